@@ -29,11 +29,20 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <vector>
+#include <sstream>
+#include <cstring>         // std::memcpy
+#include <random>          // std::mt19937
+#include <algorithm>       // std::shuffle
+#include <set>
+#include <unordered_set>
 
 // GTpo headers
 #include <GTpo>
 #include "../src/algorithm.h"
 #include "../src/generator.h"
+#include "../src/binary_format.h"
+#include "../src/parallel.h"
 
 // Google Benchmark
 #include <benchmark/benchmark.h>
@@ -70,6 +79,15 @@ struct config_no_dynamic final :  public gtpo::config<config_no_dynamic>
 };
 using graph_no_dynamic = gtpo::graph<config_no_dynamic>;
 
+struct config_pool final :  public gtpo::config<config_pool>
+{
+    template <class T>
+    using node_allocator_t = gtpo::pool_allocator<T>;
+    template <class T>
+    using edge_allocator_t = gtpo::pool_allocator<T>;
+};
+using graph_pool = gtpo::graph<config_pool>;
+
 
 using graph_complete = gtpo::graph<>;
 
@@ -126,10 +144,19 @@ static void BM_GraphComplete(benchmark::State& state)
     }
 }
 
+static void BM_GraphPool(benchmark::State& state)
+{
+    graph_pool g;
+    for (auto _ : state) {
+        impl::benchmark(g);
+    }
+}
+
 BENCHMARK(BM_GraphRaw);
 BENCHMARK(BM_GraphAdjacent);
 BENCHMARK(BM_GraphNoDynamic);
 BENCHMARK(BM_GraphComplete);
+BENCHMARK(BM_GraphPool);
 
 
 static std::vector<std::unique_ptr<gtpo::graph<>>>  bin_trees;
@@ -148,6 +175,35 @@ static void BM_linearize_tree_dfs_rec(benchmark::State& state)
         auto r = gtpo::linearize_tree_dfs_rec(*g);
     }
 }
+static void BM_linearize_dfs_csr_on_tree(benchmark::State& state)
+{
+    const gtpo::csr_view<gtpo::graph<>> csr{*bin_trees[state.range(0)]};
+    for (auto _ : state) {
+        auto r = gtpo::linearize_dfs(csr);
+    }
+}
+static void BM_topological_sort_csr_on_tree(benchmark::State& state)
+{
+    const gtpo::csr_view<gtpo::graph<>> csr{*bin_trees[state.range(0)]};
+    for (auto _ : state) {
+        auto r = gtpo::topological_sort(csr);
+    }
+}
+static void BM_is_dag_csr_on_tree(benchmark::State& state)
+{
+    const gtpo::csr_view<gtpo::graph<>> csr{*bin_trees[state.range(0)]};
+    for (auto _ : state) {
+        auto r = gtpo::is_dag(csr);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_parallel_topological_levels_on_tree(benchmark::State& state)
+{
+    const gtpo::csr_view<gtpo::graph<>> csr{*bin_trees[state.range(0)]};
+    for (auto _ : state) {
+        auto r = gtpo::parallel_topological_levels(csr);
+    }
+}
 BENCHMARK(BM_linearize_dfs_on_tree)->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
     return *(std::max_element(std::begin(v), std::end(v)));
   })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
@@ -158,10 +214,468 @@ BENCHMARK(BM_linearize_tree_dfs_rec)->ComputeStatistics("max", [](const std::vec
   })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
     return *(std::min_element(std::begin(v), std::end(v)));
   })->DenseRange(0, 14, 1);
+BENCHMARK(BM_linearize_dfs_csr_on_tree)->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+  })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+  })->DenseRange(0, 14, 1);
+BENCHMARK(BM_topological_sort_csr_on_tree)->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+  })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+  })->DenseRange(0, 14, 1);
+BENCHMARK(BM_is_dag_csr_on_tree)->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+  })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+  })->DenseRange(0, 14, 1);
+BENCHMARK(BM_parallel_topological_levels_on_tree)->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+    return *(std::max_element(std::begin(v), std::end(v)));
+  })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+    return *(std::min_element(std::begin(v), std::end(v)));
+  })->DenseRange(0, 14, 1);
+
+// Recursive vs iterative (explicit stack) tree algorithms
+static void tree_statistics(benchmark::internal::Benchmark* b)
+{
+    b->ComputeStatistics("max", [](const std::vector<double>& v) -> double {
+        return *(std::max_element(std::begin(v), std::end(v)));
+      })->ComputeStatistics("min", [](const std::vector<double>& v) -> double {
+        return *(std::min_element(std::begin(v), std::end(v)));
+      })->DenseRange(0, 14, 1);
+}
+static void BM_linearize_tree_dfs(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::linearize_tree_dfs(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_levelize_tree_dfs_rec(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::levelize_tree_dfs_rec(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_levelize_tree_dfs(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::levelize_tree_dfs(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_is_dag_rec(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::is_dag_rec(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_is_dag(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::is_dag(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_tree_depth_rec(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::tree_depth_rec(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+static void BM_tree_depth(benchmark::State& state)
+{
+    const auto g = bin_trees[state.range(0)].get();
+    for (auto _ : state) {
+        auto r = gtpo::tree_depth(*g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_linearize_tree_dfs)->Apply(tree_statistics);
+BENCHMARK(BM_levelize_tree_dfs_rec)->Apply(tree_statistics);
+BENCHMARK(BM_levelize_tree_dfs)->Apply(tree_statistics);
+BENCHMARK(BM_is_dag_rec)->Apply(tree_statistics);
+BENCHMARK(BM_is_dag)->Apply(tree_statistics);
+BENCHMARK(BM_tree_depth_rec)->Apply(tree_statistics);
+BENCHMARK(BM_tree_depth)->Apply(tree_statistics);
+
+// Sparse random graph generation, sweep up to ~1M edges (average out degree is 8)
+static void BM_gnp_random_graph(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        gtpo::graph<> g;
+        gtpo::gnp_random_graph(g, n, 8. / n);
+        state.counters["edges"] = g.get_edge_count();
+    }
+}
+static void BM_random_dag(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        gtpo::graph<> g;
+        gtpo::random_dag(g, n, 16. / n);
+        state.counters["edges"] = g.get_edge_count();
+    }
+}
+static void BM_barabasi_albert_graph(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        gtpo::graph<> g;
+        gtpo::barabasi_albert_graph(g, n, 8);
+        state.counters["edges"] = g.get_edge_count();
+    }
+}
+static void BM_is_dag_random_dag(benchmark::State& state)
+{
+    gtpo::graph<> g;
+    gtpo::random_dag(g, static_cast<int>(state.range(0)), 16. / state.range(0));
+    state.counters["edges"] = g.get_edge_count();
+    for (auto _ : state) {
+        auto r = gtpo::is_dag(g);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_gnp_random_graph)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_random_dag)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_barabasi_albert_graph)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_is_dag_random_dag)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMillisecond);
+
+// Binary graph bulk load (average out degree is 1, ie ~2 * n elements), buffer is validated on every iteration
+static void BM_load_binary_graph(benchmark::State& state)
+{
+    gtpo::graph<> g;
+    gtpo::gnp_random_graph(g, static_cast<int>(state.range(0)), 1. / state.range(0));
+    std::ostringstream os;
+    gtpo::write_binary_graph(g, os);
+    const auto data = os.str();
+    std::vector<std::uint64_t> buffer((data.size() + 7) / 8);
+    std::memcpy(buffer.data(), data.data(), data.size());
+    state.counters["edges"] = g.get_edge_count();
+    state.counters["bytes"] = static_cast<double>(data.size());
+    for (auto _ : state) {
+        const gtpo::binary_graph_view view{buffer.data(), data.size()};
+        gtpo::graph<> g2;
+        auto nodes = gtpo::load_binary_graph(g2, view);
+        benchmark::DoNotOptimize(nodes);
+    }
+}
+BENCHMARK(BM_load_binary_graph)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMillisecond);
+
+// Node reordering: linearize_dfs() on a csr_view of a binary tree whose nodes are inserted in random order,
+// range(1) is the reorder policy (-1 keep insertion order, see gtpo::reorder_policy)
+static void BM_linearize_dfs_csr_reordered(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> nodes;
+    nodes.reserve(n);
+    for ( int i = 0; i < n; ++i )
+        nodes.push_back(g.create_node());
+    std::mt19937 generator{42};
+    std::shuffle(nodes.begin() + 1, nodes.end(), generator);     // Keep root first
+    std::vector<gtpo::graph<>::shared_edge_t> edges;
+    edges.reserve(n);
+    for ( int i = 1; i < n; ++i )
+        edges.push_back(std::make_shared<gtpo::graph<>::edge_t>(nodes[(i - 1) / 2], nodes[i]));
+    g.insert_edges(edges.cbegin(), edges.cend());   // Root nodes cache is reconciled once
+    if ( state.range(1) >= 0 )
+        g.reorder(static_cast<gtpo::reorder_policy>(state.range(1)));
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    for (auto _ : state) {
+        auto r = gtpo::linearize_dfs(csr);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_linearize_dfs_csr_reordered)->ArgsProduct({{1 << 14, 1 << 17, 1 << 20}, {-1, 0, 1, 2}})->Unit(benchmark::kMillisecond);
+
+// Dynamic vs static only behaviours: memory per node/edge and insertion throughput (range is limited since
+// create_edge() root nodes maintenance is O(root nodes count))
+namespace impl {  // ::impl
+
+static std::size_t  allocated_bytes = 0;
+
+// Minimal allocator counting bytes allocated with std::allocate_shared() (control block included)
+template <class T>
+struct counting_allocator
+{
+    using value_type = T;
+    counting_allocator() noexcept = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept { }
+    T*      allocate(std::size_t n) { allocated_bytes += n * sizeof(T); return std::allocator<T>{}.allocate(n); }
+    void    deallocate(T* p, std::size_t n) noexcept { std::allocator<T>{}.deallocate(p, n); }
+};
+template <class T, class U>
+bool operator==(const counting_allocator<T>&, const counting_allocator<U>&) noexcept { return true; }
+template <class T, class U>
+bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&) noexcept { return false; }
+
+} // :impl
+
+struct config_counted_dynamic final : public gtpo::config<config_counted_dynamic>
+{
+    template <class T>
+    using node_allocator_t = impl::counting_allocator<T>;
+    template <class T>
+    using edge_allocator_t = impl::counting_allocator<T>;
+};
+
+struct config_counted_static final : public gtpo::static_behaviours_config<config_counted_static>
+{
+    template <class T>
+    using node_allocator_t = impl::counting_allocator<T>;
+    template <class T>
+    using edge_allocator_t = impl::counting_allocator<T>;
+};
+
+template <class graph_t>
+static void BM_insert_behaviours(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<typename graph_t::weak_node_t> nodes(n);
+    for (auto _ : state) {
+        graph_t g;
+        impl::allocated_bytes = 0;
+        for ( auto& node : nodes )
+            node = g.create_node();
+        const auto node_bytes = impl::allocated_bytes;
+        for ( std::size_t i = 0; i < n; ++i ) {     // Out degree is 4
+            g.create_edge(nodes[i], nodes[(i + 1) % n]);
+            g.create_edge(nodes[i], nodes[(i * 7 + 3) % n]);
+            g.create_edge(nodes[i], nodes[(i * 13 + 5) % n]);
+            g.create_edge(nodes[i], nodes[(i * 31 + 11) % n]);
+        }
+        state.counters["node_bytes"] = static_cast<double>(node_bytes) / n;
+        state.counters["edge_bytes"] = static_cast<double>(impl::allocated_bytes - node_bytes) / (4 * n);
+    }
+    state.counters["sizeof_node"] = sizeof(typename graph_t::node_t);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n * 5));   // Nodes and edges insertion per second
+}
+BENCHMARK_TEMPLATE(BM_insert_behaviours, gtpo::graph<config_counted_dynamic>)->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_insert_behaviours, gtpo::graph<config_counted_static>)->RangeMultiplier(4)->Range(1 << 8, 1 << 12)->Unit(benchmark::kMillisecond);
+
+// Container policy matrix: config_t containers, search container and adjacency index combinations measured for
+// insert, remove, contains, find_edge and traversal workloads, range(0) is node count and range(1) graph shape
+// (0 sparse random graph, 1 hub graph where half of edges target 1% of nodes, 2 binary tree), out degree is 4.
+struct config_policy_vector final : public gtpo::config<config_policy_vector>
+{
+};
+
+struct config_policy_list final : public gtpo::config<config_policy_list>
+{
+    template <class...Ts>
+    using node_container_t = std::list<Ts...>;
+    template <class...Ts>
+    using edge_container_t = std::list<Ts...>;
+};
+
+struct config_policy_list_adjacency final : public gtpo::config<config_policy_list_adjacency>
+{
+    template <class...Ts>
+    using adjacent_edges_container_t = std::list<Ts...>;
+    template <class...Ts>
+    using adjacent_nodes_container_t = std::list<Ts...>;
+};
+
+struct config_policy_ordered_search final : public gtpo::config<config_policy_ordered_search>
+{
+    template <class T>
+    using search_container_t = std::set<T, std::owner_less<T>>;
+};
+
+struct config_policy_indexed final : public gtpo::config<config_policy_indexed>
+{
+    static constexpr bool   enable_adjacency_index = true;
+};
+
+struct config_policy_throughput final : public gtpo::high_throughput_config<config_policy_throughput>
+{
+};
+
+namespace impl {  // ::impl
+
+template <class graph_t>
+struct policy_graph
+{
+    std::vector<typename graph_t::weak_node_t>                                          nodes;
+    std::vector<std::pair<typename graph_t::weak_node_t, typename graph_t::weak_node_t>> pairs;    // Existing edges (src, dst)
+};
+
+template <class graph_t>
+static auto make_policy_graph(graph_t& g, std::size_t n, int shape) -> policy_graph<graph_t>
+{
+    policy_graph<graph_t> p;
+    p.nodes.reserve(n);
+    for ( std::size_t i = 0; i < n; ++i )
+        p.nodes.push_back(g.create_node());
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> any(0, n - 1);
+    std::uniform_int_distribution<std::size_t> hub(0, n / 100);
+    const auto connect = [&g, &p](std::size_t s, std::size_t d) {
+        g.create_edge(p.nodes[s], p.nodes[d]);
+        p.pairs.emplace_back(p.nodes[s], p.nodes[d]);
+    };
+    p.pairs.reserve(n * 4);
+    for ( std::size_t s = 0; s < n; ++s ) {
+        if ( shape == 2 ) {             // Binary tree (out degree 2)
+            if ( 2 * s + 1 < n ) connect(s, 2 * s + 1);
+            if ( 2 * s + 2 < n ) connect(s, 2 * s + 2);
+            continue;
+        }
+        for ( int e = 0; e < 4; ++e )
+            connect(s, shape == 1 && (e & 1) ? hub(gen) : any(gen));
+    }
+    return p;
+}
+
+static void policy_matrix(benchmark::internal::Benchmark* b)
+{
+    b->ArgsProduct({{1 << 10, 1 << 14}, {0, 1, 2}})->Unit(benchmark::kMicrosecond);
+}
+
+} // :impl
+
+template <class graph_t>
+static void BM_policy_insert(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::size_t items = 0;
+    for (auto _ : state) {
+        graph_t g;
+        const auto p = impl::make_policy_graph(g, n, static_cast<int>(state.range(1)));
+        items += p.nodes.size() + p.pairs.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(items));
+}
+
+template <class graph_t>
+static void BM_policy_remove(benchmark::State& state)
+{
+    // Remove 10% of edges one by one, then 10% of nodes (with their adjacent edges) in one batch
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::size_t items = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto g = std::make_unique<graph_t>();
+        auto p = impl::make_policy_graph(*g, n, static_cast<int>(state.range(1)));
+        std::mt19937 gen{7};
+        std::shuffle(p.pairs.begin(), p.pairs.end(), gen);
+        p.pairs.resize(p.pairs.size() / 10);
+        std::shuffle(p.nodes.begin(), p.nodes.end(), gen);
+        p.nodes.resize(n / 10);
+        state.ResumeTiming();
+        for ( const auto& pair : p.pairs ) {
+            const auto edge = g->find_edge(pair.first, pair.second);
+            if ( !edge.expired() )
+                g->remove_edge(edge);
+        }
+        g->remove_nodes(p.nodes.cbegin(), p.nodes.cend());
+        items += p.pairs.size() + p.nodes.size();
+        state.PauseTiming();
+        g.reset();                      // Graph destruction is not measured
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(items));
+}
+
+template <class graph_t>
+static void BM_policy_contains(benchmark::State& state)
+{
+    graph_t g;
+    const auto p = impl::make_policy_graph(g, static_cast<std::size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    std::vector<typename graph_t::weak_edge_t> edges;
+    for ( const auto& edge : g.get_edges() )
+        edges.push_back(edge);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for ( const auto& node : p.nodes )
+            found += g.contains(node) ? 1 : 0;
+        for ( const auto& edge : edges )
+            found += g.contains(edge) ? 1 : 0;
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (p.nodes.size() + edges.size())));
+}
+
+template <class graph_t>
+static void BM_policy_find_edge(benchmark::State& state)
+{
+    // Half queries hit an existing edge, half miss (reversed existing edges, absent in a tree)
+    graph_t g;
+    const auto p = impl::make_policy_graph(g, static_cast<std::size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for ( const auto& pair : p.pairs ) {
+            found += g.find_edge(pair.first, pair.second).expired() ? 0 : 1;
+            found += g.find_edge(pair.second, pair.first).expired() ? 0 : 1;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * p.pairs.size() * 2));
+}
+
+template <class graph_t>
+static void BM_policy_traversal(benchmark::State& state)
+{
+    // Breadth first traversal from every root node following node out edges (no csr_view)
+    graph_t g;
+    const auto p = impl::make_policy_graph(g, static_cast<std::size_t>(state.range(0)), static_cast<int>(state.range(1)));
+    using node_t = typename graph_t::node_t;
+    std::unordered_set<const node_t*> visited;
+    std::vector<typename graph_t::shared_node_t> queue;
+    visited.reserve(p.nodes.size());
+    queue.reserve(p.nodes.size());
+    for (auto _ : state) {
+        visited.clear();
+        queue.clear();
+        for ( const auto& node : p.nodes )     // Not only root nodes: random graphs have (almost) no root nodes
+            if ( visited.insert(node.lock().get()).second )
+                queue.push_back(node.lock());
+        for ( std::size_t q = 0; q < queue.size(); ++q )
+            for ( const auto& out_edge : queue[q]->get_out_edges() ) {
+                const auto edge = out_edge.lock();
+                auto dst = edge ? edge->get_dst().lock() : nullptr;
+                if ( dst && visited.insert(dst.get()).second )
+                    queue.push_back(std::move(dst));
+            }
+        benchmark::DoNotOptimize(queue.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (p.nodes.size() + p.pairs.size())));
+}
+
+#define GTPO_POLICY_BENCHMARKS(config)                                                                   \
+    BENCHMARK_TEMPLATE(BM_policy_insert, gtpo::graph<config>)->Apply(impl::policy_matrix);              \
+    BENCHMARK_TEMPLATE(BM_policy_remove, gtpo::graph<config>)->Apply(impl::policy_matrix);              \
+    BENCHMARK_TEMPLATE(BM_policy_contains, gtpo::graph<config>)->Apply(impl::policy_matrix);            \
+    BENCHMARK_TEMPLATE(BM_policy_find_edge, gtpo::graph<config>)->Apply(impl::policy_matrix);           \
+    BENCHMARK_TEMPLATE(BM_policy_traversal, gtpo::graph<config>)->Apply(impl::policy_matrix);
+
+GTPO_POLICY_BENCHMARKS(config_policy_vector)
+GTPO_POLICY_BENCHMARKS(config_policy_list)
+GTPO_POLICY_BENCHMARKS(config_policy_list_adjacency)
+GTPO_POLICY_BENCHMARKS(config_policy_ordered_search)
+GTPO_POLICY_BENCHMARKS(config_policy_indexed)
+GTPO_POLICY_BENCHMARKS(config_policy_throughput)
 
 int main(int argc, char** argv) {
     // Generate CSV with following command:
     // ./gtpo_benchmarks --benchmark_filter=BM_linearize  --benchmark_report_aggregates_only=true --benchmark_repetitions=4 --benchmark_out_format=csv  --benchmark_out=linearize_dfs_tree.csv
+    // Compare recursive and iterative tree algorithms with --benchmark_filter="BM_(levelize|is_dag|tree_depth)"
+    // Random graph generators sweep with --benchmark_filter="BM_(gnp|random_dag|barabasi|is_dag_random)"
+    // Dynamic vs static only behaviours memory and throughput with --benchmark_filter=BM_insert_behaviours
+    // Node reordering effect on CSR traversals with --benchmark_filter=BM_linearize_dfs_csr_reordered
+    // Container policies matrix with --benchmark_filter=BM_policy (or BM_policy_find_edge, BM_policy_.*config_policy_list, etc.)
 
     // Generate candidate trees
     for ( int depth = 0; depth < 15; depth++ ) {
@@ -5,6 +5,7 @@ QT          += core
 INCLUDEPATH += $$PWD/src        # Project using this pri could include <gtpo/GTpo> just as if the library was installed in /usr/include/gtpo
 
 HEADERS +=  $$PWD/src/gtpo/utils.h                \
+            $$PWD/src/gtpo/concurrency.h          \
             $$PWD/src/gtpo/config.h               \
             $$PWD/src/gtpo/edge.h                 \
             $$PWD/src/gtpo/edge.hpp               \
@@ -15,10 +16,16 @@ HEADERS +=  $$PWD/src/gtpo/utils.h                \
             $$PWD/src/gtpo/graph_property.h       \
             $$PWD/src/gtpo/algorithm.h            \
             $$PWD/src/gtpo/algorithm.hpp          \
+            $$PWD/src/gtpo/csr_view.h             \
+            $$PWD/src/gtpo/csr_view.hpp           \
+            $$PWD/src/gtpo/parallel.h             \
+            $$PWD/src/gtpo/parallel.hpp           \
             $$PWD/src/gtpo/functional.h           \
             $$PWD/src/gtpo/generator.h            \
             $$PWD/src/gtpo/generator.hpp          \
             $$PWD/src/gtpo/behaviour.h            \
+            $$PWD/src/gtpo/binary_format.h        \
+            $$PWD/src/gtpo/binary_format.hpp      \
             $$PWD/src/gtpo/behaviourable.h        \
             $$PWD/src/gtpo/behaviourable.hpp      \
             $$PWD/src/gtpo/graph_behaviour.h      \
@@ -26,6 +33,19 @@ HEADERS +=  $$PWD/src/gtpo/utils.h                \
             $$PWD/src/gtpo/node_behaviour.h       \
             $$PWD/src/gtpo/node_behaviour.hpp     \
             $$PWD/src/gtpo/container_adapter.h    \
+            $$PWD/src/gtpo/pool_allocator.h       \
+            $$PWD/src/gtpo/reachability.h         \
+            $$PWD/src/gtpo/reachability.hpp       \
+            $$PWD/src/gtpo/reorder.h              \
+            $$PWD/src/gtpo/reorder.hpp            \
+            $$PWD/src/gtpo/snapshot.h             \
+            $$PWD/src/gtpo/handle.h               \
+            $$PWD/src/gtpo/topological_order.h    \
+            $$PWD/src/gtpo/topological_order.hpp  \
+            $$PWD/src/gtpo/fingerprint.h          \
+            $$PWD/src/gtpo/fingerprint.hpp        \
+            $$PWD/src/gtpo/topology_diff.h        \
+            $$PWD/src/gtpo/topology_diff.hpp      \
             $$PWD/src/gtpo/GTpo.h
 
 OTHER_FILES += $$PWD/src/gtpo/GTpo
@@ -36,18 +36,27 @@
 #define gtpo_algorithm_h
 
 // STD headers
+#include <algorithm>        // std::fill std::max
 #include <list>
 #include <unordered_set>
 #include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
 #include <iterator>         // std::forward_iterator_tag
 #include <unordered_map>
 #include <stack>
+#include <queue>
+#include <vector>
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <utility>          // std::pair
+#include <limits>           // std::numeric_limits
+#include <stdexcept>        // std::invalid_argument
 
 // GTpo headers
 #include "./utils.h"
 #include "./config.h"
 #include "./edge.h"
 #include "./node.h"
+#include "./csr_view.h"
 
 namespace gtpo { // ::gtpo
 
@@ -66,6 +75,103 @@ class graph;
  */
 template <class graph_t>
 auto    collect_adjacent_edges(const typename graph_t::weak_node_t& node) noexcept -> std::unordered_set<typename graph_t::weak_node_t>;
+
+/*! \brief Call \c f with every (non expired) in and out edge of \c node, without allocation.
+ *
+ * \c f is called with a shared_edge_t, a trivial circuit edge is visited once. Complexity is O(node degree).
+ * \code
+ *   gtpo::for_each_adjacent_edge(*node, [](const auto& edge) { std::cout << edge.get(); });
+ * \endcode
+ * \warning \c f must not modify \c node topology.
+ */
+template <class node_t, class functor_t>
+auto    for_each_adjacent_edge(const node_t& node, functor_t&& f) -> void;
+
+/*! \brief Append restricted hyper edges depending (directly or transitively) on \c edges to \c edges, then sort \c edges in dependency order.
+ *
+ * Dependents are found with the per target edge index (edge::get_in_hedges()), an edge is never stored twice. On return,
+ * an hyper edge is always stored after its destination edge: updating \c edges geometry in order update each
+ * dependent once, after its destination. Complexity is O(n.log(n)) with n the number of collected edges.
+ * \note \c edges must not contain nullptr.
+ */
+template <class edge_t>
+auto    order_hyper_dependents(std::vector<edge_t*>& edges) -> void;
+//-----------------------------------------------------------------------------
+
+/* Allocation Free Traversal *///----------------------------------------------
+/*! \brief Reusable visited node marks keyed by node handle index (see node<>::get_id()).
+ *
+ * All marks are cleared in O(1) by reset(): an epoch counter is incremented (storage is only cleared when
+ * counter wraps around). Once storage has grown to graph node slot count, a traversal using a long lived
+ * visit_marks does not allocate.
+ * \warning Not thread safe, use one visit_marks per thread.
+ */
+class visit_marks
+{
+public:
+    visit_marks() = default;
+
+    //! Start a new traversal: every node is unmarked, O(1).
+    inline auto reset() noexcept -> void {
+        if ( ++_epoch == 0 ) {
+            std::fill( _epochs.begin(), _epochs.end(), 0 );
+            _epoch = 1;
+        }
+    }
+    //! Mark node with handle \c index, return false if it was already marked since last reset().
+    inline auto mark( std::uint32_t index ) -> bool {
+        if ( index >= _epochs.size() )
+            _epochs.resize( std::max<std::size_t>( std::size_t{index} + 1, _epochs.size() * 2 ), 0 );
+        if ( _epochs[index] == _epoch )
+            return false;
+        _epochs[index] = _epoch;
+        return true;
+    }
+    //! Return true if node with handle \c index has been marked since last reset().
+    inline auto is_marked( std::uint32_t index ) const noexcept -> bool {
+        return index < _epochs.size() && _epochs[index] == _epoch;
+    }
+
+private:
+    std::vector<std::uint32_t>  _epochs;
+    std::uint32_t               _epoch = 1;
+};
+
+/*! \brief Reusable scratch state of collect_dfs(): visited marks and DFS stack.
+ *
+ * Keep one dfs_scratch alive across traversals (for example as a graph member) to avoid allocations.
+ */
+template <class node_t>
+struct dfs_scratch
+{
+    visit_marks                 marks;
+    std::vector<const node_t*>  stack;
+};
+
+/*! \brief Write nodes reachable from \c node out nodes to \c out in DFS preorder, return end of output range.
+ *
+ * \c node itself is written only if it is reachable from one of its out nodes (ie \c node is part of a circuit).
+ * With \c collect_group, nodes of a visited group are visited before its out nodes. Nodes that are not registered
+ * in a graph (with an invalid node<>::get_id() handle) are ignored.
+ * \code
+ *   gtpo::dfs_scratch<node_t> scratch;     // Long lived
+ *   std::vector<const node_t*> nodes;       // Could be reused too, or use any output iterator
+ *   gtpo::collect_dfs(*root, std::back_inserter(nodes), scratch);
+ * \endcode
+ * \note Traversal is iterative, there is no recursion depth limit.
+ */
+template <class node_t, class output_it>
+auto    collect_dfs(const node_t& node, output_it out, dfs_scratch<node_t>& scratch,
+                    bool collect_group = false) -> output_it;
+
+/*! \brief Write nodes reachable from a range [\c first, \c last) of start nodes (start nodes included) to \c out in DFS preorder.
+ *
+ * Nodes are written once, even if reachable from multiple start nodes (use graph root nodes to linearize a graph).
+ * \note \c forward_it must dereference to a weak or shared pointer on node_t.
+ */
+template <class node_t, class forward_it, class output_it>
+auto    collect_dfs(forward_it first, forward_it last, output_it out, dfs_scratch<node_t>& scratch,
+                    bool collect_group = false) -> output_it;
 //-----------------------------------------------------------------------------
 
 
@@ -75,6 +181,55 @@ auto    collect_adjacent_edges(const typename graph_t::weak_node_t& node) noexce
  */
 template <class graph_t>
 auto    linearize_dfs(const graph_t& graph) noexcept -> std::vector<typename graph_t::weak_node_t>;
+
+/*! \brief Return true if a graph is an acyclic graph (DAG), ie it does not contains circuits.
+ *
+ *  Iterative version of is_dag_rec() using an explicit three colors DFS stack.
+ *
+ *  \note is_dag() will return true for an empty graph.
+ *  \note complexity is O(V + E).
+ *  \note Iterative algorithm, work stack is preallocated, there is no recursion overflow risk.
+ */
+template <class graph_t>
+auto    is_dag(const graph_t& graph) noexcept -> bool;
+
+/*! \brief Return true if a graph is actually a tree (ie it does not not contains circuits and nodes maximum indegree <= 1).
+ *
+ *  Iterative version of is_tree_rec(), a forest is also considered a tree.
+ *
+ *  \note is_tree() will return true for an empty graph.
+ *  \note complexity is O(V + E).
+ *  \note Iterative algorithm, work stack is preallocated, there is no recursion overflow risk.
+ */
+template <class graph_t>
+auto    is_tree(const graph_t& graph) noexcept -> bool;
+
+/*! \brief Compute and return tree depth (number of nodes on the longest path from a root node).
+ *
+ *  Iterative version of tree_depth_rec(), traversal start from graph root nodes.
+ *
+ *  \note Iterative algorithm, depth is bounded by graph node count, so a circuit can't lead to an infinite traversal.
+ */
+template <class graph_t>
+auto    tree_depth(const graph_t& graph) noexcept -> int;
+
+/*! \brief Return a linearized DFS ordered version of a given tree.
+ *
+ *  Iterative version of linearize_tree_dfs_rec() (same order), traversal start from graph root nodes.
+ *
+ *  \note Iterative algorithm, depth is bounded by graph node count, so a circuit can't lead to an infinite traversal.
+ */
+template <class graph_t>
+auto    linearize_tree_dfs(const graph_t& graph) noexcept -> std::vector<typename graph_t::weak_node_t>;
+
+/*! \brief Return nodes ordered by their level in DFS order.
+ *
+ *  Iterative version of levelize_tree_dfs_rec() (same order), traversal start from graph root nodes.
+ *
+ *  \note Iterative algorithm, levels are bounded by graph node count, so a circuit can't lead to an infinite traversal.
+ */
+template <class graph_t>
+auto    levelize_tree_dfs(const graph_t& graph) noexcept -> std::vector<std::vector<typename graph_t::weak_node_t > >;
 //-----------------------------------------------------------------------------
 
 
@@ -86,7 +241,7 @@ auto    linearize_dfs(const graph_t& graph) noexcept -> std::vector<typename gra
  *  \note is_dag_rec() will return true for a graph with only one vertice.
  *  \note complexity is at most O(n) with n beeing number of vertices in input \c graph.
  *  \note Mandatory static behaviours: none
- *  \note Recursive algorithm with no overflow protection.
+ *  \note Recursive algorithm with no overflow protection, use is_dag() for deep graphs.
  */
 template <class graph_t>
 auto    is_dag_rec(const graph_t& graph) noexcept -> bool;
@@ -101,7 +256,7 @@ auto    is_dag_rec(const graph_t& graph) noexcept -> bool;
  *  \note is_tree_rec() will return true for a graph with only one vertice.
  *  \note complexity is at most O(2n) with n beeing number of vertices in input \c graph.
  *  \note Mandatory static behaviours: none
- *  \note Recursive algorithm with no overflow protection.
+ *  \note Recursive algorithm with no overflow protection, use is_tree() for deep graphs.
  */
 template <class graph_t>
 auto    is_tree_rec(const graph_t& graph) noexcept -> bool;
@@ -110,7 +265,7 @@ auto    is_tree_rec(const graph_t& graph) noexcept -> bool;
  *
  *  FIXME: Warning, depend on graph root nodes (graph should bot contains circuits...)
  *
- *  \note recursive algorithm with no overflow protection.
+ *  \note recursive algorithm with no overflow protection, use tree_depth() for deep graphs.
  */
 template <class graph_t>
 auto    tree_depth_rec(const graph_t& graph) noexcept -> int;
@@ -119,7 +274,7 @@ auto    tree_depth_rec(const graph_t& graph) noexcept -> int;
  *
  *  FIXME: Warning, depend on graph root nodes (graph should bot contains circuits...)
  *
- *  \note recursive algorithm with no overflow protection.
+ *  \note recursive algorithm with no overflow protection, use linearize_tree_dfs() for deep graphs.
  */
 template <class graph_t>
 auto    linearize_tree_dfs_rec(const graph_t& graph) noexcept -> std::vector<typename graph_t::weak_node_t>;
@@ -128,15 +283,120 @@ auto    linearize_tree_dfs_rec(const graph_t& graph) noexcept -> std::vector<typ
  *
  *  FIXME: Warning, depend on graph root nodes (graph should bot contains circuits...)
  *
- *  \note recursive algorithm with no overflow protection.
+ *  \note recursive algorithm with no overflow protection, use levelize_tree_dfs() for deep graphs.
  */
 template <class graph_t>
 auto    levelize_tree_dfs_rec(const graph_t& graph) noexcept -> std::vector<std::vector<typename graph_t::weak_node_t > >;
 //-----------------------------------------------------------------------------
 
 
+/* CSR View Graph Traversal Algorithms *///------------------------------------
+/*! \brief Return a linearized DFS ordered version of a csr_view snapshot \c csr (result contains dense node indexes).
+ *
+ * Same traversal order than linearize_dfs() on the source graph, without any weak_ptr locking.
+ *
+ *  \note complexity is O(V + E).
+ *  \note Iterative algorithm.
+ */
+template <class graph_t, class index_t>
+auto    linearize_dfs(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>;
 
-/* BFS Graph Iterator *///-----------------------------------------------------
+/*! \brief Return true if a csr_view snapshot \c csr is an acyclic graph (DAG), ie it does not contains circuits.
+ *
+ *  \note will return true for an empty snapshot.
+ *  \note complexity is O(V + E).
+ *  \note Iterative algorithm (three colors DFS), there is no recursion overflow risk.
+ */
+template <class graph_t, class index_t>
+auto    is_dag_rec(const csr_view<graph_t, index_t>& csr) -> bool;
+
+/*! \brief Return csr_view snapshot \c csr nodes ordered by their level in DFS order (result contains dense node indexes).
+ *
+ *  Same result than levelize_tree_dfs_rec() on the source graph, traversal start from source graph root nodes.
+ *
+ *  \note Iterative algorithm, levels are bounded by node count, so a circuit can't lead to an infinite traversal.
+ */
+template <class graph_t, class index_t>
+auto    levelize_tree_dfs_rec(const csr_view<graph_t, index_t>& csr) -> std::vector<std::vector<index_t>>;
+
+/*! \brief Return csr_view snapshot \c csr nodes in topological order using Kahn algorithm (result contains dense node indexes).
+ *
+ * For every edge \c a -> \c b, \c a is ordered before \c b. Nodes with no in edges are ordered first by
+ * increasing index, ready nodes are then consumed in FIFO order, so result is deterministic for a given snapshot.
+ *
+ *  \note When \c csr contains a circuit, nodes on a circuit (or reachable from a circuit) are not ordered and
+ *  result contains less than csr.get_node_count() nodes.
+ *  \note complexity is O(V + E).
+ *  \note Iterative algorithm, see gtpo::parallel_topological_levels() for a parallel variant on wide DAGs.
+ */
+template <class graph_t, class index_t>
+auto    topological_sort(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>;
+
+/*! \brief Return true if a csr_view snapshot \c csr is an acyclic graph (DAG), using Kahn algorithm.
+ *
+ *  Same result than is_dag_rec(csr), without DFS stack: all nodes are topologically sorted if and only if
+ *  \c csr contains no circuit.
+ *
+ *  \note will return true for an empty snapshot.
+ *  \note complexity is O(V + E).
+ */
+template <class graph_t, class index_t>
+auto    is_dag(const csr_view<graph_t, index_t>& csr) -> bool;
+
+/*! \brief Return strongly connected component id of every csr_view snapshot \c csr node (indexed by dense node index).
+ *
+ * Component ids are dense in [0, component count), they are assigned in Tarjan completion order: when an edge
+ * \c a -> \c b cross two components, \c a component id is greater than \c b component id (ie ids are a reverse
+ * topological order of the condensation graph).
+ *
+ *  \note complexity is O(V + E).
+ *  \note Iterative Tarjan algorithm using an explicit stack, there is no recursion overflow risk.
+ *  \sa gtpo::weakly_connected_components()
+ */
+template <class graph_t, class index_t>
+auto    strongly_connected_components(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>;
+//-----------------------------------------------------------------------------
+
+
+/* CSR View Path and Neighbourhood Queries *///--------------------------------
+//! Edge direction followed by gtpo::k_hop_neighbourhood().
+enum class traversal_direction {
+    out,        //!< Follow out edges only.
+    in,         //!< Follow in edges only.
+    both        //!< Consider edges undirected.
+};
+
+/*! \brief Return a shortest directed path from \c source to \c target in csr_view snapshot \c csr (result contains dense node indexes, \c source first).
+ *
+ * When \c csr is weighted (see csr_view::rebuild(const graph_t&, weight_fn_t)), Dijkstra algorithm is used with
+ * a binary heap and stop as soon as \c target is settled (O((V + E) log(V)) at worst). Otherwise, a bidirectional
+ * BFS minimizing edge count expand the smallest frontier first, from \c source following out edges and from \c target
+ * following in edges (O(V + E) at worst, usually far less).
+ *
+ * \code
+ *   gtpo::csr_view<gtpo::graph<>> csr;
+ *   csr.rebuild(g, [](const gtpo::graph<>::edge_t& e) { return 1.0; });
+ *   const auto path = gtpo::shortest_path(csr, csr.index_of(n1), csr.index_of(n2));
+ * \endcode
+ * \return an empty vector if \c target is not reachable from \c source (or if an index is out of range).
+ * \throw std::invalid_argument if a negative edge weight is encountered.
+ */
+template <class graph_t, class index_t>
+auto    shortest_path(const csr_view<graph_t, index_t>& csr, index_t source, index_t target) noexcept( false ) -> std::vector<index_t>;
+
+/*! \brief Return all nodes at most \c k hops away from \c sources in csr_view snapshot \c csr (result contains dense node indexes).
+ *
+ * Result is ordered by hop count (\c sources first), every node appears once. Out of range sources are ignored.
+ *  \note complexity is O(visited nodes + visited edges).
+ */
+template <class graph_t, class index_t>
+auto    k_hop_neighbourhood(const csr_view<graph_t, index_t>& csr, const std::vector<index_t>& sources, std::size_t k,
+                            traversal_direction direction = traversal_direction::both) -> std::vector<index_t>;
+//-----------------------------------------------------------------------------
+
+
+
+/* DFS Graph Iterator *///-----------------------------------------------------
 
 /*
  foraward_iterator_tag, standard:  http://www.cplusplus.com/reference/iterator/ForwardIterator/
@@ -152,8 +412,13 @@ auto    levelize_tree_dfs_rec(const graph_t& graph) noexcept -> std::vector<std:
     Lvalues are swappable.	swap(a,b)
 */
 
+/*! \brief Forward iterator over graph nodes in (iterative) depth first order.
+ *
+ * Nodes with a zero in degree (potential root or mother nodes) are traversed first, remaining
+ * unmarked nodes are traversed in a second pass. Use begin_dfs() and end_dfs() to create iterators.
+ */
 template <class graph_t>
-class bfs_iterator
+class dfs_iterator
 {
 public:
     using weak_node_t = typename graph_t::weak_node_t;
@@ -164,12 +429,12 @@ public:
     using pointer = weak_node_t*;
     using reference = int&;
 
-    //! Create an invalid bfs_iterator.
-    explicit bfs_iterator() { }
+    //! Create an invalid dfs_iterator.
+    explicit dfs_iterator() { }
 
     enum class pos_tag_t { BEGIN = 0, END = 1 };
 
-    explicit bfs_iterator(graph_t& graph, pos_tag_t pos_tag = pos_tag_t::BEGIN) :
+    explicit dfs_iterator(graph_t& graph, pos_tag_t pos_tag = pos_tag_t::BEGIN) :
         _nodes{&graph.get_nodes()}
     {
         if ( pos_tag == pos_tag_t::END ) {
@@ -184,7 +449,7 @@ public:
         }
     }
 
-    bfs_iterator& operator++()
+    dfs_iterator& operator++()
     {
         if ( _nodes == nullptr )
             return *this;
@@ -224,7 +489,7 @@ public:
         auto node = weak_node.lock();
         if ( !node )
             return;
-        for ( auto& out_node : node->get_out_nodes() ) {
+        for ( const auto& out_node : node->get_out_nodes() ) {
             if ( _marks.find(out_node) == _marks.end() )
                 _stack.push(out_node);
         }
@@ -283,7 +548,7 @@ public:
         return _node;
     }
 
-    bool operator==(const bfs_iterator<graph_t>& rhs) const
+    bool operator==(const dfs_iterator<graph_t>& rhs) const
     {
         if ( _nodes != rhs._nodes )
             return false;   // Fast exit
@@ -299,7 +564,7 @@ public:
                _node.lock().get() == rhs._node.lock().get();
     }
 
-    bool operator!=(const bfs_iterator<graph_t>& rhs) const { return !(*this == rhs); }
+    bool operator!=(const dfs_iterator<graph_t>& rhs) const { return !(*this == rhs); }
 
 private:
     typename graph_t::weak_node_t                      _node;
@@ -316,15 +581,138 @@ private:
 };
 
 template <class graph_t>
-auto    begin_dfs(graph_t& graph) noexcept -> bfs_iterator<graph_t>
+auto    begin_dfs(graph_t& graph) noexcept -> dfs_iterator<graph_t>
 {
-    return bfs_iterator<graph_t>{graph, bfs_iterator<graph_t>::pos_tag_t::BEGIN};  // RVO
+    return dfs_iterator<graph_t>{graph, dfs_iterator<graph_t>::pos_tag_t::BEGIN};  // RVO
 }
 
 template <class graph_t>
-auto    end_dfs(graph_t& graph) noexcept -> bfs_iterator<graph_t>
+auto    end_dfs(graph_t& graph) noexcept -> dfs_iterator<graph_t>
 {
     static_cast<void>(graph);
+    return dfs_iterator<graph_t>{graph, dfs_iterator<graph_t>::pos_tag_t::END};  // RVO
+}
+//-----------------------------------------------------------------------------
+
+
+/* BFS Graph Iterator *///-----------------------------------------------------
+/*! \brief Forward iterator over graph nodes in breadth first order (frontier queue).
+ *
+ * Nodes with a zero in degree (potential root or mother nodes) are used as BFS sources first, remaining
+ * unmarked nodes (circuits or non DAG connex components) are used as sources in a second pass, so
+ * every graph node is visited exactly once. Use begin_bfs() and end_bfs() to create iterators.
+ *
+ * \note For large read-only traversals, prefer gtpo::parallel_bfs() on a gtpo::csr_view snapshot.
+ */
+template <class graph_t>
+class bfs_iterator
+{
+public:
+    using weak_node_t = typename graph_t::weak_node_t;
+
+    using iterator_category = ::std::forward_iterator_tag;
+    using value_type = weak_node_t;
+    using difference_type = int;
+    using pointer = weak_node_t*;
+    using reference = int&;
+
+    //! Create an invalid bfs_iterator.
+    explicit bfs_iterator() { }
+
+    enum class pos_tag_t { BEGIN = 0, END = 1 };
+
+    explicit bfs_iterator(const graph_t& graph, pos_tag_t pos_tag = pos_tag_t::BEGIN) :
+        _nodes{&graph.get_nodes()}
+    {
+        if ( pos_tag == pos_tag_t::BEGIN ) {
+            _node_iter = graph.get_nodes().begin();
+            _marks.reserve(graph.get_node_count());
+            operator++();
+        } // Otherwise, _node is expired: this is an end iterator.
+    }
+
+    bfs_iterator& operator++()
+    {
+        _node = weak_node_t{};
+        if ( _nodes == nullptr )
+            return *this;
+        do {
+            while ( !_frontier.empty() ) {
+                auto node = _frontier.front();
+                _frontier.pop();
+                auto node_ptr = node.lock();
+                if ( !node_ptr )
+                    continue;
+                for ( const auto& out_node : node_ptr->get_out_nodes() )
+                    if ( !out_node.expired() &&
+                         _marks.insert(out_node).second )   // Nodes are marked when they are enqueued
+                        _frontier.push(out_node);
+                _node = node;
+                return *this;
+            }
+        } while ( feed_frontier() );
+        return *this;   // _nodes has been consumed, this is now an end iterator
+    }
+
+    /*! Dereference BFS iterator at current position
+     *
+     * \warning There is no out of range protection, but dereferencing an out of bound iterator does NOT lead
+     * to undefined behaviour: an expired weak_ptr is returned.
+     * \throw noexcept
+     */
+    value_type operator* () const { return _node; }
+
+    bool operator==(const bfs_iterator<graph_t>& rhs) const
+    {
+        if ( _nodes != rhs._nodes )
+            return false;   // Fast exit
+        if ( _node.expired() ||     // 2 expired current node are considered equals
+             rhs._node.expired() )
+            return _node.expired() && rhs._node.expired();
+        return _node.lock().get() == rhs._node.lock().get();
+    }
+
+    bool operator!=(const bfs_iterator<graph_t>& rhs) const { return !(*this == rhs); }
+
+private:
+    // Enqueue next unmarked BFS source: nodes with a zero in degree first, then any unmarked node.
+    bool    feed_frontier()
+    {
+        while ( true ) {
+            while ( _node_iter != _nodes->end() ) {
+                const auto& node = *_node_iter++;
+                if ( node &&
+                     ( _second_pass || node->get_in_degree() == 0 ) &&
+                     _marks.insert(node).second ) {
+                    _frontier.push(node);
+                    return true;
+                }
+            }
+            if ( _second_pass )
+                return false;
+            _second_pass = true;
+            _node_iter = _nodes->begin();
+        }
+    }
+
+    weak_node_t                                         _node;
+    const typename graph_t::shared_nodes_t*             _nodes = nullptr;
+    typename graph_t::shared_nodes_t::const_iterator    _node_iter;
+    bool                                                _second_pass = false;
+
+    ::std::unordered_set<weak_node_t>   _marks;
+    ::std::queue<weak_node_t>           _frontier;
+};
+
+template <class graph_t>
+auto    begin_bfs(const graph_t& graph) noexcept -> bfs_iterator<graph_t>
+{
+    return bfs_iterator<graph_t>{graph, bfs_iterator<graph_t>::pos_tag_t::BEGIN};  // RVO
+}
+
+template <class graph_t>
+auto    end_bfs(const graph_t& graph) noexcept -> bfs_iterator<graph_t>
+{
     return bfs_iterator<graph_t>{graph, bfs_iterator<graph_t>::pos_tag_t::END};  // RVO
 }
 //-----------------------------------------------------------------------------
@@ -35,6 +35,8 @@
 // STD headers
 #include <vector>
 #include <algorithm>
+#include <functional>     // std::greater
+#include <utility>        // std::pair
 #include <unordered_set>
 #include <stack>
 
@@ -48,6 +50,128 @@ auto    collect_adjacent_edges(const typename graph_t::weak_node_t& node) noexce
 
     return edges;   // RVO
 }
+
+template <class node_t, class functor_t>
+auto    for_each_adjacent_edge(const node_t& node, functor_t&& f) -> void
+{
+    for ( const auto& in_edge : node.get_in_edges() ) {
+        const auto edge = in_edge.lock();
+        if ( edge )
+            f( edge );
+    }
+    for ( const auto& out_edge : node.get_out_edges() ) {
+        const auto edge = out_edge.lock();
+        if ( edge &&
+             edge->get_dst().lock().get() != &node )   // A trivial circuit has already been visited as an in edge
+            f( edge );
+    }
+}
+
+template <class edge_t>
+auto    order_hyper_dependents(std::vector<edge_t*>& edges) -> void
+{
+    std::unordered_set<const edge_t*> collected{ edges.cbegin(), edges.cend() };
+    for ( std::size_t e = 0; e < edges.size(); ++e ) {     // Note: edges grow while iterating (BFS on hyper dependents)
+        for ( const auto& in_hedge : edges[e]->get_in_hedges() ) {
+            const auto hyper_edge = in_hedge.lock();
+            if ( hyper_edge &&
+                 collected.insert( hyper_edge.get() ).second )
+                edges.push_back( hyper_edge.get() );
+        }
+    }
+    // An hyper edge depth is its number of hyper destinations hops to a node -> node edge: destination depth is always lower
+    const auto depth = [](const edge_t* edge) -> std::size_t {
+        std::size_t d = 0;
+        for ( auto hdst = edge->get_hdst().lock(); hdst; hdst = hdst->get_hdst().lock() )
+            ++d;
+        return d;
+    };
+    std::vector<std::pair<std::size_t, edge_t*>> ordered;
+    ordered.reserve( edges.size() );
+    for ( const auto edge : edges )
+        ordered.emplace_back( depth( edge ), edge );
+    std::stable_sort( ordered.begin(), ordered.end(), [](const auto& a, const auto& b) { return a.first < b.first; } );
+    for ( std::size_t e = 0; e < ordered.size(); ++e )
+        edges[e] = ordered[e].second;
+}
+//-----------------------------------------------------------------------------
+
+/* Allocation Free Traversal *///----------------------------------------------
+namespace impl { // ::gtpo::impl
+
+//! Push \c parent unmarked children on \c scratch stack in reverse order (they are popped in adjacency order, as in a recursive DFS).
+template <class node_t>
+auto    push_dfs_children(const node_t& parent, dfs_scratch<node_t>& scratch, bool collect_group) -> void
+{
+    auto& stack = scratch.stack;
+    const auto first = stack.size();
+    if ( collect_group &&
+         parent.is_group() )
+        for ( const auto& group_node : parent.get_nodes() ) {
+            const auto child = group_node.lock();
+            if ( child &&
+                 !scratch.marks.is_marked( child->get_id().get_index() ) )
+                stack.push_back( child.get() );
+        }
+    for ( const auto& out_edge : parent.get_out_edges() ) {   // Note: out edges are available even with lean adjacency
+        const auto edge = out_edge.lock();
+        const auto child = edge ? edge->get_dst().lock() : nullptr;
+        if ( child &&
+             !scratch.marks.is_marked( child->get_id().get_index() ) )
+            stack.push_back( child.get() );
+    }
+    std::reverse( stack.begin() + static_cast<std::ptrdiff_t>( first ), stack.end() );
+}
+
+template <class node_t>
+auto    lock_dfs_start(const std::weak_ptr<node_t>& node) -> std::shared_ptr<node_t> { return node.lock(); }
+template <class node_t>
+auto    lock_dfs_start(const std::shared_ptr<node_t>& node) -> std::shared_ptr<node_t> { return node; }
+
+//! Pop \c scratch stack until it is empty, writing newly marked nodes to \c out.
+template <class node_t, class output_it>
+auto    run_dfs(output_it out, dfs_scratch<node_t>& scratch, bool collect_group) -> output_it
+{
+    auto& stack = scratch.stack;
+    while ( !stack.empty() ) {
+        const auto current = stack.back();
+        stack.pop_back();
+        const auto id = current->get_id();
+        if ( !id.is_valid() ||
+             !scratch.marks.mark( id.get_index() ) )
+            continue;
+        *out++ = current;
+        push_dfs_children( *current, scratch, collect_group );
+    }
+    return out;
+}
+
+} // ::gtpo::impl
+
+template <class node_t, class output_it>
+auto    collect_dfs(const node_t& node, output_it out, dfs_scratch<node_t>& scratch,
+                    bool collect_group) -> output_it
+{
+    scratch.marks.reset();
+    scratch.stack.clear();
+    impl::push_dfs_children( node, scratch, collect_group );
+    return impl::run_dfs( out, scratch, collect_group );
+}
+
+template <class node_t, class forward_it, class output_it>
+auto    collect_dfs(forward_it first, forward_it last, output_it out, dfs_scratch<node_t>& scratch,
+                    bool collect_group) -> output_it
+{
+    scratch.marks.reset();
+    for ( ; first != last; ++first ) {     // Note: each start node is traversed in turn, marks are shared
+        scratch.stack.clear();
+        const auto start = impl::lock_dfs_start( *first );
+        if ( start )
+            scratch.stack.push_back( start.get() );
+        out = impl::run_dfs( out, scratch, collect_group );
+    }
+    return out;
+}
 //-----------------------------------------------------------------------------
 
 
@@ -79,7 +203,7 @@ auto    linearize_dfs_impl(weak_node_t n, marks_t& marks, std::vector<weak_node_
             r.push_back(n);
             // Push all n out nodes
             auto n_ptr = n.lock();
-            for ( auto& out_node : n_ptr->get_out_nodes() ) {   // 8.
+            for ( const auto& out_node : n_ptr->get_out_nodes() ) {   // 8.
                 if ( marks.count(out_node) == 0 )
                     s.push(out_node);                           // 9.
             }
@@ -120,23 +244,186 @@ auto    linearize_dfs(const graph_t& graph) noexcept -> std::vector<typename gra
 //-----------------------------------------------------------------------------
 
 
+template <class graph_t>
+auto    is_dag(const graph_t& graph) noexcept -> bool
+{
+    // PRECONDITIONS: none
+
+    // ALGORITHM:
+        // Three colors DFS: a node is grey while it is on the work stack, a grey out node
+        // is a back edge (ie a circuit). Every stack frame keep an iterator on its node
+        // next out node to visit.
+    using node_t = typename graph_t::node_t;
+    using out_nodes_iterator_t = decltype(std::declval<const node_t&>().get_out_nodes().cbegin());
+    struct frame_t {
+        const node_t*           node;
+        out_nodes_iterator_t    out_node;
+    };
+    enum class color_t : char { grey = 1, black = 2 };   // Non registered nodes are white
+    std::unordered_map<const node_t*, color_t>  colors;
+    colors.reserve(graph.get_node_count());
+    std::vector<frame_t> s;
+    s.reserve(graph.get_node_count());
+
+    for ( const auto& root : graph.get_nodes() ) {
+        if ( !root ||
+             colors.find(root.get()) != colors.end() )
+            continue;
+        colors.emplace(root.get(), color_t::grey);
+        s.push_back(frame_t{root.get(), root->get_out_nodes().cbegin()});
+        while ( !s.empty() ) {
+            auto& f = s.back();
+            if ( f.out_node == f.node->get_out_nodes().cend() ) {
+                colors[f.node] = color_t::black;
+                s.pop_back();
+                continue;
+            }
+            const auto out_node = (f.out_node++)->lock();  // Note: f is invalidated by push_back()
+            if ( !out_node )
+                continue;
+            const auto color = colors.find(out_node.get());
+            if ( color == colors.end() ) {
+                colors.emplace(out_node.get(), color_t::grey);
+                s.push_back(frame_t{out_node.get(), out_node->get_out_nodes().cbegin()});
+            } else if ( color->second == color_t::grey )
+                return false;
+        }
+    }
+    return true;
+}
+
+template <class graph_t>
+auto    is_tree(const graph_t& graph) noexcept -> bool
+{
+    // PRECONDITIONS: none
+    using node_t = typename graph_t::node_t;
+    std::unordered_set<const node_t*> marks;
+    marks.reserve(graph.get_node_count());
+    std::vector<const node_t*> s;
+    s.reserve(graph.get_node_count());
+    for ( const auto& root : graph.get_nodes() ) {
+        if ( !root ||
+             marks.find(root.get()) != marks.end() )
+            continue;
+        s.push_back(root.get());
+        while ( !s.empty() ) {
+            const auto node = s.back();
+            s.pop_back();
+            if ( node->get_in_nodes().size() > 1 )
+                return false;
+            if ( !marks.insert(node).second )   // Node is reached twice: there is a circuit
+                return false;
+            for ( const auto& out_node : node->get_out_nodes() ) {
+                const auto out_node_ptr = out_node.lock();
+                if ( out_node_ptr )
+                    s.push_back(out_node_ptr.get());    // Note: graph keep ownership of out node
+            }
+        }
+    }
+    return true;
+}
+
+namespace impl { // ::gtpo::impl
+
+/*! \brief Generic iterative preorder traversal of a tree from \c graph root nodes.
+ *
+ * Functor \c f is called with (weak_node, level) for every visited node, out nodes are visited in
+ * their natural order (the same order than recursive *_tree_dfs_rec() algorithms).
+ */
+template <class graph_t, class functor_t>
+auto    tree_dfs_iterative(const graph_t& graph, functor_t f) noexcept -> void
+{
+    using weak_node_t = typename graph_t::weak_node_t;
+    struct entry_t {
+        weak_node_t         node;       // Copied, out nodes might be a projection of node out edges
+        int                 level;
+    };
+    const auto max_level = static_cast<int>( graph.get_node_count() );
+    std::vector<entry_t> s;
+    s.reserve(graph.get_node_count());
+
+    const auto& root_nodes = graph.get_root_nodes();
+    for ( auto root = root_nodes.cbegin(); root != root_nodes.cend(); ++root ) {
+        s.push_back(entry_t{*root, 0});
+        while ( !s.empty() ) {
+            const auto e = s.back();
+            s.pop_back();
+            const auto node_ptr = e.node.lock();
+            if ( !node_ptr ||
+                 e.level >= max_level )          // Tree level can't exceed node count (circuit protection)
+                continue;
+            f(e.node, e.level);
+            // Push out nodes in reverse order to pop them in natural order
+            const auto first_child = s.size();
+            const auto out_nodes = node_ptr->get_out_nodes();
+            for ( auto out_node = out_nodes.cbegin(); out_node != out_nodes.cend(); ++out_node )
+                s.push_back(entry_t{*out_node, e.level + 1});
+            std::reverse(s.begin() + static_cast<std::ptrdiff_t>(first_child), s.end());
+        }
+    }
+}
+
+} // ::gtpo::impl
+
+template <class graph_t>
+auto    tree_depth(const graph_t& graph) noexcept -> int
+{
+    // PRECONDITIONS: none
+    int r = 0;
+    impl::tree_dfs_iterative(graph, [&r](const auto&, int level) noexcept {
+        r = std::max(r, level + 1);
+    });
+    return r;
+}
+
+template <class graph_t>
+auto    linearize_tree_dfs(const graph_t& graph) noexcept -> std::vector<typename graph_t::weak_node_t>
+{
+    // PRECONDITIONS: none
+    std::vector<typename graph_t::weak_node_t> r;
+    r.reserve(graph.get_node_count());
+    impl::tree_dfs_iterative(graph, [&r](const auto& node, int) {
+        r.push_back(node);
+    });
+    return r;   // RVO
+}
+
+template <class graph_t>
+auto    levelize_tree_dfs(const graph_t& graph) noexcept -> std::vector<std::vector<typename graph_t::weak_node_t > >
+{
+    // PRECONDITIONS: none
+    std::vector<std::vector<typename graph_t::weak_node_t > > r;
+    impl::tree_dfs_iterative(graph, [&r](const auto& node, int level) {
+        if ( static_cast<int>(r.size()) < level + 1 )   // Eventually, add a new vector of node for level
+            r.emplace_back();
+        r[static_cast<std::size_t>(level)].push_back(node);
+    });
+    return r;   // RVO
+}
+//-----------------------------------------------------------------------------
+
+
 /* Recursive Graph Traversal Algorithms *///-----------------------------------
 
 namespace impl { // ::gtpo::impl
 
 template <class mark_t, class node_t>
-auto    is_dag_impl_rec(mark_t& marks, const node_t& node) noexcept -> bool
+auto    is_dag_impl_rec(mark_t& marks, mark_t& path, const node_t& node) noexcept -> bool
 {
     // PRECONDITIONS:
         // node must be lockable
     const auto& node_ptr = node.lock();
     if ( node_ptr ) {
-        if (marks.find(node) != marks.end())
+        if ( path.find(node) != path.end() )    // Node is on current DFS path: circuit
             return false;
-        marks.insert(node);
+        if ( marks.find(node) != marks.end() )  // Node sub graph has already been visited
+            return true;
+        path.insert(node);
         for ( const auto& out_node : node_ptr->get_out_nodes())
-            if (!is_dag_impl_rec(marks, out_node))
+            if (!is_dag_impl_rec(marks, path, out_node))
                 return false;
+        path.erase(node);
+        marks.insert(node);
     }
     return true;
 }
@@ -149,9 +436,10 @@ auto    is_dag_rec(const graph_t& graph) noexcept -> bool
     // PRECONDITIONS: none
     using mark_t = std::unordered_set<typename graph_t::weak_node_t>;
     mark_t marks;
+    mark_t path;
     for ( const auto& node : graph.get_nodes()) {
         if ( marks.find(node) == marks.end() &&
-             !impl::is_dag_impl_rec(marks, typename graph_t::weak_node_t{node}))
+             !impl::is_dag_impl_rec(marks, path, typename graph_t::weak_node_t{node}))
             return false;
     }
     return true;
@@ -286,6 +574,375 @@ auto    levelize_tree_dfs_rec(const graph_t& graph) noexcept -> std::vector<std:
 //-----------------------------------------------------------------------------
 
 
+/* CSR View Graph Traversal Algorithms *///------------------------------------
+template <class graph_t, class index_t>
+auto    linearize_dfs(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    // Same heuristic than linearize_dfs() working on graph_t: node with 0 in degree are
+    // handled first, all unmarked nodes are traversed in a second pass.
+    const auto node_count = csr.get_node_count();
+    std::vector<index_t> r;
+    r.reserve(node_count);
+    std::vector<char> marks(node_count, 0);
+    std::vector<index_t> s;
+    const auto dfs = [&](index_t n) -> void {
+        s.push_back(n);
+        while ( !s.empty() ) {
+            const auto v = s.back();
+            s.pop_back();
+            if ( marks[v] )
+                continue;
+            marks[v] = 1;
+            r.push_back(v);
+            for ( auto w = csr.out_begin(v); w != csr.out_end(v); ++w )
+                if ( !marks[*w] )
+                    s.push_back(*w);
+        }
+    };
+    for ( index_t n = 0; n < node_count; ++n )
+        if ( csr.get_in_degree(n) == 0 &&
+             !marks[n] )
+            dfs(n);
+    for ( index_t n = 0; n < node_count; ++n )
+        if ( !marks[n] )
+            dfs(n);
+    return r;
+}
+
+template <class graph_t, class index_t>
+auto    is_dag_rec(const csr_view<graph_t, index_t>& csr) -> bool
+{
+    // ALGORITHM:
+        // Iterative three colors DFS: a node is white until discovered, grey while its
+        // out nodes are beeing traversed and black once finished. Reaching a grey node
+        // from the DFS stack means there is a back edge, ie a circuit.
+    enum : char { white = 0, grey = 1, black = 2 };
+    const auto node_count = csr.get_node_count();
+    std::vector<char> colors(node_count, white);
+    std::vector<std::pair<index_t, const index_t*>> s;    // (node, next out node to visit)
+    for ( index_t n = 0; n < node_count; ++n ) {
+        if ( colors[n] != white )
+            continue;
+        colors[n] = grey;
+        s.emplace_back(n, csr.out_begin(n));
+        while ( !s.empty() ) {
+            auto& top = s.back();
+            if ( top.second == csr.out_end(top.first) ) {
+                colors[top.first] = black;
+                s.pop_back();
+                continue;
+            }
+            const auto w = *top.second++;
+            if ( colors[w] == grey )
+                return false;
+            if ( colors[w] == white ) {
+                colors[w] = grey;
+                s.emplace_back(w, csr.out_begin(w));    // Warning: top is invalidated
+            }
+        }
+    }
+    return true;
+}
+
+template <class graph_t, class index_t>
+auto    levelize_tree_dfs_rec(const csr_view<graph_t, index_t>& csr) -> std::vector<std::vector<index_t>>
+{
+    std::vector<std::vector<index_t>> r;
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<std::pair<index_t, std::size_t>> s;       // (node, level)
+    for ( const auto root_node : csr.get_root_nodes() ) {
+        s.emplace_back(root_node, 0);
+        while ( !s.empty() ) {
+            const auto v = s.back();
+            s.pop_back();
+            if ( v.second >= node_count )   // Protection against circuits
+                continue;
+            if ( r.size() < v.second + 1 )
+                r.emplace_back();
+            r[v.second].push_back(v.first);
+            // Push out nodes in reverse order to visit them in the same order than the recursive version
+            for ( auto w = csr.out_end(v.first); w != csr.out_begin(v.first); )
+                s.emplace_back(*--w, v.second + 1);
+        }
+    }
+    return r;
+}
+
+namespace impl { // ::gtpo::impl
+
+/*! \brief Kahn algorithm on \c csr: append topologically ordered nodes to \c r and return ordered node count.
+ *
+ * \c r is used as the FIFO queue of ready nodes, \c in_degrees is a scratch buffer.
+ */
+template <class graph_t, class index_t>
+auto    kahn_sort(const csr_view<graph_t, index_t>& csr,
+                  std::vector<index_t>& in_degrees,
+                  std::vector<index_t>& r) -> std::size_t
+{
+    const auto node_count = csr.get_node_count();
+    in_degrees.resize(static_cast<std::size_t>(node_count));
+    r.clear();
+    r.reserve(static_cast<std::size_t>(node_count));
+    for ( index_t n = 0; n < node_count; ++n ) {
+        in_degrees[n] = csr.get_in_degree(n);
+        if ( in_degrees[n] == 0 )
+            r.push_back(n);
+    }
+    for ( std::size_t head = 0; head < r.size(); ++head ) {
+        const auto n = r[head];
+        for ( auto out = csr.out_begin(n); out != csr.out_end(n); ++out )
+            if ( --in_degrees[*out] == 0 )
+                r.push_back(*out);
+    }
+    return r.size();
+}
+
+} // ::gtpo::impl
+
+template <class graph_t, class index_t>
+auto    topological_sort(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    std::vector<index_t> in_degrees;
+    std::vector<index_t> r;
+    impl::kahn_sort(csr, in_degrees, r);
+    return r;
+}
+
+template <class graph_t, class index_t>
+auto    is_dag(const csr_view<graph_t, index_t>& csr) -> bool
+{
+    std::vector<index_t> in_degrees;
+    std::vector<index_t> ordered;
+    return impl::kahn_sort(csr, in_degrees, ordered) == static_cast<std::size_t>(csr.get_node_count());
+}
+
+template <class graph_t, class index_t>
+auto    strongly_connected_components(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    // ALGORITHM:
+        // Iterative Tarjan: DFS stack contains (node, next out node to visit), a node is on the
+        // components stack while it has been discovered and its component is not yet known. When
+        // a node is finished with low_link == index, it is the root of a component: components
+        // stack is popped up to it.
+    using csr_t = csr_view<graph_t, index_t>;
+    constexpr index_t invalid = csr_t::invalid_index;
+    const auto node_count = csr.get_node_count();
+    std::vector<index_t> r(node_count, invalid);
+    std::vector<index_t> indexes(node_count, invalid);
+    std::vector<index_t> low_links(node_count, 0);
+    std::vector<index_t> components_stack;
+    std::vector<std::pair<index_t, const index_t*>> s;    // (node, next out node to visit)
+    index_t index = 0;
+    index_t component = 0;
+    for ( index_t n = 0; n < node_count; ++n ) {
+        if ( indexes[n] != invalid )
+            continue;
+        indexes[n] = low_links[n] = index++;
+        components_stack.push_back(n);
+        s.emplace_back(n, csr.out_begin(n));
+        while ( !s.empty() ) {
+            auto& top = s.back();
+            const auto v = top.first;
+            if ( top.second != csr.out_end(v) ) {
+                const auto w = *top.second++;
+                if ( indexes[w] == invalid ) {
+                    indexes[w] = low_links[w] = index++;
+                    components_stack.push_back(w);
+                    s.emplace_back(w, csr.out_begin(w));    // Warning: top is invalidated
+                } else if ( r[w] == invalid )               // w is on components stack
+                    low_links[v] = std::min(low_links[v], indexes[w]);
+                continue;
+            }
+            s.pop_back();
+            if ( !s.empty() ) {
+                const auto u = s.back().first;
+                low_links[u] = std::min(low_links[u], low_links[v]);
+            }
+            if ( low_links[v] == indexes[v] ) {
+                index_t w = invalid;
+                do {
+                    w = components_stack.back();
+                    components_stack.pop_back();
+                    r[w] = component;
+                } while ( w != v );
+                ++component;
+            }
+        }
+    }
+    return r;
+}
+//-----------------------------------------------------------------------------
+
+
+/* CSR View Path and Neighbourhood Queries *///--------------------------------
+namespace impl { // ::gtpo::impl
+
+template <class graph_t, class index_t>
+auto    dijkstra_path(const csr_view<graph_t, index_t>& csr, index_t source, index_t target) -> std::vector<index_t>
+{
+    using csr_t = csr_view<graph_t, index_t>;
+    using entry_t = std::pair<double, index_t>;     // (distance, node)
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<double> distances(node_count, std::numeric_limits<double>::infinity());
+    std::vector<index_t> predecessors(node_count, csr_t::invalid_index);
+    std::vector<char> settled(node_count, 0);
+    std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> heap;
+    const auto& offsets = csr.get_offsets();
+    const auto& targets = csr.get_targets();
+
+    distances[source] = 0.;
+    heap.emplace(0., source);
+    while ( !heap.empty() ) {
+        const auto v = heap.top().second;
+        heap.pop();
+        if ( settled[v] )
+            continue;       // Stale heap entry
+        settled[v] = 1;
+        if ( v == target )
+            break;
+        for ( auto e = offsets[v]; e < offsets[v + 1]; ++e ) {
+            const auto weight = csr.get_weight(e);
+            gtpo::assert_throw<std::invalid_argument>( weight >= 0., "gtpo::shortest_path(): Error: negative edge weight." );
+            const auto w = targets[e];
+            const auto distance = distances[v] + weight;
+            if ( distance < distances[w] ) {
+                distances[w] = distance;
+                predecessors[w] = v;
+                heap.emplace(distance, w);
+            }
+        }
+    }
+    std::vector<index_t> path;
+    if ( !settled[target] )
+        return path;
+    for ( auto v = target; v != csr_t::invalid_index; v = predecessors[v] )
+        path.push_back(v);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+template <class graph_t, class index_t>
+auto    bidirectional_bfs_path(const csr_view<graph_t, index_t>& csr, index_t source, index_t target) -> std::vector<index_t>
+{
+    // ALGORITHM:
+        // 1. Expand forward (out edges from source) or backward (in edges from target) frontier,
+        //    whichever is smaller, one whole level at a time.
+        // 2. While a level is expanded, record the best meeting node (minimal forward + backward depth).
+        // 3. Stop after the level where frontiers first met, then chain forward and backward predecessors.
+    using csr_t = csr_view<graph_t, index_t>;
+    struct side_t {
+        std::vector<index_t>        predecessors;
+        std::vector<std::size_t>    depths;
+        std::vector<index_t>        frontier;
+    };
+    constexpr auto unvisited = std::numeric_limits<std::size_t>::max();
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    side_t forward{std::vector<index_t>(node_count, csr_t::invalid_index), std::vector<std::size_t>(node_count, unvisited), {source}};
+    side_t backward{std::vector<index_t>(node_count, csr_t::invalid_index), std::vector<std::size_t>(node_count, unvisited), {target}};
+    forward.depths[source] = 0;
+    backward.depths[target] = 0;
+
+    auto meeting = csr_t::invalid_index;
+    auto best = unvisited;
+    std::vector<index_t> next;
+    while ( meeting == csr_t::invalid_index &&
+            !forward.frontier.empty() &&
+            !backward.frontier.empty() ) {
+        // 1.
+        const bool is_forward = forward.frontier.size() <= backward.frontier.size();
+        auto& side = is_forward ? forward : backward;
+        const auto& other = is_forward ? backward : forward;
+        next.clear();
+        for ( const auto v : side.frontier ) {
+            const auto first = is_forward ? csr.out_begin(v) : csr.in_begin(v);
+            const auto last = is_forward ? csr.out_end(v) : csr.in_end(v);
+            for ( auto w = first; w != last; ++w ) {
+                if ( side.depths[*w] != unvisited )
+                    continue;
+                side.depths[*w] = side.depths[v] + 1;
+                side.predecessors[*w] = v;
+                next.push_back(*w);
+                // 2.
+                if ( other.depths[*w] != unvisited &&
+                     side.depths[*w] + other.depths[*w] < best ) {
+                    best = side.depths[*w] + other.depths[*w];
+                    meeting = *w;
+                }
+            }
+        }
+        side.frontier.swap(next);
+    }
+
+    // 3.
+    std::vector<index_t> path;
+    if ( meeting == csr_t::invalid_index )
+        return path;
+    for ( auto v = meeting; v != csr_t::invalid_index; v = forward.predecessors[v] )
+        path.push_back(v);
+    std::reverse(path.begin(), path.end());
+    for ( auto v = backward.predecessors[meeting]; v != csr_t::invalid_index; v = backward.predecessors[v] )
+        path.push_back(v);
+    return path;
+}
+
+} // ::gtpo::impl
+
+template <class graph_t, class index_t>
+auto    shortest_path(const csr_view<graph_t, index_t>& csr, index_t source, index_t target) -> std::vector<index_t>
+{
+    // PRECONDITIONS:
+        // source and target must be valid csr dense indexes
+    const auto node_count = csr.get_node_count();
+    if ( source >= node_count ||
+         target >= node_count )
+        return {};
+    if ( source == target )
+        return {source};
+    return csr.is_weighted() ? impl::dijkstra_path(csr, source, target) :
+                               impl::bidirectional_bfs_path(csr, source, target);
+}
+
+template <class graph_t, class index_t>
+auto    k_hop_neighbourhood(const csr_view<graph_t, index_t>& csr, const std::vector<index_t>& sources, std::size_t k,
+                            traversal_direction direction) -> std::vector<index_t>
+{
+    const auto node_count = csr.get_node_count();
+    std::vector<index_t> r;
+    std::vector<char> marks(node_count, 0);
+    for ( const auto source : sources )
+        if ( source < node_count &&
+             !marks[source] ) {
+            marks[source] = 1;
+            r.push_back(source);
+        }
+    const bool out = direction != traversal_direction::in;
+    const bool in = direction != traversal_direction::out;
+    // r is used as the BFS queue, level [level_begin, level_end) contains nodes at a given hop count
+    std::size_t level_begin = 0;
+    for ( std::size_t hop = 0; hop < k && level_begin < r.size(); ++hop ) {
+        const auto level_end = r.size();
+        for ( auto i = level_begin; i < level_end; ++i ) {
+            const auto v = r[i];
+            if ( out )
+                for ( auto w = csr.out_begin(v); w != csr.out_end(v); ++w )
+                    if ( !marks[*w] ) {
+                        marks[*w] = 1;
+                        r.push_back(*w);
+                    }
+            if ( in )
+                for ( auto w = csr.in_begin(v); w != csr.in_end(v); ++w )
+                    if ( !marks[*w] ) {
+                        marks[*w] = 1;
+                        r.push_back(*w);
+                    }
+        }
+        level_begin = level_end;
+    }
+    return r;
+}
+//-----------------------------------------------------------------------------
+
+
 /* BFS Graph Iterator *///-----------------------------------------------------
 /*template <class graph_t>
 auto    begin_bfs(graph_t& graph) noexcept -> bfs_iterator<typename graph_t::weak_node_t>
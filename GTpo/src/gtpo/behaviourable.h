@@ -41,6 +41,7 @@
 #include <vector>
 #include <memory>
 #include <utility>          // c++14 std::index_sequence
+#include <tuple>
 
 // GTpo headers
 #include "./behaviour.h"
@@ -80,10 +81,13 @@ public:
 };
 
 /*! \brief Base class for all type supporting behaviours (actually gtpo::graph and gtpo::group).
+ *
+ * When \c dynamic_behaviours is false, dynamic behaviours storage and dispatch are compiled out
+ * (see gtpo::config::enable_dynamic_behaviours).
  *
  * \nosubgrouping
  */
-template < class behaviour_t, typename static_behaviours_t >
+template < class behaviour_t, typename static_behaviours_t, bool dynamic_behaviours = true >
 class behaviourable : public abstract_behaviourable
 {
     /*! \name behaviourable Object Management *///-----------------------------
@@ -91,8 +95,8 @@ class behaviourable : public abstract_behaviourable
 public:
     behaviourable() : abstract_behaviourable() { }
     ~behaviourable() noexcept { _dynamic_behaviours.clear(); }
-    behaviourable( const behaviourable<behaviour_t, static_behaviours_t>& ) = default;
-    behaviourable& operator=( const behaviourable<behaviour_t, static_behaviours_t>& ) = default;
+    behaviourable( const behaviourable<behaviour_t, static_behaviours_t, dynamic_behaviours>& ) = default;
+    behaviourable& operator=( const behaviourable<behaviour_t, static_behaviours_t, dynamic_behaviours>& ) = default;
 
 public:
     //! Clear all registered behaviours (they are automatically deleted).
@@ -172,6 +176,35 @@ private:
     //-------------------------------------------------------------------------
 };
 
+/*! \brief Static only behaviourable: no dynamic behaviours storage nor dispatch.
+ *
+ * Static behaviours tuple is an (empty) base to benefit from empty base optimization when no
+ * static behaviours are configured.
+ */
+template < class behaviour_t, typename static_behaviours_t >
+class behaviourable<behaviour_t, static_behaviours_t, false> : public abstract_behaviourable,
+                                                               private static_behaviours_t
+{
+public:
+    behaviourable() : abstract_behaviourable(), static_behaviours_t() { }
+    ~behaviourable() noexcept = default;
+    behaviourable( const behaviourable<behaviour_t, static_behaviours_t, false>& ) = default;
+    behaviourable& operator=( const behaviourable<behaviour_t, static_behaviours_t, false>& ) = default;
+
+public:
+    //! Nothing to clear, there is no dynamic behaviours.
+    inline  auto    clear() -> void { }
+    //! Always false, there is no dynamic behaviours.
+    inline auto     hasBehaviours() const noexcept -> bool { return false; }
+
+public:
+    //! \copydoc behaviourable::notify_static_behaviours()
+    template < class Functor >
+    auto    notify_static_behaviours( Functor f ) noexcept -> void {
+        impl::for_each_in_tuple( static_cast<static_behaviours_t&>( *this ), f );
+    }
+};
+
 } // ::gtpo
 
 #include "./behaviourable.hpp"
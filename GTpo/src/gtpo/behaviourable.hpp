@@ -37,9 +37,9 @@
 namespace gtpo { // ::gtpo
 
 /* Virtual Behaviours Management *///------------------------------------------
-template < class behaviour_t, class static_behaviours_t  >
+template < class behaviour_t, class static_behaviours_t, bool dynamic_behaviours >
 template < class T >
-auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&), T& arg ) noexcept -> void
+auto    behaviourable< behaviour_t, static_behaviours_t, dynamic_behaviours >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&), T& arg ) noexcept -> void
 {
     // Note 20160314: See http://stackoverflow.com/questions/1485983/calling-c-class-methods-via-a-function-pointer
     // For calling pointer on template template parameter template keyword functions.
@@ -51,9 +51,9 @@ auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behavi
             ((*behaviour).*method)(arg);
 }
 
-template < class behaviour_t, class static_behaviours_t  >
+template < class behaviour_t, class static_behaviours_t, bool dynamic_behaviours >
 template < class T, class T2 >
-auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&, T2&), T& arg, T2& arg2 ) noexcept -> void
+auto    behaviourable< behaviour_t, static_behaviours_t, dynamic_behaviours >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&, T2&), T& arg, T2& arg2 ) noexcept -> void
 {
     // Note 20160314: See http://stackoverflow.com/questions/1485983/calling-c-class-methods-via-a-function-pointer
     // For calling pointer on template template parameter template keyword functions.
@@ -65,9 +65,9 @@ auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behavi
             ((*behaviour).*method)(arg, arg2);
 }
 
-template < class behaviour_t, class static_behaviours_t  >
+template < class behaviour_t, class static_behaviours_t, bool dynamic_behaviours >
 template < class T, class T2, class T3 >
-auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&, T2&, const T3&), T& arg, T2& arg2, const T3& arg3 ) noexcept -> void
+auto    behaviourable< behaviour_t, static_behaviours_t, dynamic_behaviours >::notify_dynamic_behaviours( void (behaviour_t::*method)(T&, T2&, const T3&), T& arg, T2& arg2, const T3& arg3 ) noexcept -> void
 {
     // Note 20160314: See http://stackoverflow.com/questions/1485983/calling-c-class-methods-via-a-function-pointer
     // For calling pointer on template template parameter template keyword functions.
@@ -79,8 +79,8 @@ auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behavi
             ((*behaviour).*method)(arg, arg2, arg3);
 }
 
-template < class behaviour_t, class static_behaviours_t  >
-auto    behaviourable< behaviour_t, static_behaviours_t >::notify_dynamic_behaviours0( void (behaviour_t::*method)() ) noexcept -> void
+template < class behaviour_t, class static_behaviours_t, bool dynamic_behaviours >
+auto    behaviourable< behaviour_t, static_behaviours_t, dynamic_behaviours >::notify_dynamic_behaviours0( void (behaviour_t::*method)() ) noexcept -> void
 {
     for ( auto& behaviour : _dynamic_behaviours )
         if ( behaviour )
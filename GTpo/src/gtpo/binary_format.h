@@ -0,0 +1,232 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	binary_format.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_binary_format_h
+#define gtpo_binary_format_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t std::uint64_t
+#include <ostream>
+#include <stdexcept>        // std::runtime_error
+#include <string>
+#include <vector>
+
+// GTpo headers
+#include "./utils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Exception thrown by GTpo binary graph reader when a buffer is not a valid binary graph.
+ *
+ * Use what() to have a detailled error description.
+ */
+class bad_format_error : public std::runtime_error
+{
+public:
+    explicit bad_format_error (const std::string& what_arg) : std::runtime_error( what_arg ) { }
+    explicit bad_format_error (const char* what_arg) : std::runtime_error( what_arg ) { }
+    bad_format_error () : bad_format_error( "GTpo binary graph format error." ) { }
+};
+
+/*! \name Binary Graph Format *///---------------------------------------------
+//@{
+
+/*! \brief Binary graph file header.
+ *
+ * A binary graph file is a header followed by five sections, every section start on an 8 bytes
+ * boundary (section offsets are relative to the beginning of the file):
+ *   - node table: binary_node[node_count] (flags, parent group, label in string pool).
+ *   - geometry table: binary_geometry[node_count].
+ *   - CSR edge offsets: std::uint32_t[node_count + 1], out edges of node \c n are targets[offsets[n], offsets[n+1]).
+ *   - CSR edge targets: std::uint32_t[edge_count] destination node indexes.
+ *   - string pool: strings_size bytes of UTF-8 labels (not null terminated).
+ *
+ * Integers are stored in host byte order, \c byte_order is used to reject a file written on a host with
+ * a different endianness.
+ */
+struct binary_header {
+    enum : std::uint32_t {
+        file_magic      = 0x4F505447,   // "GTPO" little endian
+        file_version    = 1,
+        file_byte_order = 0x01020304
+    };
+
+    std::uint32_t   magic       = file_magic;
+    std::uint32_t   version     = file_version;
+    std::uint32_t   byte_order  = file_byte_order;
+    std::uint32_t   node_count  = 0;
+    std::uint32_t   edge_count  = 0;
+    std::uint32_t   group_count = 0;
+    std::uint64_t   nodes_offset        = 0;
+    std::uint64_t   geometry_offset     = 0;
+    std::uint64_t   edge_offsets_offset = 0;
+    std::uint64_t   targets_offset      = 0;
+    std::uint64_t   strings_offset      = 0;
+    std::uint64_t   strings_size        = 0;
+};
+static_assert( sizeof(binary_header) == 72, "gtpo::binary_header: unexpected header padding." );
+
+//! Binary graph node table record.
+struct binary_node {
+    enum : std::uint32_t {
+        no_group        = 0xFFFFFFFF,   //!< Value used for an ungrouped node \c group.
+        is_group_flag   = 1             //!< \c flags bit set for group nodes.
+    };
+
+    std::uint32_t   flags           = 0;
+    std::uint32_t   group           = no_group;     //!< Parent group node index.
+    std::uint32_t   label_offset    = 0;            //!< Label offset in string pool.
+    std::uint32_t   label_size      = 0;            //!< Label size in bytes.
+
+    inline auto is_group() const noexcept -> bool { return ( flags & is_group_flag ) != 0; }
+};
+static_assert( sizeof(binary_node) == 16, "gtpo::binary_node: unexpected record padding." );
+
+//! Binary graph geometry table record (node position, size and z stacking order).
+struct binary_geometry {
+    float   x = 0.f;
+    float   y = 0.f;
+    float   w = 0.f;
+    float   h = 0.f;
+    float   z = 0.f;
+};
+static_assert( sizeof(binary_geometry) == 20, "gtpo::binary_geometry: unexpected record padding." );
+
+/*! \brief Read-only zero copy view on a binary graph held in memory (typically a memory mapped file).
+ *
+ * Constructor validate the buffer once in O(V + E) (header, section bounds, CSR offsets, edge
+ * targets, group indexes and labels), accessors never copy nor check bounds.
+ *
+ * \code
+ *   // data is 8 bytes aligned (mmap() or QFile::map() data is page aligned)
+ *   gtpo::binary_graph_view view{data, size};
+ *   gtpo::graph<> g;
+ *   const auto nodes = gtpo::load_binary_graph(g, view);
+ * \endcode
+ * \note \c data must outlive the view.
+ */
+class binary_graph_view
+{
+public:
+    /*! \brief Map a binary graph over buffer [\c data, \c data + \c size).
+     *
+     * \throw gtpo::bad_format_error if \c data is not a valid binary graph (or is not 8 bytes aligned).
+     */
+    binary_graph_view(const void* data, std::size_t size) noexcept( false );
+    ~binary_graph_view() noexcept = default;
+    binary_graph_view(const binary_graph_view&) noexcept = default;
+    binary_graph_view& operator=(const binary_graph_view&) noexcept = default;
+
+public:
+    inline auto get_header() const noexcept -> const binary_header& { return *_header; }
+    inline auto get_node_count() const noexcept -> std::uint32_t { return _header->node_count; }
+    inline auto get_edge_count() const noexcept -> std::uint32_t { return _header->edge_count; }
+    inline auto get_group_count() const noexcept -> std::uint32_t { return _header->group_count; }
+
+    //! Return node \c n record (no bound checking).
+    inline auto get_node(std::uint32_t n) const noexcept -> const binary_node& { return _nodes[n]; }
+    //! Return node \c n geometry (no bound checking).
+    inline auto get_geometry(std::uint32_t n) const noexcept -> const binary_geometry& { return _geometry[n]; }
+    //! Return node \c n out degree (no bound checking).
+    inline auto get_out_degree(std::uint32_t n) const noexcept -> std::uint32_t { return _offsets[n + 1] - _offsets[n]; }
+    //! Return a pointer on the first out node index of node \c n (no bound checking).
+    inline auto out_begin(std::uint32_t n) const noexcept -> const std::uint32_t* { return _targets + _offsets[n]; }
+    //! Return a pointer past the last out node index of node \c n (no bound checking).
+    inline auto out_end(std::uint32_t n) const noexcept -> const std::uint32_t* { return _targets + _offsets[n + 1]; }
+    //! Return a pointer on node \c n UTF-8 label (not null terminated, size is get_node(n).label_size).
+    inline auto get_label_data(std::uint32_t n) const noexcept -> const char* { return _strings + _nodes[n].label_offset; }
+    //! Return a copy of node \c n label.
+    inline auto get_label(std::uint32_t n) const -> std::string { return std::string(get_label_data(n), _nodes[n].label_size); }
+
+private:
+    const binary_header*    _header = nullptr;
+    const binary_node*      _nodes = nullptr;
+    const binary_geometry*  _geometry = nullptr;
+    const std::uint32_t*    _offsets = nullptr;
+    const std::uint32_t*    _targets = nullptr;
+    const char*             _strings = nullptr;
+};
+
+/*! \brief Write \c graph topology to \c os in GTpo binary graph format.
+ *
+ * Nodes are indexed following graph get_nodes() order, out edges following node get_out_edges() order
+ * (parallel edges and circuits are preserved).
+ *
+ * \param geometry functor called with (const node_t&) returning a gtpo::binary_geometry.
+ * \param label functor called with (const node_t&) returning a UTF-8 std::string.
+ * \throw gtpo::bad_format_error if \c os can't be written, graph is too large, or a grouped node group is not part of graph.
+ */
+template <class graph_t, class geometry_fn_t, class label_fn_t>
+auto    write_binary_graph(const graph_t& graph, std::ostream& os,
+                           geometry_fn_t geometry, label_fn_t label) noexcept( false ) -> void;
+
+//! Write \c graph topology to \c os with default geometry and empty labels.
+template <class graph_t>
+auto    write_binary_graph(const graph_t& graph, std::ostream& os) noexcept( false ) -> void;
+
+/*! \brief Bulk load binary graph \c view topology in \c graph.
+ *
+ * Topology is created first with graph bulk insertion methods in a graph notification_scope: non group
+ * nodes with insert_nodes(), groups with insert_group(), edges with insert_edges() and group membership with
+ * group_nodes(). Factories are only responsible for allocating (and eventually decorating) primitives, visual
+ * attributes (geometry, labels) are expected to be attached by caller afterward using returned index mapping.
+ *
+ * \param node_factory functor called with (std::uint32_t index, const binary_node&) returning a graph_t::shared_node_t.
+ * \param group_factory functor called with (std::uint32_t index, const binary_node&) returning a graph_t::shared_group_t.
+ * \param edge_factory functor called with (const shared_node_t& src, const shared_node_t& dst) returning a
+ *        graph_t::shared_edge_t (edge source and destination are set by loader).
+ * \return graph nodes ordered by binary node index.
+ * \throw gtpo::bad_topology_error if a factory return a nullptr primitive, std::bad_alloc if graph containers can't grow.
+ */
+template <class graph_t, class node_factory_t, class group_factory_t, class edge_factory_t>
+auto    load_binary_graph(graph_t& graph, const binary_graph_view& view,
+                          node_factory_t node_factory, group_factory_t group_factory,
+                          edge_factory_t edge_factory) noexcept( false ) -> std::vector<typename graph_t::weak_node_t>;
+
+/*! \brief Bulk load binary graph \c view topology in \c graph using graph allocators for nodes and edges.
+ *
+ * \throw gtpo::bad_format_error if \c view contains groups (use the factory overload, graph_t::final_group_t
+ * must be allocated by caller).
+ */
+template <class graph_t>
+auto    load_binary_graph(graph_t& graph, const binary_graph_view& view) noexcept( false ) -> std::vector<typename graph_t::weak_node_t>;
+//@}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
+
+#include "./binary_format.hpp"
+
+#endif // gtpo_binary_format_h
@@ -0,0 +1,380 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	binary_format.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <cstdint>          // std::uintptr_t
+#include <memory>           // std::allocate_shared
+#include <unordered_map>
+#include <utility>          // std::move
+
+namespace gtpo { // ::gtpo
+
+namespace impl { // ::gtpo::impl
+
+inline auto binary_align(std::uint64_t offset) noexcept -> std::uint64_t { return ( offset + 7 ) & ~std::uint64_t{7}; }
+
+inline auto binary_section(std::uint64_t size, std::uint64_t offset, std::uint64_t count,
+                           std::uint64_t record_size, const char* what) noexcept( false ) -> void
+{
+    gtpo::assert_throw_lazy<gtpo::bad_format_error>( offset % 8 == 0, [what]() {
+        return std::string{"gtpo::binary_graph_view: Error: unaligned "} + what + " section."; } );
+    gtpo::assert_throw_lazy<gtpo::bad_format_error>( offset <= size &&
+                                                     count * record_size <= size - offset,   // count < 2^32, no overflow
+                                                     [what]() { return std::string{"gtpo::binary_graph_view: Error: truncated "} + what + " section."; } );
+}
+
+inline auto binary_write(std::ostream& os, std::uint64_t& position, const void* data, std::uint64_t size) -> void
+{
+    static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const auto aligned = binary_align(position);
+    if ( aligned != position )
+        os.write(padding, static_cast<std::streamsize>(aligned - position));
+    if ( size != 0 )
+        os.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    position = aligned + size;
+}
+
+//! Group policy for load_binary_graph() when caller provide a group factory.
+template <class graph_t, class group_factory_t>
+class binary_groups {
+public:
+    using shared_node_t  = typename graph_t::shared_node_t;
+    using shared_group_t = typename graph_t::shared_group_t;
+    using weak_node_t    = typename graph_t::weak_node_t;
+
+    binary_groups(group_factory_t factory, std::uint32_t group_count) : _factory{std::move(factory)} { _groups.reserve(group_count); }
+
+    auto    create(std::uint32_t n, const binary_node& record) -> shared_node_t {
+        shared_group_t group = _factory(n, record);
+        gtpo::assert_throw( group != nullptr, "gtpo::load_binary_graph(): Error: group factory returned a nullptr group." );
+        _groups.emplace_back(n, group);
+        return group;
+    }
+    auto    insert(graph_t& graph) -> void {
+        for ( const auto& group : _groups )
+            graph.insert_group(group.second);
+    }
+    auto    group(graph_t& graph, const std::vector<std::vector<weak_node_t>>& members) -> void {
+        for ( const auto& group : _groups ) {
+            const auto& group_members = members[group.first];
+            if ( !group_members.empty() )
+                graph.group_nodes(group.second, group_members.cbegin(), group_members.cend());
+        }
+        _groups.clear();
+    }
+private:
+    group_factory_t                                         _factory;
+    std::vector<std::pair<std::uint32_t, shared_group_t>>   _groups;
+};
+
+//! Group policy for load_binary_graph() without group support (view must contain no groups).
+template <class graph_t>
+struct binary_no_groups {
+    using shared_node_t  = typename graph_t::shared_node_t;
+    using weak_node_t    = typename graph_t::weak_node_t;
+    auto    create(std::uint32_t, const binary_node&) -> shared_node_t {
+        throw gtpo::bad_format_error( "gtpo::load_binary_graph(): Error: binary graph contains groups, use the group factory overload." );
+    }
+    auto    insert(graph_t&) noexcept -> void { }
+    auto    group(graph_t&, const std::vector<std::vector<weak_node_t>>&) noexcept -> void { }
+};
+
+template <class graph_t, class node_factory_t, class groups_t, class edge_factory_t>
+auto    load_binary_graph(graph_t& graph, const binary_graph_view& view,
+                          node_factory_t& node_factory, groups_t& groups,
+                          edge_factory_t& edge_factory) -> std::vector<typename graph_t::weak_node_t>
+{
+    // PRECONDITIONS: none, view has already been validated
+
+    // ALGORITHM:
+        // 1. Allocate every node (groups with groups policy), nodes are indexed by binary index.
+        // 2. In a notification scope: insert non group nodes in bulk, then groups.
+        // 3. Allocate edges following CSR order and insert them in bulk.
+        // 4. Collect group members and group them with one group_nodes() call per group.
+    using shared_node_t = typename graph_t::shared_node_t;
+    using shared_edge_t = typename graph_t::shared_edge_t;
+    using weak_node_t   = typename graph_t::weak_node_t;
+    const auto node_count = view.get_node_count();
+
+    // 1.
+    std::vector<shared_node_t> nodes;
+    nodes.reserve(node_count);
+    std::vector<shared_node_t> plain_nodes;
+    plain_nodes.reserve(node_count - view.get_group_count());
+    for ( std::uint32_t n = 0; n < node_count; ++n ) {
+        const auto& record = view.get_node(n);
+        if ( record.is_group() )
+            nodes.push_back(groups.create(n, record));
+        else {
+            auto node = node_factory(n, record);
+            gtpo::assert_throw( node != nullptr, "gtpo::load_binary_graph(): Error: node factory returned a nullptr node." );
+            plain_nodes.push_back(node);
+            nodes.push_back(std::move(node));
+        }
+    }
+
+    typename graph_t::notification_scope scope{graph};
+    // 2.
+    graph.insert_nodes_unchecked(plain_nodes.cbegin(), plain_nodes.cend());     // Note: factory results are checked above
+    plain_nodes.clear();
+    groups.insert(graph);
+
+    // 3.
+    {
+        std::vector<shared_edge_t> edges;
+        edges.reserve(view.get_edge_count());
+        for ( std::uint32_t n = 0; n < node_count; ++n ) {
+            const auto& src = nodes[n];
+            for ( auto target = view.out_begin(n); target != view.out_end(n); ++target ) {
+                const auto& dst = nodes[*target];
+                auto edge = edge_factory(src, dst);
+                gtpo::assert_throw( edge != nullptr, "gtpo::load_binary_graph(): Error: edge factory returned a nullptr edge." );
+                edge->set_src(src);
+                edge->set_dst(dst);
+                edges.push_back(std::move(edge));
+            }
+        }
+        graph.insert_edges_unchecked(edges.cbegin(), edges.cend());
+    }
+
+    // 4.
+    if ( view.get_group_count() != 0 ) {
+        std::vector<std::vector<weak_node_t>> members(node_count);
+        for ( std::uint32_t n = 0; n < node_count; ++n ) {
+            const auto group = view.get_node(n).group;
+            if ( group != binary_node::no_group )
+                members[group].push_back(nodes[n]);
+        }
+        groups.group(graph, members);
+    }
+    return std::vector<weak_node_t>(nodes.cbegin(), nodes.cend());
+}
+
+} // ::gtpo::impl
+
+/* Binary Graph Format *///----------------------------------------------------
+inline binary_graph_view::binary_graph_view(const void* data, std::size_t size) noexcept( false )
+{
+    // PRECONDITIONS:
+        // data must be non nullptr and 8 bytes aligned
+        // buffer must be large enough for a header
+    gtpo::assert_throw<gtpo::bad_format_error>( data != nullptr, "gtpo::binary_graph_view: Error: nullptr buffer." );
+    gtpo::assert_throw<gtpo::bad_format_error>( reinterpret_cast<std::uintptr_t>(data) % 8 == 0, "gtpo::binary_graph_view: Error: buffer must be 8 bytes aligned." );
+    gtpo::assert_throw<gtpo::bad_format_error>( size >= sizeof(binary_header), "gtpo::binary_graph_view: Error: truncated header." );
+
+    // ALGORITHM:
+        // 1. Check header magic, byte order and version.
+        // 2. Check every section lies in buffer.
+        // 3. Check CSR offsets are monotonic and targets are valid node indexes.
+        // 4. Check labels lies in string pool and group indexes reference a group node.
+    const auto bytes = static_cast<const char*>(data);
+    _header = reinterpret_cast<const binary_header*>(bytes);
+    const auto& header = *_header;
+
+    // 1.
+    gtpo::assert_throw<gtpo::bad_format_error>( header.magic == binary_header::file_magic, "gtpo::binary_graph_view: Error: not a GTpo binary graph." );
+    gtpo::assert_throw<gtpo::bad_format_error>( header.byte_order == binary_header::file_byte_order, "gtpo::binary_graph_view: Error: binary graph byte order does not match host byte order." );
+    gtpo::assert_throw<gtpo::bad_format_error>( header.version == binary_header::file_version, "gtpo::binary_graph_view: Error: unsupported binary graph version." );
+    gtpo::assert_throw<gtpo::bad_format_error>( header.node_count < binary_node::no_group, "gtpo::binary_graph_view: Error: invalid node count." );
+
+    // 2.
+    const auto node_count = std::uint64_t{header.node_count};
+    impl::binary_section(size, header.nodes_offset, node_count, sizeof(binary_node), "nodes");
+    impl::binary_section(size, header.geometry_offset, node_count, sizeof(binary_geometry), "geometry");
+    impl::binary_section(size, header.edge_offsets_offset, node_count + 1, sizeof(std::uint32_t), "edge offsets");
+    impl::binary_section(size, header.targets_offset, header.edge_count, sizeof(std::uint32_t), "edge targets");
+    gtpo::assert_throw<gtpo::bad_format_error>( header.strings_offset <= size &&
+                                                header.strings_size <= size - header.strings_offset, "gtpo::binary_graph_view: Error: truncated string pool." );
+    _nodes      = reinterpret_cast<const binary_node*>(bytes + header.nodes_offset);
+    _geometry   = reinterpret_cast<const binary_geometry*>(bytes + header.geometry_offset);
+    _offsets    = reinterpret_cast<const std::uint32_t*>(bytes + header.edge_offsets_offset);
+    _targets    = reinterpret_cast<const std::uint32_t*>(bytes + header.targets_offset);
+    _strings    = bytes + header.strings_offset;
+
+    // 3.
+    gtpo::assert_throw<gtpo::bad_format_error>( _offsets[0] == 0 &&
+                                                _offsets[header.node_count] == header.edge_count, "gtpo::binary_graph_view: Error: invalid edge offsets." );
+    for ( std::uint32_t n = 0; n < header.node_count; ++n )
+        gtpo::assert_throw<gtpo::bad_format_error>( _offsets[n] <= _offsets[n + 1], "gtpo::binary_graph_view: Error: invalid edge offsets." );
+    for ( std::uint32_t e = 0; e < header.edge_count; ++e )
+        gtpo::assert_throw<gtpo::bad_format_error>( _targets[e] < header.node_count, "gtpo::binary_graph_view: Error: invalid edge target." );
+
+    // 4.
+    std::uint32_t group_count = 0;
+    for ( std::uint32_t n = 0; n < header.node_count; ++n ) {
+        const auto& node = _nodes[n];
+        gtpo::assert_throw<gtpo::bad_format_error>( std::uint64_t{node.label_offset} + node.label_size <= header.strings_size, "gtpo::binary_graph_view: Error: invalid node label." );
+        gtpo::assert_throw<gtpo::bad_format_error>( node.group == binary_node::no_group ||
+                                                    ( node.group < header.node_count &&
+                                                      node.group != n &&
+                                                      _nodes[node.group].is_group() ), "gtpo::binary_graph_view: Error: invalid node group." );
+        if ( node.is_group() )
+            ++group_count;
+    }
+    gtpo::assert_throw<gtpo::bad_format_error>( group_count == header.group_count, "gtpo::binary_graph_view: Error: invalid group count." );
+}
+
+template <class graph_t, class geometry_fn_t, class label_fn_t>
+auto    write_binary_graph(const graph_t& graph, std::ostream& os,
+                           geometry_fn_t geometry, label_fn_t label) noexcept( false ) -> void
+{
+    // PRECONDITIONS: none
+
+    // ALGORITHM:
+        // 1. Assign a dense index to every graph node (following get_nodes() order).
+        // 2. Build node table, geometry table and string pool, then CSR offsets and targets
+        //    from node out edges.
+        // 3. Map group members to their group index.
+        // 4. Compute section offsets, write header and sections.
+    using node_t = typename graph_t::node_t;
+    constexpr auto max_index = std::uint64_t{binary_node::no_group};
+
+    // 1.
+    std::vector<const node_t*> nodes;
+    nodes.reserve(static_cast<std::size_t>(graph.get_node_count()));
+    std::unordered_map<const node_t*, std::uint32_t> indexes;
+    indexes.reserve(static_cast<std::size_t>(graph.get_node_count()));
+    for ( const auto& node : graph.get_nodes() ) {
+        if ( !node )
+            continue;
+        gtpo::assert_throw<gtpo::bad_format_error>( nodes.size() < max_index, "gtpo::write_binary_graph(): Error: too many nodes." );
+        indexes.emplace(node.get(), static_cast<std::uint32_t>(nodes.size()));
+        nodes.push_back(node.get());
+    }
+    const auto node_count = static_cast<std::uint32_t>(nodes.size());
+
+    // 2.
+    binary_header header;
+    header.node_count = node_count;
+    std::vector<binary_node>        records(node_count);
+    std::vector<binary_geometry>    geometries(node_count);
+    std::vector<std::uint32_t>      offsets;
+    offsets.reserve(node_count + 1);
+    std::vector<std::uint32_t>      targets;
+    targets.reserve(static_cast<std::size_t>(graph.get_edge_count()));
+    std::string                     strings;
+    for ( std::uint32_t n = 0; n < node_count; ++n ) {
+        const auto& node = *nodes[n];
+        auto& record = records[n];
+        if ( node.is_group() ) {
+            record.flags |= binary_node::is_group_flag;
+            ++header.group_count;
+        }
+        const std::string node_label = label(node);
+        gtpo::assert_throw<gtpo::bad_format_error>( strings.size() + node_label.size() <= max_index, "gtpo::write_binary_graph(): Error: string pool too large." );
+        record.label_offset = static_cast<std::uint32_t>(strings.size());
+        record.label_size = static_cast<std::uint32_t>(node_label.size());
+        strings.append(node_label);
+        geometries[n] = geometry(node);
+
+        offsets.push_back(static_cast<std::uint32_t>(targets.size()));
+        for ( const auto& out_edge : node.get_out_edges() ) {
+            const auto out_edge_ptr = out_edge.lock();
+            const auto dst = out_edge_ptr ? out_edge_ptr->get_dst().lock() : nullptr;
+            const auto index = dst ? indexes.find(dst.get()) : indexes.end();
+            if ( index == indexes.end() )
+                continue;
+            gtpo::assert_throw<gtpo::bad_format_error>( targets.size() < max_index, "gtpo::write_binary_graph(): Error: too many edges." );
+            targets.push_back(index->second);
+        }
+    }
+    offsets.push_back(static_cast<std::uint32_t>(targets.size()));
+    header.edge_count = static_cast<std::uint32_t>(targets.size());
+
+    // 3.
+    for ( std::uint32_t n = 0; n < node_count; ++n ) {
+        if ( !nodes[n]->is_group() )
+            continue;
+        for ( const auto& member : nodes[n]->get_nodes() ) {
+            const auto member_ptr = member.lock();
+            const auto index = member_ptr ? indexes.find(member_ptr.get()) : indexes.end();
+            gtpo::assert_throw<gtpo::bad_format_error>( index != indexes.end(), "gtpo::write_binary_graph(): Error: a group node is not part of graph." );
+            records[index->second].group = n;
+        }
+    }
+
+    // 4.
+    header.nodes_offset         = impl::binary_align(sizeof(binary_header));
+    header.geometry_offset      = impl::binary_align(header.nodes_offset + records.size() * sizeof(binary_node));
+    header.edge_offsets_offset  = impl::binary_align(header.geometry_offset + geometries.size() * sizeof(binary_geometry));
+    header.targets_offset       = impl::binary_align(header.edge_offsets_offset + offsets.size() * sizeof(std::uint32_t));
+    header.strings_offset       = impl::binary_align(header.targets_offset + targets.size() * sizeof(std::uint32_t));
+    header.strings_size         = strings.size();
+
+    std::uint64_t position = 0;
+    impl::binary_write(os, position, &header, sizeof(binary_header));
+    impl::binary_write(os, position, records.data(), records.size() * sizeof(binary_node));
+    impl::binary_write(os, position, geometries.data(), geometries.size() * sizeof(binary_geometry));
+    impl::binary_write(os, position, offsets.data(), offsets.size() * sizeof(std::uint32_t));
+    impl::binary_write(os, position, targets.data(), targets.size() * sizeof(std::uint32_t));
+    impl::binary_write(os, position, strings.data(), strings.size());
+    gtpo::assert_throw<gtpo::bad_format_error>( static_cast<bool>(os), "gtpo::write_binary_graph(): Error: output stream write failed." );
+}
+
+template <class graph_t>
+auto    write_binary_graph(const graph_t& graph, std::ostream& os) noexcept( false ) -> void
+{
+    using node_t = typename graph_t::node_t;
+    write_binary_graph(graph, os,
+                       [](const node_t&) noexcept { return binary_geometry{}; },
+                       [](const node_t&) { return std::string{}; });
+}
+
+template <class graph_t, class node_factory_t, class group_factory_t, class edge_factory_t>
+auto    load_binary_graph(graph_t& graph, const binary_graph_view& view,
+                          node_factory_t node_factory, group_factory_t group_factory,
+                          edge_factory_t edge_factory) noexcept( false ) -> std::vector<typename graph_t::weak_node_t>
+{
+    impl::binary_groups<graph_t, group_factory_t> groups{std::move(group_factory), view.get_group_count()};
+    return impl::load_binary_graph(graph, view, node_factory, groups, edge_factory);
+}
+
+template <class graph_t>
+auto    load_binary_graph(graph_t& graph, const binary_graph_view& view) noexcept( false ) -> std::vector<typename graph_t::weak_node_t>
+{
+    gtpo::assert_throw<gtpo::bad_format_error>( view.get_group_count() == 0, "gtpo::load_binary_graph(): Error: binary graph contains groups, use the group factory overload." );
+    using node_t = typename graph_t::node_t;
+    using edge_t = typename graph_t::shared_edge_t::element_type;
+    auto node_factory = [&graph](std::uint32_t, const binary_node&) {
+        return std::allocate_shared<node_t>(graph.get_node_allocator());
+    };
+    auto edge_factory = [&graph](const typename graph_t::shared_node_t&, const typename graph_t::shared_node_t&) {
+        return std::allocate_shared<edge_t>(graph.get_edge_allocator());
+    };
+    impl::binary_no_groups<graph_t> groups;
+    return impl::load_binary_graph(graph, view, node_factory, groups, edge_factory);
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
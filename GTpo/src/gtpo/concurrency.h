@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	concurrency.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_concurrency_h
+#define gtpo_concurrency_h
+
+// STD headers
+#include <atomic>
+#include <thread>
+#include <mutex>            // std::unique_lock
+#include <shared_mutex>     // std::shared_timed_mutex std::shared_lock
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Default graph concurrency policy: no synchronization, graph is owned by a single thread.
+ *
+ * Locks returned by graph::read_lock() and graph::write_lock() are no-op and optimized out.
+ */
+struct no_concurrency
+{
+    //! Mutex with empty lock() / lock_shared() (satisfy std::unique_lock and std::shared_lock requirements).
+    struct mutex_t {
+        inline void lock() noexcept { }
+        inline bool try_lock() noexcept { return true; }
+        inline void unlock() noexcept { }
+        inline void lock_shared() noexcept { }
+        inline bool try_lock_shared() noexcept { return true; }
+        inline void unlock_shared() noexcept { }
+    };
+    static constexpr bool   enabled = false;
+};
+
+namespace impl { // ::gtpo::impl
+
+/*! \brief Readers/writer mutex where writer thread might lock again (exclusively or shared) while owning the lock.
+ *
+ * Graph mutators lock exclusively while they might call each other or notify behaviours querying the graph, and
+ * a writer might hold the lock around a whole batch of mutations (see graph::write_lock()). Other threads
+ * lock_shared() as with a std::shared_timed_mutex.
+ * \note A thread holding a shared lock must not lock exclusively (it would deadlock).
+ */
+class writer_reentrant_shared_mutex
+{
+public:
+    writer_reentrant_shared_mutex() noexcept = default;
+    writer_reentrant_shared_mutex(const writer_reentrant_shared_mutex&) = delete;
+    writer_reentrant_shared_mutex& operator=(const writer_reentrant_shared_mutex&) = delete;
+
+    void    lock() {
+        if (is_owner()) {
+            ++_depth;
+            return;
+        }
+        _mutex.lock();
+        _owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        _depth = 1;
+    }
+    bool    try_lock() {
+        if (is_owner()) {
+            ++_depth;
+            return true;
+        }
+        if (!_mutex.try_lock())
+            return false;
+        _owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        _depth = 1;
+        return true;
+    }
+    void    unlock() {
+        if (--_depth == 0) {
+            _owner.store(std::thread::id{}, std::memory_order_relaxed);
+            _mutex.unlock();
+        }
+    }
+    // Note: owner thread already has exclusive access, its shared locks are no-op (they are always released
+    // before its exclusive lock with scoped locks).
+    void    lock_shared() {
+        if (!is_owner())
+            _mutex.lock_shared();
+    }
+    bool    try_lock_shared() {
+        return is_owner() || _mutex.try_lock_shared();
+    }
+    void    unlock_shared() {
+        if (!is_owner())
+            _mutex.unlock_shared();
+    }
+
+private:
+    //! Only the owner thread could read back its own id (a relaxed load is enough).
+    inline bool is_owner() const noexcept { return _owner.load(std::memory_order_relaxed) == std::this_thread::get_id(); }
+
+    std::shared_timed_mutex         _mutex;
+    std::atomic<std::thread::id>    _owner{std::thread::id{}};
+    std::size_t                     _depth = 0;
+};
+
+} // ::gtpo::impl
+
+/*! \brief Graph concurrency policy allowing multiple reader threads concurrently with a single writer thread.
+ *
+ * Every gtpo::graph<> topology mutator (node, edge and group insertion or removal, clear(), reorder(), deferred
+ * notifications flush) lock graph exclusively: while a reader thread hold graph::read_lock(), mutations are
+ * blocked and get_nodes(), get_edges() and node in/out edges and nodes containers could be traversed safely, readers
+ * never see a partially linked edge. A writer might hold graph::write_lock() around a batch of mutations so that
+ * readers see the whole batch or nothing.
+ *
+ * \code
+ *   struct my_config : public gtpo::config<my_config> {
+ *       using concurrency_policy = gtpo::shared_mutex_concurrency;
+ *   };
+ *   gtpo::graph<my_config> g;
+ *   // Writer thread                              // Reader thread
+ *   {                                             {
+ *     const auto lock = g.write_lock();             const auto lock = g.read_lock();
+ *     const auto n = g.create_node();               for (const auto& node : g.get_nodes())
+ *     g.create_edge(n, m);                              for (const auto& out : node->get_out_nodes()) ...
+ *   }                                             }
+ * \endcode
+ *
+ * \note Behaviours are notified from the writer thread while graph is locked. Primitives properties (others than
+ * topology) and direct node/edge container mutations are not synchronized.
+ */
+struct shared_mutex_concurrency
+{
+    using mutex_t = impl::writer_reentrant_shared_mutex;
+    static constexpr bool   enabled = true;
+};
+
+} // ::gtpo
+
+#endif // gtpo_concurrency_h
@@ -42,11 +42,14 @@
 #include <functional>       // std::hash
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <type_traits>      // std::is_base_of
 
 // GTpo headers
 #include "./utils.h"
 #include "./behaviour.h"
 #include "./container_adapter.h"
+#include "./pool_allocator.h"
+#include "./concurrency.h"
 
 namespace gtpo { // ::gtpo
 
@@ -112,15 +115,149 @@ struct config
     template <class...Ts>
     using edge_container_t = std::vector<Ts...>;
 
-    //! Define the unordered container used to search for edges and nodes (default to std::unordered_set).
+    /* Node in/out edges and in/out nodes lists containers might optionnally be defined in a final
+     * configuration (they default to edge_container_t and node_container_t, see impl::adjacent_edges_container):
+     * \code
+     *   template <class...Ts>
+     *   using adjacent_edges_container_t = std::vector<Ts...>;
+     *   template <class...Ts>
+     *   using adjacent_nodes_container_t = std::vector<Ts...>;
+     * \endcode
+     * Use it to keep observable containers for graph level nodes and edges while node adjacency use a plain
+     * std container (adjacency is traversed on topology hot paths and rarely exposed to views).
+     */
+
+    //! Define the allocator used by graph::create_node() with std::allocate_shared() (default to std::allocator, see gtpo::pool_allocator).
+    template <class T>
+    using node_allocator_t = std::allocator<T>;
+
+    //! Define the allocator used by graph::create_edge() with std::allocate_shared() (default to std::allocator, see gtpo::pool_allocator).
+    template <class T>
+    using edge_allocator_t = std::allocator<T>;
+
+    //! Define the container used to search for edges and nodes (default to std::unordered_set, std::set<T, std::owner_less<T>> is also supported).
     template <class T>
     using search_container_t = std::unordered_set<T>;
+
+    /*! \brief Maintain a per node hashed destination to out edges index (default to false).
+     *
+     * When true, graph::find_edge(), graph::has_edge() and graph::get_edge_count() complexity is O(1)
+     * (instead of O(source out degree)), at the cost of an hashed multimap per node.
+     */
+    static constexpr bool   enable_adjacency_index = false;
+
+    /*! \brief Maintain node in/out nodes lists (default to true).
+     *
+     * When false (lean adjacency), nodes only store their in/out edges lists: node::get_in_nodes() and
+     * node::get_out_nodes() then return a lazy projection range of edges source/destination nodes (iterators
+     * dereference to a weak_node_t value) instead of a container reference, saving two containers per node.
+     */
+    static constexpr bool   enable_node_lists = true;
+
+    /*! \brief Enable dynamic (virtual) behaviours storage and dispatch for graph and nodes (default to true).
+     *
+     * When false, graph and nodes do not store any dynamic behaviour container and add_dynamic_graph_behaviour() /
+     * add_dynamic_node_behaviour() are no longer available: only static behaviours tuples are notified. \c graph_behaviours
+     * and \c node_behaviours must then not contain enable_graph_dynamic_behaviour<> or enable_node_dynamic_behaviour<>,
+     * see gtpo::static_behaviours_config.
+     */
+    static constexpr bool   enable_dynamic_behaviours = true;
+
+    /*! \brief Define graph readers/writer synchronization (default to gtpo::no_concurrency).
+     *
+     * Set to gtpo::shared_mutex_concurrency to traverse graph from reader threads (see graph::read_lock()) while
+     * a writer thread modify its topology.
+     */
+    using concurrency_policy = gtpo::no_concurrency;
 };
 
+namespace impl { // ::gtpo::impl
+
+template <class...>
+struct make_void { using type = void; };
+template <class...Ts>
+using void_t = typename make_void<Ts...>::type;
+
+//! Node in/out edges container: config_t::adjacent_edges_container_t<T> if defined, config_t::edge_container_t<T> otherwise.
+template <class config_t, class T, class = void>
+struct adjacent_edges_container { using type = typename config_t::template edge_container_t<T>; };
+
+template <class config_t, class T>
+struct adjacent_edges_container<config_t, T, void_t<typename config_t::template adjacent_edges_container_t<T>>> {
+    using type = typename config_t::template adjacent_edges_container_t<T>;
+};
+
+//! Node in/out nodes container: config_t::adjacent_nodes_container_t<T> if defined, config_t::node_container_t<T> otherwise.
+template <class config_t, class T, class = void>
+struct adjacent_nodes_container { using type = typename config_t::template node_container_t<T>; };
+
+template <class config_t, class T>
+struct adjacent_nodes_container<config_t, T, void_t<typename config_t::template adjacent_nodes_container_t<T>>> {
+    using type = typename config_t::template adjacent_nodes_container_t<T>;
+};
+
+/*! \brief True when config_t::final_group_t is a complete type inheriting config_t::final_node_t.
+ *
+ * gtpo::group<> is only declared, groups are not supported with gtpo::default_config: graph<> group
+ * management is tag dispatched on this trait (it must only be queried where final_group_t is complete).
+ */
+template <class config_t, class = void>
+struct group_is_node : std::false_type { };
+
+template <class config_t>
+struct group_is_node<config_t, void_t<decltype(sizeof(typename config_t::final_group_t))>> :
+    std::is_base_of<typename config_t::final_node_t, typename config_t::final_group_t> { };
+
+} // ::gtpo::impl
+
 struct default_config : public config<default_config>
 {
 };
 
+/*! \brief Configuration with dynamic behaviours compiled out and empty static behaviours.
+ *
+ * Use it as a base for configurations where only static behaviours are necessary:
+ * \code
+ *   struct my_config : public gtpo::static_behaviours_config<my_config>
+ *   {
+ *       using graph_behaviours = std::tuple< my_static_graph_behaviour<my_config> >;
+ *   };
+ *   gtpo::graph<my_config> g;
+ * \endcode
+ */
+template < typename final_config >
+struct static_behaviours_config : public config<final_config>
+{
+    using graph_behaviours = std::tuple< >;
+    using group_behaviours = std::tuple< >;
+    using node_behaviours = std::tuple< >;
+
+    static constexpr bool   enable_dynamic_behaviours = false;
+};
+
+/*! \brief Recommended configuration for high throughput topology workloads.
+ *
+ * Static behaviours only, std::vector containers with hashed search containers (see default config), per node
+ * adjacency index and lean adjacency (no in/out nodes lists). Policies were chosen from GTpo/benchmarks
+ * BM_policy_* matrix (sparse random, hub and tree graphs with out degree 4):
+ *   - std::list node/edge containers do not speed up insertion while removal is several times slower.
+ *   - Ordered search containers (std::set with std::owner_less) insert faster but contains() is 2 to 3 times slower.
+ *   - Adjacency index speeds up find_edge() even for low out degrees, the gain grows with out degree (hubs).
+ *   - Static behaviours and lean adjacency speed up insertion by ~1.4x, out edges traversal is not affected.
+ *
+ * \code
+ *   struct my_config : public gtpo::high_throughput_config<my_config> { };
+ *   gtpo::graph<my_config> g;
+ * \endcode
+ * \note Edge removal cost is dominated by graph level edges container linear removal, whatever the policy.
+ */
+template < typename final_config >
+struct high_throughput_config : public static_behaviours_config<final_config>
+{
+    static constexpr bool   enable_adjacency_index = true;
+    static constexpr bool   enable_node_lists = false;
+};
+
 } // ::gtpo
 
 #endif // gtpo_config_h
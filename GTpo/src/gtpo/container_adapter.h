@@ -42,6 +42,7 @@
 #include <set>
 #include <unordered_set>
 #include <memory>
+#include <utility>          // std::move
 
 // Gtpo headers
 #include "./utils.h"
@@ -53,7 +54,7 @@ struct std_container_adapter { };
 
 template < typename T >
 struct std_container_adapter< std::vector<T> > {
-    inline static void  insert( T t, std::vector<T>& c ) { c.emplace_back( t ); }
+    inline static void  insert( T t, std::vector<T>& c ) { c.emplace_back( std::move(t) ); }
     inline static void  insert( T t, std::vector<T>& c, int i ) { c.insert( i, t ); }
     inline static void  remove( const T& t, std::vector<T>& c )
     {   // https://en.wikipedia.org/wiki/Erase%E2%80%93remove_idiom
@@ -62,11 +63,13 @@ struct std_container_adapter< std::vector<T> > {
     inline static   std::size_t size( std::vector<T>& c ) { return c.size(); }
     inline static   bool        contains( const std::vector<T>& c, const T& t ) { return std::find(std::begin(c), std::end(c), t) != std::end(c); }
     inline static   void        reserve( std::vector<T>& c, std::size_t s) { c.reserve(s); }
+    template < class P >
+    inline static   void        remove_if( std::vector<T>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end()); }
 };
 
 template < typename T >
 struct std_container_adapter< std::vector<std::shared_ptr<T>> > {
-    inline static void          insert( std::shared_ptr<T> t, std::vector<std::shared_ptr<T>>& c ) { c.emplace_back( t ); }
+    inline static void          insert( std::shared_ptr<T> t, std::vector<std::shared_ptr<T>>& c ) { c.emplace_back( std::move(t) ); }
     static constexpr void       insert( std::shared_ptr<T> t, std::vector<std::shared_ptr<T>>& c, int i ) { c.insert( i, t ); }
     inline static void          remove( const std::shared_ptr<T>& t, std::vector<std::shared_ptr<T>>& c )
     {   // https://en.wikipedia.org/wiki/Erase%E2%80%93remove_idiom
@@ -75,73 +78,145 @@ struct std_container_adapter< std::vector<std::shared_ptr<T>> > {
     inline static   std::size_t size( std::vector<std::shared_ptr<T>>& c ) { return c.size(); }
     inline static   bool        contains( const std::vector<std::shared_ptr<T>>& c, const std::shared_ptr<T>& t ) { return std::find(std::begin(c), std::end(c), t) != std::end(c); }
     inline static   void        reserve( std::vector<std::shared_ptr<T>>& c, std::size_t s) { c.reserve(s); }
+    template < class P >
+    inline static   void        remove_if( std::vector<std::shared_ptr<T>>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end()); }
 };
 
 template < typename T >
 struct std_container_adapter< std::vector<std::weak_ptr<T>> > {
-    inline static void      insert( std::weak_ptr<T> t, std::vector<std::weak_ptr<T>>& c ) { c.emplace_back( t ); }
+    inline static void      insert( std::weak_ptr<T> t, std::vector<std::weak_ptr<T>>& c ) { c.emplace_back( std::move(t) ); }
     static constexpr void   insert( std::weak_ptr<T> t, std::vector<std::weak_ptr<T>>& c, int i ) { c.insert( i, t ); }
     inline static void      remove( const std::weak_ptr<T>& t, std::vector<std::weak_ptr<T>>& c )
     {
-        c.erase( std::remove_if(c.begin(), c.end(), [=](const std::weak_ptr<T>& wp){
+        c.erase( std::remove_if(c.begin(), c.end(), [=](const std::weak_ptr<T>& wp){   // t is copied since it might alias an element of c
             return gtpo::compare_weak_ptr( wp, t );
         }), c.end());
     }
     inline static   std::size_t size( std::vector<std::weak_ptr<T>>& c ) { return c.size(); }
     inline static   bool        contains( const std::vector<std::weak_ptr<T>>& c, const std::weak_ptr<T>& t ) {
-        return std::find_if( std::begin(c), std::end(c), [=](const auto& wp){
+        return std::find_if( std::begin(c), std::end(c), [&t](const auto& wp){
             return gtpo::compare_weak_ptr( wp, t );
         }) != std::end(c);
     }
     inline static   void        reserve( std::vector<std::weak_ptr<T>>& c, std::size_t s) { c.reserve(s); }
+    template < class P >
+    inline static   void        remove_if( std::vector<std::weak_ptr<T>>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end()); }
 };
 
 template < typename T >
 struct std_container_adapter< std::list<T> > {
-    inline static void             insert( T t, std::list<T>& c ) { c.emplace_back( t ); }
+    inline static void             insert( T t, std::list<T>& c ) { c.emplace_back( std::move(t) ); }
     inline static constexpr void   insert( T t, std::list<T>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const T& t, std::list<T>& c )
     {   // https://en.wikipedia.org/wiki/Erase%E2%80%93remove_idiom
         c.erase( std::remove(c.begin(), c.end(), t), c.end());
     }
+    template < class P >
+    inline static void             remove_if( std::list<T>& c, P p ) { c.remove_if( p ); }
 };
 
 template < typename T >
 struct std_container_adapter< std::list<std::shared_ptr<T>> > {
-    inline static void             insert( std::shared_ptr<T> t, std::list<std::shared_ptr<T>>& c ) { c.emplace_back( t ); }
+    inline static void             insert( std::shared_ptr<T> t, std::list<std::shared_ptr<T>>& c ) { c.emplace_back( std::move(t) ); }
     inline static constexpr void   insert( std::shared_ptr<T> t, std::list<std::shared_ptr<T>>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const std::shared_ptr<T>& t, std::list<std::shared_ptr<T>>& c )
     {   // https://en.wikipedia.org/wiki/Erase%E2%80%93remove_idiom
         c.erase( std::remove(c.begin(), c.end(), t), c.end());
     }
+    template < class P >
+    inline static void             remove_if( std::list<std::shared_ptr<T>>& c, P p ) { c.remove_if( p ); }
+    inline static   std::size_t    size( std::list<std::shared_ptr<T>>& c ) { return c.size(); }
+    inline static   void           reserve( std::list<std::shared_ptr<T>>&, std::size_t ) { }
+};
+
+template < typename T >
+struct std_container_adapter< std::list<std::weak_ptr<T>> > {
+    inline static void             insert( std::weak_ptr<T> t, std::list<std::weak_ptr<T>>& c ) { c.emplace_back( std::move(t) ); }
+    inline static void             remove( const std::weak_ptr<T>& t, std::list<std::weak_ptr<T>>& c )
+    {
+        c.remove_if( [=](const std::weak_ptr<T>& wp){   // t is copied since it might alias an element of c
+            return gtpo::compare_weak_ptr( wp, t );
+        } );
+    }
+    inline static   std::size_t    size( std::list<std::weak_ptr<T>>& c ) { return c.size(); }
+    inline static   bool           contains( const std::list<std::weak_ptr<T>>& c, const std::weak_ptr<T>& t ) {
+        return std::find_if( std::begin(c), std::end(c), [&t](const auto& wp){
+            return gtpo::compare_weak_ptr( wp, t );
+        }) != std::end(c);
+    }
+    inline static   void           reserve( std::list<std::weak_ptr<T>>&, std::size_t ) { }
+    template < class P >
+    inline static void             remove_if( std::list<std::weak_ptr<T>>& c, P p ) { c.remove_if( p ); }
 };
 
 template < typename T >
 struct std_container_adapter< std::set<T> > {
-    inline static void             insert( T t, std::set<T>& c ) { c.insert( t ); }
+    inline static void             insert( T t, std::set<T>& c ) { c.insert( std::move(t) ); }
     inline static constexpr void   insert( T t, std::set<T>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const T& t, std::set<T>& c ) { c.erase(t); }
 };
 
 template < typename T >
 struct std_container_adapter< std::set<std::shared_ptr<T>> > {
-    inline static void             insert( std::shared_ptr<T> t, std::set<std::shared_ptr<T>>& c ) { c.insert( t ); }
+    inline static void             insert( std::shared_ptr<T> t, std::set<std::shared_ptr<T>>& c ) { c.insert( std::move(t) ); }
     inline static constexpr void   insert( std::shared_ptr<T> t, std::set<std::shared_ptr<T>>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const std::shared_ptr<T>& t, std::set<std::shared_ptr<T>>& c ) { c.erase(t); }
 };
 
 template < typename T >
 struct std_container_adapter< std::unordered_set<T> > {
-    inline static void             insert( T t, std::unordered_set<T>& c ) { c.insert( t ); }
+    inline static void             insert( T t, std::unordered_set<T>& c ) { c.insert( std::move(t) ); }
     inline static constexpr void   insert( T t, std::unordered_set<T>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const T& t, std::unordered_set<T>& c ) { c.erase(t); }
+    inline static   std::size_t    size( std::unordered_set<T>& c ) { return c.size(); }
+    inline static   bool           contains( const std::unordered_set<T>& c, const T& t ) { return c.find(t) != c.end(); }
+    inline static   void           reserve( std::unordered_set<T>& c, std::size_t s) { c.reserve(s); }
 };
 
 template < typename T >
 struct std_container_adapter< std::unordered_set<std::shared_ptr<T>> > {
-    inline static void             insert( std::shared_ptr<T> t, std::unordered_set<std::shared_ptr<T>>& c ) { c.insert( t ); }
+    inline static void             insert( std::shared_ptr<T> t, std::unordered_set<std::shared_ptr<T>>& c ) { c.insert( std::move(t) ); }
     inline static constexpr void   insert( std::shared_ptr<T> t, std::unordered_set<std::shared_ptr<T>>& c, int i ) { c.insert( i, t ); }
     inline static void             remove( const std::shared_ptr<T>& t, std::unordered_set<std::shared_ptr<T>>& c ) { c.erase(t); }
+    inline static   std::size_t    size( std::unordered_set<std::shared_ptr<T>>& c ) { return c.size(); }
+    inline static   bool           contains( const std::unordered_set<std::shared_ptr<T>>& c, const std::shared_ptr<T>& t ) { return c.find(t) != c.end(); }
+    inline static   void           reserve( std::unordered_set<std::shared_ptr<T>>& c, std::size_t s) { c.reserve(s); }
+};
+
+/*! \brief Hashed search container adapter for weak_ptr, used for graph<>::contains() fast lookup.
+ *
+ * Lookup complexity is O(1): std::hash<std::weak_ptr<T>> hash the managed pointer (see utils.h) while
+ * std::equal_to<std::weak_ptr<T>> compare control blocks with owner_before().
+ *
+ * \warning An element must be removed from the container before it expires, since an expired
+ * weak_ptr hash is different from the hash computed at insertion.
+ */
+template < typename T >
+struct std_container_adapter< std::unordered_set<std::weak_ptr<T>> > {
+    inline static void             insert( std::weak_ptr<T> t, std::unordered_set<std::weak_ptr<T>>& c ) { c.insert( std::move(t) ); }
+    inline static void             remove( const std::weak_ptr<T>& t, std::unordered_set<std::weak_ptr<T>>& c ) { c.erase(t); }
+    inline static   std::size_t    size( std::unordered_set<std::weak_ptr<T>>& c ) { return c.size(); }
+    inline static   bool           contains( const std::unordered_set<std::weak_ptr<T>>& c, const std::weak_ptr<T>& t ) {
+        return !t.expired() && c.find(t) != c.end();
+    }
+    inline static   void           reserve( std::unordered_set<std::weak_ptr<T>>& c, std::size_t s) { c.reserve(s); }
+};
+
+/*! \brief Ordered search container adapter for weak_ptr (std::set with std::owner_less), alternative to hashed search.
+ *
+ * Lookup complexity is O(log(n)), ordering compare control blocks: unlike the hashed adapter, an expired element
+ * is still found (and removed) correctly.
+ */
+template < typename T >
+struct std_container_adapter< std::set<std::weak_ptr<T>, std::owner_less<std::weak_ptr<T>>> > {
+    using container_t = std::set<std::weak_ptr<T>, std::owner_less<std::weak_ptr<T>>>;
+    inline static void             insert( std::weak_ptr<T> t, container_t& c ) { c.insert( std::move(t) ); }
+    inline static void             remove( const std::weak_ptr<T>& t, container_t& c ) { c.erase(t); }
+    inline static   std::size_t    size( container_t& c ) { return c.size(); }
+    inline static   bool           contains( const container_t& c, const std::weak_ptr<T>& t ) {
+        return !t.expired() && c.find(t) != c.end();
+    }
+    inline static   void           reserve( container_t&, std::size_t ) { }
 };
 
 } // ::gtpo
@@ -0,0 +1,185 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	csr_view.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_csr_view_h
+#define gtpo_csr_view_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <vector>
+#include <memory>           // std::shared_ptr std::weak_ptr
+#include <unordered_map>
+
+// GTpo headers
+#include "./utils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Read-only compressed sparse row (CSR) snapshot of a gtpo::graph topology.
+ *
+ * A csr_view freeze a graph out adjacency into two contiguous arrays: out edges of node
+ * with dense index \c n are stored in targets[offsets[n], offsets[n+1]) as dense node
+ * indexes. Traversal algorithms working on a csr_view never lock a weak_ptr and
+ * access memory sequentially.
+ *
+ * Dense node indexes follow graph get_nodes() order, use get_node() and index_of() to map
+ * indexes back and forth to graph nodes.
+ *
+ * \code
+ *   gtpo::graph<> g;
+ *   // ... build topology
+ *   gtpo::csr_view<gtpo::graph<>> csr{g};
+ *   const auto r = gtpo::linearize_dfs(csr);   // r contains dense node indexes
+ *   // ... modify g topology, then refresh the snapshot reusing its storage
+ *   csr.rebuild(g);
+ * \endcode
+ *
+ * \note A csr_view is a snapshot: it is not notified of source graph topology changes,
+ * call rebuild() after a mutation.
+ * \note Parallel edges are preserved (a target index might appear multiple times for a given node).
+ * \note In adjacency is also stored (in_begin() / in_end()), edge weights are only stored when the view is
+ * built with a weight functor (see rebuild(const graph_t&, weight_fn_t)).
+ */
+template <class graph_t, class index_type = std::uint32_t>
+class csr_view
+{
+    /*! \name CSR View Management *///-----------------------------------------
+    //@{
+public:
+    using index_t       = index_type;
+    using node_t        = typename graph_t::node_t;
+    using weak_node_t   = typename graph_t::weak_node_t;
+    //! Value used to signal an invalid node index (for example when a node is not part of the snapshot).
+    static constexpr index_t    invalid_index = static_cast<index_t>(-1);
+
+    csr_view() noexcept = default;
+    explicit csr_view(const graph_t& graph) { rebuild(graph); }
+    ~csr_view() noexcept = default;
+    csr_view(const csr_view&) = default;
+    csr_view& operator=(const csr_view&) = default;
+    csr_view(csr_view&&) noexcept = default;
+    csr_view& operator=(csr_view&&) noexcept = default;
+
+    /*! \brief Rebuild this view from \c graph actual topology.
+     *
+     * Complexity is O(V + E), internal storage is reused between calls.
+     * \note May throw std::bad_alloc
+     */
+    auto    rebuild(const graph_t& graph) -> void;
+
+    /*! \brief Rebuild this view from \c graph actual topology, storing an edge weight for every target.
+     *
+     * \param weight functor called with (const graph_t::edge_t&) returning edge weight (convertible to double).
+     * \note Complexity is O(V + E), may throw std::bad_alloc.
+     */
+    template <class weight_fn_t>
+    auto    rebuild(const graph_t& graph, weight_fn_t weight) -> void;
+
+    //! Clear the view (empty the snapshot).
+    auto    clear() noexcept -> void;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name CSR Topology Access *///-----------------------------------------
+    //@{
+public:
+    //! Return the number of nodes in this view.
+    inline auto get_node_count() const noexcept -> index_t { return static_cast<index_t>(_nodes.size()); }
+    //! Return the number of edges in this view.
+    inline auto get_edge_count() const noexcept -> std::size_t { return _targets.size(); }
+    //! Return true if this view contains no nodes.
+    inline auto is_empty() const noexcept -> bool { return _nodes.empty(); }
+
+    //! Return node \c n out degree (no bound checking).
+    inline auto get_out_degree(index_t n) const noexcept -> index_t { return static_cast<index_t>(_offsets[n + 1] - _offsets[n]); }
+    //! Return node \c n in degree (no bound checking).
+    inline auto get_in_degree(index_t n) const noexcept -> index_t { return _in_degrees[n]; }
+
+    //! Return a pointer on the first out node index of node \c n (no bound checking).
+    inline auto out_begin(index_t n) const noexcept -> const index_t* { return _targets.data() + _offsets[n]; }
+    //! Return a pointer past the last out node index of node \c n (no bound checking).
+    inline auto out_end(index_t n) const noexcept -> const index_t* { return _targets.data() + _offsets[n + 1]; }
+
+    //! Return a pointer on the first in node index of node \c n (no bound checking).
+    inline auto in_begin(index_t n) const noexcept -> const index_t* { return _sources.data() + _in_offsets[n]; }
+    //! Return a pointer past the last in node index of node \c n (no bound checking).
+    inline auto in_end(index_t n) const noexcept -> const index_t* { return _sources.data() + _in_offsets[n + 1]; }
+
+    //! Return true if this view has been built with edge weights.
+    inline auto is_weighted() const noexcept -> bool { return _weighted; }
+    /*! \brief Return weight of out edge at position \c e in targets array (ie out_begin(n) - get_targets().data() + i).
+     *
+     * Return 1.0 if this view is not weighted (no bound checking).
+     */
+    inline auto get_weight(std::size_t e) const noexcept -> double { return _weighted ? _weights[e] : 1.0; }
+
+    //! Offsets array (size is get_node_count() + 1).
+    inline auto get_offsets() const noexcept -> const std::vector<std::size_t>& { return _offsets; }
+    //! Target array (size is get_edge_count()).
+    inline auto get_targets() const noexcept -> const std::vector<index_t>& { return _targets; }
+    //! Dense indexes of source graph root nodes (ordered as graph get_root_nodes()).
+    inline auto get_root_nodes() const noexcept -> const std::vector<index_t>& { return _root_nodes; }
+
+    //! Map a dense index \c n to its source graph node (return an expired weak_ptr if \c n is out of range).
+    auto        get_node(index_t n) const noexcept -> weak_node_t {
+        return n < _nodes.size() ? _nodes[n] : weak_node_t{};
+    }
+    //! Return dense index of \c node in this view, or invalid_index if \c node is not part of the snapshot.
+    auto        index_of(const weak_node_t& node) const noexcept -> index_t;
+
+private:
+    //! Compute in degrees, in adjacency and root nodes from _targets.
+    auto        build_in_adjacency(const graph_t& graph) -> void;
+
+private:
+    std::vector<weak_node_t>    _nodes;
+    std::vector<std::size_t>    _offsets;
+    std::vector<index_t>        _targets;
+    std::vector<index_t>        _in_degrees;
+    std::vector<index_t>        _root_nodes;
+    std::vector<std::size_t>    _in_offsets;
+    std::vector<index_t>        _sources;
+    std::vector<double>         _weights;
+    bool                        _weighted = false;
+    std::unordered_map<const node_t*, index_t>  _indexes;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::gtpo
+
+#include "./csr_view.hpp"
+
+#endif // gtpo_csr_view_h
@@ -0,0 +1,168 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	csr_view.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+namespace gtpo { // ::gtpo
+
+/* CSR View Management *///----------------------------------------------------
+template <class graph_t, class index_type>
+constexpr typename csr_view<graph_t, index_type>::index_t csr_view<graph_t, index_type>::invalid_index;
+
+template <class graph_t, class index_type>
+auto    csr_view<graph_t, index_type>::rebuild(const graph_t& graph) -> void
+{
+    // ALGORITHM:
+        // 1. Assign a dense index to every graph node (following get_nodes() order).
+        // 2. For every node, append its out nodes dense indexes to targets and record offsets.
+        // 3. Compute in degrees and in adjacency from targets, map graph root nodes to dense indexes.
+    clear();
+    const auto node_count = static_cast<std::size_t>(graph.get_node_count());
+    _nodes.reserve(node_count);
+    _offsets.reserve(node_count + 1);
+    _targets.reserve(static_cast<std::size_t>(graph.get_edge_count()));
+    _indexes.reserve(node_count);
+
+    // 1.
+    for ( const auto& node : graph.get_nodes() ) {
+        if ( !node )
+            continue;
+        _indexes.insert({node.get(), static_cast<index_t>(_nodes.size())});
+        _nodes.emplace_back(node);
+    }
+
+    // 2.
+    _offsets.push_back(0);
+    for ( const auto& node : graph.get_nodes() ) {
+        if ( !node )
+            continue;
+        for ( const auto& out_node : node->get_out_nodes() ) {
+            const auto out_node_ptr = out_node.lock();
+            const auto out_index = out_node_ptr ? _indexes.find(out_node_ptr.get()) : _indexes.end();
+            if ( out_index != _indexes.end() )
+                _targets.push_back(out_index->second);
+        }
+        _offsets.push_back(_targets.size());
+    }
+
+    // 3.
+    build_in_adjacency(graph);
+}
+
+template <class graph_t, class index_type>
+template <class weight_fn_t>
+auto    csr_view<graph_t, index_type>::rebuild(const graph_t& graph, weight_fn_t weight) -> void
+{
+    // Same algorithm than rebuild(graph) but targets are collected from out edges (not out nodes)
+    // to keep every weight aligned with its target.
+    clear();
+    const auto node_count = static_cast<std::size_t>(graph.get_node_count());
+    _nodes.reserve(node_count);
+    _offsets.reserve(node_count + 1);
+    _targets.reserve(static_cast<std::size_t>(graph.get_edge_count()));
+    _weights.reserve(static_cast<std::size_t>(graph.get_edge_count()));
+    _indexes.reserve(node_count);
+    for ( const auto& node : graph.get_nodes() ) {
+        if ( !node )
+            continue;
+        _indexes.insert({node.get(), static_cast<index_t>(_nodes.size())});
+        _nodes.emplace_back(node);
+    }
+    _offsets.push_back(0);
+    for ( const auto& node : graph.get_nodes() ) {
+        if ( !node )
+            continue;
+        for ( const auto& out_edge : node->get_out_edges() ) {
+            const auto out_edge_ptr = out_edge.lock();
+            const auto out_node_ptr = out_edge_ptr ? out_edge_ptr->get_dst().lock() : nullptr;
+            const auto out_index = out_node_ptr ? _indexes.find(out_node_ptr.get()) : _indexes.end();
+            if ( out_index != _indexes.end() ) {
+                _targets.push_back(out_index->second);
+                _weights.push_back(static_cast<double>(weight(*out_edge_ptr)));
+            }
+        }
+        _offsets.push_back(_targets.size());
+    }
+    _weighted = true;
+    build_in_adjacency(graph);
+}
+
+template <class graph_t, class index_type>
+auto    csr_view<graph_t, index_type>::build_in_adjacency(const graph_t& graph) -> void
+{
+    const auto node_count = _nodes.size();
+    _in_degrees.assign(node_count, 0);
+    for ( const auto target : _targets )
+        ++_in_degrees[target];
+    _in_offsets.assign(node_count + 1, 0);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        _in_offsets[n + 1] = _in_offsets[n] + _in_degrees[n];
+    _sources.resize(_targets.size());
+    std::vector<std::size_t> cursors(_in_offsets.cbegin(), _in_offsets.cend() - 1);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        for ( auto e = _offsets[n]; e < _offsets[n + 1]; ++e )
+            _sources[cursors[_targets[e]]++] = static_cast<index_t>(n);
+    for ( const auto& root_node : graph.get_root_nodes() ) {
+        const auto root_index = index_of(root_node);
+        if ( root_index != invalid_index )
+            _root_nodes.push_back(root_index);
+    }
+}
+
+template <class graph_t, class index_type>
+auto    csr_view<graph_t, index_type>::clear() noexcept -> void
+{
+    _nodes.clear();
+    _offsets.clear();
+    _targets.clear();
+    _in_degrees.clear();
+    _root_nodes.clear();
+    _in_offsets.clear();
+    _sources.clear();
+    _weights.clear();
+    _weighted = false;
+    _indexes.clear();
+}
+
+template <class graph_t, class index_type>
+auto    csr_view<graph_t, index_type>::index_of(const weak_node_t& node) const noexcept -> index_t
+{
+    const auto node_ptr = node.lock();
+    if ( !node_ptr )
+        return invalid_index;
+    const auto index = _indexes.find(node_ptr.get());
+    return index != _indexes.end() ? index->second : invalid_index;
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
+
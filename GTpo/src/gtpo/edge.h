@@ -42,11 +42,13 @@
 #include <functional>       // std::hash
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <vector>
 
 // GTpo headers
 #include "./utils.h"
 #include "./behaviour.h"
 #include "./config.h"
+#include "./handle.h"
 
 /*! \brief Main GTpo namespace (\#include \<GTpo\>).
  */
@@ -100,6 +102,12 @@ private:
     void                    set_graph( graph_t* graph ) { _graph = graph; }
 public:
     graph_t*                _graph{ nullptr };
+
+public:
+    //! Return edge stable handle in its graph (an invalid handle if edge is not registered in a graph).
+    inline auto             get_id() const noexcept -> edge_id { return _id; }
+private:
+    edge_id                 _id;
     //@}
     //-------------------------------------------------------------------------
 
@@ -121,8 +129,8 @@ private:
     /*! \name Source / Destination Management *///-----------------------------
     //@{
 public:
-    inline auto set_src( weak_node_t src ) noexcept -> void { _src = src; }
-    inline auto set_dst( weak_node_t dst ) noexcept -> void { _dst = dst; }
+    inline auto set_src( const weak_node_t& src ) noexcept -> void { _src = src; }
+    inline auto set_dst( const weak_node_t& dst ) noexcept -> void { _dst = dst; }
     inline auto get_src( ) noexcept -> weak_node_t& { return _src; }
     inline auto get_src( ) const noexcept -> const weak_node_t& { return _src; }
     inline auto get_dst( ) noexcept -> weak_node_t& { return _dst; }
@@ -132,6 +140,31 @@ private:
     weak_node_t _dst;
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Restricted Hyper Edge Management *///---------------------------
+    //@{
+public:
+    /*! \brief Set this edge hyper destination, an edge with an hyper destination is a restricted hyper edge (node -> edge).
+     *
+     * \note Use graph::create_edge(weak_node_t, weak_edge_t) to create and index restricted hyper edges.
+     */
+    inline auto set_hdst( const weak_edge_t& hdst ) noexcept -> void { _hdst = hdst; _is_hyper = !_hdst.expired(); }
+    inline auto get_hdst( ) const noexcept -> const weak_edge_t& { return _hdst; }
+    //! Return true if this edge is a restricted hyper edge (ie it has an edge destination instead of a node).
+    inline auto is_hyper( ) const noexcept -> bool { return _is_hyper; }
+
+    //! Restricted hyper edges with this edge as destination (per target index maintained by graph).
+    inline auto get_in_hedges( ) const noexcept -> const std::vector<weak_edge_t>& { return _in_hedges; }
+    inline auto get_in_hdegree( ) const noexcept -> std::size_t { return _in_hedges.size(); }
+private:
+    weak_edge_t                 _hdst;
+    bool                        _is_hyper = false;
+    std::vector<weak_edge_t>    _in_hedges;
+    //! Position of this hyper edge in its source get_out_hedges() and destination get_in_hedges() (O(1) removal).
+    std::size_t                 _out_hedge_index = static_cast<std::size_t>(-1);
+    std::size_t                 _in_hedge_index = static_cast<std::size_t>(-1);
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::gtpo
@@ -0,0 +1,151 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	fingerprint.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_fingerprint_h
+#define gtpo_fingerprint_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t
+#include <functional>       // std::function
+#include <memory>           // std::shared_ptr std::weak_ptr
+#include <unordered_map>
+
+// GTpo headers
+#include "./config.h"
+#include "./utils.h"
+#include "./graph_behaviour.h"
+
+namespace gtpo { // ::gtpo
+
+template <class config_t>
+class graph;
+
+/*! \brief Dynamic graph behaviour maintaining an order independent structural hash of graph topology.
+ *
+ * Fingerprint is the wrapping sum of every node hash and every edge hash, where a node hash is derived from
+ * user provided node hasher (see set_node_hasher(), default to a constant: fingerprint then only depends on
+ * topology shape) and an edge hash is derived from its source and destination node hashes: fingerprint does
+ * not depend on insertion order and is updated in O(1) on node or edge insertion and removal.
+ *
+ * \code
+ *   auto fingerprint = std::make_unique<gtpo::fingerprint_behaviour<gtpo::default_config>>();
+ *   auto fingerprint_ptr = fingerprint.get();
+ *   g.add_dynamic_graph_behaviour(std::move(fingerprint));
+ *   fingerprint_ptr->reset(g);
+ *   // ... modify graph
+ *   const auto hash = fingerprint_ptr->get_fingerprint();
+ * \endcode
+ *
+ * \note When a node hashed property is modified, call update_node() to update node and its adjacent edges hash.
+ * \note Disabled behaviour ignore topology changes, call reset() after enabling it back.
+ */
+template <class config_t = gtpo::default_config>
+class fingerprint_behaviour : public gtpo::dynamic_graph_behaviour<config_t>
+{
+    /*! \name Fingerprint Management *///--------------------------------------
+    //@{
+public:
+    using graph_t       = gtpo::graph<config_t>;
+    using node_t        = typename config_t::final_node_t;
+    using edge_t        = typename config_t::final_edge_t;
+    using weak_node_t   = typename gtpo::dynamic_graph_behaviour<config_t>::weak_node_t;
+    using weak_edge_t   = typename gtpo::dynamic_graph_behaviour<config_t>::weak_edge_t;
+    using weak_nodes_t  = typename gtpo::dynamic_graph_behaviour<config_t>::weak_nodes_t;
+    using weak_edges_t  = typename gtpo::dynamic_graph_behaviour<config_t>::weak_edges_t;
+    //! Return a node hash, must be deterministic (do not use a per process seeded hash to persist fingerprints).
+    using node_hasher_t = std::function<std::uint64_t(const node_t&)>;
+
+    fingerprint_behaviour() noexcept : gtpo::dynamic_graph_behaviour<config_t>{} { }
+    virtual ~fingerprint_behaviour() noexcept = default;
+    fingerprint_behaviour(const fingerprint_behaviour<config_t>&) = delete;
+    fingerprint_behaviour& operator=(const fingerprint_behaviour<config_t>&) = delete;
+
+    //! Set node hash function (call reset() to take it into account for existing nodes).
+    inline auto set_node_hasher(node_hasher_t hasher) noexcept -> void { _hasher = std::move(hasher); }
+
+    /*! \brief Rebuild fingerprint from \c graph existing nodes and edges in O(V+E).
+     *
+     * \note May throw std::bad_alloc
+     */
+    auto    reset(const graph_t& graph) -> void;
+
+    //! Return actual graph fingerprint.
+    inline auto get_fingerprint() const noexcept -> std::uint64_t { return _fingerprint; }
+
+    //! Return \c node actual hash (0 for a node unknown to this behaviour).
+    auto    get_node_hash(const node_t& node) const noexcept -> std::uint64_t;
+
+    //! Rehash \c node and its adjacent edges after a modification of a node hashed property, O(degree).
+    auto    update_node(const weak_node_t& node) noexcept -> void;
+
+    //! Mix \c value bits (see gtpo::hash_mix()), used to combine hashes.
+    static constexpr auto   mix(std::uint64_t value) noexcept -> std::uint64_t { return gtpo::hash_mix(value); }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Notification Interface *///--------------------------------
+    //@{
+protected:
+    virtual void    on_node_inserted( weak_node_t& weakNode ) noexcept override;
+    virtual void    on_node_removed( weak_node_t& weakNode ) noexcept override;
+    virtual void    on_edge_inserted( weak_edge_t& weakEdge ) noexcept override;
+    virtual void    on_edge_removed( weak_edge_t& weakEdge ) noexcept override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Fingerprint Implementation *///----------------------------------
+    //@{
+private:
+    auto    hash_node(const node_t& node) const noexcept -> std::uint64_t;
+    //! Return edge hash from its actual end nodes hash (directed: source and destination are not commutative).
+    auto    hash_edge(const edge_t& edge) const noexcept -> std::uint64_t;
+    auto    insert_node(const node_t& node) noexcept -> void;
+    auto    insert_edge(const edge_t& edge) noexcept -> void;
+
+private:
+    node_hasher_t                                       _hasher;
+    std::uint64_t                                       _fingerprint = 0;
+    //! Hash of every node and edge when it has been inserted, subtracted on removal.
+    std::unordered_map<const node_t*, std::uint64_t>    _node_hashes;
+    std::unordered_map<const edge_t*, std::uint64_t>    _edge_hashes;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::gtpo
+
+#include "./fingerprint.hpp"
+
+#endif // gtpo_fingerprint_h
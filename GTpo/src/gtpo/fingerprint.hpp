@@ -0,0 +1,187 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	fingerprint.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+namespace gtpo { // ::gtpo
+
+/* Fingerprint Management *///-------------------------------------------------
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::reset(const graph_t& graph) -> void
+{
+    _fingerprint = 0;
+    _node_hashes.clear();
+    _edge_hashes.clear();
+    _node_hashes.reserve(graph.get_node_count());
+    _edge_hashes.reserve(graph.get_edge_count());
+    for ( const auto& node : graph.get_nodes() )
+        if ( node )
+            insert_node(*node);
+    for ( const auto& edge : graph.get_edges() )
+        if ( edge )
+            insert_edge(*edge);
+}
+
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::get_node_hash(const node_t& node) const noexcept -> std::uint64_t
+{
+    const auto hash = _node_hashes.find(&node);
+    return hash != _node_hashes.cend() ? hash->second : 0;
+}
+
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::update_node(const weak_node_t& weakNode) noexcept -> void
+{
+    const auto node = weakNode.lock();
+    if ( !node ||
+         !this->isEnabled() )
+        return;
+    auto hash = _node_hashes.find(node.get());
+    if ( hash == _node_hashes.end() )
+        return;
+    _fingerprint -= hash->second;
+    hash->second = hash_node(*node);
+    _fingerprint += hash->second;
+    const auto rehash = [this](const weak_edge_t& weakEdge) {
+        const auto edge = weakEdge.lock();
+        if ( !edge )
+            return;
+        auto edgeHash = _edge_hashes.find(edge.get());
+        if ( edgeHash == _edge_hashes.end() )
+            return;
+        _fingerprint -= edgeHash->second;
+        edgeHash->second = hash_edge(*edge);
+        _fingerprint += edgeHash->second;
+    };
+    for ( const auto& inEdge : node->get_in_edges() )
+        rehash(inEdge);
+    for ( const auto& outEdge : node->get_out_edges() )
+        rehash(outEdge);
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Notification Interface *///-------------------------------------------
+template <class config_t>
+void    fingerprint_behaviour<config_t>::on_node_inserted( weak_node_t& weakNode ) noexcept
+{
+    const auto node = weakNode.lock();
+    if ( node &&
+         this->isEnabled() )
+        insert_node(*node);
+}
+
+template <class config_t>
+void    fingerprint_behaviour<config_t>::on_node_removed( weak_node_t& weakNode ) noexcept
+{
+    const auto node = weakNode.lock();
+    if ( !node ||
+         !this->isEnabled() )
+        return;
+    const auto hash = _node_hashes.find(node.get());
+    if ( hash != _node_hashes.end() ) {
+        _fingerprint -= hash->second;
+        _node_hashes.erase(hash);
+    }
+}
+
+template <class config_t>
+void    fingerprint_behaviour<config_t>::on_edge_inserted( weak_edge_t& weakEdge ) noexcept
+{
+    const auto edge = weakEdge.lock();
+    if ( edge &&
+         this->isEnabled() )
+        insert_edge(*edge);
+}
+
+template <class config_t>
+void    fingerprint_behaviour<config_t>::on_edge_removed( weak_edge_t& weakEdge ) noexcept
+{
+    const auto edge = weakEdge.lock();
+    if ( !edge ||
+         !this->isEnabled() )
+        return;
+    const auto hash = _edge_hashes.find(edge.get());
+    if ( hash != _edge_hashes.end() ) {
+        _fingerprint -= hash->second;
+        _edge_hashes.erase(hash);
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Fingerprint Implementation *///---------------------------------------------
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::hash_node(const node_t& node) const noexcept -> std::uint64_t
+{
+    std::uint64_t hash = 0x9e3779b97f4a7c15ull;
+    if ( _hasher ) {
+        try {
+            hash = _hasher(node);
+        } catch (...) { /* Nil: node is hashed with default hash */ }
+    }
+    return mix(hash);
+}
+
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::hash_edge(const edge_t& edge) const noexcept -> std::uint64_t
+{
+    const auto source = edge.get_src().lock();
+    const auto destination = edge.get_dst().lock();
+    const auto source_hash = source ? get_node_hash(*source) : 0;
+    const auto destination_hash = destination ? get_node_hash(*destination) : 0;
+    // Rotate destination hash so that edges a -> b and b -> a have different hashes
+    return mix(source_hash ^ ((destination_hash << 23) | (destination_hash >> 41)) ^ 0x5851f42d4c957f2dull);
+}
+
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::insert_node(const node_t& node) noexcept -> void
+{
+    try {
+        const auto hash = hash_node(node);
+        const auto inserted = _node_hashes.emplace(&node, hash);
+        if ( inserted.second )
+            _fingerprint += hash;
+    } catch (...) { /* Nil: node is then ignored by fingerprint */ }
+}
+
+template <class config_t>
+auto    fingerprint_behaviour<config_t>::insert_edge(const edge_t& edge) noexcept -> void
+{
+    try {
+        const auto hash = hash_edge(edge);
+        const auto inserted = _edge_hashes.emplace(&edge, hash);
+        if ( inserted.second )
+            _fingerprint += hash;
+    } catch (...) { /* Nil: edge is then ignored by fingerprint */ }
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
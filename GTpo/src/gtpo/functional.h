@@ -39,12 +39,18 @@
 #include <unordered_set>
 #include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
 #include <unordered_map>
+#include <vector>
+#include <atomic>
+#include <algorithm>        // std::min
+#include <type_traits>
 
 // GTpo headers
 #include "./utils.h"
 #include "./config.h"
 #include "./edge.h"
 #include "./node.h"
+#include "./csr_view.h"
+#include "./parallel.h"
 
 namespace gtpo { // ::gtpo
 
@@ -60,7 +66,7 @@ template <typename src_node_t, typename dst_node_t>
 struct default_clone_node_func_t
 {
     std::shared_ptr<dst_node_t> operator()(const src_node_t& src_node) {
-        return std::make_shared<dst_node_t>(src_node);
+        return std::make_shared<dst_node_t>(*src_node);
     }
 };
 
@@ -75,7 +81,8 @@ struct default_clone_node_func_t
 template <typename src_graph_t, typename dst_graph_t,
           typename filter_node_func_t,
           typename clone_node_func_t = default_clone_node_func_t<typename src_graph_t::shared_node_t,
-                                                                 typename dst_graph_t::node_t>>
+                                                                 typename dst_graph_t::node_t>,
+          typename = std::enable_if_t<!is_execution_policy<std::decay_t<src_graph_t>>::value>>
 auto    filter(const src_graph_t& src, dst_graph_t& dst,
                filter_node_func_t filter_func,
                clone_node_func_t clone_node = clone_node_func_t{}) -> bool
@@ -143,7 +150,8 @@ auto    filter(const src_graph_t& src, dst_graph_t& dst,
  * \note May throw std::bad_alloc
  * \return true is \c src has been succesfully copied to \c dst.
  */
-template <typename src_graph_t, typename dst_graph_t, typename map_node_func_t>
+template <typename src_graph_t, typename dst_graph_t, typename map_node_func_t,
+          typename = std::enable_if_t<!is_execution_policy<std::decay_t<src_graph_t>>::value>>
 auto    map(const src_graph_t& src, dst_graph_t& dst, map_node_func_t f) -> bool
 {
     // PRECONDITIONS:
@@ -201,7 +209,7 @@ template <typename src_node_t, typename dst_node_t>
 struct copy_node_func_t
 {
     std::shared_ptr<dst_node_t> operator()(const src_node_t& src_node) {
-        return std::make_shared<dst_node_t>(src_node);
+        return std::make_shared<dst_node_t>(*src_node);
     }
 };
 
@@ -237,7 +245,8 @@ auto    copy(const src_graph_t& src, dst_graph_t& dst,
 template <typename src_graph_t, typename dst_graph_t,
           typename filter_node_func_t,
           typename map_node_func_t = default_clone_node_func_t<typename src_graph_t::shared_node_t,
-                                                               typename dst_graph_t::node_t>>
+                                                               typename dst_graph_t::node_t>,
+          typename = std::enable_if_t<!is_execution_policy<std::decay_t<src_graph_t>>::value>>
 auto    filter_map( const src_graph_t& src, dst_graph_t& dst,
                     filter_node_func_t filter_node_func,
                     map_node_func_t map_node_func = map_node_func_t{} ) -> bool
@@ -299,6 +308,179 @@ auto    filter_map( const src_graph_t& src, dst_graph_t& dst,
 
 //-----------------------------------------------------------------------------
 
+
+/* Parallel Graph Copy & Filter *///-------------------------------------------
+namespace impl { // ::gtpo::impl
+
+/*! \brief Parallel implementation of gtpo::filter_map(), gtpo::filter() and gtpo::map() with a parallel_policy.
+ *
+ * \c filter_node_func and \c map_node_func are called concurrently from multiple threads (at most once per
+ * source node, in no particular order), they must be thread safe.
+ */
+template <typename src_graph_t, typename dst_graph_t,
+          typename filter_node_func_t, typename map_node_func_t>
+auto    parallel_filter_map( const parallel_policy& policy,
+                             const src_graph_t& src, dst_graph_t& dst,
+                             filter_node_func_t& filter_node_func,
+                             map_node_func_t& map_node_func ) -> bool
+{
+    // PRECONDITIONS:
+        // dst must be empty
+    if (!dst.is_empty())
+        return false;
+
+    // ALGORITHM:
+        // 1. Freeze source topology in a csr_view, source nodes are then identified by their dense index
+        //    (no source to destination hash map, no edge endpoints locking).
+        // 2. Evaluate filter and map functors in parallel: dst_nodes[i] is the node mapped from source
+        //    node i, or nullptr if node i is not selected. Threads grab chunks of nodes from an atomic
+        //    counter since functors cost might vary a lot from one node to another.
+        // 3. Insert selected nodes in dst with a single batch insertion.
+        // 4. Assemble destination edges in one pass over the CSR out edges, then batch insert them.
+    using src_shared_node_t = typename src_graph_t::shared_node_t;
+    using dst_shared_node_t = typename dst_graph_t::shared_node_t;
+    using dst_shared_edge_t = typename dst_graph_t::shared_edge_t;
+    using dst_edge_t        = typename dst_shared_edge_t::element_type;
+    using csr_t             = gtpo::csr_view<src_graph_t>;
+    using index_t           = typename csr_t::index_t;
+
+    // 1.
+    const csr_t csr{src};
+    const std::size_t node_count = csr.get_node_count();
+    std::vector<src_shared_node_t> src_nodes;
+    src_nodes.reserve(node_count);
+    for ( const auto& src_node : src.get_nodes() )  // Note: csr_view dense indexes follow get_nodes() order
+        src_nodes.push_back(src_node);
+
+    // 2.
+    std::vector<dst_shared_node_t> dst_nodes(node_count);
+    constexpr std::size_t   chunk_size = 64;
+    std::atomic<std::size_t> next_chunk{0};
+    std::atomic<bool>       failed{false};
+    const auto thread_count = std::min(impl::get_thread_count(policy.thread_count),
+                                       (node_count + chunk_size - 1) / chunk_size);
+    impl::parallel_run(thread_count, [&](std::size_t, std::size_t, impl::barrier&) {
+        try {
+            while ( !failed.load(std::memory_order_relaxed) ) {
+                const auto first = next_chunk.fetch_add(chunk_size, std::memory_order_relaxed);
+                if ( first >= node_count )
+                    break;
+                const auto last = std::min(first + chunk_size, node_count);
+                for ( auto n = first; n < last; ++n ) {
+                    if ( !filter_node_func(src_nodes[n]) )
+                        continue;
+                    dst_nodes[n] = map_node_func(src_nodes[n]);
+                    if ( !dst_nodes[n] )
+                        failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        } catch (...) { failed.store(true, std::memory_order_relaxed); }
+    });
+    if ( failed.load() )
+        return false;
+
+    // 3.
+    std::vector<dst_shared_node_t> selected_nodes;
+    selected_nodes.reserve(node_count);
+    for ( const auto& dst_node : dst_nodes )
+        if ( dst_node )
+            selected_nodes.push_back(dst_node);
+    dst.insert_nodes(selected_nodes.cbegin(), selected_nodes.cend());
+
+    // 4.
+    std::vector<dst_shared_edge_t> dst_edges;
+    dst_edges.reserve(csr.get_edge_count());
+    for ( index_t n = 0; n < node_count; ++n ) {
+        if ( !dst_nodes[n] )
+            continue;
+        for ( auto t = csr.out_begin(n); t != csr.out_end(n); ++t ) {
+            if ( !dst_nodes[*t] )
+                continue;
+            auto dst_edge = std::allocate_shared<dst_edge_t>(dst.get_edge_allocator());
+            dst_edge->set_src(dst_nodes[n]);
+            dst_edge->set_dst(dst_nodes[*t]);
+            dst_edges.push_back(std::move(dst_edge));
+        }
+    }
+    dst.insert_edges(dst_edges.cbegin(), dst_edges.cend());
+    return true;
+}
+
+} // ::gtpo::impl
+
+/*! \brief Parallel gtpo::filter_map(): filter and map functors are evaluated concurrently on \c policy threads.
+ *
+ * Usefull when \c filter_node_func or \c map_node_func are expensive (property evaluation for example),
+ * edges are then assembled in a single pass and batch inserted in \c dst.
+ *
+ * \code
+ *   gtpo::graph<> src, dst;
+ *   gtpo::filter_map(gtpo::par, src, dst, [](const auto& node) { return expensive_predicate(node); });
+ * \endcode
+ *
+ * \warning Functors are called from multiple threads: they must be thread safe and must not depend on
+ * call order (a stateful functor, like a call counter, will not select the same nodes than with gtpo::seq).
+ * \note Destination nodes are inserted in source node order, edges are created for every source edge
+ * whose nodes are both selected, hyper edges are ignored.
+ * \note May throw std::bad_alloc
+ * \return true is \c src has been succesfully copied to \c dst.
+ */
+template <typename src_graph_t, typename dst_graph_t,
+          typename filter_node_func_t,
+          typename map_node_func_t = default_clone_node_func_t<typename src_graph_t::shared_node_t,
+                                                               typename dst_graph_t::node_t>>
+auto    filter_map( const parallel_policy& policy,
+                    const src_graph_t& src, dst_graph_t& dst,
+                    filter_node_func_t filter_node_func,
+                    map_node_func_t map_node_func = map_node_func_t{} ) -> bool
+{
+    return impl::parallel_filter_map(policy, src, dst, filter_node_func, map_node_func);
+}
+
+//! Parallel gtpo::filter(), see parallel gtpo::filter_map() for thread safety requirements.
+template <typename src_graph_t, typename dst_graph_t,
+          typename filter_node_func_t,
+          typename clone_node_func_t = default_clone_node_func_t<typename src_graph_t::shared_node_t,
+                                                                 typename dst_graph_t::node_t>>
+auto    filter( const parallel_policy& policy,
+                const src_graph_t& src, dst_graph_t& dst,
+                filter_node_func_t filter_func,
+                clone_node_func_t clone_node = clone_node_func_t{} ) -> bool
+{
+    return impl::parallel_filter_map(policy, src, dst, filter_func, clone_node);
+}
+
+//! Parallel gtpo::map(), see parallel gtpo::filter_map() for thread safety requirements.
+template <typename src_graph_t, typename dst_graph_t, typename map_node_func_t>
+auto    map( const parallel_policy& policy,
+             const src_graph_t& src, dst_graph_t& dst, map_node_func_t f ) -> bool
+{
+    auto select_all = [](const typename src_graph_t::shared_node_t&) noexcept { return true; };
+    return impl::parallel_filter_map(policy, src, dst, select_all, f);
+}
+
+//! Sequential gtpo::filter_map() overload (equivalent to gtpo::filter_map() without policy).
+template <typename src_graph_t, typename dst_graph_t, typename... args_t>
+auto    filter_map( sequential_policy, const src_graph_t& src, dst_graph_t& dst, args_t&&... args ) -> bool
+{
+    return gtpo::filter_map(src, dst, std::forward<args_t>(args)...);
+}
+
+//! Sequential gtpo::filter() overload (equivalent to gtpo::filter() without policy).
+template <typename src_graph_t, typename dst_graph_t, typename... args_t>
+auto    filter( sequential_policy, const src_graph_t& src, dst_graph_t& dst, args_t&&... args ) -> bool
+{
+    return gtpo::filter(src, dst, std::forward<args_t>(args)...);
+}
+
+//! Sequential gtpo::map() overload (equivalent to gtpo::map() without policy).
+template <typename src_graph_t, typename dst_graph_t, typename map_node_func_t>
+auto    map( sequential_policy, const src_graph_t& src, dst_graph_t& dst, map_node_func_t f ) -> bool
+{
+    return gtpo::map(src, dst, f);
+}
+//-----------------------------------------------------------------------------
+
 } // ::gtpo
 
 
@@ -40,13 +40,13 @@
 #include <unordered_set>
 #include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
 #include <iterator>         // std::forward_iterator_tag
+#include <random>           // std::mt19937
 
 // GTpo headers
 #include "./utils.h"
 #include "./config.h"
 #include "./edge.h"
 #include "./node.h"
-#include "./group.h"
 
 namespace gtpo { // ::gtpo
 
@@ -71,26 +71,67 @@ auto complete_tree_rec(graph_t& graph, const int depth, const int degree = 2) ->
 
 
 /* Graph Generation Algorithms *///--------------------------------------------
-/*! \brief Generate a fully connected directed graph.
+/*! \brief Generate a fully connected directed graph with \c n nodes in \c graph.
  *
- * \note Circuit will be created between every edges, ie: complete_graph(2) -> { [n0, n1], [ (n0->n1), (n1->n0 )] }.
+ * \note Circuit will be created between every edges, ie: complete_graph(g, 2) -> { [n0, n1], [ (n0->n1), (n1->n0 )] }.
+ * \note \c graph must be empty.
  */
 template <class graph_t>
-auto    complete_graph(const int n) noexcept -> graph_t;
+auto    complete_graph(graph_t& graph, const int n) -> void;
 
-/*! \brief Generate a random graph with \c n nodes using Erdos-Renyi random graph model.
+/*! \brief Generate a directed random graph with \c n nodes using Erdos-Renyi G(n, p) random graph model.
+ *
+ * Instead of testing every n*(n-1) possible edges, the number of skipped candidate edges between two
+ * created edges is drawn from a geometric distribution (Batagelj and Brandes "Efficient generation of large
+ * random networks"): complexity is O(n + m) where m is the number of generated edges. Self loops are
+ * never generated.
  *
  * \param n total number of nodes.
  * \param p Probability that an edge should be created between every possible node permutation.
+ * \param seed Random number generator seed, generated topology is deterministic for a given seed.
+ * \note \c graph must be empty.
  */
 template <class graph_t>
-auto    gnp_random_graph(const int n, const double p) noexcept -> graph_t;
+auto    gnp_random_graph(graph_t& graph, const int n, const double p,
+                         const std::mt19937::result_type seed = std::mt19937::default_seed) -> void;
 
 /*! \brief Shortcut to gnp_random_graph() generation function.
  *
  */
 template <class graph_t>
-auto    erdos_renyi_graph(const int n, const double p) noexcept -> graph_t { return gnp_random_graph<graph_t>(n, p); }
+auto    erdos_renyi_graph(graph_t& graph, const int n, const double p,
+                          const std::mt19937::result_type seed = std::mt19937::default_seed) -> void {
+    gnp_random_graph(graph, n, p, seed);
+}
+
+/*! \brief Generate a random directed acyclic graph with \c n nodes: edge (ni -> nj) with i < j is created with probability \c p.
+ *
+ * Geometric skipping is used over the n*(n-1)/2 candidate edges, complexity is O(n + m).
+ * \note \c graph must be empty.
+ */
+template <class graph_t>
+auto    random_dag(graph_t& graph, const int n, const double p,
+                   const std::mt19937::result_type seed = std::mt19937::default_seed) -> void;
+
+/*! \brief Generate a scale free graph with \c n nodes using Barabasi-Albert preferential attachment model.
+ *
+ * Graph is initialized with \c m unconnected nodes, then each new node is linked with \c m edges (from the new
+ * node to existing nodes) to distinct existing nodes choosen with a probability proportional to their degree.
+ * Complexity is O(n * m), generated graph is a DAG with (n - m) * m edges.
+ *
+ * \note \c graph must be empty, \c m must be >= 1 and < \c n.
+ */
+template <class graph_t>
+auto    barabasi_albert_graph(graph_t& graph, const int n, const int m,
+                              const std::mt19937::result_type seed = std::mt19937::default_seed) -> void;
+
+/*! \brief Generate a 2D \c rows x \c columns lattice, every node is linked to its right and bottom neighbours.
+ *
+ * \note example: grid_graph(g, 2, 2) -> { [n0, n1, n2, n3], [ (n0->n1), (n0->n2), (n1->n3), (n2->n3) ] }.
+ * \note \c graph must be empty.
+ */
+template <class graph_t>
+auto    grid_graph(graph_t& graph, const int rows, const int columns) -> void;
 //-----------------------------------------------------------------------------
 
 } // ::gtpo
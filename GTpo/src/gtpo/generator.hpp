@@ -36,13 +36,16 @@
 #include <list>
 #include <unordered_set>
 #include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
+#include <vector>
+#include <algorithm>        // std::find
+#include <iostream>         // std::cerr
+#include <cmath>            // std::log
 
 // GTpo headers
 #include "./utils.h"
 #include "./config.h"
 #include "./edge.h"
 #include "./node.h"
-#include "./group.h"
 
 namespace gtpo { // ::gtpo
 
@@ -97,17 +100,217 @@ auto complete_tree_rec(graph_t& graph, const int depth, const int degree) -> voi
 
 
 /* Graph Generation Algorithms *///--------------------------------------------
+namespace impl { // ::gtpo::impl
+
+//! Return true if \c graph is empty and \c n is positive, log an error for \c generator otherwise.
+template <class graph_t>
+auto    check_generator_preconditions(const graph_t& graph, const int n, const char* generator) -> bool
+{
+    if (graph.get_node_count() != 0) {
+        std::cerr << "gtpo::" << generator << "<>(): graph must be empty." << std::endl;
+        return false;
+    }
+    if (n < 0) {
+        std::cerr << "gtpo::" << generator << "<>(): node count must be positive." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+//! Create and batch insert \c n nodes in \c graph, return created nodes.
+template <class graph_t>
+auto    generate_nodes(graph_t& graph, const int n) -> std::vector<typename graph_t::shared_node_t>
+{
+    std::vector<typename graph_t::shared_node_t> nodes;
+    nodes.reserve(static_cast<std::size_t>(n));
+    for ( int i = 0; i < n; ++i )
+        nodes.push_back(std::allocate_shared<typename graph_t::node_t>(graph.get_node_allocator()));
+    graph.insert_nodes(nodes.cbegin(), nodes.cend());
+    return nodes;
+}
+
+//! Create an (uninserted) edge from \c src to \c dst using \c graph edge allocator.
+template <class graph_t>
+auto    generate_edge(const graph_t& graph,
+                      const typename graph_t::shared_node_t& src,
+                      const typename graph_t::shared_node_t& dst) -> typename graph_t::shared_edge_t
+{
+    using edge_t = typename graph_t::shared_edge_t::element_type;
+    auto edge = std::allocate_shared<edge_t>(graph.get_edge_allocator());
+    edge->set_src(src);
+    edge->set_dst(dst);
+    return edge;
+}
+
+//! Return the number of candidates to skip before next created edge when edges are created with probability \c p (\c log_q is log(1 - p)).
+template <class random_t>
+auto    geometric_skip(random_t& generator, const double log_q) -> long long
+{
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+    return static_cast<long long>(std::log(1.0 - distribution(generator)) / log_q);
+}
+
+} // ::gtpo::impl
+
+template <class graph_t>
+auto    complete_graph(graph_t& graph, const int n) -> void
+{
+    if (!impl::check_generator_preconditions(graph, n, "complete_graph"))
+        return;
+    const auto nodes = impl::generate_nodes(graph, n);
+    std::vector<typename graph_t::shared_edge_t> edges;
+    edges.reserve(nodes.size() * (nodes.size() > 0 ? nodes.size() - 1 : 0));
+    for ( const auto& src : nodes )
+        for ( const auto& dst : nodes )
+            if ( src != dst )
+                edges.push_back(impl::generate_edge(graph, src, dst));
+    graph.insert_edges(edges.cbegin(), edges.cend());
+}
+
+template <class graph_t>
+auto    gnp_random_graph(graph_t& graph, const int n, const double p,
+                         const std::mt19937::result_type seed) -> void
+{
+    if (!impl::check_generator_preconditions(graph, n, "gnp_random_graph"))
+        return;
+    if (p >= 1.0) {
+        complete_graph(graph, n);
+        return;
+    }
+    const auto nodes = impl::generate_nodes(graph, n);
+    if (p <= 0.0)
+        return;
+
+    // ALGORITHM: Batagelj-Brandes geometric skipping (see NetworkX fast_gnp_random_graph()):
+        // Candidate edges (v -> w) are enumerated in order, v is the current source node and w
+        // moves across destination nodes, skipping a geometrically distributed number of candidates
+        // between two created edges. Self loops are skipped.
+    std::mt19937 generator{seed};
+    const double log_q = std::log(1.0 - p);
+    std::vector<typename graph_t::shared_edge_t> edges;
+    edges.reserve(static_cast<std::size_t>(p * n * (n - 1.)));
+    const long long nn = n;
+    long long v = 0;
+    long long w = -1;
+    while ( v < nn ) {
+        w += 1 + impl::geometric_skip(generator, log_q);
+        if ( v == w )
+            ++w;
+        while ( v < nn && nn <= w ) {
+            w -= nn;
+            ++v;
+            if ( v == w )
+                ++w;
+        }
+        if ( v < nn )
+            edges.push_back(impl::generate_edge(graph, nodes[v], nodes[w]));
+    }
+    graph.insert_edges(edges.cbegin(), edges.cend());
+}
+
 template <class graph_t>
-auto    complete_graph(const int n) noexcept -> graph_t
+auto    random_dag(graph_t& graph, const int n, const double p,
+                   const std::mt19937::result_type seed) -> void
 {
-    static_cast<void>(n);
+    if (!impl::check_generator_preconditions(graph, n, "random_dag"))
+        return;
+    const auto nodes = impl::generate_nodes(graph, n);
+    if (p <= 0.0)
+        return;
+    std::vector<typename graph_t::shared_edge_t> edges;
+    if (p >= 1.0) {
+        edges.reserve(nodes.size() * (nodes.size() > 0 ? nodes.size() - 1 : 0) / 2);
+        for ( std::size_t v = 1; v < nodes.size(); ++v )
+            for ( std::size_t w = 0; w < v; ++w )
+                edges.push_back(impl::generate_edge(graph, nodes[w], nodes[v]));
+        graph.insert_edges(edges.cbegin(), edges.cend());
+        return;
+    }
+
+    // ALGORITHM: Geometric skipping over candidate edges (w -> v) with w < v (lower triangular
+    // adjacency matrix), edges always go from a lower to an higher node index.
+    std::mt19937 generator{seed};
+    const double log_q = std::log(1.0 - p);
+    edges.reserve(static_cast<std::size_t>(p * n * (n - 1.) / 2.));
+    const long long nn = n;
+    long long v = 1;
+    long long w = -1;
+    while ( v < nn ) {
+        w += 1 + impl::geometric_skip(generator, log_q);
+        while ( w >= v && v < nn ) {
+            w -= v;
+            ++v;
+        }
+        if ( v < nn )
+            edges.push_back(impl::generate_edge(graph, nodes[w], nodes[v]));
+    }
+    graph.insert_edges(edges.cbegin(), edges.cend());
 }
 
 template <class graph_t>
-auto    gnp_random_graph(const int n, const double p) noexcept -> graph_t
+auto    barabasi_albert_graph(graph_t& graph, const int n, const int m,
+                              const std::mt19937::result_type seed) -> void
 {
-    static_cast<void>(n);
-    static_cast<void>(p);
+    if (!impl::check_generator_preconditions(graph, n, "barabasi_albert_graph"))
+        return;
+    if (m < 1 || m >= n) {
+        std::cerr << "gtpo::barabasi_albert_graph<>(): m must be >= 1 and < n." << std::endl;
+        return;
+    }
+    const auto nodes = impl::generate_nodes(graph, n);
+
+    // ALGORITHM (see NetworkX barabasi_albert_graph()):
+        // 1. Start with m targets nodes.
+        // 2. Link every new node to actual targets, then choose m distinct new targets in a list
+        //    where every node appear once per incident edge: selection probability is proportional
+        //    to node degree.
+    std::mt19937 generator{seed};
+    std::vector<typename graph_t::shared_edge_t> edges;
+    edges.reserve(static_cast<std::size_t>(n - m) * static_cast<std::size_t>(m));
+    std::vector<int> repeated_nodes;
+    repeated_nodes.reserve(2 * static_cast<std::size_t>(n - m) * static_cast<std::size_t>(m));
+    std::vector<int> targets;
+    targets.reserve(static_cast<std::size_t>(m));
+    for ( int t = 0; t < m; ++t )   // 1.
+        targets.push_back(t);
+    for ( int source = m; source < n; ++source ) {
+        for ( const auto target : targets ) {  // 2.
+            edges.push_back(impl::generate_edge(graph, nodes[source], nodes[target]));
+            repeated_nodes.push_back(target);
+            repeated_nodes.push_back(source);
+        }
+        targets.clear();
+        std::uniform_int_distribution<std::size_t> distribution{0, repeated_nodes.size() - 1};
+        while ( targets.size() < static_cast<std::size_t>(m) ) {
+            const auto target = repeated_nodes[distribution(generator)];
+            if ( std::find(targets.cbegin(), targets.cend(), target) == targets.cend() )
+                targets.push_back(target);
+        }
+    }
+    graph.insert_edges(edges.cbegin(), edges.cend());
+}
+
+template <class graph_t>
+auto    grid_graph(graph_t& graph, const int rows, const int columns) -> void
+{
+    if (rows < 0 || columns < 0) {
+        std::cerr << "gtpo::grid_graph<>(): rows and columns must be positive." << std::endl;
+        return;
+    }
+    if (!impl::check_generator_preconditions(graph, rows * columns, "grid_graph"))
+        return;
+    const auto nodes = impl::generate_nodes(graph, rows * columns);
+    std::vector<typename graph_t::shared_edge_t> edges;
+    edges.reserve(2 * nodes.size());
+    for ( int r = 0; r < rows; ++r )
+        for ( int c = 0; c < columns; ++c ) {
+            const auto& node = nodes[r * columns + c];
+            if ( c + 1 < columns )
+                edges.push_back(impl::generate_edge(graph, node, nodes[r * columns + c + 1]));
+            if ( r + 1 < rows )
+                edges.push_back(impl::generate_edge(graph, node, nodes[(r + 1) * columns + c]));
+        }
+    graph.insert_edges(edges.cbegin(), edges.cend());
 }
 //-----------------------------------------------------------------------------
 
@@ -38,10 +38,15 @@
 // STD headers
 #include <list>
 #include <unordered_set>
-#include <memory>           // std::shared_ptr std::weak_ptr and std::make_shared
+#include <unordered_map>
+#include <vector>
+#include <memory>           // std::shared_ptr std::weak_ptr and std::allocate_shared
 #include <functional>       // std::hash
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <cstdint>          // std::uint64_t
+#include <mutex>            // std::unique_lock
+#include <shared_mutex>     // std::shared_lock
 
 // GTpo headers
 #include "./utils.h"
@@ -49,6 +54,9 @@
 #include "./edge.h"
 #include "./node.h"
 #include "./graph_behaviour.h"
+#include "./snapshot.h"
+#include "./handle.h"
+#include "./reorder.h"
 
 /*! \brief Main GTpo namespace (\#include \<GTpo\>).
  */
@@ -86,6 +94,7 @@ public:
     using weak_nodes_t        = typename config_t::template node_container_t< weak_node_t >;
     using weak_nodes_t_search = typename config_t::template search_container_t< weak_node_t >;
 
+    using edge_t              = typename config_t::final_edge_t;
     using weak_edge_t         = typename std::weak_ptr<typename config_t::final_edge_t>;
     using shared_edge_t       = typename std::shared_ptr<typename config_t::final_edge_t>;
     using weak_edges_t        = typename config_t::template edge_container_t< weak_edge_t >;
@@ -134,6 +143,141 @@ public:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Graph Notification Scope *///------------------------------------
+    //@{
+public:
+    /*! \brief RAII scope deferring behaviours insertion notifications until the (outermost) scope is closed.
+     *
+     * While a scope is open, node and edge insertion notifications are queued, they are sent on scope exit
+     * with a single nodes_inserted() and a single edges_inserted() call. Static behaviours that do not
+     * set \c batch_notifications receive them one at a time. Node level in/out node inserted notifications
+     * are replayed after graph behaviours have been notified.
+     *
+     * \code
+     *   gtpo::graph<> g;
+     *   {
+     *     gtpo::graph<>::notification_scope scope{g};
+     *     for ( ... )
+     *       g.create_edge(src, dst);   // No behaviour notification
+     *   }                              // Behaviours are notified once
+     * \endcode
+     *
+     * \note Removal notifications are never deferred, pending insertion notifications are flushed
+     * before any node or edge removal.
+     */
+    class notification_scope
+    {
+    public:
+        explicit notification_scope( graph& g ) noexcept : _graph( g ) { _graph.begin_deferred_notifications(); }
+        ~notification_scope() noexcept { _graph.end_deferred_notifications(); }
+        notification_scope( const notification_scope& ) = delete;
+        notification_scope& operator=( const notification_scope& ) = delete;
+    private:
+        graph&  _graph;
+    };
+
+    //! Start deferring insertion notifications (prefer using a notification_scope), calls can be nested.
+    inline auto begin_deferred_notifications() noexcept -> void { ++_notification_depth; }
+    //! End deferring insertion notifications, pending notifications are sent when outermost deferral ends.
+    auto        end_deferred_notifications() noexcept -> void;
+    //! Return true if insertion notifications are actually deferred.
+    inline auto is_notification_deferred() const noexcept -> bool { return _notification_depth > 0; }
+    //! Immediately send pending insertion notifications (even when notifications are still deferred).
+    auto        flush_notifications() noexcept -> void;
+
+private:
+    using deferred_nodes_t = typename behaviourable_base::dynamic_graph_behaviour_t::weak_nodes_t;
+    using deferred_edges_t = typename behaviourable_base::dynamic_graph_behaviour_t::weak_edges_t;
+
+    std::size_t         _notification_depth = 0;
+    deferred_nodes_t    _deferred_nodes;
+    deferred_edges_t    _deferred_edges;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Concurrency *///------------------------------------------
+    //@{
+public:
+    using concurrency_policy_t = typename config_t::concurrency_policy;
+    using mutex_t              = typename concurrency_policy_t::mutex_t;
+    using read_lock_t          = std::shared_lock<mutex_t>;
+    using write_lock_t         = std::unique_lock<mutex_t>;
+
+    /*! \brief Lock graph topology for reading from a reader thread, mutations are blocked until lock is released.
+     *
+     * No-op with default gtpo::no_concurrency policy, see gtpo::shared_mutex_concurrency.
+     * \code
+     *   {
+     *     const auto lock = g.read_lock();
+     *     for (const auto& node : g.get_nodes())
+     *       for (const auto& out_node : node->get_out_nodes()) { }
+     *   }
+     * \endcode
+     * \note Weak references locked while reading remain valid after lock is released, but their topology might change.
+     */
+    inline auto read_lock() const -> read_lock_t { return read_lock_t{_mutex}; }
+
+    /*! \brief Lock graph topology exclusively from writer thread, readers see mutations applied while lock is held as a single batch.
+     *
+     * Graph mutators already lock graph (a writer thread might lock again while owning the lock), no-op with
+     * default gtpo::no_concurrency policy.
+     */
+    inline auto write_lock() -> write_lock_t { return write_lock_t{_mutex}; }
+
+private:
+    mutable mutex_t     _mutex;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Topology Snapshot *///-------------------------------------
+    //@{
+public:
+    using snapshot_t        = gtpo::graph_snapshot<graph<config_t>>;
+    using shared_snapshot_t = std::shared_ptr<const snapshot_t>;
+
+    /*! \brief Return an immutable, thread shareable, index based snapshot of graph actual topology.
+     *
+     * Snapshot is built in O(V + E) and cached: while topology is not modified, snapshot() return the same
+     * shared instance in O(1), a snapshot still referenced elsewhere is never modified (a topology
+     * modification just detach graph cache from it).
+     * \note Must be called from the thread owning the graph (or writer thread with gtpo::shared_mutex_concurrency), may throw std::bad_alloc.
+     * \sa gtpo::graph_snapshot
+     */
+    auto        snapshot() const -> shared_snapshot_t;
+
+    //! Return graph topology revision, incremented on every node or edge insertion and removal.
+    inline auto get_topology_revision() const noexcept -> std::uint64_t { return _topology_revision; }
+
+private:
+    std::uint64_t               _topology_revision = 0;
+    mutable shared_snapshot_t   _snapshot;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Node Ordering *///----------------------------------------
+    //@{
+public:
+    /*! \brief Permute graph nodes container (and root nodes cache) following \c policy, edges are regrouped by source node.
+     *
+     * Topology is not modified, but get_nodes() order, and therefore csr_view, snapshot() and binary format dense
+     * node indexes, follow the new order: traversal algorithms working on dense indexes then access memory
+     * almost sequentially. Complexity is O(V + E) (see gtpo::reorder_permutation() for policies details).
+     *
+     * \code
+     *   g.reorder(gtpo::reorder_policy::reverse_cuthill_mckee);
+     *   gtpo::csr_view<gtpo::graph<>> csr{g};   // or g.snapshot()
+     *   const auto r = gtpo::linearize_dfs(csr);
+     * \endcode
+     * \note Nodes are not moved in memory (node address is node identity for the adjacency index and the user),
+     * allocate nodes with a config_t::node_allocator_t pool and reorder() before inserting them with insert_nodes()
+     * for a contiguous node storage.
+     * \note Behaviours are not notified, topology revision is incremented.
+     * \note May throw std::bad_alloc (graph is left unchanged).
+     */
+    auto        reorder(reorder_policy policy = reorder_policy::bfs) -> void;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Node Management *///---------------------------------------
     //@{
 public:
@@ -177,14 +321,50 @@ public:
      */
     auto    insert_node( shared_node_t node ) noexcept( false ) -> weak_node_t;
 
+    /*! \brief Insert a range [\c first, \c last) of nodes created outside of GTpo into the graph.
+     *
+     * Equivalent to insert_node() called on every node in range, but graph containers are reserved
+     * once and graph behaviours receive a single nodes_inserted() notification (instead of one
+     * node_inserted() per node), use it to load large graphs.
+     * \note \c forward_it must be a forward iterator dereferencing to shared_node_t.
+     * \throw gtpo::bad_topology_error with an error description if insertion fails.
+     */
+    template < class forward_it >
+    auto    insert_nodes( forward_it first, forward_it last ) noexcept( false ) -> void;
+
+    /*! \brief Unchecked version of insert_node() for trusted bulk loaders.
+     *
+     * \c node must be non nullptr and not already inserted in a graph: preconditions are not checked
+     * and container errors are not translated to gtpo::bad_topology_error.
+     * \throw std::bad_alloc if graph containers can't grow.
+     */
+    auto    insert_node_unchecked( shared_node_t node ) noexcept( false ) -> weak_node_t;
+
+    //! Unchecked version of insert_nodes(), every node in range must satisfy insert_node_unchecked() preconditions.
+    template < class forward_it >
+    auto    insert_nodes_unchecked( forward_it first, forward_it last ) noexcept( false ) -> void;
+
     /*! \brief Remove node \c node from graph.
      *
-     * Complexity depends on config_t::node_container_t.
+     * Shortcut to remove_nodes() for a single node: node adjacent edges are detached from their
+     * other endpoint in O(degree), graph containers are swept once.
      * \note If \c weakNode is actually grouped in a group, it will first be ungroup before
      * beeing removed (any group behaviour will also be notified that the node is ungrouped).
      * \throw gtpo::bad_topology_error if node can't be removed (or node is not valid).
      */
-    auto    remove_node( weak_node_t weakNode ) noexcept( false ) -> void;
+    auto    remove_node( const weak_node_t& weakNode ) noexcept( false ) -> void;
+
+    /*! \brief Remove a range [\c first, \c last) of nodes and all their adjacent edges from graph.
+     *
+     * Victims are marked in an hashed set, their adjacent edges are detached from surviving nodes only,
+     * then graph edges, nodes and root nodes containers are swept once (complexity is O(V + E) for the
+     * whole range instead of O(E) per removed edge). Graph behaviours receive a single nodes_removed()
+     * and edges_removed() notification.
+     * \note \c forward_it must dereference to a type convertible to weak_node_t (or shared_node_t).
+     * \throw gtpo::bad_topology_error if a node can't be removed (or is expired).
+     */
+    template < class forward_it >
+    auto    remove_nodes( forward_it first, forward_it last ) noexcept( false ) -> void;
 
     //! Return the number of nodes actually registered in graph.
     inline auto get_node_count() const -> size_type { return _nodes.size(); }
@@ -194,23 +374,27 @@ public:
     /*! \brief Install a given \c node in the root node cache.
      *
      * This method should not be directly used by an end user until you have deeply
-     * modified graph topology with non gtpo::graph<> methods.
+     * modified graph topology with non gtpo::graph<> methods. Installing an already
+     * installed root node has no effect, complexity is O(1).
      *
      * \throw gtpo::bad_topology_error if \c node in degree is different from 0.
      */
-    auto    install_root_node( weak_node_t node ) noexcept( false ) -> void;
+    auto    install_root_node( const weak_node_t& node ) noexcept( false ) -> void;
     /*! \brief Test if a given \c node is a root node.
      *
      * This method is safer than testing node->get_in_degree()==0, since it check
-     * \c node in degree and its presence in the internal root node cache.
+     * \c node in degree and its presence in the internal root node cache, complexity is O(1).
      *
      * \return true if \c node is a root node, false otherwise.
-     * \throw gtpo::bad_topology_error if there is a graph cohenrency problem (ie node is in the root node cache but has a zero in degree).
+     * \throw gtpo::bad_topology_error if \c node is expired.
      */
-    auto    is_root_node( weak_node_t node ) const noexcept( false ) -> bool;
+    auto    is_root_node( const weak_node_t& node ) const noexcept( false ) -> bool;
 
-    //! Use fast search container to find if a given \c node is part of this graph.
-    auto    contains( weak_node_t node ) const noexcept -> bool;
+    /*! \brief Use fast search container to find if a given \c node is part of this graph.
+     *
+     * Complexity is O(1) with hashed config_t::search_container_t (default to std::unordered_set).
+     */
+    auto    contains( const weak_node_t& node ) const noexcept -> bool;
 
     //! Graph main nodes container.
     inline auto     get_nodes() const -> const shared_nodes_t& { return _nodes; }
@@ -224,12 +408,32 @@ public:
     //! Return a const end iterator over graph shared_node_t nodes.
     inline auto     cend() const -> typename shared_nodes_t::const_iterator { return _nodes.cend(); }
 
-    //! Graph root nodes container.
-    inline auto     get_root_nodes() const -> const weak_nodes_t& { return _root_nodes; }
+    //! Root nodes container type: unordered, nodes are swap erased from it.
+    using root_nodes_t = std::vector<weak_node_t>;
+
+    //! Graph root nodes container (order is unspecified).
+    inline auto     get_root_nodes() const -> const root_nodes_t& { return _root_nodes; }
+
+    using node_allocator_t  = typename config_t::template node_allocator_t< node_t >;
+    //! Allocator used to allocate nodes (and their control block) in create_node().
+    inline auto     get_node_allocator() const noexcept -> const node_allocator_t& { return _node_allocator; }
 
 private:
+    //! Append \c node to root nodes if it is not already a root node, O(1).
+    auto    root_insert( node_t& node, const weak_node_t& weak_node ) noexcept( false ) -> void;
+    //! Swap erase \c node from root nodes if it is a root node, O(1).
+    auto    root_erase( node_t& node ) noexcept -> void;
+    //! Ungroup removed \c nodes with one ungroup_nodes() sweep per group (no-op when groups are not nodes).
+    auto    ungroup_removed_nodes( const std::vector<shared_node_t>& nodes, std::true_type ) noexcept( false ) -> void;
+    auto    ungroup_removed_nodes( const std::vector<shared_node_t>&, std::false_type ) noexcept -> void { }
+    //! Remove group \c node from groups container when it is removed with remove_nodes() (no-op when groups are not nodes).
+    auto    remove_removed_group( const shared_node_t& node, std::true_type ) noexcept( false ) -> void;
+    auto    remove_removed_group( const shared_node_t&, std::false_type ) noexcept -> void { }
+
+    node_allocator_t    _node_allocator;
     shared_nodes_t      _nodes;
-    weak_nodes_t        _root_nodes;
+    //! Every root node store its index in this container (see node<>::_root_index).
+    root_nodes_t        _root_nodes;
     weak_nodes_t_search _nodes_search;
     //@}
     //-------------------------------------------------------------------------
@@ -244,7 +448,11 @@ public:
      * \throw a gtpo::bad_topology_error if creation fails (either \c source or \c destination does not exists).
      */
     //template < class edge_t = typename config_t::final_edge_t >
-    auto        create_edge( weak_node_t source, weak_node_t destination ) noexcept(false) -> weak_edge_t;
+    auto        create_edge( const weak_node_t& source, const weak_node_t& destination ) noexcept(false) -> weak_edge_t;
+private:
+    auto        create_edge_impl( node_t& source, const weak_node_t& source_weak,
+                                  node_t& destination, const weak_node_t& destination_weak ) noexcept(false) -> weak_edge_t;
+public:
 
     /*! \brief Insert a directed edge created outside of GTpo into the graph.
      *
@@ -254,6 +462,40 @@ public:
      */
     auto        insert_edge( shared_edge_t edge ) noexcept( false ) -> weak_edge_t;
 
+    /*! \brief Insert a range [\c first, \c last) of directed edges created outside of GTpo into the graph.
+     *
+     * Equivalent to insert_edge() called on every edge in range, but graph containers are reserved
+     * once, root node cache is reconciled once at the end of insertion and graph behaviours
+     * receive a single edges_inserted() notification.
+     * \note \c forward_it must be a forward iterator dereferencing to shared_edge_t.
+     * \throw gtpo::bad_topology_error with an error description if insertion fails.
+     */
+    template < class forward_it >
+    auto        insert_edges( forward_it first, forward_it last ) noexcept( false ) -> void;
+
+    /*! \brief Unchecked version of insert_edge() for trusted bulk loaders.
+     *
+     * \c edge must be non nullptr with a source and destination nodes already inserted in this graph:
+     * preconditions are not checked and node errors are not translated to gtpo::bad_topology_error.
+     * \throw std::bad_alloc if graph or node containers can't grow.
+     */
+    auto        insert_edge_unchecked( shared_edge_t edge ) noexcept( false ) -> weak_edge_t;
+
+    //! Unchecked version of insert_edges(), every edge in range must satisfy insert_edge_unchecked() preconditions.
+    template < class forward_it >
+    auto        insert_edges_unchecked( forward_it first, forward_it last ) noexcept( false ) -> void;
+
+    /*! \brief Insert a range [\c first, \c last) of edges already linked to their source and destination nodes.
+     *
+     * Same as insert_edges_unchecked(), but edges are expected to be already registered in their source out edges
+     * and destination in edges (see node::add_out_edge() and node::add_in_edge()): node adjacency is not modified.
+     * Used to adopt a topology whose adjacency has been built outside of the graph (for example on a worker thread,
+     * before nodes are inserted with insert_nodes_unchecked()).
+     * \throw std::bad_alloc if graph containers can't grow.
+     */
+    template < class forward_it >
+    auto        adopt_edges_unchecked( forward_it first, forward_it last ) noexcept( false ) -> void;
+
     /*! \brief Remove first directed edge found between \c source and \c destination node.
      *
      * If the current graph<> config_t::edge_container_t and config_t::node_container_t allow parrallel edges support, the first
@@ -262,7 +504,7 @@ public:
      * Complexity is O(edge count) at worst.
      * \throw a gtpo::bad_topology_error if suppression fails (either \c source or \c destination or edge does not exists).
      */
-    auto        remove_edge( weak_node_t source, weak_node_t destination ) noexcept( false ) -> void;
+    auto        remove_edge( const weak_node_t& source, const weak_node_t& destination ) noexcept( false ) -> void;
 
     /*! \brief Remove all directed edge between \c source and \c destination node.
      *
@@ -272,36 +514,40 @@ public:
      * Worst case complexity is O(edge count).
      * \throw a gtpo::bad_topology_error if suppression fails (either \c source or \c destination or edge does not exists).
      */
-    auto        remove_all_edges( weak_node_t source, weak_node_t destination ) noexcept( false ) -> void;
+    auto        remove_all_edges( const weak_node_t& source, const weak_node_t& destination ) noexcept( false ) -> void;
 
     /*! \brief Remove directed edge \c edge.
      *
+     * \c edge might be a restricted hyper edge, hyper edges with \c edge as destination are removed too.
      * Worst case complexity is O(edge count).
      * \throw a gtpo::bad_topology_error if suppression fails (\c edge does not exists).
      */
-    auto        remove_edge( weak_edge_t edge ) noexcept( false ) -> void;
+    auto        remove_edge( const weak_edge_t& edge ) noexcept( false ) -> void;
 
     /*! \brief Look for the first directed edge between \c source and \c destination and return it.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(1) when config_t::enable_adjacency_index is true, O(source out degree) otherwise.
      * \return A shared reference on edge, en empty shared reference otherwise (result == false).
      * \throw noexcept.
      */
-    auto        find_edge( weak_node_t source, weak_node_t destination ) const noexcept -> weak_edge_t;
+    auto        find_edge( const weak_node_t& source, const weak_node_t& destination ) const noexcept -> weak_edge_t;
     /*! \brief Test if a directed edge exists between nodes \c source and \c destination.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Complexity is O(1) when config_t::enable_adjacency_index is true,
+     * O(source out degree) otherwise.
      * \throw noexcept.
      */
-    auto        has_edge( weak_node_t source, weak_node_t destination ) const noexcept -> bool;
+    auto        has_edge( const weak_node_t& source, const weak_node_t& destination ) const noexcept -> bool;
     /*! \brief Look for the first directed restricted hyper edge between \c source node and \c destination edge and return it.
      *
-     * Worst case complexity is O(edge count).
+     * Complexity is O(destination in hyper degree), hyper edges are indexed per target edge (see edge::get_in_hedges()).
      * \return A shared reference on edge, en empty shared reference otherwise (result == false).
      * \throw noexcept.
      */
-    auto        find_edge( weak_node_t source, weak_edge_t destination ) const noexcept -> weak_edge_t;
+    auto        find_edge( const weak_node_t& source, const weak_edge_t& destination ) const noexcept -> weak_edge_t;
+    //! Test if a directed restricted hyper edge exists between \c source node and \c destination edge, see find_edge(weak_node_t, weak_edge_t).
+    auto        has_edge( const weak_node_t& source, const weak_edge_t& destination ) const noexcept -> bool;
 
     //! Return the number of edges currently existing in graph.
     auto        get_edge_count() const noexcept -> unsigned int { return static_cast<int>( _edges.size() ); }
@@ -311,22 +557,117 @@ public:
      * parrallel edge support, otherwise, get_edge_count() will always return 1 or 0.
      *
      * This method only test a 1 degree relationship (ie a direct edge between \c source
-     * and \c destination). Worst case complexity is O(edge count).
+     * and \c destination). Complexity is O(1) when config_t::enable_adjacency_index is true,
+     * O(source out degree) otherwise.
      * \throw no GTpo exception (might throw a std::bad_weak_ptr).
      */
-    auto        get_edge_count( weak_node_t source, weak_node_t destination ) const noexcept( false ) -> unsigned int;
+    auto        get_edge_count( const weak_node_t& source, const weak_node_t& destination ) const noexcept( false ) -> unsigned int;
 
-    //! Use fast search container to find if a given \c edge is part of this graph.
-    auto        contains( weak_edge_t edge ) const noexcept -> bool;
+    /*! \brief Use fast search container to find if a given \c edge is part of this graph.
+     *
+     * Complexity is O(1) with hashed config_t::search_container_t (default to std::unordered_set).
+     */
+    auto        contains( const weak_edge_t& edge ) const noexcept -> bool;
 
     //! Graph main edges container.
     inline auto get_edges() const noexcept -> const shared_edges_t& { return _edges; }
+
+    using edge_allocator_t  = typename config_t::template edge_allocator_t< typename config_t::final_edge_t >;
+    //! Allocator used to allocate edges (and their control block) in create_edge().
+    inline auto get_edge_allocator() const noexcept -> const edge_allocator_t& { return _edge_allocator; }
 private:
+    edge_allocator_t      _edge_allocator;
     shared_edges_t        _edges;
     weak_edges_search_t   _edges_search;
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Restricted Hyper Edge Management *///---------------------------
+    //@{
+public:
+    /*! \brief Create a directed restricted hyper edge between \c source node and \c destination edge, then insert it into the graph.
+     *
+     * Hyper edges are indexed on their source node (node::get_out_hedges()) and on their destination edge
+     * (edge::get_in_hedges()), a hyper edge may target another hyper edge. Hyper edges are not part of
+     * get_edges(), node adjacency nor handles: graph behaviours are not notified and topology algorithms
+     * ignore them.
+     * \note Removing an edge (or a node) recursively remove the hyper edges depending on it.
+     * \throw a gtpo::bad_topology_error if \c source or \c destination are expired or not part of this graph.
+     */
+    auto        create_edge( const weak_node_t& source, const weak_edge_t& destination ) noexcept(false) -> weak_edge_t;
+
+    //! Graph restricted hyper edges container.
+    inline auto get_hyper_edges() const noexcept -> const shared_edges_t& { return _hyper_edges; }
+    //! Return the number of restricted hyper edges currently existing in graph.
+    inline auto get_hyper_edge_count() const noexcept -> std::size_t { return _hyper_edges.size(); }
+
+private:
+    //! Remove hyper edge \c hyper_edge and the hyper edges depending on it from graph and from its source and destination indexes.
+    auto        remove_hyper_edge_impl( const shared_edge_t& hyper_edge ) noexcept -> void;
+    //! Remove all hyper edges with \c edge as (direct or indirect) destination.
+    auto        remove_in_hedges( edge_t& edge ) noexcept -> void;
+
+    shared_edges_t        _hyper_edges;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Handles *///----------------------------------------------
+    //@{
+public:
+    /*! \brief Return node registered with handle \c id, or nullptr if \c id is stale or invalid.
+     *
+     * Complexity is O(1), no weak_ptr is locked: returned pointer is valid until node is removed from graph.
+     * \code
+     *   gtpo::graph<> g;
+     *   const gtpo::node_id n1 = g.create_node().lock()->get_id();
+     *   const gtpo::node_id n2 = g.create_node().lock()->get_id();
+     *   const gtpo::edge_id e = g.create_edge(n1, n2);
+     *   g.remove_node(n2);  // e and n2 are now stale: get_edge(e) == nullptr
+     * \endcode
+     */
+    inline auto get_node( node_id id ) const noexcept -> node_t* { return _node_slots.get( id ); }
+    //! Return edge registered with handle \c id, or nullptr if \c id is stale or invalid (complexity is O(1)).
+    inline auto get_edge( edge_id id ) const noexcept -> edge_t* { return _edge_slots.get( id ); }
+    //! Return a weak reference on node registered with handle \c id (expired if \c id is stale or invalid).
+    auto        find_node( node_id id ) const noexcept -> weak_node_t;
+    //! Return a weak reference on edge registered with handle \c id (expired if \c id is stale or invalid).
+    auto        find_edge( edge_id id ) const noexcept -> weak_edge_t;
+    //! Return true if \c id is a valid handle on a node registered in this graph (complexity is O(1)).
+    inline auto contains( node_id id ) const noexcept -> bool { return _node_slots.find( id ) != nullptr; }
+    //! Return true if \c id is a valid handle on an edge registered in this graph (complexity is O(1)).
+    inline auto contains( edge_id id ) const noexcept -> bool { return _edge_slots.find( id ) != nullptr; }
+
+    /*! \brief Create a directed edge between nodes with handles \c source and \c destination.
+     *
+     * Same as create_edge(weak_node_t, weak_node_t) but endpoints are resolved in O(1) without locking them.
+     * \throw a gtpo::bad_topology_error if \c source or \c destination is stale or creation fails.
+     */
+    auto        create_edge( node_id source, node_id destination ) noexcept( false ) -> edge_id;
+
+    /*! \brief Return handle of the first directed edge between \c source and \c destination (or an invalid handle).
+     *
+     * Complexity is O(1) when config_t::enable_adjacency_index is true, O(source out degree) otherwise.
+     */
+    auto        find_edge( node_id source, node_id destination ) const noexcept -> edge_id;
+
+    /*! \brief Remove node with handle \c id (and all its adjacent edges) from graph.
+     *
+     * \throw a gtpo::bad_topology_error if \c id is stale or invalid.
+     */
+    auto        remove_node( node_id id ) noexcept( false ) -> void;
+
+    /*! \brief Remove edge with handle \c id from graph.
+     *
+     * \throw a gtpo::bad_topology_error if \c id is stale or invalid.
+     */
+    auto        remove_edge( edge_id id ) noexcept( false ) -> void;
+
+private:
+    impl::slot_map<node_t, weak_node_t, node_id>    _node_slots;
+    impl::slot_map<edge_t, weak_edge_t, edge_id>    _edge_slots;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Group Management *///--------------------------------------
     //@{
 public:
@@ -344,7 +685,7 @@ public:
      * Worst case complexity is O(group count).
      * \throw a gtpo::bad_topology_error if suppression fails (\c group does not exists).
      */
-    auto            remove_group( weak_group_t group ) noexcept( false ) -> void;
+    auto            remove_group( const weak_group_t& group ) noexcept( false ) -> void;
 
     //! Return true if a given group \c group is registered in the graph.
     auto            has_group( const weak_group_t& group ) const -> bool;
@@ -362,7 +703,7 @@ public:
      *
      * \note \c node get_group() will return \c group if grouping succeed.
      */
-    auto            group_node( weak_node_t node, weak_group_t group) noexcept(false) -> void;
+    auto            group_node( const weak_node_t& node, const weak_group_t& group) noexcept(false) -> void;
 
     /*! \brief Insert an existing node \c weakNode in group \c weakGroup group.
      *
@@ -371,7 +712,31 @@ public:
      *
      * \note \c node getGroup() will return an expired weak pointer if ungroup succeed.
      */
-    auto            ungroup_node( weak_node_t weakNode, weak_node_t weakGroup ) noexcept(false) -> void;
+    auto            ungroup_node( const weak_node_t& weakNode, const weak_node_t& weakGroup ) noexcept(false) -> void;
+
+    /*! \brief Insert nodes in range [\c first, \c last) in group \c group.
+     *
+     * Nodes already registered in \c group are ignored, complexity is O(range size) (group membership
+     * is hashed, group containers are reserved once).
+     *
+     * \code
+     *   std::vector<gtpo::graph<>::weak_node_t> nodes{n1, n2, n3};
+     *   g.group_nodes( group, nodes.cbegin(), nodes.cend() );
+     * \endcode
+     * \throw gtpo::bad_topology_error if \c group or a node in range is expired.
+     */
+    template < class forward_it >
+    auto            group_nodes( const weak_group_t& group, forward_it first, forward_it last ) noexcept(false) -> void;
+
+    /*! \brief Ungroup nodes in range [\c first, \c last) from group \c group.
+     *
+     * Group nodes container is swept once, complexity is O(group node count + range size) instead
+     * of O(group node count x range size) with successive ungroup_node() calls.
+     *
+     * \throw gtpo::bad_topology_error if \c group or a node in range is expired, or if a node is not part of \c group.
+     */
+    template < class forward_it >
+    auto            ungroup_nodes( const weak_group_t& group, forward_it first, forward_it last ) noexcept(false) -> void;
 
 private:
     weak_groups_t   _groups;
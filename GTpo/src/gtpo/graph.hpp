@@ -44,22 +44,156 @@ graph<config_t>::~graph()
 template <class config_t>
 void    graph<config_t>::clear() noexcept
 {
+    const auto lock = write_lock();
     // Note 20160104: First edges, then nodes (it helps maintaining topology if
     // womething went wrong during destruction
-    for ( auto& node: _nodes )   // Do not maintain topology during node deletion
+    for ( auto& hyper_edge: _hyper_edges )  // Hyper edges first, they reference edges
+        hyper_edge->_graph = nullptr;
+    _hyper_edges.clear();
+    for ( auto& node: _nodes ) { // Do not maintain topology during node deletion
         node->_graph = nullptr;
+        node->_id = node_id{};
+        node->_root_index = static_cast<std::size_t>(-1);
+        node->_out_hedges.clear();
+    }
     _root_nodes.clear();         // Remove weak_ptr containers first
     _nodes_search.clear();
     _nodes.clear();
 
-    for ( auto& edge: _edges )   // Do not maintain topology during edge deletion
+    for ( auto& edge: _edges ) { // Do not maintain topology during edge deletion
         edge->_graph = nullptr;
+        edge->_id = edge_id{};
+        edge->_in_hedges.clear();
+    }
     _edges_search.clear();
     _edges.clear();
+    _node_slots.clear();
+    _edge_slots.clear();
 
     // Clearing groups and behaviours (Not: group->_graph is resetted with nodes)
     _groups.clear();
+    _deferred_nodes.clear();     // Pending notifications reference destroyed primitives
+    _deferred_edges.clear();
     behaviourable_base::clear();
+    _snapshot.reset();
+    ++_topology_revision;
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Notification Scope *///-----------------------------------------------
+template <class config_t>
+auto    graph<config_t>::end_deferred_notifications() noexcept -> void
+{
+    const auto lock = write_lock();
+    if ( _notification_depth == 0 )
+        return;
+    if ( --_notification_depth == 0 )
+        flush_notifications();
+}
+
+template <class config_t>
+auto    graph<config_t>::flush_notifications() noexcept -> void
+{
+    const auto lock = write_lock();
+    // ALGORITHM:
+        // 1. Swap pending queues out (a behaviour might insert primitives while being notified).
+        // 2. Notify graph behaviours with one batch for nodes, then one batch for edges.
+        // 3. Replay node level in/out node inserted notifications in edge insertion order.
+    if ( _deferred_nodes.empty() &&
+         _deferred_edges.empty() )
+        return;
+    deferred_nodes_t nodes;
+    deferred_edges_t edges;
+    nodes.swap( _deferred_nodes );
+    edges.swap( _deferred_edges );
+    if ( !nodes.empty() )
+        behaviourable_base::notify_nodes_inserted( nodes );
+    if ( !edges.empty() ) {
+        behaviourable_base::notify_edges_inserted( edges );
+        for ( const auto& weak_edge : edges ) {
+            auto edge = weak_edge.lock();
+            if ( !edge )
+                continue;
+            const auto source_ptr = edge->get_src().lock();
+            const auto destination_ptr = edge->get_dst().lock();
+            if ( source_ptr && destination_ptr ) {
+                const auto& source = edge->get_src();
+                const auto& destination = edge->get_dst();
+                source_ptr->notify_out_node_inserted( source, destination, weak_edge );
+                destination_ptr->notify_in_node_inserted( destination, source, weak_edge );
+            }
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Topology Snapshot *///------------------------------------------------
+template <class config_t>
+auto    graph<config_t>::snapshot() const -> shared_snapshot_t
+{
+    // Cached snapshot is reused until topology is modified, a detached snapshot is
+    // never modified since it might be shared with other threads.
+    if ( !_snapshot ||
+         _snapshot->get_revision() != _topology_revision )
+        _snapshot = std::make_shared<const snapshot_t>( *this );
+    return _snapshot;
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Node Ordering *///----------------------------------------------------
+template <class config_t>
+auto    graph<config_t>::reorder(reorder_policy policy) -> void
+{
+    const auto lock = write_lock();
+    // ALGORITHM:
+        // 1. Compute permutation on a csr_view of actual topology (dense indexes follow _nodes order).
+        // 2. Build reordered nodes and root nodes containers.
+        // 3. Regroup edges by source node in new order.
+        // 4. Commit new containers (no allocation past this point).
+    if ( get_node_count() == 0 )
+        return;
+    // 1.
+    const csr_view<graph_t> csr{*this};
+    const auto order = reorder_permutation(csr, policy);
+    std::vector<shared_node_t> dense;
+    dense.reserve(csr.get_node_count());
+    for ( const auto& node : _nodes )
+        if ( node )
+            dense.push_back(node);
+
+    // 2.
+    shared_nodes_t nodes;
+    root_nodes_t root_nodes;
+    std::vector<bool> is_root(dense.size(), false);
+    for ( const auto root : csr.get_root_nodes() )
+        is_root[root] = true;
+    config_t::template container_adapter<shared_nodes_t>::reserve( nodes, dense.size() );
+    root_nodes.reserve( get_root_node_count() );
+    for ( const auto n : order ) {
+        config_t::template container_adapter<shared_nodes_t>::insert( dense[n], nodes );
+        if ( is_root[n] )
+            root_nodes.push_back( dense[n] );
+    }
+
+    // 3.
+    shared_edges_t edges;
+    config_t::template container_adapter<shared_edges_t>::reserve( edges, _edges.size() );
+    for ( const auto& node : nodes )
+        for ( const auto& out_edge : node->get_out_edges() ) {
+            auto edge = out_edge.lock();
+            if ( edge )
+                config_t::template container_adapter<shared_edges_t>::insert( edge, edges );
+        }
+
+    // 4.
+    ++_topology_revision;
+    using std::swap;
+    swap( _nodes, nodes );
+    swap( _root_nodes, root_nodes );
+    for ( std::size_t r = 0; r < _root_nodes.size(); ++r )
+        _root_nodes[r].lock()->_root_index = r;
+    if ( edges.size() == _edges.size() )    // Do not loose an edge with an expired source
+        swap( _edges, edges );
 }
 //-----------------------------------------------------------------------------
 
@@ -67,9 +201,10 @@ void    graph<config_t>::clear() noexcept
 template < class config_t >
 auto graph<config_t>::create_node( ) -> weak_node_t
 {
+    const auto lock = write_lock();
     weak_node_t node;
     try {
-        node = insert_node( std::make_shared< typename config_t::final_node_t >() );
+        node = insert_node( std::allocate_shared< typename config_t::final_node_t >( _node_allocator ) );
     } catch (...) { gtpo::assert_throw( false, "graph<>::create_node(): Error: can't insert node in graph." ); }
     return node;
 }
@@ -77,112 +212,300 @@ auto graph<config_t>::create_node( ) -> weak_node_t
 template < class config_t >
 auto    graph<config_t>::insert_node( shared_node_t node ) -> weak_node_t
 {
+    const auto lock = write_lock();
     assert_throw(node != nullptr, "gtpo::graph<>::insert_node(): Error: Trying to insert a nullptr node in graph.");
-    weak_node_t weak_node;
     try {
-        weak_node = node;
+        return insert_node_unchecked( std::move(node) );
+    } catch (...) { throw gtpo::bad_topology_error{ "gtpo::graph<>::insert_node(): Error: can't insert node in graph." }; }
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::insert_nodes( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    for ( auto node = first; node != last; ++node )    // Check whole range before modifying graph
+        assert_throw(*node != nullptr, "gtpo::graph<>::insert_nodes(): Error: Trying to insert a nullptr node in graph.");
+    try {
+        insert_nodes_unchecked( first, last );
+    } catch (...) { throw gtpo::bad_topology_error{ "gtpo::graph<>::insert_nodes(): Error: can't insert node in graph." }; }
+}
+
+template < class config_t >
+auto    graph<config_t>::insert_node_unchecked( shared_node_t node ) -> weak_node_t
+{
+    const auto lock = write_lock();
+    ++_topology_revision;
+    weak_node_t weak_node = node;
+    node->set_graph(this);
+    node->_id = _node_slots.insert( node.get(), weak_node );
+    config_t::template container_adapter< weak_nodes_t_search >::insert( weak_node, _nodes_search );
+    root_insert( *node, weak_node );
+    config_t::template container_adapter< shared_nodes_t >::insert( std::move(node), _nodes );  // Graph take ownership, node is no longer used
+    if ( is_notification_deferred() )
+        _deferred_nodes.push_back( weak_node );
+    else
+        behaviourable_base::notify_node_inserted( weak_node );
+    return weak_node;
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::insert_nodes_unchecked( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    const auto count = static_cast<std::size_t>( std::distance( first, last ) );
+    if ( count == 0 )
+        return;
+    typename behaviourable_base::dynamic_graph_behaviour_t::weak_nodes_t weak_nodes;
+    weak_nodes.reserve( count );
+    config_t::template container_adapter< shared_nodes_t >::reserve( _nodes, get_node_count() + count );
+    config_t::template container_adapter< weak_nodes_t_search >::reserve( _nodes_search, get_node_count() + count );
+    _root_nodes.reserve( get_root_node_count() + count );
+    _node_slots.reserve( get_node_count() + count );
+
+    ++_topology_revision;
+    for ( ; first != last; ++first ) {
+        const shared_node_t& node = *first;
+        weak_node_t weak_node = node;
         node->set_graph(this);
+        node->_id = _node_slots.insert( node.get(), weak_node );
         config_t::template container_adapter< shared_nodes_t >::insert( node, _nodes );
         config_t::template container_adapter< weak_nodes_t_search >::insert( weak_node, _nodes_search );
-        config_t::template container_adapter< weak_nodes_t >::insert( weak_node, _root_nodes );
-        behaviourable_base::notify_node_inserted( weak_node );
-    } catch (...) { gtpo::assert_throw( false, "gtpo::graph<>::insert_node(): Error: can't insert node in graph." ); }
-    return weak_node;
+        root_insert( *node, weak_node );
+        weak_nodes.push_back( weak_node );
+    }
+    if ( is_notification_deferred() )
+        _deferred_nodes.insert( _deferred_nodes.end(), weak_nodes.cbegin(), weak_nodes.cend() );
+    else
+        behaviourable_base::notify_nodes_inserted( weak_nodes );
 }
 
 template < class config_t >
-auto    graph<config_t>::remove_node( weak_node_t weak_node ) -> void
+auto    graph<config_t>::remove_node( const weak_node_t& weak_node ) -> void
 {
-    auto node = weak_node.lock();
-    if ( !node )
+    const auto lock = write_lock();
+    if ( weak_node.expired() )
         gtpo::assert_throw( false, "gtpo::graph<>::remove_node(): Error: node is expired." );
+    remove_nodes( &weak_node, &weak_node + 1 );
+}
 
-    // Eventually, ungroup node
-    auto group = node->get_group().lock();
-    if ( group )
-        ungroup_node(weak_node, group);
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::remove_nodes( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    // ALGORITHM:
+        // 1. Collect (unique) victim nodes, ungroup them and notify behaviours.
+        // 2. Collect victims in and out edges, detach them from surviving nodes only.
+        // 3. Sweep graph edges, nodes and root nodes containers once.
+    using edge_t = typename config_t::final_edge_t;
+    std::vector<shared_node_t>          nodes;
+    std::unordered_set<const node_t*>   victims;
+    for ( ; first != last; ++first ) {
+        const weak_node_t& weak_node = *first;  // No copy for weak_node_t ranges (a temporary is bound for shared_node_t ranges)
+        auto node = weak_node.lock();
+        if ( !node )
+            gtpo::assert_throw( false, "gtpo::graph<>::remove_nodes(): Error: node is expired." );
+        if ( victims.insert( node.get() ).second )
+            nodes.push_back( node );
+    }
+    if ( nodes.empty() )
+        return;
+    flush_notifications();  // Behaviours must be aware of victims insertion before their removal
+    ++_topology_revision;
+
+    ungroup_removed_nodes( nodes, impl::group_is_node<config_t>{} );
+    typename behaviourable_base::dynamic_graph_behaviour_t::weak_nodes_t weak_nodes( nodes.cbegin(), nodes.cend() );
+    behaviourable_base::notify_nodes_removed( weak_nodes );
+
+    // Collect all edges adjacent to victims (an edge between two victims is collected once).
+    std::vector<shared_edge_t>          edges;
+    std::unordered_set<const edge_t*>   victim_edges;
+    const auto collect_edge = [&edges, &victim_edges](const weak_edge_t& weak_edge) {
+        auto edge = weak_edge.lock();
+        if ( edge &&
+             victim_edges.insert( edge.get() ).second )
+            edges.push_back( edge );
+    };
+    for ( const auto& node : nodes ) {
+        for ( const auto& in_edge : node->get_in_edges() )
+            collect_edge( in_edge );
+        for ( const auto& out_edge : node->get_out_edges() )
+            collect_edge( out_edge );
+    }
+    if ( !edges.empty() ) {
+        typename behaviourable_base::dynamic_graph_behaviour_t::weak_edges_t weak_edges( edges.cbegin(), edges.cend() );
+        behaviourable_base::notify_edges_removed( weak_edges );
+    }
+
+    // Hyper edges from victims or to removed edges are removed first (they are not reported to behaviours).
+    for ( const auto& node : nodes )
+        while ( !node->_out_hedges.empty() ) {
+            const auto hyper_edge = node->_out_hedges.back().lock();
+            if ( hyper_edge )
+                remove_hyper_edge_impl( hyper_edge );
+            else
+                node->_out_hedges.pop_back();
+        }
+    for ( const auto& edge : edges )
+        remove_in_hedges( *edge );
 
-    behaviourable_base::notify_node_removed( weak_node );
+    // Removed edges are detached from surviving nodes, victims adjacency is cleared at once.
+    for ( const auto& edge : edges ) {
+        const weak_edge_t weak_edge{ edge };
+        auto source = edge->get_src().lock();
+        if ( source &&
+             victims.find( source.get() ) == victims.end() )
+            source->remove_out_edge( weak_edge );
+        auto destination = edge->get_dst().lock();
+        if ( destination &&
+             victims.find( destination.get() ) == victims.end() )
+            destination->remove_in_edge( weak_edge );
+        edge->set_graph( nullptr );
+        _edge_slots.erase( edge->_id );
+        edge->_id = edge_id{};
+        config_t::template container_adapter<weak_edges_search_t>::remove( weak_edge, _edges_search );
+    }
+    for ( const auto& node : nodes ) {
+        node->_in_edges.clear(); node->_out_edges.clear();
+        node->_in_nodes.clear(); node->_out_nodes.clear();
+        node->_out_edges_index.clear();
+        config_t::template container_adapter<weak_nodes_t_search>::remove( node, _nodes_search );
+        root_erase( *node );
+        if ( node->is_group() )
+            remove_removed_group( node, impl::group_is_node<config_t>{} );
+        node->set_graph( nullptr );
+        _node_slots.erase( node->_id );
+        node->_id = node_id{};
+    }
 
-    // Removing all orphant edges pointing to node.
-    weak_edges_t nodeInEdges; std::copy( node->get_in_edges().cbegin(),
-                                      node->get_in_edges().cend(),
-                                      std::back_inserter( nodeInEdges ) );
-    for ( auto inEdge: nodeInEdges )
-        node->remove_in_edge( inEdge );
-    for ( auto inEdge: nodeInEdges )
-        remove_edge( inEdge );
+    // Sweep main graph containers once (it will generate edges and nodes destruction)
+    if ( !edges.empty() )
+        config_t::template container_adapter<shared_edges_t>::remove_if( _edges, [&victim_edges](const shared_edge_t& edge) {
+            return victim_edges.find( edge.get() ) != victim_edges.end();
+        } );
+    config_t::template container_adapter<shared_nodes_t>::remove_if( _nodes, [&victims](const shared_node_t& node) {
+        return victims.find( node.get() ) != victims.end();
+    } );
+}
 
-    weak_edges_t nodeOutEdges; std::copy( node->get_out_edges().cbegin(),
-                                      node->get_out_edges().cend(),
-                                      std::back_inserter( nodeOutEdges ) );
-    for ( auto outEdge: nodeOutEdges )
-        node->remove_out_edge( outEdge );
-    for ( auto outEdge: nodeOutEdges )
-        remove_edge( outEdge );
+template < class config_t >
+auto    graph<config_t>::ungroup_removed_nodes( const std::vector<shared_node_t>& nodes, std::true_type ) noexcept( false ) -> void
+{
+    std::unordered_map<const group_t*, std::vector<weak_node_t>> grouped;  // Victims are ungrouped with one sweep per group
+    for ( const auto& node : nodes ) {
+        auto group = node->get_group().lock();
+        if ( group )
+            grouped[group.get()].push_back( node );
+    }
+    for ( const auto& group_nodes : grouped ) {
+        const auto& group_victims = group_nodes.second;
+        ungroup_nodes( group_victims.front().lock()->get_group(), group_victims.cbegin(), group_victims.cend() );
+    }
+}
 
-    // Remove node from main graph containers (it will generate node destruction)
-    config_t::template container_adapter<weak_nodes_t_search>::remove( weak_node, _nodes_search );
-    config_t::template container_adapter<weak_nodes_t>::remove( weak_node, _root_nodes );
-    node->set_graph( nullptr );
-    config_t::template container_adapter<shared_nodes_t>::remove( node, _nodes );
+template < class config_t >
+auto    graph<config_t>::remove_removed_group( const shared_node_t& node, std::true_type ) noexcept( false ) -> void
+{
+    config_t::template container_adapter<weak_groups_t>::remove( std::static_pointer_cast<group_t>( node ), _groups );
 }
 
 template < class config_t >
-auto    graph<config_t>::install_root_node( weak_node_t node ) -> void
+auto    graph<config_t>::install_root_node( const weak_node_t& node ) -> void
 {
+    const auto lock = write_lock();
     assert_throw( !node.expired(), "gtpo::graph<>::setRootNode(): Error: node is expired." );
     shared_node_t sharedNode = node.lock();
     assert_throw( sharedNode->get_in_degree() == 0, "gtpo::graph<>::setRootNode(): Error: trying to set a node with non 0 in degree as a root node." );
-
-    config_t::template container_adapter<weak_nodes_t>::insert( node, _root_nodes );
+    root_insert( *sharedNode, node );
 }
 
 template < class config_t >
-auto    graph<config_t>::is_root_node( weak_node_t node ) const -> bool
+auto    graph<config_t>::is_root_node( const weak_node_t& node ) const -> bool
 {
     assert_throw( !node.expired(), "gtpo::graph<>::is_root_node(): Error: node is expired." );
     shared_node_t sharedNode = node.lock();
     if ( sharedNode->get_in_degree() != 0 )   // Fast exit when node in degree != 0, it can't be a root node
         return false;
-    return gtpo::find_weak_ptr( _root_nodes, node );
+    const auto index = sharedNode->_root_index;
+    return index < _root_nodes.size() &&
+           _root_nodes[index].lock() == sharedNode;    // Node root index could come from another graph
 }
 
 template < class config_t >
-auto    graph<config_t>::contains( weak_node_t node ) const noexcept -> bool
+auto    graph<config_t>::root_insert( node_t& node, const weak_node_t& weak_node ) -> void
+{
+    const auto index = node._root_index;
+    if ( index < _root_nodes.size() &&
+         _root_nodes[index].lock().get() == &node )
+        return;     // Already a root node
+    _root_nodes.push_back( weak_node );
+    node._root_index = _root_nodes.size() - 1;
+}
+
+template < class config_t >
+auto    graph<config_t>::root_erase( node_t& node ) noexcept -> void
+{
+    const auto index = node._root_index;
+    node._root_index = static_cast<std::size_t>(-1);
+    if ( index >= _root_nodes.size() ||
+         _root_nodes[index].lock().get() != &node )
+        return;     // Not a root node
+    if ( index != _root_nodes.size() - 1 ) {
+        _root_nodes[index] = std::move( _root_nodes.back() );
+        auto moved = _root_nodes[index].lock();
+        if ( moved )
+            moved->_root_index = index;
+    }
+    _root_nodes.pop_back();
+}
+
+template < class config_t >
+auto    graph<config_t>::contains( const weak_node_t& node ) const noexcept -> bool
 {
     if ( node.expired() )   // Fast exit.
         return false;
-    auto nodeIter = std::find_if( _nodes_search.cbegin(), _nodes_search.cend(),
-                                            [=](const weak_node_t& n ) { return ( compare_weak_ptr<>( node, n ) ); } );
-    return nodeIter != _nodes_search.cend();
+    return config_t::template container_adapter<weak_nodes_t_search>::contains( _nodes_search, node );
 }
 //-----------------------------------------------------------------------------
 
 /* Graph Edge Management *///--------------------------------------------------
 template < class config_t >
 //template < class Edge_t >
-auto    graph< config_t >::create_edge( weak_node_t source, weak_node_t destination ) -> weak_edge_t
+auto    graph< config_t >::create_edge( const weak_node_t& source, const weak_node_t& destination ) -> weak_edge_t
 {
+    const auto lock = write_lock();
     auto source_ptr = source.lock();
     auto destination_ptr = destination.lock();
     if ( !source_ptr ||
          !destination_ptr )
         throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(Node,Node): Insertion of edge failed, either source or destination nodes are expired." );
+    return create_edge_impl( *source_ptr, source, *destination_ptr, destination );
+}
 
-    auto edge = std::make_shared<typename config_t::final_edge_t>();
+template < class config_t >
+auto    graph< config_t >::create_edge_impl( node_t& source, const weak_node_t& source_weak,
+                                             node_t& destination, const weak_node_t& destination_weak ) -> weak_edge_t
+{
+    ++_topology_revision;
+    auto edge = std::allocate_shared<typename config_t::final_edge_t>( _edge_allocator );
+    weak_edge_t weak_edge{ edge };
     edge->set_graph( this );
     config_t::template container_adapter< shared_edges_t >::insert( edge, _edges );
-    config_t::template container_adapter< weak_edges_search_t >::insert( edge, _edges_search );
-    edge->set_src( source );
-    edge->set_dst( destination );
+    config_t::template container_adapter< weak_edges_search_t >::insert( weak_edge, _edges_search );
+    edge->_id = _edge_slots.insert( edge.get(), weak_edge );
+    edge->set_src( source_weak );
+    edge->set_dst( destination_weak );
     try {
-        source_ptr->add_out_edge( edge );
-        destination_ptr->add_in_edge( edge );
-        if ( source_ptr.get() != destination_ptr.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
-            config_t::template container_adapter<weak_nodes_t>::remove( destination, _root_nodes );    // Otherwise destination is no longer a root node
-        auto weak_edge = weak_edge_t{edge};
-        behaviourable_base::notify_edge_inserted( weak_edge );
+        source.add_out_edge( weak_edge );
+        destination.add_in_edge( weak_edge );
+        if ( &source != &destination ) // If edge define is a trivial circuit, do not remove destination from root nodes
+            root_erase( destination );  // Otherwise destination is no longer a root node
+        if ( is_notification_deferred() )
+            _deferred_edges.push_back( weak_edge );
+        else
+            behaviourable_base::notify_edge_inserted( weak_edge );
     } catch ( ... ) {
         throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(Node,Node): Insertion of edge failed, source or destination nodes topology can't be modified." );
     }
@@ -192,54 +515,148 @@ auto    graph< config_t >::create_edge( weak_node_t source, weak_node_t destinat
 template < class config_t >
 auto    graph<config_t>::insert_edge( shared_edge_t edge ) -> weak_edge_t
 {
-    assert_throw( edge != nullptr );
-    auto source = edge->get_src().lock();
-    if ( source == nullptr ||
+    const auto lock = write_lock();
+    assert_throw( edge != nullptr, "gtpo::graph<>::insert_edge(): Error: Trying to insert a nullptr edge in graph." );
+    if ( edge->get_src().expired() ||
          edge->get_dst().expired() )
         throw gtpo::bad_topology_error( "gtpo::graph<>::insert_edge(): Error: Either source and/or destination nodes are expired." );
+    try {
+        return insert_edge_unchecked( std::move(edge) );
+    } catch ( ... ) {
+        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(): Insertion of edge failed, source or destination nodes topology can't be modified." );
+    }
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::insert_edges( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    for ( auto edge = first; edge != last; ++edge ) {   // Check whole range before modifying graph
+        assert_throw( *edge != nullptr, "gtpo::graph<>::insert_edges(): Error: Trying to insert a nullptr edge in graph." );
+        if ( (*edge)->get_src().expired() ||
+             (*edge)->get_dst().expired() )
+            throw gtpo::bad_topology_error( "gtpo::graph<>::insert_edges(): Error: Either source and/or destination nodes are expired." );
+    }
+    try {
+        insert_edges_unchecked( first, last );
+    } catch ( ... ) {
+        throw gtpo::bad_topology_error( "gtpo::graph<>::insert_edges(): Insertion of edge failed, source or destination nodes topology can't be modified." );
+    }
+}
+
+template < class config_t >
+auto    graph<config_t>::insert_edge_unchecked( shared_edge_t edge ) -> weak_edge_t
+{
+    const auto lock = write_lock();
+    auto source = edge->get_src().lock();
+    auto destination = edge->get_dst().lock();
+    ++_topology_revision;
     edge->set_graph( this );
     weak_edge_t weak_edge = edge;
-    config_t::template container_adapter<shared_edges_t>::insert( edge, _edges );
+    edge->_id = _edge_slots.insert( edge.get(), weak_edge );
+    config_t::template container_adapter<shared_edges_t>::insert( std::move(edge), _edges );    // Graph take ownership, edge is no longer used
     config_t::template container_adapter<weak_edges_search_t>::insert( weak_edge, _edges_search );
-    try {
-        source->add_out_edge( edge );
-        auto destination = edge->get_dst().lock();
-        if ( destination != nullptr ) {
-            destination->add_in_edge( edge );
-            if ( source.get() != destination.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
-                config_t::template container_adapter<weak_nodes_t>::remove( destination, _root_nodes );    // Otherwise destination is no longer a root node
-        }
-        auto weak_edge = weak_edge_t(edge);
+    source->add_out_edge( weak_edge );
+    destination->add_in_edge( weak_edge );
+    if ( source.get() != destination.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
+        root_erase( *destination );     // Otherwise destination is no longer a root node
+    if ( is_notification_deferred() )
+        _deferred_edges.push_back( weak_edge );
+    else
         behaviourable_base::notify_edge_inserted( weak_edge );
-    } catch ( ... ) {
-        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(): Insertion of edge failed, source or destination nodes topology can't be modified." );
+    return weak_edge;
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::insert_edges_unchecked( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    const auto count = static_cast<std::size_t>( std::distance( first, last ) );
+    if ( count == 0 )
+        return;
+    typename behaviourable_base::dynamic_graph_behaviour_t::weak_edges_t weak_edges;
+    weak_edges.reserve( count );
+    config_t::template container_adapter< shared_edges_t >::reserve( _edges, get_edge_count() + count );
+    config_t::template container_adapter< weak_edges_search_t >::reserve( _edges_search, get_edge_count() + count );
+    _edge_slots.reserve( get_edge_count() + count );
+
+    ++_topology_revision;
+    for ( ; first != last; ++first ) {
+        const shared_edge_t& edge = *first;
+        auto source = edge->get_src().lock();
+        auto destination = edge->get_dst().lock();
+        edge->set_graph( this );
+        weak_edge_t weak_edge = edge;
+        edge->_id = _edge_slots.insert( edge.get(), weak_edge );
+        config_t::template container_adapter<shared_edges_t>::insert( edge, _edges );
+        config_t::template container_adapter<weak_edges_search_t>::insert( weak_edge, _edges_search );
+        source->add_out_edge( weak_edge );
+        destination->add_in_edge( weak_edge );
+        if ( source.get() != destination.get() ) // If edge define is a trivial circuit, do not remove destination from root nodes
+            root_erase( *destination );
+        weak_edges.push_back( weak_edge );
     }
-    return edge;
+    if ( is_notification_deferred() )
+        _deferred_edges.insert( _deferred_edges.end(), weak_edges.cbegin(), weak_edges.cend() );
+    else
+        behaviourable_base::notify_edges_inserted( weak_edges );
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::adopt_edges_unchecked( forward_it first, forward_it last ) -> void
+{
+    const auto lock = write_lock();
+    const auto count = static_cast<std::size_t>( std::distance( first, last ) );
+    if ( count == 0 )
+        return;
+    typename behaviourable_base::dynamic_graph_behaviour_t::weak_edges_t weak_edges;
+    weak_edges.reserve( count );
+    config_t::template container_adapter< shared_edges_t >::reserve( _edges, get_edge_count() + count );
+    config_t::template container_adapter< weak_edges_search_t >::reserve( _edges_search, get_edge_count() + count );
+    _edge_slots.reserve( get_edge_count() + count );
+
+    ++_topology_revision;
+    for ( ; first != last; ++first ) {
+        const shared_edge_t& edge = *first;
+        edge->set_graph( this );
+        weak_edge_t weak_edge = edge;
+        edge->_id = _edge_slots.insert( edge.get(), weak_edge );
+        config_t::template container_adapter<shared_edges_t>::insert( edge, _edges );
+        config_t::template container_adapter<weak_edges_search_t>::insert( weak_edge, _edges_search );
+        const auto source = edge->get_src().lock();
+        const auto destination = edge->get_dst().lock();
+        if ( destination &&
+             source.get() != destination.get() )   // Note: adjacency is already linked, only root node cache is updated
+            root_erase( *destination );
+        weak_edges.push_back( weak_edge );
+    }
+    if ( is_notification_deferred() )
+        _deferred_edges.insert( _deferred_edges.end(), weak_edges.cbegin(), weak_edges.cend() );
+    else
+        behaviourable_base::notify_edges_inserted( weak_edges );
 }
 
 template < class config_t >
-void    graph<config_t>::remove_edge( weak_node_t source, weak_node_t destination )
+void    graph<config_t>::remove_edge( const weak_node_t& source, const weak_node_t& destination )
 {
+    const auto lock = write_lock();
     if ( source.expired() ||
          destination.expired() )
         throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(): Topology error." );
 
     // Find the edge associed with source / destination
-    if ( _edges.size() == 0 )
-        return; // Fast exit
-    auto edgeIter = std::find_if( _edges.begin(), _edges.end(),
-                                 [=](const shared_edge_t& e ){
-                                    return ( compare_weak_ptr<>( e->get_src(), source ) &&
-                                             compare_weak_ptr<>( e->get_dst(), destination ) );
-                                    }
-                                 ); // std::find_if
-    if ( edgeIter != _edges.end() )
-        remove_edge( *edgeIter );
+    auto edge = find_edge( source, destination );
+    if ( !edge.expired() )
+        remove_edge( edge );
 }
 
 template < class config_t >
-void    graph<config_t>::remove_all_edges( weak_node_t source, weak_node_t destination )
+void    graph<config_t>::remove_all_edges( const weak_node_t& source, const weak_node_t& destination )
 {
+    const auto lock = write_lock();
     if ( source.expired() ||
          destination.expired() )
         throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(): Topology error." );
@@ -249,64 +666,229 @@ void    graph<config_t>::remove_all_edges( weak_node_t source, weak_node_t desti
 }
 
 template < class config_t >
-void    graph<config_t>::remove_edge( weak_edge_t weak_edge )
+void    graph<config_t>::remove_edge( const weak_edge_t& weak_edge )
 {
+    const auto lock = write_lock();
     shared_edge_t edge = weak_edge.lock();
     if ( !edge )
         throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(): Error: Edge to be removed is already expired." );
+    if ( edge->is_hyper() ) {
+        if ( edge->get_graph() != this )
+            throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(): Error: Hyper edge to be removed is not part of this graph." );
+        ++_topology_revision;
+        remove_hyper_edge_impl( edge );
+        return;
+    }
     auto source = edge->get_src().lock();
     auto destination = edge->get_dst().lock();
     if ( source == nullptr      ||           // Expecting a non null source and either a destination or an hyper destination
          destination == nullptr )
         throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(): Error: Edge source or destination are expired." );
-    behaviourable_base::notify_edge_removed( weak_edge );
-    source->remove_out_edge( weak_edge );
+    ++_topology_revision;
+    flush_notifications();  // Behaviours must be aware of edge insertion before its removal
+    weak_edge_t victim{ weak_edge };  // weak_edge might alias an item of source or destination adjacency containers
+    behaviourable_base::notify_edge_removed( victim );
+    remove_in_hedges( *edge );
+    source->remove_out_edge( victim );
     if ( destination )      // Remove edge from destination in edges
-        destination->remove_in_edge( weak_edge );
+        destination->remove_in_edge( victim );
 
     edge->set_graph( nullptr );
+    _edge_slots.erase( edge->_id );
+    edge->_id = edge_id{};
     config_t::template container_adapter<shared_edges_t>::remove( edge, _edges );
-    config_t::template container_adapter<weak_edges_search_t>::remove( weak_edge, _edges_search );
+    config_t::template container_adapter<weak_edges_search_t>::remove( victim, _edges_search );
 }
 
 template < class config_t >
-auto    graph<config_t>::find_edge( weak_node_t source, weak_node_t destination ) const noexcept -> weak_edge_t
+auto    graph<config_t>::find_edge( const weak_node_t& source, const weak_node_t& destination ) const noexcept -> weak_edge_t
 {
-    // Find the edge associed with source / destination
-    auto edgeIter = std::find_if( _edges.begin(), _edges.end(),
-                                    [=](const shared_edge_t& e ) noexcept {
-                                        return ( compare_weak_ptr<>( e->get_src(), source ) &&
-                                                 compare_weak_ptr<>( e->get_dst(), destination ) );
-                                    } );
-    return ( edgeIter != _edges.end() ? *edgeIter : weak_edge_t{} );   // std::shared_ptr::operator* is noexcept
+    // Find the edge associed with source / destination in source out edges (or source adjacency index)
+    const auto sourcePtr = source.lock();
+    if ( !sourcePtr )
+        return weak_edge_t{};
+    return sourcePtr->find_out_edge( destination );
 }
 
 template < class config_t >
-auto    graph<config_t>::has_edge( weak_node_t source, weak_node_t destination ) const noexcept -> bool
+auto    graph<config_t>::has_edge( const weak_node_t& source, const weak_node_t& destination ) const noexcept -> bool
 {
     return ( find_edge( source, destination).use_count() != 0 );
 }
 
 template < class config_t >
-auto    graph<config_t>::get_edge_count( weak_node_t source, weak_node_t destination ) const -> unsigned int
+auto    graph<config_t>::find_edge( const weak_node_t& source, const weak_edge_t& destination ) const noexcept -> weak_edge_t
+{
+    // Look in destination per target hyper edge index, not in graph edges
+    const auto source_ptr = source.lock();
+    const auto destination_ptr = destination.lock();
+    if ( !source_ptr ||
+         !destination_ptr )
+        return weak_edge_t{};
+    for ( const auto& in_hedge : destination_ptr->get_in_hedges() ) {
+        const auto hyper_edge = in_hedge.lock();
+        if ( hyper_edge &&
+             hyper_edge->get_src().lock() == source_ptr )
+            return hyper_edge;
+    }
+    return weak_edge_t{};
+}
+
+template < class config_t >
+auto    graph<config_t>::has_edge( const weak_node_t& source, const weak_edge_t& destination ) const noexcept -> bool
+{
+    return ( find_edge( source, destination ).use_count() != 0 );
+}
+
+template < class config_t >
+auto    graph<config_t>::get_edge_count( const weak_node_t& source, const weak_node_t& destination ) const -> unsigned int
 {
-    unsigned int edgeCount = 0;
-    std::for_each( _edges.begin(), _edges.end(), [&](const shared_edge_t& e ) {
-                                                        if ( compare_weak_ptr<>( e->get_src(), source ) &&
-                                                             compare_weak_ptr<>( e->get_dst(), destination ) )
-                                                            ++edgeCount;
-                                                    } );
-    return edgeCount;
+    const auto sourcePtr = source.lock();
+    if ( !sourcePtr )
+        return 0;
+    return sourcePtr->get_out_edge_count( destination );
 }
 
 template < class config_t >
-auto    graph<config_t>::contains( weak_edge_t edge ) const noexcept -> bool
+auto    graph<config_t>::contains( const weak_edge_t& edge ) const noexcept -> bool
 {
     if ( edge.expired() )   // Fast exit.
         return false;
-    auto edgeIter = std::find_if( _edges_search.cbegin(), _edges_search.cend(),
-                                            [=](const weak_edge_t& n ) { return ( compare_weak_ptr<>( edge, n ) ); } );
-    return edgeIter != _edges_search.cend();
+    return config_t::template container_adapter<weak_edges_search_t>::contains( _edges_search, edge );
+}
+//-----------------------------------------------------------------------------
+
+/* Restricted Hyper Edge Management *///---------------------------------------
+template < class config_t >
+auto    graph<config_t>::create_edge( const weak_node_t& source, const weak_edge_t& destination ) -> weak_edge_t
+{
+    const auto lock = write_lock();
+    auto source_ptr = source.lock();
+    auto destination_ptr = destination.lock();
+    if ( !source_ptr ||
+         !destination_ptr )
+        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(Node,Edge): Insertion of hyper edge failed, either source node or destination edge are expired." );
+    if ( source_ptr->get_graph() != this ||
+         destination_ptr->get_graph() != this )
+        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(Node,Edge): Insertion of hyper edge failed, source node or destination edge is not part of this graph." );
+    ++_topology_revision;
+    auto hyper_edge = std::allocate_shared<typename config_t::final_edge_t>( _edge_allocator );
+    hyper_edge->set_src( source );
+    hyper_edge->set_hdst( destination );
+    try {
+        config_t::template container_adapter< shared_edges_t >::insert( hyper_edge, _hyper_edges );
+        hyper_edge->_out_hedge_index = source_ptr->_out_hedges.size();
+        source_ptr->_out_hedges.push_back( hyper_edge );
+        hyper_edge->_in_hedge_index = destination_ptr->_in_hedges.size();
+        destination_ptr->_in_hedges.push_back( hyper_edge );
+    } catch ( ... ) {
+        remove_hyper_edge_impl( hyper_edge );
+        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(Node,Edge): Insertion of hyper edge failed, source or destination topology can't be modified." );
+    }
+    hyper_edge->set_graph( this );
+    return hyper_edge;
+}
+
+template < class config_t >
+auto    graph<config_t>::remove_hyper_edge_impl( const shared_edge_t& hyper_edge ) noexcept -> void
+{
+    // Indexes are swap-erased: hyper edge moved in place of victim get its index updated.
+    const auto erase_from = [](std::vector<weak_edge_t>& index, std::size_t position, std::size_t edge_t::* member) {
+        if ( position >= index.size() )
+            return;
+        const auto back = index.back().lock();
+        if ( position != index.size() - 1 ) {
+            index[position] = index.back();
+            if ( back )
+                ( *back ).*member = position;
+        }
+        index.pop_back();
+    };
+    remove_in_hedges( *hyper_edge );    // Hyper edges may target hyper edges
+    const auto source = hyper_edge->get_src().lock();
+    if ( source )
+        erase_from( source->_out_hedges, hyper_edge->_out_hedge_index, &edge_t::_out_hedge_index );
+    const auto destination = hyper_edge->get_hdst().lock();
+    if ( destination )
+        erase_from( destination->_in_hedges, hyper_edge->_in_hedge_index, &edge_t::_in_hedge_index );
+    hyper_edge->_out_hedge_index = static_cast<std::size_t>(-1);
+    hyper_edge->_in_hedge_index = static_cast<std::size_t>(-1);
+    hyper_edge->set_graph( nullptr );
+    config_t::template container_adapter<shared_edges_t>::remove( hyper_edge, _hyper_edges );
+}
+
+template < class config_t >
+auto    graph<config_t>::remove_in_hedges( edge_t& edge ) noexcept -> void
+{
+    while ( !edge._in_hedges.empty() ) {
+        const auto hyper_edge = edge._in_hedges.back().lock();
+        if ( hyper_edge )
+            remove_hyper_edge_impl( hyper_edge );   // Erase hyper edge from edge._in_hedges
+        else
+            edge._in_hedges.pop_back();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Handles *///---------------------------------------------------------
+template < class config_t >
+auto    graph<config_t>::find_node( node_id id ) const noexcept -> weak_node_t
+{
+    const auto slot = _node_slots.find( id );
+    return slot != nullptr ? slot->weak : weak_node_t{};
+}
+
+template < class config_t >
+auto    graph<config_t>::find_edge( edge_id id ) const noexcept -> weak_edge_t
+{
+    const auto slot = _edge_slots.find( id );
+    return slot != nullptr ? slot->weak : weak_edge_t{};
+}
+
+template < class config_t >
+auto    graph<config_t>::create_edge( node_id source, node_id destination ) -> edge_id
+{
+    const auto lock = write_lock();
+    const auto source_slot = _node_slots.find( source );
+    const auto destination_slot = _node_slots.find( destination );
+    if ( source_slot == nullptr ||
+         destination_slot == nullptr )
+        throw gtpo::bad_topology_error( "gtpo::graph<>::create_edge(node_id,node_id): Insertion of edge failed, either source or destination handles are stale." );
+    const auto edge = create_edge_impl( *source_slot->ptr, source_slot->weak,
+                                        *destination_slot->ptr, destination_slot->weak );
+    return edge.lock()->get_id();
+}
+
+template < class config_t >
+auto    graph<config_t>::find_edge( node_id source, node_id destination ) const noexcept -> edge_id
+{
+    const auto source_slot = _node_slots.find( source );
+    const auto destination_slot = _node_slots.find( destination );
+    if ( source_slot == nullptr ||
+         destination_slot == nullptr )
+        return edge_id{};
+    const auto edge = source_slot->ptr->find_out_edge( destination_slot->weak, destination_slot->ptr ).lock();
+    return edge ? edge->get_id() : edge_id{};
+}
+
+template < class config_t >
+auto    graph<config_t>::remove_node( node_id id ) -> void
+{
+    const auto lock = write_lock();
+    const auto slot = _node_slots.find( id );
+    if ( slot == nullptr )
+        throw gtpo::bad_topology_error( "gtpo::graph<>::remove_node(node_id): Error: node handle is stale." );
+    remove_node( slot->weak );
+}
+
+template < class config_t >
+auto    graph<config_t>::remove_edge( edge_id id ) -> void
+{
+    const auto lock = write_lock();
+    const auto slot = _edge_slots.find( id );
+    if ( slot == nullptr )
+        throw gtpo::bad_topology_error( "gtpo::graph<>::remove_edge(edge_id): Error: edge handle is stale." );
+    remove_edge( slot->weak );
 }
 //-----------------------------------------------------------------------------
 
@@ -314,6 +896,7 @@ auto    graph<config_t>::contains( weak_edge_t edge ) const noexcept -> bool
 template < class config_t >
 auto    graph<config_t>::insert_group( shared_group_t group ) noexcept( false ) -> weak_group_t
 {
+    const auto lock = write_lock();
     assert_throw( group != nullptr, "gtpo::graph<>::insert_group(): Error: trying to insert a nullptr shared_node_t" );
     weak_node_t group_node_ptr = insert_node(group);
     try {
@@ -329,8 +912,9 @@ auto    graph<config_t>::insert_group( shared_group_t group ) noexcept( false )
 }
 
 template < class config_t >
-auto    graph<config_t>::remove_group( weak_group_t group_ptr ) noexcept( false ) -> void
+auto    graph<config_t>::remove_group( const weak_group_t& group_ptr ) noexcept( false ) -> void
 {
+    const auto lock = write_lock();
     shared_node_t group = group_ptr.lock();
     if ( !group )
         gtpo::assert_throw( false, "graph<>::remove_group(): Error: trying to remove and expired group." );
@@ -341,7 +925,7 @@ auto    graph<config_t>::remove_group( weak_group_t group_ptr ) noexcept( false
     group->set_graph( nullptr );
     config_t::template container_adapter<weak_groups_t>::remove( group_ptr, _groups );
 
-    remove_node(group_ptr);
+    remove_node( group );   // Note: group_ptr might alias a (now removed) item of _groups
 }
 
 template < class config_t >
@@ -355,24 +939,29 @@ auto    graph<config_t>::has_group( const weak_group_t& group ) const -> bool
 }
 
 template < class config_t >
-auto    graph<config_t>::group_node( weak_node_t node, weak_group_t group) noexcept(false) -> void
+auto    graph<config_t>::group_node( const weak_node_t& node, const weak_group_t& group) noexcept(false) -> void
 {
+    const auto lock = write_lock();
     auto group_ptr = group.lock();
     gtpo::assert_throw( group_ptr != nullptr, "gtpo::group<>::group_node(): Error: trying to insert a node into an expired group." );
 
     auto node_ptr = node.lock();
     gtpo::assert_throw( node_ptr != nullptr, "gtpo::group<>::group_node(): Error: trying to insert an expired node in group." );
 
+    if ( group_ptr->has_node( node ) )   // Node is already part of group
+        return;
     node_ptr->set_group( group );
     config_t::template container_adapter<weak_nodes_t>::insert( node, group_ptr->_nodes );
+    config_t::template container_adapter<typename node_t::weak_nodes_search_t>::insert( node, group_ptr->_nodes_search );
 
     // FIXME GROUPS
     //group_ptr->notify_node_inserted( node );
 }
 
 template < class config_t >
-auto    graph<config_t>::ungroup_node( weak_node_t weakNode, weak_node_t weakGroup ) noexcept(false) -> void
+auto    graph<config_t>::ungroup_node( const weak_node_t& weakNode, const weak_node_t& weakGroup ) noexcept(false) -> void
 {
+    const auto lock = write_lock();
     auto group = weakGroup.lock();
     gtpo::assert_throw( group != nullptr, "gtpo::group<>::ungroup_node(): Error: trying to ungroup from an expired group." );
 
@@ -381,11 +970,69 @@ auto    graph<config_t>::ungroup_node( weak_node_t weakNode, weak_node_t weakGro
 
     gtpo::assert_throw( node->get_group().lock() == group, "gtpo::group<>::ungroup_node(): Error: trying to ungroup a node that is not part of group." );
 
+    // Note: hashed index is updated first, weakNode might alias an item of group->_nodes
+    config_t::template container_adapter<typename node_t::weak_nodes_search_t>::remove( weakNode, group->_nodes_search );
     config_t::template container_adapter<weak_nodes_t>::remove( weakNode, group->_nodes );
     // FIXME GROUPS
     //group->notify_node_removed( weakNode );
     node->set_group( weak_group_t{} );  // Warning: group must remain valid while notify_node_removed() is called
 }
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::group_nodes( const weak_group_t& group, forward_it first, forward_it last ) noexcept(false) -> void
+{
+    const auto lock = write_lock();
+    auto group_ptr = group.lock();
+    gtpo::assert_throw( group_ptr != nullptr, "gtpo::graph<>::group_nodes(): Error: trying to insert nodes into an expired group." );
+    const auto count = static_cast<std::size_t>( std::distance( first, last ) );
+    if ( count == 0 )
+        return;
+    config_t::template container_adapter<weak_nodes_t>::reserve( group_ptr->_nodes, group_ptr->_nodes.size() + count );
+    config_t::template container_adapter<typename node_t::weak_nodes_search_t>::reserve( group_ptr->_nodes_search, group_ptr->_nodes.size() + count );
+    for ( ; first != last; ++first ) {
+        const weak_node_t& node = *first;
+        auto node_ptr = node.lock();
+        gtpo::assert_throw( node_ptr != nullptr, "gtpo::graph<>::group_nodes(): Error: trying to insert an expired node in group." );
+        if ( group_ptr->has_node( node ) )
+            continue;
+        node_ptr->set_group( group );
+        config_t::template container_adapter<weak_nodes_t>::insert( node, group_ptr->_nodes );
+        config_t::template container_adapter<typename node_t::weak_nodes_search_t>::insert( node, group_ptr->_nodes_search );
+    }
+}
+
+template < class config_t >
+template < class forward_it >
+auto    graph<config_t>::ungroup_nodes( const weak_group_t& weak_group, forward_it first, forward_it last ) noexcept(false) -> void
+{
+    const auto lock = write_lock();
+    // ALGORITHM:
+        // 1. Check and collect (unique) victims, remove them from group hashed membership.
+        // 2. Sweep group nodes container once.
+        // 3. Reset victims group.
+    auto group = weak_group.lock();
+    gtpo::assert_throw( group != nullptr, "gtpo::graph<>::ungroup_nodes(): Error: trying to ungroup from an expired group." );
+    std::vector<shared_node_t>          nodes;
+    std::unordered_set<const node_t*>   victims;
+    for ( ; first != last; ++first ) {
+        const weak_node_t& weak_node = *first;
+        auto node = weak_node.lock();
+        gtpo::assert_throw( node != nullptr, "gtpo::graph<>::ungroup_nodes(): Error: trying to ungroup an expired node from a group." );
+        gtpo::assert_throw( node->get_group().lock() == group, "gtpo::graph<>::ungroup_nodes(): Error: trying to ungroup a node that is not part of group." );
+        if ( victims.insert( node.get() ).second )
+            nodes.push_back( node );
+    }
+    if ( nodes.empty() )
+        return;
+    for ( const auto& node : nodes )
+        config_t::template container_adapter<typename node_t::weak_nodes_search_t>::remove( node, group->_nodes_search );
+    config_t::template container_adapter<weak_nodes_t>::remove_if( group->_nodes, [&victims](const weak_node_t& node) {
+        return victims.find( node.lock().get() ) != victims.end();
+    } );
+    for ( const auto& node : nodes )
+        node->set_group( weak_group_t{} );
+}
 //-----------------------------------------------------------------------------
 
 } // ::gtpo
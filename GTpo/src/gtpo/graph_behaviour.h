@@ -34,6 +34,9 @@
 
 #pragma once
 
+// STD headers
+#include <vector>
+
 // GTpo headers
 #include "./behaviour.h"
 #include "./node.h"
@@ -55,6 +58,15 @@ public:
 
     using weak_node_t      = std::weak_ptr<typename config_t::final_node_t>;
     using weak_edge_t      = std::weak_ptr<typename config_t::final_edge_t>;
+    using weak_nodes_t     = std::vector<weak_node_t>;
+    using weak_edges_t     = std::vector<weak_edge_t>;
+
+    /*! \brief Set to true in a static behaviour implementing batch notifications (nodes_inserted(), edges_inserted(), etc.).
+     *
+     * When false, batch notifications are replayed to the static behaviour one primitive at a time with
+     * node_inserted(), edge_inserted(), etc.
+     */
+    static constexpr bool   batch_notifications = false;
 
     /*! \name Graph Notification Interface *///--------------------------------
     //@{
@@ -63,6 +75,10 @@ public:
     void    node_inserted( weak_node_t& weakNode ) noexcept { static_cast<void>(weakNode); }
     //! Called immediatly before node \c weakNode is removed from graph.
     void    node_removed( weak_node_t& weakNode) noexcept { static_cast<void>(weakNode); }
+    //! Called once after a batch of nodes \c weakNodes has been inserted with graph::insert_nodes().
+    void    nodes_inserted( weak_nodes_t& weakNodes ) noexcept { static_cast<void>(weakNodes); }
+    //! Called once before a batch of nodes \c weakNodes is removed with graph::remove_nodes().
+    void    nodes_removed( weak_nodes_t& weakNodes ) noexcept { static_cast<void>(weakNodes); }
 
 public:
     //! Called immediatly after group \c weakGroup has been inserted in graph.
@@ -75,6 +91,10 @@ public:
     void    edge_inserted( weak_edge_t& weakEdge ) noexcept { static_cast<void>(weakEdge); }
     //! Called when \c weakEdge is about to be removed.
     void    edge_removed( weak_edge_t& weakEdge ) noexcept { static_cast<void>(weakEdge); }
+    //! Called once after a batch of edges \c weakEdges has been inserted with graph::insert_edges().
+    void    edges_inserted( weak_edges_t& weakEdges ) noexcept { static_cast<void>(weakEdges); }
+    //! Called once before a batch of edges \c weakEdges is removed (with graph::remove_nodes()).
+    void    edges_removed( weak_edges_t& weakEdges ) noexcept { static_cast<void>(weakEdges); }
     //@}
     //-------------------------------------------------------------------------
 };
@@ -95,14 +115,20 @@ public:
 
     using weak_node_t      = std::weak_ptr<typename config_t::final_node_t>;
     using weak_edge_t      = std::weak_ptr<typename config_t::final_edge_t>;
+    using weak_nodes_t     = std::vector<weak_node_t>;
+    using weak_edges_t     = std::vector<weak_edge_t>;
 
 public:
     void    node_inserted( weak_node_t& weakNode ) noexcept { on_node_inserted(weakNode); }
+    void    nodes_inserted( weak_nodes_t& weakNodes ) noexcept { on_nodes_inserted(weakNodes); }
+    void    nodes_removed( weak_nodes_t& weakNodes ) noexcept { on_nodes_removed(weakNodes); }
     void    node_removed( weak_node_t& weakNode) noexcept { on_node_removed(weakNode); }
     void    group_inserted( weak_node_t& weakGroup ) noexcept { on_group_inserted(weakGroup); }
     void    group_removed( weak_node_t& weakGroup ) noexcept { on_group_removed(weakGroup); }
     void    edge_inserted( weak_edge_t& weakEdge ) noexcept { on_edge_inserted(weakEdge); }
     void    edge_removed( weak_edge_t& weakEdge ) noexcept { on_edge_removed(weakEdge); }
+    void    edges_inserted( weak_edges_t& weakEdges ) noexcept { on_edges_inserted(weakEdges); }
+    void    edges_removed( weak_edges_t& weakEdges ) noexcept { on_edges_removed(weakEdges); }
 
     /*! \name Graph Dynamic (virtual) Notification Interface *///--------------
     //@{
@@ -111,6 +137,16 @@ protected:
     virtual void    on_node_inserted( weak_node_t& weakNode ) noexcept { static_cast<void>(weakNode); }
     //! Called immediatly before node \c weakNode is removed from graph.
     virtual void    on_node_removed( weak_node_t& weakNode) noexcept { static_cast<void>(weakNode); }
+    //! Called after a batch of nodes has been inserted, default implementation call on_node_inserted() for every node.
+    virtual void    on_nodes_inserted( weak_nodes_t& weakNodes ) noexcept {
+        for ( auto& weakNode : weakNodes )
+            on_node_inserted(weakNode);
+    }
+    //! Called before a batch of nodes is removed, default implementation call on_node_removed() for every node.
+    virtual void    on_nodes_removed( weak_nodes_t& weakNodes ) noexcept {
+        for ( auto& weakNode : weakNodes )
+            on_node_removed(weakNode);
+    }
 
     //! Called immediatly after group \c weakGroup has been inserted in graph.
     virtual void    on_group_inserted( weak_node_t& weakGroup ) noexcept { static_cast<void>(weakGroup); }
@@ -122,6 +158,16 @@ protected:
     virtual void    on_edge_inserted( weak_edge_t& weakEdge ) noexcept { static_cast<void>(weakEdge); }
     //! Called when \c weakEdge is about to be removed.
     virtual void    on_edge_removed( weak_edge_t& weakEdge ) noexcept { static_cast<void>(weakEdge); }
+    //! Called after a batch of edges has been inserted, default implementation call on_edge_inserted() for every edge.
+    virtual void    on_edges_inserted( weak_edges_t& weakEdges ) noexcept {
+        for ( auto& weakEdge : weakEdges )
+            on_edge_inserted(weakEdge);
+    }
+    //! Called before a batch of edges is removed, default implementation call on_edge_removed() for every edge.
+    virtual void    on_edges_removed( weak_edges_t& weakEdges ) noexcept {
+        for ( auto& weakEdge : weakEdges )
+            on_edge_removed(weakEdge);
+    }
     //@}
     //-------------------------------------------------------------------------
 };
@@ -136,6 +182,8 @@ protected:
 template < class config_t >
 class enable_graph_dynamic_behaviour :  public gtpo::graph_behaviour<config_t>
 {
+    static_assert( config_t::enable_dynamic_behaviours,
+                   "gtpo::enable_graph_dynamic_behaviour<>: Error: dynamic behaviours are disabled in config_t (enable_dynamic_behaviours is false)." );
 public:
     enable_graph_dynamic_behaviour() noexcept : gtpo::graph_behaviour<config_t>{} {}
     ~enable_graph_dynamic_behaviour() noexcept = default;
@@ -144,6 +192,11 @@ public:
 
     using weak_node_t      = std::weak_ptr<typename config_t::final_node_t>;
     using weak_edge_t      = std::weak_ptr<typename config_t::final_edge_t>;
+    using weak_nodes_t     = std::vector<weak_node_t>;
+    using weak_edges_t     = std::vector<weak_edge_t>;
+
+    //! Batch notifications are forwarded to dynamic behaviours (their default implementation replay them per primitive).
+    static constexpr bool   batch_notifications = true;
 
 public:
     template < class primitive_t >
@@ -183,6 +236,34 @@ public:
         if ( graph != nullptr )
             graph->notify_dynamic_behaviours( &dynamic_graph_behaviour<config_t>::edge_removed, weakEdge );
     }
+    void    nodes_inserted( weak_nodes_t& weakNodes ) noexcept {
+        if ( weakNodes.empty() )
+            return;
+        const auto graph = get_primitive_graph(weakNodes.front());
+        if ( graph != nullptr )
+            graph->notify_dynamic_behaviours( &dynamic_graph_behaviour<config_t>::nodes_inserted, weakNodes );
+    }
+    void    edges_inserted( weak_edges_t& weakEdges ) noexcept {
+        if ( weakEdges.empty() )
+            return;
+        const auto graph = get_primitive_graph(weakEdges.front());
+        if ( graph != nullptr )
+            graph->notify_dynamic_behaviours( &dynamic_graph_behaviour<config_t>::edges_inserted, weakEdges );
+    }
+    void    nodes_removed( weak_nodes_t& weakNodes ) noexcept {
+        if ( weakNodes.empty() )
+            return;
+        const auto graph = get_primitive_graph(weakNodes.front());
+        if ( graph != nullptr )
+            graph->notify_dynamic_behaviours( &dynamic_graph_behaviour<config_t>::nodes_removed, weakNodes );
+    }
+    void    edges_removed( weak_edges_t& weakEdges ) noexcept {
+        if ( weakEdges.empty() )
+            return;
+        const auto graph = get_primitive_graph(weakEdges.front());
+        if ( graph != nullptr )
+            graph->notify_dynamic_behaviours( &dynamic_graph_behaviour<config_t>::edges_removed, weakEdges );
+    }
     //@}
     //-------------------------------------------------------------------------
 };
@@ -193,7 +274,8 @@ public:
  */
 template <class config_t>
 class behaviourable_graph : public behaviourable<dynamic_graph_behaviour<config_t>,
-                                                 typename config_t::graph_behaviours
+                                                 typename config_t::graph_behaviours,
+                                                 config_t::enable_dynamic_behaviours
                                                 > // gtpo::behaviourable<>
 {
     /*! \name behaviourable_graph Object Management *///------------------------
@@ -203,7 +285,7 @@ public:
 
     using dynamic_graph_behaviour_t = dynamic_graph_behaviour<config_t>;
     using graph_static_behaviours_t = typename config_t::graph_behaviours;
-    using behaviourable_base = behaviourable<dynamic_graph_behaviour<config_t>, typename config_t::graph_behaviours>;
+    using behaviourable_base = behaviourable<dynamic_graph_behaviour<config_t>, typename config_t::graph_behaviours, config_t::enable_dynamic_behaviours>;
 
     behaviourable_graph() : behaviourable_base{} { }
     ~behaviourable_graph() noexcept { /* Nil */ }
@@ -216,7 +298,7 @@ public:
     //@{
 public:
     inline auto     add_dynamic_graph_behaviour( std::unique_ptr<dynamic_graph_behaviour_t> behaviour ) -> void {
-        behaviourable<dynamic_graph_behaviour_t, graph_static_behaviours_t>::add_behaviour(std::move(behaviour));
+        behaviourable_base::add_behaviour(std::move(behaviour));
     }
 
     template < class node_t >
@@ -231,6 +313,18 @@ public:
     template < class edge_t >
     auto    notify_edge_removed( edge_t& node ) noexcept -> void;
 
+    template < class nodes_t >
+    auto    notify_nodes_inserted( nodes_t& nodes ) noexcept -> void;
+
+    template < class edges_t >
+    auto    notify_edges_inserted( edges_t& edges ) noexcept -> void;
+
+    template < class nodes_t >
+    auto    notify_nodes_removed( nodes_t& nodes ) noexcept -> void;
+
+    template < class edges_t >
+    auto    notify_edges_removed( edges_t& edges ) noexcept -> void;
+
     template < class group_t >
     auto    notify_group_inserted( group_t& group ) noexcept -> void;
 
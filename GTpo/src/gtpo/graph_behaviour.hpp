@@ -32,11 +32,36 @@
 // \date	2017 03 09
 //-----------------------------------------------------------------------------
 
+// STD headers
+#include <type_traits>  // std::integral_constant std::decay_t
+
 #include "./utils.h"
 
 namespace gtpo { // ::gtpo
 
 /* Notification Helper Methods *///--------------------------------------------
+namespace impl { // ::gtpo::impl
+
+// Batch notifications dispatch for static behaviours: forward the batch when behaviour_t::batch_notifications
+// is true, otherwise replay the batch one primitive at a time.
+template < class behaviour_t, class primitives_t, class batch_method_t, class method_t >
+auto    notify_batch( behaviour_t& behaviour, primitives_t& primitives, batch_method_t batch_method, method_t, std::true_type ) noexcept -> void
+{
+    (behaviour.*batch_method)( primitives );
+}
+
+template < class behaviour_t, class primitives_t, class batch_method_t, class method_t >
+auto    notify_batch( behaviour_t& behaviour, primitives_t& primitives, batch_method_t, method_t method, std::false_type ) noexcept -> void
+{
+    for ( auto& primitive : primitives )
+        (behaviour.*method)( primitive );
+}
+
+template < class behaviour_t >
+using batch_notifications_t = std::integral_constant<bool, behaviour_t::batch_notifications>;
+
+} // ::gtpo::impl
+
 template < class config_t >
 template < class node_t >
 auto    behaviourable_graph< config_t >::notify_node_inserted( node_t& node ) noexcept -> void
@@ -65,6 +90,46 @@ auto    behaviourable_graph< config_t >::notify_edge_removed( edge_t& edge ) noe
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.edge_removed( edge ); } );
 }
 
+template < class config_t >
+template < class nodes_t >
+auto    behaviourable_graph< config_t >::notify_nodes_inserted( nodes_t& nodes ) noexcept -> void
+{
+    this->notify_static_behaviours( [&](auto& behaviour) noexcept {
+        using behaviour_t = std::decay_t<decltype(behaviour)>;
+        impl::notify_batch( behaviour, nodes, &behaviour_t::nodes_inserted, &behaviour_t::node_inserted, impl::batch_notifications_t<behaviour_t>{} );
+    } );
+}
+
+template < class config_t >
+template < class edges_t >
+auto    behaviourable_graph< config_t >::notify_edges_inserted( edges_t& edges ) noexcept -> void
+{
+    this->notify_static_behaviours( [&](auto& behaviour) noexcept {
+        using behaviour_t = std::decay_t<decltype(behaviour)>;
+        impl::notify_batch( behaviour, edges, &behaviour_t::edges_inserted, &behaviour_t::edge_inserted, impl::batch_notifications_t<behaviour_t>{} );
+    } );
+}
+
+template < class config_t >
+template < class nodes_t >
+auto    behaviourable_graph< config_t >::notify_nodes_removed( nodes_t& nodes ) noexcept -> void
+{
+    this->notify_static_behaviours( [&](auto& behaviour) noexcept {
+        using behaviour_t = std::decay_t<decltype(behaviour)>;
+        impl::notify_batch( behaviour, nodes, &behaviour_t::nodes_removed, &behaviour_t::node_removed, impl::batch_notifications_t<behaviour_t>{} );
+    } );
+}
+
+template < class config_t >
+template < class edges_t >
+auto    behaviourable_graph< config_t >::notify_edges_removed( edges_t& edges ) noexcept -> void
+{
+    this->notify_static_behaviours( [&](auto& behaviour) noexcept {
+        using behaviour_t = std::decay_t<decltype(behaviour)>;
+        impl::notify_batch( behaviour, edges, &behaviour_t::edges_removed, &behaviour_t::edge_removed, impl::batch_notifications_t<behaviour_t>{} );
+    } );
+}
+
 template < class config_t >
 template < class group_t >
 auto    behaviourable_graph< config_t >::notify_group_inserted( group_t& group ) noexcept -> void
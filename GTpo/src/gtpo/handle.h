@@ -0,0 +1,200 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	handle.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_handle_h
+#define gtpo_handle_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <functional>       // std::hash
+#include <vector>
+
+// GTpo headers
+#include "./utils.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Stable 32 bits generational handle on a graph primitive (see node_id and edge_id).
+ *
+ * A handle pack a slot index (low 24 bits) and a slot generation (high 8 bits): when a primitive is
+ * removed from its graph, its slot generation is incremented and all existing handles on the slot
+ * become stale. A slot whose generation is exhausted is retired and never reused, a stale handle can
+ * not alias a newer primitive.
+ *
+ * Default constructed handles are invalid.
+ */
+template <class tag_t>
+class handle
+{
+public:
+    enum : std::uint32_t {
+        index_bits      = 24,
+        index_mask      = ( std::uint32_t{1} << index_bits ) - 1,
+        max_index       = index_mask - 1,               //!< index_mask is reserved for invalid handles.
+        max_generation  = 0xFF,
+        invalid_value   = 0xFFFFFFFF
+    };
+
+    constexpr handle() noexcept = default;
+    constexpr handle(std::uint32_t index, std::uint32_t generation) noexcept :
+        _value{ ( generation << index_bits ) | ( index & index_mask ) } { }
+    ~handle() noexcept = default;
+    handle(const handle&) noexcept = default;
+    handle& operator=(const handle&) noexcept = default;
+
+    //! Return false for a default constructed handle (a valid handle might be stale, use graph contains()).
+    constexpr auto  is_valid() const noexcept -> bool { return _value != invalid_value; }
+    constexpr auto  get_index() const noexcept -> std::uint32_t { return _value & index_mask; }
+    constexpr auto  get_generation() const noexcept -> std::uint32_t { return _value >> index_bits; }
+    constexpr auto  get_value() const noexcept -> std::uint32_t { return _value; }
+
+    constexpr auto  operator==(const handle& rhs) const noexcept -> bool { return _value == rhs._value; }
+    constexpr auto  operator!=(const handle& rhs) const noexcept -> bool { return _value != rhs._value; }
+    constexpr auto  operator<(const handle& rhs) const noexcept -> bool { return _value < rhs._value; }
+
+private:
+    std::uint32_t   _value = invalid_value;
+};
+
+struct node_id_tag { };
+struct edge_id_tag { };
+
+//! Stable generational handle on a graph node, resolved in O(1) with graph get_node().
+using node_id = handle<node_id_tag>;
+//! Stable generational handle on a graph edge, resolved in O(1) with graph get_edge().
+using edge_id = handle<edge_id_tag>;
+
+namespace impl { // ::gtpo::impl
+
+/*! \brief Slot map resolving gtpo::handle to a primitive raw pointer and weak pointer in O(1).
+ *
+ * Free slots are recycled with an intrusive free list, resolution never lock a weak pointer:
+ * a slot is valid while its primitive is registered in graph.
+ */
+template <class T, class weak_t, class handle_t>
+class slot_map
+{
+public:
+    struct slot {
+        T*              ptr         = nullptr;
+        weak_t          weak;
+        std::uint32_t   generation  = 0;
+        std::uint32_t   next_free   = invalid_slot;
+    };
+
+    slot_map() noexcept = default;
+    slot_map(const slot_map&) = delete;
+    slot_map& operator=(const slot_map&) = delete;
+
+    /*! \brief Register \c ptr and return its handle.
+     *
+     * \throw gtpo::bad_topology_error if the maximum handle index count is exceeded.
+     */
+    auto    insert(T* ptr, const weak_t& weak) noexcept( false ) -> handle_t {
+        std::uint32_t index = _free_head;
+        if ( index != invalid_slot ) {
+            _free_head = _slots[index].next_free;
+        } else {
+            gtpo::assert_throw( _slots.size() <= handle_t::max_index, "gtpo::impl::slot_map<>::insert(): Error: maximum handle count exceeded." );
+            index = static_cast<std::uint32_t>( _slots.size() );
+            _slots.emplace_back();
+        }
+        auto& s = _slots[index];
+        s.ptr = ptr;
+        s.weak = weak;
+        s.next_free = invalid_slot;
+        ++_size;
+        return handle_t{ index, s.generation };
+    }
+
+    //! Unregister primitive for handle \c h, \c h and all its copies become stale (no-op if \c h is already stale).
+    auto    erase(handle_t h) noexcept -> void {
+        if ( find(h) == nullptr )
+            return;
+        const auto index = h.get_index();
+        auto& s = _slots[index];
+        s.ptr = nullptr;
+        s.weak.reset();
+        --_size;
+        if ( ++s.generation < handle_t::max_generation ) {   // Otherwise retire slot
+            s.next_free = _free_head;
+            _free_head = index;
+        }
+    }
+
+    //! Return slot for handle \c h, or nullptr if \c h is stale or invalid.
+    inline auto find(handle_t h) const noexcept -> const slot* {
+        const auto index = h.get_index();
+        if ( !h.is_valid() ||
+             index >= _slots.size() )
+            return nullptr;
+        const auto& s = _slots[index];
+        return ( s.ptr != nullptr && s.generation == h.get_generation() ) ? &s : nullptr;
+    }
+    //! Return primitive for handle \c h, or nullptr if \c h is stale or invalid.
+    inline auto get(handle_t h) const noexcept -> T* {
+        const auto s = find(h);
+        return s != nullptr ? s->ptr : nullptr;
+    }
+
+    inline auto size() const noexcept -> std::size_t { return _size; }
+    inline auto reserve(std::size_t capacity) -> void { _slots.reserve(capacity); }
+    //! Clear all slots (existing handles generations are not preserved, clear() is only safe when graph is cleared).
+    auto    clear() noexcept -> void { _slots.clear(); _free_head = invalid_slot; _size = 0; }
+
+private:
+    enum : std::uint32_t { invalid_slot = 0xFFFFFFFF };
+    std::vector<slot>   _slots;
+    std::uint32_t       _free_head = invalid_slot;
+    std::size_t         _size = 0;
+};
+
+} // ::gtpo::impl
+
+} // ::gtpo
+
+namespace std
+{
+    //! Specialization of std::hash for gtpo::handle type.
+    template <class tag_t>
+    struct hash<gtpo::handle<tag_t>>
+    {
+        auto operator()(const gtpo::handle<tag_t>& h) const noexcept -> std::size_t {
+            return std::hash<std::uint32_t>()( h.get_value() );
+        }
+    };
+}
+
+#endif // gtpo_handle_h
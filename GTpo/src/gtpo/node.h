@@ -42,12 +42,18 @@
 #include <functional>       // std::hash
 #include <cassert>
 #include <iterator>         // std::back_inserter
+#include <unordered_map>
+#include <type_traits>      // std::integral_constant
+#include <utility>          // std::declval
+#include <cstddef>          // std::ptrdiff_t
+#include <vector>
 
 // GTpo headers
 #include "./utils.h"
 #include "./config.h"
 #include "./graph_property.h"
 #include "./node_behaviour.h"
+#include "./handle.h"
 
 namespace gtpo { // ::gtpo
 
@@ -60,6 +66,128 @@ class group;
 template <class config_t>
 class edge;
 
+namespace impl { // ::gtpo::impl
+
+/*! \brief Empty node out edges index used when config_t::enable_adjacency_index is false.
+ */
+template <class node_t, class weak_edge_t, bool enabled>
+struct adjacency_index {
+    inline auto insert(const node_t*, const weak_edge_t&) noexcept -> void { }
+    inline auto remove(const node_t*, const weak_edge_t&) noexcept -> void { }
+    inline auto clear() noexcept -> void { }
+};
+
+/*! \brief Hashed destination node to out edges (multi) map, maintained by gtpo::node when config_t::enable_adjacency_index is true.
+ */
+template <class node_t, class weak_edge_t>
+struct adjacency_index<node_t, weak_edge_t, true> {
+    inline auto insert(const node_t* dst, const weak_edge_t& edge) -> void { index.insert({dst, edge}); }
+    auto        remove(const node_t* dst, const weak_edge_t& edge) noexcept -> void {
+        if ( dst == nullptr ) {     // Destination has expired, fallback to a linear search
+            for ( auto it = index.begin(); it != index.end(); ++it )
+                if ( compare_weak_ptr(it->second, edge) ) {
+                    index.erase(it);
+                    return;
+                }
+            return;
+        }
+        const auto range = index.equal_range(dst);
+        for ( auto it = range.first; it != range.second; ++it )
+            if ( compare_weak_ptr(it->second, edge) ) {
+                index.erase(it);
+                return;
+            }
+    }
+    inline auto clear() noexcept -> void { index.clear(); }
+
+    std::unordered_multimap<const node_t*, weak_edge_t>  index;
+};
+
+/*! \brief Lazy projection of a node in (or out) edges on their source (or destination) nodes.
+ *
+ * Used for node get_in_nodes() / get_out_nodes() when config_t::enable_node_lists is false, iterators
+ * dereference to a weak_node_t value (an expired weak_ptr for an expired edge). Range is valid while
+ * projected edges container is not modified.
+ */
+template <class weak_edges_t, class weak_node_t, bool source>
+class edge_nodes_range {
+public:
+    class const_iterator {
+    public:
+        using edge_iterator_t   = typename weak_edges_t::const_iterator;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = weak_node_t;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = weak_node_t;
+        //! Arrow proxy (allow it->lock()).
+        struct pointer {
+            weak_node_t node;
+            inline auto operator->() const noexcept -> const weak_node_t* { return &node; }
+        };
+
+        const_iterator() noexcept = default;
+        explicit const_iterator(edge_iterator_t edge) noexcept : _edge{edge} { }
+
+        inline auto operator*() const noexcept -> weak_node_t { return project(*_edge); }
+        inline auto operator->() const noexcept -> pointer { return pointer{project(*_edge)}; }
+        inline auto operator++() noexcept -> const_iterator& { ++_edge; return *this; }
+        inline auto operator++(int) noexcept -> const_iterator { auto it = *this; ++_edge; return it; }
+        inline auto operator==(const const_iterator& rhs) const noexcept -> bool { return _edge == rhs._edge; }
+        inline auto operator!=(const const_iterator& rhs) const noexcept -> bool { return _edge != rhs._edge; }
+
+    private:
+        template <class weak_edge_t>
+        static auto project(const weak_edge_t& edge) noexcept -> weak_node_t {
+            const auto edge_ptr = edge.lock();
+            if ( !edge_ptr )
+                return weak_node_t{};
+            return source ? edge_ptr->get_src() : edge_ptr->get_dst();
+        }
+        edge_iterator_t _edge;
+    };
+    using iterator = const_iterator;
+
+    explicit edge_nodes_range(const weak_edges_t& edges) noexcept : _edges{edges} { }
+
+    inline auto begin() const noexcept -> const_iterator { return const_iterator{_edges.cbegin()}; }
+    inline auto end() const noexcept -> const_iterator { return const_iterator{_edges.cend()}; }
+    inline auto cbegin() const noexcept -> const_iterator { return begin(); }
+    inline auto cend() const noexcept -> const_iterator { return end(); }
+    inline auto size() const noexcept -> std::size_t { return static_cast<std::size_t>(_edges.size()); }
+    inline auto empty() const noexcept -> bool { return _edges.size() == 0; }
+
+private:
+    const weak_edges_t& _edges;
+};
+
+/*! \brief Node in (or out) nodes list, maintained by gtpo::node when config_t::enable_node_lists is true.
+ */
+template <class config_t, class weak_nodes_t, class weak_edges_t, bool source, bool enabled>
+struct node_list {
+    using weak_node_t = typename weak_nodes_t::value_type;
+    inline auto insert(const weak_node_t& node) -> void { config_t::template container_adapter<weak_nodes_t>::insert(node, nodes); }
+    inline auto remove(const weak_node_t& node) -> void { config_t::template container_adapter<weak_nodes_t>::remove(node, nodes); }
+    inline auto clear() noexcept -> void { nodes.clear(); }
+    inline auto view(const weak_edges_t&) const noexcept -> const weak_nodes_t& { return nodes; }
+
+    weak_nodes_t    nodes;
+};
+
+/*! \brief Lean node list when config_t::enable_node_lists is false: nothing is stored, nodes are projected from edges.
+ */
+template <class config_t, class weak_nodes_t, class weak_edges_t, bool source>
+struct node_list<config_t, weak_nodes_t, weak_edges_t, source, false> {
+    using weak_node_t = typename weak_nodes_t::value_type;
+    inline auto insert(const weak_node_t&) noexcept -> void { }
+    inline auto remove(const weak_node_t&) noexcept -> void { }
+    inline auto clear() noexcept -> void { }
+    inline auto view(const weak_edges_t& edges) const noexcept -> edge_nodes_range<weak_edges_t, weak_node_t, source> {
+        return edge_nodes_range<weak_edges_t, weak_node_t, source>{edges};
+    }
+};
+
+} // ::gtpo::impl
+
 /*! \brief Base class for modelling nodes with an in/out edges list in a gtpo::graph graph.
  *
  * \nosubgrouping
@@ -89,6 +217,7 @@ public:
     virtual ~node() noexcept {
         _in_edges.clear(); _out_edges.clear();
         _in_nodes.clear(); _out_nodes.clear();
+        _out_edges_index.clear();
         if ( this->_graph != nullptr ) {
             std::cerr << "gtpo::node<>::~node(): Warning: Node has been destroyed before beeing removed from the graph." << std::endl;
         }
@@ -111,6 +240,13 @@ public:
             behaviour->set_target(this->shared_from_this());
         behaviourable_base::add_behaviour(std::move(behaviour));
     }
+
+    //! Return node stable handle in its graph (an invalid handle if node is not registered in a graph).
+    inline auto     get_id() const noexcept -> node_id { return _id; }
+private:
+    node_id         _id;
+    //! Index of this node in its graph root nodes container, -1 if node is not a root node (see graph<>::is_root_node()).
+    std::size_t     _root_index = static_cast<std::size_t>(-1);
     //@}
     //-------------------------------------------------------------------------
 
@@ -119,42 +255,97 @@ public:
 public:
     using weak_edge_t     = std::weak_ptr<typename config_t::final_edge_t>;
     using shared_edge_t   = std::shared_ptr<typename config_t::final_edge_t>;
-    using weak_edges_t    = typename config_t::template edge_container_t< weak_edge_t >;
+    //! Node in/out edges container (config_t::adjacent_edges_container_t if defined, config_t::edge_container_t otherwise).
+    using weak_edges_t    = typename impl::adjacent_edges_container< config_t, weak_edge_t >::type;
 
     /*! \brief Insert edge \c outEdge as an out edge for this node.
      *
      * \note if \c outEdge source node is different from this node, it is set to this node.
      */
-    auto    add_out_edge( weak_edge_t sharedOutEdge ) noexcept( false ) -> void;
+    auto    add_out_edge( const weak_edge_t& outEdge ) noexcept( false ) -> void;
     /*! \brief Insert edge \c inEdge as an in edge for \c node.
      *
      * \note if \c inEdge destination node is different from \c node, it is automatically set to \c node.
      */
-    auto    add_in_edge( weak_edge_t sharedInEdge ) noexcept( false ) -> void;
+    auto    add_in_edge( const weak_edge_t& inEdge ) noexcept( false ) -> void;
     /*! \brief Remove edge \c outEdge from this node out edges.
      *
      * \throw gtpo::bad_topology_error
      */
-    auto    remove_out_edge( const weak_edge_t outEdge ) noexcept( false ) -> void;
+    auto    remove_out_edge( const weak_edge_t& outEdge ) noexcept( false ) -> void;
     /*! \brief Remove edge \c inEdge from this node in edges.
      *
      * \throw gtpo::bad_topology_error
      */
-    auto    remove_in_edge( const weak_edge_t inEdge ) noexcept( false ) -> void;
+    auto    remove_in_edge( const weak_edge_t& inEdge ) noexcept( false ) -> void;
 
     inline auto     get_in_edges() const noexcept -> const weak_edges_t& { return _in_edges; }
     inline auto     get_out_edges() const noexcept -> const weak_edges_t& { return _out_edges; }
 
-    inline auto     get_in_nodes() const noexcept -> const weak_nodes_t& { return _in_nodes; }
-    inline auto     get_out_nodes() const noexcept -> const weak_nodes_t& { return _out_nodes; }
+private:
+    using adjacent_nodes_t = typename impl::adjacent_nodes_container< config_t, weak_node_t >::type;
+    using in_nodes_list_t  = impl::node_list<config_t, adjacent_nodes_t, weak_edges_t, true, config_t::enable_node_lists>;
+    using out_nodes_list_t = impl::node_list<config_t, adjacent_nodes_t, weak_edges_t, false, config_t::enable_node_lists>;
+public:
+    //! In nodes type, either a const reference on adjacent nodes container or a lazy projection of in edges when config_t::enable_node_lists is false.
+    using in_nodes_t  = decltype( std::declval<const in_nodes_list_t&>().view( std::declval<const weak_edges_t&>() ) );
+    //! Out nodes type, either a const reference on adjacent nodes container or a lazy projection of out edges when config_t::enable_node_lists is false.
+    using out_nodes_t = decltype( std::declval<const out_nodes_list_t&>().view( std::declval<const weak_edges_t&>() ) );
+
+    inline auto     get_in_nodes() const noexcept -> in_nodes_t { return _in_nodes.view( _in_edges ); }
+    inline auto     get_out_nodes() const noexcept -> out_nodes_t { return _out_nodes.view( _out_edges ); }
 
     inline auto     get_in_degree() const noexcept -> unsigned int { return static_cast<int>( _in_edges.size() ); }
     inline auto     get_out_degree() const noexcept -> unsigned int { return static_cast<int>( _out_edges.size() ); }
+
+    /*! \brief Return the first out edge with destination \c dst (or an expired weak_ptr if there is no such edge).
+     *
+     * Complexity is O(1) when config_t::enable_adjacency_index is true, O(out degree) otherwise.
+     */
+    auto    find_out_edge( const weak_node_t& dst ) const noexcept -> weak_edge_t;
+    /*! \brief Return the first out edge with destination \c dst when caller already hold \c dst raw pointer.
+     *
+     * Same as find_out_edge(), but \c dst is never locked (used by id based graph methods).
+     */
+    auto    find_out_edge( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr ) const noexcept -> weak_edge_t;
+    /*! \brief Return the number of (parallel) out edges with destination \c dst.
+     *
+     * Complexity is O(1) when config_t::enable_adjacency_index is true, O(out degree) otherwise.
+     */
+    auto    get_out_edge_count( const weak_node_t& dst ) const noexcept -> unsigned int;
+    /*! \brief Call \c functor with every (parallel) out edge with destination \c dst_ptr, \c functor signature is \c void(const weak_edge_t&).
+     *
+     * Complexity is O(parallel edges count) when config_t::enable_adjacency_index is true, O(out degree) otherwise,
+     * edges are visited in no particular order.
+     */
+    template <class functor_t>
+    auto    for_each_out_edge( const typename config_t::final_node_t* dst_ptr, functor_t&& functor ) const -> void;
+private:
+    using adjacency_index_enabled_t = std::integral_constant<bool, config_t::enable_adjacency_index>;
+    auto    find_out_edge_impl( const weak_node_t& dst, std::true_type ) const noexcept -> weak_edge_t;
+    auto    find_out_edge_impl( const weak_node_t& dst, std::false_type ) const noexcept -> weak_edge_t;
+    auto    find_out_edge_impl( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr, std::true_type ) const noexcept -> weak_edge_t;
+    auto    find_out_edge_impl( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr, std::false_type ) const noexcept -> weak_edge_t;
+    auto    get_out_edge_count_impl( const weak_node_t& dst, std::true_type ) const noexcept -> unsigned int;
+    auto    get_out_edge_count_impl( const weak_node_t& dst, std::false_type ) const noexcept -> unsigned int;
+    template <class functor_t>
+    auto    for_each_out_edge_impl( const typename config_t::final_node_t* dst_ptr, functor_t& functor, std::true_type ) const -> void;
+    template <class functor_t>
+    auto    for_each_out_edge_impl( const typename config_t::final_node_t* dst_ptr, functor_t& functor, std::false_type ) const -> void;
+
 private:
     weak_edges_t       _in_edges;
     weak_edges_t       _out_edges;
-    weak_nodes_t       _in_nodes;
-    weak_nodes_t       _out_nodes;
+    in_nodes_list_t    _in_nodes;
+    out_nodes_list_t   _out_nodes;
+    impl::adjacency_index<typename config_t::final_node_t, weak_edge_t,
+                          config_t::enable_adjacency_index> _out_edges_index;
+
+public:
+    //! Restricted hyper edges (node -> edge) with this node as source, maintained by graph (see graph::create_edge(weak_node_t, weak_edge_t)).
+    inline auto     get_out_hedges() const noexcept -> const std::vector<weak_edge_t>& { return _out_hedges; }
+private:
+    std::vector<weak_edge_t>    _out_hedges;
     //@}
     //-------------------------------------------------------------------------
 
@@ -174,12 +365,17 @@ private:
     /*! \name Group-node Support *///------------------------------------------
     //@{
 public:
+    using weak_nodes_search_t = typename config_t::template search_container_t< weak_node_t >;
+
     inline auto is_group() const noexcept -> bool { return _is_group; }
 
     //! Return group's nodes.
     inline auto get_nodes() const noexcept -> const weak_nodes_t& { return _nodes; }
 
-    //! Return true if group contains \c node.
+    /*! \brief Return true if group contains \c node.
+     *
+     * Complexity is O(1), group membership is hashed.
+     */
     auto        has_node(const weak_node_t& node) const noexcept -> bool;
 
     //! Return group registered node count.
@@ -190,8 +386,9 @@ protected:
 
     inline  auto group_nodes() const noexcept -> const weak_nodes_t& { return _nodes; }
 private:
-    bool            _is_group = false;
-    weak_nodes_t   _nodes;
+    bool                _is_group = false;
+    weak_nodes_t        _nodes;
+    weak_nodes_search_t _nodes_search;     // Hashed group membership (mirror _nodes content)
     //@}
     //-------------------------------------------------------------------------
 };
@@ -36,59 +36,59 @@ namespace gtpo { // ::gtpo
 
 /* node Edges Management *///-----------------------------------------------
 template < class config_t >
-auto node<config_t>::add_out_edge( weak_edge_t outEdgePtr ) -> void
-{
-    assert_throw( !outEdgePtr.expired(), "gtpo::node<>::add_out_edge(): Error: out edge is expired." );
-    auto node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
-    auto outEdge = outEdgePtr.lock();
-    auto outEdgeSrc = outEdge->get_src().lock();
-    if ( outEdge ) {
-        if ( !outEdgeSrc || outEdgeSrc != node )  // Out edge source should point to target node
-            outEdge->set_src( node );
-        config_t::template container_adapter< weak_edges_t >::insert( outEdgePtr, _out_edges );
-        if ( !outEdge->get_dst().expired() ) {
-            config_t::template container_adapter< weak_nodes_t >::insert( outEdge->get_dst(), _out_nodes );
-            this->notify_out_node_inserted( weak_node_t{node}, outEdge->get_dst(), weak_edge_t{outEdge} );
-        }
+auto node<config_t>::add_out_edge( const weak_edge_t& outEdgePtr ) -> void
+{
+    const auto outEdge = outEdgePtr.lock();
+    assert_throw( outEdge != nullptr, "gtpo::node<>::add_out_edge(): Error: out edge is expired." );
+    const weak_node_t node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
+    if ( outEdge->get_src().lock().get() != this )  // Out edge source should point to target node
+        outEdge->set_src( node );
+    const auto& outEdgeDst = outEdge->get_dst();
+    config_t::template container_adapter< weak_edges_t >::insert( outEdgePtr, _out_edges );
+    _out_edges_index.insert( outEdgeDst.lock().get(), outEdgePtr );
+    if ( !outEdgeDst.expired() ) {
+        _out_nodes.insert( outEdgeDst );
+        if ( this->_graph == nullptr ||     // Notification is replayed when graph deferred notifications are flushed
+             !this->_graph->is_notification_deferred() )
+            this->notify_out_node_inserted( node, outEdgeDst, outEdgePtr );
     }
 }
 
 template <class config_t>
-auto node<config_t>::add_in_edge( weak_edge_t inEdgePtr ) -> void
-{
-    assert_throw( !inEdgePtr.expired(), "gtpo::node<>::add_in_edge(): Error: in edge is expired." );
-    auto node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
-    auto inEdge = inEdgePtr.lock( );
-    if ( inEdge ) {
-        auto inEdgeDst = inEdge->get_dst().lock();
-        if ( !inEdgeDst ||
-             inEdgeDst != node ) // In edge destination should point to target node
-            inEdge->set_dst( node );
-        config_t::template container_adapter< weak_edges_t >::insert( inEdgePtr, _in_edges );
-        if ( !inEdge->get_src().expired() ) {
-            config_t::template container_adapter< weak_nodes_t >::insert( inEdge->get_src(), _in_nodes );
-            this->notify_in_node_inserted( weak_node_t{node}, inEdge->get_src(), inEdgePtr );
-        }
+auto node<config_t>::add_in_edge( const weak_edge_t& inEdgePtr ) -> void
+{
+    const auto inEdge = inEdgePtr.lock();
+    assert_throw( inEdge != nullptr, "gtpo::node<>::add_in_edge(): Error: in edge is expired." );
+    const weak_node_t node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
+    if ( inEdge->get_dst().lock().get() != this )   // In edge destination should point to target node
+        inEdge->set_dst( node );
+    const auto& inEdgeSrc = inEdge->get_src();
+    config_t::template container_adapter< weak_edges_t >::insert( inEdgePtr, _in_edges );
+    if ( !inEdgeSrc.expired() ) {
+        _in_nodes.insert( inEdgeSrc );
+        if ( this->_graph == nullptr ||
+             !this->_graph->is_notification_deferred() )
+            this->notify_in_node_inserted( node, inEdgeSrc, inEdgePtr );
     }
 }
 
 template < class config_t >
-auto node<config_t>::remove_out_edge( const weak_edge_t outEdge ) -> void
+auto node<config_t>::remove_out_edge( const weak_edge_t& outEdge ) -> void
 {
-    gtpo::assert_throw( !outEdge.expired(), "gtpo::node<>::remove_out_edge(): Error: Out edge has expired" );
-    auto outEdgePtr = outEdge.lock( );
-    auto outEdgeSrcPtr = outEdgePtr->get_src().lock();
-    weak_node_t node{ std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this()) };
-    gtpo::assert_throw( outEdgeSrcPtr != nullptr &&    // Out edge src must be this node
-                        outEdgeSrcPtr.get() == this, "gtpo::node<>::remove_out_edge(): Error: Out edge source is expired or different from this node.");
+    const auto outEdgePtr = outEdge.lock();
+    gtpo::assert_throw( outEdgePtr != nullptr, "gtpo::node<>::remove_out_edge(): Error: Out edge has expired" );
+    gtpo::assert_throw( outEdgePtr->get_src().lock().get() == this,   // Out edge src must be this node
+                        "gtpo::node<>::remove_out_edge(): Error: Out edge source is expired or different from this node.");
+    const weak_node_t node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
 
-    auto outEdgeDst = outEdgePtr->get_dst().lock();
-    if ( outEdgeDst != nullptr ) {
-        gtpo::assert_throw( outEdgeDst != nullptr, "gtpo::node<>::remove_out_edge(): Error: Out edge destination is expired." );
-        this->notify_out_node_removed( node, outEdgePtr->get_dst(), outEdge );
-    }
+    const auto& outEdgeDst = outEdgePtr->get_dst();
+    const auto outEdgeDstPtr = outEdgeDst.lock();
+    if ( outEdgeDstPtr != nullptr )
+        this->notify_out_node_removed( node, outEdgeDst, outEdge );
+    // Note: index is updated first, outEdge might alias an item of _out_edges
+    _out_edges_index.remove( outEdgeDstPtr.get(), outEdge );
+    _out_nodes.remove( outEdgeDst );
     config_t::template container_adapter<weak_edges_t>::remove( outEdge, _out_edges );
-    config_t::template container_adapter<weak_nodes_t>::remove( outEdgePtr->get_dst(), _out_nodes );
     if ( get_in_degree() == 0 ) {
         graph_t* graph{ this->get_graph() };
         if ( graph != nullptr )
@@ -98,26 +98,134 @@ auto node<config_t>::remove_out_edge( const weak_edge_t outEdge ) -> void
 }
 
 template < class config_t >
-auto node<config_t>::remove_in_edge( const weak_edge_t inEdge ) -> void
+auto node<config_t>::remove_in_edge( const weak_edge_t& inEdge ) -> void
 {
-    gtpo::assert_throw( !inEdge.expired(), "gtpo::node<>::remove_in_edge(): Error: In edge has expired" );
-    auto nodePtr = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
-    auto inEdgePtr = inEdge.lock( );
-    auto inEdgeDstPtr = inEdgePtr->get_dst().lock();
-    gtpo::assert_throw( inEdgeDstPtr &&    // in edge dst must be this node
-                        inEdgeDstPtr == nodePtr, "gtpo::node<>::remove_in_edge(): Error: In edge destination is expired or different from this node.");
+    const auto inEdgePtr = inEdge.lock();
+    gtpo::assert_throw( inEdgePtr != nullptr, "gtpo::node<>::remove_in_edge(): Error: In edge has expired" );
+    gtpo::assert_throw( inEdgePtr->get_dst().lock().get() == this,    // in edge dst must be this node
+                        "gtpo::node<>::remove_in_edge(): Error: In edge destination is expired or different from this node.");
+    const auto& inEdgeSrc = inEdgePtr->get_src();
+    gtpo::assert_throw( !inEdgeSrc.expired(), "gtpo::node<>::remove_in_edge(): Error: In edge source is expired." );
+    const weak_node_t node = std::static_pointer_cast<typename config_t::final_node_t>(this->shared_from_this());
 
-    auto inEdgeSrcPtr = inEdgePtr->get_src().lock();
-    gtpo::assert_throw( inEdgeSrcPtr != nullptr, "gtpo::node<>::remove_in_edge(): Error: In edge source is expired." );
-    this->notify_in_node_removed( weak_node_t{ nodePtr }, inEdgePtr->get_src(), inEdge );
+    this->notify_in_node_removed( node, inEdgeSrc, inEdge );
+    _in_nodes.remove( inEdgeSrc );
     config_t::template container_adapter< weak_edges_t >::remove( inEdge, _in_edges );
-    config_t::template container_adapter< weak_nodes_t >::remove( inEdgePtr->get_src(), _in_nodes );
     if ( get_in_degree() == 0 ) {
         graph_t* graph{ this->get_graph() };
         if ( graph != nullptr )
-            graph->install_root_node( weak_node_t{ nodePtr } );
+            graph->install_root_node( node );
+    }
+    this->notify_in_node_removed( node );
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge( const weak_node_t& dst ) const noexcept -> weak_edge_t
+{
+    return find_out_edge_impl( dst, adjacency_index_enabled_t{} );
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr ) const noexcept -> weak_edge_t
+{
+    return find_out_edge_impl( dst, dst_ptr, adjacency_index_enabled_t{} );
+}
+
+template < class config_t >
+auto node<config_t>::get_out_edge_count( const weak_node_t& dst ) const noexcept -> unsigned int
+{
+    return get_out_edge_count_impl( dst, adjacency_index_enabled_t{} );
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge_impl( const weak_node_t& dst, std::true_type ) const noexcept -> weak_edge_t
+{
+    const auto dst_ptr = dst.lock();
+    if ( !dst_ptr )
+        return weak_edge_t{};
+    const auto edge = _out_edges_index.index.find( dst_ptr.get() );
+    return edge != _out_edges_index.index.end() ? edge->second : weak_edge_t{};
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge_impl( const weak_node_t& dst, std::false_type ) const noexcept -> weak_edge_t
+{
+    if ( dst.expired() )
+        return weak_edge_t{};
+    for ( const auto& out_edge : _out_edges ) {
+        const auto out_edge_ptr = out_edge.lock();
+        if ( out_edge_ptr &&
+             compare_weak_ptr<>( out_edge_ptr->get_dst(), dst ) )
+            return out_edge;
+    }
+    return weak_edge_t{};
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge_impl( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr, std::true_type ) const noexcept -> weak_edge_t
+{
+    static_cast<void>( dst );
+    if ( dst_ptr == nullptr )
+        return weak_edge_t{};
+    const auto edge = _out_edges_index.index.find( dst_ptr );
+    return edge != _out_edges_index.index.end() ? edge->second : weak_edge_t{};
+}
+
+template < class config_t >
+auto node<config_t>::find_out_edge_impl( const weak_node_t& dst, const typename config_t::final_node_t* dst_ptr, std::false_type ) const noexcept -> weak_edge_t
+{
+    return dst_ptr != nullptr ? find_out_edge_impl( dst, std::false_type{} ) : weak_edge_t{};
+}
+
+template < class config_t >
+auto node<config_t>::get_out_edge_count_impl( const weak_node_t& dst, std::true_type ) const noexcept -> unsigned int
+{
+    const auto dst_ptr = dst.lock();
+    return dst_ptr ? static_cast<unsigned int>( _out_edges_index.index.count( dst_ptr.get() ) ) : 0;
+}
+
+template < class config_t >
+auto node<config_t>::get_out_edge_count_impl( const weak_node_t& dst, std::false_type ) const noexcept -> unsigned int
+{
+    if ( dst.expired() )
+        return 0;
+    unsigned int edge_count = 0;
+    for ( const auto& out_edge : _out_edges ) {
+        const auto out_edge_ptr = out_edge.lock();
+        if ( out_edge_ptr &&
+             compare_weak_ptr<>( out_edge_ptr->get_dst(), dst ) )
+            ++edge_count;
+    }
+    return edge_count;
+}
+
+template < class config_t >
+template < class functor_t >
+auto node<config_t>::for_each_out_edge( const typename config_t::final_node_t* dst_ptr, functor_t&& functor ) const -> void
+{
+    if ( dst_ptr != nullptr )
+        for_each_out_edge_impl( dst_ptr, functor, adjacency_index_enabled_t{} );
+}
+
+template < class config_t >
+template < class functor_t >
+auto node<config_t>::for_each_out_edge_impl( const typename config_t::final_node_t* dst_ptr, functor_t& functor, std::true_type ) const -> void
+{
+    const auto range = _out_edges_index.index.equal_range( dst_ptr );
+    for ( auto it = range.first; it != range.second; ++it )
+        functor( it->second );
+}
+
+template < class config_t >
+template < class functor_t >
+auto node<config_t>::for_each_out_edge_impl( const typename config_t::final_node_t* dst_ptr, functor_t& functor, std::false_type ) const -> void
+{
+    for ( const auto& out_edge : _out_edges ) {
+        const auto out_edge_ptr = out_edge.lock();
+        if ( out_edge_ptr &&
+             out_edge_ptr->get_dst().lock().get() == dst_ptr )
+            functor( out_edge );
     }
-    this->notify_in_node_removed( weak_node_t{nodePtr} );
 }
 //-----------------------------------------------------------------------------
 
@@ -127,12 +235,7 @@ auto node<config_t>::has_node( const weak_node_t& node ) const noexcept -> bool
 {
     if ( node.expired() )
         return false;
-    shared_node_t group_node = node.lock();
-    if ( !group_node )
-        return false;
-    auto group_nodeIter = std::find_if( _nodes.begin(), _nodes.end(),
-                                        [=](const weak_node_t& group_node ){ return ( compare_weak_ptr<>( node, group_node ) ); } );
-    return group_nodeIter != _nodes.end();
+    return config_t::template container_adapter<weak_nodes_search_t>::contains( _nodes_search, node );
 }
 //-----------------------------------------------------------------------------
 
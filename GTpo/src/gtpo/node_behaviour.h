@@ -74,27 +74,27 @@ public:
 public:
     /*! \brief Called immediatly after an in-edge with source \c weakInNode has been inserted.
      */
-    void    in_node_inserted( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
+    void    in_node_inserted( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
 
     /*! \brief Called when an in-edge with source \c weakInNode is about to be removed.
      */
-    void    in_node_removed( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
+    void    in_node_removed( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
 
     /*! \brief Called immediatly after an in node has been removed.
      */
-    void    in_node_removed(weak_node_t& target)  noexcept { static_cast<void>(target); }
+    void    in_node_removed( const weak_node_t& target )  noexcept { static_cast<void>(target); }
 
     /*! \brief Called immediatly after an out-edge with destination \c weakOutNode has been inserted.
      */
-    void    out_node_inserted( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
+    void    out_node_inserted( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
 
     /*! \brief Called when an out-edge with destination \c weakOutNode is about to be removed.
      */
-    void    out_node_removed( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
+    void    out_node_removed( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
 
     /*! \brief Called immediatly after an out-edge has been removed.
      */
-    void    out_node_removed(weak_node_t& target)  noexcept { static_cast<void>(target); }
+    void    out_node_removed( const weak_node_t& target )  noexcept { static_cast<void>(target); }
     //@}
     //-------------------------------------------------------------------------
 };
@@ -121,37 +121,37 @@ public:
     using weak_edge_t          = std::weak_ptr<typename config_t::final_edge_t>;
 
 public:
-    void    in_node_inserted( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { on_in_node_inserted(target, weakInNode, edge); }
-    void    in_node_removed( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { on_in_node_removed(target, weakInNode, edge); }
-    void    in_node_removed( weak_node_t& target )  noexcept { on_in_node_removed(target); }
-    void    out_node_inserted( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { on_out_node_inserted(target, weakOutNode, edge); }
-    void    out_node_removed( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { on_out_node_removed(target, weakOutNode, edge); }
-    void    out_node_removed( weak_node_t& target )  noexcept { on_out_node_removed(target); }
+    void    in_node_inserted( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { on_in_node_inserted(target, weakInNode, edge); }
+    void    in_node_removed( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { on_in_node_removed(target, weakInNode, edge); }
+    void    in_node_removed( const weak_node_t& target )  noexcept { on_in_node_removed(target); }
+    void    out_node_inserted( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { on_out_node_inserted(target, weakOutNode, edge); }
+    void    out_node_removed( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { on_out_node_removed(target, weakOutNode, edge); }
+    void    out_node_removed( const weak_node_t& target )  noexcept { on_out_node_removed(target); }
 
 protected:
     /*! \brief Called immediatly after an in-edge with source \c weakInNode has been inserted.
      */
-    virtual void    on_in_node_inserted( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
+    virtual void    on_in_node_inserted( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
 
     /*! \brief Called when an in-edge with source \c weakInNode is about to be removed.
      */
-    virtual void    on_in_node_removed( weak_node_t& target, weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
+    virtual void    on_in_node_removed( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakInNode); static_cast<void>(edge); }
 
     /*! \brief Called immediatly after an in node has been removed.
      */
-    virtual void    on_in_node_removed(weak_node_t& target)  noexcept { static_cast<void>(target); }
+    virtual void    on_in_node_removed( const weak_node_t& target )  noexcept { static_cast<void>(target); }
 
     /*! \brief Called immediatly after an out-edge with destination \c weakOutNode has been inserted.
      */
-    virtual void    on_out_node_inserted( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
+    virtual void    on_out_node_inserted( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
 
     /*! \brief Called when an out-edge with destination \c weakOutNode is about to be removed.
      */
-    virtual void    on_out_node_removed( weak_node_t& target, weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
+    virtual void    on_out_node_removed( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept { static_cast<void>(target); static_cast<void>(weakOutNode); static_cast<void>(edge); }
 
     /*! \brief Called immediatly after an out-edge has been removed.
      */
-    virtual void    on_out_node_removed(weak_node_t& target)  noexcept { static_cast<void>(target); }
+    virtual void    on_out_node_removed( const weak_node_t& target )  noexcept { static_cast<void>(target); }
 };
 
 template <class config_t>
@@ -166,6 +166,8 @@ class behaviourable_node;
 template < class config_t >
 class enable_node_dynamic_behaviour : public gtpo::node_behaviour<config_t>
 {
+    static_assert( config_t::enable_dynamic_behaviours,
+                   "gtpo::enable_node_dynamic_behaviour<>: Error: dynamic behaviours are disabled in config_t (enable_dynamic_behaviours is false)." );
 public:
     enable_node_dynamic_behaviour() noexcept : gtpo::node_behaviour<config_t>{} {}
     ~enable_node_dynamic_behaviour() noexcept = default;
@@ -175,32 +177,32 @@ public:
     using base_t    = gtpo::node_behaviour<config_t>;
 
 public:
-    void    in_node_inserted( weak_node_t target, weak_node_t weakInNode, const weak_edge_t& edge )  noexcept {
+    void    in_node_inserted( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::in_node_inserted, target, weakInNode, edge );
     }
-    void    in_node_removed( weak_node_t target, weak_node_t weakInNode, const weak_edge_t& edge )  noexcept {
+    void    in_node_removed( const weak_node_t& target, const weak_node_t& weakInNode, const weak_edge_t& edge )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::in_node_removed, target, weakInNode, edge );
     }
-    void    in_node_removed(weak_node_t target)  noexcept {
+    void    in_node_removed( const weak_node_t& target )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::in_node_removed, target );
     }
-    void    out_node_inserted( weak_node_t target, weak_node_t weakOutNode, const weak_edge_t& edge )  noexcept {
+    void    out_node_inserted( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::out_node_inserted, target, weakOutNode, edge );
     }
-    void    out_node_removed( weak_node_t target, weak_node_t weakOutNode, const weak_edge_t& edge )  noexcept {
+    void    out_node_removed( const weak_node_t& target, const weak_node_t& weakOutNode, const weak_edge_t& edge )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::out_node_removed, target, weakOutNode, edge );
     }
-    void    out_node_removed(weak_node_t target)  noexcept {
+    void    out_node_removed( const weak_node_t& target )  noexcept {
         auto node = target.lock();
         if ( node )
             node->notify_dynamic_behaviours( &gtpo::dynamic_node_behaviour<config_t>::out_node_removed, target );
@@ -214,7 +216,8 @@ public:
  */
 template < class config_t >
 class behaviourable_node : public behaviourable<gtpo::dynamic_node_behaviour<config_t>,
-                                                typename config_t::node_behaviours
+                                                typename config_t::node_behaviours,
+                                                config_t::enable_dynamic_behaviours
                                                > // gtpo::behaviourable<>
 {
     /*! \name behaviourable_node Object Management *///------------------------
@@ -229,31 +232,32 @@ public:
 
     using dynamic_node_behaviour_t = dynamic_node_behaviour<config_t>;
     using node_static_behaviours_t = typename config_t::node_behaviours;
+    using behaviourable_base = behaviourable<dynamic_node_behaviour_t, node_static_behaviours_t, config_t::enable_dynamic_behaviours>;
 
     /*! \name Notification Helper Methods *///---------------------------------
     //@{
 public:
     inline auto     add_dynamic_node_behaviour( std::unique_ptr<dynamic_node_behaviour_t> behaviour ) -> void {
-        behaviourable<dynamic_node_behaviour_t, node_static_behaviours_t>::add_behaviour(std::move(behaviour));
+        behaviourable_base::add_behaviour(std::move(behaviour));
     }
 
     template < class node_t, class edge_t  >
-    auto    notify_in_node_inserted( node_t target, node_t node, const edge_t& edge ) noexcept -> void;
+    auto    notify_in_node_inserted( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void;
 
     template < class node_t, class edge_t  >
-    auto    notify_in_node_removed( node_t target, node_t node, const edge_t& edge ) noexcept -> void;
+    auto    notify_in_node_removed( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void;
 
     template < class node_t >
-    auto    notify_in_node_removed( node_t target ) noexcept -> void;
+    auto    notify_in_node_removed( const node_t& target ) noexcept -> void;
 
     template < class node_t, class edge_t  >
-    auto    notify_out_node_inserted( node_t target, node_t node, const edge_t& edge ) noexcept -> void;
+    auto    notify_out_node_inserted( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void;
 
     template < class node_t, class edge_t >
-    auto    notify_out_node_removed( node_t target, node_t node, const edge_t& edge ) noexcept -> void;
+    auto    notify_out_node_removed( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void;
 
     template < class node_t >
-    auto    notify_out_node_removed( node_t target ) noexcept -> void;
+    auto    notify_out_node_removed( const node_t& target ) noexcept -> void;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -39,42 +39,42 @@ namespace gtpo { // ::gtpo
 /* Notification Helper Methods *///--------------------------------------------
 template < class config_t >
 template < class node_t, class edge_t >
-auto    behaviourable_node< config_t >::notify_in_node_inserted( node_t target, node_t node, const edge_t& edge ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_in_node_inserted( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.in_node_inserted( target, node, edge ); } );
 }
 
 template < class config_t >
 template < class node_t, class edge_t >
-auto    behaviourable_node< config_t >::notify_in_node_removed( node_t target, node_t node, const edge_t& edge ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_in_node_removed( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.in_node_removed( target, node, edge ); } );
 }
 
 template < class config_t >
 template < class node_t >
-auto    behaviourable_node< config_t >::notify_in_node_removed( node_t target ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_in_node_removed( const node_t& target ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.in_node_removed( target ); } );
 }
 
 template < class config_t >
 template < class node_t, class edge_t >
-auto    behaviourable_node< config_t >::notify_out_node_inserted( node_t target, node_t node, const edge_t& edge ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_out_node_inserted( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.out_node_inserted( target, node, edge ); } );
 }
 
 template < class config_t >
 template < class node_t, class edge_t >
-auto    behaviourable_node< config_t >::notify_out_node_removed( node_t target, node_t node, const edge_t& edge ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_out_node_removed( const node_t& target, const node_t& node, const edge_t& edge ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.out_node_removed( target, node, edge ); } );
 }
 
 template < class config_t >
 template < class node_t >
-auto    behaviourable_node< config_t >::notify_out_node_removed( node_t target ) noexcept -> void
+auto    behaviourable_node< config_t >::notify_out_node_removed( const node_t& target ) noexcept -> void
 {
     this->notify_static_behaviours( [&](auto& behaviour) noexcept { behaviour.out_node_removed(target); } );
 }
@@ -0,0 +1,215 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	parallel.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_parallel_h
+#define gtpo_parallel_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>           // std::unique_ptr
+#include <type_traits>
+
+// GTpo headers
+#include "./csr_view.h"
+
+namespace gtpo { // ::gtpo
+
+namespace impl { // ::gtpo::impl
+
+/*! \brief Reusable thread barrier (std::barrier is not available in C++14).
+ */
+class barrier
+{
+public:
+    explicit barrier(std::size_t count) noexcept : _count{count}, _waiting{0} { }
+    barrier(const barrier&) = delete;
+    barrier& operator=(const barrier&) = delete;
+
+    //! Block until \c count threads have called wait().
+    auto    wait() -> void;
+
+private:
+    std::mutex              _mutex;
+    std::condition_variable _condition;
+    const std::size_t       _count;
+    std::size_t             _waiting;
+    std::size_t             _generation = 0;
+};
+
+/*! \brief Run \c f(thread_index, thread_count, barrier) on \c thread_count threads (calling thread is thread 0) and join them.
+ *
+ * \c barrier is shared by all threads and sized to the effective thread count: if a thread can't be
+ * started, \c f is run on the threads successfully started, it must not assume that \c thread_count
+ * is the requested value.
+ * \note \c f must not throw (an exception in a worker thread call std::terminate()).
+ */
+template <class functor_t>
+auto    parallel_run(std::size_t thread_count, functor_t f) -> void;
+
+//! Return \c thread_count, or std::thread::hardware_concurrency() when \c thread_count is 0.
+auto    get_thread_count(std::size_t thread_count) noexcept -> std::size_t;
+
+} // ::gtpo::impl
+
+
+/* Execution Policies *///-----------------------------------------------------
+//! Sequential execution policy tag for GTpo algorithms (C++14 replacement for std::execution::seq).
+struct sequential_policy { };
+
+/*! \brief Parallel execution policy tag for GTpo algorithms (C++14 replacement for std::execution::par).
+ *
+ * Algorithms run on \c thread_count threads (std::thread::hardware_concurrency() when 0).
+ */
+struct parallel_policy
+{
+    std::size_t thread_count = 0;
+};
+
+constexpr sequential_policy seq{};
+constexpr parallel_policy   par{};
+
+//! True if \c T is a GTpo execution policy (used to disambiguate policy overloads).
+template <class T>
+struct is_execution_policy : std::false_type { };
+template <>
+struct is_execution_policy<sequential_policy> : std::true_type { };
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type { };
+//-----------------------------------------------------------------------------
+
+
+/* Parallel Graph Traversal Algorithms *///------------------------------------
+/*! \brief Result of a BFS traversal of a csr_view: per node distance and parent (dense node indexes).
+ *
+ * Unreached nodes have csr_view::invalid_index distance and parent, BFS sources are their own parents.
+ */
+template <class index_t>
+struct bfs_result
+{
+    std::vector<index_t>    distances;
+    std::vector<index_t>    parents;
+};
+
+/*! \brief Level synchronous parallel BFS of a csr_view snapshot \c csr from \c sources dense node indexes.
+ *
+ * Each frontier is split between \c thread_count threads (std::thread::hardware_concurrency() when 0), nodes
+ * are claimed with an atomic compare and swap on their parent, threads synchronize on a barrier at the end
+ * of every level. With \c thread_count == 1, this is a plain sequential BFS.
+ *
+ * \note When a node is reachable from multiple nodes at the same level, its parent might be any of them
+ * (distances are always deterministic).
+ * \note complexity is O(V + E) work.
+ * \throw std::bad_alloc
+ */
+template <class graph_t, class index_t>
+auto    parallel_bfs(const csr_view<graph_t, index_t>& csr,
+                     const std::vector<index_t>& sources,
+                     std::size_t thread_count = 0) -> bfs_result<index_t>;
+
+//! Shortcut to parallel_bfs() from a single \c source dense node index.
+template <class graph_t, class index_t>
+auto    parallel_bfs(const csr_view<graph_t, index_t>& csr,
+                     index_t source,
+                     std::size_t thread_count = 0) -> bfs_result<index_t>;
+
+/*! \brief Level synchronous parallel Kahn topological sort of a csr_view snapshot \c csr, return nodes grouped by level (dense node indexes).
+ *
+ * Level 0 contains nodes with no in edges, a node is in level \c l + 1 when its deepest predecessor is in level \c l:
+ * nodes of a given level are independent and could be processed concurrently. Each level is split between
+ * \c thread_count threads (std::thread::hardware_concurrency() when 0), in degrees are decremented atomically
+ * and the thread reaching zero claim the node, threads synchronize on a barrier at the end of every level.
+ * Nodes are sorted by index inside a level, result is deterministic.
+ *
+ * \note When \c csr contains a circuit, nodes on a circuit (or reachable from a circuit) are not part of
+ * any level: \c csr is a DAG if and only if levels contains csr.get_node_count() nodes.
+ * \note complexity is O(V + E) work, the number of barriers is the number of levels.
+ * \throw std::bad_alloc
+ */
+template <class graph_t, class index_t>
+auto    parallel_topological_levels(const csr_view<graph_t, index_t>& csr,
+                                    std::size_t thread_count = 0) -> std::vector<std::vector<index_t>>;
+
+/*! \brief Return weakly connected component id of every csr_view snapshot \c csr node (indexed by dense node index).
+ *
+ * Edges are split between \c thread_count threads (std::thread::hardware_concurrency() when 0) and merged in a lock
+ * free union-find: roots are linked with a compare and swap (always under the lowest index root) and paths are
+ * halved during find. Component ids are dense in [0, component count) and numbered by increasing lowest node
+ * index, result is deterministic.
+ *
+ * \note complexity is O(E α(V)) work.
+ * \throw std::bad_alloc
+ * \sa gtpo::strongly_connected_components()
+ */
+template <class graph_t, class index_t>
+auto    weakly_connected_components(const csr_view<graph_t, index_t>& csr,
+                                    std::size_t thread_count = 0) -> std::vector<index_t>;
+//-----------------------------------------------------------------------------
+
+
+/* Parallel Community Detection *///-------------------------------------------
+/*! \brief Parallel label propagation community detection on a csr_view snapshot \c csr, return community id of every node (indexed by dense node index).
+ *
+ * Every node start with its own label, then repeatedly adopt the most frequent label among its in and out neighbours
+ * (edges are considered undirected, ties are broken by keeping actual label, then pseudo randomly) until no label
+ * change or \c max_iterations sweeps. Nodes are split between \c thread_count threads (std::thread::hardware_concurrency()
+ * when 0) updating labels asynchronously in place, threads synchronize on a barrier at the end of every sweep.
+ * Community ids are dense in [0, community count) and numbered by increasing lowest node index.
+ *
+ * \code
+ *   gtpo::csr_view<gtpo::graph<>> csr{g};
+ *   const auto communities = gtpo::parallel_label_propagation(csr);
+ * \endcode
+ *
+ * \note Tie breaking is a hash of node, label and sweep: with \c thread_count == 1 result is deterministic, with
+ * \c thread_count > 1 result might differ between runs (update order between threads is not deterministic).
+ * \note complexity is O(max_iterations * (V + E)) work, memory is O(thread_count * V).
+ * \throw std::bad_alloc
+ */
+template <class graph_t, class index_t>
+auto    parallel_label_propagation(const csr_view<graph_t, index_t>& csr,
+                                   std::size_t max_iterations = 20,
+                                   std::size_t thread_count = 0) -> std::vector<index_t>;
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
+
+#include "./parallel.hpp"
+
+#endif // gtpo_parallel_h
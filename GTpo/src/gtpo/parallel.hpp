@@ -0,0 +1,433 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	parallel.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <algorithm>        // std::min std::max std::sort
+#include <utility>          // std::swap
+#include <cstdint>          // std::uint64_t
+#include <system_error>     // std::system_error
+
+namespace gtpo { // ::gtpo
+
+namespace impl { // ::gtpo::impl
+
+inline auto barrier::wait() -> void
+{
+    std::unique_lock<std::mutex> lock{_mutex};
+    const auto generation = _generation;
+    if ( ++_waiting == _count ) {
+        _waiting = 0;
+        ++_generation;
+        _condition.notify_all();
+    } else
+        _condition.wait(lock, [this, generation]() { return generation != _generation; });
+}
+
+template <class functor_t>
+auto    parallel_run(std::size_t thread_count, functor_t f) -> void
+{
+    if ( thread_count <= 1 ) {
+        barrier single{1};
+        f(std::size_t{0}, std::size_t{1}, single);
+        return;
+    }
+    // Threads wait until the effective thread count is known before running f
+    std::mutex                  mutex;
+    std::condition_variable     condition;
+    bool                        go = false;
+    std::size_t                 effective_thread_count = 1;
+    std::unique_ptr<barrier>    shared_barrier;
+    const auto worker = [&](std::size_t t) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            condition.wait(lock, [&go]() { return go; });
+        }
+        f(t, effective_thread_count, *shared_barrier);
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    try {
+        for ( std::size_t t = 1; t < thread_count; ++t )
+            threads.emplace_back(worker, t);
+    } catch ( const std::system_error& ) { /* Run f on already started threads */ }
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        effective_thread_count = threads.size() + 1;
+        shared_barrier = std::make_unique<barrier>(effective_thread_count);
+        go = true;
+    }
+    condition.notify_all();
+    f(std::size_t{0}, effective_thread_count, *shared_barrier);
+    for ( auto& thread : threads )
+        thread.join();
+}
+
+inline auto get_thread_count(std::size_t thread_count) noexcept -> std::size_t
+{
+    if ( thread_count != 0 )
+        return thread_count;
+    const auto hardware_concurrency = std::thread::hardware_concurrency();
+    return hardware_concurrency != 0 ? hardware_concurrency : 1;
+}
+
+} // ::gtpo::impl
+
+
+/* Parallel Graph Traversal Algorithms *///------------------------------------
+template <class graph_t, class index_t>
+auto    parallel_bfs(const csr_view<graph_t, index_t>& csr,
+                     const std::vector<index_t>& sources,
+                     std::size_t thread_count) -> bfs_result<index_t>
+{
+    // ALGORITHM:
+        // Level synchronous BFS: frontier nodes are statically partitionned between threads, every
+        // thread claim unvisited out nodes with a CAS on their parent and collect them in a local
+        // next frontier. Thread 0 merge local frontiers between two barriers.
+    using csr_t = csr_view<graph_t, index_t>;
+    constexpr index_t invalid = csr_t::invalid_index;
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+
+    bfs_result<index_t> r;
+    r.distances.assign(node_count, invalid);
+    r.parents.assign(node_count, invalid);
+    std::vector<std::atomic<index_t>> parents(node_count);
+    for ( auto& parent : parents )
+        parent.store(invalid, std::memory_order_relaxed);
+
+    std::vector<index_t> frontier;
+    frontier.reserve(node_count);
+    for ( const auto source : sources ) {
+        if ( static_cast<std::size_t>(source) >= node_count ||
+             parents[source].load(std::memory_order_relaxed) != invalid )
+            continue;
+        parents[source].store(source, std::memory_order_relaxed);
+        r.distances[source] = 0;
+        frontier.push_back(source);
+    }
+    if ( frontier.empty() )
+        return r;
+
+    thread_count = std::min(impl::get_thread_count(thread_count), std::max<std::size_t>(1, node_count));
+    std::vector<std::vector<index_t>> next_frontiers(thread_count);
+    index_t level = 0;
+    impl::parallel_run(thread_count, [&](std::size_t t, std::size_t effective_thread_count, impl::barrier& barrier) noexcept {
+        auto& next_frontier = next_frontiers[t];
+        while ( !frontier.empty() ) {
+            const auto frontier_size = frontier.size();
+            const auto first = ( frontier_size * t ) / effective_thread_count;
+            const auto last = ( frontier_size * ( t + 1 ) ) / effective_thread_count;
+            const index_t next_level = level + 1;
+            for ( auto f = first; f < last; ++f ) {
+                const auto n = frontier[f];
+                for ( auto out = csr.out_begin(n); out != csr.out_end(n); ++out ) {
+                    auto expected = invalid;
+                    if ( parents[*out].load(std::memory_order_relaxed) == invalid &&
+                         parents[*out].compare_exchange_strong(expected, n, std::memory_order_relaxed) ) {
+                        r.distances[*out] = next_level;   // Only the claiming thread write distance
+                        next_frontier.push_back(*out);
+                    }
+                }
+            }
+            barrier.wait();
+            if ( t == 0 ) {         // Merge local frontiers
+                frontier.clear();
+                for ( auto& local_frontier : next_frontiers ) {
+                    frontier.insert(frontier.end(), local_frontier.begin(), local_frontier.end());
+                    local_frontier.clear();
+                }
+                ++level;
+            }
+            barrier.wait();
+        }
+    });
+
+    for ( std::size_t n = 0; n < node_count; ++n )
+        r.parents[n] = parents[n].load(std::memory_order_relaxed);
+    return r;
+}
+
+template <class graph_t, class index_t>
+auto    parallel_bfs(const csr_view<graph_t, index_t>& csr,
+                     index_t source,
+                     std::size_t thread_count) -> bfs_result<index_t>
+{
+    return parallel_bfs(csr, std::vector<index_t>{source}, thread_count);
+}
+
+template <class graph_t, class index_t>
+auto    parallel_topological_levels(const csr_view<graph_t, index_t>& csr,
+                                    std::size_t thread_count) -> std::vector<std::vector<index_t>>
+{
+    // ALGORITHM:
+        // Level synchronous Kahn algorithm: frontier (actual level) nodes are statically partitionned
+        // between threads, every thread decrement its out nodes in degree with an atomic fetch_sub, the
+        // thread reaching zero collect the node in its local next level. Thread 0 merge and sort local
+        // levels between two barriers. Levels are stored flat in ordered (level_ends is the end of each level
+        // in ordered) to avoid allocation inside threads.
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<std::vector<index_t>> r;
+    std::vector<std::atomic<index_t>> in_degrees(node_count);
+    std::vector<index_t> frontier;
+    frontier.reserve(node_count);
+    for ( std::size_t n = 0; n < node_count; ++n ) {
+        const auto in_degree = csr.get_in_degree(static_cast<index_t>(n));
+        in_degrees[n].store(in_degree, std::memory_order_relaxed);
+        if ( in_degree == 0 )
+            frontier.push_back(static_cast<index_t>(n));
+    }
+    if ( frontier.empty() )
+        return r;
+    std::vector<index_t> ordered;
+    ordered.reserve(node_count);
+    ordered.insert(ordered.end(), frontier.begin(), frontier.end());
+    std::vector<std::size_t> level_ends;
+    level_ends.reserve(node_count);
+    level_ends.push_back(ordered.size());
+
+    thread_count = std::min(impl::get_thread_count(thread_count), std::max<std::size_t>(1, node_count));
+    std::vector<std::vector<index_t>> next_frontiers(thread_count);
+    for ( auto& next_frontier : next_frontiers )
+        next_frontier.reserve(node_count);
+    impl::parallel_run(thread_count, [&](std::size_t t, std::size_t effective_thread_count, impl::barrier& barrier) noexcept {
+        auto& next_frontier = next_frontiers[t];
+        while ( !frontier.empty() ) {
+            const auto frontier_size = frontier.size();
+            const auto first = ( frontier_size * t ) / effective_thread_count;
+            const auto last = ( frontier_size * ( t + 1 ) ) / effective_thread_count;
+            for ( auto f = first; f < last; ++f ) {
+                const auto n = frontier[f];
+                for ( auto out = csr.out_begin(n); out != csr.out_end(n); ++out )
+                    if ( in_degrees[*out].fetch_sub(1, std::memory_order_acq_rel) == 1 )
+                        next_frontier.push_back(*out);
+            }
+            barrier.wait();
+            if ( t == 0 ) {         // Merge local levels
+                frontier.clear();
+                for ( auto& local_frontier : next_frontiers ) {
+                    frontier.insert(frontier.end(), local_frontier.begin(), local_frontier.end());
+                    local_frontier.clear();
+                }
+                std::sort(frontier.begin(), frontier.end());
+                if ( !frontier.empty() ) {
+                    ordered.insert(ordered.end(), frontier.begin(), frontier.end());
+                    level_ends.push_back(ordered.size());
+                }
+            }
+            barrier.wait();
+        }
+    });
+
+    r.reserve(level_ends.size());
+    std::size_t level_begin = 0;
+    for ( const auto level_end : level_ends ) {
+        r.emplace_back(ordered.begin() + level_begin, ordered.begin() + level_end);
+        level_begin = level_end;
+    }
+    return r;
+}
+
+template <class graph_t, class index_t>
+auto    weakly_connected_components(const csr_view<graph_t, index_t>& csr,
+                                    std::size_t thread_count) -> std::vector<index_t>
+{
+    // ALGORITHM:
+        // Lock free union-find: source nodes are statically partitionned between threads, every
+        // out edge unite its source and target sets. Since a root is always linked under a lower
+        // index root, parent indexes strictly decrease along a path (no circuit can be created by
+        // concurrent links) and a set root is its lowest index node.
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<index_t> r(node_count);
+    if ( node_count == 0 )
+        return r;
+    std::vector<std::atomic<index_t>> parents(node_count);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        parents[n].store(static_cast<index_t>(n), std::memory_order_relaxed);
+    const auto find = [&parents](index_t n) noexcept -> index_t {
+        for ( ;; ) {
+            auto parent = parents[n].load(std::memory_order_relaxed);
+            if ( parent == n )
+                return n;
+            const auto grand_parent = parents[parent].load(std::memory_order_relaxed);
+            if ( parent != grand_parent )       // Path halving
+                parents[n].compare_exchange_weak(parent, grand_parent, std::memory_order_relaxed);
+            n = grand_parent;
+        }
+    };
+    const auto unite = [&parents, &find](index_t a, index_t b) noexcept {
+        for ( ;; ) {
+            a = find(a);
+            b = find(b);
+            if ( a == b )
+                return;
+            if ( a < b )
+                std::swap(a, b);
+            auto expected = a;
+            if ( parents[a].compare_exchange_strong(expected, b, std::memory_order_relaxed) )
+                return;
+        }
+    };
+
+    thread_count = std::min(impl::get_thread_count(thread_count), node_count);
+    impl::parallel_run(thread_count, [&](std::size_t t, std::size_t effective_thread_count, impl::barrier&) noexcept {
+        const auto first = ( node_count * t ) / effective_thread_count;
+        const auto last = ( node_count * ( t + 1 ) ) / effective_thread_count;
+        for ( auto n = first; n < last; ++n ) {
+            const auto source = static_cast<index_t>(n);
+            for ( auto out = csr.out_begin(source); out != csr.out_end(source); ++out )
+                unite(source, *out);
+        }
+    });
+
+    index_t component = 0;      // A set root is visited before any other node of its set
+    for ( std::size_t n = 0; n < node_count; ++n ) {
+        const auto root = find(static_cast<index_t>(n));
+        r[n] = root == static_cast<index_t>(n) ? component++ : r[root];
+    }
+    return r;
+}
+//-----------------------------------------------------------------------------
+
+
+/* Parallel Community Detection *///-------------------------------------------
+template <class graph_t, class index_t>
+auto    parallel_label_propagation(const csr_view<graph_t, index_t>& csr,
+                                   std::size_t max_iterations,
+                                   std::size_t thread_count) -> std::vector<index_t>
+{
+    // ALGORITHM:
+        // Asynchronous label propagation: nodes are statically partitionned between threads, every
+        // thread count its nodes neighbours labels in a thread local counter array (indexed by
+        // label, reset using the list of touched labels) and update node label in place. Ties are
+        // broken with a hash of (node, label, sweep): breaking them by lowest label would flood a
+        // single label across weakly connected communities during first sweeps. Thread 0 check
+        // for convergence between two barriers.
+    using csr_t = csr_view<graph_t, index_t>;
+    constexpr index_t invalid = csr_t::invalid_index;
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<index_t> r(node_count);
+    if ( node_count == 0 )
+        return r;
+    std::vector<std::atomic<index_t>> labels(node_count);
+    std::size_t max_degree = 0;
+    for ( std::size_t n = 0; n < node_count; ++n ) {
+        const auto node = static_cast<index_t>(n);
+        labels[n].store(node, std::memory_order_relaxed);
+        max_degree = std::max(max_degree, static_cast<std::size_t>(csr.get_out_degree(node)) + csr.get_in_degree(node));
+    }
+
+    thread_count = std::min(impl::get_thread_count(thread_count), node_count);
+    std::vector<std::vector<index_t>> counts(thread_count);
+    std::vector<std::vector<index_t>> touched_labels(thread_count);
+    for ( std::size_t t = 0; t < thread_count; ++t ) {     // Avoid allocation inside threads
+        counts[t].assign(node_count, 0);
+        touched_labels[t].reserve(max_degree);
+    }
+    std::atomic<bool>   changed{false};
+    bool                running = max_iterations > 0;
+    std::size_t         iteration = 0;
+    const auto tie_hash = [](std::size_t node, index_t label, std::size_t sweep) noexcept -> std::uint64_t {
+        auto h = ( static_cast<std::uint64_t>(node) * 0x9E3779B97F4A7C15ULL ) ^
+                 ( static_cast<std::uint64_t>(label) + 0xBF58476D1CE4E5B9ULL * ( sweep + 1 ) );
+        h = ( h ^ ( h >> 31 ) ) * 0x94D049BB133111EBULL;      // splitmix64 finalizer
+        return h ^ ( h >> 29 );
+    };
+    impl::parallel_run(thread_count, [&](std::size_t t, std::size_t effective_thread_count, impl::barrier& barrier) noexcept {
+        auto& count = counts[t];
+        auto& touched = touched_labels[t];
+        const auto first = ( node_count * t ) / effective_thread_count;
+        const auto last = ( node_count * ( t + 1 ) ) / effective_thread_count;
+        const auto count_label = [&labels, &count, &touched](index_t neighbour) noexcept {
+            const auto label = labels[neighbour].load(std::memory_order_relaxed);
+            if ( count[label]++ == 0 )
+                touched.push_back(label);
+        };
+        while ( running ) {
+            const auto sweep = iteration;
+            bool local_changed = false;
+            for ( auto n = first; n < last; ++n ) {
+                const auto node = static_cast<index_t>(n);
+                for ( auto out = csr.out_begin(node); out != csr.out_end(node); ++out )
+                    if ( *out != node )
+                        count_label(*out);
+                for ( auto in = csr.in_begin(node); in != csr.in_end(node); ++in )
+                    if ( *in != node )
+                        count_label(*in);
+                if ( touched.empty() )
+                    continue;
+                const auto label = labels[n].load(std::memory_order_relaxed);
+                auto best_label = invalid;
+                index_t best_count = 0;
+                std::uint64_t best_hash = 0;
+                for ( const auto touched_label : touched ) {
+                    const auto touched_count = count[touched_label];
+                    if ( touched_count < best_count )
+                        continue;
+                    const auto hash = tie_hash(n, touched_label, sweep);
+                    if ( touched_count > best_count || hash < best_hash ) {
+                        best_label = touched_label;
+                        best_count = touched_count;
+                        best_hash = hash;
+                    }
+                }
+                if ( count[label] < best_count ) {      // Keep actual label on ties
+                    labels[n].store(best_label, std::memory_order_relaxed);
+                    local_changed = true;
+                }
+                for ( const auto touched_label : touched )
+                    count[touched_label] = 0;
+                touched.clear();
+            }
+            if ( local_changed )
+                changed.store(true, std::memory_order_relaxed);
+            barrier.wait();
+            if ( t == 0 )
+                running = changed.exchange(false, std::memory_order_relaxed) && ++iteration < max_iterations;
+            barrier.wait();
+        }
+    });
+
+    std::vector<index_t> community_ids(node_count, invalid);    // Indexed by label
+    index_t community = 0;
+    for ( std::size_t n = 0; n < node_count; ++n ) {
+        const auto label = labels[n].load(std::memory_order_relaxed);
+        if ( community_ids[label] == invalid )
+            community_ids[label] = community++;
+        r[n] = community_ids[label];
+    }
+    return r;
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
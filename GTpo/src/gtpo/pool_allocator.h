@@ -0,0 +1,167 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	pool_allocator.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_pool_allocator_h
+#define gtpo_pool_allocator_h
+
+// STD headers
+#include <cstddef>          // std::size_t std::max_align_t
+#include <memory>           // std::shared_ptr std::make_shared
+#include <new>              // std::bad_alloc
+#include <vector>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Memory resource serving fixed size blocks carved out of large chunks, used by gtpo::pool_allocator.
+ *
+ * Requested sizes are rounded up to a multiple of alignof(std::max_align_t) and served from one
+ * free list per rounded size: deallocated blocks are recycled for later allocations of the same size,
+ * memory is given back to the system only when the resource is destroyed.
+ *
+ * \note pool_resource is not thread safe.
+ */
+class pool_resource
+{
+public:
+    explicit pool_resource( std::size_t chunk_size = 64 * 1024 ) noexcept : _chunk_size{chunk_size} { }
+    ~pool_resource() noexcept {
+        for ( auto chunk : _chunks )
+            ::operator delete( chunk );
+    }
+    pool_resource( const pool_resource& ) = delete;
+    pool_resource& operator=( const pool_resource& ) = delete;
+
+    //! Allocate a block of at least \c bytes bytes (aligned on std::max_align_t), throw std::bad_alloc on failure.
+    auto    allocate( std::size_t bytes ) -> void* {
+        const auto bucket = get_bucket( bytes );
+        if ( bucket < _free_lists.size() &&
+             _free_lists[bucket] != nullptr ) {     // Recycle a previously deallocated block
+            auto block = _free_lists[bucket];
+            _free_lists[bucket] = block->next;
+            return block;
+        }
+        const auto block_size = ( bucket + 1 ) * block_alignment;
+        if ( _chunk_left < block_size ) {         // Rest of the current chunk is lost
+            const auto chunk_size = block_size > _chunk_size ? block_size : _chunk_size;
+            _chunks.reserve( _chunks.size() + 1 );
+            _chunk = static_cast<char*>( ::operator new( chunk_size ) );
+            _chunks.push_back( _chunk );
+            _chunk_left = chunk_size;
+        }
+        auto block = _chunk;
+        _chunk += block_size;
+        _chunk_left -= block_size;
+        return block;
+    }
+
+    //! Give back a block of \c bytes bytes allocated with allocate() to its free list.
+    auto    deallocate( void* p, std::size_t bytes ) noexcept -> void {
+        if ( p == nullptr )
+            return;
+        const auto bucket = get_bucket( bytes );
+        if ( bucket >= _free_lists.size() ) {
+            try {
+                _free_lists.resize( bucket + 1, nullptr );
+            } catch ( ... ) { return; }     // Block is lost until resource destruction
+        }
+        auto block = static_cast<free_block*>( p );
+        block->next = _free_lists[bucket];
+        _free_lists[bucket] = block;
+    }
+
+private:
+    struct free_block { free_block* next; };
+    static constexpr std::size_t block_alignment = alignof(std::max_align_t);
+    static inline auto  get_bucket( std::size_t bytes ) noexcept -> std::size_t {
+        return bytes == 0 ? 0 : ( bytes - 1 ) / block_alignment;
+    }
+
+    std::size_t                 _chunk_size = 64 * 1024;
+    char*                       _chunk = nullptr;
+    std::size_t                 _chunk_left = 0;
+    std::vector<char*>          _chunks;
+    std::vector<free_block*>    _free_lists;
+};
+
+/*! \brief Standard allocator allocating from a shared gtpo::pool_resource.
+ *
+ * A default constructed pool_allocator create its own pool_resource, copies (including rebound copies)
+ * share it: std::allocate_shared() store an allocator copy in the control block, so the resource
+ * lives until the last primitive allocated from it is destroyed.
+ *
+ * Use it in a custom GTpo configuration to allocate nodes and edges (and their shared_ptr control
+ * blocks) from per graph pools:
+ * \code
+ *   struct pool_config : public gtpo::config<pool_config> {
+ *       template <class T>
+ *       using node_allocator_t = gtpo::pool_allocator<T>;
+ *       template <class T>
+ *       using edge_allocator_t = gtpo::pool_allocator<T>;
+ *   };
+ * \endcode
+ * \note Not thread safe: primitives sharing a resource should not be allocated or destroyed concurrently.
+ */
+template <class T>
+class pool_allocator
+{
+public:
+    using value_type = T;
+
+    pool_allocator() : _resource{ std::make_shared<pool_resource>() } { }
+    explicit pool_allocator( std::shared_ptr<pool_resource> resource ) noexcept : _resource{ std::move(resource) } { }
+    template <class U>
+    pool_allocator( const pool_allocator<U>& other ) noexcept : _resource{ other.get_resource() } { }
+
+    auto    allocate( std::size_t n ) -> T* {
+        static_assert( alignof(T) <= alignof(std::max_align_t), "gtpo::pool_allocator<>: over-aligned types are not supported." );
+        return static_cast<T*>( _resource->allocate( n * sizeof(T) ) );
+    }
+    auto    deallocate( T* p, std::size_t n ) noexcept -> void { _resource->deallocate( p, n * sizeof(T) ); }
+
+    inline auto get_resource() const noexcept -> const std::shared_ptr<pool_resource>& { return _resource; }
+
+private:
+    std::shared_ptr<pool_resource>  _resource;
+};
+
+template <class T, class U>
+inline bool operator==( const pool_allocator<T>& lhs, const pool_allocator<U>& rhs ) noexcept { return lhs.get_resource() == rhs.get_resource(); }
+
+template <class T, class U>
+inline bool operator!=( const pool_allocator<T>& lhs, const pool_allocator<U>& rhs ) noexcept { return !( lhs == rhs ); }
+
+} // ::gtpo
+
+#endif // gtpo_pool_allocator_h
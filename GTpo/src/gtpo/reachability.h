@@ -0,0 +1,153 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	reachability.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_reachability_h
+#define gtpo_reachability_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <vector>
+
+// GTpo headers
+#include "./csr_view.h"
+#include "./algorithm.h"     // gtpo::strongly_connected_components()
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Reachability index answering "is \c target reachable from \c source" queries on a csr_view snapshot.
+ *
+ * Index is built on the condensation of \c csr (strongly connected components collapsed, see
+ * gtpo::strongly_connected_components()), nodes in the same component are mutually reachable. Components
+ * are then labelled with:
+ * \li A topological rank: component ids are a reverse topological order, a component can only reach
+ *     components with a lower id (negative cut).
+ * \li A spanning forest pre-order interval: a component inside the tree interval of another one is
+ *     reachable (positive cut, exact for trees and forests).
+ * \li \c labelings GRAIL intervals [min descendant post-order rank, post-order rank] computed with
+ *     randomized child orders: a component whose interval is not contained in another component
+ *     interval is not reachable (negative cut).
+ *
+ * Queries not resolved by labels fall back to a DFS pruned with the same labels. Most queries on
+ * sparse graphs are answered in O(labelings), index memory is O(V + E).
+ *
+ * \code
+ *   gtpo::reachability_index<gtpo::graph<>> reachability{g.snapshot()->get_csr()};
+ *   const auto& csr = g.snapshot()->get_csr();
+ *   if ( reachability.is_reachable(csr.index_of(n1), csr.index_of(n2)) )
+ *       ;  // n2 is n1 descendant: inserting n2 -> n1 would create a circuit
+ * \endcode
+ *
+ * \note Index is a snapshot, it must be rebuilt when source topology revision change.
+ * \note is_reachable() use internal scratch storage, concurrent queries on the same index are not supported.
+ */
+template <class graph_t, class index_type = std::uint32_t>
+class reachability_index
+{
+    /*! \name Reachability Index Management *///-------------------------------
+    //@{
+public:
+    using csr_t     = gtpo::csr_view<graph_t, index_type>;
+    using index_t   = index_type;
+    static constexpr index_t    invalid_index = csr_t::invalid_index;
+    //! Number of GRAIL interval labelings (default).
+    static constexpr std::size_t default_labelings = 2;
+
+    reachability_index() noexcept = default;
+    explicit reachability_index(const csr_t& csr, std::size_t labelings = default_labelings) { rebuild(csr, labelings); }
+    ~reachability_index() noexcept = default;
+    reachability_index(const reachability_index&) = default;
+    reachability_index& operator=(const reachability_index&) = default;
+    reachability_index(reachability_index&&) noexcept = default;
+    reachability_index& operator=(reachability_index&&) noexcept = default;
+
+    /*! \brief Rebuild index from \c csr snapshot.
+     *
+     * Complexity is O(labelings * (V + E)), internal storage is reused between calls.
+     * \note May throw std::bad_alloc
+     */
+    auto    rebuild(const csr_t& csr, std::size_t labelings = default_labelings) -> void;
+
+    //! Clear the index.
+    auto    clear() noexcept -> void;
+
+    //! Return the number of nodes indexed.
+    inline auto get_node_count() const noexcept -> index_t { return static_cast<index_t>(_components.size()); }
+    //! Return the number of strongly connected components of indexed snapshot.
+    inline auto get_component_count() const noexcept -> index_t { return static_cast<index_t>(_tree_pre.size()); }
+    //! Return node \c n strongly connected component id (no bound checking).
+    inline auto get_component(index_t n) const noexcept -> index_t { return _components[n]; }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Reachability Queries *///----------------------------------------
+    //@{
+public:
+    /*! \brief Return true if a directed path exist from \c source to \c target (dense csr indexes).
+     *
+     * A node is reachable from itself. Return false if an index is out of range.
+     */
+    auto    is_reachable(index_t source, index_t target) const noexcept -> bool;
+
+private:
+    //! Return true if component \c target might be reachable from \c source (false when labels prove it is not).
+    inline auto may_reach(index_t source, index_t target) const noexcept -> bool;
+    //! Return true if component \c target is in \c source spanning forest subtree.
+    inline auto tree_reach(index_t source, index_t target) const noexcept -> bool {
+        return _tree_pre[source] <= _tree_pre[target] &&
+               _tree_pre[target] < _tree_pre[source] + _tree_size[source];
+    }
+
+private:
+    std::vector<index_t>        _components;    // Node -> component
+    std::vector<std::size_t>    _offsets;       // Condensation out adjacency (CSR, deduplicated)
+    std::vector<index_t>        _targets;
+    std::vector<index_t>        _tree_pre;      // Spanning forest pre-order rank and subtree size
+    std::vector<index_t>        _tree_size;
+    std::size_t                 _labelings = 0;
+    std::vector<index_t>        _lows;          // labelings * components GRAIL intervals [low, post]
+    std::vector<index_t>        _posts;
+    // Pruned DFS scratch (visit marks are generation stamps, never cleared)
+    mutable std::vector<std::uint32_t>  _marks;
+    mutable std::uint32_t               _generation = 0;
+    mutable std::vector<index_t>        _stack;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::gtpo
+
+#include "./reachability.hpp"
+
+#endif // gtpo_reachability_h
@@ -0,0 +1,226 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	reachability.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <algorithm>        // std::max std::sort std::unique
+#include <utility>          // std::pair
+
+namespace gtpo { // ::gtpo
+
+/* Reachability Index Management *///------------------------------------------
+template <class graph_t, class index_type>
+auto    reachability_index<graph_t, index_type>::rebuild(const csr_t& csr, std::size_t labelings) -> void
+{
+    // ALGORITHM:
+        // 1. Collapse strongly connected components.
+        // 2. Build condensation DAG out adjacency (without self loops and parallel edges).
+        // 3. For every labeling, run a DFS from condensation roots with a rotated child order: component
+        //    post-order rank is assigned on finish, low is the min of its post rank and its children lows
+        //    (all children are finished first in a DAG). First labeling also record spanning forest
+        //    pre-order intervals.
+    clear();
+    const auto node_count = csr.get_node_count();
+    if ( node_count == 0 )
+        return;
+    _components = gtpo::strongly_connected_components(csr);     // 1.
+    index_t component_count = 0;
+    for ( const auto c : _components )
+        component_count = std::max(component_count, static_cast<index_t>(c + 1));
+
+    _offsets.assign(static_cast<std::size_t>(component_count) + 1, 0);     // 2.
+    for ( index_t n = 0; n < node_count; ++n )
+        for ( auto t = csr.out_begin(n); t != csr.out_end(n); ++t )
+            if ( _components[n] != _components[*t] )
+                ++_offsets[_components[n] + 1];
+    for ( index_t c = 0; c < component_count; ++c )
+        _offsets[c + 1] += _offsets[c];
+    _targets.resize(_offsets.back());
+    {
+        std::vector<std::size_t> positions(_offsets.begin(), _offsets.end() - 1);
+        for ( index_t n = 0; n < node_count; ++n )
+            for ( auto t = csr.out_begin(n); t != csr.out_end(n); ++t )
+                if ( _components[n] != _components[*t] )
+                    _targets[positions[_components[n]]++] = _components[*t];
+    }
+    std::vector<index_t> in_degrees(component_count, 0);
+    std::size_t size = 0;
+    for ( index_t c = 0; c < component_count; ++c ) {
+        const auto begin = _targets.begin() + static_cast<std::ptrdiff_t>(_offsets[c]);
+        auto end = _targets.begin() + static_cast<std::ptrdiff_t>(_offsets[c + 1]);
+        std::sort(begin, end);
+        end = std::unique(begin, end);
+        _offsets[c] = size;
+        for ( auto t = begin; t != end; ++t ) {
+            _targets[size++] = *t;
+            ++in_degrees[*t];
+        }
+    }
+    _offsets[component_count] = size;
+    _targets.resize(size);
+
+    std::vector<index_t> roots;     // 3.
+    for ( index_t c = component_count; c-- > 0; )     // Note: highest ids are upstream
+        if ( in_degrees[c] == 0 )
+            roots.push_back(c);
+    _labelings = std::max<std::size_t>(labelings, 1);
+    _tree_pre.assign(component_count, 0);
+    _tree_size.assign(component_count, 0);
+    _lows.assign(_labelings * component_count, 0);
+    _posts.assign(_labelings * component_count, 0);
+    _marks.assign(component_count, 0);
+    _generation = 0;
+    std::vector<char> visited;
+    std::vector<std::pair<index_t, std::size_t>> s;     // (component, visited children count)
+    for ( std::size_t l = 0; l < _labelings; ++l ) {
+        const auto lows = _lows.data() + l * component_count;
+        const auto posts = _posts.data() + l * component_count;
+        visited.assign(component_count, 0);
+        index_t pre = 0;
+        index_t post = 0;
+        const auto rotation = [l](index_t c, std::size_t degree) -> std::size_t {
+            return degree == 0 ? 0 : ( l * 7919 + static_cast<std::size_t>(c) * l ) % degree;
+        };
+        const auto root_count = roots.size();
+        for ( std::size_t r = 0; r < root_count; ++r ) {
+            const auto root = roots[( r + l * 31 ) % root_count];
+            visited[root] = 1;
+            if ( l == 0 )
+                _tree_pre[root] = pre++;
+            s.emplace_back(root, 0);
+            while ( !s.empty() ) {
+                auto& top = s.back();
+                const auto c = top.first;
+                const auto degree = _offsets[c + 1] - _offsets[c];
+                if ( top.second < degree ) {
+                    const auto child = _targets[_offsets[c] + ( top.second++ + rotation(c, degree) ) % degree];
+                    if ( visited[child] == 0 ) {
+                        visited[child] = 1;
+                        if ( l == 0 )
+                            _tree_pre[child] = pre++;
+                        s.emplace_back(child, 0);   // Warning: top is invalidated
+                    }
+                    continue;
+                }
+                s.pop_back();
+                posts[c] = post++;
+                auto low = posts[c];
+                for ( auto t = _offsets[c]; t != _offsets[c + 1]; ++t )
+                    low = std::min(low, lows[_targets[t]]);
+                lows[c] = low;
+                if ( l == 0 )
+                    _tree_size[c] = pre - _tree_pre[c];
+            }
+        }
+    }
+}
+
+template <class graph_t, class index_type>
+auto    reachability_index<graph_t, index_type>::clear() noexcept -> void
+{
+    _components.clear();
+    _offsets.clear();
+    _targets.clear();
+    _tree_pre.clear();
+    _tree_size.clear();
+    _labelings = 0;
+    _lows.clear();
+    _posts.clear();
+    _marks.clear();
+    _generation = 0;
+    _stack.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Reachability Queries *///---------------------------------------------------
+template <class graph_t, class index_type>
+auto    reachability_index<graph_t, index_type>::may_reach(index_t source, index_t target) const noexcept -> bool
+{
+    if ( source == target )
+        return true;
+    if ( source < target )      // Component ids are a reverse topological order
+        return false;
+    const auto component_count = static_cast<std::size_t>(get_component_count());
+    for ( std::size_t l = 0; l < _labelings; ++l ) {
+        const auto o = l * component_count;
+        if ( _lows[o + source] > _lows[o + target] ||
+             _posts[o + target] > _posts[o + source] )
+            return false;
+    }
+    return true;
+}
+
+template <class graph_t, class index_type>
+auto    reachability_index<graph_t, index_type>::is_reachable(index_t source, index_t target) const noexcept -> bool
+{
+    if ( source >= get_node_count() ||
+         target >= get_node_count() )
+        return false;
+    const auto s = _components[source];
+    const auto t = _components[target];
+    if ( s == t )
+        return true;
+    if ( !may_reach(s, t) )
+        return false;
+    if ( tree_reach(s, t) )
+        return true;
+    // Labels are not conclusive: DFS on condensation, pruning components that can't reach target
+    if ( ++_generation == 0 ) {     // Stamps wrapped, reset marks
+        std::fill(_marks.begin(), _marks.end(), 0);
+        _generation = 1;
+    }
+    _stack.clear();
+    _stack.push_back(s);
+    _marks[s] = _generation;
+    while ( !_stack.empty() ) {
+        const auto c = _stack.back();
+        _stack.pop_back();
+        for ( auto e = _offsets[c]; e != _offsets[c + 1]; ++e ) {
+            const auto child = _targets[e];
+            if ( child == t )
+                return true;
+            if ( _marks[child] == _generation )
+                continue;
+            _marks[child] = _generation;
+            if ( !may_reach(child, t) )
+                continue;
+            if ( tree_reach(child, t) )
+                return true;
+            _stack.push_back(child);
+        }
+    }
+    return false;
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
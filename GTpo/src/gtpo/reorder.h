@@ -0,0 +1,79 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	reorder.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_reorder_h
+#define gtpo_reorder_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <algorithm>        // std::stable_sort std::reverse
+
+// GTpo headers
+#include "./csr_view.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \name Node Reordering *///-------------------------------------------------
+//@{
+
+//! Node ordering policy used by gtpo::graph::reorder() and gtpo::reorder_permutation().
+enum class reorder_policy {
+    //! Breadth first order from root nodes (then from remaining unvisited nodes), following out edges.
+    bfs,
+    /*! Reverse Cuthill-McKee order (edges considered undirected), minimize adjacency bandwidth: nodes
+     * adjacent in the graph get close dense indexes.
+     */
+    reverse_cuthill_mckee,
+    //! Decreasing (in + out) degree order, hubs first.
+    degree
+};
+
+/*! \brief Compute a node permutation of csr_view snapshot \c csr following \c policy.
+ *
+ * Result \c r contains every \c csr dense node index exactly once, \c r[i] is the actual index of the
+ * node that should be moved to position \c i. Complexity is O(V + E) for bfs, O(V log(V) + E log(dmax))
+ * for reverse_cuthill_mckee and O(V log(V)) for degree.
+ * \note May throw std::bad_alloc
+ */
+template <class graph_t, class index_t>
+auto    reorder_permutation(const csr_view<graph_t, index_t>& csr, reorder_policy policy) -> std::vector<index_t>;
+//@}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
+
+#include "./reorder.hpp"
+
+#endif // gtpo_reorder_h
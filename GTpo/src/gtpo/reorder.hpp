@@ -0,0 +1,153 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	reorder.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+namespace gtpo { // ::gtpo
+
+namespace impl { // ::gtpo::impl
+
+template <class graph_t, class index_t>
+auto    reorder_bfs(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<index_t> order;
+    order.reserve(node_count);
+    std::vector<bool> visited(node_count, false);
+    const auto visit_from = [&csr, &order, &visited](index_t start) {
+        if ( visited[start] )
+            return;
+        visited[start] = true;
+        auto head = order.size();
+        order.push_back(start);
+        for ( ; head < order.size(); ++head ) {     // order is used as the BFS queue
+            const auto node = order[head];
+            for ( auto target = csr.out_begin(node); target != csr.out_end(node); ++target )
+                if ( !visited[*target] ) {
+                    visited[*target] = true;
+                    order.push_back(*target);
+                }
+        }
+    };
+    for ( const auto root : csr.get_root_nodes() )
+        visit_from(root);
+    for ( std::size_t n = 0; n < node_count; ++n )  // Nodes only reachable from a circuit
+        visit_from(static_cast<index_t>(n));
+    return order;
+}
+
+template <class graph_t, class index_t>
+auto    reorder_reverse_cuthill_mckee(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    // ALGORITHM:
+        // 1. Build an undirected adjacency (out targets + in sources) CSR.
+        // 2. Sort start candidates by increasing degree.
+        // 3. For every unvisited candidate BFS, appending unvisited neighbours by increasing degree.
+        // 4. Reverse the resulting Cuthill-McKee order.
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+
+    // 1.
+    std::vector<std::size_t> offsets(node_count + 1, 0);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        offsets[n + 1] = offsets[n] + csr.get_out_degree(static_cast<index_t>(n)) + csr.get_in_degree(static_cast<index_t>(n));
+    std::vector<index_t> neighbours(offsets[node_count]);
+    std::vector<std::size_t> cursors(offsets.cbegin(), offsets.cend() - 1);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        for ( auto target = csr.out_begin(static_cast<index_t>(n)); target != csr.out_end(static_cast<index_t>(n)); ++target ) {
+            neighbours[cursors[n]++] = *target;
+            neighbours[cursors[*target]++] = static_cast<index_t>(n);
+        }
+    const auto degree = [&offsets](index_t n) { return offsets[n + 1] - offsets[n]; };
+    const auto by_degree = [&degree](index_t a, index_t b) { return degree(a) < degree(b); };
+
+    // 2.
+    std::vector<index_t> candidates(node_count);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        candidates[n] = static_cast<index_t>(n);
+    std::stable_sort(candidates.begin(), candidates.end(), by_degree);
+
+    // 3.
+    std::vector<index_t> order;
+    order.reserve(node_count);
+    std::vector<bool> visited(node_count, false);
+    for ( const auto start : candidates ) {
+        if ( visited[start] )
+            continue;
+        visited[start] = true;
+        auto head = order.size();
+        order.push_back(start);
+        for ( ; head < order.size(); ++head ) {
+            const auto node = order[head];
+            const auto first = order.size();
+            for ( auto n = offsets[node]; n < offsets[node + 1]; ++n )
+                if ( !visited[neighbours[n]] ) {
+                    visited[neighbours[n]] = true;
+                    order.push_back(neighbours[n]);
+                }
+            std::stable_sort(order.begin() + first, order.end(), by_degree);
+        }
+    }
+
+    // 4.
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+template <class graph_t, class index_t>
+auto    reorder_degree(const csr_view<graph_t, index_t>& csr) -> std::vector<index_t>
+{
+    const auto node_count = static_cast<std::size_t>(csr.get_node_count());
+    std::vector<index_t> order(node_count);
+    for ( std::size_t n = 0; n < node_count; ++n )
+        order[n] = static_cast<index_t>(n);
+    std::stable_sort(order.begin(), order.end(), [&csr](index_t a, index_t b) {
+        return csr.get_out_degree(a) + csr.get_in_degree(a) > csr.get_out_degree(b) + csr.get_in_degree(b);
+    });
+    return order;
+}
+
+} // ::gtpo::impl
+
+/* Node Reordering *///---------------------------------------------------------
+template <class graph_t, class index_t>
+auto    reorder_permutation(const csr_view<graph_t, index_t>& csr, reorder_policy policy) -> std::vector<index_t>
+{
+    switch ( policy ) {
+    case reorder_policy::reverse_cuthill_mckee: return impl::reorder_reverse_cuthill_mckee(csr);
+    case reorder_policy::degree:                return impl::reorder_degree(csr);
+    case reorder_policy::bfs:
+    default:                                    return impl::reorder_bfs(csr);
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
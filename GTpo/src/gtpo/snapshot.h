@@ -0,0 +1,99 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	snapshot.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_snapshot_h
+#define gtpo_snapshot_h
+
+// STD headers
+#include <cstdint>          // std::uint64_t
+
+// GTpo headers
+#include "./csr_view.h"
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Immutable, thread shareable, index based copy of a gtpo::graph topology.
+ *
+ * A graph_snapshot is created with graph::snapshot() on the thread owning the graph, it is then
+ * never modified and can be read concurrently from any thread (for example to run DAG checks,
+ * reachability or layout algorithms on a worker thread without stalling the GUI thread). Results
+ * should be expressed with snapshot dense node indexes and mapped back to graph nodes with
+ * get_csr().get_node() on the graph thread.
+ *
+ * \code
+ *   auto snapshot = g.snapshot();      // GUI thread, O(1) if topology did not change since last snapshot
+ *   std::thread worker{[snapshot]() {
+ *       const auto order = gtpo::linearize_dfs(snapshot->get_csr());
+ *       // ... post result to GUI thread
+ *   }};
+ * \endcode
+ *
+ * \note Snapshot weak nodes must only be locked on the graph thread: a node destroyed from a worker
+ * thread last reference would be destroyed outside of its owner thread.
+ */
+template <class graph_t>
+class graph_snapshot
+{
+    /*! \name Graph Snapshot Management *///-----------------------------------
+    //@{
+public:
+    using csr_t     = gtpo::csr_view<graph_t>;
+    using index_t   = typename csr_t::index_t;
+
+    explicit graph_snapshot(const graph_t& graph) :
+        _revision{graph.get_topology_revision()},
+        _csr{graph} { }
+    ~graph_snapshot() noexcept = default;
+    graph_snapshot(const graph_snapshot&) = delete;
+    graph_snapshot& operator=(const graph_snapshot&) = delete;
+
+    //! Source graph topology revision when this snapshot was taken.
+    inline auto get_revision() const noexcept -> std::uint64_t { return _revision; }
+    //! Snapshot topology (dense node indexes follow source graph get_nodes() order).
+    inline auto get_csr() const noexcept -> const csr_t& { return _csr; }
+    //! Shortcut to get_csr().get_node_count().
+    inline auto get_node_count() const noexcept -> index_t { return _csr.get_node_count(); }
+    //! Shortcut to get_csr().get_edge_count().
+    inline auto get_edge_count() const noexcept -> std::size_t { return _csr.get_edge_count(); }
+
+private:
+    const std::uint64_t _revision;
+    const csr_t         _csr;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::gtpo
+
+#endif // gtpo_snapshot_h
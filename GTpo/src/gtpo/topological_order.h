@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	topological_order.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_topological_order_h
+#define gtpo_topological_order_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <vector>
+#include <memory>           // std::shared_ptr std::weak_ptr
+#include <unordered_map>
+#include <unordered_set>
+
+// GTpo headers
+#include "./config.h"
+#include "./graph_behaviour.h"
+
+namespace gtpo { // ::gtpo
+
+template <class config_t>
+class graph;
+
+/*! \brief Dynamic graph behaviour maintaining an incremental topological order of graph nodes.
+ *
+ * Order is maintained on edge insertion using Pearce-Kelly dynamic topological sort: inserting
+ * an edge that already respect the actual order is O(1), otherwise only nodes in the "affected
+ * region" (between edge destination and source in the order) are visited and reordered.
+ *
+ * would_create_cycle() use the same bounded search to detect if an edge would close a circuit
+ * _before_ it is inserted, it allow to maintain a DAG interactively without calling is_dag() on the
+ * whole graph for every insertion.
+ *
+ * \code
+ *   using graph_t = gtpo::graph<>;
+ *   graph_t g;
+ *   auto order = std::make_unique<gtpo::topological_order_behaviour<gtpo::default_config>>();
+ *   auto order_ptr = order.get();
+ *   g.add_dynamic_graph_behaviour(std::move(order));
+ *   // ... create nodes
+ *   if ( !order_ptr->would_create_cycle(n1, n2) )
+ *      g.create_edge(n1, n2);
+ * \endcode
+ *
+ * \note Behaviour must be installed on an empty graph, or reset() must be called after installation
+ * to take existing nodes and edges into account.
+ * \note When an edge closing a circuit is inserted anyway, behaviour is no longer acyclic (see is_acyclic()):
+ * would_create_cycle() then fall back to an unbounded search until the circuit is removed, order is
+ * lazily rebuilt after edge or node removal.
+ * \note A batch insertion (graph::insert_edges()) trigger a full O(V+E) rebuild.
+ * \note Disabled behaviour ignore topology changes, call reset() after enabling it back.
+ */
+template <class config_t = gtpo::default_config>
+class topological_order_behaviour : public gtpo::dynamic_graph_behaviour<config_t>
+{
+    /*! \name Topological Order Management *///--------------------------------
+    //@{
+public:
+    using graph_t       = gtpo::graph<config_t>;
+    using node_t        = typename config_t::final_node_t;
+    using weak_node_t   = typename gtpo::dynamic_graph_behaviour<config_t>::weak_node_t;
+    using weak_edge_t   = typename gtpo::dynamic_graph_behaviour<config_t>::weak_edge_t;
+    using weak_nodes_t  = typename gtpo::dynamic_graph_behaviour<config_t>::weak_nodes_t;
+    using weak_edges_t  = typename gtpo::dynamic_graph_behaviour<config_t>::weak_edges_t;
+    //! Value returned by get_order() for a node that is not part of the order.
+    static constexpr std::size_t    invalid_order = static_cast<std::size_t>(-1);
+
+    topological_order_behaviour() noexcept : gtpo::dynamic_graph_behaviour<config_t>{} { }
+    virtual ~topological_order_behaviour() noexcept = default;
+    topological_order_behaviour(const topological_order_behaviour<config_t>&) = delete;
+    topological_order_behaviour& operator=(const topological_order_behaviour<config_t>&) = delete;
+
+    /*! \brief Rebuild order from \c graph existing nodes and edges in O(V+E).
+     *
+     * \note May throw std::bad_alloc
+     */
+    auto    reset(const graph_t& graph) -> void;
+
+    /*! \brief Return true if inserting an edge from \c source to \c destination would create a circuit.
+     *
+     * Return true for a trivial circuit (\c source == \c destination), false if either
+     * \c source or \c destination is expired or not part of the order.
+     * Complexity is O(1) when edge respect actual order, otherwise bounded by the size of the
+     * affected region.
+     */
+    auto    would_create_cycle(const weak_node_t& source, const weak_node_t& destination) -> bool;
+
+    //! Return false if graph actually contains a circuit (ie an edge closing a circuit has been inserted).
+    auto    is_acyclic() -> bool;
+
+    /*! \brief Return \c node position in actual topological order (invalid_order if \c node is not ordered).
+     *
+     * \note Positions are strictly increasing along any path but are not dense (removed nodes leave holes).
+     */
+    auto    get_order(const weak_node_t& node) const noexcept -> std::size_t;
+
+    //! Return ordered nodes (only meaningfull if is_acyclic() is true).
+    auto    get_ordered_nodes() const -> weak_nodes_t;
+
+    //! Return the number of nodes actually ordered.
+    inline auto get_node_count() const noexcept -> std::size_t { return _positions.size(); }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Notification Interface *///--------------------------------
+    //@{
+protected:
+    virtual void    on_node_inserted( weak_node_t& weakNode ) noexcept override;
+    virtual void    on_node_removed( weak_node_t& weakNode ) noexcept override;
+    virtual void    on_nodes_inserted( weak_nodes_t& weakNodes ) noexcept override;
+    virtual void    on_nodes_removed( weak_nodes_t& weakNodes ) noexcept override;
+    virtual void    on_edge_inserted( weak_edge_t& weakEdge ) noexcept override;
+    virtual void    on_edge_removed( weak_edge_t& weakEdge ) noexcept override;
+    virtual void    on_edges_inserted( weak_edges_t& weakEdges ) noexcept override;
+    virtual void    on_edges_removed( weak_edges_t& weakEdges ) noexcept override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Pearce-Kelly Implementation *///---------------------------------
+    //@{
+private:
+    auto    append_node(const weak_node_t& node) -> void;
+    auto    erase_node(const node_t* node) noexcept -> void;
+    //! Reorder affected region after insertion of edge \c source -> \c destination.
+    auto    insert_edge(const node_t* source, const node_t* destination) -> void;
+    /*! \brief Forward search from \c node visiting nodes with a position lower than \c upper_bound.
+     *
+     * Visited nodes are appended to _forward, return true if \c target is reached.
+     */
+    auto    forward_search(const node_t* node, const node_t* target, std::size_t upper_bound) -> bool;
+    //! Backward search from \c node visiting nodes with a position greater than \c lower_bound.
+    auto    backward_search(const node_t* node, std::size_t lower_bound) -> void;
+    //! Kahn rebuild of the order using actually ordered nodes, update _acyclic.
+    auto    rebuild() -> void;
+    //! Remove holes left by removed nodes when they become too numerous.
+    auto    compact() -> void;
+
+private:
+    //! Node at a given position (expired when a node has been removed).
+    std::vector<weak_node_t>                        _nodes;
+    std::unordered_map<const node_t*, std::size_t>  _positions;
+    std::size_t                                     _holes = 0;
+    bool                                            _acyclic = true;
+    //! Set when topology is modified while graph contains a circuit, order is rebuilt lazily.
+    bool                                            _dirty = false;
+
+    // Scratch buffers reused between searches
+    std::vector<const node_t*>                      _forward;
+    std::vector<const node_t*>                      _backward;
+    std::vector<const node_t*>                      _stack;
+    std::unordered_set<const node_t*>               _visited;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::gtpo
+
+#include "./topological_order.hpp"
+
+#endif // gtpo_topological_order_h
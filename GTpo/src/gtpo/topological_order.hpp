@@ -0,0 +1,427 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	topological_order.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <algorithm>        // std::sort
+
+namespace gtpo { // ::gtpo
+
+/* Topological Order Management *///-------------------------------------------
+template <class config_t>
+constexpr std::size_t   topological_order_behaviour<config_t>::invalid_order;
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::reset(const graph_t& graph) -> void
+{
+    _nodes.clear();
+    _positions.clear();
+    _holes = 0;
+    _nodes.reserve(graph.get_node_count());
+    for ( const auto& node : graph.get_nodes() )
+        append_node(weak_node_t{node});
+    rebuild();
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::would_create_cycle(const weak_node_t& source, const weak_node_t& destination) -> bool
+{
+    const auto source_ptr = source.lock();
+    const auto destination_ptr = destination.lock();
+    if ( !source_ptr ||
+         !destination_ptr )
+        return false;
+    if ( source_ptr == destination_ptr )       // Trivial circuit
+        return true;
+    if ( !_acyclic && _dirty )
+        rebuild();
+    const auto source_position = _positions.find(source_ptr.get());
+    const auto destination_position = _positions.find(destination_ptr.get());
+    if ( source_position == _positions.end() ||
+         destination_position == _positions.end() )
+        return false;
+    // Fast exit: edge respect actual order, it can't close a circuit
+    if ( _acyclic &&
+         source_position->second < destination_position->second )
+        return false;
+
+    // Otherwise, a circuit is created only if source is reachable from destination: when order
+    // is valid, search is bounded to nodes ordered before source.
+    _forward.clear();
+    _visited.clear();
+    return forward_search(destination_ptr.get(), source_ptr.get(),
+                          _acyclic ? source_position->second : invalid_order);
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::is_acyclic() -> bool
+{
+    if ( !_acyclic && _dirty )
+        rebuild();
+    return _acyclic;
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::get_order(const weak_node_t& node) const noexcept -> std::size_t
+{
+    const auto node_ptr = node.lock();
+    if ( !node_ptr )
+        return invalid_order;
+    const auto position = _positions.find(node_ptr.get());
+    return position != _positions.end() ? position->second : invalid_order;
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::get_ordered_nodes() const -> weak_nodes_t
+{
+    weak_nodes_t nodes;
+    nodes.reserve(_positions.size());
+    for ( const auto& node : _nodes )
+        if ( !node.expired() )
+            nodes.push_back(node);
+    return nodes;
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Notification Interface *///-------------------------------------------
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_node_inserted( weak_node_t& weakNode ) noexcept
+{
+    if ( !this->isEnabled() )
+        return;
+    try {
+        append_node(weakNode);
+    } catch (...) { /* Nil: node is then ignored by would_create_cycle() */ }
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_node_removed( weak_node_t& weakNode ) noexcept
+{
+    if ( !this->isEnabled() )
+        return;
+    const auto node = weakNode.lock();
+    if ( node ) {
+        erase_node(node.get());
+        _dirty = !_acyclic;     // Removing a node might remove a circuit
+    }
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_nodes_inserted( weak_nodes_t& weakNodes ) noexcept
+{
+    if ( !this->isEnabled() )
+        return;
+    try {
+        _nodes.reserve(_nodes.size() + weakNodes.size());
+        for ( const auto& weakNode : weakNodes )
+            append_node(weakNode);
+    } catch (...) { /* Nil */ }
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_nodes_removed( weak_nodes_t& weakNodes ) noexcept
+{
+    for ( auto& weakNode : weakNodes )
+        on_node_removed(weakNode);
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_edge_inserted( weak_edge_t& weakEdge ) noexcept
+{
+    if ( !this->isEnabled() )
+        return;
+    const auto edge = weakEdge.lock();
+    if ( !edge )
+        return;
+    const auto source = edge->get_src().lock();
+    const auto destination = edge->get_dst().lock();
+    if ( !source ||
+         !destination )     // Hyper edges are ignored
+        return;
+    try {
+        insert_edge(source.get(), destination.get());
+    } catch (...) {         // Order is no longer reliable, force a rebuild
+        _acyclic = false;
+        _dirty = true;
+    }
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_edge_removed( weak_edge_t& weakEdge ) noexcept
+{
+    static_cast<void>(weakEdge);
+    if ( !this->isEnabled() )
+        return;
+    // Removing an edge never invalidate a topological order, but it might remove a circuit
+    _dirty = !_acyclic;
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_edges_inserted( weak_edges_t& weakEdges ) noexcept
+{
+    static_cast<void>(weakEdges);
+    if ( !this->isEnabled() )
+        return;
+    // Note: edges of the batch are all already present in graph topology: incremental insertion
+    // would search through not yet ordered edges, rebuild the order once.
+    try {
+        rebuild();
+    } catch (...) {
+        _acyclic = false;
+        _dirty = true;
+    }
+}
+
+template <class config_t>
+void    topological_order_behaviour<config_t>::on_edges_removed( weak_edges_t& weakEdges ) noexcept
+{
+    static_cast<void>(weakEdges);
+    if ( !this->isEnabled() )
+        return;
+    _dirty = !_acyclic;
+}
+//-----------------------------------------------------------------------------
+
+/* Pearce-Kelly Implementation *///--------------------------------------------
+template <class config_t>
+auto    topological_order_behaviour<config_t>::append_node(const weak_node_t& node) -> void
+{
+    const auto node_ptr = node.lock();
+    if ( !node_ptr ||
+         _positions.find(node_ptr.get()) != _positions.end() )
+        return;
+    // Note: an inserted node has no edges, it could be ordered anywhere
+    _positions.emplace(node_ptr.get(), _nodes.size());
+    _nodes.push_back(node);
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::erase_node(const node_t* node) noexcept -> void
+{
+    const auto position = _positions.find(node);
+    if ( position == _positions.end() )
+        return;
+    _nodes[position->second].reset();
+    _positions.erase(position);
+    ++_holes;
+    try {
+        compact();
+    } catch (...) { /* Nil: holes are cleaned on next compaction */ }
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::insert_edge(const node_t* source, const node_t* destination) -> void
+{
+    if ( !_acyclic )            // Order is meaningless until the circuit is removed
+        return;
+    if ( source == destination ) {
+        _acyclic = false;
+        return;
+    }
+    const auto source_position = _positions.find(source);
+    const auto destination_position = _positions.find(destination);
+    if ( source_position == _positions.end() ||
+         destination_position == _positions.end() )
+        return;
+    const auto upper_bound = source_position->second;
+    const auto lower_bound = destination_position->second;
+    if ( lower_bound > upper_bound )    // Fast exit: actual order is still valid
+        return;
+
+    // ALGORITHM:
+        // 1. Forward search from destination in the affected region [lower_bound, upper_bound],
+        //    reaching source means the new edge close a circuit.
+        // 2. Backward search from source in the affected region.
+        // 3. Reorder: backward visited nodes take the lowest affected positions, then forward
+        //    visited nodes, relative order inside each set is preserved.
+    _forward.clear();
+    _visited.clear();
+    if ( forward_search(destination, source, upper_bound) ) {
+        _acyclic = false;
+        return;
+    }
+    _backward.clear();
+    backward_search(source, lower_bound);   // Note: _visited is not cleared, forward and backward sets are disjoints
+
+    const auto by_position = [this](const node_t* a, const node_t* b) {
+        return _positions[a] < _positions[b];
+    };
+    std::sort(_backward.begin(), _backward.end(), by_position);
+    std::sort(_forward.begin(), _forward.end(), by_position);
+
+    std::vector<std::size_t> positions;
+    std::vector<weak_node_t> nodes;
+    positions.reserve(_backward.size() + _forward.size());
+    nodes.reserve(_backward.size() + _forward.size());
+    for ( const auto node : _backward ) {
+        positions.push_back(_positions[node]);
+        nodes.push_back(_nodes[_positions[node]]);
+    }
+    for ( const auto node : _forward ) {
+        positions.push_back(_positions[node]);
+        nodes.push_back(_nodes[_positions[node]]);
+    }
+    std::sort(positions.begin(), positions.end());
+    for ( std::size_t i = 0; i < positions.size(); ++i ) {
+        _nodes[positions[i]] = nodes[i];
+        _positions[nodes[i].lock().get()] = positions[i];
+    }
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::forward_search(const node_t* node, const node_t* target, std::size_t upper_bound) -> bool
+{
+    _stack.clear();
+    _stack.push_back(node);
+    _visited.insert(node);
+    while ( !_stack.empty() ) {
+        const auto current = _stack.back();
+        _stack.pop_back();
+        _forward.push_back(current);
+        for ( const auto& out_node : current->get_out_nodes() ) {
+            const auto out_node_ptr = out_node.lock();
+            if ( !out_node_ptr )
+                continue;
+            if ( out_node_ptr.get() == target )
+                return true;
+            const auto position = _positions.find(out_node_ptr.get());
+            if ( position == _positions.end() ||
+                 position->second > upper_bound )       // Outside affected region
+                continue;
+            if ( _visited.insert(out_node_ptr.get()).second )
+                _stack.push_back(out_node_ptr.get());
+        }
+    }
+    return false;
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::backward_search(const node_t* node, std::size_t lower_bound) -> void
+{
+    _stack.clear();
+    _stack.push_back(node);
+    _visited.insert(node);
+    while ( !_stack.empty() ) {
+        const auto current = _stack.back();
+        _stack.pop_back();
+        _backward.push_back(current);
+        for ( const auto& in_node : current->get_in_nodes() ) {
+            const auto in_node_ptr = in_node.lock();
+            if ( !in_node_ptr )
+                continue;
+            const auto position = _positions.find(in_node_ptr.get());
+            if ( position == _positions.end() ||
+                 position->second < lower_bound )       // Outside affected region
+                continue;
+            if ( _visited.insert(in_node_ptr.get()).second )
+                _stack.push_back(in_node_ptr.get());
+        }
+    }
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::rebuild() -> void
+{
+    // ALGORITHM: Kahn topological sort of actually ordered nodes, nodes with equal rank keep
+    // their previous relative order, nodes part of a circuit are appended in their previous order.
+    std::vector<weak_node_t> nodes;
+    nodes.reserve(_positions.size());
+    std::unordered_map<const node_t*, std::size_t> in_degrees;
+    in_degrees.reserve(_positions.size());
+    for ( const auto& node : _nodes ) {
+        const auto node_ptr = node.lock();
+        if ( !node_ptr ||
+             _positions.find(node_ptr.get()) == _positions.end() )
+            continue;
+        std::size_t in_degree = 0;
+        for ( const auto& in_node : node_ptr->get_in_nodes() ) {
+            const auto in_node_ptr = in_node.lock();
+            if ( in_node_ptr &&
+                 _positions.find(in_node_ptr.get()) != _positions.end() )
+                ++in_degree;
+        }
+        in_degrees.emplace(node_ptr.get(), in_degree);
+        nodes.push_back(node);
+    }
+
+    std::vector<weak_node_t> ordered;
+    ordered.reserve(nodes.size());
+    for ( const auto& node : nodes )
+        if ( in_degrees[node.lock().get()] == 0 )
+            ordered.push_back(node);
+    for ( std::size_t i = 0; i < ordered.size(); ++i ) {   // Note: ordered is used as a FIFO queue
+        const auto node_ptr = ordered[i].lock();
+        for ( const auto& out_node : node_ptr->get_out_nodes() ) {
+            const auto out_node_ptr = out_node.lock();
+            if ( !out_node_ptr )
+                continue;
+            auto in_degree = in_degrees.find(out_node_ptr.get());
+            if ( in_degree != in_degrees.end() &&
+                 --in_degree->second == 0 )
+                ordered.push_back(out_node);
+        }
+    }
+    _acyclic = ordered.size() == nodes.size();
+    if ( !_acyclic ) {
+        for ( const auto& node : nodes )
+            if ( in_degrees[node.lock().get()] != 0 )
+                ordered.push_back(node);
+    }
+
+    _nodes = std::move(ordered);
+    for ( std::size_t p = 0; p < _nodes.size(); ++p )
+        _positions[_nodes[p].lock().get()] = p;
+    _holes = 0;
+    _dirty = false;
+}
+
+template <class config_t>
+auto    topological_order_behaviour<config_t>::compact() -> void
+{
+    if ( _holes < 64 ||
+         _holes * 2 < _nodes.size() )
+        return;
+    std::size_t p = 0;
+    for ( auto& node : _nodes ) {
+        const auto node_ptr = node.lock();
+        if ( !node_ptr )
+            continue;
+        _positions[node_ptr.get()] = p;
+        _nodes[p++] = node;
+    }
+    _nodes.resize(p);
+    _holes = 0;
+}
+//-----------------------------------------------------------------------------
+
+} // ::gtpo
@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	topology_diff.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef gtpo_topology_diff_h
+#define gtpo_topology_diff_h
+
+// STD headers
+#include <cstddef>          // std::size_t
+#include <functional>       // std::hash
+#include <vector>
+
+namespace gtpo { // ::gtpo
+
+/*! \brief Graph topology described with external ids (for example a backend model snapshot).
+ *
+ * Nodes and edges are identified by user ids (\c id_t must be equality comparable and hashable), edge ids and
+ * node ids are independent namespaces.
+ */
+template <class id_t>
+struct id_topology
+{
+    //! Edge with external \c id from \c src node id to \c dst node id.
+    struct edge_t {
+        id_t    id;
+        id_t    src;
+        id_t    dst;
+    };
+    std::vector<id_t>   nodes;
+    std::vector<edge_t> edges;
+};
+
+/*! \brief Minimal list of operations transforming a topology into another one, see gtpo::diff_topology().
+ *
+ * Operations should be applied in this order: remove edges, remove nodes, add nodes, rewire edges and add edges,
+ * so that an edge never reference a missing node (a rewired edge adjacent to a removed node must be detached
+ * before the node is removed).
+ */
+template <class id_t>
+struct topology_diff
+{
+    using edge_t = typename id_topology<id_t>::edge_t;
+
+    std::vector<id_t>   removed_edges;
+    std::vector<id_t>   removed_nodes;
+    std::vector<id_t>   added_nodes;
+    //! Edges existing in both topologies whose source or destination has changed (with their new ends).
+    std::vector<edge_t> rewired_edges;
+    std::vector<edge_t> added_edges;
+
+    //! Return true if there is no change between the two compared topologies.
+    inline auto is_empty() const noexcept -> bool { return get_change_count() == 0; }
+    //! Return the number of operations in this diff.
+    inline auto get_change_count() const noexcept -> std::size_t {
+        return removed_edges.size() + removed_nodes.size() + added_nodes.size() +
+               rewired_edges.size() + added_edges.size();
+    }
+};
+
+/*! \brief Compare topology \c from with topology \c to by external id and return operations transforming \c from into \c to.
+ *
+ * Nodes and edges are matched by id: an id only in \c from is removed, an id only in \c to is added, an edge id in both
+ * topologies with different ends is rewired. Edges adjacent to a removed node are explicitly listed in removed edges
+ * (unless they are rewired). Duplicated ids are ignored (first occurrence win).
+ *
+ * \code
+ *   gtpo::id_topology<std::string> actual, fresh;
+ *   // ... fill actual and fresh from two backend snapshots
+ *   const auto diff = gtpo::diff_topology(actual, fresh);
+ *   for ( const auto& edge : diff.removed_edges ) { ... }
+ * \endcode
+ *
+ * \note complexity is O(V + E) of both topologies (hashed), applying the result cost O(changes).
+ * \throw std::bad_alloc
+ */
+template <class id_t, class hash_t = std::hash<id_t>>
+auto    diff_topology(const id_topology<id_t>& from, const id_topology<id_t>& to) -> topology_diff<id_t>;
+
+} // ::gtpo
+
+#include "./topology_diff.hpp"
+
+#endif // gtpo_topology_diff_h
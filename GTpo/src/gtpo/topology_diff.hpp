@@ -0,0 +1,103 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software library.
+//
+// \file	topology_diff.hpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <unordered_map>
+#include <unordered_set>
+
+namespace gtpo { // ::gtpo
+
+template <class id_t, class hash_t>
+auto    diff_topology(const id_topology<id_t>& from, const id_topology<id_t>& to) -> topology_diff<id_t>
+{
+    // ALGORITHM:
+        // 1. Hash both node sets, nodes only in from are removed, nodes only in to are added.
+        // 2. Hash from edges by id (first occurrence), then sweep to edges: an unknown id is added,
+        //    a known id with different ends is rewired, matched ids are erased from the hash.
+        // 3. Remaining from edges are removed.
+    using edge_t = typename id_topology<id_t>::edge_t;
+    topology_diff<id_t> r;
+
+    std::unordered_set<id_t, hash_t> from_nodes;
+    from_nodes.reserve(from.nodes.size());
+    for ( const auto& node : from.nodes )
+        from_nodes.insert(node);
+    std::unordered_set<id_t, hash_t> to_nodes;
+    to_nodes.reserve(to.nodes.size());
+    for ( const auto& node : to.nodes ) {
+        if ( !to_nodes.insert(node).second )
+            continue;
+        if ( from_nodes.find(node) == from_nodes.end() )
+            r.added_nodes.push_back(node);
+    }
+    for ( const auto& node : from.nodes ) {
+        const auto from_node = from_nodes.find(node);
+        if ( from_node == from_nodes.end() )    // Duplicated id, already visited
+            continue;
+        if ( to_nodes.find(node) == to_nodes.end() )
+            r.removed_nodes.push_back(node);
+        from_nodes.erase(from_node);
+    }
+
+    std::unordered_map<id_t, const edge_t*, hash_t> from_edges;
+    from_edges.reserve(from.edges.size());
+    for ( const auto& edge : from.edges )
+        from_edges.emplace(edge.id, &edge);
+    std::unordered_set<id_t, hash_t> to_edges;
+    to_edges.reserve(to.edges.size());
+    for ( const auto& edge : to.edges ) {
+        if ( !to_edges.insert(edge.id).second )
+            continue;
+        const auto from_edge = from_edges.find(edge.id);
+        if ( from_edge == from_edges.end() ) {
+            r.added_edges.push_back(edge);
+            continue;
+        }
+        if ( !( from_edge->second->src == edge.src ) ||
+             !( from_edge->second->dst == edge.dst ) )
+            r.rewired_edges.push_back(edge);
+        from_edges.erase(from_edge);
+    }
+    for ( const auto& edge : from.edges ) {     // Keep from order for removed edges
+        const auto from_edge = from_edges.find(edge.id);
+        if ( from_edge != from_edges.end() &&
+             from_edge->second == &edge ) {
+            r.removed_edges.push_back(edge.id);
+            from_edges.erase(from_edge);
+        }
+    }
+    return r;
+}
+
+} // ::gtpo
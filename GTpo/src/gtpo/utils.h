@@ -37,15 +37,22 @@
 
 // STD headers
 #include <algorithm>
+#include <cstdint>      // std::uint64_t
+#include <cstring>      // std::memcpy
 #include <exception>    // std::runtime_error
 #include <memory>       // std::weak_ptr
+#include <string>
 #include <iostream>     // std::cout
 #include <utility>      // std::index_sequence / std::make_index_sequence
 
 namespace gtpo { // ::gtpo
 
-//! Empty class
-class empty { };
+//! Empty class (accept an optional parent to mimic QObject base construction in node<> and edge<>).
+class empty {
+public:
+    empty() noexcept = default;
+    explicit empty(const empty*) noexcept { }
+};
 
 /*! \brief Exception thrown by GTpo to notify user that a topology related error occurs.
  *
@@ -62,15 +69,36 @@ public:
 /*! Standard GTpo utility to assert an expression  \c expr and throw an exception if \c expr is *false*.
  *
  * Used with no template parameter, assert_throw will throw a gtpo::bad_topology_error with a given \c message.
+ * Message is a literal: no std::string is built when \c expr is true.
  *
  * \note This function does not rely on N_DEBUG, the test will be run even in release mode.
  */
 template < class E = gtpo::bad_topology_error >
-auto    assert_throw( bool expr, std::string message = std::string{ "" } ) noexcept( false ) -> void {
+inline auto assert_throw( bool expr, const char* message = "" ) noexcept( false ) -> void {
     if ( !expr )
         throw E{ message };
 }
 
+//! \copydoc assert_throw()
+template < class E = gtpo::bad_topology_error >
+inline auto assert_throw( bool expr, const std::string& message ) noexcept( false ) -> void {
+    if ( !expr )
+        throw E{ message };
+}
+
+/*! Assert \c expr and throw an \c E exception with the message returned by \c build_message if \c expr is *false*.
+ *
+ * Use when message must be built at runtime, \c build_message is only called on failure:
+ * \code
+ *   gtpo::assert_throw_lazy( offset % 8 == 0, [&]() { return std::string{"unaligned "} + what; } );
+ * \endcode
+ */
+template < class E = gtpo::bad_topology_error, class message_builder_t >
+inline auto assert_throw_lazy( bool expr, message_builder_t&& build_message ) noexcept( false ) -> void {
+    if ( !expr )
+        throw E{ build_message() };
+}
+
 //! Compare two std::weak_ptr that must have been checked for expired() and nullptr content (ie use_count()==0).
 template < class T >
 auto    compare_weak_ptr( const std::weak_ptr<T>& left, const std::weak_ptr<T>& right ) noexcept -> bool {
@@ -90,6 +118,24 @@ auto    find_weak_ptr( const C& container, const T& element ) -> bool {
     return ( iter != container.end() );
 }
 
+//! Mix \c value bits (splitmix64 finalizer).
+constexpr auto  hash_mix( std::uint64_t value ) noexcept -> std::uint64_t {
+    value = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+    value = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebull;
+    return value ^ ( value >> 31 );
+}
+
+//! Combine \c value into \c seed hash (boost::hash_combine() with a hash_mix() finalized \c value).
+constexpr auto  hash_combine( std::uint64_t seed, std::uint64_t value ) noexcept -> std::uint64_t {
+    return seed ^ ( hash_mix( value + 0x9e3779b97f4a7c15ull ) + 0x9e3779b97f4a7c15ull + ( seed << 6 ) + ( seed >> 2 ) );
+}
+
+//! Return \c value bits, to combine a floating point value with hash_combine().
+inline auto     hash_bits( double value ) noexcept -> std::uint64_t {
+    std::uint64_t bits = 0;
+    std::memcpy( &bits, &value, sizeof(bits) );
+    return bits;
+}
 
 /*! Configuration interface for accessing graph containers.
  *
@@ -36,11 +36,20 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <thread>
+#include <vector>
+#include <iterator>         // std::back_inserter
+#include <cstdlib>         // std::abs
+#include <string>
+#include <algorithm>        // std::find
 
 // GTpo headers
 #include <GTpo>
 #include <../src/algorithm.h>
 #include <../src/functional.h>
+#include <../src/parallel.h>
+#include <../src/topology_diff.h>
+#include <../src/reachability.h>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -294,6 +303,110 @@ TEST(GTpoGraph, levelize_tree_dfs_rec)
 }
 
 
+//-----------------------------------------------------------------------------
+// Iterative tree algorithms
+//-----------------------------------------------------------------------------
+
+TEST(GTpoGraph, is_dag)
+{
+    gtpo::graph<> g;
+    EXPECT_TRUE(gtpo::is_dag(g));
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.create_edge(n1, n2);  // Diamond: n4 is reached twice but there is no circuit
+    g.create_edge(n1, n3);
+    g.create_edge(n2, n4);
+    g.create_edge(n3, n4);
+    EXPECT_TRUE(gtpo::is_dag(g));
+    EXPECT_TRUE(gtpo::is_dag_rec(g));
+    g.create_edge(n4, n1);
+    EXPECT_FALSE(gtpo::is_dag(g));
+    EXPECT_FALSE(gtpo::is_dag_rec(g));
+}
+
+TEST(GTpoGraph, is_tree)
+{
+    gtpo::graph<> g;
+    EXPECT_TRUE(gtpo::is_tree(g));
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    EXPECT_TRUE(gtpo::is_tree(g));
+    g.create_edge(n2, n3);  // n3 in degree is now 2
+    EXPECT_FALSE(gtpo::is_tree(g));
+}
+
+TEST(GTpoGraph, tree_depth)
+{
+    gtpo::graph<> g;
+    EXPECT_EQ(gtpo::tree_depth(g), 0);
+    auto n1 = g.create_node();
+    EXPECT_EQ(gtpo::tree_depth(g), 1);
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    g.create_edge(n3, n4);
+    EXPECT_EQ(gtpo::tree_depth(g), 3);
+}
+
+TEST(GTpoGraph, linearize_levelize_tree_dfs)
+{
+    // Iterative versions must return the same result than recursive ones
+    // g = {[n1, n2, n3, n4, n5], [(n1 -> n2), (n1 -> n3), (n2 -> n4), (n5 -> n1)]}
+    gtpo::graph<> g;
+    EXPECT_EQ(gtpo::linearize_tree_dfs(g).size(), 0);
+    EXPECT_EQ(gtpo::levelize_tree_dfs(g).size(), 0);
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    g.create_edge(n2, n4);
+    g.create_edge(n5, n1);
+    auto e = gtpo::linearize_tree_dfs_rec(g);
+    auto r = gtpo::linearize_tree_dfs(g);
+    ASSERT_EQ(r.size(), e.size());
+    for ( std::size_t i = 0; i < r.size(); ++i )
+        EXPECT_EQ(r[i].lock().get(), e[i].lock().get());
+
+    auto el = gtpo::levelize_tree_dfs_rec(g);
+    auto rl = gtpo::levelize_tree_dfs(g);
+    ASSERT_EQ(rl.size(), el.size());
+    for ( std::size_t l = 0; l < rl.size(); ++l ) {
+        ASSERT_EQ(rl[l].size(), el[l].size());
+        for ( std::size_t i = 0; i < rl[l].size(); ++i )
+            EXPECT_EQ(rl[l][i].lock().get(), el[l][i].lock().get());
+    }
+}
+
+TEST(GTpoGraph, iterative_deep_chain)
+{
+    // A 100k nodes chain would overflow recursive algorithms call stack
+    gtpo::graph<> g;
+    const int depth = 100000;
+    auto prev = g.create_node();
+    for ( int n = 1; n < depth; ++n ) {
+        auto node = g.create_node();
+        g.create_edge(prev, node);
+        prev = node;
+    }
+    EXPECT_TRUE(gtpo::is_dag(g));
+    EXPECT_TRUE(gtpo::is_tree(g));
+    EXPECT_EQ(gtpo::tree_depth(g), depth);
+    EXPECT_EQ(gtpo::linearize_tree_dfs(g).size(), static_cast<std::size_t>(depth));
+    EXPECT_EQ(gtpo::levelize_tree_dfs(g).size(), static_cast<std::size_t>(depth));
+    g.clear();
+}
+
+
 //-----------------------------------------------------------------------------
 // Graph (iterative) BFS iterator
 //-----------------------------------------------------------------------------
@@ -365,6 +478,92 @@ TEST(GTpoGraph, linearize_dfs)
     }
 }
 
+TEST(GTpoGraph, collect_dfs)
+{
+    // g = {[n1, n2, n3, n4, n5],
+    //      [(n1 -> n2), (n2 -> n3), (n1 -> n4), (n4 -> n1), (n4 -> n2)]}
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n1, n4);
+    g.create_edge(n4, n1);
+    g.create_edge(n4, n2);
+
+    using node_t = gtpo::graph<>::final_config_t::final_node_t;
+    gtpo::dfs_scratch<node_t> scratch;
+    std::vector<const node_t*> r;
+    gtpo::collect_dfs(*n1.lock(), std::back_inserter(r), scratch);
+    ASSERT_EQ(r.size(), 4);     // n1 is part of a circuit
+    EXPECT_EQ(r[0], n2.lock().get());
+    EXPECT_EQ(r[1], n3.lock().get());
+    EXPECT_EQ(r[2], n4.lock().get());
+    EXPECT_EQ(r[3], n1.lock().get());
+
+    // Scratch is reused, marks are reset
+    r.clear();
+    gtpo::collect_dfs(*n2.lock(), std::back_inserter(r), scratch);
+    ASSERT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0], n3.lock().get());
+
+    // Range overload: start nodes are collected, shared nodes only once
+    r.clear();
+    const std::vector<gtpo::graph<>::weak_node_t> starts{n2, n4};
+    gtpo::collect_dfs<node_t>(starts.cbegin(), starts.cend(), std::back_inserter(r), scratch);
+    ASSERT_EQ(r.size(), 4);
+    EXPECT_EQ(r[0], n2.lock().get());
+    EXPECT_EQ(r[1], n3.lock().get());
+    EXPECT_EQ(r[2], n4.lock().get());
+    EXPECT_EQ(r[3], n1.lock().get());
+}
+
+TEST(GTpoGraph, for_each_adjacent_edge)
+{
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n3, n1);
+    g.create_edge(n1, n1);     // Trivial circuit is visited once
+    int count = 0;
+    gtpo::for_each_adjacent_edge(*n1.lock(), [&count](const gtpo::graph<>::shared_edge_t& edge) {
+        EXPECT_TRUE(edge != nullptr);
+        ++count;
+    });
+    EXPECT_EQ(count, 3);
+}
+
+TEST(GTpoGraph, order_hyper_dependents)
+{
+    // Dependents are appended once, and ordered after their destination edge
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto e1 = g.create_edge(n1, n2);
+    auto e2 = g.create_edge(n2, n3);
+    auto he1 = g.create_edge(n3, e1);
+    auto he2 = g.create_edge(n1, he1);
+    auto he3 = g.create_edge(n2, he1);
+
+    using edge_t = gtpo::graph<>::final_config_t::final_edge_t;
+    std::vector<edge_t*> edges{he2.lock().get(), e2.lock().get(), e1.lock().get()};
+    gtpo::order_hyper_dependents(edges);
+    ASSERT_EQ(edges.size(), 5);
+    const auto position = [&edges](const gtpo::graph<>::weak_edge_t& edge) {
+        return std::find(edges.cbegin(), edges.cend(), edge.lock().get()) - edges.cbegin();
+    };
+    EXPECT_LT(position(e1), position(he1));
+    EXPECT_LT(position(he1), position(he2));
+    EXPECT_LT(position(he1), position(he3));
+    EXPECT_LT(position(e2), position(he1));     // Stable for edges with the same depth
+}
+
 TEST(GTpoGraph, begin_end_dfs)
 {
     {
@@ -523,3 +722,710 @@ TEST(GTpoGraph, dfs_iterator)
 
     // FIXME: Test a non DAG...
 }
+
+
+//-----------------------------------------------------------------------------
+// CSR view snapshot and algorithms
+//-----------------------------------------------------------------------------
+
+TEST(GTpoGraph, csr_view)
+{
+    {   // Empty graph, expecting an empty view
+        gtpo::graph<> g;
+        gtpo::csr_view<gtpo::graph<>> csr{g};
+        EXPECT_TRUE(csr.is_empty());
+        EXPECT_EQ(csr.get_node_count(), 0);
+        EXPECT_EQ(csr.get_edge_count(), 0);
+    }
+
+    {   // g = {[n1, n2, n3], [(n1 -> n2), (n1 -> n3), (n1 -> n3)]}
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        g.create_edge(n1, n2);
+        g.create_edge(n1, n3);
+        g.create_edge(n1, n3);  // Parallel edges are preserved
+        gtpo::csr_view<gtpo::graph<>> csr{g};
+        ASSERT_EQ(csr.get_node_count(), 3);
+        EXPECT_EQ(csr.get_edge_count(), 3);
+        EXPECT_EQ(csr.index_of(n1), 0);
+        EXPECT_EQ(csr.index_of(n3), 2);
+        EXPECT_EQ(csr.get_node(1).lock().get(), n2.lock().get());
+        EXPECT_TRUE(csr.get_node(42).expired());
+        EXPECT_EQ(csr.get_out_degree(0), 3);
+        EXPECT_EQ(csr.get_in_degree(0), 0);
+        EXPECT_EQ(csr.get_in_degree(2), 2);
+        ASSERT_EQ(csr.get_root_nodes().size(), 1);
+        EXPECT_EQ(csr.get_root_nodes()[0], 0);
+
+        // Rebuild after a mutation
+        g.remove_node(n2);
+        csr.rebuild(g);
+        EXPECT_EQ(csr.get_node_count(), 2);
+        EXPECT_EQ(csr.get_edge_count(), 2);
+        EXPECT_EQ(csr.index_of(n2), gtpo::csr_view<gtpo::graph<>>::invalid_index);
+        EXPECT_EQ(csr.index_of(n3), 1);
+    }
+}
+
+TEST(GTpoGraph, csr_linearize_dfs)
+{
+    // Expecting the same order than linearize_dfs() on the source graph
+    // g = {[n1, n2, n3, n4, n5],
+    //      [(n1 -> n4), (n1 -> n2), (n2 -> n3), (n5 -> n2)]}
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    g.create_edge(n1, n4);
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n5, n2);
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    const auto r = gtpo::linearize_dfs(g);
+    const auto csr_r = gtpo::linearize_dfs(csr);
+    ASSERT_EQ(csr_r.size(), r.size());
+    for ( std::size_t i = 0; i < r.size(); ++i )
+        EXPECT_EQ(csr.get_node(csr_r[i]).lock().get(), r[i].lock().get());
+}
+
+TEST(GTpoGraph, csr_is_dag)
+{
+    {   // Empty graph is a DAG
+        gtpo::graph<> g;
+        EXPECT_TRUE(gtpo::is_dag_rec(gtpo::csr_view<gtpo::graph<>>{g}));
+    }
+
+    {   // g = { [n1, n2, n3], [(n1 -> n3), (n2 -> n3)] }
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        g.create_edge(n1, n3);
+        g.create_edge(n2, n3);
+        EXPECT_TRUE(gtpo::is_dag_rec(gtpo::csr_view<gtpo::graph<>>{g}));
+    }
+
+    {   // Circuit == non DAG
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        g.create_edge(n1, n2);
+        g.create_edge(n2, n3);
+        g.create_edge(n3, n2);
+        EXPECT_FALSE(gtpo::is_dag_rec(gtpo::csr_view<gtpo::graph<>>{g}));
+    }
+}
+
+TEST(GTpoGraph, csr_topological_sort)
+{
+    {   // Empty graph is a DAG
+        gtpo::graph<> g;
+        const gtpo::csr_view<gtpo::graph<>> csr{g};
+        EXPECT_TRUE(gtpo::topological_sort(csr).empty());
+        EXPECT_TRUE(gtpo::is_dag(csr));
+    }
+
+    {   // g = { [n1, n2, n3, n4], [(n3 -> n1), (n1 -> n2), (n4 -> n2)] }
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        auto n4 = g.create_node();
+        g.create_edge(n3, n1);
+        g.create_edge(n1, n2);
+        g.create_edge(n4, n2);
+        const gtpo::csr_view<gtpo::graph<>> csr{g};
+        EXPECT_TRUE(gtpo::is_dag(csr));
+        const auto r = gtpo::topological_sort(csr);
+        ASSERT_EQ(r.size(), 4);
+        std::vector<std::size_t> positions(r.size());
+        for ( std::size_t i = 0; i < r.size(); ++i )
+            positions[r[i]] = i;
+        EXPECT_LT(positions[csr.index_of(n3)], positions[csr.index_of(n1)]);
+        EXPECT_LT(positions[csr.index_of(n1)], positions[csr.index_of(n2)]);
+        EXPECT_LT(positions[csr.index_of(n4)], positions[csr.index_of(n2)]);
+    }
+
+    {   // Circuit == non DAG, nodes downstream of the circuit are not ordered
+        // g = { [n1, n2, n3, n4], [(n1 -> n2), (n2 -> n3), (n3 -> n2), (n3 -> n4)] }
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        auto n4 = g.create_node();
+        g.create_edge(n1, n2);
+        g.create_edge(n2, n3);
+        g.create_edge(n3, n2);
+        g.create_edge(n3, n4);
+        const gtpo::csr_view<gtpo::graph<>> csr{g};
+        EXPECT_FALSE(gtpo::is_dag(csr));
+        const auto r = gtpo::topological_sort(csr);
+        ASSERT_EQ(r.size(), 1);
+        EXPECT_EQ(r[0], csr.index_of(n1));
+    }
+}
+
+TEST(GTpoGraph, csr_strongly_connected_components)
+{
+    {   // Empty graph has no components
+        gtpo::graph<> g;
+        EXPECT_TRUE(gtpo::strongly_connected_components(gtpo::csr_view<gtpo::graph<>>{g}).empty());
+    }
+
+    // g = { [n1 .. n6], [(n1 -> n2), (n2 -> n3), (n3 -> n1), (n3 -> n4), (n4 -> n5), (n5 -> n4)] }, n6 is isolated
+    // Expect: components = { {n1, n2, n3}, {n4, n5}, {n6} }
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    auto n6 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n3, n1);
+    g.create_edge(n3, n4);
+    g.create_edge(n4, n5);
+    g.create_edge(n5, n4);
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    const auto r = gtpo::strongly_connected_components(csr);
+    ASSERT_EQ(r.size(), 6);
+    const auto c = [&csr, &r](const gtpo::graph<>::weak_node_t& n) { return r[csr.index_of(n)]; };
+    EXPECT_EQ(c(n1), c(n2));
+    EXPECT_EQ(c(n1), c(n3));
+    EXPECT_EQ(c(n4), c(n5));
+    EXPECT_NE(c(n1), c(n4));
+    EXPECT_NE(c(n1), c(n6));
+    EXPECT_NE(c(n4), c(n6));
+    EXPECT_GT(c(n1), c(n4));    // Reverse topological order of condensation graph
+    EXPECT_EQ(*std::max_element(r.begin(), r.end()), 2);
+}
+
+TEST(GTpoGraph, csr_reachability_index)
+{
+    {   // Empty graph, every query is false
+        gtpo::graph<> g;
+        const gtpo::reachability_index<gtpo::graph<>> reachability{gtpo::csr_view<gtpo::graph<>>{g}};
+        EXPECT_EQ(reachability.get_node_count(), 0);
+        EXPECT_FALSE(reachability.is_reachable(0, 0));
+    }
+
+    // g = { [n1 .. n7], [(n1 -> n2), (n2 -> n3), (n3 -> n2), (n1 -> n4), (n4 -> n5), (n3 -> n5), (n6 -> n5)] }, n7 is isolated
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n5 = g.create_node();
+    auto n6 = g.create_node();
+    auto n7 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n3, n2);
+    g.create_edge(n1, n4);
+    g.create_edge(n4, n5);
+    g.create_edge(n3, n5);
+    g.create_edge(n6, n5);
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    const gtpo::reachability_index<gtpo::graph<>> reachability{csr};
+    EXPECT_EQ(reachability.get_component_count(), 6);   // {n2, n3} are collapsed
+    const auto reach = [&](const gtpo::graph<>::weak_node_t& a, const gtpo::graph<>::weak_node_t& b) {
+        return reachability.is_reachable(csr.index_of(a), csr.index_of(b));
+    };
+    EXPECT_TRUE(reach(n1, n1));
+    EXPECT_TRUE(reach(n1, n3));
+    EXPECT_TRUE(reach(n3, n2));     // Circuit
+    EXPECT_TRUE(reach(n2, n5));
+    EXPECT_TRUE(reach(n1, n5));
+    EXPECT_TRUE(reach(n6, n5));
+    EXPECT_FALSE(reach(n5, n1));
+    EXPECT_FALSE(reach(n4, n3));
+    EXPECT_FALSE(reach(n6, n1));
+    EXPECT_FALSE(reach(n1, n6));
+    EXPECT_FALSE(reach(n1, n7));
+    EXPECT_FALSE(reachability.is_reachable(0, 42));
+
+    // Compare with a BFS on the source graph for every pair
+    for ( gtpo::csr_view<gtpo::graph<>>::index_t s = 0; s < csr.get_node_count(); ++s ) {
+        const auto reachable = gtpo::k_hop_neighbourhood(csr, {s}, csr.get_node_count(), gtpo::traversal_direction::out);
+        for ( gtpo::csr_view<gtpo::graph<>>::index_t t = 0; t < csr.get_node_count(); ++t )
+            EXPECT_EQ(reachability.is_reachable(s, t),
+                      std::find(reachable.begin(), reachable.end(), t) != reachable.end());
+    }
+}
+
+TEST(GTpoGraph, csr_levelize_tree_dfs)
+{
+    // g = {[n1, n3, n4, n2], [(n3 -> n4)]}
+    // Expect: r = [ [n1, n3, n2], [n4] ]
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n3, n4);
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    const auto r = gtpo::levelize_tree_dfs_rec(csr);
+    ASSERT_EQ( r.size(), 2);
+    ASSERT_EQ( r[0].size(), 3);
+    ASSERT_EQ( r[1].size(), 1);
+    EXPECT_EQ( csr.get_node(r[0][0]).lock().get(), n1.lock().get());
+    EXPECT_EQ( csr.get_node(r[0][1]).lock().get(), n3.lock().get());
+    EXPECT_EQ( csr.get_node(r[0][2]).lock().get(), n2.lock().get());
+    EXPECT_EQ( csr.get_node(r[1][0]).lock().get(), n4.lock().get());
+}
+
+TEST(GTpoGraph, snapshot)
+{
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n1, n2);
+    const auto s1 = g.snapshot();
+    ASSERT_TRUE( s1 );
+    EXPECT_EQ( s1->get_node_count(), 2 );
+    EXPECT_EQ( s1->get_edge_count(), 1 );
+    EXPECT_EQ( g.snapshot(), s1 );       // Topology unchanged, same shared snapshot
+
+    const auto revision = g.get_topology_revision();
+    auto n3 = g.create_node();
+    g.create_edge(n2, n3);
+    EXPECT_GT( g.get_topology_revision(), revision );
+    const auto s2 = g.snapshot();
+    EXPECT_NE( s2, s1 );
+    EXPECT_EQ( s1->get_node_count(), 2 );   // Detached snapshot is never modified
+    EXPECT_EQ( s2->get_node_count(), 3 );
+    EXPECT_EQ( s2->get_edge_count(), 2 );
+
+    g.remove_node(n1);
+    EXPECT_EQ( g.snapshot()->get_node_count(), 2 );
+    g.clear();
+    EXPECT_TRUE( g.snapshot()->get_csr().is_empty() );
+}
+
+TEST(GTpoGraph, snapshot_thread)
+{
+    // Snapshot is analyzed on a worker thread while source graph is modified
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> nodes;
+    for ( int n = 0; n < 1000; ++n )
+        nodes.push_back(g.create_node());
+    for ( int n = 0; n < 999; ++n )
+        g.create_edge(nodes[n], nodes[n + 1]);
+    const auto snapshot = g.snapshot();
+    std::vector<gtpo::graph<>::snapshot_t::index_t> order;
+    bool is_dag = false;
+    std::thread worker{[snapshot, &order, &is_dag]() {
+        is_dag = gtpo::is_dag_rec(snapshot->get_csr());
+        order = gtpo::linearize_dfs(snapshot->get_csr());
+    }};
+    for ( int n = 0; n < 100; ++n )
+        g.create_edge(nodes[999 - n], nodes[n]);
+    worker.join();
+    EXPECT_TRUE( is_dag );
+    ASSERT_EQ( order.size(), 1000 );
+    EXPECT_EQ( snapshot->get_csr().get_node(order.front()).lock(), nodes[0].lock() );
+    EXPECT_FALSE( gtpo::is_dag_rec(g.snapshot()->get_csr()) );
+}
+
+
+TEST(GTpoGraph, reorder)
+{
+    // g = {[n4, n3, n1, n2], [(n1 -> n2), (n2 -> n3), (n2 -> n4), (n1 -> n4)]}
+    gtpo::graph<> g;
+    auto n4 = g.create_node();
+    auto n3 = g.create_node();
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n2, n4);
+    g.create_edge(n1, n4);
+    const auto revision = g.get_topology_revision();
+
+    g.reorder(gtpo::reorder_policy::bfs);     // Expecting [n1, n2, n4, n3]
+    EXPECT_GT( g.get_topology_revision(), revision );
+    ASSERT_EQ( g.get_node_count(), 4 );
+    EXPECT_EQ( g.get_nodes()[0], n1.lock() );
+    EXPECT_EQ( g.get_nodes()[1], n2.lock() );
+    EXPECT_EQ( g.get_nodes()[2], n4.lock() );
+    EXPECT_EQ( g.get_nodes()[3], n3.lock() );
+    EXPECT_EQ( g.get_edge_count(), 4 );
+    EXPECT_EQ( g.get_edges()[0]->get_src().lock(), n1.lock() );  // Edges are regrouped by source
+    EXPECT_EQ( g.get_edges()[1]->get_src().lock(), n1.lock() );
+    EXPECT_EQ( g.get_edges()[2]->get_src().lock(), n2.lock() );
+    EXPECT_TRUE( g.has_edge(n2, n3) );
+    EXPECT_TRUE( g.is_root_node(n1) );
+    EXPECT_EQ( g.get_root_node_count(), 1 );
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    EXPECT_EQ( csr.index_of(n1), 0 );
+    EXPECT_EQ( csr.get_root_nodes()[0], 0 );
+
+    g.reorder(gtpo::reorder_policy::degree);  // n2 (degree 3) first, then n1 and n4 (degree 2)
+    EXPECT_EQ( g.get_nodes()[0], n2.lock() );
+    EXPECT_EQ( g.get_nodes()[3], n3.lock() );
+    EXPECT_EQ( gtpo::linearize_dfs(g).size(), 4 );
+}
+
+TEST(GTpoGraph, reorder_reverse_cuthill_mckee)
+{
+    // Shuffled chain: RCM must give consecutive indexes to adjacent nodes (bandwidth == 1)
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> nodes;
+    for ( int n = 0; n < 64; ++n )
+        nodes.push_back(g.create_node());
+    for ( int n = 0; n < 63; ++n )
+        g.create_edge(nodes[(n * 37) % 64], nodes[((n + 1) * 37) % 64]);
+    g.reorder(gtpo::reorder_policy::reverse_cuthill_mckee);
+    ASSERT_EQ( g.get_node_count(), 64 );
+    EXPECT_EQ( g.get_edge_count(), 63 );
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    for ( gtpo::csr_view<gtpo::graph<>>::index_t n = 0; n < csr.get_node_count(); ++n )
+        for ( auto target = csr.out_begin(n); target != csr.out_end(n); ++target )
+            EXPECT_EQ( std::abs(static_cast<int>(*target) - static_cast<int>(n)), 1 );
+    EXPECT_TRUE( gtpo::is_dag(g) );
+    EXPECT_EQ( gtpo::linearize_dfs(csr).size(), 64 );
+}
+
+
+//-----------------------------------------------------------------------------
+// CSR shortest path and k-hop neighbourhood
+//-----------------------------------------------------------------------------
+
+struct weighted_edge_config : public gtpo::config<weighted_edge_config>
+{
+    using final_edge_t = struct weighted_edge;
+};
+struct weighted_edge : public gtpo::edge<weighted_edge_config>
+{
+    double  weight = 1.;
+};
+
+TEST(GTpoGraph, csr_in_adjacency)
+{
+    // g = {[n1, n2, n3], [(n1 -> n3), (n2 -> n3), (n3 -> n1)]}
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n3);
+    g.create_edge(n2, n3);
+    g.create_edge(n3, n1);
+    const gtpo::csr_view<gtpo::graph<>> csr{g};
+    EXPECT_FALSE( csr.is_weighted() );
+    ASSERT_EQ( csr.in_end(2) - csr.in_begin(2), 2 );
+    EXPECT_EQ( csr.in_begin(2)[0], 0 );
+    EXPECT_EQ( csr.in_begin(2)[1], 1 );
+    ASSERT_EQ( csr.in_end(0) - csr.in_begin(0), 1 );
+    EXPECT_EQ( *csr.in_begin(0), 2 );
+    EXPECT_EQ( csr.in_end(1) - csr.in_begin(1), 0 );
+}
+
+TEST(GTpoGraph, csr_shortest_path)
+{
+    // g = {[n0, n1, n2, n3, n4], [(n0 -> n1), (n1 -> n2), (n2 -> n3), (n0 -> n4), (n4 -> n3)]}
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 5; ++i )
+        n.push_back(g.create_node());
+    g.create_edge(n[0], n[1]);
+    g.create_edge(n[1], n[2]);
+    g.create_edge(n[2], n[3]);
+    g.create_edge(n[0], n[4]);
+    g.create_edge(n[4], n[3]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    using path_t = std::vector<csr_t::index_t>;
+    EXPECT_EQ( gtpo::shortest_path(csr, csr_t::index_t{0}, csr_t::index_t{3}), (path_t{0, 4, 3}) );
+    EXPECT_EQ( gtpo::shortest_path(csr, csr_t::index_t{1}, csr_t::index_t{3}), (path_t{1, 2, 3}) );
+    EXPECT_EQ( gtpo::shortest_path(csr, csr_t::index_t{2}, csr_t::index_t{2}), (path_t{2}) );
+    EXPECT_TRUE( gtpo::shortest_path(csr, csr_t::index_t{3}, csr_t::index_t{0}).empty() );   // Directed
+    EXPECT_TRUE( gtpo::shortest_path(csr, csr_t::index_t{0}, csr_t::index_t{42}).empty() );
+
+    {   // Weighted: longer path is cheaper
+        gtpo::graph<weighted_edge_config> wg;
+        std::vector<gtpo::graph<weighted_edge_config>::weak_node_t> wn;
+        for ( int i = 0; i < 5; ++i )
+            wn.push_back(wg.create_node());
+        wg.create_edge(wn[0], wn[1]);
+        wg.create_edge(wn[1], wn[2]);
+        wg.create_edge(wn[2], wn[3]);
+        wg.create_edge(wn[0], wn[4]).lock()->weight = 5.;
+        wg.create_edge(wn[4], wn[3]);
+        using wcsr_t = gtpo::csr_view<gtpo::graph<weighted_edge_config>>;
+        wcsr_t wcsr;
+        wcsr.rebuild(wg, [](const weighted_edge& e) { return e.weight; });
+        EXPECT_TRUE( wcsr.is_weighted() );
+        using wpath_t = std::vector<wcsr_t::index_t>;
+        EXPECT_EQ( gtpo::shortest_path(wcsr, wcsr_t::index_t{0}, wcsr_t::index_t{3}), (wpath_t{0, 1, 2, 3}) );
+        wg.create_edge(wn[3], wn[0]).lock()->weight = -1.;
+        wcsr.rebuild(wg, [](const weighted_edge& e) { return e.weight; });
+        EXPECT_THROW( gtpo::shortest_path(wcsr, wcsr_t::index_t{3}, wcsr_t::index_t{4}), std::invalid_argument );
+    }
+}
+
+TEST(GTpoGraph, csr_k_hop_neighbourhood)
+{
+    // Chain n0 -> n1 -> n2 -> n3 -> n4
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 5; ++i )
+        n.push_back(g.create_node());
+    for ( int i = 0; i < 4; ++i )
+        g.create_edge(n[i], n[i + 1]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    using nodes_t = std::vector<csr_t::index_t>;
+    EXPECT_EQ( gtpo::k_hop_neighbourhood(csr, nodes_t{2}, 0), (nodes_t{2}) );
+    EXPECT_EQ( gtpo::k_hop_neighbourhood(csr, nodes_t{2}, 1), (nodes_t{2, 3, 1}) );
+    EXPECT_EQ( gtpo::k_hop_neighbourhood(csr, nodes_t{2}, 2, gtpo::traversal_direction::out), (nodes_t{2, 3, 4}) );
+    EXPECT_EQ( gtpo::k_hop_neighbourhood(csr, nodes_t{2}, 5, gtpo::traversal_direction::in), (nodes_t{2, 1, 0}) );
+    EXPECT_EQ( gtpo::k_hop_neighbourhood(csr, nodes_t{0, 4, 0, 42}, 1), (nodes_t{0, 4, 1, 3}) );
+}
+
+
+//-----------------------------------------------------------------------------
+// BFS iterator and parallel BFS
+//-----------------------------------------------------------------------------
+
+TEST(GTpoGraph, bfs_iterator)
+{
+    {   // begin_bfs() on an empty graph must be equal to end_bfs()
+        gtpo::graph<> g;
+        EXPECT_TRUE(gtpo::begin_bfs(g) == gtpo::end_bfs(g));
+    }
+    {   // g = {[n1, n2, n3, n4, n5], [(n1 -> n2), (n1 -> n3), (n2 -> n4), (n3 -> n5)]}
+        // Expect: BFS order n1, n2, n3, n4, n5 (DFS would visit n4 before n3)
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        auto n4 = g.create_node();
+        auto n5 = g.create_node();
+        g.create_edge(n1, n2);
+        g.create_edge(n1, n3);
+        g.create_edge(n2, n4);
+        g.create_edge(n3, n5);
+        std::vector<gtpo::graph<>::node_t*> r;
+        for ( auto it = gtpo::begin_bfs(g); it != gtpo::end_bfs(g); ++it )
+            r.push_back((*it).lock().get());
+        ASSERT_EQ(r.size(), 5);
+        EXPECT_EQ(r[0], n1.lock().get());
+        EXPECT_EQ(r[1], n2.lock().get());
+        EXPECT_EQ(r[2], n3.lock().get());
+        EXPECT_EQ(r[3], n4.lock().get());
+        EXPECT_EQ(r[4], n5.lock().get());
+    }
+    {   // Circuits (no root node) must also be traversed: g = {[n1, n2], [(n1 -> n2), (n2 -> n1)]}
+        gtpo::graph<> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        g.create_edge(n1, n2);
+        g.create_edge(n2, n1);
+        int count = 0;
+        for ( auto it = gtpo::begin_bfs(g); it != gtpo::end_bfs(g); ++it )
+            ++count;
+        EXPECT_EQ(count, 2);
+    }
+}
+
+TEST(GTpoGraph, parallel_bfs)
+{
+    // g = {[n0 .. n5], [(n0 -> n1), (n0 -> n2), (n1 -> n3), (n2 -> n3), (n3 -> n4)]}, n5 is unreachable
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 6; ++i )
+        n.push_back(g.create_node());
+    g.create_edge(n[0], n[1]);
+    g.create_edge(n[0], n[2]);
+    g.create_edge(n[1], n[3]);
+    g.create_edge(n[2], n[3]);
+    g.create_edge(n[3], n[4]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    const auto source = csr.index_of(n[0]);
+    for ( std::size_t thread_count : { 1, 4 } ) {
+        const auto r = gtpo::parallel_bfs(csr, source, thread_count);
+        ASSERT_EQ(r.distances.size(), 6);
+        EXPECT_EQ(r.distances[csr.index_of(n[0])], 0);
+        EXPECT_EQ(r.distances[csr.index_of(n[1])], 1);
+        EXPECT_EQ(r.distances[csr.index_of(n[2])], 1);
+        EXPECT_EQ(r.distances[csr.index_of(n[3])], 2);
+        EXPECT_EQ(r.distances[csr.index_of(n[4])], 3);
+        EXPECT_EQ(r.distances[csr.index_of(n[5])], csr_t::invalid_index);
+        EXPECT_EQ(r.parents[source], source);
+        EXPECT_EQ(r.parents[csr.index_of(n[4])], csr.index_of(n[3]));
+        const auto n3_parent = r.parents[csr.index_of(n[3])];   // Either n1 or n2
+        EXPECT_TRUE(n3_parent == csr.index_of(n[1]) || n3_parent == csr.index_of(n[2]));
+        EXPECT_EQ(r.parents[csr.index_of(n[5])], csr_t::invalid_index);
+    }
+}
+
+TEST(GTpoGraph, parallel_topological_levels)
+{
+    // g = {[n0 .. n5], [(n0 -> n1), (n0 -> n2), (n1 -> n3), (n2 -> n3), (n3 -> n4), (n0 -> n4)]}
+    // Expect: levels = [ [n0, n5], [n1, n2], [n3], [n4] ]
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 6; ++i )
+        n.push_back(g.create_node());
+    g.create_edge(n[0], n[1]);
+    g.create_edge(n[0], n[2]);
+    g.create_edge(n[1], n[3]);
+    g.create_edge(n[2], n[3]);
+    g.create_edge(n[3], n[4]);
+    g.create_edge(n[0], n[4]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    const auto sorted = [&csr](std::vector<gtpo::graph<>::weak_node_t> nodes) {
+        std::vector<csr_t::index_t> r;
+        for ( const auto& node : nodes )
+            r.push_back(csr.index_of(node));
+        std::sort(r.begin(), r.end());
+        return r;
+    };
+    for ( std::size_t thread_count : { 1, 4 } ) {
+        const auto levels = gtpo::parallel_topological_levels(csr, thread_count);
+        ASSERT_EQ(levels.size(), 4);
+        EXPECT_EQ(levels[0], sorted({n[0], n[5]}));
+        EXPECT_EQ(levels[1], sorted({n[1], n[2]}));
+        EXPECT_EQ(levels[2], sorted({n[3]}));
+        EXPECT_EQ(levels[3], sorted({n[4]}));
+    }
+
+    g.create_edge(n[4], n[3]);  // Circuit: n3 and n4 are no longer leveled
+    const csr_t cyclic_csr{g};
+    const auto levels = gtpo::parallel_topological_levels(cyclic_csr, 4);
+    ASSERT_EQ(levels.size(), 2);
+    EXPECT_EQ(levels[1].size(), 2);
+}
+
+TEST(GTpoGraph, weakly_connected_components)
+{
+    // g = { [n0 .. n7], [(n1 -> n0), (n2 -> n1), (n3 -> n4), (n5 -> n4), (n6 -> n6)] }, n7 is isolated
+    // Expect: components = { {n0, n1, n2}, {n3, n4, n5}, {n6}, {n7} }
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 8; ++i )
+        n.push_back(g.create_node());
+    g.create_edge(n[1], n[0]);
+    g.create_edge(n[2], n[1]);
+    g.create_edge(n[3], n[4]);
+    g.create_edge(n[5], n[4]);
+    g.create_edge(n[6], n[6]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    for ( std::size_t thread_count : { 1, 4 } ) {
+        const auto r = gtpo::weakly_connected_components(csr, thread_count);
+        ASSERT_EQ(r.size(), 8);
+        const auto c = [&csr, &r](const gtpo::graph<>::weak_node_t& node) { return r[csr.index_of(node)]; };
+        EXPECT_EQ(c(n[0]), c(n[1]));
+        EXPECT_EQ(c(n[0]), c(n[2]));
+        EXPECT_EQ(c(n[3]), c(n[4]));
+        EXPECT_EQ(c(n[3]), c(n[5]));
+        EXPECT_NE(c(n[0]), c(n[3]));
+        EXPECT_NE(c(n[6]), c(n[7]));
+        EXPECT_EQ(*std::max_element(r.begin(), r.end()), 3);   // Ids are dense
+        EXPECT_EQ(r[0], 0);
+    }
+
+    {   // Long chain split between threads: one component
+        gtpo::graph<> chain;
+        auto previous = chain.create_node();
+        for ( int i = 0; i < 1000; ++i ) {
+            auto next = chain.create_node();
+            chain.create_edge(next, previous);
+            previous = next;
+        }
+        const auto r = gtpo::weakly_connected_components(csr_t{chain}, 8);
+        EXPECT_TRUE(std::all_of(r.begin(), r.end(), [](csr_t::index_t c) { return c == 0; }));
+    }
+}
+
+TEST(GTpoGraph, parallel_label_propagation)
+{
+    {   // Empty graph has no communities
+        gtpo::graph<> g;
+        EXPECT_TRUE(gtpo::parallel_label_propagation(gtpo::csr_view<gtpo::graph<>>{g}).empty());
+    }
+
+    // g = two 5 nodes cliques [n0 .. n4] and [n5 .. n9] linked by (n4 -> n5), n10 is isolated
+    // Expect: communities = { {n0 .. n4}, {n5 .. n9}, {n10} }
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> n;
+    for ( int i = 0; i < 11; ++i )
+        n.push_back(g.create_node());
+    for ( int clique = 0; clique < 2; ++clique )
+        for ( int i = 0; i < 5; ++i )
+            for ( int j = i + 1; j < 5; ++j )
+                g.create_edge(n[clique * 5 + i], n[clique * 5 + j]);
+    g.create_edge(n[4], n[5]);
+    using csr_t = gtpo::csr_view<gtpo::graph<>>;
+    const csr_t csr{g};
+    for ( std::size_t thread_count : { 1, 4 } ) {
+        const auto r = gtpo::parallel_label_propagation(csr, 20, thread_count);
+        ASSERT_EQ(r.size(), 11);
+        const auto c = [&csr, &r](const gtpo::graph<>::weak_node_t& node) { return r[csr.index_of(node)]; };
+        for ( int i = 1; i < 5; ++i ) {
+            EXPECT_EQ(c(n[0]), c(n[i]));
+            EXPECT_EQ(c(n[5]), c(n[5 + i]));
+        }
+        EXPECT_NE(c(n[0]), c(n[5]));
+        EXPECT_NE(c(n[0]), c(n[10]));
+        EXPECT_NE(c(n[5]), c(n[10]));
+        EXPECT_EQ(*std::max_element(r.begin(), r.end()), 2);   // Ids are dense
+    }
+
+    // With no iterations, every node is its own community
+    const auto r = gtpo::parallel_label_propagation(csr, 0, 1);
+    EXPECT_EQ(*std::max_element(r.begin(), r.end()), 10);
+}
+
+
+//-----------------------------------------------------------------------------
+// Topology diff
+//-----------------------------------------------------------------------------
+
+TEST(GTpoGraph, diff_topology)
+{
+    using topology_t = gtpo::id_topology<std::string>;
+    {   // Identical topologies have an empty diff
+        topology_t a;
+        a.nodes = {"n1", "n2"};
+        a.edges = {{"e1", "n1", "n2"}};
+        EXPECT_TRUE(gtpo::diff_topology(a, a).is_empty());
+    }
+
+    // from = { [n1, n2, n3], [e1 (n1 -> n2), e2 (n2 -> n3), e3 (n3 -> n1)] }
+    // to   = { [n1, n2, n4], [e1 (n1 -> n2), e2 (n2 -> n4), e4 (n4 -> n1)] }
+    // Expect: n3 removed, n4 added, e3 removed, e2 rewired, e4 added
+    topology_t from;
+    from.nodes = {"n1", "n2", "n3"};
+    from.edges = {{"e1", "n1", "n2"}, {"e2", "n2", "n3"}, {"e3", "n3", "n1"}};
+    topology_t to;
+    to.nodes = {"n1", "n2", "n4", "n4"};    // Duplicated ids are ignored
+    to.edges = {{"e1", "n1", "n2"}, {"e2", "n2", "n4"}, {"e4", "n4", "n1"}};
+    const auto diff = gtpo::diff_topology(from, to);
+    EXPECT_EQ(diff.get_change_count(), 5);
+    EXPECT_EQ(diff.removed_nodes, std::vector<std::string>{"n3"});
+    EXPECT_EQ(diff.added_nodes, std::vector<std::string>{"n4"});
+    EXPECT_EQ(diff.removed_edges, std::vector<std::string>{"e3"});
+    ASSERT_EQ(diff.rewired_edges.size(), 1);
+    EXPECT_EQ(diff.rewired_edges[0].id, "e2");
+    EXPECT_EQ(diff.rewired_edges[0].dst, "n4");
+    ASSERT_EQ(diff.added_edges.size(), 1);
+    EXPECT_EQ(diff.added_edges[0].id, "e4");
+
+    // Reverse diff
+    const auto reverse = gtpo::diff_topology(to, from);
+    EXPECT_EQ(reverse.removed_nodes, std::vector<std::string>{"n4"});
+    EXPECT_EQ(reverse.added_nodes, std::vector<std::string>{"n3"});
+    EXPECT_EQ(reverse.removed_edges, std::vector<std::string>{"e4"});
+    EXPECT_EQ(reverse.rewired_edges.size(), 1);
+    EXPECT_EQ(reverse.added_edges.size(), 1);
+}
@@ -36,9 +36,14 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <random>
+#include <queue>
+#include <unordered_set>
 
 // GTpo headers
 #include <GTpo>
+#include <../src/topological_order.h>
+#include <../src/fingerprint.h>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -66,16 +71,12 @@ protected:
     virtual void    on_node_removed( weak_node_t& ) noexcept override { std::cerr << "GraphBehaviourMock::on_node_removed()" << std::endl; mockNodeRemoved(); }
     virtual void    on_edge_inserted( weak_edge_t& ) noexcept override { std::cerr << "GraphBehaviourMock::on_edge_inserted()" << std::endl; mockEdgeInserted(); }
     virtual void    on_edge_removed( weak_edge_t& ) noexcept override { std::cerr << "GraphBehaviourMock::on_edge_removed()" << std::endl; mockEdgeRemoved(); }
-    virtual void    on_group_inserted( weak_group_t& ) noexcept override { std::cerr << "GraphBehaviourMock::on_group_inserted()" << std::endl; mockGroupInserted(); }
-    virtual void    on_group_removed( weak_group_t& ) noexcept override { std::cerr << "GraphBehaviourMock::on_group_removed()" << std::endl; mockGroupRemoved(); }
 
 public:
     MOCK_METHOD0(mockNodeInserted, void(void));
     MOCK_METHOD0(mockNodeRemoved, void(void));
     MOCK_METHOD0(mockEdgeInserted, void(void));
     MOCK_METHOD0(mockEdgeRemoved, void(void));
-    MOCK_METHOD0(mockGroupInserted, void(void));
-    MOCK_METHOD0(mockGroupRemoved, void(void));
 };
 
 TEST(GTpoBehaviour, graphEnabledDisabled)
@@ -122,100 +123,364 @@ TEST(GTpoBehaviour, graphBehaviour)
     EXPECT_CALL(*mockBehaviour, mockEdgeRemoved()).Times(1);
     g.remove_edge(e);
 
-    // group_inserted() notification
-    EXPECT_CALL(*mockBehaviour, mockGroupInserted()).Times(1);
-    auto gg = g.create_group();
-
-    // group_removed() notification
-    EXPECT_CALL(*mockBehaviour, mockGroupRemoved()).Times(1);
-    g.remove_group( gg );
-
     //delete mockBehaviour;
 }
 
-//-----------------------------------------------------------------------------
-// GTpo Group behaviour tests
-//-----------------------------------------------------------------------------
+TEST(GTpoBehaviour, graphBehaviourBatchInsert)
+{
+    gtpo::graph<> g;
 
-template < class config_t = gtpo::default_config >
-class GroupBehaviourMock : public gtpo::dynamic_group_behaviour< config_t >
+    using MockGraphBehaviour = GraphBehaviourMock<>;
+    auto mockBehaviour = new MockGraphBehaviour();  // Do not use unique_ptr here because of gmock
+    g.add_dynamic_graph_behaviour( std::unique_ptr<MockGraphBehaviour>(mockBehaviour) );
+
+    // Default on_nodes_inserted() / on_edges_inserted() should forward to per primitive notifications
+    std::vector<gtpo::graph<>::shared_node_t> nodes{ std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>() };
+    EXPECT_CALL(*mockBehaviour, mockNodeInserted()).Times(3);
+    g.insert_nodes( nodes.cbegin(), nodes.cend() );
+
+    std::vector<gtpo::graph<>::shared_edge_t> edges{ std::make_shared<gtpo::edge<>>(nodes[0], nodes[1]),
+                                                     std::make_shared<gtpo::edge<>>(nodes[1], nodes[2]) };
+    EXPECT_CALL(*mockBehaviour, mockEdgeInserted()).Times(2);
+    g.insert_edges( edges.cbegin(), edges.cend() );
+}
+
+// Count batch notifications calls (and notified primitives)
+class BatchCounterBehaviour : public gtpo::dynamic_graph_behaviour<gtpo::default_config>
 {
 public:
-    GroupBehaviourMock() { }
-    virtual ~GroupBehaviourMock() { }
-
-    using weak_node_t      = std::weak_ptr< typename config_t::final_node_t >;
-    using weak_edge_t      = std::weak_ptr< typename config_t::final_edge_t >;
-    using weak_group_t     = std::weak_ptr< typename config_t::final_group_t >;
+    int         nodes_batches = 0;
+    int         edges_batches = 0;
+    std::size_t nodes_count = 0;
+    std::size_t edges_count = 0;
+    std::size_t expired_count = 0;
+    std::size_t removed_edges_count = 0;
 
 protected:
-    virtual void    on_node_inserted( weak_node_t& ) noexcept override { mockNodeInserted(); }
-    virtual void    on_node_removed( weak_node_t& ) noexcept override { mockNodeRemoved(); }
-    virtual void    on_group_inserted( weak_group_t& ) noexcept override { mockGroupInserted(); }
-    virtual void    on_group_removed( weak_group_t& ) noexcept override { mockGroupRemoved(); }
+    virtual void    on_nodes_inserted( weak_nodes_t& nodes ) noexcept override { ++nodes_batches; nodes_count += nodes.size(); }
+    virtual void    on_edges_inserted( weak_edges_t& edges ) noexcept override {
+        ++edges_batches; edges_count += edges.size();
+        for ( const auto& edge : edges )    // Deferred edges must still be alive and fully connected when notified
+            if ( edge.expired() || edge.lock()->get_src().expired() || edge.lock()->get_dst().expired() )
+                ++expired_count;
+    }
+    virtual void    on_edge_removed( weak_edge_t& ) noexcept override { ++removed_edges_count; }
+};
+
+TEST(GTpoBehaviour, graphNotificationScope)
+{
+    gtpo::graph<> g;
+    auto counter = new BatchCounterBehaviour{};
+    g.add_dynamic_graph_behaviour( std::unique_ptr<BatchCounterBehaviour>(counter) );
+
+    EXPECT_FALSE( g.is_notification_deferred() );
+    {
+        gtpo::graph<>::notification_scope scope{g};
+        EXPECT_TRUE( g.is_notification_deferred() );
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto n3 = g.create_node();
+        {   // Nested scope: nothing is sent until outermost scope is closed
+            gtpo::graph<>::notification_scope nested{g};
+            g.create_edge( n1, n2 );
+            g.create_edge( n2, n3 );
+        }
+        EXPECT_TRUE( g.is_notification_deferred() );
+        EXPECT_EQ( counter->nodes_batches, 0 );
+        EXPECT_EQ( counter->edges_batches, 0 );
+        g.create_edge( n1, n3 );
+    }
+    EXPECT_FALSE( g.is_notification_deferred() );
+    EXPECT_EQ( counter->nodes_batches, 1 );     // Coalesced in one call per primitive kind
+    EXPECT_EQ( counter->nodes_count, 3u );
+    EXPECT_EQ( counter->edges_batches, 1 );
+    EXPECT_EQ( counter->edges_count, 3u );
+    EXPECT_EQ( counter->expired_count, 0u );
+
+    // Outside a scope, notifications are immediate (and not batched)
+    g.create_node();
+    EXPECT_EQ( counter->nodes_batches, 1 );
+}
+
+TEST(GTpoBehaviour, graphNotificationScopeFlushOnRemove)
+{
+    gtpo::graph<> g;
+    auto counter = new BatchCounterBehaviour{};
+    g.add_dynamic_graph_behaviour( std::unique_ptr<BatchCounterBehaviour>(counter) );
+
+    gtpo::graph<>::notification_scope scope{g};
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto e = g.create_edge( n1, n2 );
+    EXPECT_EQ( counter->edges_batches, 0 );
+
+    // Removal is never deferred: pending insertions are sent first
+    g.remove_edge( e );
+    EXPECT_EQ( counter->nodes_batches, 1 );
+    EXPECT_EQ( counter->edges_batches, 1 );
+    EXPECT_EQ( counter->removed_edges_count, 1u );
+    EXPECT_EQ( counter->expired_count, 0u );
+}
+
+// Static only configuration (dynamic behaviours compiled out) with a counting static graph behaviour
+struct static_counter_config;
 
+template < class config_t >
+class StaticCounterBehaviour : public gtpo::graph_behaviour<config_t>
+{
 public:
-    MOCK_METHOD0(mockNodeInserted, void(void));
-    MOCK_METHOD0(mockNodeRemoved, void(void));
-    MOCK_METHOD0(mockGroupInserted, void(void));
-    MOCK_METHOD0(mockGroupRemoved, void(void));
+    using weak_node_t = typename gtpo::graph_behaviour<config_t>::weak_node_t;
+    using weak_edge_t = typename gtpo::graph_behaviour<config_t>::weak_edge_t;
+    static int  nodes;
+    static int  edges;
+    void    node_inserted( weak_node_t& ) noexcept { ++nodes; }
+    void    node_removed( weak_node_t& ) noexcept { --nodes; }
+    void    edge_inserted( weak_edge_t& ) noexcept { ++edges; }
+    void    edge_removed( weak_edge_t& ) noexcept { --edges; }
+};
+template < class config_t > int StaticCounterBehaviour<config_t>::nodes = 0;
+template < class config_t > int StaticCounterBehaviour<config_t>::edges = 0;
+
+struct static_counter_config : public gtpo::static_behaviours_config<static_counter_config>
+{
+    using graph_behaviours = std::tuple< StaticCounterBehaviour<static_counter_config> >;
+};
+
+struct static_only_config : public gtpo::static_behaviours_config<static_only_config>
+{
 };
 
-// FIXME groups:
-    // A contract should enforce the behaviour when a grouped node or edge is actually
-    // removed from topology, is a group edge_removed() or node_removed() signal emitted ?
+TEST(GTpoBehaviour, staticBehavioursConfig)
+{
+    // Dynamic behaviours storage is compiled out
+    static_assert( !static_only_config::enable_dynamic_behaviours, "" );
+    EXPECT_LT( sizeof(gtpo::node<static_only_config>), sizeof(gtpo::node<gtpo::default_config>) );
+    EXPECT_LT( sizeof(gtpo::graph<static_only_config>), sizeof(gtpo::graph<gtpo::default_config>) );
+
+    // Static behaviours are still notified, including batch notifications (replayed per primitive)
+    using counter_t = StaticCounterBehaviour<static_counter_config>;
+    gtpo::graph<static_counter_config> g;
+    EXPECT_FALSE( g.hasBehaviours() );
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto e = g.create_edge( n1, n2 );
+    EXPECT_EQ( counter_t::nodes, 2 );
+    EXPECT_EQ( counter_t::edges, 1 );
+
+    using graph_t = gtpo::graph<static_counter_config>;
+    std::vector<graph_t::shared_node_t> nodes{ std::make_shared<graph_t::node_t>(),
+                                               std::make_shared<graph_t::node_t>() };
+    g.insert_nodes( nodes.cbegin(), nodes.cend() );
+    EXPECT_EQ( counter_t::nodes, 4 );
+
+    g.remove_edge( e );
+    EXPECT_EQ( counter_t::edges, 0 );
+    g.remove_node( n1 );
+    EXPECT_EQ( counter_t::nodes, 3 );
+}
+
+//-----------------------------------------------------------------------------
+// GTpo topological order behaviour tests
+//-----------------------------------------------------------------------------
+
+using topological_order_t = gtpo::topological_order_behaviour<gtpo::default_config>;
 
-TEST(GTpoBehaviour, groupBehaviourNodeInserted)
+TEST(GTpoBehaviour, topologicalOrderWouldCreateCycle)
 {
     gtpo::graph<> g;
-    using MockGroupBehaviour = GroupBehaviourMock<>;
-    auto group = g.create_group();
-    auto n = g.create_node();
+    auto order = std::make_unique<topological_order_t>();
+    auto orderPtr = order.get();
+    g.add_dynamic_graph_behaviour(std::move(order));
 
-    ASSERT_TRUE(group.lock());
-    auto groupMockBehaviour = new MockGroupBehaviour(); // Can't use unique_ptr here because of gmock
-    group.lock()->add_dynamic_group_behaviour( std::unique_ptr<MockGroupBehaviour>(groupMockBehaviour) );
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    EXPECT_EQ(orderPtr->get_node_count(), 3);
+    EXPECT_TRUE(orderPtr->would_create_cycle(n1, n1));  // Trivial circuit
+    EXPECT_FALSE(orderPtr->would_create_cycle(n1, n2));
+
+    // g = {[n1, n2, n3], [(n3 -> n2), (n2 -> n1)]}: both edges violate insertion order
+    g.create_edge(n3, n2);
+    g.create_edge(n2, n1);
+    EXPECT_TRUE(orderPtr->is_acyclic());
+    EXPECT_LT(orderPtr->get_order(n3), orderPtr->get_order(n2));
+    EXPECT_LT(orderPtr->get_order(n2), orderPtr->get_order(n1));
+    EXPECT_TRUE(orderPtr->would_create_cycle(n1, n3));
+    EXPECT_TRUE(orderPtr->would_create_cycle(n1, n2));
+    EXPECT_FALSE(orderPtr->would_create_cycle(n3, n1));
+
+    // Inserting an edge closing a circuit anyway, then removing it
+    auto e = g.create_edge(n1, n3);
+    EXPECT_FALSE(orderPtr->is_acyclic());
+    EXPECT_TRUE(orderPtr->would_create_cycle(n2, n3));      // Unbounded search fallback
+    g.remove_edge(e);
+    EXPECT_TRUE(orderPtr->is_acyclic());
+    EXPECT_LT(orderPtr->get_order(n3), orderPtr->get_order(n1));
+
+    // Node removal
+    g.remove_node(n2);
+    EXPECT_EQ(orderPtr->get_node_count(), 2);
+    EXPECT_FALSE(orderPtr->would_create_cycle(n1, n3));
+    EXPECT_EQ(orderPtr->get_order(n2), topological_order_t::invalid_order);
+}
 
-    // node_inserted() notification
-    EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(1);
-    g.group_node(n, group);
-    //EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(0);
-
-    // node_removed() notification
-    EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(1);
-    g.ungroup_node(n, group);
-    //EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(0);
-
-    // When a node is removed from graph, it is automatically ungrouped,
-    // we expect the group behaviour to be notified that the node is removed...
-    EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(1);
-    g.group_node(n, group);
-    EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(1);
-    g.remove_node(n);
+TEST(GTpoBehaviour, topologicalOrderReset)
+{
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n2, n1);
+
+    auto order = std::make_unique<topological_order_t>();
+    auto orderPtr = order.get();
+    g.add_dynamic_graph_behaviour(std::move(order));
+    orderPtr->reset(g);     // Behaviour installed on a non empty graph
+    EXPECT_EQ(orderPtr->get_node_count(), 2);
+    EXPECT_TRUE(orderPtr->would_create_cycle(n1, n2));
+    EXPECT_FALSE(orderPtr->would_create_cycle(n2, n1));
+
+    // Batch insertion
+    std::vector<gtpo::graph<>::shared_node_t> nodes{ std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>() };
+    g.insert_nodes(nodes.cbegin(), nodes.cend());
+    std::vector<gtpo::graph<>::shared_edge_t> edges{ std::make_shared<gtpo::edge<>>(nodes[1], nodes[0]),
+                                                     std::make_shared<gtpo::edge<>>(nodes[0], n2.lock()) };
+    g.insert_edges(edges.cbegin(), edges.cend());
+    EXPECT_TRUE(orderPtr->is_acyclic());
+    EXPECT_TRUE(orderPtr->would_create_cycle(n1, nodes[1]));
+    const auto ordered = orderPtr->get_ordered_nodes();
+    ASSERT_EQ(ordered.size(), 4);
+    EXPECT_EQ(ordered.front().lock(), nodes[1]);
+    EXPECT_EQ(ordered.back().lock(), n1.lock());
 }
 
-TEST(GTpoBehaviour, groupBehaviourGroupInserted)
+TEST(GTpoBehaviour, topologicalOrderRandomInsertion)
 {
+    // Compare would_create_cycle() with a brute force reachability test on random edge insertions
     gtpo::graph<> g;
-    using MockGroupBehaviour = GroupBehaviourMock< gtpo::graph<>::configuration >;
-    auto group = g.create_group();
-    auto n = g.create_node();
+    auto order = std::make_unique<topological_order_t>();
+    auto orderPtr = order.get();
+    g.add_dynamic_graph_behaviour(std::move(order));
+
+    using weak_node_t = gtpo::graph<>::weak_node_t;
+    std::vector<weak_node_t> nodes;
+    for ( int n = 0; n < 100; ++n )
+        nodes.push_back(g.create_node());
+    const auto is_reachable = [](const weak_node_t& source, const weak_node_t& target) {
+        std::unordered_set<const gtpo::graph<>::node_t*> marks;
+        std::queue<weak_node_t> nodes;
+        nodes.push(source);
+        while ( !nodes.empty() ) {
+            const auto node = nodes.front().lock();
+            nodes.pop();
+            if ( node == target.lock() )
+                return true;
+            if ( !marks.insert(node.get()).second )
+                continue;
+            for ( const auto& out_node : node->get_out_nodes() )
+                nodes.push(out_node);
+        }
+        return false;
+    };
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<std::size_t> distribution{0, nodes.size() - 1};
+    int inserted = 0;
+    for ( int i = 0; i < 600; ++i ) {
+        const auto& source = nodes[distribution(generator)];
+        const auto& destination = nodes[distribution(generator)];
+        const bool cycle = orderPtr->would_create_cycle(source, destination);
+        EXPECT_EQ(cycle, is_reachable(destination, source));
+        if ( !cycle ) {
+            g.create_edge(source, destination);
+            ++inserted;
+        }
+    }
+    EXPECT_GT(inserted, 0);
+    EXPECT_TRUE(orderPtr->is_acyclic());
+    for ( const auto& edge : g.get_edges() )   // Every edge respect order
+        EXPECT_LT(orderPtr->get_order(edge->get_src()), orderPtr->get_order(edge->get_dst()));
+}
 
-    ASSERT_TRUE(group.lock());
-    auto groupMockBehaviour = new MockGroupBehaviour(); // Can't use unique_ptr here because of gmock
-    group.lock()->add_dynamic_group_behaviour( std::unique_ptr<MockGroupBehaviour>(groupMockBehaviour) );
+//-----------------------------------------------------------------------------
+// GTpo fingerprint behaviour tests
+//-----------------------------------------------------------------------------
 
-    // node_inserted() notification
-    using weak_group_t = gtpo::group<>::weak_group_t;
-    auto group2 = g.create_group();
-    EXPECT_CALL(*groupMockBehaviour, mockGroupInserted()).Times(1);
-    g.group_node(weak_group_t{group2}, group);
-
-    // group_removed() notification
-    EXPECT_CALL(*groupMockBehaviour, mockGroupRemoved()).Times(1);
-    g.ungroup_node(weak_group_t{group2}, group);
+using fingerprint_t = gtpo::fingerprint_behaviour<gtpo::default_config>;
+
+TEST(GTpoBehaviour, fingerprintOrderIndependent)
+{
+    // Same topology built in a different order has the same fingerprint
+    gtpo::graph<> g1;
+    auto fingerprint1 = std::make_unique<fingerprint_t>();
+    auto fingerprint1Ptr = fingerprint1.get();
+    g1.add_dynamic_graph_behaviour(std::move(fingerprint1));
+    auto a1 = g1.create_node();
+    auto b1 = g1.create_node();
+    auto c1 = g1.create_node();
+    g1.create_edge(a1, b1);
+    g1.create_edge(b1, c1);
+
+    gtpo::graph<> g2;
+    auto c2 = g2.create_node();
+    auto b2 = g2.create_node();
+    g2.create_edge(b2, c2);
+    auto a2 = g2.create_node();
+    g2.create_edge(a2, b2);
+    auto fingerprint2 = std::make_unique<fingerprint_t>();
+    auto fingerprint2Ptr = fingerprint2.get();
+    g2.add_dynamic_graph_behaviour(std::move(fingerprint2));
+    fingerprint2Ptr->reset(g2);     // Behaviour installed after topology has been built
+    EXPECT_EQ(fingerprint1Ptr->get_fingerprint(), fingerprint2Ptr->get_fingerprint());
+
+    // Removal restore previous fingerprint
+    const auto fingerprint = fingerprint1Ptr->get_fingerprint();
+    auto e = g1.create_edge(c1, a1);
+    EXPECT_NE(fingerprint1Ptr->get_fingerprint(), fingerprint);
+    g1.remove_edge(e);
+    EXPECT_EQ(fingerprint1Ptr->get_fingerprint(), fingerprint);
 }
 
+TEST(GTpoBehaviour, fingerprintNodeHasher)
+{
+    gtpo::graph<> g;
+    std::unordered_map<const gtpo::default_config::final_node_t*, std::uint64_t> labels;
+    auto fingerprint = std::make_unique<fingerprint_t>();
+    auto fingerprintPtr = fingerprint.get();
+    fingerprintPtr->set_node_hasher([&labels](const gtpo::default_config::final_node_t& node) {
+        const auto label = labels.find(&node);
+        return label != labels.cend() ? label->second : std::uint64_t{0};
+    });
+    g.add_dynamic_graph_behaviour(std::move(fingerprint));
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n1, n2);
+    const auto fingerprint0 = fingerprintPtr->get_fingerprint();
+
+    labels[n1.lock().get()] = 42;
+    fingerprintPtr->update_node(n1);
+    const auto fingerprint42 = fingerprintPtr->get_fingerprint();
+    EXPECT_NE(fingerprint42, fingerprint0);
+    EXPECT_EQ(fingerprintPtr->get_node_hash(*n1.lock()), fingerprint_t::mix(42));
+
+    // Incremental update is equal to a full reset
+    fingerprintPtr->reset(g);
+    EXPECT_EQ(fingerprintPtr->get_fingerprint(), fingerprint42);
+
+    labels[n1.lock().get()] = 0;
+    fingerprintPtr->update_node(n1);
+    EXPECT_EQ(fingerprintPtr->get_fingerprint(), fingerprint0);
+
+    // Edges are directed: n1 -> n2 and n2 -> n1 have different hashes when n1 and n2 hashes differ
+    labels[n1.lock().get()] = 42;
+    fingerprintPtr->update_node(n1);
+    auto e = g.find_edge(n1, n2);
+    g.remove_edge(e);
+    g.create_edge(n2, n1);
+    EXPECT_NE(fingerprintPtr->get_fingerprint(), fingerprint42);
+}
 
 //-----------------------------------------------------------------------------
 // GTpo Node behaviour tests
@@ -233,13 +498,13 @@ public:
     using weak_group_t     = std::weak_ptr< typename config_t::final_group_t >;
 
 protected:
-    virtual void    on_in_node_inserted( weak_node_t&, weak_node_t&, const weak_edge_t& ) noexcept override { mockInNodeInserted(); }
-    virtual void    on_in_node_removed( weak_node_t&, weak_node_t&, const weak_edge_t& ) noexcept override { mockInNodeRemoved(); }
-    virtual void    on_in_node_removed( weak_node_t& ) noexcept override { mockInNodeRemoved(); }
+    virtual void    on_in_node_inserted( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept override { mockInNodeInserted(); }
+    virtual void    on_in_node_removed( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept override { mockInNodeRemoved(); }
+    virtual void    on_in_node_removed( const weak_node_t& ) noexcept override { mockInNodeRemoved(); }
 
-    virtual void    on_out_node_inserted( weak_node_t&, weak_node_t&, const weak_edge_t& ) noexcept override { mockOutNodeInserted(); }
-    virtual void    on_out_node_removed( weak_node_t&, weak_node_t&, const weak_edge_t& ) noexcept override { mockOutNodeRemoved(); }
-    virtual void    on_out_node_removed( weak_node_t& ) noexcept override { mockOutNodeRemoved(); }
+    virtual void    on_out_node_inserted( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept override { mockOutNodeInserted(); }
+    virtual void    on_out_node_removed( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept override { mockOutNodeRemoved(); }
+    virtual void    on_out_node_removed( const weak_node_t& ) noexcept override { mockOutNodeRemoved(); }
 
 public:
     MOCK_METHOD0(mockInNodeInserted, void(void));
@@ -251,7 +516,7 @@ public:
 TEST(GTpoBehaviour, nodeBehaviour)
 {
     gtpo::graph<> g;
-    using MockNodeBehaviour = NodeBehaviourMock< gtpo::graph<>::configuration >;
+    using MockNodeBehaviour = NodeBehaviourMock< gtpo::graph<>::final_config_t >;
     auto nodeMockBehaviour = new MockNodeBehaviour{}; // Can't use unique_ptr here because of gmock
     auto n = g.create_node().lock();
     ASSERT_TRUE(n);
@@ -280,3 +545,26 @@ TEST(GTpoBehaviour, nodeBehaviour)
     EXPECT_CALL(*nodeMockBehaviour, mockOutNodeRemoved()).Times(0);
 }
 
+TEST(GTpoBehaviour, nodeBehaviourNotificationScope)
+{
+    gtpo::graph<> g;
+    using MockNodeBehaviour = NodeBehaviourMock< gtpo::graph<>::final_config_t >;
+    auto nodeMockBehaviour = new MockNodeBehaviour{}; // Can't use unique_ptr here because of gmock
+    auto n = g.create_node().lock();
+    ASSERT_TRUE(n);
+    n->add_dynamic_node_behaviour( std::unique_ptr<MockNodeBehaviour>{nodeMockBehaviour} );
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    {
+        gtpo::graph<>::notification_scope scope{g};
+        EXPECT_CALL(*nodeMockBehaviour, mockInNodeInserted()).Times(0);
+        EXPECT_CALL(*nodeMockBehaviour, mockOutNodeInserted()).Times(0);
+        g.create_edge(n2, n);
+        g.create_edge(n, n3);
+        ::testing::Mock::VerifyAndClearExpectations(nodeMockBehaviour);
+
+        // in/out node inserted notifications are replayed on scope exit
+        EXPECT_CALL(*nodeMockBehaviour, mockInNodeInserted()).Times(1);
+        EXPECT_CALL(*nodeMockBehaviour, mockOutNodeInserted()).Times(1);
+    }
+}
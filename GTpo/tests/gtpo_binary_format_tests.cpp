@@ -0,0 +1,215 @@
+/*
+ Copyright (c) 2008-2018, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the GTpo software.
+//
+// \file	gtpo_binary_format_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GTpo headers
+#include <GTpo>
+#include <../src/binary_format.h>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+// Copy a serialized graph in an 8 bytes aligned buffer (as an mmaped file would be)
+static auto to_aligned_buffer(const std::string& data) -> std::vector<std::uint64_t>
+{
+    std::vector<std::uint64_t> buffer((data.size() + 7) / 8, 0);
+    std::memcpy(buffer.data(), data.data(), data.size());
+    return buffer;
+}
+
+//-----------------------------------------------------------------------------
+// GTpo binary graph format
+//-----------------------------------------------------------------------------
+
+TEST(GTpoBinaryFormat, emptyGraph)
+{
+    gtpo::graph<> g;
+    std::ostringstream os;
+    gtpo::write_binary_graph(g, os);
+    const auto data = os.str();
+    const auto buffer = to_aligned_buffer(data);
+    const gtpo::binary_graph_view view{buffer.data(), data.size()};
+    EXPECT_EQ( view.get_node_count(), 0 );
+    EXPECT_EQ( view.get_edge_count(), 0 );
+    gtpo::graph<> g2;
+    EXPECT_TRUE( gtpo::load_binary_graph(g2, view).empty() );
+    EXPECT_EQ( g2.get_node_count(), 0 );
+}
+
+TEST(GTpoBinaryFormat, writeLoad)
+{
+    // Labels, geometry, parallel edges and circuits must survive a write / load round trip
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    g.create_edge(n1, n3);
+    g.create_edge(n3, n3);
+    std::vector<const gtpo::graph<>::node_t*> nodes{n1.lock().get(), n2.lock().get(), n3.lock().get()};
+    auto index_of = [&nodes](const gtpo::graph<>::node_t& node) {
+        return static_cast<int>(std::find(nodes.cbegin(), nodes.cend(), &node) - nodes.cbegin());
+    };
+
+    std::ostringstream os;
+    gtpo::write_binary_graph(g, os,
+                             [&](const gtpo::graph<>::node_t& node) {
+                                 const auto n = static_cast<float>(index_of(node));
+                                 return gtpo::binary_geometry{n * 10.f, n * 20.f, 100.f, 50.f, n};
+                             },
+                             [&](const gtpo::graph<>::node_t& node) {
+                                 return std::string{"node"} + std::to_string(index_of(node));
+                             });
+    const auto data = os.str();
+    const auto buffer = to_aligned_buffer(data);
+    const gtpo::binary_graph_view view{buffer.data(), data.size()};
+    ASSERT_EQ( view.get_node_count(), 3 );
+    EXPECT_EQ( view.get_edge_count(), 4 );
+    EXPECT_EQ( view.get_group_count(), 0 );
+    EXPECT_EQ( view.get_label(0), "node0" );
+    EXPECT_EQ( view.get_label(2), "node2" );
+    EXPECT_FLOAT_EQ( view.get_geometry(1).x, 10.f );
+    EXPECT_FLOAT_EQ( view.get_geometry(1).y, 20.f );
+    EXPECT_FLOAT_EQ( view.get_geometry(2).z, 2.f );
+    EXPECT_EQ( view.get_out_degree(0), 3 );
+    EXPECT_EQ( view.get_out_degree(1), 0 );
+    EXPECT_EQ( *view.out_begin(2), 2 );
+
+    gtpo::graph<> g2;
+    const auto loaded = gtpo::load_binary_graph(g2, view);
+    ASSERT_EQ( loaded.size(), 3 );
+    EXPECT_EQ( g2.get_node_count(), 3 );
+    EXPECT_EQ( g2.get_edge_count(), 4 );
+    EXPECT_EQ( g2.get_edge_count(loaded[0], loaded[2]), 2 );
+    EXPECT_TRUE( g2.has_edge(loaded[0], loaded[1]) );
+    EXPECT_TRUE( g2.has_edge(loaded[2], loaded[2]) );
+    EXPECT_EQ( g2.get_root_node_count(), 1 );
+    EXPECT_TRUE( g2.is_root_node(loaded[0]) );
+}
+
+TEST(GTpoBinaryFormat, badFormat)
+{
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    g.create_edge(n1, n2);
+    std::ostringstream os;
+    gtpo::write_binary_graph(g, os);
+    const auto data = os.str();
+
+    {   // Truncated buffer
+        const auto buffer = to_aligned_buffer(data);
+        EXPECT_THROW( (gtpo::binary_graph_view{buffer.data(), 16}), gtpo::bad_format_error );
+        EXPECT_THROW( (gtpo::binary_graph_view{buffer.data(), data.size() - 8}), gtpo::bad_format_error );
+    }
+    {   // Invalid magic
+        auto corrupted = data;
+        corrupted[0] = 'X';
+        const auto buffer = to_aligned_buffer(corrupted);
+        EXPECT_THROW( (gtpo::binary_graph_view{buffer.data(), corrupted.size()}), gtpo::bad_format_error );
+    }
+    {   // Invalid edge target
+        auto buffer = to_aligned_buffer(data);
+        auto header = reinterpret_cast<const gtpo::binary_header*>(buffer.data());
+        auto targets = reinterpret_cast<std::uint32_t*>(reinterpret_cast<char*>(buffer.data()) + header->targets_offset);
+        targets[0] = 42;
+        EXPECT_THROW( (gtpo::binary_graph_view{buffer.data(), data.size()}), gtpo::bad_format_error );
+    }
+}
+
+// Minimal group primitive: a node flagged as a group
+class binary_test_group;
+struct binary_group_config : public gtpo::config<binary_group_config>
+{
+    using final_group_t = binary_test_group;
+};
+
+class binary_test_group : public gtpo::node<binary_group_config>
+{
+public:
+    binary_test_group() : gtpo::node<binary_group_config>{} { set_is_group(true); }
+};
+using binary_group_graph = gtpo::graph<binary_group_config>;
+
+TEST(GTpoBinaryFormat, writeLoadGroups)
+{
+    binary_group_graph g;
+    auto group = g.insert_group( std::make_shared<binary_test_group>() );
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n2);
+    g.group_node(n1, group);
+    g.group_node(n2, group);
+    std::ostringstream os;
+    gtpo::write_binary_graph(g, os);
+    const auto data = os.str();
+    const auto buffer = to_aligned_buffer(data);
+    const gtpo::binary_graph_view view{buffer.data(), data.size()};
+    EXPECT_EQ( view.get_group_count(), 1 );
+    EXPECT_TRUE( view.get_node(0).is_group() );
+    EXPECT_EQ( view.get_node(1).group, 0 );
+    EXPECT_EQ( view.get_node(3).group, gtpo::binary_node::no_group );
+
+    {   // Default loader does not support groups
+        binary_group_graph g2;
+        EXPECT_THROW( gtpo::load_binary_graph(g2, view), gtpo::bad_format_error );
+    }
+    binary_group_graph g2;
+    const auto nodes = gtpo::load_binary_graph(g2, view,
+                                               [](std::uint32_t, const gtpo::binary_node&) { return std::make_shared<binary_group_graph::node_t>(); },
+                                               [](std::uint32_t, const gtpo::binary_node&) { return std::make_shared<binary_test_group>(); },
+                                               [](const binary_group_graph::shared_node_t&, const binary_group_graph::shared_node_t&) {
+                                                   return std::make_shared<binary_group_graph::shared_edge_t::element_type>();
+                                               });
+    ASSERT_EQ( nodes.size(), 4 );
+    EXPECT_EQ( g2.get_node_count(), 4 );
+    EXPECT_EQ( g2.get_group_count(), 1 );
+    EXPECT_EQ( g2.get_edge_count(), 1 );
+    const auto group2 = nodes[0].lock();
+    ASSERT_TRUE( group2 && group2->is_group() );
+    EXPECT_EQ( group2->get_node_count(), 2 );
+    EXPECT_TRUE( group2->has_node(nodes[1]) );
+    EXPECT_TRUE( group2->has_node(nodes[2]) );
+    EXPECT_FALSE( group2->has_node(nodes[3]) );
+}
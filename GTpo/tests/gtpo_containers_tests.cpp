@@ -138,3 +138,22 @@ TEST(GTpoContainerAdapter, stdUnorderedSetInsertRemove)
     std_container_adapter<IntUnorderedSet>::insert(i, il);
     std_container_adapter<IntUnorderedSet>::remove(i, il);
 }
+
+TEST(GTpoContainerAdapter, stdUnorderedSetWeakContains)
+{
+    using WeakIntUnorderedSet = std::unordered_set< std::weak_ptr<int> >;
+    WeakIntUnorderedSet wis;
+    auto si = std::make_shared<int>( 42 );
+    auto si2 = std::make_shared<int>( 42 );
+    std::weak_ptr<int> wi{si};
+    EXPECT_FALSE( std_container_adapter<WeakIntUnorderedSet>::contains(wis, wi) );
+    std_container_adapter<WeakIntUnorderedSet>::reserve(wis, 2);
+    std_container_adapter<WeakIntUnorderedSet>::insert(wi, wis);
+    EXPECT_TRUE( std_container_adapter<WeakIntUnorderedSet>::size(wis) == 1 );
+    EXPECT_TRUE( std_container_adapter<WeakIntUnorderedSet>::contains(wis, wi) );
+    EXPECT_FALSE( std_container_adapter<WeakIntUnorderedSet>::contains(wis, std::weak_ptr<int>{si2}) );
+    EXPECT_FALSE( std_container_adapter<WeakIntUnorderedSet>::contains(wis, std::weak_ptr<int>{}) );
+    std_container_adapter<WeakIntUnorderedSet>::remove(wi, wis);
+    EXPECT_TRUE( std_container_adapter<WeakIntUnorderedSet>::size(wis) == 0 );
+    EXPECT_FALSE( std_container_adapter<WeakIntUnorderedSet>::contains(wis, wi) );
+}
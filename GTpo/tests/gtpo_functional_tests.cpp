@@ -36,6 +36,8 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <vector>
+#include <unordered_set>
 
 // GTpo headers
 #include <GTpo>
@@ -88,7 +90,7 @@ TEST(gtpo_functional, map_copy)
  //       return std::make_shared<typename gtpo::graph<>::node_t>();
  //   };
     //gtpo::copy2(src, dst, f2);
-    gtpo::copy2(src, dst);
+    gtpo::copy(src, dst);
     EXPECT_EQ(src.get_node_count(), dst.get_node_count());    // dst is non empty, gtpo::filter should check that precondition and return false.
 }
 
@@ -189,3 +191,62 @@ TEST(gtpo_functional, filter)
     }
 }
 
+
+//-----------------------------------------------------------------------------
+// gtpo::filter / gtpo::map / gtpo::filter_map with an execution policy
+//-----------------------------------------------------------------------------
+
+TEST(gtpo_functional, parallel_precond)
+{
+    gtpo::graph<> src;
+    src.create_node();
+    gtpo::graph<> dst;
+    dst.create_node();
+    const auto f = [](const auto& node) -> bool { static_cast<void>(node); return true; };
+    const auto clone = [](const auto&) { return std::make_shared<gtpo::graph<>::node_t>(); };
+    EXPECT_FALSE(gtpo::filter(gtpo::par, src, dst, f, clone));     // dst is non empty
+    EXPECT_FALSE(gtpo::filter_map(gtpo::par, src, dst, f, clone));
+    EXPECT_FALSE(gtpo::map(gtpo::par, src, dst, clone));
+}
+
+TEST(gtpo_functional, parallel_filter_map)
+{
+    // src = 1000 nodes chain with shortcuts, select one node every three
+    gtpo::graph<> src;
+    std::vector<gtpo::graph<>::weak_node_t> nodes;
+    for ( int n = 0; n < 1000; ++n )
+        nodes.push_back(src.create_node());
+    for ( std::size_t n = 0; n + 1 < nodes.size(); ++n )
+        src.create_edge(nodes[n], nodes[n + 1]);
+    for ( std::size_t n = 0; n + 3 < nodes.size(); n += 3 )
+        src.create_edge(nodes[n], nodes[n + 3]);
+    std::unordered_set<const gtpo::graph<>::node_t*> selected;     // Read only in functors: thread safe
+    for ( std::size_t n = 0; n < nodes.size(); n += 3 )
+        selected.insert(nodes[n].lock().get());
+    const auto f = [&selected](const gtpo::graph<>::shared_node_t& node) -> bool {
+        return selected.find(node.get()) != selected.end();
+    };
+    const auto clone = [](const auto&) { return std::make_shared<gtpo::graph<>::node_t>(); };
+
+    gtpo::graph<> seq_dst;
+    EXPECT_TRUE(gtpo::filter(gtpo::seq, src, seq_dst, f, clone));
+    for ( std::size_t thread_count : { 1, 4 } ) {
+        gtpo::graph<> dst;
+        EXPECT_TRUE(gtpo::filter(gtpo::parallel_policy{thread_count}, src, dst, f, clone));
+        EXPECT_EQ(dst.get_node_count(), selected.size());
+        EXPECT_EQ(dst.get_edge_count(), seq_dst.get_edge_count());
+        EXPECT_EQ(dst.get_edge_count(), 333);                   // Only shortcut edges are kept
+        EXPECT_EQ(dst.get_root_nodes().size(), 1);
+
+        gtpo::graph<> map_dst;
+        EXPECT_TRUE(gtpo::map(gtpo::parallel_policy{thread_count}, src, map_dst, clone));
+        EXPECT_EQ(map_dst.get_node_count(), src.get_node_count());
+        EXPECT_EQ(map_dst.get_edge_count(), src.get_edge_count());
+    }
+
+    {   // A failing map functor must be reported
+        gtpo::graph<> dst;
+        const auto fail = [](const gtpo::graph<>::shared_node_t&) -> gtpo::graph<>::shared_node_t { return nullptr; };
+        EXPECT_FALSE(gtpo::filter_map(gtpo::par, src, dst, f, fail));
+    }
+}
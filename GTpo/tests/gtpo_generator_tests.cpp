@@ -36,10 +36,12 @@
 #include <list>
 #include <memory>
 #include <iostream>
+#include <unordered_set>
 
 // GTpo headers
 #include <GTpo>
 #include <../src/generator.h>
+#include <../src/algorithm.h>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -125,3 +127,136 @@ TEST(GTpoGenerator, complete_tree_rec)
         ASSERT_EQ(t.get_edge_count(), 12);
     }
 }
+
+//-----------------------------------------------------------------------------
+// gtpo graph generators
+//-----------------------------------------------------------------------------
+
+namespace { // ::anonymous
+auto    has_self_loop(const gtpo::graph<>& g) -> bool
+{
+    for ( const auto& edge : g.get_edges() )
+        if ( edge->get_src().lock() == edge->get_dst().lock() )
+            return true;
+    return false;
+}
+} // ::anonymous
+
+TEST(GTpoGenerator, complete_graph)
+{
+    {   // Expect: g = { [n0, n1], [(n0->n1), (n1->n0)] }
+        gtpo::graph<> g;
+        gtpo::complete_graph(g, 2);
+        ASSERT_EQ(g.get_node_count(), 2);
+        ASSERT_EQ(g.get_edge_count(), 2);
+        const auto& nodes = g.get_nodes();
+        EXPECT_TRUE(g.has_edge(nodes[0], nodes[1]));
+        EXPECT_TRUE(g.has_edge(nodes[1], nodes[0]));
+    }
+    {
+        gtpo::graph<> g;
+        gtpo::complete_graph(g, 5);
+        EXPECT_EQ(g.get_node_count(), 5);
+        EXPECT_EQ(g.get_edge_count(), 20);
+        EXPECT_FALSE(has_self_loop(g));
+    }
+    {   // Expect: no generation in a non empty graph
+        gtpo::graph<> g;
+        g.create_node();
+        gtpo::complete_graph(g, 5);
+        EXPECT_EQ(g.get_node_count(), 1);
+    }
+}
+
+TEST(GTpoGenerator, gnp_random_graph)
+{
+    {   // p == 0: only nodes
+        gtpo::graph<> g;
+        gtpo::gnp_random_graph(g, 10, 0.);
+        EXPECT_EQ(g.get_node_count(), 10);
+        EXPECT_EQ(g.get_edge_count(), 0);
+    }
+    {   // p == 1: complete graph
+        gtpo::graph<> g;
+        gtpo::gnp_random_graph(g, 10, 1.);
+        EXPECT_EQ(g.get_edge_count(), 90);
+    }
+    {   // Expect p * n * (n - 1) edges (+/- 10%), no self loops
+        gtpo::graph<> g;
+        gtpo::gnp_random_graph(g, 2000, 0.002, 42);
+        EXPECT_EQ(g.get_node_count(), 2000);
+        const double expected = 0.002 * 2000 * 1999;
+        EXPECT_GT(g.get_edge_count(), 0.9 * expected);
+        EXPECT_LT(g.get_edge_count(), 1.1 * expected);
+        EXPECT_FALSE(has_self_loop(g));
+
+        // Same seed, same topology
+        gtpo::graph<> g2;
+        gtpo::erdos_renyi_graph(g2, 2000, 0.002, 42);
+        EXPECT_EQ(g.get_edge_count(), g2.get_edge_count());
+    }
+}
+
+TEST(GTpoGenerator, random_dag)
+{
+    {
+        gtpo::graph<> g;
+        gtpo::random_dag(g, 10, 1.);
+        EXPECT_EQ(g.get_edge_count(), 45);
+        EXPECT_TRUE(gtpo::is_dag(g));
+    }
+    {
+        gtpo::graph<> g;
+        gtpo::random_dag(g, 2000, 0.004, 42);
+        EXPECT_EQ(g.get_node_count(), 2000);
+        const double expected = 0.004 * 2000 * 1999 / 2.;
+        EXPECT_GT(g.get_edge_count(), 0.9 * expected);
+        EXPECT_LT(g.get_edge_count(), 1.1 * expected);
+        EXPECT_TRUE(gtpo::is_dag(g));
+    }
+}
+
+TEST(GTpoGenerator, barabasi_albert_graph)
+{
+    {   // Expect: no generation with invalid m
+        gtpo::graph<> g;
+        gtpo::barabasi_albert_graph(g, 10, 0);
+        EXPECT_TRUE(g.is_empty());
+        gtpo::barabasi_albert_graph(g, 10, 10);
+        EXPECT_TRUE(g.is_empty());
+    }
+    {   // Expect: (n - m) * m edges, no parallel edges
+        gtpo::graph<> g;
+        gtpo::barabasi_albert_graph(g, 1000, 3, 42);
+        EXPECT_EQ(g.get_node_count(), 1000);
+        EXPECT_EQ(g.get_edge_count(), (1000 - 3) * 3);
+        EXPECT_TRUE(gtpo::is_dag(g));
+        for ( const auto& node : g.get_nodes() ) {
+            std::unordered_set<const gtpo::graph<>::node_t*> dsts;
+            for ( const auto& out_node : node->get_out_nodes() )
+                EXPECT_TRUE(dsts.insert(out_node.lock().get()).second);
+        }
+    }
+}
+
+TEST(GTpoGenerator, grid_graph)
+{
+    {   // Expect: g = { [n0, n1, n2, n3], [(n0->n1), (n0->n2), (n1->n3), (n2->n3)] }
+        gtpo::graph<> g;
+        gtpo::grid_graph(g, 2, 2);
+        ASSERT_EQ(g.get_node_count(), 4);
+        ASSERT_EQ(g.get_edge_count(), 4);
+        const auto& nodes = g.get_nodes();
+        EXPECT_TRUE(g.has_edge(nodes[0], nodes[1]));
+        EXPECT_TRUE(g.has_edge(nodes[0], nodes[2]));
+        EXPECT_TRUE(g.has_edge(nodes[1], nodes[3]));
+        EXPECT_TRUE(g.has_edge(nodes[2], nodes[3]));
+    }
+    {
+        gtpo::graph<> g;
+        gtpo::grid_graph(g, 3, 4);
+        EXPECT_EQ(g.get_node_count(), 12);
+        EXPECT_EQ(g.get_edge_count(), 3 * 3 + 2 * 4);
+        EXPECT_EQ(g.get_root_nodes().size(), 1);
+    }
+}
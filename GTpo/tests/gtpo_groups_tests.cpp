@@ -301,3 +301,86 @@ TEST(GTpoGroups, adjacentEdges)
     g.clear();
 }
 
+//-----------------------------------------------------------------------------
+// GTpo Group behaviour tests
+//-----------------------------------------------------------------------------
+
+template < class config_t = gtpo::default_config >
+class GroupBehaviourMock : public gtpo::dynamic_group_behaviour< config_t >
+{
+public:
+    GroupBehaviourMock() { }
+    virtual ~GroupBehaviourMock() { }
+
+    using weak_node_t      = std::weak_ptr< typename config_t::final_node_t >;
+    using weak_edge_t      = std::weak_ptr< typename config_t::final_edge_t >;
+    using weak_group_t     = std::weak_ptr< typename config_t::final_group_t >;
+
+protected:
+    virtual void    on_node_inserted( weak_node_t& ) noexcept override { mockNodeInserted(); }
+    virtual void    on_node_removed( weak_node_t& ) noexcept override { mockNodeRemoved(); }
+    virtual void    on_group_inserted( weak_group_t& ) noexcept override { mockGroupInserted(); }
+    virtual void    on_group_removed( weak_group_t& ) noexcept override { mockGroupRemoved(); }
+
+public:
+    MOCK_METHOD0(mockNodeInserted, void(void));
+    MOCK_METHOD0(mockNodeRemoved, void(void));
+    MOCK_METHOD0(mockGroupInserted, void(void));
+    MOCK_METHOD0(mockGroupRemoved, void(void));
+};
+
+// FIXME groups:
+    // A contract should enforce the behaviour when a grouped node or edge is actually
+    // removed from topology, is a group edge_removed() or node_removed() signal emitted ?
+
+TEST(GTpoBehaviour, groupBehaviourNodeInserted)
+{
+    gtpo::graph<> g;
+    using MockGroupBehaviour = GroupBehaviourMock<>;
+    auto group = g.create_group();
+    auto n = g.create_node();
+
+    ASSERT_TRUE(group.lock());
+    auto groupMockBehaviour = new MockGroupBehaviour(); // Can't use unique_ptr here because of gmock
+    group.lock()->add_dynamic_group_behaviour( std::unique_ptr<MockGroupBehaviour>(groupMockBehaviour) );
+
+    // node_inserted() notification
+    EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(1);
+    g.group_node(n, group);
+    //EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(0);
+
+    // node_removed() notification
+    EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(1);
+    g.ungroup_node(n, group);
+    //EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(0);
+
+    // When a node is removed from graph, it is automatically ungrouped,
+    // we expect the group behaviour to be notified that the node is removed...
+    EXPECT_CALL(*groupMockBehaviour, mockNodeInserted()).Times(1);
+    g.group_node(n, group);
+    EXPECT_CALL(*groupMockBehaviour, mockNodeRemoved()).Times(1);
+    g.remove_node(n);
+}
+
+TEST(GTpoBehaviour, groupBehaviourGroupInserted)
+{
+    gtpo::graph<> g;
+    using MockGroupBehaviour = GroupBehaviourMock< gtpo::graph<>::configuration >;
+    auto group = g.create_group();
+    auto n = g.create_node();
+
+    ASSERT_TRUE(group.lock());
+    auto groupMockBehaviour = new MockGroupBehaviour(); // Can't use unique_ptr here because of gmock
+    group.lock()->add_dynamic_group_behaviour( std::unique_ptr<MockGroupBehaviour>(groupMockBehaviour) );
+
+    // node_inserted() notification
+    using weak_group_t = gtpo::group<>::weak_group_t;
+    auto group2 = g.create_group();
+    EXPECT_CALL(*groupMockBehaviour, mockGroupInserted()).Times(1);
+    g.group_node(weak_group_t{group2}, group);
+
+    // group_removed() notification
+    EXPECT_CALL(*groupMockBehaviour, mockGroupRemoved()).Times(1);
+    g.ungroup_node(weak_group_t{group2}, group);
+}
+
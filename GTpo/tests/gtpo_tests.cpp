@@ -49,6 +49,15 @@ TEST(GTpoUtils, assertThrow)
 {
     EXPECT_THROW( gtpo::assert_throw(false, "" ), gtpo::bad_topology_error );
     EXPECT_NO_THROW( gtpo::assert_throw(true, "" ) );
+    EXPECT_THROW( gtpo::assert_throw(false, std::string{"message"} ), gtpo::bad_topology_error );
+
+    // Lazy message builder is only called on failure
+    int built = 0;
+    const auto build = [&built]() { ++built; return std::string{"message"}; };
+    EXPECT_NO_THROW( gtpo::assert_throw_lazy(true, build) );
+    EXPECT_EQ( built, 0 );
+    EXPECT_THROW( gtpo::assert_throw_lazy<std::invalid_argument>(false, build), std::invalid_argument );
+    EXPECT_EQ( built, 1 );
 }
 
 
@@ -35,10 +35,16 @@
 // STD headers
 #include <list>
 #include <memory>
+#include <type_traits>
+#include <unordered_set>
 #include <iostream>
+#include <thread>
+#include <atomic>
+#include <vector>
 
 // GTpo headers
 #include <GTpo>
+#include <../src/algorithm.h>
 
 // Google Test
 #include <gtest/gtest.h>
@@ -87,6 +93,178 @@ TEST(GTpoTopology, remove_nodeCount)
     g.clear();
 }
 
+TEST(GTpoTopology, nodeEdgeBatchInsert)
+{
+    // insert_nodes() / insert_edges() should lead to the same topology than insert_node() / insert_edge()
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::shared_node_t> nodes;
+    for ( int n = 0; n < 4; ++n )
+        nodes.push_back( std::make_shared<gtpo::graph<>::node_t>() );
+    g.insert_nodes( nodes.cbegin(), nodes.cend() );
+    EXPECT_EQ( g.get_node_count(), 4 );
+    EXPECT_EQ( g.get_root_node_count(), 4 );
+    EXPECT_TRUE( g.contains( nodes[2] ) );
+
+    std::vector<gtpo::graph<>::shared_edge_t> edges;
+    edges.push_back( std::make_shared<gtpo::edge<>>(nodes[0], nodes[1]) );
+    edges.push_back( std::make_shared<gtpo::edge<>>(nodes[0], nodes[2]) );
+    edges.push_back( std::make_shared<gtpo::edge<>>(nodes[1], nodes[2]) );
+    edges.push_back( std::make_shared<gtpo::edge<>>(nodes[3], nodes[3]) );  // Trivial circuit
+    g.insert_edges( edges.cbegin(), edges.cend() );
+    EXPECT_EQ( g.get_edge_count(), 4 );
+    EXPECT_EQ( g.get_root_node_count(), 2 );    // nodes[0] and nodes[3]
+    EXPECT_TRUE( g.is_root_node( nodes[0] ) );
+    EXPECT_FALSE( g.is_root_node( nodes[2] ) );
+    EXPECT_EQ( nodes[2]->get_in_degree(), 2 );
+    EXPECT_TRUE( g.has_edge( nodes[1], nodes[2] ) );
+
+    std::vector<gtpo::graph<>::shared_edge_t> badEdges{ std::make_shared<gtpo::edge<>>() };
+    EXPECT_THROW( g.insert_edges( badEdges.cbegin(), badEdges.cend() ), gtpo::bad_topology_error );
+    EXPECT_EQ( g.get_edge_count(), 4 );     // Range is checked before graph is modified
+    g.clear();
+}
+
+TEST(GTpoTopology, rootNodeBookkeeping)
+{
+    // Root nodes are swap erased: is_root_node() and root node count must stay coherent under edge churn
+    gtpo::graph<> g;
+    std::vector<gtpo::graph<>::weak_node_t> nodes;
+    for ( int n = 0; n < 5; ++n )
+        nodes.push_back( g.create_node() );
+    auto e1 = g.create_edge( nodes[0], nodes[1] );   // Erase a root in the middle of root nodes
+    auto e2 = g.create_edge( nodes[0], nodes[4] );   // Erase last root node
+    EXPECT_EQ( g.get_root_node_count(), 3 );
+    EXPECT_TRUE( g.is_root_node( nodes[3] ) );
+    EXPECT_FALSE( g.is_root_node( nodes[1] ) );
+    g.create_edge( nodes[2], nodes[1] );
+    g.remove_edge( e1 );
+    EXPECT_FALSE( g.is_root_node( nodes[1] ) );      // nodes[2] -> nodes[1] remains
+    g.remove_edge( e2 );
+    EXPECT_TRUE( g.is_root_node( nodes[4] ) );
+    EXPECT_EQ( g.get_root_node_count(), 4 );        // nodes[0] is not inserted twice
+    g.install_root_node( nodes[4] );                 // No effect on an existing root node
+    EXPECT_EQ( g.get_root_node_count(), 4 );
+    for ( const auto& root : g.get_root_nodes() )
+        EXPECT_TRUE( g.is_root_node( root ) );
+    g.clear();
+}
+
+TEST(GTpoTopology, nodeEdgeUncheckedInsert)
+{
+    // Unchecked insertion should lead to the same topology than checked insertion
+    gtpo::graph<> g;
+    auto n1 = std::make_shared<gtpo::graph<>::node_t>();
+    g.insert_node_unchecked( n1 );
+    std::vector<gtpo::graph<>::shared_node_t> nodes{ std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>() };
+    g.insert_nodes_unchecked( nodes.cbegin(), nodes.cend() );
+    EXPECT_EQ( g.get_node_count(), 3 );
+    EXPECT_EQ( g.get_root_node_count(), 3 );
+    EXPECT_TRUE( g.contains( nodes[1] ) );
+
+    g.insert_edge_unchecked( std::make_shared<gtpo::edge<>>(n1, nodes[0]) );
+    std::vector<gtpo::graph<>::shared_edge_t> edges{ std::make_shared<gtpo::edge<>>(nodes[0], nodes[1]),
+                                                     std::make_shared<gtpo::edge<>>(nodes[1], nodes[1]) };
+    g.insert_edges_unchecked( edges.cbegin(), edges.cend() );
+    EXPECT_EQ( g.get_edge_count(), 3 );
+    EXPECT_EQ( g.get_root_node_count(), 1 );    // n1
+    EXPECT_TRUE( g.is_root_node( n1 ) );
+    EXPECT_EQ( nodes[1]->get_in_degree(), 2 );
+    EXPECT_TRUE( g.has_edge( nodes[0], nodes[1] ) );
+    g.clear();
+}
+
+TEST(GTpoTopology, edgeAdoptLinked)
+{
+    // Edges linked to their nodes outside of graph should lead to the same topology than insert_edges()
+    std::vector<gtpo::graph<>::shared_node_t> nodes{ std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>(),
+                                                     std::make_shared<gtpo::graph<>::node_t>() };
+    std::vector<gtpo::graph<>::shared_edge_t> edges{ std::make_shared<gtpo::edge<>>(nodes[0], nodes[1]),
+                                                     std::make_shared<gtpo::edge<>>(nodes[1], nodes[2]),
+                                                     std::make_shared<gtpo::edge<>>(nodes[2], nodes[2]) };
+    for ( const auto& edge : edges ) {
+        edge->get_src().lock()->add_out_edge( edge );
+        edge->get_dst().lock()->add_in_edge( edge );
+    }
+    gtpo::graph<> g;
+    g.insert_nodes_unchecked( nodes.cbegin(), nodes.cend() );
+    g.adopt_edges_unchecked( edges.cbegin(), edges.cend() );
+    EXPECT_EQ( g.get_edge_count(), 3 );
+    EXPECT_EQ( g.get_root_node_count(), 1 );
+    EXPECT_TRUE( g.is_root_node( nodes[0] ) );
+    EXPECT_EQ( nodes[1]->get_out_degree(), 1 );     // Adjacency is not linked twice
+    EXPECT_EQ( nodes[2]->get_in_degree(), 2 );
+    EXPECT_TRUE( g.has_edge( nodes[0], nodes[1] ) );
+    g.remove_node( nodes[1] );
+    EXPECT_EQ( g.get_edge_count(), 1 );
+    EXPECT_EQ( nodes[0]->get_out_degree(), 0 );
+    g.clear();
+}
+
+TEST(GTpoTopology, removeNodesBatch)
+{
+    // remove_nodes() must remove victims and their adjacent edges, surviving nodes topology must be updated
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto n4 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n3, n2);      // Edge between two victims
+    g.create_edge(n3, n4);
+    g.create_edge(n1, n4);
+    EXPECT_EQ( g.get_edge_count(), 5 );
+
+    std::vector<gtpo::graph<>::weak_node_t> victims{ n2, n3, n2 };   // Duplicates are ignored
+    g.remove_nodes( victims.cbegin(), victims.cend() );
+    EXPECT_TRUE( n2.expired() );
+    EXPECT_TRUE( n3.expired() );
+    EXPECT_EQ( g.get_node_count(), 2 );
+    EXPECT_EQ( g.get_edge_count(), 1 );
+    EXPECT_TRUE( g.has_edge(n1, n4) );
+    EXPECT_EQ( n1.lock()->get_out_degree(), 1 );
+    EXPECT_EQ( n4.lock()->get_in_degree(), 1 );
+    EXPECT_TRUE( g.is_root_node(n1) );
+    EXPECT_FALSE( g.is_root_node(n4) );
+
+    std::vector<gtpo::graph<>::weak_node_t> expired{ n2 };
+    EXPECT_THROW( g.remove_nodes( expired.cbegin(), expired.cend() ), gtpo::bad_topology_error );
+    g.clear();
+}
+
+struct pool_allocator_config : public gtpo::config<pool_allocator_config>
+{
+    template <class T>
+    using node_allocator_t = gtpo::pool_allocator<T>;
+    template <class T>
+    using edge_allocator_t = gtpo::pool_allocator<T>;
+};
+
+TEST(GTpoTopology, nodeEdgePoolAllocator)
+{
+    // Nodes and edges allocated with gtpo::pool_allocator must behave like std::allocator ones
+    gtpo::graph<pool_allocator_config>::weak_node_t n3;
+    {
+        gtpo::graph<pool_allocator_config> g;
+        auto n1 = g.create_node();
+        auto n2 = g.create_node();
+        auto e1 = g.create_edge(n1, n2);
+        EXPECT_EQ( g.get_node_count(), 2 );
+        EXPECT_TRUE( g.has_edge(n1, n2) );
+        g.remove_edge(e1);
+        g.remove_node(n2);
+        EXPECT_TRUE( n2.expired() );
+        n2 = g.create_node();               // Reuse a recycled block
+        g.create_edge(n1, n2);
+        EXPECT_EQ( g.get_edge_count(), 1 );
+        n3 = g.create_node();
+        EXPECT_EQ( g.get_node_allocator().get_resource(), g.get_node_allocator().get_resource() );
+    }
+    EXPECT_TRUE( n3.expired() );
+}
+
 //-----------------------------------------------------------------------------
 // Graph clear tests
 //-----------------------------------------------------------------------------
@@ -119,7 +297,7 @@ TEST(GTpoTopology, graphClearNodeEdge)
     gtpo::graph<> g;
     auto n1 = g.create_node();
     auto n2 = g.create_node();
-    auto e1 = g.create_edge<gtpo::edge<>>(n1, n2);
+    auto e1 = g.create_edge(n1, n2);
     EXPECT_EQ( g.get_node_count(), 2 );
     EXPECT_TRUE( g.contains(e1) );
     g.clear();
@@ -289,6 +467,185 @@ TEST(GTpoTopology, edgeInsertparallel)
     }
 }
 
+struct adjacency_index_config : public gtpo::config<adjacency_index_config>
+{
+    static constexpr bool   enable_adjacency_index = true;
+};
+
+TEST(GTpoTopology, edgeAdjacencyIndex)
+{
+    // find_edge(), has_edge() and get_edge_count() must give the same results with config_t::enable_adjacency_index
+    gtpo::graph<adjacency_index_config> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    EXPECT_FALSE( g.has_edge(n1, n2) );
+    auto e1 = g.create_edge(n1, n2);
+    g.create_edge(n2, n3);
+    g.create_edge(n2, n3);
+    EXPECT_TRUE( g.has_edge(n1, n2) );
+    EXPECT_FALSE( g.has_edge(n2, n1) );
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>( g.find_edge(n1, n2), e1 ) );
+    EXPECT_EQ( g.find_edge(n1.lock()->get_id(), n2.lock()->get_id()), e1.lock()->get_id() );
+    EXPECT_FALSE( g.find_edge(n2.lock()->get_id(), n1.lock()->get_id()).is_valid() );
+    EXPECT_EQ( g.get_edge_count(n2, n3), 2 );
+    g.remove_edge(n2, n3);
+    EXPECT_EQ( g.get_edge_count(n2, n3), 1 );
+    g.remove_node(n3);          // Index must be updated when edges are removed with their nodes
+    EXPECT_EQ( g.get_edge_count(n2, n3), 0 );
+    EXPECT_EQ( n2.lock()->get_out_degree(), 0 );
+    g.remove_edge(e1);
+    EXPECT_FALSE( g.has_edge(n1, n2) );
+    EXPECT_TRUE( g.find_edge(n1, n2).expired() );
+}
+
+template <class graph_t>
+static void checkForEachOutEdge()
+{
+    graph_t g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto e1 = g.create_edge(n1, n2);
+    auto e2 = g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    g.create_edge(n2, n1);      // Reverse edges are not out edges of n1
+    std::vector<decltype(e1)> parallels;
+    const auto collect = [&parallels](const auto& edge) { parallels.push_back(edge); };
+    n1.lock()->for_each_out_edge(n2.lock().get(), collect);
+    ASSERT_EQ( parallels.size(), 2 );
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>(parallels[0], e1) || gtpo::compare_weak_ptr<>(parallels[1], e1) );
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>(parallels[0], e2) || gtpo::compare_weak_ptr<>(parallels[1], e2) );
+    parallels.clear();
+    g.remove_edge(e1);
+    n1.lock()->for_each_out_edge(n2.lock().get(), collect);
+    ASSERT_EQ( parallels.size(), 1 );
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>(parallels[0], e2) );
+    parallels.clear();
+    n1.lock()->for_each_out_edge(nullptr, collect);
+    EXPECT_TRUE( parallels.empty() );
+}
+
+TEST(GTpoTopology, forEachOutEdge)
+{
+    // for_each_out_edge() must enumerate the same parallel edges with or without config_t::enable_adjacency_index
+    checkForEachOutEdge<gtpo::graph<adjacency_index_config>>();
+    checkForEachOutEdge<gtpo::graph<>>();
+}
+
+struct lean_adjacency_config : public gtpo::config<lean_adjacency_config>
+{
+    static constexpr bool   enable_node_lists = false;
+};
+
+TEST(GTpoTopology, edgeLeanAdjacency)
+{
+    // With config_t::enable_node_lists set to false, in/out nodes are projected from in/out edges
+    EXPECT_LT( sizeof(gtpo::node<lean_adjacency_config>), sizeof(gtpo::node<gtpo::graph<>::final_config_t>) );
+    gtpo::graph<lean_adjacency_config> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    g.create_edge(n1, n2);
+    g.create_edge(n1, n3);
+    g.create_edge(n1, n3);      // Parallel edges are projected twice
+    auto node1 = n1.lock();
+    auto node3 = n3.lock();
+    EXPECT_EQ( node1->get_out_nodes().size(), 3 );
+    EXPECT_EQ( node3->get_in_nodes().size(), 2 );
+    EXPECT_TRUE( node1->get_in_nodes().empty() );
+    auto out_node = node1->get_out_nodes().cbegin();
+    EXPECT_TRUE( gtpo::compare_weak_ptr<>( *out_node, n2 ) );
+    EXPECT_EQ( (++out_node)->lock(), node3 );
+    for ( const auto& in_node : node3->get_in_nodes() )
+        EXPECT_TRUE( gtpo::compare_weak_ptr<>( in_node, n1 ) );
+
+    EXPECT_TRUE( gtpo::is_dag(g) );
+    EXPECT_EQ( gtpo::linearize_dfs(g).size(), 3 );
+    EXPECT_EQ( gtpo::tree_depth(g), 2 );
+
+    g.remove_edge(n1, n3);
+    EXPECT_EQ( node1->get_out_nodes().size(), 2 );
+    g.remove_node(n2);
+    EXPECT_EQ( node1->get_out_nodes().size(), 1 );
+    g.create_edge(n3, n1);
+    EXPECT_FALSE( gtpo::is_dag(g) );
+}
+
+struct adjacent_containers_config : public gtpo::config<adjacent_containers_config>
+{
+    template <class...Ts>
+    using adjacent_edges_container_t = std::list<Ts...>;
+    template <class...Ts>
+    using adjacent_nodes_container_t = std::list<Ts...>;
+};
+
+TEST(GTpoTopology, edgeAdjacentContainers)
+{
+    // Node adjacency default to config_t edge_container_t, and use config_t::adjacent_edges_container_t when defined
+    using default_node_t = gtpo::node<gtpo::graph<>::final_config_t>;
+    EXPECT_TRUE( (std::is_same<default_node_t::weak_edges_t, gtpo::graph<>::weak_edges_t>::value) );
+    using adjacent_node_t = gtpo::node<adjacent_containers_config>;
+    EXPECT_TRUE( (std::is_same<adjacent_node_t::weak_edges_t, std::list<adjacent_node_t::weak_edge_t>>::value) );
+    EXPECT_TRUE( (std::is_same<std::decay_t<adjacent_node_t::out_nodes_t>, std::list<adjacent_node_t::weak_node_t>>::value) );
+    EXPECT_TRUE( (std::is_same<adjacent_node_t::weak_nodes_t, std::vector<adjacent_node_t::weak_node_t>>::value) );  // Groups
+}
+
+struct concurrent_config : public gtpo::config<concurrent_config>
+{
+    using concurrency_policy = gtpo::shared_mutex_concurrency;
+};
+
+TEST(GTpoTopology, concurrentReadersWriter)
+{
+    // Readers must never see a partially inserted (or removed) batch of two opposite edges
+    using graph_t = gtpo::graph<concurrent_config>;
+    graph_t g;
+    std::vector<graph_t::weak_node_t> nodes;
+    for (int n = 0; n < 16; ++n)
+        nodes.push_back(g.create_node());
+    std::atomic<bool> done{false};
+    std::atomic<int>  torn{0};
+    std::atomic<int>  reads{0};
+    const auto reader = [&]() {
+        while (!done.load()) {
+            const auto lock = g.read_lock();
+            std::size_t out_degrees = 0;
+            for (const auto& node : g.get_nodes()) {
+                out_degrees += node->get_out_edges().size();
+                for (const auto& out_node : node->get_out_nodes())
+                    if (!g.has_edge(out_node, node))
+                        ++torn;
+            }
+            if (g.get_edge_count() % 2 != 0 ||
+                out_degrees != g.get_edge_count())
+                ++torn;
+            ++reads;
+        }
+    };
+    std::thread r1{reader};
+    std::thread r2{reader};
+    for (int b = 0; b < 2000; ++b) {
+        const auto lock = g.write_lock();   // Mutators lock again (reentrant for writer thread)
+        const auto& src = nodes[static_cast<std::size_t>(b) % nodes.size()];
+        const auto& dst = nodes[static_cast<std::size_t>(b * 7 + 3) % nodes.size()];
+        if (g.has_edge(src, dst)) {
+            g.remove_edge(src, dst);
+            EXPECT_TRUE( g.read_lock().owns_lock() );   // Writer thread might read while writing
+            g.remove_edge(dst, src);
+        } else {
+            g.create_edge(src, dst);
+            g.create_edge(dst, src);
+        }
+    }
+    while (reads.load() < 100)
+        std::this_thread::yield();
+    done = true;
+    r1.join();
+    r2.join();
+    EXPECT_EQ( torn.load(), 0 );
+}
+
 TEST(GTpoTopology, edgeRemoveContains)
 {
     // Graph must no longer contains() an edge that has been removed
@@ -369,3 +726,245 @@ TEST(GTpoTopology, remove_nodeInOutDegree)
     EXPECT_EQ( n1->get_out_degree(), 0 );
     EXPECT_EQ( n3->get_in_degree(), 0 );
 }
+
+TEST(GTpoTopology, hyperEdgeCreateFind)
+{
+    // Restricted hyper edges are indexed on their destination edge, not inserted in graph edges
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto e1 = g.create_edge(n1, n2);
+    auto he1 = g.create_edge(n3, e1);
+    ASSERT_FALSE( he1.expired() );
+    EXPECT_TRUE( he1.lock()->is_hyper() );
+    EXPECT_FALSE( e1.lock()->is_hyper() );
+    EXPECT_EQ( g.get_edge_count(), 1 );
+    EXPECT_EQ( g.get_hyper_edge_count(), 1 );
+    EXPECT_EQ( e1.lock()->get_in_hdegree(), 1 );
+    EXPECT_EQ( n3.lock()->get_out_hedges().size(), 1 );
+    EXPECT_EQ( n3.lock()->get_out_degree(), 0 );    // Hyper edges are not part of node adjacency
+    EXPECT_EQ( g.find_edge(n3, e1).lock(), he1.lock() );
+    EXPECT_TRUE( g.has_edge(n3, e1) );
+    EXPECT_FALSE( g.has_edge(n1, e1) );
+    EXPECT_TRUE( g.is_root_node(n3) );
+
+    ASSERT_THROW( g.create_edge(n3, gtpo::graph<>::weak_edge_t{}), gtpo::bad_topology_error );
+}
+
+TEST(GTpoTopology, hyperEdgeRemoveCascade)
+{
+    // Removing an edge (or a node) remove hyper edges depending on it, recursively
+    gtpo::graph<> g;
+    auto n1 = g.create_node();
+    auto n2 = g.create_node();
+    auto n3 = g.create_node();
+    auto e1 = g.create_edge(n1, n2);
+    auto e2 = g.create_edge(n2, n3);
+    auto he1 = g.create_edge(n3, e1);
+    auto he2 = g.create_edge(n1, he1);  // Hyper edge on hyper edge
+    auto he3 = g.create_edge(n1, e2);
+    EXPECT_EQ( g.get_hyper_edge_count(), 3 );
+    EXPECT_EQ( n1.lock()->get_out_hedges().size(), 2 );
+
+    g.remove_edge(he2);
+    EXPECT_EQ( g.get_hyper_edge_count(), 2 );
+    EXPECT_EQ( he1.lock()->get_in_hdegree(), 0 );
+    EXPECT_EQ( n1.lock()->get_out_hedges().size(), 1 );
+
+    he2 = g.create_edge(n1, he1);
+    g.remove_edge(e1);                  // he1 and he2 are removed with e1
+    EXPECT_TRUE( he1.expired() );
+    EXPECT_TRUE( he2.expired() );
+    EXPECT_EQ( g.get_hyper_edge_count(), 1 );
+    EXPECT_EQ( n3.lock()->get_out_hedges().size(), 0 );
+    EXPECT_EQ( n1.lock()->get_out_hedges().size(), 1 );
+
+    g.remove_node(n1);                  // he3 source is n1
+    EXPECT_TRUE( he3.expired() );
+    EXPECT_EQ( g.get_hyper_edge_count(), 0 );
+    EXPECT_EQ( e2.lock()->get_in_hdegree(), 0 );
+}
+
+//-----------------------------------------------------------------------------
+// Graph handles tests
+//-----------------------------------------------------------------------------
+
+TEST(GTpoTopology, handleNodeId)
+{
+    gtpo::graph<> g;
+    EXPECT_FALSE( gtpo::node_id{}.is_valid() );
+    EXPECT_EQ( g.get_node( gtpo::node_id{} ), nullptr );
+    auto n1 = g.create_node().lock();
+    auto n2 = g.create_node().lock();
+    const auto id1 = n1->get_id();
+    const auto id2 = n2->get_id();
+    EXPECT_TRUE( id1.is_valid() );
+    EXPECT_TRUE( id2.is_valid() );
+    EXPECT_NE( id1, id2 );
+    EXPECT_EQ( g.get_node( id1 ), n1.get() );
+    EXPECT_EQ( g.get_node( id2 ), n2.get() );
+    EXPECT_TRUE( g.contains( id1 ) );
+    EXPECT_EQ( g.find_node( id1 ).lock(), n1 );
+
+    // Removed node handle is stale, and a recycled slot does not alias the removed node
+    g.remove_node( id1 );
+    EXPECT_FALSE( n1->get_id().is_valid() );
+    EXPECT_FALSE( g.contains( id1 ) );
+    EXPECT_EQ( g.get_node( id1 ), nullptr );
+    EXPECT_TRUE( g.find_node( id1 ).expired() );
+    auto n3 = g.create_node().lock();
+    EXPECT_EQ( n3->get_id().get_index(), id1.get_index() );
+    EXPECT_NE( n3->get_id(), id1 );
+    EXPECT_EQ( g.get_node( id1 ), nullptr );
+    EXPECT_EQ( g.get_node( n3->get_id() ), n3.get() );
+    EXPECT_THROW( g.remove_node( id1 ), gtpo::bad_topology_error );
+
+    // Clearing graph invalidate all handles
+    g.clear();
+    EXPECT_FALSE( n2->get_id().is_valid() );
+    EXPECT_FALSE( g.contains( id2 ) );
+}
+
+TEST(GTpoTopology, handleEdgeId)
+{
+    gtpo::graph<> g;
+    const auto n1 = g.create_node().lock()->get_id();
+    const auto n2 = g.create_node().lock()->get_id();
+    const auto n3 = g.create_node().lock()->get_id();
+    const auto e1 = g.create_edge( n1, n2 );
+    const auto e2 = g.create_edge( n2, n3 );
+    EXPECT_TRUE( e1.is_valid() );
+    EXPECT_NE( e1, e2 );
+    EXPECT_EQ( g.get_edge_count(), 2 );
+    EXPECT_EQ( g.get_root_node_count(), 1 );
+    EXPECT_EQ( g.find_edge( n1, n2 ), e1 );
+    EXPECT_EQ( g.find_edge( n2, n3 ), e2 );
+    EXPECT_FALSE( g.find_edge( n1, n3 ).is_valid() );
+    EXPECT_TRUE( g.has_edge( g.find_node( n1 ), g.find_node( n2 ) ) );
+    ASSERT_NE( g.get_edge( e1 ), nullptr );
+    EXPECT_EQ( g.get_edge( e1 )->get_src().lock().get(), g.get_node( n1 ) );
+    EXPECT_EQ( g.find_edge( e1 ).lock().get(), g.get_edge( e1 ) );
+
+    // Edge inserted with weak_ptr methods also get an handle
+    const auto e3 = g.create_edge( g.find_node( n1 ), g.find_node( n3 ) ).lock()->get_id();
+    EXPECT_EQ( g.find_edge( n1, n3 ), e3 );
+
+    g.remove_edge( e1 );
+    EXPECT_FALSE( g.contains( e1 ) );
+    EXPECT_EQ( g.get_edge( e1 ), nullptr );
+    EXPECT_FALSE( g.find_edge( n1, n2 ).is_valid() );
+    EXPECT_THROW( g.remove_edge( e1 ), gtpo::bad_topology_error );
+
+    // Removing a node invalidate its adjacent edges handles
+    g.remove_node( n3 );
+    EXPECT_FALSE( g.contains( e2 ) );
+    EXPECT_FALSE( g.contains( e3 ) );
+    EXPECT_EQ( g.get_edge_count(), 0 );
+    EXPECT_THROW( g.create_edge( n1, n3 ), gtpo::bad_topology_error );
+}
+
+TEST(GTpoTopology, handleGenerations)
+{
+    // A slot is retired when its generation is exhausted, stale handles never alias a new node
+    gtpo::graph<> g;
+    auto id = g.create_node().lock()->get_id();
+    const auto index = id.get_index();
+    std::unordered_set<gtpo::node_id> ids;
+    for ( unsigned int i = 0; i < gtpo::node_id::max_generation; ++i ) {
+        EXPECT_TRUE( ids.insert( id ).second );
+        g.remove_node( id );
+        id = g.create_node().lock()->get_id();
+    }
+    EXPECT_NE( id.get_index(), index );
+    for ( const auto& stale : ids )
+        EXPECT_FALSE( g.contains( stale ) );
+    EXPECT_TRUE( g.contains( id ) );
+}
+
+//-----------------------------------------------------------------------------
+// Graph groups tests
+//-----------------------------------------------------------------------------
+
+// Minimal group primitive: a node flagged as a group
+class test_group;
+struct group_test_config : public gtpo::config<group_test_config>
+{
+    using final_group_t = test_group;
+};
+
+class test_group : public gtpo::node<group_test_config>
+{
+public:
+    test_group() : gtpo::node<group_test_config>{} { set_is_group(true); }
+};
+using group_test_graph = gtpo::graph<group_test_config>;
+
+TEST(GTpoTopology, group_nodes)
+{
+    group_test_graph g;
+    auto group = g.insert_group( std::make_shared<test_group>() ).lock();
+    ASSERT_TRUE(group);
+    std::vector<group_test_graph::weak_node_t> nodes;
+    for ( int n = 0; n < 100; ++n )
+        nodes.push_back( g.create_node() );
+
+    g.group_nodes( group, nodes.cbegin(), nodes.cend() );
+    EXPECT_EQ( group->get_node_count(), 100 );
+    for ( const auto& node : nodes ) {
+        EXPECT_TRUE( group->has_node( node ) );
+        EXPECT_EQ( node.lock()->get_group().lock(), group );
+    }
+    // Grouping already grouped nodes is a no-op
+    g.group_nodes( group, nodes.cbegin(), nodes.cbegin() + 10 );
+    g.group_node( nodes.front(), group );
+    EXPECT_EQ( group->get_node_count(), 100 );
+
+    auto n = g.create_node();
+    EXPECT_FALSE( group->has_node( n ) );
+    EXPECT_FALSE( group->has_node( group_test_graph::weak_node_t{} ) );
+}
+
+TEST(GTpoTopology, ungroup_nodes)
+{
+    group_test_graph g;
+    auto group = g.insert_group( std::make_shared<test_group>() ).lock();
+    std::vector<group_test_graph::weak_node_t> nodes;
+    for ( int n = 0; n < 10; ++n )
+        nodes.push_back( g.create_node() );
+    g.group_nodes( group, nodes.cbegin(), nodes.cend() );
+
+    // Ungroup even nodes, group order is preserved for remaining nodes
+    std::vector<group_test_graph::weak_node_t> even;
+    for ( std::size_t n = 0; n < nodes.size(); n += 2 )
+        even.push_back( nodes[n] );
+    g.ungroup_nodes( group, even.cbegin(), even.cend() );
+    EXPECT_EQ( group->get_node_count(), 5 );
+    for ( std::size_t n = 0; n < nodes.size(); ++n ) {
+        EXPECT_EQ( group->has_node( nodes[n] ), n % 2 == 1 );
+        EXPECT_EQ( nodes[n].lock()->get_group().expired(), n % 2 == 0 );
+    }
+    for ( std::size_t n = 0; n < 5; ++n )
+        EXPECT_EQ( group->get_nodes()[n].lock(), nodes[2 * n + 1].lock() );
+
+    // Ungrouping a node that is not part of group throw
+    EXPECT_THROW( g.ungroup_nodes( group, even.cbegin(), even.cbegin() + 1 ), gtpo::bad_topology_error );
+}
+
+TEST(GTpoTopology, removeGroupedNodes)
+{
+    group_test_graph g;
+    auto group = g.insert_group( std::make_shared<test_group>() ).lock();
+    std::vector<group_test_graph::weak_node_t> nodes;
+    for ( int n = 0; n < 10; ++n )
+        nodes.push_back( g.create_node() );
+    g.group_nodes( group, nodes.cbegin(), nodes.cend() );
+
+    // Removed nodes are ungrouped first
+    g.remove_nodes( nodes.cbegin(), nodes.cbegin() + 6 );
+    EXPECT_EQ( group->get_node_count(), 4 );
+    EXPECT_TRUE( group->has_node( nodes[7] ) );
+    g.ungroup_node( nodes[7], group );
+    EXPECT_FALSE( group->has_node( nodes[7] ) );
+    EXPECT_EQ( group->get_node_count(), 3 );
+}
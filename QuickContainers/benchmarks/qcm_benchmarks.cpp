@@ -0,0 +1,387 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of QuickContainers library.
+//
+// \file	qcm_benchmarks.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QGuiApplication>
+#include <QQmlEngine>
+#include <QQmlContext>
+#include <QQmlComponent>
+#include <QQuickItem>
+#include <QVector>
+
+// QuickContainers headers
+#include "../include/QuickContainers.h"
+#include "./qcm_benchmarks.h"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+/*
+ * Available benchmarks:
+ *   - BM_*_append, BM_*_insert, BM_*_remove, BM_*_indexOf: qcm::Container vs plain QVector baseline, with
+ *     and without a model (container model is created on first getModel() access).
+ *   - BM_list_view: QML ListView population for every QObject ItemDispatcher category.
+ *
+ * Compare with a previous build:  ./qcm_benchmarks --benchmark_out_format=csv --benchmark_out=qcm.csv
+ */
+
+using QObjects          = qcm::Container<QVector, QObject*>;
+using SharedQObjects    = qcm::Container<QVector, std::shared_ptr<QObject>>;
+using WeakQObjects      = qcm::Container<QVector, std::weak_ptr<QObject>>;
+
+//! Owner of benchmark items (QObject allocation is not part of measured time).
+struct bench_items {
+    explicit bench_items(int count) {
+        shared.reserve(static_cast<std::size_t>(count));
+        for ( int i = 0; i < count; ++i ) {
+            shared.emplace_back(std::make_shared<QBenchItem>());
+            raw.push_back(shared.back().get());
+        }
+    }
+    std::vector<std::shared_ptr<QObject>>   shared;
+    std::vector<QObject*>                   raw;
+};
+
+enum class modelled : int { no = 0, yes = 1 };
+
+//! Create container model when benchmark second argument is modelled::yes.
+template <class container_t>
+static void    configure(container_t& container, const benchmark::State& state) {
+    if ( static_cast<modelled>(state.range(1)) == modelled::yes )
+        container.getModel();
+}
+
+/* Append *///-----------------------------------------------------------------
+static void BM_qvector_append(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        QVector<QObject*> v;
+        for ( const auto item : items.raw )
+            v.append(item);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_container_append(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        QObjects c;
+        configure(c, state);
+        for ( const auto item : items.raw )
+            c.append(item);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_container_append_range(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        QObjects c;
+        configure(c, state);
+        c.append(items.raw.cbegin(), items.raw.cend());
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_shared_container_append(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        SharedQObjects c;
+        configure(c, state);
+        for ( const auto& item : items.shared )
+            c.append(item);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_weak_container_append(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        WeakQObjects c;
+        configure(c, state);
+        for ( const auto& item : items.shared )
+            c.append(item);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* Insert *///-----------------------------------------------------------------
+static void BM_qvector_insert_front(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        QVector<QObject*> v;
+        for ( const auto item : items.raw )
+            v.insert(0, item);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_container_insert_front(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        QObjects c;
+        configure(c, state);
+        for ( const auto item : items.raw )
+            c.insert(item, 0);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* Remove *///-----------------------------------------------------------------
+static void BM_qvector_remove(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        state.PauseTiming();
+        QVector<QObject*> v;
+        for ( const auto item : items.raw )
+            v.append(item);
+        state.ResumeTiming();
+        for ( const auto item : items.raw )
+            v.removeAll(item);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_container_remove(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        state.PauseTiming();
+        QObjects c;
+        configure(c, state);
+        c.append(items.raw.cbegin(), items.raw.cend());
+        state.ResumeTiming();
+        for ( const auto item : items.raw )
+            c.removeAll(item);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//! Remove items from the back of container (worst case for a linear indexOf(), every row is shifted).
+static void BM_container_remove_indexed_unordered(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    for (auto _ : state) {
+        state.PauseTiming();
+        QObjects c;
+        configure(c, state);
+        c.setIndexed(true);
+        c.append(items.raw.cbegin(), items.raw.cend());
+        state.ResumeTiming();
+        for ( const auto item : items.raw )
+            c.removeUnordered(item);
+        benchmark::DoNotOptimize(c.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* IndexOf *///----------------------------------------------------------------
+static void BM_qvector_indexOf(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    QVector<QObject*> v;
+    for ( const auto item : items.raw )
+        v.append(item);
+    for (auto _ : state) {
+        for ( const auto item : items.raw )
+            benchmark::DoNotOptimize(v.indexOf(item));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//! Model indexOf() (the one used by QML and display role monitoring), second argument is indexed mode.
+static void BM_container_model_indexOf(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    QObjects c;
+    c.setIndexed(state.range(1) != 0);
+    c.append(items.raw.cbegin(), items.raw.cend());
+    const auto model = c.getModel();
+    for (auto _ : state) {
+        for ( const auto item : items.raw )
+            benchmark::DoNotOptimize(model->indexOf(item));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_shared_container_model_indexOf(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    SharedQObjects c;
+    c.setIndexed(state.range(1) != 0);
+    for ( const auto& item : items.shared )
+        c.append(item);
+    const auto model = c.getModel();
+    for (auto _ : state) {
+        for ( const auto item : items.raw )
+            benchmark::DoNotOptimize(model->indexOf(item));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* QML ListView Population *///------------------------------------------------
+static QQmlEngine*  engine = nullptr;
+
+/*! \brief Measure QML ListView creation with a model of \c count items, visible delegates (at most 512) are created synchronously.
+ *
+ * \c fill is called with (container_t&, bench_items&).
+ */
+template <class container_t, class fill_t>
+static void BM_list_view(benchmark::State& state, fill_t fill)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_items items{count};
+    container_t c;
+    fill(c, items);
+    QQmlComponent component{engine};
+    component.setData(QByteArrayLiteral("import QtQuick 2.7\n"
+                                        "ListView {\n"
+                                        "  width: 100; height: 512\n"
+                                        "  delegate: Item { width: 100; height: 1; property var item: itemData }\n"
+                                        "}\n"), QUrl{});
+    if ( component.isError() ) {
+        state.SkipWithError(qPrintable(component.errorString()));
+        return;
+    }
+    for (auto _ : state) {
+        auto context = std::make_unique<QQmlContext>(engine->rootContext());
+        std::unique_ptr<QObject> view{component.beginCreate(context.get())};
+        view->setProperty("model", QVariant::fromValue(c.getModel()));
+        component.completeCreate();
+        QMetaObject::invokeMethod(view.get(), "forceLayout");
+        benchmark::DoNotOptimize(view->property("count"));
+    }
+    state.SetItemsProcessed(state.iterations() * std::min(count, 512));
+}
+
+static void BM_list_view_ptr_qobject(benchmark::State& state)
+{
+    BM_list_view<QObjects>(state, [](QObjects& c, bench_items& items) {
+        c.append(items.raw.cbegin(), items.raw.cend());
+    });
+}
+
+static void BM_list_view_shared_ptr_qobject(benchmark::State& state)
+{
+    BM_list_view<SharedQObjects>(state, [](SharedQObjects& c, bench_items& items) {
+        c.append(items.shared.cbegin(), items.shared.cend());
+    });
+}
+
+static void BM_list_view_weak_ptr_qobject(benchmark::State& state)
+{
+    // Note: state items are kept alive for the whole benchmark, weak items never expire.
+    BM_list_view<WeakQObjects>(state, [](WeakQObjects& c, bench_items& items) {
+        for ( const auto& item : items.shared )
+            c.append(item);
+    });
+}
+//-----------------------------------------------------------------------------
+
+static void container_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgsProduct({{1 << 10, 1 << 14, 1 << 17}, {static_cast<int>(modelled::no), static_cast<int>(modelled::yes)}});
+}
+
+BENCHMARK(BM_qvector_append)->RangeMultiplier(16)->Range(1 << 10, 1 << 17);
+BENCHMARK(BM_container_append)->Apply(container_sizes);
+BENCHMARK(BM_container_append_range)->Apply(container_sizes);
+BENCHMARK(BM_shared_container_append)->Apply(container_sizes);
+BENCHMARK(BM_weak_container_append)->Apply(container_sizes);
+
+// Front insertion and linear removal are quadratic, keep sizes small
+BENCHMARK(BM_qvector_insert_front)->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_container_insert_front)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 1}});
+BENCHMARK(BM_qvector_remove)->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_container_remove)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 1}});
+BENCHMARK(BM_container_remove_indexed_unordered)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 1}});
+
+BENCHMARK(BM_qvector_indexOf)->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_container_model_indexOf)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 1}});
+BENCHMARK(BM_shared_container_model_indexOf)->ArgsProduct({{1 << 8, 1 << 10, 1 << 12}, {0, 1}});
+
+BENCHMARK(BM_list_view_ptr_qobject)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_list_view_shared_ptr_qobject)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_list_view_weak_ptr_qobject)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // ListView benchmarks require a GUI application (use -platform offscreen on headless hosts)
+    QGuiApplication app{argc, argv};
+    QQmlEngine qmlEngine;
+    engine = &qmlEngine;
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    engine = nullptr;
+    return 0;
+}
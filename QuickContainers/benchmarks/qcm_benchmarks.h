@@ -0,0 +1,62 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of QuickContainers library.
+//
+// \file	qcm_benchmarks.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef qcm_benchmarks_h
+#define qcm_benchmarks_h
+
+// Qt headers
+#include <QObject>
+#include <QString>
+
+//! Benchmark item exposing a notifiable display role (default qcm::ContainerModel "label" property).
+class QBenchItem : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QBenchItem( QObject* parent = nullptr ) : QObject{ parent } { }
+    virtual ~QBenchItem() override = default;
+private:
+    Q_DISABLE_COPY(QBenchItem)
+
+public:
+    Q_PROPERTY( QString label READ getLabel WRITE setLabel NOTIFY labelChanged )
+    const QString&  getLabel() const { return _label; }
+    void            setLabel(const QString& label ){ _label = label; emit labelChanged(); }
+protected:
+    QString         _label{QStringLiteral("Label")};
+signals:
+    void            labelChanged( );
+};
+
+#endif // qcm_benchmarks_h
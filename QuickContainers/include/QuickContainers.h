@@ -41,6 +41,7 @@
 // QuickContainers headers
 #include "qcmAbstractContainer.h"
 #include "qcmContainer.h"
+#include "qcmContainerView.h"
 
 struct QuickContainers {
     static void initialize() {
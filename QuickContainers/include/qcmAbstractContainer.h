@@ -66,19 +66,27 @@ public:
     template <typename... Args>         // std::forward<As>(a)...
     inline void    fwdBeginInsertRows(Args... args) noexcept { _model->fwdBeginInsertRows(std::forward<Args>(args)...); }
     inline void    fwdEndInsertRows() noexcept { _model->fwdEndInsertRows(); }
-    inline void    fwdEmitLengthChanged() noexcept { _model->fwdEmitLengthChanged(); }
+    inline void    fwdEmitLengthChanged() noexcept { _model->fwdEmitLengthChanged(); emit lengthChanged(); }
 
     template <typename... Args>         // std::forward<As>(a)...
     inline void    fwdBeginRemoveRows(Args... args) noexcept { _model->fwdBeginRemoveRows(std::forward<Args>(args)...); }
     inline void    fwdEndRemoveRows() noexcept { _model->fwdEndRemoveRows(); }
     inline void    fwdBeginResetModel() noexcept { _model->fwdBeginResetModel(); }
     inline void    fwdEndResetModel() noexcept { _model->fwdEndResetModel(); }
+    inline void    fwdEmitDataChanged(int first, int last) noexcept { _model->fwdEmitDataChanged(first, last); }
+
+signals:
+    /*! \brief Emitted when container length change, even if no model has been created (prefer connecting this
+     * signal to model lengthChanged() when no view is bound to the container, since it avoid model creation).
+     */
+    void            lengthChanged();
 
 public:
     Q_PROPERTY( ContainerModel*    model READ getModel CONSTANT FINAL )
     /*! \brief Return a Qt model for this container extended with a modification interface for the underlining container model from QML.
      *
      * \warning Underlying model is created \b synchronously on first \c model access, expect a quite slow first call (O(n), n beein container size).
+     * Until then, container modifications do not pay any model bookkeeping cost.
      */
     inline ContainerModel*      getModel( ) noexcept {
         if ( !_model )
@@ -87,6 +95,8 @@ public:
     }
     //! Shortcut to getModel().
     inline ContainerModel*      model() const noexcept { return const_cast<AbstractContainer*>(this)->getModel(); }
+    //! Return true if container model has already been created (does not create it).
+    inline bool                 hasModel() const noexcept { return _model != nullptr; }
 
 protected:
     //! Create a concrete container model list reference for this abstract interface (called once).
@@ -44,7 +44,8 @@
 #include <memory>       // shared_ptr, weak_ptr
 #include <vector>
 #include <type_traits>  // integral_constant
-#include <algorithm>    // std::remove
+#include <utility>      // std::move
+#include <algorithm>    // std::remove std::rotate
 
 namespace qcm { // ::qcm
 
@@ -70,8 +71,22 @@ struct adapter< QList, T > {
     inline static void  insert(QList<T>& c, const T& t) { c.append( t ); }
     inline static void  insert(QList<T>& c, T&& t)      { c.append( t ); }
     inline static void  insert( QList<T>& c, const T& t, std::size_t i ) { c.insert( i, t ); }
+    //! Insert range [\c first, \c last) at index \c i (items are appended, then rotated in place).
+    template <class InputIt>
+    inline static void  insert( QList<T>& c, InputIt first, InputIt last, std::size_t i ) {
+        const auto s = c.size();
+        for ( ; first != last; ++first )
+            c.append( *first );
+        std::rotate( c.begin() + static_cast<int>(i), c.begin() + s, c.end() );
+    }
 
     inline static void  remove(QList<T>& c, std::size_t i ) { c.removeAt(static_cast<int>(i)); }
+    //! Remove item at index \c i in O(1) by moving last item at index \c i (order is not preserved).
+    inline static void  swapErase(QList<T>& c, std::size_t i ) {
+        if ( static_cast<int>(i) != c.size() - 1 )
+            c[static_cast<int>(i)] = c.last();
+        c.removeLast();
+    }
     inline static int   removeAll(QList<T>& c, const T& t ) { return c.removeAll(t); }
 
     inline static bool  contains(const QList<T>& c, const T& t) { return c.contains(t); }
@@ -88,8 +103,20 @@ struct adapter< QVector, T > {
     inline static void  insert(QVector<T>& c, const T& t)   { c.append( t ); }
     inline static void  insert(QVector<T>& c, T&& t)        { c.append( t ); }
     inline static void  insert(QVector<T>& c, const T& t, int i ) { c.insert( i, t ); }
+    template <class InputIt>
+    inline static void  insert(QVector<T>& c, InputIt first, InputIt last, int i ) {
+        const auto s = c.size();
+        for ( ; first != last; ++first )
+            c.append( *first );
+        std::rotate( c.begin() + i, c.begin() + s, c.end() );
+    }
 
     inline static void  remove(QVector<T>& c, std::size_t i)    { c.remove(static_cast<int>(i)); }
+    inline static void  swapErase(QVector<T>& c, std::size_t i) {
+        if ( static_cast<int>(i) != c.size() - 1 )
+            c[static_cast<int>(i)] = c.last();
+        c.removeLast();
+    }
     inline static int   removeAll(QVector<T>& c, const T& t )   { return c.removeAll(t); }
 
     inline static bool      contains(const QVector<T>& c, const T& t) { return c.contains(t); }
@@ -106,8 +133,15 @@ struct adapter< QSet, T > {
     inline static void  insert(QSet<T>& c, const T& t)      { c.insert( t ); }
     inline static void  insert(QSet<T>& c, T&& t)           { c.insert( t ); }
     inline static void  insert(QSet<T>& c, const T& t, int i )    { c.insert( t ); Q_UNUSED(i); }
+    template <class InputIt>
+    inline static void  insert(QSet<T>& c, InputIt first, InputIt last, int i ) {
+        Q_UNUSED(i);
+        for ( ; first != last; ++first )
+            c.insert( *first );
+    }
 
     inline static void  remove(QSet<T>& c, std::size_t i)   { c.erase(c.cbegin() + static_cast<int>(i)); }
+    inline static void  swapErase(QSet<T>& c, std::size_t i) { remove(c, i); }
     inline static int   removeAll(QSet<T>& c, const T& t )  { return c.remove(t); }
 
     inline static bool      contains(const QSet<T>& c, const T& t) { return c.contains(t); }
@@ -127,8 +161,15 @@ struct adapter< std::vector, T > {
     inline static void  insert(std::vector<T>& c, const T& t)   { c.push_back( t ); }
     inline static void  insert(std::vector<T>& c, T&& t)        { c.push_back( t ); }
     inline static void  insert(std::vector<T>& c, const T& t, std::size_t i ) { c.insert( t, i ); }
+    template <class InputIt>
+    inline static void  insert(std::vector<T>& c, InputIt first, InputIt last, std::size_t i ) { c.insert( c.begin() + i, first, last ); }
 
     inline static void  remove(std::vector<T>& c, std::size_t i) { c.erase( c.cbegin() + i ); }
+    inline static void  swapErase(std::vector<T>& c, std::size_t i) {
+        if ( i + 1 != c.size() )
+            c[i] = std::move(c.back());
+        c.pop_back();
+    }
     // See erase-remove idiom:
     // http://thispointer.com/removing-all-occurences-of-an-element-from-vector-in-on-complexity/
     inline static int   removeAll(std::vector<T>& c, const T& t ) {
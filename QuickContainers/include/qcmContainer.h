@@ -48,6 +48,9 @@
 #include <memory>       // shared_ptr, weak_ptr
 #include <type_traits>  // integral_constant
 #include <utility>      // std::declval
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 QT_BEGIN_NAMESPACE
 
@@ -144,9 +147,13 @@ public:
 
 protected:
     using ModelImpl = qcm::ContainerModelImpl< qcm::Container<C, T> >;
+    //! Model is created on first getModel() call, QObject item map is then built from actual container content.
     virtual void createModel() override {
         _modelImpl = std::make_unique<ModelImpl>(*this);
         _model = static_cast<qcm::ContainerModel*>(_modelImpl.get());
+        reserveImpl( static_cast<std::size_t>(_container.size()), typename ItemDispatcher<T>::type{} );
+        for ( const auto& item : qAsConst(_container) )
+            appendImpl( item, typename ItemDispatcher<T>::type{} );
     }
 private:
     std::unique_ptr<ModelImpl>    _modelImpl;
@@ -241,8 +248,18 @@ private:
     inline auto atImpl( int i, ItemDispatcherBase::weak_ptr_qobject_type )  const -> T { return atImpl( i, ItemDispatcherBase::weak_ptr_type{} ); }
 
 public:
-    //! Shortcut to Container<T>::reserve().
-    void        reserve( std::size_t size ) { qcm::adapter<C,T>::reserve(_container, size); }
+    //! Shortcut to Container<T>::reserve(), model QObject item map is also pre-sized.
+    void        reserve( std::size_t size ) {
+        qcm::adapter<C,T>::reserve(_container, size);
+        reserveImpl( size, typename ItemDispatcher<T>::type{} );
+    }
+private:
+    template <class Dispatch>
+    inline auto reserveImpl( std::size_t, Dispatch ) noexcept -> void {}
+    inline auto reserveImpl( std::size_t size, ItemDispatcherBase::ptr_qobject_type )        -> void { if ( _modelImpl ) _modelImpl->_qObjectItemMap.reserve( size ); }
+    inline auto reserveImpl( std::size_t size, ItemDispatcherBase::q_ptr_type )              -> void { reserveImpl( size, ItemDispatcherBase::ptr_qobject_type{} ); }
+    inline auto reserveImpl( std::size_t size, ItemDispatcherBase::shared_ptr_qobject_type ) -> void { reserveImpl( size, ItemDispatcherBase::ptr_qobject_type{} ); }
+    inline auto reserveImpl( std::size_t size, ItemDispatcherBase::weak_ptr_qobject_type )   -> void { reserveImpl( size, ItemDispatcherBase::ptr_qobject_type{} ); }
 
 public:
     //! Shortcut to Container<T>::size().
@@ -262,7 +279,10 @@ public:
         } else {
             qcm::adapter<C, T>::append(_container, item);
             appendImpl( item, typename ItemDispatcher<T>::type{} );
+            emit lengthChanged();
         }
+        if ( _indexed )
+            indexRow( item, static_cast<int>(_container.size()) - 1 );
     }
 
     //! Shortcut to Container<T>::insert().
@@ -280,7 +300,50 @@ public:
         } else {
             qcm::adapter<C,T>::insert(_container, item, i);
             appendImpl( item, typename ItemDispatcher<T>::type{} );
+            emit lengthChanged();
         }
+        if ( _indexed )
+            reindex( i );
+    }
+
+    /*! \brief Append items in range [\c first, \c last) with a single model rows insertion notification.
+     *
+     * Null items are ignored, container and model item map are reserved once.
+     * \code
+     *   qcm::Container<QVector, QObject*> objects;
+     *   std::vector<QObject*> items{o1, o2, o3};
+     *   objects.append(items.cbegin(), items.cend());   // One beginInsertRows()/endInsertRows() pair
+     * \endcode
+     */
+    template <class InputIt>
+    void        append( InputIt first, InputIt last ) { insert( first, last, static_cast<int>(size()) ); }
+
+    //! Insert items in range [\c first, \c last) at index \c i with a single model rows insertion notification (see append(first, last)).
+    template <class InputIt>
+    void        insert( InputIt first, InputIt last, int i ) {
+        if ( i < 0 ||
+             i > static_cast<int>(size()) )
+            return;
+        std::vector<T> items;
+        for ( ; first != last; ++first )
+            if ( !isNullPtr( *first, typename ItemDispatcher<T>::type{} ) )
+                items.push_back( *first );
+        if ( items.empty() )
+            return;
+        const auto count = static_cast<int>(items.size());
+        reserve( static_cast<std::size_t>(size()) + items.size() );
+        if ( _model )
+            fwdBeginInsertRows( QModelIndex{}, i, i + count - 1 );
+        qcm::adapter<C,T>::insert(_container, items.cbegin(), items.cend(), i);
+        for ( const auto& item : items )
+            appendImpl( item, typename ItemDispatcher<T>::type{} );
+        if ( _indexed )
+            reindex( i );
+        if ( _model ) {
+            fwdEndInsertRows( );
+            fwdEmitLengthChanged();
+        } else
+            emit lengthChanged();
     }
 
 private:
@@ -317,9 +380,25 @@ public:
     void        removeAll( const T& item ) {
         if ( isNullPtr( item, typename ItemDispatcher<T>::type{} ) )
             return;
-        const auto itemIndex = qcm::adapter<C,T>::indexOf(_container, item);
+        const auto itemIndex = static_cast<int>(indexOf(item));
         if ( itemIndex < 0 )
             return;
+        if ( _indexed ) {   // Indexed container items are unique, remove item row and reindex following rows
+            _rows.erase( itemKey( item, typename ItemDispatcher<T>::type{} ) );
+            if ( _model ) {
+                fwdBeginRemoveRows( QModelIndex{}, itemIndex, itemIndex );
+                removeImpl( item, typename ItemDispatcher<T>::type{} );
+                qcm::adapter<C,T>::remove(_container, static_cast<std::size_t>(itemIndex));
+                reindex( itemIndex );
+                fwdEndRemoveRows( );
+                fwdEmitLengthChanged();
+            } else {
+                qcm::adapter<C,T>::remove(_container, static_cast<std::size_t>(itemIndex));
+                reindex( itemIndex );
+                emit lengthChanged();
+            }
+            return;
+        }
         if ( _model ) {
             // FIXME: Model updating is actually quite buggy: removeAll might remove
             // items at multiple index, but model update is requested only for itemIndex...
@@ -332,9 +411,61 @@ public:
             fwdEmitLengthChanged();
         } else {
             qcm::adapter<C,T>::removeAll(_container, item);
+            emit lengthChanged();
         }
     }
 
+    /*! \brief Remove items in range [\c first, \c last) with a single model reset notification.
+     *
+     * Items are matched by identity in O(1) (container is traversed once), container order is preserved. Fallback
+     * to one removeAll(item) per item for non pointer items.
+     * \code
+     *   qcm::Container<QVector, QObject*> selection;
+     *   std::vector<QObject*> unselected{o1, o3};
+     *   selection.removeAll(unselected.cbegin(), unselected.cend());   // One beginResetModel()/endResetModel() pair
+     * \endcode
+     */
+    template <class InputIt>
+    void        removeAll( InputIt first, InputIt last ) {
+        std::unordered_set<const void*> keys;
+        for ( ; first != last; ++first ) {
+            const auto key = itemKey( *first, typename ItemDispatcher<T>::type{} );
+            if ( key != nullptr )
+                keys.insert( key );
+            else
+                removeAll( *first );
+        }
+        if ( keys.empty() )
+            return;
+        std::vector<T> items;       // Kept items
+        items.reserve( static_cast<std::size_t>(_container.size()) );
+        std::vector<T> removed;
+        for ( const auto& item : qAsConst(_container) ) {
+            if ( keys.find( itemKey( item, typename ItemDispatcher<T>::type{} ) ) == keys.end() )
+                items.push_back( item );
+            else
+                removed.push_back( item );
+        }
+        if ( removed.empty() )
+            return;
+        if ( _model )
+            fwdBeginResetModel();
+        for ( const auto& item : removed ) {
+            if ( _indexed )
+                _rows.erase( itemKey( item, typename ItemDispatcher<T>::type{} ) );
+            removeImpl( item, typename ItemDispatcher<T>::type{} );
+        }
+        _container.clear();
+        qcm::adapter<C,T>::insert(_container, items.cbegin(), items.cend(), 0);
+        if ( _indexed )
+            reindex( 0 );
+        if ( _model ) {
+            fwdEndResetModel();
+            fwdEmitLengthChanged();
+        } else
+            emit lengthChanged();
+    }
+
 private:
     inline auto removeImpl( const T&, ItemDispatcherBase::unsupported_type )               -> void {}
     inline auto removeImpl( const T&, ItemDispatcherBase::non_ptr_type )                   -> void {}
@@ -342,13 +473,13 @@ private:
     inline auto removeImpl( const T& item, ItemDispatcherBase::ptr_qobject_type )          -> void {
         if ( _modelImpl &&
              item != nullptr ) {
-            item->disconnect( 0, _modelImpl.get(), 0 );
+            _modelImpl->unmonitorItem( item );
             _modelImpl->_qObjectItemMap.erase( item );
         }
     }
     inline auto removeImpl( const T& item, ItemDispatcherBase::q_ptr_type )                -> void {
         if ( _modelImpl && item != nullptr ) {
-            item->disconnect( 0, _modelImpl.get(), 0 );
+            _modelImpl->unmonitorItem( item.data() );
             _modelImpl->_qObjectItemMap.erase( item.data() );
         }
     }
@@ -356,7 +487,7 @@ private:
     inline auto removeImpl( const T& item, ItemDispatcherBase::shared_ptr_qobject_type )   -> void {
         QObject* qObject = qobject_cast<QObject*>(item.get());
         if ( _modelImpl && qObject != nullptr ) {
-            qObject->disconnect( 0, _modelImpl.get(), 0 );
+            _modelImpl->unmonitorItem( qObject );
             _modelImpl->_qObjectItemMap.erase( qObject );
         }
     }
@@ -366,21 +497,24 @@ private:
             return;
         QObject* qObject = qobject_cast<QObject*>(item.lock().get());
         if ( qObject != nullptr ) {
-            qObject->disconnect( 0, _modelImpl.get(), 0 );
+            _modelImpl->unmonitorItem( qObject );
             _modelImpl->_qObjectItemMap.erase( qObject );
         }
     }
 
 public:
     inline  void    clear() noexcept {
+        _rows.clear();
         if ( _model && _modelImpl ) {
             fwdBeginResetModel();
+            _modelImpl->unmonitorAllItems();
             _modelImpl->_qObjectItemMap.clear();
             _container.clear( );
             fwdEndResetModel();
             fwdEmitLengthChanged();
         } else {
             _container.clear( );
+            emit lengthChanged();
         }
     }
 
@@ -395,8 +529,10 @@ public:
      * \arg deleteContent if true, delete will eventually be called on each container item before the container is cleared.
      */
     void    clear( bool deleteContent ) {
+        _rows.clear();
         if ( _model && _modelImpl) {
             fwdBeginResetModel();
+            _modelImpl->unmonitorAllItems();     // Disconnect before items are eventually deleted
             clearImpl( deleteContent, typename ItemDispatcher<T>::type{} );
             _modelImpl->_qObjectItemMap.clear();
             _container.clear();
@@ -405,6 +541,7 @@ public:
         } else {
             clearImpl( deleteContent, typename ItemDispatcher<T>::type{} );
             _container.clear();
+            emit lengthChanged();
         }
     }
 
@@ -424,13 +561,120 @@ public:
      *
      * \arg item    if nullptr, return false.
      */
-    inline auto    contains( T item ) const noexcept -> bool { return qcm::adapter<C, T>::contains(_container, item); }
+    inline auto    contains( T item ) const noexcept -> bool {
+        return _indexed ? static_cast<int>(indexOf(item)) >= 0 :
+                          qcm::adapter<C, T>::contains(_container, item);
+    }
 
     /*! \brief Shortcut to Container<T>::indexOf(), return index of a given \c item element in this model container.
      *
      * \arg item    if nullptr, return -1.
      */
-    inline auto    indexOf( T item ) const noexcept -> size_t { return qcm::adapter<C, T>::indexOf( _container, item ); }
+    inline auto    indexOf( T item ) const noexcept -> size_t {
+        if ( _indexed ) {
+            const auto key = itemKey( item, typename ItemDispatcher<T>::type{} );
+            if ( key != nullptr ) {
+                const auto row = _rows.find( key );
+                return row != _rows.cend() ? static_cast<size_t>(row->second) : static_cast<size_t>(-1);
+            }
+        }
+        return qcm::adapter<C, T>::indexOf( _container, item );
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Indexed Mode *///------------------------------------------------
+    //@{
+public:
+    /*! \brief Maintain an item to row hash index for pointer (or smart pointer) items, indexOf(), contains() and removeAll() become O(1).
+     *
+     * Indexing is opt-in and costs one hash map entry per item, insertion of a single item or a range not at the end
+     * of container reindex following rows. Items of an indexed container are expected to be unique.
+     * \code
+     *   qcm::Container<QVector, QObject*> selection;
+     *   selection.setIndexed(true);
+     *   // ... append a lot of items
+     *   selection.removeUnordered(item);   // O(1), last item is moved in removed item row
+     * \endcode
+     * \note Setting indexed mode on a non pointer item container has no effect (indexOf() still use a linear scan).
+     * \warning Container must not be modified through its C<T>& cast operator while indexed.
+     */
+    void            setIndexed( bool indexed ) {
+        _indexed = indexed;
+        _rows.clear();
+        if ( _indexed ) {
+            _rows.reserve( static_cast<std::size_t>(_container.size()) );
+            reindex( 0 );
+        }
+    }
+    //! \copydoc setIndexed()
+    inline auto     isIndexed() const noexcept -> bool { return _indexed; }
+
+    /*! \brief Remove \c item in O(1) when container is indexed by moving last container item in \c item row.
+     *
+     * Model is notified with a removal of the last row, followed by a dataChanged() for \c item row (no rows after
+     * \c item row are shifted). Container order is not preserved. Fallback to an ordered removeAll() if container
+     * is not a random access indexed container.
+     */
+    void            removeUnordered( const T& item ) {
+        if ( !_indexed ||
+             isNullPtr( item, typename ItemDispatcher<T>::type{} ) ) {
+            removeAll( item );
+            return;
+        }
+        const auto itemKey_ = itemKey( item, typename ItemDispatcher<T>::type{} );
+        const auto itemRow = _rows.find( itemKey_ );
+        if ( itemRow == _rows.end() ) {
+            if ( itemKey_ == nullptr )      // Non indexable item
+                removeAll( item );
+            return;
+        }
+        const int row = itemRow->second;
+        const int lastRow = static_cast<int>(_container.size()) - 1;
+        _rows.erase( itemRow );
+        if ( _model ) {
+            fwdBeginRemoveRows( QModelIndex{}, lastRow, lastRow );
+            removeImpl( item, typename ItemDispatcher<T>::type{} );
+            qcm::adapter<C,T>::swapErase( _container, static_cast<std::size_t>(row) );
+        } else
+            qcm::adapter<C,T>::swapErase( _container, static_cast<std::size_t>(row) );
+        if ( row != lastRow )
+            indexRow( _container.at( row ), row );
+        if ( _model ) {
+            fwdEndRemoveRows( );
+            if ( row != lastRow )
+                fwdEmitDataChanged( row, row );
+            fwdEmitLengthChanged();
+        } else
+            emit lengthChanged();
+    }
+
+private:
+    inline auto indexRow( const T& item, int row ) -> void {
+        const auto key = itemKey( item, typename ItemDispatcher<T>::type{} );
+        if ( key != nullptr )
+            _rows[key] = row;
+    }
+    //! Update rows index for all items starting at \c row.
+    inline auto reindex( int row ) -> void {
+        const int size = static_cast<int>(_container.size());
+        for ( auto r = row; r < size; ++r )
+            indexRow( _container.at( r ), r );
+    }
+
+    inline auto itemKey( const T&, ItemDispatcherBase::unsupported_type )               const noexcept -> const void* { return nullptr; }
+    inline auto itemKey( const T&, ItemDispatcherBase::non_ptr_type )                   const noexcept -> const void* { return nullptr; }
+    inline auto itemKey( const T& item, ItemDispatcherBase::ptr_type )                  const noexcept -> const void* { return item; }
+    inline auto itemKey( const T& item, ItemDispatcherBase::ptr_qobject_type )          const noexcept -> const void* { return item; }
+    inline auto itemKey( const T& item, ItemDispatcherBase::q_ptr_type )                const noexcept -> const void* { return item.data(); }
+    inline auto itemKey( const T& item, ItemDispatcherBase::shared_ptr_type )           const noexcept -> const void* { return item.get(); }
+    inline auto itemKey( const T& item, ItemDispatcherBase::shared_ptr_qobject_type )   const noexcept -> const void* { return item.get(); }
+    inline auto itemKey( const T& item, ItemDispatcherBase::weak_ptr_type )             const noexcept -> const void* { return item.lock().get(); }
+    inline auto itemKey( const T& item, ItemDispatcherBase::weak_ptr_qobject_type )     const noexcept -> const void* { return item.lock().get(); }
+
+private:
+    bool                                    _indexed = false;
+    std::unordered_map<const void*, int>    _rows;
 
 private:
     C<T>                _container;
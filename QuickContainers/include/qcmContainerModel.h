@@ -38,12 +38,17 @@
 // Std headers
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <algorithm>    // std::sort std::unique
 
 // Qt headers
 #include <QObject>
 #include <QDebug>
 #include <QQmlEngine>   // Q_QML_DECLARE_TYPE, qmlEngine()
 #include <QAbstractListModel>
+#include <QMetaMethod>
+#include <QMetaProperty>
 
 namespace qcm { // ::qcm
 
@@ -193,24 +198,116 @@ public:
      * }
      * \endcode
      */
-    void            setItemDisplayRole(const QString& displayRoleProperty) noexcept { _displayRoleProperty = displayRoleProperty; }
+    void            setItemDisplayRole(const QString& displayRoleProperty) noexcept {
+        unmonitorAllItems();
+        _displayNotifySignals.clear();
+        _displayRoleProperty = displayRoleProperty;
+    }
 protected:
     const QString&  getItemDisplayRole() const { return _displayRoleProperty; }
 private:
     QString         _displayRoleProperty{QStringLiteral("label")};
+
+public:
+    /*! \brief Stop monitoring \c item display property (called when \c item is removed from container).
+     *
+     * \note Item display property might be monitored again if its row is read again with data().
+     */
+    void            unmonitorItem( const QObject* item ) const noexcept {
+        if ( item == nullptr ||
+             _monitoredItems.erase( item ) == 0 )
+            return;
+        QObject::disconnect( item, nullptr, this, nullptr );
+        // Note: A pending dirty row for item is eventually flushed: dataChanged() on a row that has been
+        // reused (or is out of range) is harmless.
+    }
+    //! Stop monitoring all items display property (called on container clear or reset).
+    void            unmonitorAllItems() const noexcept {
+        for ( const auto item : _monitoredItems )
+            QObject::disconnect( item, nullptr, this, nullptr );
+        _monitoredItems.clear();
+        _dirtyRows.clear();
+    }
+
+protected:
+    /*! \brief Catch \c item display property change notify signal to force model update for it's index.
+     *
+     * Display property notify signal is resolved once for a given QMetaObject (not for every item), an item is
+     * connected only once, whatever the number of data() calls for its row.
+     */
+    void            monitorItem( QObject* item ) const {
+        if ( item == nullptr ||
+             _monitoredItems.find( item ) != _monitoredItems.cend() )
+            return;
+        const QMetaMethod& notifySignal = getDisplayNotifySignal( item->metaObject() );
+        if ( !notifySignal.isValid() )     // Item display property is constant, no monitoring necessary
+            return;
+        // Note 20161125: Direct connection (without method(indexOfSlot()) call is impossible, there is no existing QObject::connect
+        // overload taking (QObject*, QMetaMethod, QObject*, pointer on method).
+        static const QMetaMethod itemDisplayPropertyChangedSlot = ContainerModel::staticMetaObject.method(
+                    ContainerModel::staticMetaObject.indexOfSlot( "itemDisplayPropertyChanged()" ) );
+        if ( connect( item, notifySignal, this, itemDisplayPropertyChangedSlot ) )
+            _monitoredItems.insert( item );
+    }
+
+private:
+    //! Return (and cache) display property notify signal for \c metaObject type (an invalid method if property has no notify signal).
+    const QMetaMethod&  getDisplayNotifySignal( const QMetaObject* metaObject ) const {
+        const auto cached = _displayNotifySignals.find( metaObject );
+        if ( cached != _displayNotifySignals.cend() )
+            return cached->second;
+        QMetaMethod notifySignal;
+        const QMetaProperty displayProperty = metaObject->property( metaObject->indexOfProperty( getItemDisplayRole().toLatin1() ) );
+        if ( displayProperty.isValid() &&
+             displayProperty.hasNotifySignal() )
+            notifySignal = displayProperty.notifySignal();
+        return _displayNotifySignals.emplace( metaObject, notifySignal ).first->second;
+    }
+
+    //! Display property notify signal for every item type read in this model (keyed by QMetaObject, see setItemDisplayRole()).
+    mutable std::unordered_map<const QMetaObject*, QMetaMethod> _displayNotifySignals;
+    //! Items actually connected to itemDisplayPropertyChanged().
+    mutable std::unordered_set<const QObject*>  _monitoredItems;
+    //! Rows with a modified display property waiting for flushDisplayChanges().
+    mutable std::vector<int>    _dirtyRows;
+
 protected slots:
+    //! Record sender item row as modified, dataChanged() is emitted for contiguous row ranges once per event loop iteration.
     void            itemDisplayPropertyChanged() {
         QObject* qItem = sender();
         if ( qItem == nullptr )
             return;
         int qItemIndex = indexOf( qItem );
         if ( qItemIndex >= 0 ) {
-            QModelIndex itemIndex{ index( qItemIndex ) };
-            if ( itemIndex.isValid( ) )
-                emit dataChanged( itemIndex, itemIndex );
+            if ( _dirtyRows.empty() )
+                QMetaObject::invokeMethod( this, "flushDisplayChanges", Qt::QueuedConnection );
+            _dirtyRows.push_back( qItemIndex );
         } else
-            disconnect( qItem,  nullptr,
-                        this,   nullptr );
+            unmonitorItem( qItem );
+    }
+public slots:
+    //! Emit dataChanged() for all rows recorded in itemDisplayPropertyChanged(), merging contiguous rows (automatically called from event loop).
+    void            flushDisplayChanges() {
+        if ( _dirtyRows.empty() )
+            return;
+        std::vector<int> rows;
+        rows.swap( _dirtyRows );
+        std::sort( rows.begin(), rows.end() );
+        rows.erase( std::unique( rows.begin(), rows.end() ), rows.end() );
+        const int rowCount_ = rowCount();
+        for ( std::size_t r = 0; r < rows.size(); ) {
+            auto last = r;
+            while ( last + 1 < rows.size() &&
+                    rows[last + 1] == rows[last] + 1 )
+                ++last;
+            if ( rows[r] < rowCount_ ) {
+                const QModelIndex first{ index( rows[r] ) };
+                const QModelIndex lastIndex{ index( std::min( rows[last], rowCount_ - 1 ) ) };
+                if ( first.isValid() && lastIndex.isValid() )
+                    emit dataChanged( first, lastIndex, { Qt::DisplayRole } );
+            }
+            r = last + 1;
+        }
     }
     //-------------------------------------------------------------------------
 
@@ -230,6 +327,7 @@ protected:
 
     inline void    fwdBeginResetModel() noexcept { beginResetModel(); }
     inline void    fwdEndResetModel() noexcept { endResetModel(); }
+    inline void    fwdEmitDataChanged(int first, int last) noexcept { emit dataChanged(index(first), index(last)); }
     //-------------------------------------------------------------------------
 
     /*! \name QML Container Interface *///-------------------------------------
@@ -336,24 +434,6 @@ protected:
                                           item.lock()->property( getItemDisplayRole().toLatin1() ) );
     }
 
-private:
-    //! Catch an item label property change notify signal and force model update for it's index.
-    void    monitorItem( QObject* item ) const {
-        if ( item == nullptr )
-            return;
-        QMetaProperty displayProperty = item->metaObject()->property(
-                    item->metaObject()->indexOfProperty( getItemDisplayRole().toLatin1() ) );
-        if ( displayProperty.isValid() &&
-             displayProperty.hasNotifySignal() ) {
-            QMetaMethod displayPropertyChanged = displayProperty.notifySignal( );
-            // Note 20161125: Direct connection (without method(indexOfSlot()) call is impossible, there is no existing QObject::connect
-            // overload taking (QObject*, QMetaMethod, QObject*, pointer on method).
-            QMetaMethod itemDisplayPropertyChangedSlot = metaObject( )->method( metaObject( )->indexOfSlot( "itemDisplayPropertyChanged()" ) );
-            auto c = connect( item, displayPropertyChanged,
-                              this, itemDisplayPropertyChangedSlot );
-        }
-    }
-
 private:
     inline auto dataItemRole( int row, ItemDispatcherBase::non_ptr_type )           const -> QVariant {
         T item = _container.at( row );
@@ -409,7 +489,7 @@ public:
         return indexOfImpl( item, typename ItemDispatcher<typename Container::Item_type>::type{} );
     }
 
-    virtual bool        clear() const override { _container.clear(); return true; }
+    virtual bool        clear() const override { _container.clear(); return true; }   // Container clear() call unmonitorAllItems()
 
 private:
     inline auto appendImpl( QObject*, ItemDispatcherBase::non_ptr_type )                    const -> bool { return false; }
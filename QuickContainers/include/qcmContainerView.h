@@ -0,0 +1,276 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickContainers library.
+//
+// \file    qcmContainerView.h
+// \author  benoit@destrat.io
+// \date    2026 10 14
+//-----------------------------------------------------------------------------
+
+#ifndef qcmContainerView_h
+#define qcmContainerView_h
+
+// Std headers
+#include <vector>
+#include <functional>   // std::function
+#include <algorithm>    // std::upper_bound
+
+// Qt headers
+#include <QAbstractListModel>
+
+// QuickContainers headers
+#include "qcmContainerModel.h"
+
+namespace qcm { // ::qcm
+
+/*! \brief Filtered and sorted read-only model over a qcm::Container, using C++ predicates (no QVariant conversion).
+ *
+ * A ContainerView maintains a permutation of source container rows: rows accepted by filter, ordered by
+ * less than comparator (or by source row when no comparator is set). Permutation is updated incrementally
+ * from source container model rows insertion, removal and data change notifications: source rows insertion
+ * and removal cost O(log(n)) comparisons plus an O(n) index shift, a full O(n log(n)) rebuild only happens
+ * on source model reset or when filter or comparator is modified.
+ *
+ * \code
+ *   qcm::Container<QVector, qan::Node*> nodes;
+ *   qcm::ContainerView<decltype(nodes)> view{nodes};
+ *   view.setFilter([](const qan::Node* node) { return node->getLabel().startsWith("a"); });
+ *   view.setLessThan([](const qan::Node* a, const qan::Node* b) { return a->getLabel() < b->getLabel(); });
+ *   // Expose view as a context property, then in QML: ListView { model: view }
+ * \endcode
+ *
+ * \note View roles are the source container model roles (Qt::DisplayRole and "itemData").
+ * \warning Source container must outlive its views.
+ */
+template < class Container >
+class ContainerView : public qcm::ContainerModel
+{
+    /*! \name View Management *///---------------------------------------------
+    //@{
+public:
+    using T         = typename Container::Item_type;
+    using Filter    = std::function<bool(const T&)>;
+    using LessThan  = std::function<bool(const T&, const T&)>;
+
+    explicit ContainerView( Container& container ) :
+        qcm::ContainerModel{},
+        _container( container )
+    {
+        auto source = _container.getModel();
+        connect( source, &QAbstractItemModel::rowsInserted,
+                 this,   [this](const QModelIndex&, int first, int last) { sourceRowsInserted(first, last); } );
+        connect( source, &QAbstractItemModel::rowsAboutToBeRemoved,
+                 this,   [this](const QModelIndex&, int first, int last) { sourceRowsAboutToBeRemoved(first, last); } );
+        connect( source, &QAbstractItemModel::rowsRemoved,
+                 this,   [this](const QModelIndex&, int first, int last) { sourceRowsRemoved(first, last); } );
+        connect( source, &QAbstractItemModel::dataChanged,
+                 this,   [this](const QModelIndex& first, const QModelIndex& last) { sourceDataChanged(first.row(), last.row()); } );
+        connect( source, &QAbstractItemModel::modelReset,
+                 this,   [this]() { invalidate(); } );
+        invalidate();
+    }
+    virtual ~ContainerView() override = default;
+    ContainerView(const ContainerView<Container>&) = delete;
+
+public:
+    //! Set view filter predicate (an empty filter accept all items), view is rebuilt.
+    void        setFilter( Filter filter ) { _filter = std::move(filter); invalidate(); }
+    //! Set view comparator (with an empty comparator, view follow source container order), view is rebuilt.
+    void        setLessThan( LessThan lessThan ) { _lessThan = std::move(lessThan); invalidate(); }
+    //! Shortcut to setLessThan() ordering items by \c key(const T&) result (compared with operator<).
+    template <class Key>
+    void        setSortKey( Key key ) {
+        setLessThan( [key](const T& a, const T& b) { return key(a) < key(b); } );
+    }
+
+    //! Fully rebuild view from source container (call after an external filter or comparator state has changed).
+    void        invalidate() {
+        beginResetModel();
+        const int sourceCount = static_cast<int>(_container.size());
+        _rows.clear();
+        _rows.reserve( static_cast<std::size_t>(sourceCount) );
+        for ( int r = 0; r < sourceCount; ++r )
+            if ( accept( r ) )
+                _rows.push_back( r );
+        if ( _lessThan )
+            std::stable_sort( _rows.begin(), _rows.end(), [this](int a, int b) { return less( a, b ); } );
+        _sourceToView.assign( static_cast<std::size_t>(sourceCount), -1 );
+        updateMapping( 0 );
+        endResetModel();
+        emitLengthChanged();
+    }
+
+    //! Return source container row for view row \c row (-1 if \c row is invalid).
+    inline auto mapToSource( int row ) const noexcept -> int {
+        return row >= 0 && row < static_cast<int>(_rows.size()) ? _rows[static_cast<std::size_t>(row)] : -1;
+    }
+    //! Return view row for source container row \c sourceRow (-1 if \c sourceRow is filtered or invalid).
+    inline auto mapFromSource( int sourceRow ) const noexcept -> int {
+        return sourceRow >= 0 && sourceRow < static_cast<int>(_sourceToView.size()) ? _sourceToView[static_cast<std::size_t>(sourceRow)] : -1;
+    }
+
+private:
+    Container&          _container;
+    Filter              _filter;
+    LessThan            _lessThan;
+    //! View row to source row permutation.
+    std::vector<int>    _rows;
+    //! Source row to view row (-1 for filtered rows).
+    std::vector<int>    _sourceToView;
+
+    inline auto accept( int sourceRow ) const -> bool {
+        return !_filter || _filter( _container.at( sourceRow ) );
+    }
+    //! Strict weak ordering on source rows: comparator first, then source row for a stable order.
+    inline auto less( int a, int b ) const -> bool {
+        if ( _lessThan ) {
+            const T ta = _container.at( a );
+            const T tb = _container.at( b );
+            if ( _lessThan( ta, tb ) )
+                return true;
+            if ( _lessThan( tb, ta ) )
+                return false;
+        }
+        return a < b;
+    }
+    //! Update source to view mapping for view rows starting at \c viewRow.
+    inline auto updateMapping( int viewRow ) -> void {
+        for ( auto v = static_cast<std::size_t>(viewRow); v < _rows.size(); ++v )
+            _sourceToView[static_cast<std::size_t>(_rows[v])] = static_cast<int>(v);
+    }
+    //! Insert (already accepted) source row in view at its sorted position, return view row.
+    inline auto insertRow( int sourceRow ) -> int {
+        const auto position = std::upper_bound( _rows.begin(), _rows.end(), sourceRow,
+                                                [this](int a, int b) { return less( a, b ); } );
+        const int viewRow = static_cast<int>(position - _rows.begin());
+        beginInsertRows( QModelIndex{}, viewRow, viewRow );
+        _rows.insert( position, sourceRow );
+        updateMapping( viewRow );
+        endInsertRows();
+        return viewRow;
+    }
+    inline auto removeRow( int viewRow ) -> void {
+        beginRemoveRows( QModelIndex{}, viewRow, viewRow );
+        _sourceToView[static_cast<std::size_t>(_rows[static_cast<std::size_t>(viewRow)])] = -1;
+        _rows.erase( _rows.begin() + viewRow );
+        updateMapping( viewRow );
+        endRemoveRows();
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Source Container Monitoring *///---------------------------------
+    //@{
+private:
+    auto    sourceRowsInserted( int first, int last ) -> void {
+        const int count = last - first + 1;
+        for ( auto& r : _rows )     // Shift source rows following insertion point
+            if ( r >= first )
+                r += count;
+        _sourceToView.insert( _sourceToView.begin() + first, static_cast<std::size_t>(count), -1 );
+        bool inserted = false;
+        for ( int r = first; r <= last; ++r )
+            if ( accept( r ) ) {
+                insertRow( r );
+                inserted = true;
+            }
+        if ( inserted )
+            emitLengthChanged();
+    }
+    //! Remove view rows while source rows are still valid.
+    auto    sourceRowsAboutToBeRemoved( int first, int last ) -> void {
+        bool removed = false;
+        for ( int r = last; r >= first; --r ) {
+            const int viewRow = mapFromSource( r );
+            if ( viewRow >= 0 ) {
+                removeRow( viewRow );
+                removed = true;
+            }
+        }
+        if ( removed )
+            emitLengthChanged();
+    }
+    auto    sourceRowsRemoved( int first, int last ) -> void {
+        const int count = last - first + 1;
+        for ( auto& r : _rows )
+            if ( r > last )
+                r -= count;
+        _sourceToView.erase( _sourceToView.begin() + first, _sourceToView.begin() + last + 1 );
+    }
+    //! Re-filter and re-sort modified source rows.
+    auto    sourceDataChanged( int first, int last ) -> void {
+        const int lengthBefore = rowCount();
+        for ( int r = first; r <= last; ++r ) {
+            const int viewRow = mapFromSource( r );
+            const bool accepted = accept( r );
+            if ( viewRow < 0 ) {
+                if ( accepted )
+                    insertRow( r );
+            } else if ( !accepted ) {
+                removeRow( viewRow );
+            } else if ( ( viewRow > 0 && less( r, _rows[static_cast<std::size_t>(viewRow - 1)] ) ) ||
+                        ( viewRow + 1 < rowCount() && less( _rows[static_cast<std::size_t>(viewRow + 1)], r ) ) ) {
+                removeRow( viewRow );   // Sort key changed, move row to its new position
+                insertRow( r );
+            } else {
+                const QModelIndex viewIndex{ index( viewRow ) };
+                emit dataChanged( viewIndex, viewIndex );
+            }
+        }
+        if ( rowCount() != lengthBefore )
+            emitLengthChanged();
+    }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Qt Abstract Model Interface *///---------------------------------
+    //@{
+public:
+    virtual int         rowCount( const QModelIndex& parent = QModelIndex{} ) const override {
+        return ( parent.isValid() ? 0 : static_cast<int>(_rows.size()) );
+    }
+    virtual QVariant    data( const QModelIndex& index, int role = Qt::DisplayRole ) const override {
+        const int sourceRow = mapToSource( index.row() );
+        if ( sourceRow < 0 )
+            return QVariant{};
+        const auto source = _container.model();
+        return source->data( source->index( sourceRow ), role );
+    }
+
+    virtual QObject*    at( int index ) const override {
+        const int sourceRow = mapToSource( index );
+        return sourceRow >= 0 ? _container.model()->at( sourceRow ) : nullptr;
+    }
+    virtual int         indexOf( QObject* item ) const override { return mapFromSource( _container.model()->indexOf( item ) ); }
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qcm
+
+#endif // qcmContainerView_h
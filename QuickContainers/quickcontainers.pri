@@ -8,6 +8,7 @@ HEADERS +=  $$PWD/include/qcmContainerModel.h       \
             $$PWD/include/qcmAbstractContainer.h    \
             $$PWD/include/qcmAdapter.h              \
             $$PWD/include/qcmContainer.h            \
+            $$PWD/include/qcmContainerView.h        \
             $$PWD/include/QuickContainers.h
 
 OTHER_FILES +=  $$PWD/QuickContainers
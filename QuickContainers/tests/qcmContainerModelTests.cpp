@@ -256,6 +256,203 @@ TEST(qpsContainer, qVectorPod)
     }
 }
 
+TEST(qpsContainer, qVectorPodRange)
+{
+    using Ints = qcm::Container< QVector, int >;
+    {   // Container::append(first, last)
+        Ints ints;
+        QSignalSpy rowsInserted(ints.model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)));
+        const std::vector<int> values{42, 43, 44};
+        ints.append( values.cbegin(), values.cend() );
+        EXPECT_EQ( ints.model()->getLength(), 3 );
+        EXPECT_EQ( rowsInserted.count(), 1 );
+        EXPECT_EQ( rowsInserted.at(0).at(1).toInt(), 0 );
+        EXPECT_EQ( rowsInserted.at(0).at(2).toInt(), 2 );
+        EXPECT_EQ( ints.at(0), 42 );
+        EXPECT_EQ( ints.at(2), 44 );
+    }
+
+    {   // Container::insert(first, last, i)
+        Ints ints;
+        ints.append( 1 );
+        ints.append( 4 );
+        QSignalSpy rowsInserted(ints.model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)));
+        const std::vector<int> values{2, 3};
+        ints.insert( values.cbegin(), values.cend(), 1 );
+        EXPECT_EQ( rowsInserted.count(), 1 );
+        ASSERT_EQ( ints.model()->getLength(), 4 );
+        for ( int i = 0; i < 4; ++i )
+            EXPECT_EQ( ints.at(i), i + 1 );
+        ints.insert( values.cbegin(), values.cend(), 42 );  // Invalid index
+        ints.insert( values.cend(), values.cend(), 0 );     // Empty range
+        EXPECT_EQ( rowsInserted.count(), 1 );
+        EXPECT_EQ( ints.model()->getLength(), 4 );
+    }
+}
+
+TEST(qpsContainerModel, qVectorQObjectRange)
+{
+    using QObjects = qcm::Container< QVector, QObject* >;
+    QObjects objects;
+    QObject* o1{new QObject()};
+    QObject* o2{new QObject()};
+    QObject* o3{new QObject()};
+    objects.append( o3 );
+
+    QSignalSpy rowsInserted(objects.model(), SIGNAL(rowsInserted(const QModelIndex&, int, int)));
+    QSignalSpy lengthChanged(objects.model(), SIGNAL(lengthChanged()));
+    const std::vector<QObject*> items{o1, nullptr, o2};     // nullptr items are ignored
+    objects.insert( items.cbegin(), items.cend(), 0 );
+    EXPECT_EQ( rowsInserted.count(), 1 );
+    EXPECT_EQ( lengthChanged.count(), 1 );
+    ASSERT_EQ( objects.model()->getLength(), 3 );
+    EXPECT_TRUE( objects.at(0) == o1 );
+    EXPECT_TRUE( objects.at(1) == o2 );
+    EXPECT_TRUE( objects.at(2) == o3 );
+    EXPECT_EQ( objects.model()->indexOf(o2), 1 );
+}
+
+TEST(qpsContainerModel, qVectorQObjectIndexed)
+{
+    using QObjects = qcm::Container< QVector, QObject* >;
+    QObjects objects;
+    objects.setIndexed( true );
+    EXPECT_TRUE( objects.isIndexed() );
+    std::vector<QObject*> items;
+    for ( int i = 0; i < 5; ++i )
+        items.push_back( new QObject() );
+    objects.append( items.cbegin(), items.cend() );
+    for ( int i = 0; i < 5; ++i )
+        EXPECT_EQ( objects.model()->indexOf( items[i] ), i );
+
+    QObject* o{new QObject()};      // Single insertion reindex following rows
+    objects.insert( o, 0 );
+    EXPECT_EQ( objects.model()->indexOf( o ), 0 );
+    EXPECT_EQ( objects.model()->indexOf( items[4] ), 5 );
+
+    objects.removeAll( items[0] );   // Ordered removal
+    EXPECT_FALSE( objects.contains( items[0] ) );
+    EXPECT_EQ( objects.model()->indexOf( items[1] ), 1 );
+    EXPECT_EQ( objects.model()->getLength(), 5 );
+
+    // Unordered removal: last row is removed, then moved item row is refreshed
+    QSignalSpy rowsRemoved(objects.model(), SIGNAL(rowsRemoved(const QModelIndex&, int, int)));
+    QSignalSpy dataChanged(objects.model(), SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&, const QVector<int>&)));
+    objects.removeUnordered( items[1] );
+    EXPECT_EQ( rowsRemoved.count(), 1 );
+    EXPECT_EQ( rowsRemoved.at(0).at(1).toInt(), 4 );
+    EXPECT_EQ( dataChanged.count(), 1 );
+    ASSERT_EQ( objects.model()->getLength(), 4 );
+    EXPECT_TRUE( objects.at(1) == items[4] );
+    EXPECT_EQ( objects.model()->indexOf( items[4] ), 1 );
+    EXPECT_EQ( objects.model()->indexOf( items[1] ), -1 );
+
+    objects.removeUnordered( items[4] );
+    objects.removeUnordered( items[2] );    // Last row: no dataChanged
+    EXPECT_EQ( dataChanged.count(), 2 );
+    EXPECT_EQ( objects.model()->getLength(), 2 );
+    objects.clear();
+    EXPECT_EQ( objects.model()->indexOf( o ), -1 );
+}
+
+TEST(qpsContainerModel, qVectorQObjectRemoveRange)
+{
+    using QObjects = qcm::Container< QVector, QObject* >;
+    QObjects objects;
+    objects.setIndexed( true );
+    std::vector<QObject*> items;
+    for ( int i = 0; i < 5; ++i )
+        items.push_back( new QObject() );
+    objects.append( items.cbegin(), items.cend() );
+
+    QSignalSpy modelReset(objects.model(), SIGNAL(modelReset()));
+    QSignalSpy rowsRemoved(objects.model(), SIGNAL(rowsRemoved(const QModelIndex&, int, int)));
+    const std::vector<QObject*> removed{items[3], items[0], nullptr, items[1]};
+    objects.removeAll( removed.cbegin(), removed.cend() );
+    EXPECT_EQ( modelReset.count(), 1 );
+    EXPECT_EQ( rowsRemoved.count(), 0 );
+    ASSERT_EQ( objects.model()->getLength(), 2 );
+    EXPECT_TRUE( objects.at(0) == items[2] );     // Order is preserved
+    EXPECT_TRUE( objects.at(1) == items[4] );
+    EXPECT_EQ( objects.model()->indexOf( items[4] ), 1 );
+    EXPECT_FALSE( objects.contains( items[0] ) );
+
+    objects.removeAll( removed.cbegin(), removed.cend() );   // No more matching items: no notification
+    EXPECT_EQ( modelReset.count(), 1 );
+}
+
+TEST(qpsContainerModel, stdVectorStdSharedQObjectLazyModel)
+{
+    using SharedQObjects = qcm::Container< std::vector, std::shared_ptr<QObject> >;
+    SharedQObjects objects;
+    QSignalSpy lengthChanged(&objects, SIGNAL(lengthChanged()));
+    auto o1 = std::make_shared<QObject>();
+    auto o2 = std::make_shared<QObject>();
+    objects.append( o1 );       // No model bookkeeping, container length is still notified
+    objects.append( o2 );
+    EXPECT_EQ( lengthChanged.count(), 2 );
+
+    // Model created on first access maps items appended before its creation
+    auto model = objects.getModel();
+    ASSERT_TRUE( model != nullptr );
+    EXPECT_EQ( model->getLength(), 2 );
+    EXPECT_EQ( model->indexOf( o2.get() ), 1 );
+    objects.removeAll( o1 );
+    EXPECT_EQ( lengthChanged.count(), 3 );
+    EXPECT_EQ( model->indexOf( o2.get() ), 0 );
+}
+
+TEST(qpsContainerView, qVectorQObjectFilterSort)
+{
+    using Dummies = qcm::Container<QVector, QDummy*>;
+    Dummies dummies;
+    auto d1 = new QDummy{1., "c"};
+    auto d2 = new QDummy{2., "a"};
+    auto d3 = new QDummy{3., "b"};
+    dummies.append(d1);
+    dummies.append(d2);
+    dummies.append(d3);
+
+    qcm::ContainerView<Dummies> view{dummies};
+    EXPECT_EQ( view.rowCount(), 3 );        // No filter, source order
+    EXPECT_TRUE( view.at(0) == d1 );
+
+    view.setFilter([](const QDummy* d) { return d->getDummyReal() > 1.5; });
+    view.setSortKey([](const QDummy* d) { return d->getDummyString(); });
+    ASSERT_EQ( view.rowCount(), 2 );
+    EXPECT_TRUE( view.at(0) == d2 );        // "a"
+    EXPECT_TRUE( view.at(1) == d3 );        // "b"
+    EXPECT_EQ( view.mapFromSource(0), -1 ); // d1 is filtered
+    EXPECT_EQ( view.indexOf(d3), 1 );
+
+    // Incremental insertion at sorted position
+    QSignalSpy rowsInserted(&view, SIGNAL(rowsInserted(const QModelIndex&, int, int)));
+    QSignalSpy modelReset(&view, SIGNAL(modelReset()));
+    auto d4 = new QDummy{4., "aa"};
+    auto d5 = new QDummy{0., "z"};
+    dummies.insert(d4, 0);
+    dummies.append(d5);                     // Filtered
+    EXPECT_EQ( rowsInserted.count(), 1 );
+    EXPECT_EQ( rowsInserted.at(0).at(1).toInt(), 1 );
+    ASSERT_EQ( view.rowCount(), 3 );
+    EXPECT_TRUE( view.at(1) == d4 );
+    EXPECT_EQ( view.mapToSource(1), 0 );
+    EXPECT_EQ( view.mapToSource(0), 2 );    // d2 source row shifted by d4 insertion
+
+    // Incremental removal
+    dummies.removeAll(d2);
+    ASSERT_EQ( view.rowCount(), 2 );
+    EXPECT_TRUE( view.at(0) == d4 );
+    EXPECT_TRUE( view.at(1) == d3 );
+    EXPECT_EQ( view.mapToSource(1), 2 );
+    EXPECT_EQ( modelReset.count(), 0 );     // No full rebuild
+
+    dummies.clear();
+    EXPECT_EQ( view.rowCount(), 0 );
+    for ( auto d : {d1, d2, d3, d4, d5} )
+        delete d;
+}
+
 //-----------------------------------------------------------------------------
 // qcm::Container std::vector POD tests
 //-----------------------------------------------------------------------------
@@ -706,8 +903,10 @@ void    testItemDisplayRole(Container& container)
 
     // Now modify container model qobject properties used as display role.
     container.at(0)->setLabel("D1 label");
+    model.flushDisplayChanges();    // Display changes are batched until next event loop iteration
     ASSERT_EQ(spy.count, 1);
     container.at(1)->setLabel("D2 label");
+    model.flushDisplayChanges();
     ASSERT_EQ(spy.count, 2);
 
     // Check that label content is correct
@@ -723,6 +922,40 @@ void    testItemDisplayRole(Container& container)
     ASSERT_EQ( QVariant{"Dummy2"}, model.data(model.index(1,0), qcm::ContainerModel::ItemLabelRole) );
 }
 
+TEST(qpsContainerModel, qObjectPtrItemDisplayRoleBatching)
+{
+    using Dummies = qcm::Container<QVector, QDummy*>;
+    Dummies dummies;
+    auto& model = *dummies.model();
+    for ( int i = 0; i < 4; ++i )
+        dummies.append(new QDummy{42., "Dummy"});
+    for ( int i = 0; i < 4; ++i ) {     // Rows read multiple times are connected only once
+        model.data(model.index(i), Qt::DisplayRole);
+        model.data(model.index(i), Qt::DisplayRole);
+    }
+
+    QSignalSpy dataChanged(&model, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&, const QVector<int>&)));
+    dummies.at(0)->setLabel("D0");
+    dummies.at(0)->setLabel("D0 label");
+    dummies.at(1)->setLabel("D1");
+    dummies.at(3)->setLabel("D3");
+    EXPECT_EQ( dataChanged.count(), 0 );
+    model.flushDisplayChanges();
+    ASSERT_EQ( dataChanged.count(), 2 );    // Rows [0, 1] and [3, 3]
+    EXPECT_EQ( dataChanged.at(0).at(0).value<QModelIndex>().row(), 0 );
+    EXPECT_EQ( dataChanged.at(0).at(1).value<QModelIndex>().row(), 1 );
+    EXPECT_EQ( dataChanged.at(1).at(0).value<QModelIndex>().row(), 3 );
+
+    // A removed item is no longer monitored
+    auto d3 = dummies.at(3);
+    dummies.removeAll(d3);
+    d3->setLabel("Removed");
+    model.flushDisplayChanges();
+    EXPECT_EQ( dataChanged.count(), 2 );
+    delete d3;
+    dummies.clear(true);
+}
+
 TEST(qpsContainerModel, qObjectPtrItemDisplayRole)
 {
     using Dummies = qcm::Container<QVector, QDummy*>;
@@ -0,0 +1,23 @@
+TEMPLATE    = app
+TARGET      = qan_benchmarks
+CONFIG      += warn_on thread c++14
+QT          += core gui qml quick quickcontrols2
+
+include(../src/quickqanava.pri)
+
+# On win32, set Google Benchmarks source and library directories manually
+#win32-msvc*:GBENCHMARK_DIR =  c:/path/to/google/benchmark
+#win32-msvc*:INCLUDEPATH     += $$GBENCHMARK_DIR/include
+
+SOURCES	+=  qan_benchmarks.cpp
+HEADERS	+=
+
+CONFIG(debug, debug|release) {
+    linux-g++*:     LIBS	+= -L../build/ -lbenchmark
+    #win32-msvc*:    LIBS	+= $$GBENCHMARK_DIR/src/Debug/benchmark.lib Shlwapi.lib
+}
+
+CONFIG(release, debug|release) {
+    linux-g++*:     LIBS	+= -L../build/ -lbenchmark
+    #win32-msvc*:    LIBS	+= $$GBENCHMARK_DIR/src/Release/benchmark.lib Shlwapi.lib
+}
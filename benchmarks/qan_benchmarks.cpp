@@ -0,0 +1,903 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qan_benchmarks.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>    // std::conditional_t
+#include <vector>
+
+// Qt headers
+#include <QGuiApplication>
+#include <QQmlEngine>
+#include <QQmlContext>
+#include <QQmlComponent>
+#include <QQuickWindow>
+#include <QQuickItem>
+
+// QuickQanava headers
+#include "../src/QuickQanava.h"
+
+// GTpo headers
+#include <gtpo/GTpo>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>         // malloc_usable_size()
+#endif
+
+/*
+ * Available benchmarks (graph is hosted in a Qan.GraphView of an offscreen QQuickWindow, with real delegates):
+ *   - BM_insert_node, BM_insert_edge, BM_insert_group: insertion throughput.
+ *   - BM_remove_selection: removeSelection() of a fully selected graph.
+ *   - BM_select_all: selectAll(), invertSelection() and clearSelection() of a headless graph (no items).
+ *   - BM_edge_update_item, BM_edge_update_items: EdgeItem::updateItem() vs batched EdgeItem::updateItems().
+ *   - BM_edge_update_allocations: heap allocations per straight or curved edge geometry regeneration (counter).
+ *   - BM_send_to_front_hub: Graph::sendToFront() of a hub node, edges are restacked with no geometry update (counter).
+ *   - BM_drag_move: DraggableCtrl::dragMove() of a primary node dragging a selection.
+ *   - BM_zoom_on: Navigable::zoomOn() on a populated graph.
+ *   - BM_graph_child_at: Graph::graphChildAt() hit testing.
+ *   - BM_memory_node, BM_memory_edge, BM_memory_group: measured heap bytes and allocations per element (counters),
+ *     with default delegates, created in/out models, virtualization and headless mode, compared to Graph::getMemoryStats()
+ *     estimation.
+ *   - BM_memory_gtpo_node: raw GTpo node with and without node lists (lean adjacency).
+ *
+ * Run on headless hosts with: ./qan_benchmarks -platform offscreen
+ * Compare with a previous build:  ./qan_benchmarks --benchmark_out_format=json --benchmark_out=qan.json
+ */
+
+/* Counting Allocator *///----------------------------------------------------
+/*
+ * With glibc, malloc() family is replaced by counting wrappers (Qt containers and strings allocate with malloc()),
+ * on other platforms only global operator new/delete are counted.
+ */
+static std::atomic<long long>   liveBytes{0};
+static std::atomic<long long>   allocationCount{0};
+
+#if defined(__GLIBC__)
+extern "C" {
+void*   __libc_malloc(std::size_t size);
+void*   __libc_calloc(std::size_t count, std::size_t size);
+void*   __libc_realloc(void* ptr, std::size_t size);
+void*   __libc_memalign(std::size_t alignment, std::size_t size);
+void    __libc_free(void* ptr);
+
+static inline void* counted(void* ptr) noexcept {
+    if ( ptr != nullptr ) {
+        liveBytes += static_cast<long long>(malloc_usable_size(ptr));
+        ++allocationCount;
+    }
+    return ptr;
+}
+void*   malloc(std::size_t size) { return counted(__libc_malloc(size)); }
+void*   calloc(std::size_t count, std::size_t size) { return counted(__libc_calloc(count, size)); }
+void*   realloc(void* ptr, std::size_t size) {
+    const auto previous = ptr != nullptr ? static_cast<long long>(malloc_usable_size(ptr)) : 0;
+    auto reallocated = __libc_realloc(ptr, size);
+    if ( reallocated != nullptr || size == 0 ) {       // On failure, ptr is left unchanged
+        liveBytes -= previous;
+        if ( reallocated != nullptr )
+            liveBytes += static_cast<long long>(malloc_usable_size(reallocated));
+        if ( ptr == nullptr && reallocated != nullptr )
+            ++allocationCount;
+    }
+    return reallocated;
+}
+void*   memalign(std::size_t alignment, std::size_t size) { return counted(__libc_memalign(alignment, size)); }
+void*   aligned_alloc(std::size_t alignment, std::size_t size) { return counted(__libc_memalign(alignment, size)); }
+int     posix_memalign(void** ptr, std::size_t alignment, std::size_t size) {
+    *ptr = counted(__libc_memalign(alignment, size));
+    return *ptr != nullptr ? 0 : ENOMEM;
+}
+void    free(void* ptr) {
+    if ( ptr != nullptr )
+        liveBytes -= static_cast<long long>(malloc_usable_size(ptr));
+    __libc_free(ptr);
+}
+} // extern "C"
+#else
+static constexpr std::size_t    allocationHeader = alignof(std::max_align_t);
+void*   operator new(std::size_t size) {
+    auto block = static_cast<char*>(std::malloc(size + allocationHeader));
+    if ( block == nullptr )
+        throw std::bad_alloc{};
+    *reinterpret_cast<std::size_t*>(block) = size;
+    liveBytes += static_cast<long long>(size);
+    ++allocationCount;
+    return block + allocationHeader;
+}
+void    operator delete(void* ptr) noexcept {
+    if ( ptr == nullptr )
+        return;
+    auto block = static_cast<char*>(ptr) - allocationHeader;
+    liveBytes -= static_cast<long long>(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+}
+void    operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
+#endif
+
+//! Measure live heap bytes and allocations between construction and per_element() call.
+struct allocation_probe {
+    allocation_probe() : bytes{liveBytes.load()}, allocations{allocationCount.load()} { }
+    //! Report measured costs divided by \c count in \c state counters.
+    void    report(benchmark::State& state, int count) const {
+        const auto n = static_cast<double>(qMax(1, count));
+        state.counters["bytes_per_element"] = static_cast<double>(liveBytes.load() - bytes) / n;
+        state.counters["allocs_per_element"] = static_cast<double>(allocationCount.load() - allocations) / n;
+    }
+    const long long bytes;
+    const long long allocations;
+};
+//-----------------------------------------------------------------------------
+
+static QQmlEngine*      engine = nullptr;
+static QQuickWindow*    window = nullptr;
+
+//! Qan.GraphView with an empty Qan.Graph created in benchmark window, destroyed with the fixture.
+struct bench_graph {
+    static constexpr qreal  nodeWidth{100.}, nodeHeight{45.}, spacing{40.};
+
+    bench_graph() {
+        QQmlComponent component{engine};
+        component.setData(QByteArrayLiteral("import QtQuick 2.7\n"
+                                            "import QuickQanava 2.0 as Qan\n"
+                                            "import \"qrc:/QuickQanava\" as Qan\n"
+                                            "Qan.GraphView {\n"
+                                            "  width: 1024; height: 768\n"
+                                            "  graph: Qan.Graph { }\n"
+                                            "}\n"), QUrl{});
+        if ( component.isError() ) {
+            error = component.errorString();
+            return;
+        }
+        view.reset(qobject_cast<qan::GraphView*>(component.create(engine->rootContext())));
+        if ( view ) {
+            view->setParentItem(window->contentItem());
+            graph = view->getGraph();
+        }
+        if ( graph == nullptr )
+            error = QStringLiteral("Graph creation failed.");
+    }
+    ~bench_graph() { view.reset(); }
+
+    //! Return true if fixture is usable, skip benchmark \c state otherwise.
+    bool    ok(benchmark::State& state) const {
+        if ( !error.isEmpty() )
+            state.SkipWithError(qPrintable(error));
+        return error.isEmpty();
+    }
+
+    //! Insert \c count nodes laid out on a grid.
+    void    insert_nodes(int count) {
+        const int columns = qMax(1, static_cast<int>(std::ceil(std::sqrt(count))));
+        nodes.reserve(nodes.size() + static_cast<std::size_t>(count));
+        for ( int n = 0; n < count; ++n ) {
+            auto node = graph->insertNode();
+            if ( node != nullptr && node->getItem() != nullptr )
+                node->getItem()->setRect({ (n % columns) * (nodeWidth + spacing),
+                                           (n / columns) * (nodeHeight + spacing),
+                                           nodeWidth, nodeHeight });
+            nodes.push_back(node);
+        }
+    }
+
+    //! Link every node to its right neighbour (count - 1 edges).
+    void    insert_chain_edges() {
+        for ( std::size_t n = 1; n < nodes.size(); ++n )
+            edges.push_back(graph->insertEdge(nodes[n - 1], nodes[n]));
+    }
+
+    void    clear() {
+        graph->clearGraph();
+        nodes.clear();
+        edges.clear();
+    }
+
+    std::unique_ptr<qan::GraphView> view;
+    qan::Graph*                     graph = nullptr;
+    std::vector<qan::Node*>         nodes;
+    std::vector<qan::Edge*>         edges;
+    QString                         error;
+};
+
+/* Insertion *///--------------------------------------------------------------
+static void BM_insert_node(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+        g.insert_nodes(count);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_insert_edge(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g.clear();
+        g.insert_nodes(count + 1);
+        state.ResumeTiming();
+        g.insert_chain_edges();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_insert_group(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g.clear();
+        state.ResumeTiming();
+        for ( int i = 0; i < count; ++i )
+            benchmark::DoNotOptimize(g.graph->insertGroup());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* Selection Removal *///------------------------------------------------------
+static void BM_remove_selection(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g.clear();
+        g.insert_nodes(count);
+        g.insert_chain_edges();
+        for ( const auto node : g.nodes )
+            if ( node != nullptr )
+                g.graph->setNodeSelected(*node, true);
+        state.ResumeTiming();
+        g.graph->removeSelection();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//! selectAll(), invertSelection() and clearSelection() of a headless graph with range(0) nodes.
+static void BM_select_all(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.graph->setHeadless(true);
+    g.insert_nodes(count);
+    for (auto _ : state) {
+        g.graph->selectAll();
+        g.graph->invertSelection();
+        g.graph->selectAll();
+        g.graph->clearSelection();
+        benchmark::DoNotOptimize(g.graph->getSelectionVersion());
+    }
+    state.SetItemsProcessed(state.iterations() * count * 4);
+}
+
+//! Clear a graph with range(0) nodes and chained edges, including deferred items destruction.
+static void BM_clear_graph(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    for (auto _ : state) {
+        state.PauseTiming();
+        g.insert_nodes(count);
+        g.insert_chain_edges();
+        state.ResumeTiming();
+        g.clear();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+//-----------------------------------------------------------------------------
+
+/* Edge Geometry Update *///---------------------------------------------------
+static void BM_edge_update_item(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count + 1);
+    g.insert_chain_edges();
+    for (auto _ : state) {
+        for ( const auto edge : g.edges )
+            if ( edge != nullptr && edge->getItem() != nullptr )
+                edge->getItem()->updateItem();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_edge_update_items(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count + 1);
+    g.insert_chain_edges();
+    std::vector<qan::EdgeItem*> edgeItems;
+    for ( const auto edge : g.edges )
+        if ( edge != nullptr && edge->getItem() != nullptr )
+            edgeItems.push_back(edge->getItem());
+    for (auto _ : state)
+        qan::EdgeItem::updateItems(edgeItems);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/*! Heap allocations per edge geometry regeneration in EdgeItem::updateItems() (range(1): 0 straight, 1 curved).
+ *
+ * Every other node is moved back and forth between iterations (with paused timing and allocation counting), so that
+ * every chained edge geometry is fully regenerated (one end moving is not a translation). Edges use an empty
+ * Qan.EdgeItem delegate to exclude QML bindings allocations: \c allocs_per_update is expected to be 0.
+ */
+static void BM_edge_update_allocations(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    const auto lineType = state.range(1) == 0 ? qan::EdgeStyle::LineType::Straight :
+                                                qan::EdgeStyle::LineType::Curved;
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    auto edgeDelegate = std::make_unique<QQmlComponent>(engine);
+    edgeDelegate->setData(QByteArrayLiteral("import QuickQanava 2.0 as Qan\n"
+                                            "Qan.EdgeItem { }\n"), QUrl{});
+    g.graph->setEdgeDelegate(std::move(edgeDelegate));
+    g.insert_nodes(count + 1);
+    g.insert_chain_edges();
+    std::vector<qan::EdgeItem*> edgeItems;
+    for ( const auto edge : g.edges )
+        if ( edge != nullptr && edge->getItem() != nullptr )
+            edgeItems.push_back(edge->getItem());
+    if ( edgeItems.empty() ||
+         edgeItems.front()->getStyle() == nullptr ) {
+        state.SkipWithError("Edge creation failed.");
+        return;
+    }
+    const auto style = edgeItems.front()->getStyle();       // Note: default edge style is shared
+    style->setLineType(lineType);
+    qan::EdgeItem::updateItems(edgeItems);                   // Grow scratch storage and node shapes caches
+
+    long long allocations = 0;
+    qreal offset = 1.;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for ( std::size_t n = 1; n < g.nodes.size(); n += 2 )
+            if ( g.nodes[n] != nullptr && g.nodes[n]->getItem() != nullptr )
+                g.nodes[n]->getItem()->setX(g.nodes[n]->getItem()->x() + offset);
+        offset = -offset;
+        const auto before = allocationCount.load();
+        state.ResumeTiming();
+        qan::EdgeItem::updateItems(edgeItems);
+        allocations += allocationCount.load() - before;
+    }
+    style->setLineType(qan::EdgeStyle::LineType::Straight);
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["allocs_per_update"] = static_cast<double>(allocations) /
+                                          static_cast<double>(qMax<long long>(1, state.iterations() * count));
+}
+
+/*! Raise a hub node connected to range(0) leaf nodes with Graph::sendToFront(), then flush restacked edges.
+ *
+ * Hub edges are restacked in a single pass when hub z is modified: \c geometry_updates_per_raise (EdgeItem::updateItem()
+ * calls counted with qan::TraceCounter::EdgeItemUpdates) is expected to be 0.
+ */
+static void BM_send_to_front_hub(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count + 1);
+    const auto hub = g.nodes.front();
+    if ( hub == nullptr ||
+         hub->getItem() == nullptr ) {
+        state.SkipWithError("Hub node creation failed.");
+        return;
+    }
+    for ( std::size_t n = 1; n < g.nodes.size(); ++n )
+        g.edges.push_back(g.graph->insertEdge(hub, g.nodes[n]));
+    g.graph->flushEdgeItemUpdates();
+
+    const auto before = qan::Trace::getCounter(qan::TraceCounter::EdgeItemUpdates);
+    for (auto _ : state) {
+        g.graph->sendToFront(hub->getItem());
+        g.graph->flushEdgeItemUpdates();
+    }
+    const auto updates = qan::Trace::getCounter(qan::TraceCounter::EdgeItemUpdates) - before;
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["geometry_updates_per_raise"] = static_cast<double>(updates) /
+                                                   static_cast<double>(qMax<long long>(1, state.iterations()));
+}
+//-----------------------------------------------------------------------------
+
+/* Interactions *///-----------------------------------------------------------
+//! Drag a primary node with range(0) selected nodes (graph has 4096 nodes and chained edges).
+static void BM_drag_move(benchmark::State& state)
+{
+    const auto selected = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(4096);
+    g.insert_chain_edges();
+    for ( int n = 0; n < selected && n < static_cast<int>(g.nodes.size()); ++n )
+        g.graph->setNodeSelected(*g.nodes[static_cast<std::size_t>(n)], true);
+    auto primary = g.nodes.front();
+    if ( primary == nullptr || primary->getItem() == nullptr ) {
+        state.SkipWithError("Primary node creation failed.");
+        return;
+    }
+    auto& draggableCtrl = primary->getItem()->draggableCtrl();
+    draggableCtrl.beginDragMove(QPointF{0., 0.}, true);
+    qreal delta = 1.;
+    for (auto _ : state) {
+        draggableCtrl.dragMove(QPointF{delta, delta}, true);
+        delta = -delta;     // Stay in place
+    }
+    draggableCtrl.endDragMove(true);
+    state.SetItemsProcessed(state.iterations() * selected);
+}
+
+//! Zoom on view center with range(0) nodes.
+static void BM_zoom_on(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count);
+    const QPointF center{g.view->width() / 2., g.view->height() / 2.};
+    bool zoomIn = true;
+    for (auto _ : state) {
+        g.view->zoomOn(center, zoomIn ? 1.5 : 1.0);
+        zoomIn = !zoomIn;
+    }
+}
+
+//! Hit test random positions in a graph with range(0) nodes (spatial index is built before timing).
+static void BM_graph_child_at(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count);
+    const int columns = qMax(1, static_cast<int>(std::ceil(std::sqrt(count))));
+    const auto extent = columns * (bench_graph::nodeWidth + bench_graph::spacing);
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> distribution{0., extent};
+    std::vector<QPointF> positions(1024);
+    for ( auto& position : positions )
+        position = QPointF{distribution(generator), distribution(generator)};
+    benchmark::DoNotOptimize(g.graph->graphChildAt(0., 0.));
+    std::size_t p = 0;
+    for (auto _ : state) {
+        const auto& position = positions[p++ % positions.size()];
+        benchmark::DoNotOptimize(g.graph->graphChildAt(position.x(), position.y()));
+    }
+}
+
+//! Search as you type a node label in a qan::LabelIndex of range(0) labels (one iteration is a complete typed query).
+static void BM_label_index_find(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    qan::LabelIndex index;
+    std::vector<char> keys(static_cast<std::size_t>(count));     // Node keys are never dereferenced
+    for ( int n = 0; n < count; ++n )
+        index.insert(reinterpret_cast<const qan::Node*>(&keys[static_cast<std::size_t>(n)]),
+                     QStringLiteral("Node %1").arg(n));
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, count - 1};
+    std::vector<QString> queries(64);
+    for ( auto& query : queries )
+        query = QStringLiteral("node %1").arg(distribution(generator));
+    std::size_t q = 0;
+    for (auto _ : state) {
+        const auto& query = queries[q++ % queries.size()];
+        for ( int c = 1; c <= query.size(); ++c )      // One query per keystroke
+            benchmark::DoNotOptimize(index.find(query.left(c), 20));
+    }
+}
+
+//! Central picking of random positions in a graph with range(0) nodes and chained edges (see qan::Graph::pickItem()).
+static void BM_graph_pick_item(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    bench_graph g;
+    if ( !g.ok(state) )
+        return;
+    g.insert_nodes(count);
+    g.insert_chain_edges();
+    g.graph->setCentralPicking(true);
+    const int columns = qMax(1, static_cast<int>(std::ceil(std::sqrt(count))));
+    const auto extent = columns * (bench_graph::nodeWidth + bench_graph::spacing);
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> distribution{0., extent};
+    std::vector<QPointF> positions(1024);
+    for ( auto& position : positions )
+        position = QPointF{distribution(generator), distribution(generator)};
+    benchmark::DoNotOptimize(g.graph->pickItem(QPointF{0., 0.}));
+    std::size_t p = 0;
+    for (auto _ : state) {
+        const auto& position = positions[p++ % positions.size()];
+        benchmark::DoNotOptimize(g.graph->pickItem(position));
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Memory Footprint *///-------------------------------------------------------
+//! Memory benchmark graph configurations (benchmarks second argument).
+enum class memory_config : int {
+    delegates   = 0,    //!< Default delegates.
+    models      = 1,    //!< Default delegates with in/out nodes and edges models created (lazy otherwise).
+    virtualized = 2,    //!< Virtualized graph, primitives are outside viewport (no items).
+    headless    = 3     //!< Headless graph (no items).
+};
+
+static void configure(bench_graph& g, const benchmark::State& state)
+{
+    switch ( static_cast<memory_config>(state.range(1)) ) {
+    case memory_config::virtualized:
+        g.graph->setVirtualized(true);
+        g.graph->setViewportRect(QRectF{-1e6, -1e6, 10., 10.});
+        break;
+    case memory_config::headless:
+        g.graph->setHeadless(true);
+        break;
+    default: break;
+    }
+}
+
+//! Create models of \c node in/out containers when configured.
+static void touch_models(qan::Node* node, const benchmark::State& state)
+{
+    if ( node != nullptr &&
+         static_cast<memory_config>(state.range(1)) == memory_config::models ) {
+        benchmark::DoNotOptimize(node->qmlGetInNodes());
+        benchmark::DoNotOptimize(node->qmlGetOutNodes());
+        benchmark::DoNotOptimize(node->qmlGetOutEdges());
+    }
+}
+
+//! Report Graph::getMemoryStats() estimation of \c bytes member divided by \c count.
+static void report_estimation(benchmark::State& state, const qan::Graph& graph, qint64 qan::MemoryStats::* bytes, int count)
+{
+    const auto stats = graph.getMemoryStats();
+    state.counters["estimated_bytes_per_element"] = static_cast<double>(stats.*bytes + stats.itemBytes + stats.modelBytes) /
+                                                    static_cast<double>(qMax(1, count));
+}
+
+static void BM_memory_node(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        bench_graph g;
+        if ( !g.ok(state) )
+            return;
+        configure(g, state);
+        const allocation_probe probe;
+        g.insert_nodes(count);
+        for ( const auto node : g.nodes )
+            touch_models(node, state);
+        state.PauseTiming();
+        probe.report(state, count);
+        report_estimation(state, *g.graph, &qan::MemoryStats::nodeBytes, count);
+        state.ResumeTiming();
+    }
+}
+
+static void BM_memory_edge(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        bench_graph g;
+        if ( !g.ok(state) )
+            return;
+        configure(g, state);
+        g.insert_nodes(count + 1);
+        const auto before = g.graph->getMemoryStats();
+        const allocation_probe probe;
+        g.insert_chain_edges();
+        for ( const auto node : g.nodes )
+            touch_models(node, state);
+        state.PauseTiming();
+        probe.report(state, count);
+        const auto after = g.graph->getMemoryStats();
+        state.counters["estimated_bytes_per_element"] = static_cast<double>(after.totalBytes() - before.totalBytes()) /
+                                                        static_cast<double>(qMax(1, count));
+        state.ResumeTiming();
+    }
+}
+
+static void BM_memory_group(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        bench_graph g;
+        if ( !g.ok(state) )
+            return;
+        configure(g, state);
+        const allocation_probe probe;
+        for ( int i = 0; i < count; ++i )
+            touch_models(g.graph->insertGroup(), state);
+        state.PauseTiming();
+        probe.report(state, count);
+        report_estimation(state, *g.graph, &qan::MemoryStats::groupBytes, count);
+        state.ResumeTiming();
+    }
+}
+
+namespace { // ::anonymous
+
+//! Raw GTpo primitives base (gtpo::empty can't be constructed from a parent pointer).
+struct raw_base {
+    raw_base(void* = nullptr) noexcept { }
+};
+
+template <bool node_lists>
+struct config_raw final : public gtpo::config<config_raw<node_lists>>
+{
+    using graph_base = raw_base;
+    using node_base  = raw_base;
+    using edge_base  = raw_base;
+    using graph_behaviours = std::tuple< >;
+    using group_behaviours = std::tuple< >;
+    using node_behaviours = std::tuple< >;
+    static constexpr bool   enable_node_lists = node_lists;
+};
+
+} // ::anonymous
+
+//! Raw GTpo node with 2 edges per node, second argument is 1 for lean adjacency (no node lists).
+template <bool node_lists>
+static void memory_gtpo_node(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        gtpo::graph<config_raw<node_lists>> graph;
+        const allocation_probe probe;
+        std::vector<typename gtpo::graph<config_raw<node_lists>>::weak_node_t> nodes;
+        nodes.reserve(static_cast<std::size_t>(count));
+        for ( int n = 0; n < count; ++n )
+            nodes.push_back(graph.create_node());
+        for ( int n = 1; n < count; ++n )
+            graph.create_edge(nodes[static_cast<std::size_t>(n - 1)], nodes[static_cast<std::size_t>(n)]);
+        for ( int n = 2; n < count; ++n )
+            graph.create_edge(nodes[static_cast<std::size_t>(n - 2)], nodes[static_cast<std::size_t>(n)]);
+        state.PauseTiming();
+        probe.report(state, count);
+        state.ResumeTiming();
+    }
+}
+
+static void BM_memory_gtpo_node(benchmark::State& state)
+{
+    if ( state.range(1) != 0 )
+        memory_gtpo_node<false>(state);
+    else
+        memory_gtpo_node<true>(state);
+}
+//-----------------------------------------------------------------------------
+
+/* Adjacency Containers *///---------------------------------------------------
+namespace { // ::anonymous
+
+//! qan::Config containers with QObject primitives, nodes adjacency is a qcm::Container or a plain std::vector (\c std_adjacency).
+template <bool std_adjacency>
+struct config_adjacency final : public gtpo::config<config_adjacency<std_adjacency>>
+{
+    using graph_base = raw_base;
+    using node_base  = QObject;
+    using edge_base  = QObject;
+
+    template <typename T>
+    using container_adapter = qan::ContainerAdapter<T>;
+
+    template <class ...Args>
+    using node_container_t = qcm::Container< QVector, Args... >;
+
+    template <class ...Args>
+    using edge_container_t = qcm::Container< QVector, Args... >;
+
+    template <class ...Args>
+    using search_container_t = QSet< Args... >;
+
+    template <class ...Args>
+    using adjacent_edges_container_t = std::conditional_t<std_adjacency, std::vector<Args...>, qcm::Container<QVector, Args...>>;
+
+    template <class ...Args>
+    using adjacent_nodes_container_t = std::conditional_t<std_adjacency, std::vector<Args...>, qcm::Container<QVector, Args...>>;
+};
+
+} // ::anonymous
+
+//! Insert then remove 2 edges per node on range(0) nodes, adjacency is stored in qcm::Container or std::vector.
+template <bool std_adjacency>
+static void adjacency_insert_remove(benchmark::State& state)
+{
+    using graph_t = gtpo::graph<config_adjacency<std_adjacency>>;
+    const auto count = static_cast<int>(state.range(0));
+    graph_t graph;
+    std::vector<typename graph_t::weak_node_t> nodes;
+    nodes.reserve(static_cast<std::size_t>(count));
+    for ( int n = 0; n < count; ++n )
+        nodes.push_back(graph.create_node());
+    std::vector<typename graph_t::weak_edge_t> edges;
+    edges.reserve(static_cast<std::size_t>(count) * 2);
+    for (auto _ : state) {
+        for ( int n = 1; n < count; ++n )
+            edges.push_back(graph.create_edge(nodes[static_cast<std::size_t>(n - 1)], nodes[static_cast<std::size_t>(n)]));
+        for ( int n = 2; n < count; ++n )
+            edges.push_back(graph.create_edge(nodes[static_cast<std::size_t>(n - 2)], nodes[static_cast<std::size_t>(n)]));
+        for ( const auto& edge : edges )
+            graph.remove_edge(edge);
+        edges.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count) * 2);
+}
+
+//! Second argument is 1 for std::vector adjacency (QUICKQANAVA_STD_ADJACENCY), 0 for qcm::Container adjacency (default).
+static void BM_adjacency_insert_remove(benchmark::State& state)
+{
+    if ( state.range(1) != 0 )
+        adjacency_insert_remove<true>(state);
+    else
+        adjacency_insert_remove<false>(state);
+}
+//-----------------------------------------------------------------------------
+
+/* Layouts *///----------------------------------------------------------------
+//! Random tree layout job (org chart like, 1 to 8 children per node) with variable node widths.
+static qan::LayoutJob   make_tree_job(int count)
+{
+    std::mt19937 rng{42};
+    std::vector<std::vector<std::uint32_t>> children(static_cast<std::size_t>(count));
+    std::size_t parent = 0;
+    for (int n = 1; n < count; ++n) {
+        children[parent].push_back(static_cast<std::uint32_t>(n));
+        if (children[parent].size() >= 1 + rng() % 8)
+            ++parent;
+    }
+    qan::LayoutJob job;
+    job.offsets.push_back(0);
+    for (int n = 0; n < count; ++n) {
+        job.x.push_back(0.);
+        job.y.push_back(0.);
+        job.width.push_back(60. + rng() % 80);
+        job.height.push_back(40.);
+        job.mobility.push_back(1.);
+        job.keys.push_back(static_cast<std::uint64_t>(n));
+        for (const auto c : children[static_cast<std::size_t>(n)])
+            job.targets.push_back(c);
+        job.offsets.push_back(job.targets.size());
+    }
+    return job;
+}
+
+//! Tidy tree layout, second argument is 1 for an incremental layout after a leaf node has been resized (0 for a full layout).
+static void BM_tree_layout(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    const bool incremental = state.range(1) != 0;
+    const auto job = make_tree_job(count);
+    const qan::TreeParameters parameters;
+    qan::TreeState previous;
+    if (incremental) {
+        auto initial = job;
+        qan::runTree(initial, parameters, nullptr, &previous);
+    }
+    auto modified = job;
+    modified.width.back() += 100.;
+    int walked = 0;
+    for (auto _ : state) {
+        auto current = modified;
+        qan::TreeState next;
+        walked = qan::runTree(current, parameters, incremental ? &previous : nullptr, &next);
+        benchmark::DoNotOptimize(current.x.data());
+    }
+    state.counters["walked"] = walked;
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+//-----------------------------------------------------------------------------
+
+BENCHMARK(BM_insert_node)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_insert_edge)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_insert_group)->RangeMultiplier(8)->Range(1 << 3, 1 << 9)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_remove_selection)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_select_all)->Arg(1 << 12)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_clear_graph)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_edge_update_item)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_edge_update_items)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_edge_update_allocations)->ArgsProduct({{1 << 10, 1 << 12}, {0, 1}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_send_to_front_hub)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_drag_move)->RangeMultiplier(8)->Range(1, 1 << 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_zoom_on)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_graph_child_at)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(BM_graph_pick_item)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+BENCHMARK(BM_label_index_find)->RangeMultiplier(8)->Range(1 << 10, 1 << 17)->Unit(benchmark::kMicrosecond);
+
+static void memory_configs(benchmark::internal::Benchmark* b) {
+    b->ArgsProduct({{1 << 10}, {static_cast<int>(memory_config::delegates), static_cast<int>(memory_config::models),
+                                static_cast<int>(memory_config::virtualized), static_cast<int>(memory_config::headless)}});
+}
+BENCHMARK(BM_memory_node)->Apply(memory_configs)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_memory_edge)->Apply(memory_configs)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_memory_group)->ArgsProduct({{1 << 7}, {0, 1, 2, 3}})->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_memory_gtpo_node)->ArgsProduct({{1 << 14}, {0, 1}})->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_adjacency_insert_remove)->ArgsProduct({{1 << 10, 1 << 14}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_tree_layout)->ArgsProduct({{1 << 10, 50000}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // Graph items require a GUI application and a window (use -platform offscreen on headless hosts)
+    QGuiApplication app{argc, argv};
+    QQmlEngine qmlEngine;
+    QuickQanava::initialize(&qmlEngine);
+    QQuickWindow quickWindow;
+    quickWindow.resize(1024, 768);
+    engine = &qmlEngine;
+    window = &quickWindow;
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    engine = nullptr;
+    window = nullptr;
+    return 0;
+}
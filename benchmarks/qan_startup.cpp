@@ -0,0 +1,175 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qan_startup.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cstdio>
+#include <memory>
+
+// Qt headers
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QQmlEngine>
+#include <QQmlContext>
+#include <QQmlComponent>
+#include <QQuickWindow>
+#include <QQuickItem>
+
+// QuickQanava headers
+#include "../src/QuickQanava.h"
+
+/*
+ * Cold start of QuickQanava, measured once per process (types registration, QML resources and default delegates
+ * are cached process wide, run the executable once per configuration):
+ *   - application: QGuiApplication construction.
+ *   - initialize: QuickQanava::initialize() (types registration and static qrc resources).
+ *   - graph_view: Qan.GraphView component compilation and creation (QuickQanava QML module loading).
+ *   - first_frame: window show() to first frameSwapped() with an empty graph.
+ *   - first_node: first insertNode() (default node delegate compilation if it is not preloaded yet).
+ *   - nodes: insertion of the remaining --nodes nodes.
+ *   - nodes_frame: next frameSwapped() with all nodes.
+ *   - time_to_first_frame: from main() entry to first frame displaying all nodes.
+ *
+ * Typical runs (compare with a QUICKQANAVA_QML_CACHEGEN build to measure QML precompilation):
+ *   ./qan_startup -platform offscreen --nodes 0
+ *   ./qan_startup -platform offscreen --nodes 1000
+ *   ./qan_startup -platform offscreen --nodes 1000 --core-types    // Extended types are not registered
+ */
+
+namespace { // ::anonymous
+
+//! Run event loop until \c window swap a frame, return false after \c timeout ms.
+bool    waitFrameSwapped(QQuickWindow& window, int timeout = 10000)
+{
+    QEventLoop loop;
+    bool swapped = false;
+    const auto connection = QObject::connect(&window, &QQuickWindow::frameSwapped, &loop, [&loop, &swapped]() {
+        swapped = true;
+        loop.quit();
+    }, Qt::QueuedConnection);
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+    window.update();
+    loop.exec();
+    QObject::disconnect(connection);
+    return swapped;
+}
+
+void    report(const char* phase, qint64 ns)
+{
+    std::printf("%-22s %10.3f ms\n", phase, static_cast<double>(ns) / 1e6);
+}
+
+} // ::anonymous
+
+int main(int argc, char** argv)
+{
+    QElapsedTimer total;
+    total.start();
+    QElapsedTimer phase;
+    phase.start();
+    QGuiApplication app{argc, argv};
+    report("application", phase.nsecsElapsed());
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("QuickQanava startup and first frame benchmark."));
+    parser.addHelpOption();
+    const QCommandLineOption nodesOption{QStringLiteral("nodes"), QStringLiteral("Number of nodes inserted after first frame (default to 1000)."),
+                                         QStringLiteral("count"), QStringLiteral("1000")};
+    const QCommandLineOption coreTypesOption{QStringLiteral("core-types"), QStringLiteral("Register only core QuickQanava types (see QuickQanava::initialize()).")};
+    parser.addOption(nodesOption);
+    parser.addOption(coreTypesOption);
+    parser.process(app);
+    const int nodeCount = qMax(0, parser.value(nodesOption).toInt());
+
+    QQmlEngine engine;
+    phase.restart();
+    QuickQanava::initialize(&engine, !parser.isSet(coreTypesOption));
+    report("initialize", phase.nsecsElapsed());
+
+    phase.restart();
+    QQmlComponent component{&engine};
+    component.setData(QByteArrayLiteral("import QtQuick 2.7\n"
+                                        "import QuickQanava 2.0 as Qan\n"
+                                        "import \"qrc:/QuickQanava\" as Qan\n"
+                                        "Qan.GraphView {\n"
+                                        "  anchors.fill: parent\n"
+                                        "  graph: Qan.Graph { }\n"
+                                        "}\n"), QUrl{});
+    std::unique_ptr<qan::GraphView> view{qobject_cast<qan::GraphView*>(component.create(engine.rootContext()))};
+    const auto graph = view ? view->getGraph() : nullptr;
+    if (graph == nullptr) {
+        std::fprintf(stderr, "qan_startup: Error: Graph view creation failed: %s\n", qPrintable(component.errorString()));
+        return 1;
+    }
+    report("graph_view", phase.nsecsElapsed());
+
+    phase.restart();
+    QQuickWindow window;
+    window.resize(1024, 768);
+    view->setParentItem(window.contentItem());
+    window.show();
+    if (!waitFrameSwapped(window)) {
+        std::fprintf(stderr, "qan_startup: Error: No frame rendered (try -platform offscreen with QT_QUICK_BACKEND=software).\n");
+        return 1;
+    }
+    report("first_frame", phase.nsecsElapsed());
+
+    if (nodeCount > 0) {
+        phase.restart();
+        graph->insertNode();
+        report("first_node", phase.nsecsElapsed());
+
+        phase.restart();
+        const int columns = 32;
+        for (int n = 1; n < nodeCount; ++n) {
+            const auto node = graph->insertNode();
+            if (node != nullptr &&
+                node->getItem() != nullptr)
+                node->getItem()->setPosition(QPointF{(n % columns) * 140., (n / columns) * 85.});
+        }
+        report("nodes", phase.nsecsElapsed());
+
+        phase.restart();
+        if (!waitFrameSwapped(window)) {
+            std::fprintf(stderr, "qan_startup: Error: No frame rendered after nodes insertion.\n");
+            return 1;
+        }
+        report("nodes_frame", phase.nsecsElapsed());
+    }
+    report("time_to_first_frame", total.nsecsElapsed());
+    view.reset();
+    return 0;
+}
@@ -0,0 +1,9 @@
+TEMPLATE    = app
+TARGET      = qan_startup
+CONFIG      += warn_on thread c++14
+QT          += core gui qml quick quickcontrols2
+
+include(../src/quickqanava.pri)
+
+SOURCES	+=  qan_startup.cpp
+HEADERS	+=
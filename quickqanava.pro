@@ -12,6 +12,10 @@ test-style.subdir       = samples/style
 test-dataflow.subdir    = samples/dataflow
 test-topology.subdir    = samples/topology
 test-cpp.subdir         = samples/cpp
+test-stress.subdir      = samples/stress
+
+benchmarks.subdir       = benchmarks
+startup.file            = benchmarks/startup.pro
 
 #SUBDIRS +=  test-resizer
 #SUBDIRS +=  test-navigable
@@ -24,7 +28,10 @@ SUBDIRS +=  test-connector
 SUBDIRS +=  test-topology
 #SUBDIRS +=  test-dataflow
 #SUBDIRS +=  test-cpp
+#SUBDIRS +=  test-stress
 
 #SUBDIRS +=  test-40k
+#SUBDIRS +=  benchmarks    # Require Google Benchmark
+#SUBDIRS +=  startup       # Cold start and first frame timings (see benchmarks/qan_startup.cpp)
 
 OTHER_FILES += ./.travis.yml
@@ -46,10 +46,7 @@ using namespace qan;
 
 QQmlComponent*  CustomGroup::delegate(QQmlEngine &engine, QObject* parent) noexcept {
     Q_UNUSED(parent)
-    static std::unique_ptr<QQmlComponent> delegate;
-    if (!delegate)
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/CustomGroup.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/CustomGroup.qml"));
 }
 
 qan::NodeStyle* CustomGroup::style(QObject* parent) noexcept {
@@ -64,11 +61,7 @@ qan::NodeStyle* CustomGroup::style(QObject* parent) noexcept {
 QQmlComponent*  CustomNode::delegate(QQmlEngine &engine, QObject* parent) noexcept
 {
     Q_UNUSED(parent)
-    static std::unique_ptr<QQmlComponent> customRectNode_delegate;
-    if (!customRectNode_delegate)
-        customRectNode_delegate =
-                std::make_unique<QQmlComponent>(&engine, "qrc:/CustomNode.qml");
-    return customRectNode_delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/CustomNode.qml"));
 }
 
 qan::NodeStyle *CustomNode::style(QObject* parent) noexcept
@@ -84,11 +77,7 @@ qan::NodeStyle *CustomNode::style(QObject* parent) noexcept
 
 QQmlComponent *CustomEdge::delegate(QQmlEngine &engine, QObject* parent) noexcept {
     Q_UNUSED(parent)
-    static std::unique_ptr<QQmlComponent> customEdge_delegate;
-    if (!customEdge_delegate)
-        customEdge_delegate =
-                std::make_unique<QQmlComponent>(&engine, "qrc:/CustomEdge.qml");
-    return customEdge_delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/CustomEdge.qml"));
 }
 
 qan::EdgeStyle *CustomEdge::style(QObject* parent) noexcept {
@@ -75,13 +75,15 @@ Qan.NodeItem {
         padding: 1
         anchors.left: parent.left; anchors.bottom: parent.bottom;
         opacity: 0.9
-        Label { text: image.sourceSize.width + "x" + image.sourceSize.height + "px" }
+        Label { text: image.implicitWidth + "x" + image.implicitHeight + "px" }
     }
     Image {
         id: image
         z: 1
         anchors.fill: parent
         smooth: true
-        source: imageNodeItem.node.output
+        // Shared asynchronous decoding at a power of two size following node on screen size (see qan::ImageProvider)
+        sourceSize.width: Math.pow(2, Math.ceil(Math.log(Math.max(1, width * (imageNodeItem.graph ? imageNodeItem.graph.lodZoom : 1.))) / Math.LN2))
+        source: imageNodeItem.node.output ? "image://qan/" + imageNodeItem.node.output : ""
     }
 }
@@ -36,6 +36,7 @@ import QtQuick              2.7
 import QtQuick.Controls     2.0
 import QtQuick.Layouts      1.3
 import QtGraphicalEffects   1.0
+import QuickQanava.Samples  1.0
 
 import QuickQanava          2.0 as Qan
 import "qrc:/QuickQanava"   as Qan
@@ -51,13 +52,9 @@ Qan.NodeItem {
     Qan.RectNodeTemplate {
         anchors.fill: parent
         nodeItem : parent
-            Image {
+            FlowImageItem {
                 anchors.fill: parent; anchors.margins: 2
-                source: node.source
-                layer.enabled: true
-                layer.effect: ColorOverlay {
-                    color: node.tintColor
-                }
+                image: node.output
             }
     }
 }
@@ -56,6 +56,7 @@ int	main( int argc, char** argv )
     qmlRegisterType< qan::FlowNode >( "QuickQanava.Samples", 1, 0, "FlowNode");
     qmlRegisterType< qan::OperationNode >( "QuickQanava.Samples", 1, 0, "OperationNode");
     qmlRegisterType< qan::FlowGraph >( "QuickQanava.Samples", 1, 0, "FlowGraph");
+    qmlRegisterType< qan::FlowImageItem >( "QuickQanava.Samples", 1, 0, "FlowImageItem");
 
     engine.load(QUrl("qrc:/dataflow.qml"));
     return app.exec();
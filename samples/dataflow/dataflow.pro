@@ -6,9 +6,11 @@ QT          += widgets core gui qml quick quickcontrols2
 include(../../src/quickqanava.pri)
 
 SOURCES     +=  dataflow.cpp    \
-                qanDataFlow.cpp
+                qanDataFlow.cpp \
+                qanTintKernel.cpp
 				
-HEADERS     +=  qanDataFlow.h
+HEADERS     +=  qanDataFlow.h   \
+                qanTintKernel.h
 
 OTHER_FILES +=  dataflow.qml        \
                 FlowNode.qml        \
@@ -35,34 +35,33 @@
 // QuickQanava headers
 #include "../../src/QuickQanava.h"
 #include "./qanDataFlow.h"
+#include "./qanTintKernel.h"
+
+// Qt headers
+#include <QPainter>
 
 namespace qan { // ::qan
 
 void    FlowNodeBehaviour::inNodeInserted( qan::Node& inNode, qan::Edge& edge ) noexcept
 {
-    Q_UNUSED(edge);
-    const auto inFlowNode = qobject_cast<qan::FlowNode*>(&inNode);
-    const auto flowNodeHost = qobject_cast<qan::FlowNode*>(getHost());
-    if ( inFlowNode != nullptr &&
-         flowNodeHost != nullptr ) {
-        //
-        QObject::connect(inFlowNode,    &qan::FlowNode::outputChanged,
-                         flowNodeHost,  &qan::FlowNode::inNodeOutputChanged);
-    }
-    flowNodeHost->inNodeOutputChanged();    // Force a call since with a new edge insertion, actual value might aready be initialized
+    Q_UNUSED(inNode); Q_UNUSED(edge);
+    // Note: downstream nodes are evaluated by FlowGraph engine, once per change even in a diamond shaped graph
+    const auto flowGraph = getHost() != nullptr ? qobject_cast<qan::FlowGraph*>(getHost()->getGraph()) : nullptr;
+    if ( flowGraph != nullptr )
+        flowGraph->getEngine()->markDirty(getHost());   // With a new edge insertion, actual value might aready be initialized
 }
 
 void    FlowNodeBehaviour::inNodeRemoved( qan::Node& inNode, qan::Edge& edge ) noexcept
 {
     Q_UNUSED(inNode); Q_UNUSED(edge);
+    const auto flowGraph = getHost() != nullptr ? qobject_cast<qan::FlowGraph*>(getHost()->getGraph()) : nullptr;
+    if ( flowGraph != nullptr )
+        flowGraph->getEngine()->markDirty(getHost());
 }
 
 QQmlComponent*  FlowNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   qan_FlowNode_delegate;
-    if ( !qan_FlowNode_delegate )
-        qan_FlowNode_delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/FlowNode.qml");
-    return qan_FlowNode_delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/FlowNode.qml"));
 }
 
 void    FlowNode::inNodeOutputChanged()
@@ -78,18 +77,12 @@ void    FlowNode::setOutput(QVariant output) noexcept
 
 QQmlComponent*  PercentageNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/PercentageNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/PercentageNode.qml"));
 }
 
 QQmlComponent*  OperationNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/OperationNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/OperationNode.qml"));
 }
 
 void    OperationNode::setOperation(Operation operation) noexcept
@@ -100,11 +93,32 @@ void    OperationNode::setOperation(Operation operation) noexcept
     }
 }
 
-void    OperationNode::inNodeOutputChanged()
+namespace { // ::qan::anonymous
+
+qreal   operate(OperationNode::Operation operation, const std::vector<qreal>& inputs) noexcept
 {
-    FlowNode::inNodeOutputChanged();
     qreal o{0.}; // For the example sake we do not deal with overflow
     bool oIsInitialized{false};
+    for ( const auto input : inputs ) {
+        switch ( operation ) {
+        case OperationNode::Operation::Add:        o += input; break;
+        case OperationNode::Operation::Multiply:
+            if ( !oIsInitialized ) {
+                o = input;
+                oIsInitialized = true;
+            } else
+                o *= input;
+            break;
+        }
+    }
+    return o;
+}
+
+} // ::qan::anonymous
+
+std::vector<qreal>  OperationNode::inputs()
+{
+    std::vector<qreal> inputs;
     for ( const auto& inNode : get_in_nodes() ) {
         const auto inFlowNode = qobject_cast<qan::FlowNode*>(inNode.lock().get());
         if ( inFlowNode == nullptr ||
@@ -112,44 +126,46 @@ void    OperationNode::inNodeOutputChanged()
             continue;
         bool ok{false};
         const auto inOutput = inFlowNode->getOutput().toReal(&ok);
-        if ( ok ) {
-            switch ( _operation ) {
-            case Operation::Add:        o += inOutput; break;
-            case Operation::Multiply:
-                if ( !oIsInitialized ) {
-                    o = inOutput;
-                    oIsInitialized = true;
-                } else
-                    o *= inOutput;
-                break;
-            }
-        }
+        if ( ok )
+            inputs.push_back(inOutput);
     }
-    setOutput(o);
+    return inputs;
+}
+
+void    OperationNode::inNodeOutputChanged()
+{
+    FlowNode::inNodeOutputChanged();
+    setOutput(operate(_operation, inputs()));
+}
+
+FlowComputable::Computation OperationNode::createComputation()
+{
+    return [operation = _operation, inputs = inputs()]() {
+        return QVariant{operate(operation, inputs)};
+    };
+}
+
+std::uint64_t   OperationNode::computationKey()
+{
+    auto key = gtpo::hash_combine(0, static_cast<std::uint64_t>(_operation));
+    for ( const auto input : inputs() )
+        key = gtpo::hash_combine(key, gtpo::hash_bits(input));
+    return key;
 }
 
 QQmlComponent*  ImageNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/ImageNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/ImageNode.qml"));
 }
 
 QQmlComponent*  ColorNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/ColorNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/ColorNode.qml"));
 }
 
 QQmlComponent*  TintNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/TintNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/TintNode.qml"));
 }
 
 void    TintNode::setSource(QUrl source) noexcept
@@ -171,34 +187,115 @@ void    TintNode::setTintColor(QColor tintColor) noexcept
 void    TintNode::inNodeOutputChanged()
 {
     FlowNode::inNodeOutputChanged();
-    qDebug() << "TintNode::inNodeOutputValueChanged()";
+    // Synchronous evaluation (without a FlowExecutor)
+    const auto computation = createComputation();
+    if ( computation )
+        applyComputation(computation());
+}
+
+bool    TintNode::inputs(QColor& tint, QImage& inputImage, QUrl& source) const
+{
     if ( get_in_nodes().size() != 3 )
-        return;
+        return false;
 
     // FIXME: Do not find port item by index, but by id with qan::NodeItem::findPort()...
 
     const auto inFactorNode = qobject_cast<qan::FlowNode*>(get_in_nodes().at(0).lock().get());
     const auto inColorNode = qobject_cast<qan::FlowNode*>(get_in_nodes().at(1).lock().get());
     const auto inImageNode = qobject_cast<qan::FlowNode*>(get_in_nodes().at(2).lock().get());
-    qDebug() << "inFactorNode=" << inFactorNode << "\tinColorNode=" << inColorNode << "\tinImageNode=" << inImageNode;
     if ( inFactorNode == nullptr ||
          inColorNode == nullptr ||
          inImageNode == nullptr )
-        return;
+        return false;
     bool factorOk{false};
     const auto factor = inFactorNode->getOutput().toReal(&factorOk);
-    auto       tint =   inColorNode->getOutput().value<QColor>();
-    const auto source = inImageNode->getOutput().toUrl();
-    qDebug() << "factor=" << factor;
-    qDebug() << "tint=" << tint;
-    qDebug() << "source=" << source.toString();
-    if ( factorOk &&
-         !source.isEmpty() &&
-         tint.isValid() ) {
-        tint.setAlpha(qBound(0., factor, 1.0) * 255);
-        setSource(source);
-        setTintColor(tint);
+    tint = inColorNode->getOutput().value<QColor>();
+    // Image input is either an image url (ImageNode) or an implicitly shared QImage (TintNode)
+    const auto imageInput = inImageNode->getOutput();
+    const bool isImage = imageInput.type() == QVariant::Image;
+    inputImage = isImage ? imageInput.value<QImage>() : QImage{};
+    source = isImage ? QUrl{} : imageInput.toUrl();
+    if ( !factorOk ||
+         !tint.isValid() ||
+         (isImage ? inputImage.isNull() : source.isEmpty()) )
+        return false;
+    tint.setAlpha(static_cast<int>(qBound(0., factor, 1.0) * 255));
+    return true;
+}
+
+std::uint64_t   TintNode::computationKey()
+{
+    QColor tint;
+    QImage inputImage;
+    QUrl   source;
+    if ( !inputs(tint, inputImage, source) )
+        return 0;
+    auto key = gtpo::hash_combine(0, static_cast<std::uint64_t>(tint.rgba()));
+    key = gtpo::hash_combine(key, inputImage.isNull() ? static_cast<std::uint64_t>(qHash(source)) :
+                                                        static_cast<std::uint64_t>(inputImage.cacheKey()));
+    return gtpo::hash_combine(key, static_cast<std::uint64_t>(inputImage.isNull() ? 0 : 1));
+}
+
+FlowComputable::Computation TintNode::createComputation()
+{
+    QColor tint;
+    QImage inputImage;
+    QUrl   source;
+    if ( !inputs(tint, inputImage, source) )
+        return Computation{};
+    const bool isImage = !inputImage.isNull();
+
+    auto sourceImage = isImage ? inputImage :
+                                 ( source == _sourceImageUrl ? _sourceImage : QImage{} );
+    return [source, sourceImage, tint]() {
+        auto image = sourceImage;
+        if ( image.isNull() ) {     // Decode source image (qrc urls are mapped to resource paths)
+            const auto path = source.scheme() == QStringLiteral("qrc") ? QStringLiteral(":") + source.path() :
+                              source.isLocalFile() ? source.toLocalFile() : source.toString();
+            image = QImage{path}.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        } else if ( image.format() != QImage::Format_ARGB32_Premultiplied )
+            image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        auto tinted = image;            // Note: bits() detach tinted from shared source image
+        if ( !tinted.isNull() )
+            qan::tintPixels(reinterpret_cast<std::uint32_t*>(tinted.bits()),
+                            static_cast<std::size_t>(tinted.width()) * static_cast<std::size_t>(tinted.height()), tint.rgba());
+        return QVariant{QVariantList{ source, image, tinted, tint }};
+    };
+}
+
+void    TintNode::applyComputation(QVariant output)
+{
+    // Note: output might be a memoized output (source and tint color are updated with output)
+    const auto outputs = output.toList();
+    if ( outputs.size() != 4 )
+        return;
+    const auto source = outputs.at(0).toUrl();
+    if ( !source.isEmpty() ) {          // Cache decoded source image
+        _sourceImageUrl = source;
+        _sourceImage = outputs.at(1).value<QImage>();
     }
+    setSource(source);
+    setTintColor(outputs.at(3).value<QColor>());
+    setOutput(outputs.at(2));
+}
+
+void    FlowImageItem::paint(QPainter* painter)
+{
+    if ( painter == nullptr ||
+         _image.isNull() )
+        return;
+    const auto size = _image.size().scaled(QSize{static_cast<int>(width()), static_cast<int>(height())}, Qt::KeepAspectRatio);
+    const QRectF target{(width() - size.width()) / 2., (height() - size.height()) / 2.,
+                        static_cast<qreal>(size.width()), static_cast<qreal>(size.height())};
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+    painter->drawImage(target, _image);
+}
+
+void    FlowImageItem::setImage(QImage image) noexcept
+{
+    _image = image;
+    emit imageChanged();
+    update();
 }
 
 qan::Node* FlowGraph::insertFlowNode(FlowNode::Type type)
@@ -237,8 +334,15 @@ qan::Node* FlowGraph::insertFlowNode(FlowNode::Type type)
         break;
     default: return nullptr;
     }
-    if ( flowNode )
+    if ( flowNode ) {
         flowNode->installBehaviour(std::make_unique<FlowNodeBehaviour>());
+        const auto flowNodePtr = static_cast<qan::FlowNode*>(flowNode);
+        connect(flowNodePtr, &qan::FlowNode::outputChanged,
+                &_engine,    [this, flowNodePtr]() { _engine.markOutputsDirty(flowNodePtr); });
+        if ( type == qan::FlowNode::Type::Operation )   // Operation output is memoized per operation and inputs
+            connect(static_cast<qan::OperationNode*>(flowNode), &qan::OperationNode::operationChanged,
+                    &_engine,    [this, flowNodePtr]() { _engine.markDirty(flowNodePtr); });
+    }
     return flowNode;
 }
 
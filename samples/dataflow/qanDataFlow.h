@@ -40,6 +40,7 @@
 
 // Qt headers
 #include <QQuickPaintedItem>
+#include <QImage>
 
 namespace qan { // ::qan
 
@@ -53,7 +54,7 @@ protected:
     virtual void    inNodeRemoved( qan::Node& inNode, qan::Edge& edge ) noexcept override;
 };
 
-class FlowNode : public qan::Node
+class FlowNode : public qan::Node, public qan::FlowComputable
 {
     Q_OBJECT
 public:
@@ -86,6 +87,13 @@ protected:
 
 public slots:
     virtual void    inNodeOutputChanged();
+    //! Called by qan::FlowEngine when an input of this node has changed.
+    void            evaluate() { inNodeOutputChanged(); }
+
+public:
+    //! Default to a synchronous evaluation on GUI thread (see evaluate()).
+    virtual Computation createComputation() override { return Computation{}; }
+    virtual void    applyComputation(QVariant output) override { setOutput(output); }
 
 public:
     Q_PROPERTY(QVariant output READ getOutput WRITE setOutput NOTIFY outputChanged)
@@ -115,10 +123,8 @@ public:
     };
     Q_ENUM(Operation)
 
-    OperationNode() : qan::FlowNode{FlowNode::Type::Operation} {
-        // When user change operation, recompute an output value
-        connect(this, &OperationNode::operationChanged, this, &FlowNode::inNodeOutputChanged);
-    }
+    // Note: operation changes mark node dirty in qan::FlowGraph engine (see FlowGraph::insertFlowNode())
+    OperationNode() : qan::FlowNode{FlowNode::Type::Operation} { }
     static  QQmlComponent*      delegate(QQmlEngine& engine) noexcept;
 
     Q_PROPERTY(Operation operation READ getOperation WRITE setOperation NOTIFY operationChanged)
@@ -131,6 +137,15 @@ signals:
 
 protected slots:
     void                inNodeOutputChanged();
+
+public:
+    //! Operation is computed on a worker thread from a copy of actual inputs.
+    virtual Computation createComputation() override;
+    //! Hash of operation and actual inputs.
+    virtual std::uint64_t   computationKey() override;
+private:
+    //! Return actual valid numeric inputs.
+    std::vector<qreal>  inputs();
 };
 
 class ImageNode : public qan::FlowNode
@@ -149,6 +164,11 @@ public:
     static  QQmlComponent*      delegate(QQmlEngine& engine) noexcept;
 };
 
+/*! \brief Tint an input image, output is an implicitly shared QImage (downstream nodes and FlowImageItem take no copy).
+ *
+ * Image is tinted on a worker thread with qan::tintPixels(), decoded source image is cached. Tint is memoized by
+ * flow engine (it is not recomputed when source and tint color are unchanged, see computationKey()).
+ */
 class TintNode : public qan::FlowNode
 {
     Q_OBJECT
@@ -156,6 +176,20 @@ public:
     TintNode() : qan::FlowNode{FlowNode::Type::Tint} { }
     static  QQmlComponent*      delegate(QQmlEngine& engine) noexcept;
 
+public:
+    virtual Computation createComputation() override;
+    virtual void    applyComputation(QVariant output) override;
+    //! Hash of source image (url or upstream QImage cache key) and tint color.
+    virtual std::uint64_t   computationKey() override;
+private:
+    //! Read actual inputs, return false if an input is missing or invalid.
+    bool            inputs(QColor& tint, QImage& inputImage, QUrl& source) const;
+
+    //! Decoded source image cache (source image url, or null url for an upstream QImage).
+    QImage          _sourceImage;
+    QUrl            _sourceImageUrl;
+
+public:
     Q_PROPERTY(QUrl source READ getSource WRITE setSource NOTIFY sourceChanged)
     inline QUrl     getSource() const noexcept { return _source; }
     void            setSource(QUrl source) noexcept;
@@ -176,11 +210,38 @@ protected slots:
     void            inNodeOutputChanged();
 };
 
+//! Paint a QImage flow node output without copying it.
+class FlowImageItem : public QQuickPaintedItem
+{
+    Q_OBJECT
+public:
+    explicit FlowImageItem(QQuickItem* parent = nullptr) : QQuickPaintedItem{parent} { }
+    virtual void    paint(QPainter* painter) override;
+
+public:
+    Q_PROPERTY(QImage image READ getImage WRITE setImage NOTIFY imageChanged)
+    inline QImage   getImage() const noexcept { return _image; }
+    void            setImage(QImage image) noexcept;
+private:
+    QImage          _image;
+signals:
+    void            imageChanged();
+};
+
 class FlowGraph : public qan::Graph
 {
     Q_OBJECT
 public:
-    explicit FlowGraph( QQuickItem* parent = nullptr ) noexcept : qan::Graph(parent) { }
+    explicit FlowGraph( QQuickItem* parent = nullptr ) noexcept : qan::Graph(parent) {
+        _engine.setGraph(this);
+        _engine.setMemoSize(8);     // Toggling operations or tint inputs back and forth reuse memoized outputs
+    }
+public:
+    //! Engine evaluating flow nodes once per change, in topological order, independent nodes being computed in parallel.
+    Q_PROPERTY(qan::FlowEngine* engine READ getEngine CONSTANT FINAL)
+    inline qan::FlowEngine* getEngine() noexcept { return &_engine; }
+private:
+    qan::FlowExecutor       _engine;
 public:
     Q_INVOKABLE qan::Node*  insertFlowNode(int type) { return insertFlowNode(static_cast<FlowNode::Type>(type)); }       // FlowNode::Type could not be used from QML, Qt 5.10 bug???
     qan::Node*              insertFlowNode(FlowNode::Type type);
@@ -0,0 +1,166 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTintKernel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cstring>
+
+#if defined(__AVX2__)
+#define QAN_TINT_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QAN_TINT_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define QAN_TINT_NEON
+#include <arm_neon.h>
+#endif
+
+// QuickQanava headers
+#include "./qanTintKernel.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+// Note: x / 255 rounded to nearest, exact for x in [0, 255 * 255]
+inline std::uint32_t    div255(std::uint32_t x) noexcept { x += 128; return (x + (x >> 8)) >> 8; }
+
+inline std::uint32_t    tintPixel(std::uint32_t p, const std::uint32_t (&tc)[4], std::uint32_t ta) noexcept
+{
+    const auto a = p >> 24;
+    std::uint32_t r = 0;
+    for (unsigned s = 0; s < 32; s += 8) {
+        const auto c = (p >> s) & 0xFF;
+        r |= div255(c * (255 - ta) + div255(tc[s / 8] * a) * ta) << s;
+    }
+    return r;
+}
+
+#if defined(QAN_TINT_AVX2) || defined(QAN_TINT_SSE2)
+// x / 255 rounded to nearest on 16 bits lanes
+template <class V, class Add, class Srl>
+inline V    div255(V x, V c128, Add add, Srl srl) noexcept { x = add(x, c128); return srl(add(x, srl(x))); }
+#endif
+
+} // ::qan::anonymous
+
+void    tintPixels(std::uint32_t* pixels, std::size_t count, std::uint32_t tint) noexcept
+{
+    if (pixels == nullptr)
+        return;
+    const std::uint32_t ta = tint >> 24;
+    if (ta == 0)
+        return;
+    // Tint color per channel in memory order (B, G, R, A), alpha "color" is 255 so that alpha is preserved
+    const std::uint32_t tc[4] = { tint & 0xFF, (tint >> 8) & 0xFF, (tint >> 16) & 0xFF, 255 };
+    std::size_t i = 0;
+#if defined(QAN_TINT_AVX2)
+    {
+        const auto tc16 = _mm256_setr_epi16(tc[0], tc[1], tc[2], tc[3], tc[0], tc[1], tc[2], tc[3],
+                                            tc[0], tc[1], tc[2], tc[3], tc[0], tc[1], tc[2], tc[3]);
+        const auto ta16 = _mm256_set1_epi16(static_cast<short>(ta));
+        const auto inv16 = _mm256_set1_epi16(static_cast<short>(255 - ta));
+        const auto c128 = _mm256_set1_epi16(128);
+        const auto zero = _mm256_setzero_si256();
+        const auto add = [](__m256i a, __m256i b) { return _mm256_add_epi16(a, b); };
+        const auto srl = [](__m256i a) { return _mm256_srli_epi16(a, 8); };
+        const auto blend = [&](__m256i p) {
+            const auto a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(p, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            const auto premul = div255(_mm256_mullo_epi16(tc16, a), c128, add, srl);
+            return div255(_mm256_add_epi16(_mm256_mullo_epi16(p, inv16), _mm256_mullo_epi16(premul, ta16)), c128, add, srl);
+        };
+        for (; i + 8 <= count; i += 8) {
+            const auto p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + i));
+            const auto lo = blend(_mm256_unpacklo_epi8(p, zero));
+            const auto hi = blend(_mm256_unpackhi_epi8(p, zero));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i), _mm256_packus_epi16(lo, hi));
+        }
+    }
+#elif defined(QAN_TINT_SSE2)
+    {
+        const auto tc16 = _mm_setr_epi16(tc[0], tc[1], tc[2], tc[3], tc[0], tc[1], tc[2], tc[3]);
+        const auto ta16 = _mm_set1_epi16(static_cast<short>(ta));
+        const auto inv16 = _mm_set1_epi16(static_cast<short>(255 - ta));
+        const auto c128 = _mm_set1_epi16(128);
+        const auto zero = _mm_setzero_si128();
+        const auto add = [](__m128i a, __m128i b) { return _mm_add_epi16(a, b); };
+        const auto srl = [](__m128i a) { return _mm_srli_epi16(a, 8); };
+        const auto blend = [&](__m128i p) {
+            const auto a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(p, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            const auto premul = div255(_mm_mullo_epi16(tc16, a), c128, add, srl);
+            return div255(_mm_add_epi16(_mm_mullo_epi16(p, inv16), _mm_mullo_epi16(premul, ta16)), c128, add, srl);
+        };
+        for (; i + 4 <= count; i += 4) {
+            const auto p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+            const auto lo = blend(_mm_unpacklo_epi8(p, zero));
+            const auto hi = blend(_mm_unpackhi_epi8(p, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_packus_epi16(lo, hi));
+        }
+    }
+#elif defined(QAN_TINT_NEON)
+    {
+        const auto ta8 = vdup_n_u8(static_cast<std::uint8_t>(ta));
+        const auto inv8 = vdup_n_u8(static_cast<std::uint8_t>(255 - ta));
+        const auto div255 = [](uint16x8_t x) {
+            x = vaddq_u16(x, vdupq_n_u16(128));
+            return vshrn_n_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), 8);
+        };
+        for (; i + 8 <= count; i += 8) {
+            auto p = vld4_u8(reinterpret_cast<const std::uint8_t*>(pixels + i));     // Deinterleaved B, G, R, A
+            for (int c = 0; c < 3; ++c) {
+                const auto premul = div255(vmull_u8(vdup_n_u8(static_cast<std::uint8_t>(tc[c])), p.val[3]));
+                p.val[c] = div255(vmlal_u8(vmull_u8(p.val[c], inv8), premul, ta8));
+            }
+            vst4_u8(reinterpret_cast<std::uint8_t*>(pixels + i), p);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+        pixels[i] = tintPixel(pixels[i], tc, ta);
+}
+
+const char* tintPixelsIsa() noexcept
+{
+#if defined(QAN_TINT_AVX2)
+    return "AVX2";
+#elif defined(QAN_TINT_SSE2)
+    return "SSE2";
+#elif defined(QAN_TINT_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+} // ::qan
@@ -0,0 +1,57 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTintKernel.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef qanTintKernel_h
+#define qanTintKernel_h
+
+// Std headers
+#include <cstddef>
+#include <cstdint>
+
+namespace qan { // ::qan
+
+/*! \brief Tint \c count premultiplied ARGB32 \c pixels in place with \c tint (0xAARRGGBB, tint alpha is the tint amount).
+ *
+ * Every color channel is blended with the tint color premultiplied by pixel alpha: c = (c * (255 - ta) + tc * a / 255 * ta) / 255,
+ * pixel alpha is preserved (same result than a QtGraphicalEffects ColorOverlay with a translucent color).
+ * Vectorized with AVX2, SSE2 or NEON depending on target architecture, results are identical to the scalar version.
+ */
+void        tintPixels(std::uint32_t* pixels, std::size_t count, std::uint32_t tint) noexcept;
+
+//! Return the instruction set used by tintPixels() ("AVX2", "SSE2", "NEON" or "Scalar").
+const char* tintPixelsIsa() noexcept;
+
+} // ::qan
+
+#endif // qanTintKernel_h
@@ -8,6 +8,8 @@ import "qrc:/QuickQanava"   as Qan
 
 Item {
     Qan.LineGrid { id: lineGrid }
+    Qan.ShaderGrid { id: shaderLineGrid; anchors.fill: parent; gridScale: 25 }
+    Qan.ShaderGrid { id: shaderPointGrid; anchors.fill: parent; gridScale: 25; gridStyle: Qan.ShaderGrid.Points }
 
     Qan.Navigable {
         id: navigable
@@ -65,13 +67,17 @@ Item {
             textRole: "key"
             model: ListModel {
                 ListElement { key: "Lines";  value: 25 }
+                ListElement { key: "Shader Lines";  value: 25 }
+                ListElement { key: "Shader Points";  value: 25 }
                 ListElement { key: "None"; value: 50 }
             }
             currentIndex: 0 // Default to "Lines"
             onActivated: {
                 switch ( currentIndex ) {
                 case 0: navigable.grid = lineGrid; break;
-                case 2: navigable.grid = null; break;
+                case 1: navigable.grid = shaderLineGrid; break;
+                case 2: navigable.grid = shaderPointGrid; break;
+                case 3: navigable.grid = null; break;
                 }
             }
         }
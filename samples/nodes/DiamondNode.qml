@@ -45,21 +45,9 @@ Qan.NodeItem {
     width: Layout.preferredWidth
     height: Layout.preferredHeight
 
-    property var symbolPolygon: new Array(5)
-    complexBoundingShape: true                  // SAMPLE: Do not forget to set complexBoundingShape to true for non
-    onRequestUpdateBoundingShape: {             // rectangular node otherwise requestUpdateBoundingShape() will never be
-        var w = width - 1                       // called (an a rectangular BS will be generated more efficietly from c++)
-        var w2 = w / 2
-        var w5 = w / 4
-        var h = height - 1
-        var h2 = h / 2
-        symbolPolygon[0] = Qt.point( w2, 1 )
-        symbolPolygon[1] = Qt.point( w2 + h2, h2 )
-        symbolPolygon[2] = Qt.point( w2, h )
-        symbolPolygon[3] = Qt.point( w2 - h2, h2 )
-        symbolPolygon[4] = Qt.point( w2, 1 )
-        setBoundingShape( symbolPolygon )
-    }
+    // SAMPLE: Native bounding shape provider for non rectangular nodes, diamond shape is generated from c++ and
+    // shared between diamond nodes of the same size (no need for complexBoundingShape and onRequestUpdateBoundingShape()).
+    shapeProvider: Qan.BoundingShape { shape: Qan.BoundingShape.Diamond }
 
     Qan.CanvasNodeTemplate {
         id: template
@@ -78,9 +66,9 @@ Qan.NodeItem {
                 var w = width - 1;  var w2 = w / 2
                 var h = height - 1; var h2 = h / 2
                 ctx.moveTo( w2, 1 )
-                ctx.lineTo( w2 + h2, h2 )
+                ctx.lineTo( w, h2 )
                 ctx.lineTo( w2, h )
-                ctx.lineTo( w2 - h2, h2 )
+                ctx.lineTo( 1, h2 )
                 ctx.lineTo( w2, 1 )
                 ctx.stroke( )
                 var gradient = ctx.createLinearGradient(0, 0, width, height);
@@ -0,0 +1,387 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanStress.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+
+// Qt headers
+#include <QQuickItem>
+
+#if defined(Q_OS_LINUX)
+#include <unistd.h>         // sysconf()
+#endif
+
+// GTpo headers
+#include <gtpo/generator.h>
+
+// QuickQanava headers
+#include "./qanStress.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Primitives base for a raw GTpo topology (gtpo::empty can't be constructed from a parent pointer).
+struct TopologyBase {
+    TopologyBase(void* = nullptr) noexcept { }
+};
+
+//! Raw (non visual, behaviour-less) GTpo topology used as generators output.
+struct TopologyConfig final : public gtpo::config<TopologyConfig>
+{
+    using graph_base = TopologyBase;
+    using node_base  = TopologyBase;
+    using edge_base  = TopologyBase;
+    using graph_behaviours = std::tuple< >;
+    using group_behaviours = std::tuple< >;
+    using node_behaviours = std::tuple< >;
+};
+
+} // ::qan::anonymous
+
+/* StressGraph Generation *///-------------------------------------------------
+qint64  StressGraph::generate(int nodes, int edges, int groups, bool styled, int seed)
+{
+    QElapsedTimer timer;
+    timer.start();
+    clearGraph();
+    _styles.clear();
+    nodes = qMax(0, nodes);
+    edges = qMax(0, edges);
+    groups = qMax(0, groups);
+
+    // Generate a raw GTpo topology with about edges edges: G(n, p) with p = m / n(n-1)
+    gtpo::graph<TopologyConfig> topology;
+    const double p = nodes > 1 ? qBound(0., static_cast<double>(edges) / (static_cast<double>(nodes) * (nodes - 1.)), 1.) : 0.;
+    gtpo::gnp_random_graph(topology, nodes, p, static_cast<std::mt19937::result_type>(seed));
+
+    // Node styles: a set of rich (gradient fill + shadow) styles or a single flat one
+    if ( styled ) {
+        const QColor colors[] = { QColor{"#03A9F4"}, QColor{"#8BC34A"}, QColor{"#FF9800"}, QColor{"#E91E63"} };
+        for ( const auto& color : colors ) {
+            auto style = std::make_unique<qan::NodeStyle>();
+            style->setFillType(qan::NodeStyle::FillType::FillGradient);
+            style->setBaseColor(color);
+            style->setBackColor(color.lighter(150));
+            style->setEffectType(qan::NodeStyle::EffectType::EffectShadow);
+            style->setEffectEnabled(true);
+            _styles.push_back(std::move(style));
+        }
+    } else {
+        auto style = std::make_unique<qan::NodeStyle>();
+        style->setFillType(qan::NodeStyle::FillType::FillSolid);
+        style->setEffectType(qan::NodeStyle::EffectType::EffectNone);
+        style->setEffectEnabled(false);
+        style->setBackRadius(0.);
+        _styles.push_back(std::move(style));
+    }
+
+    static constexpr qreal nodeWidth{100.}, nodeHeight{45.};
+    static constexpr qreal xSpacing{60.}, ySpacing{40.}, padding{20.};
+
+    // Mirror topology nodes, the first groups * nodesPerGroup nodes are grouped
+    const int groupedCount = qMin(nodes, groups * _nodesPerGroup);
+    const int columns = qMax(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(nodes - groupedCount)))));
+    std::vector<qan::Node*> inserted;
+    inserted.reserve(static_cast<std::size_t>(nodes));
+    std::unordered_map<const void*, std::size_t> indexes;
+    indexes.reserve(static_cast<std::size_t>(nodes));
+    for ( const auto& topologyNode : topology.get_nodes() ) {
+        const auto n = inserted.size();
+        indexes.emplace(topologyNode.get(), n);
+        auto node = insertNode(nullptr, _styles[n % _styles.size()].get());
+        inserted.push_back(node);
+        if ( node == nullptr ||
+             node->getItem() == nullptr )
+            continue;
+        node->setLabel(QString::number(n));
+        const int gridIndex = static_cast<int>(n) - groupedCount;
+        if ( gridIndex >= 0 )
+            node->getItem()->setRect({ (gridIndex % columns) * (nodeWidth + xSpacing),
+                                       (gridIndex / columns) * (nodeHeight + ySpacing),
+                                       nodeWidth, nodeHeight });
+    }
+
+    // Groups are laid out in a row above the node grid
+    const int groupRows = (_nodesPerGroup + 1) / 2;
+    const QSizeF groupSize{ 2 * nodeWidth + xSpacing / 2. + 2 * padding,
+                            groupRows * (nodeHeight + ySpacing / 2.) + 2 * padding };
+    for ( int g = 0; g < groups; ++g ) {
+        auto group = insertGroup();
+        if ( group == nullptr ||
+             group->getItem() == nullptr )
+            continue;
+        group->setLabel(QStringLiteral("Group ") + QString::number(g));
+        group->getItem()->setRect({ g * (groupSize.width() + xSpacing), -(groupSize.height() + 2 * ySpacing),
+                                    groupSize.width(), groupSize.height() });
+        for ( int i = 0; i < _nodesPerGroup; ++i ) {
+            const int n = g * _nodesPerGroup + i;
+            if ( n >= groupedCount )
+                break;
+            auto node = inserted[static_cast<std::size_t>(n)];
+            if ( node == nullptr ||
+                 !groupNode(group, node, false) ||
+                 node->getItem() == nullptr )
+                continue;
+            node->getItem()->setRect({ padding + (i % 2) * (nodeWidth + xSpacing / 2.),
+                                       padding + (i / 2) * (nodeHeight + ySpacing / 2.),
+                                       nodeWidth, nodeHeight });
+        }
+    }
+
+    // Mirror topology edges
+    for ( const auto& topologyEdge : topology.get_edges() ) {
+        const auto src = indexes.find(topologyEdge->get_src().lock().get());
+        const auto dst = indexes.find(topologyEdge->get_dst().lock().get());
+        if ( src != indexes.end() &&
+             dst != indexes.end() &&
+             inserted[src->second] != nullptr &&
+             inserted[dst->second] != nullptr )
+            insertEdge(inserted[src->second], inserted[dst->second]);
+    }
+    return timer.elapsed();
+}
+
+void    StressGraph::setNodesPerGroup(int nodesPerGroup) noexcept
+{
+    nodesPerGroup = qMax(1, nodesPerGroup);
+    if ( nodesPerGroup != _nodesPerGroup ) {
+        _nodesPerGroup = nodesPerGroup;
+        emit nodesPerGroupChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* StressGraph Scripted Interactions *///--------------------------------------
+void    StressGraph::selectRandomNodes(int count)
+{
+    clearSelection();
+    std::vector<qan::Node*> candidates;     // Only ungrouped nodes with an item
+    for ( const auto& node : get_nodes() )
+        if ( node &&
+             !node->isGroup() &&
+             node->get_group().expired() &&
+             node->getItem() != nullptr )
+            candidates.push_back(node.get());
+    if ( candidates.empty() )
+        return;
+    static std::mt19937 generator{42};
+    std::shuffle(candidates.begin(), candidates.end(), generator);
+    count = qBound(0, count, static_cast<int>(candidates.size()));
+    for ( int n = 0; n < count; ++n )
+        setNodeSelected(candidates[static_cast<std::size_t>(n)], true);
+}
+
+void    StressGraph::dragSelection(QPointF delta)
+{
+    const auto& selectedNodes = getSelectedNodes();
+    if ( selectedNodes.size() == 0 )
+        return;
+    const auto node = selectedNodes.at(0);
+    if ( node == nullptr ||
+         node->getItem() == nullptr )
+        return;
+    // Drive the primary dragged node controller like a mouse drag, selection follows
+    auto& draggableCtrl = node->getItem()->draggableCtrl();
+    draggableCtrl.beginDragMove(QPointF{0., 0.}, true);
+    draggableCtrl.dragMove(delta, true);
+    draggableCtrl.endDragMove(true);
+}
+//-----------------------------------------------------------------------------
+
+
+/* StressMonitor Object Management *///----------------------------------------
+StressMonitor::StressMonitor(QObject* parent) :
+    QObject{parent}
+{
+    _clock.start();
+    _sampleTimer.setInterval(1000);
+    connect(&_sampleTimer, &QTimer::timeout, this, &StressMonitor::sample);
+    _sampleTimer.start();
+}
+
+StressMonitor::~StressMonitor()
+{
+    _csvStream.flush();
+}
+
+void    StressMonitor::setWindow(QQuickWindow* window) noexcept
+{
+    if ( window == _window )
+        return;
+    if ( _window )
+        disconnect(_window, nullptr, this, nullptr);
+    _window = window;
+    if ( _window )
+        connect(_window, &QQuickWindow::frameSwapped, this, &StressMonitor::frameSwapped);
+    reset();
+    emit windowChanged();
+}
+
+void    StressMonitor::setGraph(qan::Graph* graph) noexcept
+{
+    if ( graph != _graph ) {
+        _graph = graph;
+        emit graphChanged();
+    }
+}
+
+void    StressMonitor::setSampleInterval(int sampleInterval) noexcept
+{
+    sampleInterval = qMax(100, sampleInterval);
+    if ( sampleInterval != _sampleTimer.interval() ) {
+        _sampleTimer.setInterval(sampleInterval);
+        emit sampleIntervalChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* StressMonitor Metrics *///--------------------------------------------------
+void    StressMonitor::reset()
+{
+    _lastFrame = -1;
+    _frameTime = 0.;
+    _frameTimeSum = 0.;
+    _maxFrameTime = 0.;
+    _frameCount = 0;
+    _sampleFrameCount = 0;
+    _lastSample = _clock.nsecsElapsed();
+    _fps = 0.;
+    _latency = 0.;
+    emit metricsChanged();
+}
+
+void    StressMonitor::mark(const QString& action)
+{
+    _pendingAction = action;
+    _pendingActionTime = _clock.nsecsElapsed();
+    if ( _window )      // Ensure a frame is rendered even if action does not modify the scene
+        _window->update();
+}
+
+void    StressMonitor::frameSwapped()
+{
+    const auto now = _clock.nsecsElapsed();
+    qreal frameTime = 0.;
+    if ( _lastFrame >= 0 ) {
+        frameTime = (now - _lastFrame) / 1e6;
+        _frameTime = frameTime;
+        _frameTimeSum += frameTime;
+        _maxFrameTime = qMax(_maxFrameTime, frameTime);
+        ++_frameCount;
+    }
+    _lastFrame = now;
+    ++_sampleFrameCount;
+
+    QString action;
+    qreal latency = 0.;
+    if ( !_pendingAction.isEmpty() ) {
+        action = _pendingAction;
+        latency = _latency = (now - _pendingActionTime) / 1e6;
+        _pendingAction.clear();
+    }
+    writeRow(frameTime, action, latency);
+}
+
+void    StressMonitor::sample()
+{
+    const auto now = _clock.nsecsElapsed();
+    const auto elapsed = now - _lastSample;
+    _fps = elapsed > 0 ? _sampleFrameCount * 1e9 / elapsed : 0.;
+    _sampleFrameCount = 0;
+    _lastSample = now;
+    _itemCount = _window ? countItems(_window->contentItem()) : 0;
+    _nodeCount = _graph ? static_cast<int>(_graph->get_node_count()) : 0;
+    _edgeCount = _graph ? static_cast<int>(_graph->get_edge_count()) : 0;
+    _memory = residentMemory();
+    emit metricsChanged();
+}
+
+void    StressMonitor::setCsvFile(const QString& csvFile) noexcept
+{
+    if ( csvFile == _csvFile )
+        return;
+    _csvStream.flush();
+    _csvStream.setDevice(nullptr);
+    _csv.close();
+    _csvFile = csvFile;
+    if ( !_csvFile.isEmpty() ) {
+        _csv.setFileName(_csvFile);
+        if ( _csv.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text) ) {
+            _csvStream.setDevice(&_csv);
+            _csvStream << "time,frame,action,latency,items,nodes,edges,memory\n";
+        } else
+            qWarning() << "qan::StressMonitor::setCsvFile(): Error: can't open " << _csvFile << " for writing.";
+    }
+    emit csvFileChanged();
+}
+
+void    StressMonitor::writeRow(qreal frameTime, const QString& action, qreal latency)
+{
+    if ( _csvStream.device() == nullptr )
+        return;
+    _csvStream << _clock.elapsed() << ',' << frameTime << ',' << action << ',' << latency << ','
+               << _itemCount << ',' << _nodeCount << ',' << _edgeCount << ','
+               << _memory << '\n';
+}
+
+int     StressMonitor::countItems(const QQuickItem* item) noexcept
+{
+    if ( item == nullptr )
+        return 0;
+    int count = 1;
+    for ( const auto child : item->childItems() )
+        count += countItems(child);
+    return count;
+}
+
+qreal   StressMonitor::residentMemory() noexcept
+{
+#if defined(Q_OS_LINUX)
+    // /proc/self/statm second field is resident set size in pages
+    QFile statm{QStringLiteral("/proc/self/statm")};
+    if ( statm.open(QIODevice::ReadOnly | QIODevice::Text) ) {
+        const auto fields = QString::fromLatin1(statm.readLine()).split(' ');
+        if ( fields.size() > 1 )
+            return fields.at(1).toLongLong() * static_cast<qreal>(sysconf(_SC_PAGESIZE)) / (1024. * 1024.);
+    }
+#endif
+    return 0.;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
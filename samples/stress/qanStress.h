@@ -0,0 +1,219 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanStress.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#ifndef qanStress_h
+#define qanStress_h
+
+// Std headers
+#include <vector>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Qt headers
+#include <QQuickWindow>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QFile>
+#include <QTextStream>
+
+namespace qan { // ::qan
+
+/*! \brief Graph generating large parameterized topologies with GTpo generators for stress testing.
+ *
+ * Topology is generated with gtpo::gnp_random_graph() in a raw GTpo graph, then mirrored in this graph
+ * with real node, edge and group items: \c nodes are laid out on a grid, \c groups are created with
+ * up to \c nodesPerGroup nodes each.
+ */
+class StressGraph : public qan::Graph
+{
+    Q_OBJECT
+public:
+    explicit StressGraph(QQuickItem* parent = nullptr) : qan::Graph{parent} { }
+    virtual ~StressGraph() override = default;
+    StressGraph(const StressGraph&) = delete;
+
+public:
+    /*! \brief Clear graph and generate a random graph with \c nodes nodes, about \c edges edges and \c groups groups.
+     *
+     * \param styled when true, nodes use a set of rich styles (gradient fill, shadow effect), otherwise a single flat style.
+     * \param seed generated topology is deterministic for a given seed.
+     * \return generation time in ms (topology and items creation).
+     */
+    Q_INVOKABLE qint64  generate(int nodes, int edges, int groups, bool styled, int seed = 42);
+
+    //! Maximum number of nodes inserted in each generated group (default to 8).
+    Q_PROPERTY(int nodesPerGroup READ getNodesPerGroup WRITE setNodesPerGroup NOTIFY nodesPerGroupChanged FINAL)
+    inline int          getNodesPerGroup() const noexcept { return _nodesPerGroup; }
+    void                setNodesPerGroup(int nodesPerGroup) noexcept;
+private:
+    int                 _nodesPerGroup = 8;
+signals:
+    void                nodesPerGroupChanged();
+
+public:
+    //! Select \c count randomly choosen nodes (previous selection is cleared).
+    Q_INVOKABLE void    selectRandomNodes(int count);
+    //! Drag actual selection by \c delta (in graph coordinates) with node draggable controllers, as a mouse drag would.
+    Q_INVOKABLE void    dragSelection(QPointF delta);
+
+private:
+    std::vector<std::unique_ptr<qan::NodeStyle>>    _styles;
+};
+
+/*! \brief Monitor \c window frame times, item count and memory, and optionally record them in a CSV file.
+ *
+ * Frame time is measured between two QQuickWindow::frameSwapped() signals, action latency is the time
+ * elapsed between a call to mark() and the next swapped frame. Item count, graph size and memory are sampled every
+ * \c sampleInterval ms since counting items is linear in the number of items.
+ *
+ * CSV columns: time (ms), frame (ms), action, latency (ms), items, nodes, edges, memory (MB).
+ */
+class StressMonitor : public QObject
+{
+    Q_OBJECT
+public:
+    explicit StressMonitor(QObject* parent = nullptr);
+    virtual ~StressMonitor() override;
+    StressMonitor(const StressMonitor&) = delete;
+
+public:
+    Q_PROPERTY(QQuickWindow* window READ getWindow WRITE setWindow NOTIFY windowChanged FINAL)
+    inline QQuickWindow*    getWindow() const noexcept { return _window.data(); }
+    void                    setWindow(QQuickWindow* window) noexcept;
+private:
+    QPointer<QQuickWindow>  _window;
+signals:
+    void                    windowChanged();
+
+public:
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*      getGraph() const noexcept { return _graph.data(); }
+    void                    setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                    graphChanged();
+
+public:
+    //! Item count and memory sampling interval in ms (default to 1000ms, minimum 100ms).
+    Q_PROPERTY(int sampleInterval READ getSampleInterval WRITE setSampleInterval NOTIFY sampleIntervalChanged FINAL)
+    inline int              getSampleInterval() const noexcept { return _sampleTimer.interval(); }
+    void                    setSampleInterval(int sampleInterval) noexcept;
+signals:
+    void                    sampleIntervalChanged();
+
+public:
+    //! Last frame time in ms.
+    Q_PROPERTY(qreal frameTime READ getFrameTime NOTIFY metricsChanged FINAL)
+    inline qreal            getFrameTime() const noexcept { return _frameTime; }
+    //! Average frame time in ms since last reset().
+    Q_PROPERTY(qreal averageFrameTime READ getAverageFrameTime NOTIFY metricsChanged FINAL)
+    inline qreal            getAverageFrameTime() const noexcept { return _frameCount > 0 ? _frameTimeSum / _frameCount : 0.; }
+    //! Maximum frame time in ms since last reset().
+    Q_PROPERTY(qreal maxFrameTime READ getMaxFrameTime NOTIFY metricsChanged FINAL)
+    inline qreal            getMaxFrameTime() const noexcept { return _maxFrameTime; }
+    //! Frame per seconds over the last sample interval.
+    Q_PROPERTY(qreal fps READ getFps NOTIFY metricsChanged FINAL)
+    inline qreal            getFps() const noexcept { return _fps; }
+    //! Latency in ms of the last mark()ed action.
+    Q_PROPERTY(qreal latency READ getLatency NOTIFY metricsChanged FINAL)
+    inline qreal            getLatency() const noexcept { return _latency; }
+    //! Number of QQuickItem in window (sampled).
+    Q_PROPERTY(int itemCount READ getItemCount NOTIFY metricsChanged FINAL)
+    inline int              getItemCount() const noexcept { return _itemCount; }
+    //! Number of nodes (including groups) in graph (sampled).
+    Q_PROPERTY(int nodeCount READ getNodeCount NOTIFY metricsChanged FINAL)
+    inline int              getNodeCount() const noexcept { return _nodeCount; }
+    //! Number of edges in graph (sampled).
+    Q_PROPERTY(int edgeCount READ getEdgeCount NOTIFY metricsChanged FINAL)
+    inline int              getEdgeCount() const noexcept { return _edgeCount; }
+    //! Process resident memory in MB (sampled, 0 when unavailable on actual platform).
+    Q_PROPERTY(qreal memory READ getMemory NOTIFY metricsChanged FINAL)
+    inline qreal            getMemory() const noexcept { return _memory; }
+signals:
+    //! Emitted when frame metrics are updated (at most once per sample interval).
+    void                    metricsChanged();
+
+public:
+    //! Reset frame time statistics.
+    Q_INVOKABLE void        reset();
+    //! Mark the beginning of an \c action, its latency is measured up to the next swapped frame.
+    Q_INVOKABLE void        mark(const QString& action);
+
+public:
+    //! Record metrics in \c csvFile when not empty (file is truncated when recording starts).
+    Q_PROPERTY(QString csvFile READ getCsvFile WRITE setCsvFile NOTIFY csvFileChanged FINAL)
+    inline QString          getCsvFile() const noexcept { return _csvFile; }
+    void                    setCsvFile(const QString& csvFile) noexcept;
+private:
+    QString                 _csvFile;
+signals:
+    void                    csvFileChanged();
+
+private:
+    void                    frameSwapped();
+    void                    sample();
+    void                    writeRow(qreal frameTime, const QString& action, qreal latency);
+    static int              countItems(const QQuickItem* item) noexcept;
+    static qreal            residentMemory() noexcept;
+
+private:
+    QElapsedTimer           _clock;
+    QTimer                  _sampleTimer;
+    qint64                  _lastFrame = -1;        // ns
+    qreal                   _frameTime = 0.;
+    qreal                   _frameTimeSum = 0.;
+    qreal                   _maxFrameTime = 0.;
+    int                     _frameCount = 0;
+    int                     _sampleFrameCount = 0;
+    qint64                  _lastSample = 0;        // ns
+    qreal                   _fps = 0.;
+    qreal                   _latency = 0.;
+    QString                 _pendingAction;
+    qint64                  _pendingActionTime = 0; // ns
+    int                     _itemCount = 0;
+    int                     _nodeCount = 0;
+    int                     _edgeCount = 0;
+    qreal                   _memory = 0.;
+    QFile                   _csv;
+    QTextStream             _csvStream;
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::StressGraph)
+QML_DECLARE_TYPE(qan::StressMonitor)
+
+#endif // qanStress_h
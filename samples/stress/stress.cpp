@@ -0,0 +1,88 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	stress.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QtQml>
+#include <QQuickStyle>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./qanStress.h"
+
+//-----------------------------------------------------------------------------
+int	main( int argc, char** argv )
+{
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
+    QQuickStyle::setStyle("Material");
+
+    // Generated graph and scenario are configurable from command line, ex for release validation:
+        // sample_stress --nodes 5000 --edges 10000 --groups 50 --csv stress.csv --quit
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("QuickQanava large graph stress sample"));
+    parser.addHelpOption();
+    const QCommandLineOption nodesOption{QStringLiteral("nodes"), QStringLiteral("Generated node count."), QStringLiteral("n"), QStringLiteral("1000")};
+    const QCommandLineOption edgesOption{QStringLiteral("edges"), QStringLiteral("Generated edge count (approximative)."), QStringLiteral("m"), QStringLiteral("2000")};
+    const QCommandLineOption groupsOption{QStringLiteral("groups"), QStringLiteral("Generated group count."), QStringLiteral("g"), QStringLiteral("10")};
+    const QCommandLineOption seedOption{QStringLiteral("seed"), QStringLiteral("Topology generator seed."), QStringLiteral("seed"), QStringLiteral("42")};
+    const QCommandLineOption flatOption{QStringLiteral("flat"), QStringLiteral("Disable node styles (no gradient, no effect).")};
+    const QCommandLineOption csvOption{QStringLiteral("csv"), QStringLiteral("Record frame metrics in CSV file."), QStringLiteral("file")};
+    const QCommandLineOption autorunOption{QStringLiteral("autorun"), QStringLiteral("Run scripted scenario at startup.")};
+    const QCommandLineOption quitOption{QStringLiteral("quit"), QStringLiteral("Run scripted scenario and quit when it ends.")};
+    parser.addOptions({nodesOption, edgesOption, groupsOption, seedOption, flatOption, csvOption, autorunOption, quitOption});
+    parser.process(app);
+
+    QVariantMap options;
+    options.insert(QStringLiteral("nodes"), parser.value(nodesOption).toInt());
+    options.insert(QStringLiteral("edges"), parser.value(edgesOption).toInt());
+    options.insert(QStringLiteral("groups"), parser.value(groupsOption).toInt());
+    options.insert(QStringLiteral("seed"), parser.value(seedOption).toInt());
+    options.insert(QStringLiteral("styled"), !parser.isSet(flatOption));
+    options.insert(QStringLiteral("csv"), parser.value(csvOption));
+    options.insert(QStringLiteral("autorun"), parser.isSet(autorunOption) || parser.isSet(quitOption));
+    options.insert(QStringLiteral("quit"), parser.isSet(quitOption));
+
+    QQmlApplicationEngine engine;
+    engine.addPluginPath(QStringLiteral("../../src")); // Necessary only for development when plugin is not installed to QTDIR/qml
+    QuickQanava::initialize(&engine);
+    qmlRegisterType< qan::StressGraph >( "QuickQanava.Samples", 1, 0, "StressGraph");
+    qmlRegisterType< qan::StressMonitor >( "QuickQanava.Samples", 1, 0, "StressMonitor");
+    engine.rootContext()->setContextProperty(QStringLiteral("stressOptions"), options);
+
+    engine.load(QUrl("qrc:/stress.qml"));
+    return app.exec();
+}
+//-----------------------------------------------------------------------------
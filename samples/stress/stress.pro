@@ -0,0 +1,15 @@
+TEMPLATE    = app
+TARGET      = test-stress
+CONFIG      += qt warn_on thread c++14
+QT          += widgets core gui qml quick quickcontrols2
+
+include(../../src/quickqanava.pri)
+
+SOURCES     +=  stress.cpp      \
+                qanStress.cpp
+
+HEADERS     +=  qanStress.h
+
+OTHER_FILES +=  stress.qml
+
+RESOURCES   +=  stress.qrc
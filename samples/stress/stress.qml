@@ -0,0 +1,138 @@
+/*
+ Copyright (c) 2008-2017, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+import QtQuick                   2.8
+import QtQuick.Controls          2.1
+import QtQuick.Controls.Material 2.1
+import QtQuick.Layouts           1.3
+
+import QuickQanava          2.0 as Qan
+import QuickQanava.Samples  1.0
+import "qrc:/QuickQanava"   as Qan
+
+ApplicationWindow {
+    id: window
+    visible: true
+    width: 1280; height: 720
+    title: "Stress sample"
+    Pane { anchors.fill: parent }
+
+    StressMonitor {
+        id: monitor
+        window: window
+        graph: graph
+        csvFile: stressOptions.csv
+    }
+
+    Qan.GraphView {
+        id: graphView
+        anchors.fill: parent
+        navigable   : true
+        graph: StressGraph {
+            id: graph
+            Component.onCompleted: generate()
+            function generate() {
+                var ms = graph.generate(nodesSpin.value, edgesSpin.value, groupsSpin.value,
+                                        styledCheck.checked, stressOptions.seed)
+                generationLabel.text = "Generated in " + ms + "ms"
+                graphView.fitInView()
+                monitor.reset()
+            }
+        }
+    }  // Qan.GraphView
+
+    // Scripted scenario: every step is mark()ed in monitor to measure its latency up to next frame
+    Timer {
+        id: scenario
+        interval: 100; repeat: true
+        property int step: 0
+        property int loops: 3
+        readonly property var steps: [
+            { name: "zoomIn",   run: function() { graphView.zoomOn(Qt.point(graphView.width / 2, graphView.height / 2), graphView.zoom * 1.5) } },
+            { name: "zoomIn",   run: function() { graphView.zoomOn(Qt.point(graphView.width / 2, graphView.height / 2), graphView.zoom * 1.5) } },
+            { name: "panRight", run: function() { graphView.containerItem.x -= 200 } },
+            { name: "panDown",  run: function() { graphView.containerItem.y -= 200 } },
+            { name: "select",   run: function() { graph.selectRandomNodes(50) } },
+            { name: "drag",     run: function() { graph.dragSelection(Qt.point(25, 10)) } },
+            { name: "drag",     run: function() { graph.dragSelection(Qt.point(25, 10)) } },
+            { name: "drag",     run: function() { graph.dragSelection(Qt.point(-50, -20)) } },
+            { name: "clear",    run: function() { graph.clearSelection() } },
+            { name: "panLeft",  run: function() { graphView.containerItem.x += 200 } },
+            { name: "panUp",    run: function() { graphView.containerItem.y += 200 } },
+            { name: "zoomOut",  run: function() { graphView.zoomOn(Qt.point(graphView.width / 2, graphView.height / 2), graphView.zoom / 2.25) } },
+            { name: "fit",      run: function() { graphView.fitInView() } }
+        ]
+        function begin() { step = 0; monitor.reset(); start() }
+        onTriggered: {
+            if (step >= steps.length * loops) {
+                stop()
+                if (stressOptions.quit)
+                    Qt.quit()
+                return
+            }
+            var s = steps[step % steps.length]
+            monitor.mark(s.name)
+            s.run()
+            step++
+        }
+    }
+    Component.onCompleted: {
+        if (stressOptions.autorun)
+            scenario.begin()
+    }
+
+    Pane { x: menu.x; y: menu.y; width: menu.width; height: menu.height; opacity: 0.8 } // Pane: menu transparent background
+    RowLayout {
+        id: menu
+        anchors.horizontalCenter: parent.horizontalCenter
+        anchors.top: parent.top; anchors.topMargin: 4
+        Label { text: "Nodes:" }
+        SpinBox { id: nodesSpin; from: 0; to: 100000; stepSize: 500; editable: true; value: stressOptions.nodes }
+        Label { text: "Edges:" }
+        SpinBox { id: edgesSpin; from: 0; to: 500000; stepSize: 1000; editable: true; value: stressOptions.edges }
+        Label { text: "Groups:" }
+        SpinBox { id: groupsSpin; from: 0; to: 1000; stepSize: 10; editable: true; value: stressOptions.groups }
+        CheckBox { id: styledCheck; text: "Styles"; checked: stressOptions.styled }
+        ToolButton { text: "Generate"; onClicked: graph.generate() }
+        ToolButton { text: scenario.running ? "Stop" : "Run"; onClicked: scenario.running ? scenario.stop() : scenario.begin() }
+    }
+
+    Pane {      // HUD
+        anchors.left: parent.left; anchors.bottom: parent.bottom; anchors.margins: 4
+        opacity: 0.85
+        ColumnLayout {
+            Label { id: generationLabel }
+            Label { text: "Frame: " + monitor.frameTime.toFixed(1) + "ms (avg " + monitor.averageFrameTime.toFixed(1) +
+                          "ms, max " + monitor.maxFrameTime.toFixed(1) + "ms)" }
+            Label { text: "FPS: " + monitor.fps.toFixed(1) }
+            Label { text: "Last action latency: " + monitor.latency.toFixed(1) + "ms" }
+            Label { text: "Items: " + monitor.itemCount + "  Nodes: " + monitor.nodeCount + "  Edges: " + monitor.edgeCount }
+            Label { text: "Memory: " + monitor.memory.toFixed(1) + "MB" }
+            Label { visible: stressOptions.csv !== ""; text: "Recording: " + stressOptions.csv }
+        }
+    }
+}
@@ -42,10 +42,7 @@
 
 QQmlComponent*  CustomRectNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   customRectNode_delegate;
-    if ( !customRectNode_delegate )
-        customRectNode_delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/RectNode.qml");
-    return customRectNode_delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/RectNode.qml"));
 }
 
 qan::NodeStyle* CustomRectNode::style(QObject* parent) noexcept
@@ -62,10 +59,7 @@ qan::NodeStyle* CustomRectNode::style(QObject* parent) noexcept
 
 QQmlComponent*  CustomRoundNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   customRoundNode_delegate;
-    if ( !customRoundNode_delegate )
-        customRoundNode_delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/RoundNode.qml");
-    return customRoundNode_delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/RoundNode.qml"));
 }
 
 qan::NodeStyle* CustomRoundNode::style(QObject* parent) noexcept
@@ -82,11 +76,8 @@ qan::NodeStyle* CustomRoundNode::style(QObject* parent) noexcept
 
 QQmlComponent*  CustomEdge::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   customEdge_delegate;
-    if (!customEdge_delegate)
-        customEdge_delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/CustomEdge.qml",
-                                                              QQmlComponent::PreferSynchronous, parent);
-    return customEdge_delegate.get();
+    Q_UNUSED(parent)
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/CustomEdge.qml"));
 }
 
 qan::EdgeStyle* CustomEdge::style(QObject* parent) noexcept
@@ -78,20 +78,23 @@ Qan.NodeItem {
         padding: 1
         anchors.left: parent.left; anchors.bottom: parent.bottom;
         opacity: 0.9
-        Label { text: image.sourceSize.width + "x" + image.sourceSize.height + "px" }
+        Label { text: image.implicitWidth + "x" + image.implicitHeight + "px" }
     }
     Image {
         id: image
         z: 1
         anchors.fill: parent
         smooth: true
-        source: faceNodeItem.node.image
-        onSourceSizeChanged: {
-            if ( sourceSize.width > 0 &&
-                 sourceSize.height > 0 ) {
-                faceNodeItem.ratio = sourceSize.width / sourceSize.height;
+        // Shared asynchronous decoding at a power of two size following node on screen size (see qan::ImageProvider)
+        sourceSize.width: Math.pow(2, Math.ceil(Math.log(Math.max(1, width * (faceNodeItem.graph ? faceNodeItem.graph.lodZoom : 1.))) / Math.LN2))
+        source: faceNodeItem.node.image.toString() !== "" ? "image://qan/" + faceNodeItem.node.image : ""
+        onStatusChanged: {
+            if ( status === Image.Ready &&
+                 implicitWidth > 0 &&
+                 implicitHeight > 0 ) {
+                faceNodeItem.ratio = implicitWidth / implicitHeight;
                 // FIXME: generate a clean initial size here
-            } else
+            } else if ( status !== Image.Loading )
                 faceNodeItem.ratio = -1.;
         }
     }
@@ -43,10 +43,7 @@ FaceNode::FaceNode(QQuickItem* parent) :
 
 QQmlComponent*  FaceNode::delegate(QQmlEngine& engine) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if ( !delegate )
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/FaceNode.qml");
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/FaceNode.qml"));
 }
 
 void    FaceNode::setImage(QUrl image) noexcept
@@ -88,6 +88,8 @@ Item {
             width: parent.width
             verticalAlignment: Text.AlignVCenter; horizontalAlignment: Text.AlignHCenter
             text: nodeItem.node.label
+            // Label text is not rendered out of view (see Graph.viewportCulling) or when drawn by a Qan.LabelBatchRenderer
+            visible: !nodeItem.culled && !nodeItem.graph.labelsBatched
             wrapMode: Text.Wrap;    elide: Text.ElideRight; maximumLineCount: 4
         }
         Item {
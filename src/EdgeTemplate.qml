@@ -46,31 +46,35 @@ Item {
     property color color: edgeItem &&
                           edgeItem.style ? edgeItem.style.lineColor : Qt.rgba(0.,0.,0.,1.)
     // Allow direct bypass of lstyle
-    property var    lineType: edgeItem.style ? edgeItem.style.lineType : Qan.EdgeStyle.Straight
+    // Fanned parallel edges are drawn as curves whatever their style line type (see Qan.Graph.parallelEdgeSpacing)
+    property var    lineType: edgeItem.fanOffset !== 0 ? Qan.EdgeStyle.Curved
+                                                       : edgeItem.style ? edgeItem.style.lineType : Qan.EdgeStyle.Straight
     property var    dashed  : edgeItem.style && style.dashed ? ShapePath.DashLine : ShapePath.SolidLine
+    // Edge geometry is bound once: a single edgeGeometryChanged() notification is emitted per edge update
+    readonly property var   edgeGeometry: edgeItem.edgeGeometry
 
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.dstAngle
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
+        rotation: edgeGeometry.dstAngle
+        x: edgeGeometry.p2.x
+        y: edgeGeometry.p2.y
         visible: ((edgeItem.dstShape === Qan.EdgeStyle.Arrow) || (edgeItem.dstShape === Qan.EdgeStyle.ArrowOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
             strokeColor: edgeTemplate.color
             fillColor: edgeItem.dstShape === Qan.EdgeStyle.ArrowOpen ? Qt.rgba(0.,0.,0.,0.) : edgeTemplate.color
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
-            startX: edgeItem.dstA1.x;   startY: edgeItem.dstA1.y
-            PathLine { x: edgeItem.dstA3.x; y: edgeItem.dstA3.y }
-            PathLine { x: edgeItem.dstA2.x; y: edgeItem.dstA2.y }
-            PathLine { x: edgeItem.dstA1.x; y: edgeItem.dstA1.y }
+            startX: edgeGeometry.dstA1.x;   startY: edgeGeometry.dstA1.y
+            PathLine { x: edgeGeometry.dstA3.x; y: edgeGeometry.dstA3.y }
+            PathLine { x: edgeGeometry.dstA2.x; y: edgeGeometry.dstA2.y }
+            PathLine { x: edgeGeometry.dstA1.x; y: edgeGeometry.dstA1.y }
         }
     }
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.dstAngle
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
+        rotation: edgeGeometry.dstAngle
+        x: edgeGeometry.p2.x
+        y: edgeGeometry.p2.y
         visible: ((edgeItem.dstShape === Qan.EdgeStyle.Circle) || (edgeItem.dstShape === Qan.EdgeStyle.CircleOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
@@ -79,55 +83,55 @@ Item {
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
             startX: 0;   startY: 0
             PathArc {
-                relativeX: edgeItem.dstA2.x; relativeY: edgeItem.dstA2.y
-                radiusX: edgeItem.dstA1.x; radiusY: edgeItem.dstA1.y;
+                relativeX: edgeGeometry.dstA2.x; relativeY: edgeGeometry.dstA2.y
+                radiusX: edgeGeometry.dstA1.x; radiusY: edgeGeometry.dstA1.y;
             }
             PathArc {
-                relativeX: -edgeItem.dstA2.x; relativeY: edgeItem.dstA2.y
-                radiusX: edgeItem.dstA1.x; radiusY: edgeItem.dstA1.y;
+                relativeX: -edgeGeometry.dstA2.x; relativeY: edgeGeometry.dstA2.y
+                radiusX: edgeGeometry.dstA1.x; radiusY: edgeGeometry.dstA1.y;
             }
         }
     }
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.dstAngle
-        x: edgeItem.p2.x
-        y: edgeItem.p2.y
+        rotation: edgeGeometry.dstAngle
+        x: edgeGeometry.p2.x
+        y: edgeGeometry.p2.y
         visible: ((edgeItem.dstShape === Qan.EdgeStyle.Rect) || (edgeItem.dstShape === Qan.EdgeStyle.RectOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
             strokeColor: edgeTemplate.color
             fillColor: edgeItem.dstShape === Qan.EdgeStyle.RectOpen ? Qt.rgba(0.,0.,0.,0.) : edgeTemplate.color
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
-            startX: edgeItem.dstA1.x;   startY: edgeItem.dstA1.y
+            startX: edgeGeometry.dstA1.x;   startY: edgeGeometry.dstA1.y
             PathLine { x: 0.;               y: 0.               }
-            PathLine { x: edgeItem.dstA3.x; y: edgeItem.dstA3.y }
-            PathLine { x: edgeItem.dstA2.x; y: edgeItem.dstA2.y }
-            PathLine { x: edgeItem.dstA1.x; y: edgeItem.dstA1.y }
+            PathLine { x: edgeGeometry.dstA3.x; y: edgeGeometry.dstA3.y }
+            PathLine { x: edgeGeometry.dstA2.x; y: edgeGeometry.dstA2.y }
+            PathLine { x: edgeGeometry.dstA1.x; y: edgeGeometry.dstA1.y }
         }
     }
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.srcAngle
-        x: edgeItem.p1.x
-        y: edgeItem.p1.y
+        rotation: edgeGeometry.srcAngle
+        x: edgeGeometry.p1.x
+        y: edgeGeometry.p1.y
         visible: ((edgeItem.srcShape === Qan.EdgeStyle.Arrow) || (edgeItem.srcShape === Qan.EdgeStyle.ArrowOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
             strokeColor: edgeTemplate.color
             fillColor: edgeItem.srcShape === Qan.EdgeStyle.ArrowOpen ? Qt.rgba(0.,0.,0.,0.) : edgeTemplate.color
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
-            startX: edgeItem.srcA1.x;   startY: edgeItem.srcA1.y
-            PathLine { x: edgeItem.srcA3.x; y: edgeItem.srcA3.y }
-            PathLine { x: edgeItem.srcA2.x; y: edgeItem.srcA2.y }
-            PathLine { x: edgeItem.srcA1.x; y: edgeItem.srcA1.y }
+            startX: edgeGeometry.srcA1.x;   startY: edgeGeometry.srcA1.y
+            PathLine { x: edgeGeometry.srcA3.x; y: edgeGeometry.srcA3.y }
+            PathLine { x: edgeGeometry.srcA2.x; y: edgeGeometry.srcA2.y }
+            PathLine { x: edgeGeometry.srcA1.x; y: edgeGeometry.srcA1.y }
         }
     }
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.srcAngle
-        x: edgeItem.p1.x
-        y: edgeItem.p1.y
+        rotation: edgeGeometry.srcAngle
+        x: edgeGeometry.p1.x
+        y: edgeGeometry.p1.y
         visible: ((edgeItem.srcShape === Qan.EdgeStyle.Circle) || (edgeItem.srcShape === Qan.EdgeStyle.CircleOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
@@ -136,39 +140,39 @@ Item {
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
             startX: 0;   startY: 0
             PathArc {
-                relativeX: edgeItem.srcA2.x; relativeY: edgeItem.srcA2.y
-                radiusX: edgeItem.srcA1.x; radiusY: edgeItem.srcA1.y;
+                relativeX: edgeGeometry.srcA2.x; relativeY: edgeGeometry.srcA2.y
+                radiusX: edgeGeometry.srcA1.x; radiusY: edgeGeometry.srcA1.y;
             }
             PathArc {
-                relativeX: -edgeItem.srcA2.x; relativeY: edgeItem.srcA2.y
-                radiusX: edgeItem.srcA1.x; radiusY: edgeItem.srcA1.y;
+                relativeX: -edgeGeometry.srcA2.x; relativeY: edgeGeometry.srcA2.y
+                radiusX: edgeGeometry.srcA1.x; radiusY: edgeGeometry.srcA1.y;
             }
         }
     }
     Shape {
         transformOrigin: Item.TopLeft
-        rotation: edgeItem.srcAngle
-        x: edgeItem.p1.x
-        y: edgeItem.p1.y
+        rotation: edgeGeometry.srcAngle
+        x: edgeGeometry.p1.x
+        y: edgeGeometry.p1.y
         visible: ((edgeItem.srcShape === Qan.EdgeStyle.Rect) || (edgeItem.srcShape === Qan.EdgeStyle.RectOpen))
                  && edgeItem.visible && !edgeItem.hidden
         ShapePath {
             strokeColor: edgeTemplate.color
             fillColor: edgeItem.srcShape === Qan.EdgeStyle.RectOpen ? Qt.rgba(0.,0.,0.,0.) : edgeTemplate.color
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
-            startX: edgeItem.srcA1.x;   startY: edgeItem.srcA1.y
+            startX: edgeGeometry.srcA1.x;   startY: edgeGeometry.srcA1.y
             PathLine { x: 0.;               y: 0.               }
-            PathLine { x: edgeItem.srcA3.x; y: edgeItem.srcA3.y }
-            PathLine { x: edgeItem.srcA2.x; y: edgeItem.srcA2.y }
-            PathLine { x: edgeItem.srcA1.x; y: edgeItem.srcA1.y }
+            PathLine { x: edgeGeometry.srcA3.x; y: edgeGeometry.srcA3.y }
+            PathLine { x: edgeGeometry.srcA2.x; y: edgeGeometry.srcA2.y }
+            PathLine { x: edgeGeometry.srcA1.x; y: edgeGeometry.srcA1.y }
         }
     }
     Component {
         id: straightShapePath
         ShapePath {
             id: edgeShapePath
-            startX: edgeItem.p1.x
-            startY: edgeItem.p1.y
+            startX: edgeGeometry.p1.x
+            startY: edgeGeometry.p1.y
             capStyle: ShapePath.FlatCap
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
             strokeColor: edgeTemplate.color
@@ -176,8 +180,8 @@ Item {
             dashPattern: style ? style.dashPattern : [4, 2]
             fillColor: Qt.rgba(0,0,0,0)
             PathLine {
-                x: edgeItem.p2.x
-                y: edgeItem.p2.y
+                x: edgeGeometry.p2.x
+                y: edgeGeometry.p2.y
             }
         }
     }
@@ -185,30 +189,22 @@ Item {
         id: orthoShapePath
         ShapePath {
             id: edgeShapePath
-            startX: edgeItem.p1.x
-            startY: edgeItem.p1.y
             capStyle: ShapePath.FlatCap
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
             strokeColor: edgeTemplate.color
             strokeStyle: edgeTemplate.dashed
             dashPattern: style ? style.dashPattern : [4, 2]
             fillColor: Qt.rgba(0,0,0,0)
-            PathLine {
-                x: edgeItem.c1.x
-                y: edgeItem.c1.y
-            }
-            PathLine {
-                x: edgeItem.p2.x
-                y: edgeItem.p2.y
-            }
+            // Ortho polyline is p1 -> c1 -> p2, or edge route when graph orthoRouting is enabled
+            PathSvg { path: edgeItem.orthoPath }
         }
     }
     Component {
         id: curvedShapePath
         ShapePath {
             id: edgeShapePath
-            startX: edgeItem.p1.x
-            startY: edgeItem.p1.y
+            startX: edgeGeometry.p1.x
+            startY: edgeGeometry.p1.y
             capStyle: ShapePath.FlatCap
             strokeWidth: edgeItem.style ? edgeItem.style.lineWidth : 2
             strokeColor: edgeTemplate.color
@@ -216,12 +212,12 @@ Item {
             dashPattern: edgeItem.style ? style.dashPattern : [4, 2]
             fillColor: Qt.rgba(0,0,0,0)
             PathCubic {
-                x: edgeItem.p2.x
-                y: edgeItem.p2.y
-                control1X: edgeItem.c1.x
-                control1Y: edgeItem.c1.y
-                control2X: edgeItem.c2.x
-                control2Y: edgeItem.c2.y
+                x: edgeGeometry.p2.x
+                y: edgeGeometry.p2.y
+                control1X: edgeGeometry.c1.x
+                control1Y: edgeGeometry.c1.y
+                control2X: edgeGeometry.c2.x
+                control2Y: edgeGeometry.c2.y
             }
         }
     }
@@ -247,11 +243,14 @@ Item {
                 edgeShape.data = straightLine
                 break;
 
-            case Qan.EdgeStyle.Ortho:
+            case Qan.EdgeStyle.Ortho:   // Custom C++ shapes polyline is published in edgeItem.orthoPath
+            case Qan.EdgeStyle.Custom:
                 if ( straightLine )
                     straightLine.destroy()
                 if ( curvedLine )
                     curvedLine.destroy()
+                if ( orthoLine )        // Switching between ortho and custom
+                    orthoLine.destroy()
                 orthoLine = orthoShapePath.createObject(edgeShape)
                 edgeShape.data = orthoLine
                 break;
@@ -267,19 +266,27 @@ Item {
             }
         }
     }
+    Text {      // Parallel edges count for a collapsed set (see Qan.Graph.parallelEdgeCollapseZoom)
+        x: edgeGeometry.labelPos.x
+        y: edgeGeometry.labelPos.y
+        visible: edgeItem.fanCollapsed && edgeItem.visible && !edgeItem.hidden
+        text: "\u00d7" + edgeItem.fanCount
+        color: edgeTemplate.color
+        font.bold: true
+    }
     // Debug control points display code.
     /*
     Rectangle {
         width: 8; height: 8
-        x: edgeItem.c1.x - 4
-        y: edgeItem.c1.y - 4
+        x: edgeGeometry.c1.x - 4
+        y: edgeGeometry.c1.y - 4
         radius: 4
         color: "red"
     }
     Rectangle {
         width: 8; height: 8
-        x: edgeItem.c2.x - 4
-        y: edgeItem.c2.y - 4
+        x: edgeGeometry.c2.x - 4
+        y: edgeGeometry.c2.y - 4
         radius: 4
         color: "green"
     }
@@ -293,7 +300,7 @@ Item {
         width: 4; height: 4; radius: 4; color: "red"
     }
     Rectangle {
-        x: edgeItem.p2.x - 2; y: edgeItem.p2.y - 2
+        x: edgeGeometry.p2.x - 2; y: edgeGeometry.p2.y - 2
         width: 4; height: 4; radius: 2; color: "blue"
     }
     */
@@ -50,7 +50,7 @@ Control {
     padding: 0
 
     property real   previewSize: 0.15
-    property    real graphRatio: graphView.containerItem.childrenRect.width / graphView.containerItem.childrenRect.height
+    property    real graphRatio: graphView.contentRect.width / graphView.contentRect.height
     property    real previewRatio: graphView.width / graphView.height
     onGraphRatioChanged: updateNavigablePreviewSize()
     onPreviewRatioChanged: updateNavigablePreviewSize()
@@ -64,8 +64,8 @@ Control {
 
         const pw = graphPreview.width
         const ph = graphPreview.height
-        const gw = graphView.containerItem.childrenRect.width
-        const gh = graphView.containerItem.childrenRect.height
+        const gw = graphView.contentRect.width
+        const gh = graphView.contentRect.height
 
         //console.error('')
         //console.error('graphRatio=' + graphRatio + '    previewRatio=' + previewRatio)
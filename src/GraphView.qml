@@ -79,7 +79,13 @@ Qan.AbstractGraphView {
         handlerWidth: resizeHandlerWidth
         handlerSize: resizeHandlerSize
 
+        onResizeStart: {
+            if (target)
+                target.beginResize()
+        }
         onResizeEnd: {
+            if (target)
+                target.endResize()
             if (target &&
                 target.node)
                 graph.nodeResized(target.node);
@@ -96,7 +102,15 @@ Qan.AbstractGraphView {
         handlerWidth: resizeHandlerWidth
         handlerSize: resizeHandlerSize
 
+        onResizeStart: {
+            if (target &&
+                target.groupItem)
+                target.groupItem.beginResize()
+        }
         onResizeEnd: {
+            if (target &&
+                target.groupItem)
+                target.groupItem.endResize()
             if (target &&
                 target.groupItem &&
                 target.groupItem.group)
@@ -114,6 +128,18 @@ Qan.AbstractGraphView {
     }
     selectionRectItem: selectionRect
 
+    // Mirror view: render shared graph container region shown in this view (no items are instantiated)
+    ShaderEffectSource {
+        id: mirrorSource
+        anchors.fill: parent
+        visible: graphView.mirror
+        live: visible
+        hideSource: false
+        sourceItem: graphView.mirror && graph ? graph.containerItem : null
+        sourceRect: graphView.viewportRect
+        textureSize: Qt.size(Math.ceil(width), Math.ceil(height))
+    }
+
     // View Click management //////////////////////////////////////////////////
     onClicked: {
         // Hide resizers when view background is clicked
@@ -43,7 +43,13 @@ Qan.AbstractNavigablePreview {
     property color  visibleWindowColor: Qt.rgba(1, 0, 0, 1)
 
     //! Show or hide the target navigable content as a background image (default to true).
-    property alias  backgroundPreviewVisible: sourcePreview.visible
+    property bool   backgroundPreviewVisible: true
+
+    /*! \brief Number of thumbnail tiles per row and column when \c updatePolicy is not \c Live (default to 4).
+     *
+     * With \c OnChange policy, only tiles intersecting invalidated regions are rendered again.
+     */
+    property int    thumbnailTiles: 4
 
     // PRIVATE ////////////////////////////////////////////////////////////////
     function updatePreviewSourceRect(rect) {
@@ -52,12 +58,26 @@ Qan.AbstractNavigablePreview {
         if (preview.source &&     // Manually update shader effect source source rect
             preview.source.containerItem &&
             sourcePreview.sourceItem === preview.source.containerItem ) {
-            var cr = preview.source.containerItem.childrenRect
+            var cr = preview.source.contentRect
             if (cr.width > 0 && cr.height > 0)
                 sourcePreview.sourceRect = cr
         }
     }
 
+    onThumbnailUpdateRequested: {
+        const fullUpdate = dirtyRect.width <= 0. || dirtyRect.height <= 0.
+        for (var t = 0; t < thumbnailTilesRepeater.count; t++) {
+            var tile = thumbnailTilesRepeater.itemAt(t)
+            if (!tile)
+                continue
+            const r = tile.sourceRect
+            if (fullUpdate ||
+                (r.x < dirtyRect.x + dirtyRect.width && dirtyRect.x < r.x + r.width &&
+                 r.y < dirtyRect.y + dirtyRect.height && dirtyRect.y < r.y + r.height))
+                tile.scheduleUpdate()
+        }
+    }
+
     onSourceChanged: {
         if (source &&
             source.containerItem) {
@@ -69,10 +89,10 @@ Qan.AbstractNavigablePreview {
             source.containerItem.onScaleChanged.connect(updateVisibleWindow)
             source.containerItem.onXChanged.connect(updateVisibleWindow)
             source.containerItem.onYChanged.connect(updateVisibleWindow)
-            source.containerItem.onChildrenRectChanged.connect(updatePreviewSourceRect)
+            source.onContentRectChanged.connect(updatePreviewSourceRect)
 
             sourcePreview.sourceItem = source.containerItem
-            var cr = preview.source.containerItem.childrenRect
+            var cr = preview.source.contentRect
             if (cr.width > 0 && cr.height > 0)
                 sourcePreview.sourceRect = cr
         } else
@@ -84,11 +104,35 @@ Qan.AbstractNavigablePreview {
         id: sourcePreview
         anchors.fill: parent
         anchors.margins: 0
-        live: true; recursive: false
+        visible: backgroundPreviewVisible && updatePolicy === Qan.AbstractNavigablePreview.Live
+        live: visible; recursive: false
         sourceItem: source.containerItem
         textureSize: Qt.size(width, height)
     }
 
+    // Throttled thumbnail: non live low resolution tiles, rendered on thumbnailUpdateRequested()
+    Repeater {
+        id: thumbnailTilesRepeater
+        model: updatePolicy !== Qan.AbstractNavigablePreview.Live ? thumbnailTiles * thumbnailTiles : 0
+        delegate: ShaderEffectSource {
+            readonly property int   column: index % thumbnailTiles
+            readonly property int   row: Math.floor(index / thumbnailTiles)
+            readonly property rect  contentRect: source ? source.contentRect : Qt.rect(0, 0, 0, 0)
+            x: column * preview.width / thumbnailTiles
+            y: row * preview.height / thumbnailTiles
+            width: preview.width / thumbnailTiles
+            height: preview.height / thumbnailTiles
+            visible: backgroundPreviewVisible
+            live: false; recursive: false
+            sourceItem: source ? source.containerItem : null
+            sourceRect: Qt.rect(contentRect.x + column * contentRect.width / thumbnailTiles,
+                                contentRect.y + row * contentRect.height / thumbnailTiles,
+                                contentRect.width / thumbnailTiles, contentRect.height / thumbnailTiles)
+            textureSize: Qt.size(Math.max(1, Math.ceil(width)), Math.max(1, Math.ceil(height)))
+            Component.onCompleted: scheduleUpdate()
+        }
+    }
+
     // Reset visibleWindow rect to preview dimension (taking rectangle border into account)
     function    resetVisibleWindow() {
         const border = visibleWindow.border.width
@@ -111,7 +155,7 @@ Qan.AbstractNavigablePreview {
             preview.resetVisibleWindow()
             return
         }
-        var containerItemCr = containerItem.childrenRect
+        var containerItemCr = source.contentRect
         if (containerItemCr.width < preview.source.width && // If scene size is stricly inferior to preview size
             containerItemCr.height < preview.source.height) {         // reset the preview window
             //preview.resetVisibleWindow()
@@ -0,0 +1,108 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	PerformanceOverlay.qml
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+import QtQuick              2.7
+import QtQuick.Controls     2.3
+import QtQuick.Layouts      1.3
+
+import QuickQanava 2.0 as Qan
+
+/*! \brief Semi transparent panel displaying live rendering and graph metrics for a Qan.GraphView.
+ *
+ * Displayed metrics are sampled by an internal Qan.PerformanceMonitor: frame time, edge updateItem()
+ * calls per frame, items created and reused from graph item pool, visible versus total nodes and
+ * edges and selection size. Sampling is disabled while the overlay is invisible.
+ *
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   anchors.fill: parent
+ *   graph: Qan.Graph { }
+ *   Qan.PerformanceOverlay {
+ *     anchors.top: parent.top; anchors.right: parent.right
+ *     graphView: graphView
+ *   }
+ * }
+ * \endcode
+ */
+Pane {
+    id: overlay
+
+    // PUBLIC /////////////////////////////////////////////////////////////////
+
+    //! Monitored graph view.
+    property var    graphView: undefined
+
+    //! Metrics sampling interval in ms (default to 500ms).
+    property alias  sampleInterval: monitor.sampleInterval
+
+    //! Internal Qan.PerformanceMonitor, could be used to access metrics from user code.
+    readonly property alias monitor: monitor
+
+    //! Frame time (in ms) over which frame time is displayed as a warning (default to 16.7ms, ie 60 fps).
+    property real   frameTimeWarning: 16.7
+
+    // PRIVATE ////////////////////////////////////////////////////////////////
+    opacity: 0.8
+    padding: 6
+    z: 10
+
+    Qan.PerformanceMonitor {
+        id: monitor
+        graphView: overlay.graphView
+        enabled: overlay.visible
+    }
+
+    GridLayout {
+        columns: 2
+        rowSpacing: 1; columnSpacing: 8
+        Label { text: "Frame:" }
+        Label {
+            text: monitor.frameTime.toFixed(1) + " ms (max " + monitor.maxFrameTime.toFixed(1) + " ms)"
+            color: monitor.maxFrameTime > overlay.frameTimeWarning ? "red" : overlay.palette.text
+        }
+        Label { text: "FPS:" }
+        Label { text: monitor.fps.toFixed(1) }
+        Label { text: "Edge updates:" }
+        Label { text: monitor.edgeUpdatesPerFrame.toFixed(1) + " / frame" }
+        Label { text: "Items:" }
+        Label { text: monitor.itemsCreated + " created, " + monitor.itemsReused + " reused, " + monitor.pooledItems + " pooled" }
+        Label { text: "Nodes:" }
+        Label { text: monitor.visibleNodes + " / " + monitor.nodeCount + " visible" }
+        Label { text: "Edges:" }
+        Label { text: monitor.visibleEdges + " / " + monitor.edgeCount + " visible" }
+        Label { text: "Selection:" }
+        Label { text: monitor.selectionSize }
+    }
+}
@@ -43,11 +43,38 @@
 
 // Qt header
 #include <QQmlEngine>
+#include <QTimer>
 
 // QuickQanava headers
 #include "./qanGraphConfig.h"
 #include "./qanEdge.h"
 #include "./qanEdgeItem.h"
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanNodeBatchRenderer.h"
+#include "./qanLabelBatchRenderer.h"
+#include "./qanFastNodeItem.h"
+#include "./qanGraphExporter.h"
+#include "./qanTileView.h"
+#include "./qanLayoutCache.h"
+#include "./qanImageCache.h"
+#include "./qanEdgeBundler.h"
+#include "./qanEdgeAggregator.h"
+#include "./qanOrthoRouter.h"
+#include "./qanAbstractLayout.h"
+#include "./qanForceDirectedLayout.h"
+#include "./qanLayeredLayout.h"
+#include "./qanTreeLayout.h"
+#include "./qanGroupLayout.h"
+#include "./qanFlowEngine.h"
+#include "./qanFlowExecutor.h"
+#include "./qanPerformanceMonitor.h"
+#include "./qanGraphImporter.h"
+#include "./qanGraphBuilder.h"
+#include "./qanAdjacencyModel.h"
+#include "./qanGraphUpdateQueue.h"
+#include "./qanModelGraphAdapter.h"
+#include "./qanUndoStack.h"
+#include "./qanBoundingShape.h"
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
 #include "./qanPortItem.h"
@@ -55,17 +82,27 @@
 #include "./qanGroup.h"
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
+#include "./qanComponentCache.h"
 #include "./qanNavigable.h"
 #include "./qanGrid.h"
 #include "./qanLineGrid.h"
+#include "./qanShaderGrid.h"
+#include "./qanEffectItem.h"
 #include "./qanGraphView.h"
 #include "./qanStyle.h"
 #include "./qanStyleManager.h"
 #include "./qanBottomRightResizer.h"
 #include "./qanNavigablePreview.h"
 
+/*! \brief Static QuickQanava initialization (when QUICKQANAVA_STATIC is defined, see quickqanava.pri).
+ *
+ * Types that are not necessary to display and edit a graph (batch renderers, layouts, exporters, importers, dataflow,
+ * monitoring, etc.) are registered by registerExtendedTypes(). Call initialize() with \c extendedTypes set to false
+ * to reduce cold start time when they are not used, and eventually call registerExtendedTypes() later, before loading
+ * QML using them (Qan.PerformanceOverlay use Qan.PerformanceMonitor). See benchmarks/qan_startup.cpp.
+ */
 struct QuickQanava {
-    static void initialize(QQmlEngine* engine) {
+    static void initialize(QQmlEngine* engine, bool extendedTypes = true) {
 #ifdef QUICKQANAVA_STATIC   // Initialization is done in QuickQanavaPlugin when QUICKQANAVA_STATIC is not defined
         Q_INIT_RESOURCE(QuickQanava_static);
 #if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
@@ -78,11 +115,19 @@ struct QuickQanava {
             engine->rootContext()->setContextProperty("defaultNodeStyle", QVariant::fromValue(qan::Node::style()));
             engine->rootContext()->setContextProperty("defaultEdgeStyle", QVariant::fromValue(qan::Edge::style()));
             engine->rootContext()->setContextProperty("defaultGroupStyle", QVariant::fromValue(qan::Group::style()));
+            // Default templates are compiled asynchronously, first node, edge and group insertion do not wait for QML loading
+            QTimer::singleShot(0, engine, [engine]() { qan::ComponentCache::instance(*engine).preload(); });
+            if (engine->imageProvider(QStringLiteral("qan")) == nullptr)    // Shared asynchronous image cache (image://qan/ urls)
+                engine->addImageProvider(QStringLiteral("qan"), new qan::ImageProvider{});
         }
         qmlRegisterType<qan::NodeItem>("QuickQanava", 2, 0, "NodeItem");
         qmlRegisterType<qan::PortItem>("QuickQanava", 2, 0, "PortItem");
         qmlRegisterType<qan::Edge>("QuickQanava", 2, 0, "AbstractEdge");
         qmlRegisterType<qan::EdgeItem>("QuickQanava", 2, 0, "EdgeItem");
+        qRegisterMetaType<qan::EdgeGeometry>();
+        qmlRegisterUncreatableType<qan::OrthoRouter>("QuickQanava", 2, 0, "OrthoRouter", "OrthoRouter is created by qan::Graph, use Graph.orthoRouting.");
+        qmlRegisterUncreatableType<qan::UndoStack>("QuickQanava", 2, 0, "UndoStack", "UndoStack is created by qan::Graph, use Graph.undoStack.");
+        qmlRegisterType<qan::BoundingShape>("QuickQanava", 2, 0, "BoundingShape");
         qmlRegisterType<qan::Group>("QuickQanava", 2, 0, "AbstractGroup");
         qmlRegisterType<qan::GroupItem>("QuickQanava", 2, 0, "GroupItem");
         qmlRegisterType<qan::Connector>("QuickQanava", 2, 0, "Connector");
@@ -96,14 +141,51 @@ struct QuickQanava {
         qmlRegisterType<qan::OrthoGrid>("QuickQanava", 2, 0, "OrthoGrid");
         qmlRegisterType<qan::LineGrid>("QuickQanava", 2, 0, "AbstractLineGrid");
         qmlRegisterType<qan::impl::GridLine>("QuickQanava", 2, 0, "GridLine");
+        qmlRegisterType<qan::ShaderGrid>("QuickQanava", 2, 0, "ShaderGrid");
+        qmlRegisterType<qan::EffectItem>("QuickQanava", 2, 0, "EffectItem");
 
         qmlRegisterType<qan::Style>("QuickQanava", 2, 0, "Style");
         qmlRegisterType<qan::NodeStyle>("QuickQanava", 2, 0, "NodeStyle");
         qmlRegisterType<qan::EdgeStyle>("QuickQanava", 2, 0, "EdgeStyle");
         qmlRegisterType<qan::StyleManager>("QuickQanava", 2, 0, "StyleManager");
         qmlRegisterType<qan::BottomRightResizer>("QuickQanava", 2, 0, "BottomRightResizer" );
+        if (extendedTypes)
+            registerExtendedTypes();
+#else
+        Q_UNUSED(engine)
+        Q_UNUSED(extendedTypes)
 #endif // QUICKQANAVA_STATIC
     } // initialize()
+
+    //! Register QuickQanava extended types (nothing is done if they are already registered, or without QUICKQANAVA_STATIC).
+    static void registerExtendedTypes() {
+#ifdef QUICKQANAVA_STATIC
+        static bool registered = false;
+        if (registered)
+            return;
+        registered = true;
+        qmlRegisterType<qan::EdgeBatchRenderer>("QuickQanava", 2, 0, "EdgeBatchRenderer");
+        qmlRegisterType<qan::NodeBatchRenderer>("QuickQanava", 2, 0, "NodeBatchRenderer");
+        qmlRegisterType<qan::LabelBatchRenderer>("QuickQanava", 2, 0, "LabelBatchRenderer");
+        qmlRegisterType<qan::FastNodeItem>("QuickQanava", 2, 0, "FastNodeItem");
+        qmlRegisterType<qan::GraphExporter>("QuickQanava", 2, 0, "GraphExporter");
+        qmlRegisterType<qan::TileView>("QuickQanava", 2, 0, "TileView");
+        qmlRegisterType<qan::LayoutCache>("QuickQanava", 2, 0, "LayoutCache");
+        qmlRegisterType<qan::EdgeBundler>("QuickQanava", 2, 0, "EdgeBundler");
+        qmlRegisterType<qan::EdgeAggregator>("QuickQanava", 2, 0, "EdgeAggregator");
+        qmlRegisterUncreatableType<qan::AbstractLayout>("QuickQanava", 2, 0, "AbstractLayout", "AbstractLayout is abstract, use ForceDirectedLayout, LayeredLayout or TreeLayout.");
+        qmlRegisterType<qan::ForceDirectedLayout>("QuickQanava", 2, 0, "ForceDirectedLayout");
+        qmlRegisterType<qan::LayeredLayout>("QuickQanava", 2, 0, "LayeredLayout");
+        qmlRegisterType<qan::TreeLayout>("QuickQanava", 2, 0, "TreeLayout");
+        qmlRegisterType<qan::GroupLayout>("QuickQanava", 2, 0, "GroupLayout");
+        qmlRegisterType<qan::FlowEngine>("QuickQanava", 2, 0, "FlowEngine");
+        qmlRegisterType<qan::FlowExecutor>("QuickQanava", 2, 0, "FlowExecutor");
+        qmlRegisterType<qan::PerformanceMonitor>("QuickQanava", 2, 0, "PerformanceMonitor");
+        qmlRegisterType<qan::GraphImporter>("QuickQanava", 2, 0, "GraphImporter");
+        qmlRegisterType<qan::GraphUpdateQueue>("QuickQanava", 2, 0, "GraphUpdateQueue");
+        qmlRegisterType<qan::ModelGraphAdapter>("QuickQanava", 2, 0, "ModelGraphAdapter");
+#endif // QUICKQANAVA_STATIC
+    } // registerExtendedTypes()
 };
 
 namespace qan { // ::qan
@@ -33,68 +33,25 @@
 //-----------------------------------------------------------------------------
 
 import QtQuick              2.7
-import QtGraphicalEffects   1.0
 
 import QuickQanava          2.0 as Qan
 
 /*! \brief Node or group background component with solid fill, glow effect and backOpacity style support
  *
+ * Glow is drawn from a nine-patch texture shared by all nodes with the same style, see qan::EffectItem.
  */
-Item {
+Qan.EffectItem {
     id: glowEffect
 
     // Public:
     property var    nodeItem: undefined
 
-    // private:
-    // Default settings for rect radius, shadow margin is the _maximum_ shadow radius (+vertical or horizontal offset).
-    property real   glowRadius:     nodeItem.style.effectRadius
-    property color  glowColor:      nodeItem.style.effectColor
-    property real   effectMargin:   glowRadius * 2
-    property real   borderWidth:    nodeItem.style.borderWidth
-    property real   borderWidth2:   borderWidth / 2.
-
-    Item {
-        id: effectBackground
-        z: -1   // Effect should be behind edges , docks and connectors...
-        x: -effectMargin; y: -effectMargin
-        width: nodeItem.width + effectMargin * 2; height: nodeItem.height + effectMargin * 2
-        visible: false
-        Rectangle {
-            x: effectMargin
-            y: effectMargin
-            width: nodeItem.width       // Avoid aliasing artifacts for mask at high scales.
-            height: nodeItem.height
-            radius: nodeItem.style.backRadius
-            border.width: borderWidth
-            color: Qt.rgba(0, 0, 0, 1)
-            antialiasing: true
-            layer.enabled: true
-            layer.effect: Glow {
-                color: glowEffect.glowColor
-                radius: glowEffect.glowRadius;     samples: Math.min( 16, glowEffect.glowRadius)
-                spread: 0.25;   transparentBorder: true;    cached: false
-                visible: nodeItem.style.effectEnabled
-            }
-        }
-    }
-    Item {
-        id: backgroundMask
-        anchors.fill: effectBackground
-        visible: false
-        Rectangle {
-            x: effectMargin + borderWidth2
-            y: effectMargin + borderWidth2
-            width: nodeItem.width - borderWidth;  height: nodeItem.height - borderWidth
-            radius: nodeItem.style.backRadius
-            color: Qt.rgba(0,0,0,1)
-            antialiasing: true
-        }
-    }
-    OpacityMask {
-        anchors.fill: effectBackground
-        source: effectBackground
-        maskSource: backgroundMask
-        invert: true
-    }
+    z: -1   // Effect should be behind edges , docks and connectors...
+    // Effects are skipped below Full level of detail (see Graph.simplifiedZoom)
+    visible: nodeItem.style.effectEnabled &&
+             nodeItem.levelOfDetail === Qan.NodeItem.Full
+    effectType: Qan.NodeStyle.EffectGlow
+    effectRadius: nodeItem.style.effectRadius
+    effectColor: nodeItem.style.effectColor
+    backRadius: nodeItem.style.backRadius
 }
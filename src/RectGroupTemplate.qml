@@ -113,7 +113,7 @@ Item {
                 id: groupLabel
                 anchors.fill: parent
                 text: groupItem && groupItem.group ? groupItem.group.label : "              "
-                visible: !labelEditor.visible
+                visible: !labelEditor.visible && !groupItem.culled  // Label text is not rendered out of view (see Graph.viewportCulling)
                 verticalAlignment: Text.AlignVCenter
                 font.bold: groupItem.style.fontBold
                 elide:  Text.ElideRight
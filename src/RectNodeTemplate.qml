@@ -59,10 +59,17 @@ Item {
     Loader {
         id: delegateLoader
         anchors.fill: parent
+        // At Flat level, nodes are eventually drawn by a Qan.NodeBatchRenderer: no background is necessary
+        active: !nodeItem ||
+                !nodeItem.graph ||
+                !nodeItem.graph.flatBatched ||
+                nodeItem.levelOfDetail !== Qan.NodeItem.Flat
         source: {
             if (!nodeItem ||
                 !nodeItem.style)     // Defaul to solid no effect with unconfigured nodes
                 return "qrc:/QuickQanava/RectSolidBackground.qml";
+            if (nodeItem.levelOfDetail !== Qan.NodeItem.Full)   // No effect nor gradient below Full level of detail
+                return "qrc:/QuickQanava/RectSolidBackground.qml";
             switch (nodeItem.style.fillType) {  // Otherwise, select the delegate according to current style configuration
             case Qan.NodeStyle.FillSolid:
                 switch (nodeItem.style.effectType ) {
@@ -89,7 +96,9 @@ Item {
         id: layout
         anchors.fill: parent
         anchors.margins: nodeItem.style.backRadius / 2.; spacing: 0
-        visible: !labelEditor.visible
+        // Label and content are not readable below Full level of detail
+        visible: !labelEditor.visible &&
+                 (!nodeItem || nodeItem.levelOfDetail === Qan.NodeItem.Full)
         Label {
             id: nodeLabel
             Layout.fillWidth: true
@@ -98,6 +107,8 @@ Item {
             Layout.alignment: Qt.AlignHCenter | Qt.AlignTop
             textFormat: Text.PlainText
             text: nodeItem && nodeItem.node ? nodeItem.node.label : ""
+            // Label text is not rendered out of view (see Graph.viewportCulling) or when drawn by a Qan.LabelBatchRenderer
+            visible: !nodeItem || (!nodeItem.culled && !nodeItem.graph.labelsBatched)
             horizontalAlignment: Qt.AlignHCenter; verticalAlignment: Qt.AlignVCenter
             maximumLineCount: 3 // Must be set, otherwise elide don't work and we end up with single line text
             elide: Text.ElideRight; wrapMode: Text.Wrap
@@ -33,67 +33,23 @@
 //-----------------------------------------------------------------------------
 
 import QtQuick              2.7
-import QtGraphicalEffects   1.0
 
 import QuickQanava          2.0 as Qan
 
 /*! \brief Node or group background component with solid fill, shadow effect and backOpacity style support
  *
+ * Shadow is drawn from a nine-patch texture shared by all nodes with the same style, see qan::EffectItem.
  */
-Item {
+Qan.EffectItem {
     // Public:
     property var    nodeItem: undefined
 
-    // private:
-    // Default settings for rect radius, shadow margin is the _maximum_ shadow radius (+vertical or horizontal offset).
-    property real   borderWidth  : nodeItem.style.borderWidth
-    property real   borderWidth2 : borderWidth / 2.
-    property real   shadowOffset : nodeItem.style.effectOffset
-    property real   shadowRadius : nodeItem.style.effectRadius
-    property color  shadowColor  : nodeItem.style.effectColor
-
-    Item {
-        id: effectBackground
-        x: 0; y: 0
-        //z: -1   // Effect should be behind edges , docks and connectors...
-        width: nodeItem.width + shadowOffset + shadowRadius
-        height: nodeItem.height + shadowOffset + shadowRadius
-        visible: false
-        Rectangle {
-            x: borderWidth2; y: borderWidth2
-            width: nodeItem.width - borderWidth         // avoid aliasing artifacts at high scales.
-            height: nodeItem.height - borderWidth
-            radius: nodeItem.style.backRadius
-            color: Qt.rgba(0, 0, 0, 1)
-            antialiasing: true
-            layer.enabled: true
-            layer.effect: DropShadow {
-                horizontalOffset: shadowOffset; verticalOffset: shadowOffset
-                radius: shadowRadius; samples: 8
-                color: shadowColor
-                visible: nodeItem.style.effectEnabled
-                transparentBorder: true
-                cached: false
-            }
-        }
-    }
-
-    Item {
-        id: backgroundMask
-        anchors.fill: effectBackground
-        visible: false
-        Rectangle {
-            x: 0; y: 0
-            width: nodeItem.width - borderWidth2
-            height: nodeItem.height - borderWidth2
-            radius: nodeItem.style.backRadius
-            color: Qt.rgba(1, 0, 0, 1)
-        }
-    }
-    OpacityMask {
-        anchors.fill: effectBackground
-        source: effectBackground
-        maskSource: backgroundMask
-        invert: true
-    }
+    // Effects are skipped below Full level of detail (see Graph.simplifiedZoom)
+    visible: nodeItem.style.effectEnabled &&
+             nodeItem.levelOfDetail === Qan.NodeItem.Full
+    effectType: Qan.NodeStyle.EffectShadow
+    effectRadius: nodeItem.style.effectRadius
+    effectOffset: nodeItem.style.effectOffset
+    effectColor: nodeItem.style.effectColor
+    backRadius: nodeItem.style.backRadius
 }
@@ -50,7 +50,7 @@ Item {
     property color  backColor: nodeItem.style.backColor
 
     RectGlowEffect {
-        //anchors.fill: parent
+        anchors.fill: parent
         nodeItem: background.nodeItem
     }
     RectSolidBackground {
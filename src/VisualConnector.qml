@@ -133,38 +133,15 @@ Qan.Connector {
             edgeItem.visible = false
     }
 
-    Drag.active: dropDestArea.drag.active
-    Drag.dragType: Drag.Internal
-    Drag.onTargetChanged: { // Hilight a target node
-        if (Drag.target) {
-            visualConnector.z = Drag.target.z + 1
+    // Note: drop target is resolved on C++ side from graph spatial index at frame rate (see hoveredTarget)
+    onHoveredTargetChanged: { // Hilight a target node
+        if (hoveredTarget) {
+            visualConnector.z = hoveredTarget.z + 1
             if (connectorItem)
-                connectorItem.z = Drag.target.z + 1
-        }
-        if (!Drag.target &&
-            connectorItem) {
-            connectorItem.state = "NORMAL"
-            return;
-        }
-        // Drag.target is valid, trying to find a valid target
-        let source = visualConnector.sourceNode ? visualConnector.sourceNode : visualConnector.sourcePort
-        if (source) {   // Note: source might be a qan::Node OR a qan::PortItem
-            if (source.item &&
-                Drag.target === source.item) { // Prevent creation of a circuit on source node
-                connectorItem.state = "NORMAL"
-            } else if (source.group &&
-                       source.group.item &&                 // Prevent creation of an edge from
-                       Drag.target === source.group.item) { // source node to it's own group
-                connectorItem.state = "NORMAL"
-            } else {
-                // Potentially, we have a valid node or group target
-                let target = Drag.target.group ? Drag.target.group : Drag.target.node
-                let connectable = Drag.target.connectable === Qan.NodeItem.Connectable ||
-                                  Drag.target.connectable === Qan.NodeItem.InConnectable
-                if (target && connectable)
-                    connectorItem.state = "HILIGHT"
-            }
+                connectorItem.z = hoveredTarget.z + 1
         }
+        if (connectorItem)
+            connectorItem.state = hoveredTargetConnectable ? "HILIGHT" : "NORMAL"
     }
     connectorItem: Rectangle {
         id: defaultConnectorItem
@@ -204,8 +181,7 @@ Qan.Connector {
         hoverEnabled: true
         enabled: true
         onReleased: {
-            if (connectorItem.state === "HILIGHT")
-                connectorReleased(visualConnector.Drag.target)
+            connectorReleased(hoveredTargetConnectable ? hoveredTarget : null)
             configureConnectorPosition()
             if (edgeItem)       // Hide the edgeItem after a mouse release or it could
                 edgeItem.visible = false    // be visible on non rectangular nodes.
@@ -0,0 +1,482 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanAbstractLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
+// Qt headers
+#include <QThreadPool>
+#include <QRunnable>
+
+// QuickQanava headers
+#include "./qanAbstractLayout.h"
+#include "./qanGraph.h"
+#include "./qanNodeItem.h"
+#include "./qanGroupItem.h"
+#include "./qanLayoutCache.h"
+
+namespace qan { // ::qan
+
+//! Shared between a layout and its running workers, worker results are only posted while layout is alive.
+struct AbstractLayout::Guard {
+    std::mutex              mutex;
+    qan::AbstractLayout*    layout = nullptr;
+};
+
+//! Graph side input of a layout computation.
+struct AbstractLayout::Job {
+    qan::Graph::Snapshot        snapshot;
+    //! Snapshot nodes top left position when job was created (indexed by snapshot dense node index).
+    std::vector<QPointF>        origins;
+    //! Snapshot node index of every laid out node.
+    std::vector<std::uint32_t>  nodes;
+    qan::LayoutJob              layoutJob;
+    //! Graph fingerprint and laid out nodes structural keys when job was created (only for a layout with a cache).
+    std::uint64_t               fingerprint = 0;
+    std::vector<std::uint64_t>  cacheKeys;
+
+    //! Build laid out nodes adjacency from snapshot topology (edges with an end not being laid out are ignored), O(n + m).
+    void    buildAdjacency()
+    {
+        const auto& csr = snapshot->get_csr();
+        std::vector<std::int32_t> layoutIndexes(static_cast<std::size_t>(csr.get_node_count()), -1);
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            layoutIndexes[nodes[i]] = static_cast<std::int32_t>(i);
+        auto& offsets = layoutJob.offsets;
+        auto& targets = layoutJob.targets;
+        offsets.assign(nodes.size() + 1, 0);
+        targets.clear();
+        targets.reserve(csr.get_edge_count());
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            const auto n = nodes[i];
+            for (auto out = csr.out_begin(n); out != csr.out_end(n); ++out)
+                if (layoutIndexes[*out] >= 0)
+                    targets.push_back(static_cast<std::uint32_t>(layoutIndexes[*out]));
+            offsets[i + 1] = targets.size();
+        }
+    }
+
+    /*! \brief Build laid out nodes structural keys from node and neighbours hash, O(n + m).
+     *
+     * Key is stable across sessions (unlike node pointer keys): hash of node label mixed with its in and out
+     * neighbours labels hashes, nodes with the same key are disambiguated by their order in snapshot.
+     */
+    void    buildCacheKeys()
+    {
+        using Fingerprint = gtpo::fingerprint_behaviour<qan::Config>;
+        const auto& csr = snapshot->get_csr();
+        const auto nodeCount = static_cast<std::size_t>(csr.get_node_count());
+        std::vector<std::uint64_t> hashes(nodeCount, 0);
+        for (std::size_t n = 0; n < nodeCount; ++n) {
+            const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(n)).lock();
+            if (node)
+                hashes[n] = Fingerprint::mix(qan::Graph::getStructuralHash(*node));
+        }
+        std::vector<std::uint64_t> neighbours(nodeCount, 0);
+        for (std::size_t n = 0; n < nodeCount; ++n) {
+            const auto source = static_cast<qan::Graph::Snapshot::element_type::index_t>(n);
+            for (auto out = csr.out_begin(source); out != csr.out_end(source); ++out) {
+                neighbours[n] += Fingerprint::mix(hashes[*out] + 1);     // Out and in neighbours are not commutative
+                neighbours[*out] += Fingerprint::mix(hashes[n] + 2);
+            }
+        }
+        std::unordered_map<std::uint64_t, std::uint64_t> occurrences;
+        cacheKeys.clear();
+        cacheKeys.reserve(nodes.size());
+        for (const auto n : nodes) {
+            const auto key = Fingerprint::mix(hashes[n] + Fingerprint::mix(neighbours[n]));
+            const auto occurrence = occurrences[key]++;
+            cacheKeys.push_back(Fingerprint::mix(key + occurrence * 0x9e3779b97f4a7c15ull));
+        }
+    }
+
+    //! Return snapshot nodes top left positions (origin for nodes that are not laid out).
+    std::vector<QPointF>    positions() const
+    {
+        auto result = origins;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            result[nodes[i]] = QPointF{layoutJob.x[i] - layoutJob.width[i] / 2.,
+                                       layoutJob.y[i] - layoutJob.height[i] / 2.};
+        return result;
+    }
+};
+
+//! Shared between a layout and the worker running it.
+struct AbstractLayout::Run {
+    std::unique_ptr<Job>    job;
+    AbstractLayout::Task    task;
+    std::atomic<bool>       cancelled{false};
+    //! True while an intermediate positions batch is posted but not yet applied.
+    std::atomic<bool>       batchPending{false};
+};
+
+namespace { // ::qan::anonymous
+
+class LayoutRunnable : public QRunnable, public qan::LayoutProgress
+{
+public:
+    LayoutRunnable(std::shared_ptr<qan::AbstractLayout::Guard> guard,
+                   std::shared_ptr<qan::AbstractLayout::Run> run) :
+        QRunnable{}, _guard{std::move(guard)}, _run{std::move(run)},
+        _lastBatch{std::chrono::steady_clock::now()} { setAutoDelete(true); }
+
+    virtual void run() override {
+        auto& job = *_run->job;
+        job.buildAdjacency();
+        const auto iterations = _run->task(job.layoutJob, *this);
+        if (!isCancelled())
+            postPositions(job.positions(), iterations, true);
+    }
+
+    virtual bool    isCancelled() const noexcept override { return _run->cancelled.load(); }
+
+    // Note: an intermediate batch is posted at most once per frame, and only when previous one has been applied
+    virtual bool    isBatchDue() const noexcept override {
+        static constexpr std::chrono::milliseconds batchInterval{16};
+        return !_run->batchPending.load() &&
+               std::chrono::steady_clock::now() - _lastBatch >= batchInterval;
+    }
+
+    virtual void    post(int iteration) noexcept override {
+        if (_run->batchPending.exchange(true))
+            return;
+        _lastBatch = std::chrono::steady_clock::now();
+        postPositions(_run->job->positions(), iteration, false);
+    }
+
+private:
+    void    postPositions(std::vector<QPointF> positions, int iteration, bool finished) {
+        std::lock_guard<std::mutex> lock{_guard->mutex};
+        if (_guard->layout == nullptr)
+            return;
+        const auto layout = _guard->layout;
+        QMetaObject::invokeMethod(layout, [layout, run = _run, positions = std::move(positions),
+                                           iteration, finished]() mutable {
+            layout->positionsReady(run, std::move(positions), iteration, finished);
+        }, Qt::QueuedConnection);
+    }
+
+    std::shared_ptr<qan::AbstractLayout::Guard> _guard;
+    std::shared_ptr<qan::AbstractLayout::Run>   _run;
+    std::chrono::steady_clock::time_point       _lastBatch;
+};
+
+//! Progress of a synchronous layout (never cancelled, no intermediate batches).
+class SynchronousProgress : public qan::LayoutProgress
+{
+public:
+    virtual bool    isCancelled() const noexcept override { return false; }
+    virtual bool    isBatchDue() const noexcept override { return false; }
+    virtual void    post(int) noexcept override { }
+};
+
+} // ::qan::anonymous
+
+/* AbstractLayout Object Management *///---------------------------------------
+AbstractLayout::AbstractLayout(QObject* parent) :
+    QObject{parent},
+    _guard{std::make_shared<Guard>()}
+{
+    _guard->layout = this;
+}
+
+AbstractLayout::~AbstractLayout()
+{
+    if (_run)
+        _run->cancelled.store(true);
+    std::lock_guard<std::mutex> lock{_guard->mutex};
+    _guard->layout = nullptr;       // Running workers results are dropped
+}
+
+void    AbstractLayout::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph != _graph) {
+        stop();
+        _graph = graph;
+        emit graphChanged();
+    }
+}
+
+void    AbstractLayout::setCache(qan::LayoutCache* cache) noexcept
+{
+    if (cache != _cache) {
+        _cache = cache;
+        emit cacheChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Execution *///-------------------------------------------------------
+void    AbstractLayout::start() noexcept
+{
+    const bool wasRunning = getRunning();
+    if (_run)           // Restart: running worker results are dropped
+        _run->cancelled.store(true);
+    _run.reset();
+    auto job = createJob();
+    if (job && lookupCache(*job)) {     // Every node is cached: apply cached positions without running task
+        applyPositions(*job, job->positions());
+        setIteration(0);
+        if (wasRunning)
+            emit runningChanged();
+        emit finished();
+        return;
+    }
+    auto task = job ? createTask() : Task{};
+    if (!job || !task) {
+        if (wasRunning)
+            emit runningChanged();
+        return;
+    }
+    _run = std::make_shared<Run>();
+    _run->job = std::move(job);
+    _run->task = std::move(task);
+    setIteration(0);
+    QThreadPool::globalInstance()->start(new LayoutRunnable{_guard, _run});
+    if (!wasRunning)
+        emit runningChanged();
+}
+
+void    AbstractLayout::stop() noexcept
+{
+    if (!_run)
+        return;
+    _run->cancelled.store(true);
+    _run.reset();
+    emit runningChanged();
+}
+
+int     AbstractLayout::layout() noexcept
+{
+    stop();
+    auto job = createJob();
+    if (job && lookupCache(*job)) {
+        applyPositions(*job, job->positions());
+        setIteration(0);
+        emit finished();
+        return 0;
+    }
+    auto task = job ? createTask() : Task{};
+    if (!job || !task)
+        return 0;
+    job->buildAdjacency();
+    SynchronousProgress progress;
+    const auto iterations = task(job->layoutJob, progress);
+    applyPositions(*job, job->positions());
+    storeCache(*job);
+    setIteration(iterations);
+    emit finished();
+    return iterations;
+}
+
+void    AbstractLayout::positionsReady(const std::shared_ptr<Run>& run, std::vector<QPointF> positions,
+                                       int iteration, bool finished) noexcept
+{
+    if (!run ||
+        run != _run)        // Stopped or restarted layout
+        return;
+    applyPositions(*run->job, positions);
+    run->batchPending.store(false);
+    setIteration(iteration);
+    if (finished) {
+        storeCache(*run->job);
+        _run.reset();
+        emit runningChanged();
+        emit this->finished();
+    }
+}
+
+std::unique_ptr<AbstractLayout::Job>    AbstractLayout::createJob() const noexcept
+{
+    if (!_graph)
+        return nullptr;
+    auto job = std::make_unique<Job>();
+    job->snapshot = _graph->snapshot();
+    const auto& csr = job->snapshot->get_csr();
+    const auto nodeCount = static_cast<std::size_t>(csr.get_node_count());
+    job->origins.resize(nodeCount);
+    job->nodes.reserve(nodeCount);
+    auto& layoutJob = job->layoutJob;
+    for (auto v : { &layoutJob.x, &layoutJob.y, &layoutJob.width, &layoutJob.height, &layoutJob.mobility })
+        v->reserve(nodeCount);
+    layoutJob.keys.reserve(nodeCount);
+    const bool hierarchical = isHierarchical();
+    // Note: grouped nodes are laid out in a hierarchical job, unless one of their ancestor group is collapsed
+    const auto isLaidOut = [hierarchical](const qan::Node& node) {
+        if (!hierarchical)
+            return node.get_group().expired();      // Grouped nodes move with their group
+        for (auto group = node.get_group().lock(); group; group = group->get_group().lock()) {
+            const auto groupItem = group->getGroupItem();
+            if (groupItem != nullptr && groupItem->getCollapsed())
+                return false;
+        }
+        return true;
+    };
+    std::unordered_map<const qan::Node*, std::int32_t> layoutIndexes;
+    const auto columns = _graph->getNodeColumns();  // Read geometry from graph node columns when enabled (no item property access)
+    const auto nodeGeometry = [columns](const qan::Node& node) -> QRectF {
+        const auto row = columns != nullptr ? columns->rowOf(node) : 0;
+        if (columns == nullptr ||
+            row >= columns->rowCount() ||
+            node.getItem() == nullptr)
+            return node.getGeometry();
+        return QRectF{columns->x()[row], columns->y()[row], columns->width()[row], columns->height()[row]};
+    };
+    for (std::size_t n = 0; n < nodeCount; ++n) {
+        const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(n)).lock();
+        if (!node)
+            continue;
+        const auto geometry = nodeGeometry(*node);
+        job->origins[n] = geometry.topLeft();
+        if (!isLaidOut(*node))
+            continue;
+        if (hierarchical)
+            layoutIndexes.emplace(node.get(), static_cast<std::int32_t>(job->nodes.size()));
+        job->nodes.push_back(static_cast<std::uint32_t>(n));
+        layoutJob.x.push_back(geometry.center().x());
+        layoutJob.y.push_back(geometry.center().y());
+        layoutJob.width.push_back(geometry.width());
+        layoutJob.height.push_back(geometry.height());
+        const auto item = node->getItem();
+        layoutJob.mobility.push_back(item != nullptr && !item->getDraggable() ? 0. : 1.);
+        layoutJob.keys.push_back(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(node.get())));
+    }
+    if (job->nodes.empty())
+        return nullptr;
+    if (hierarchical) {
+        layoutJob.parents.assign(job->nodes.size(), -1);
+        layoutJob.containers.assign(job->nodes.size(), 0);
+        for (std::size_t i = 0; i < job->nodes.size(); ++i) {
+            const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(job->nodes[i])).lock();
+            const auto group = node ? node->get_group().lock() : nullptr;
+            if (!group)
+                continue;
+            const auto parent = layoutIndexes.find(group.get());
+            if (parent == layoutIndexes.cend())
+                continue;
+            layoutJob.parents[i] = parent->second;
+            layoutJob.containers[static_cast<std::size_t>(parent->second)] = 1;
+        }
+        for (std::size_t i = 0; i < job->nodes.size(); ++i) {
+            if (layoutJob.containers[i] == 0)
+                continue;
+            const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(job->nodes[i])).lock();
+            const auto groupItem = node ? qobject_cast<qan::Group*>(node.get())->getGroupItem() : nullptr;
+            layoutJob.width[i] = groupItem != nullptr ? groupItem->getMinimumGroupWidth() : 0.;
+            layoutJob.height[i] = groupItem != nullptr ? groupItem->getMinimumGroupHeight() : 0.;
+        }
+    }
+    if (_cache && !hierarchical) {
+        job->fingerprint = _graph->getFingerprint();
+        try {
+            job->buildCacheKeys();
+        } catch (const std::bad_alloc&) { job->cacheKeys.clear(); }
+    }
+    return job;
+}
+
+bool    AbstractLayout::lookupCache(Job& job) const noexcept
+{
+    if (!_cache ||
+        job.cacheKeys.size() != job.nodes.size())
+        return false;
+    auto& layoutJob = job.layoutJob;
+    bool complete = !job.cacheKeys.empty();
+    for (std::size_t i = 0; i < job.cacheKeys.size(); ++i) {
+        if (layoutJob.mobility[i] == 0.)    // Pinned nodes keep their actual position
+            continue;
+        QPointF center;
+        bool exact = false;
+        if (_cache->lookup(job.fingerprint, job.cacheKeys[i], center, exact)) {
+            layoutJob.x[i] = center.x();
+            layoutJob.y[i] = center.y();
+            layoutJob.mobility[i] = 0.;
+        }
+        complete = complete && exact;
+    }
+    return complete;
+}
+
+void    AbstractLayout::storeCache(const Job& job) const noexcept
+{
+    if (!_cache ||
+        job.cacheKeys.size() != job.nodes.size())
+        return;
+    try {
+        std::vector<qan::LayoutCache::Entry> entries;
+        entries.reserve(job.cacheKeys.size());
+        for (std::size_t i = 0; i < job.cacheKeys.size(); ++i)
+            entries.push_back(qan::LayoutCache::Entry{job.cacheKeys[i], job.fingerprint,
+                                                      job.layoutJob.x[i], job.layoutJob.y[i]});
+        _cache->store(std::move(entries));
+    } catch (const std::bad_alloc&) { /* Nil: cache is not updated */ }
+}
+
+void    AbstractLayout::applyPositions(const Job& job, const std::vector<QPointF>& positions) noexcept
+{
+    if (!_graph)
+        return;
+    _graph->beginUpdate();
+    const auto& layoutJob = job.layoutJob;
+    for (std::size_t i = 0; i < layoutJob.containers.size(); ++i) {    // Resize groups before moving their content
+        if (layoutJob.containers[i] == 0)
+            continue;
+        const auto node = job.snapshot->get_csr().get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(job.nodes[i])).lock();
+        const auto group = qobject_cast<qan::Group*>(node.get());
+        if (group == nullptr)
+            continue;
+        if (group->getGroupItem() != nullptr) {
+            group->getGroupItem()->setPreferredGroupWidth(layoutJob.width[i]);
+            group->getGroupItem()->setPreferredGroupHeight(layoutJob.height[i]);
+        } else
+            group->setGeometry(QRectF{group->getGeometry().topLeft(), QSizeF{layoutJob.width[i], layoutJob.height[i]}});
+    }
+    _graph->applyNodePositions(job.snapshot, positions);
+    _graph->endUpdate();
+}
+
+void    AbstractLayout::setIteration(int iteration) noexcept
+{
+    if (iteration != _iteration) {
+        _iteration = iteration;
+        emit iterationChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
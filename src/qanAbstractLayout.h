@@ -0,0 +1,206 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanAbstractLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QPointF>
+#include <QQmlEngine>
+
+// QuickQanava headers
+#include "./qanLayoutJob.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class GroupLayout;
+class LayoutCache;
+
+//! Progress reporting interface of a running layout task.
+class LayoutProgress
+{
+public:
+    virtual ~LayoutProgress() = default;
+    //! Return true if layout has been stopped or restarted, task should return as soon as possible.
+    virtual bool    isCancelled() const noexcept = 0;
+    //! Return true if an intermediate positions batch could be posted (at most once per frame, when previous one has been applied).
+    virtual bool    isBatchDue() const noexcept = 0;
+    //! Post actual job positions as an intermediate batch for \c iteration (job \c x and \c y must be up to date).
+    virtual void    post(int iteration) noexcept = 0;
+};
+
+/*! \brief Base class for graph layouts computed on a worker thread.
+ *
+ * start() takes a topology snapshot of \c graph (see qan::Graph::snapshot()) and actual nodes geometry in a
+ * qan::LayoutJob, then run the task returned by createTask() on the global QThreadPool. Positions (intermediate
+ * batches and final result) are applied from the layout thread in a single qan::Graph::beginUpdate()/endUpdate()
+ * scope.
+ *
+ * \note Only ungrouped nodes and groups are laid out (grouped nodes move with their group), unless layout
+ * is hierarchical (see isHierarchical()). Headless and virtualized nodes are laid out using their qan::Node::geometry.
+ * \nosubgrouping
+ */
+class AbstractLayout : public QObject
+{
+    Q_OBJECT
+    friend class qan::GroupLayout;      // Create tasks of its per group layout
+    /*! \name AbstractLayout Object Management *///----------------------------
+    //@{
+public:
+    explicit AbstractLayout(QObject* parent = nullptr);
+    virtual ~AbstractLayout() override;
+    AbstractLayout(const AbstractLayout&) = delete;
+    AbstractLayout& operator=(const AbstractLayout&) = delete;
+
+public:
+    //! Graph laid out by this layout (a running layout is stopped when graph is changed).
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    void            setGraph(qan::Graph* graph) noexcept;
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void            graphChanged();
+
+public:
+    /*! \brief Optional persistent positions cache (default to nullptr, ie no cache).
+     *
+     * When set, nodes found in cache are pinned at their cached position and only new nodes are laid out
+     * (only layouts honouring qan::LayoutJob::mobility keep cached nodes fixed), when graph structure and all
+     * nodes are found in cache, cached positions are applied without running a layout. Final positions are
+     * stored in cache. Cache is ignored for hierarchical layouts.
+     *
+     * Nodes are identified across sessions by a structural key: node label, group flag and neighbours labels.
+     */
+    Q_PROPERTY(qan::LayoutCache* cache READ getCache WRITE setCache NOTIFY cacheChanged FINAL)
+    void            setCache(qan::LayoutCache* cache) noexcept;
+    inline qan::LayoutCache*    getCache() const noexcept { return _cache.data(); }
+private:
+    QPointer<qan::LayoutCache>  _cache;
+signals:
+    void            cacheChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Execution *///--------------------------------------------
+    //@{
+public:
+    //! Start an asynchronous layout of \c graph (a running layout is restarted from actual positions).
+    Q_INVOKABLE void    start() noexcept;
+
+    //! Stop running layout, positions already applied are kept.
+    Q_INVOKABLE void    stop() noexcept;
+
+    /*! \brief Synchronously layout \c graph and apply final positions, return iteration count.
+     *
+     * Intended for headless graph processing (see qan::Graph::headless).
+     */
+    Q_INVOKABLE int     layout() noexcept;
+
+public:
+    //! True while an asynchronous layout is running.
+    Q_PROPERTY(bool running READ getRunning NOTIFY runningChanged FINAL)
+    inline bool     getRunning() const noexcept { return _run != nullptr; }
+signals:
+    void            runningChanged();
+
+public:
+    //! Iteration of last applied positions batch.
+    Q_PROPERTY(int iteration READ getIteration NOTIFY iterationChanged FINAL)
+    inline int      getIteration() const noexcept { return _iteration; }
+private:
+    int             _iteration = 0;
+signals:
+    void            iterationChanged();
+
+signals:
+    //! Emitted when final positions have been applied (not emitted by stop()).
+    void            finished();
+
+protected:
+    //! Layout task: compute \c job nodes positions and return iteration count.
+    using Task = std::function<int(qan::LayoutJob& job, qan::LayoutProgress& progress)>;
+
+    /*! \brief Return a task computing positions, called from layout thread when a layout is started.
+     *
+     * Task is run on a worker thread: it must only use state captured by value (for example actual layout
+     * parameters) and must not throw.
+     */
+    virtual Task    createTask() = 0;
+
+    /*! \brief Return true to lay out grouped nodes in a hierarchical qan::LayoutJob (default to false).
+     *
+     * Nodes of collapsed groups are not laid out, expanded groups with content are resized with their job size
+     * (see qan::GroupItem::preferredGroupWidth).
+     */
+    virtual bool    isHierarchical() const noexcept { return false; }
+
+public:
+    struct Guard;
+    struct Run;
+    struct Job;
+
+    //! Apply a positions batch computed by a worker thread (must be called from layout thread).
+    void            positionsReady(const std::shared_ptr<Run>& run, std::vector<QPointF> positions,
+                                   int iteration, bool finished) noexcept;
+
+private:
+    //! Build a layout job from actual \c graph nodes geometry, return nullptr if there is nothing to layout.
+    std::unique_ptr<Job>    createJob() const noexcept;
+    //! Pin \c job nodes found in cache at their cached position, return true if every node has been found for actual graph fingerprint.
+    bool            lookupCache(Job& job) const noexcept;
+    //! Store \c job final positions in cache.
+    void            storeCache(const Job& job) const noexcept;
+    //! Apply \c positions (indexed by \c job snapshot node indexes) to graph in a single batched update.
+    void            applyPositions(const Job& job, const std::vector<QPointF>& positions) noexcept;
+    //! Set actual iteration.
+    void            setIteration(int iteration) noexcept;
+
+    std::shared_ptr<Guard>  _guard;
+    std::shared_ptr<Run>    _run;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::AbstractLayout)
@@ -0,0 +1,149 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanAdjacencyModel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <iterator>     // std::next
+
+// QuickQanava headers
+#include "./qanAdjacencyModel.h"
+#include "./qanNode.h"
+#include "./qanEdge.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Return the QObject at \c index in \c adjacency (a range of weak nodes or weak edges).
+template <class adjacency_t>
+QObject*    adjacentAt(const adjacency_t& adjacency, int index) noexcept
+{
+    if (index < 0 ||
+        index >= static_cast<int>(std::distance(adjacency.cbegin(), adjacency.cend())))
+        return nullptr;
+    return (*std::next(adjacency.cbegin(), index)).lock().get();
+}
+
+template <class adjacency_t>
+int         adjacentIndexOf(const adjacency_t& adjacency, const QObject* item) noexcept
+{
+    int index = 0;
+    for (const auto& adjacent : adjacency) {
+        if (adjacent.lock().get() == item)
+            return index;
+        ++index;
+    }
+    return -1;
+}
+
+} // ::qan::anonymous
+
+/* AdjacencyModel Object Management *///---------------------------------------
+AdjacencyModel::AdjacencyModel(const qan::Node& node, Adjacency adjacency, QObject* parent) :
+    QAbstractListModel{parent},
+    _node{node},
+    _adjacency{adjacency}
+{
+    _length = getDegree();
+    if (_adjacency == Adjacency::InNodes)
+        connect(&_node, &qan::Node::inDegreeChanged,    this,   &AdjacencyModel::onDegreeChanged);
+    else
+        connect(&_node, &qan::Node::outDegreeChanged,   this,   &AdjacencyModel::onDegreeChanged);
+}
+//-----------------------------------------------------------------------------
+
+/* QAbstractListModel Interface *///-------------------------------------------
+int     AdjacencyModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : _length;
+}
+
+QVariant    AdjacencyModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() ||
+        index.row() >= _length)
+        return QVariant{};
+    const auto item = at(index.row());
+    if (item == nullptr)
+        return QVariant{};
+    if (role == Qt::DisplayRole)
+        return item->property("label");
+    else if (role == ItemDataRole)
+        return QVariant::fromValue<QObject*>(item);
+    return QVariant{};
+}
+
+QHash<int, QByteArray>  AdjacencyModel::roleNames() const
+{
+    return { {static_cast<int>(ItemDataRole), "itemData"} };
+}
+
+QObject*    AdjacencyModel::at(int index) const noexcept
+{
+    switch (_adjacency) {
+    case Adjacency::InNodes:    return adjacentAt(_node.get_in_nodes(), index);
+    case Adjacency::OutNodes:   return adjacentAt(_node.get_out_nodes(), index);
+    case Adjacency::OutEdges:   return adjacentAt(_node.get_out_edges(), index);
+    }
+    return nullptr;
+}
+
+int     AdjacencyModel::indexOf(QObject* item) const noexcept
+{
+    if (item == nullptr)
+        return -1;
+    switch (_adjacency) {
+    case Adjacency::InNodes:    return adjacentIndexOf(_node.get_in_nodes(), item);
+    case Adjacency::OutNodes:   return adjacentIndexOf(_node.get_out_nodes(), item);
+    case Adjacency::OutEdges:   return adjacentIndexOf(_node.get_out_edges(), item);
+    }
+    return -1;
+}
+
+void    AdjacencyModel::onDegreeChanged()
+{
+    const auto length = getDegree();
+    beginResetModel();
+    _length = length;
+    endResetModel();
+    emit lengthChanged();
+}
+
+int     AdjacencyModel::getDegree() const noexcept
+{
+    return static_cast<int>(_adjacency == Adjacency::InNodes ? _node.get_in_degree() :
+                                                               _node.get_out_degree());
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,114 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanAdjacencyModel.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QAbstractListModel>
+#include <QHash>
+#include <QByteArray>
+
+namespace qan { // ::qan
+
+class Node;
+
+/*! \brief Read-only lazy list model projecting a qan::Node in nodes, out nodes or out edges.
+ *
+ * Used for qan::Node inNodes, outNodes and outEdges properties when adjacency is stored in plain std
+ * containers (QUICKQANAVA_STD_ADJACENCY): model is created on first QML access and items are read
+ * from node adjacency on demand, the model is reset when node in or out degree change.
+ *
+ * Roles and invokables mirror qcm::ContainerModel: "itemData" role, Qt::DisplayRole is item \c label
+ * property, \c length property and at(), indexOf(), contains() methods.
+ */
+class AdjacencyModel : public QAbstractListModel
+{
+    /*! \name AdjacencyModel Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+public:
+    //! Adjacency projected by an AdjacencyModel.
+    enum class Adjacency : int {
+        InNodes     = 0,
+        OutNodes    = 1,
+        OutEdges    = 2
+    };
+
+    //! Project \c node \c adjacency, \c node must outlive the model (it is usually owned by \c node).
+    explicit AdjacencyModel(const qan::Node& node, Adjacency adjacency, QObject* parent = nullptr);
+    virtual ~AdjacencyModel() override = default;
+    AdjacencyModel(const AdjacencyModel&) = delete;
+    AdjacencyModel& operator=(const AdjacencyModel&) = delete;
+private:
+    const qan::Node&    _node;
+    const Adjacency     _adjacency;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name QAbstractListModel Interface *///--------------------------------
+    //@{
+public:
+    enum Roles {
+        ItemDataRole = Qt::UserRole + 1
+    };
+
+    virtual int         rowCount(const QModelIndex& parent = QModelIndex{}) const override;
+    virtual QVariant    data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    virtual QHash<int, QByteArray>  roleNames() const override;
+
+public:
+    Q_PROPERTY(int length READ getLength NOTIFY lengthChanged FINAL)
+    Q_INVOKABLE int     getLength() const noexcept { return _length; }
+signals:
+    void                lengthChanged();
+
+public:
+    //! Return item at \c index (a qan::Node or qan::Edge), nullptr if \c index is invalid.
+    Q_INVOKABLE QObject*    at(int index) const noexcept;
+    //! Return \c item index in projected adjacency, -1 if \c item is not found.
+    Q_INVOKABLE int         indexOf(QObject* item) const noexcept;
+    Q_INVOKABLE bool        contains(QObject* item) const noexcept { return indexOf(item) >= 0; }
+
+private:
+    //! Reset model when projected node degree change.
+    void                onDegreeChanged();
+    //! Return current projected adjacency size.
+    int                 getDegree() const noexcept;
+    //! Cached projected adjacency size (node adjacency is modified before degree notification).
+    int                 _length = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
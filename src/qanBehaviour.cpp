@@ -60,7 +60,7 @@ void    NodeBehaviour::setHost( qan::Node* host )
 
 
 /* Notification Interface *///-------------------------------------------------
-void    NodeBehaviour::on_in_node_inserted( WeakNode& target, WeakNode& weakInNode, const WeakEdge& edge ) noexcept
+void    NodeBehaviour::on_in_node_inserted( const WeakNode& target, const WeakNode& weakInNode, const WeakEdge& edge ) noexcept
 {
     Q_UNUSED(target);
     auto inNode = weakInNode.lock();
@@ -69,7 +69,7 @@ void    NodeBehaviour::on_in_node_inserted( WeakNode& target, WeakNode& weakInNo
         inNodeInserted( *qobject_cast<qan::Node*>(inNode.get()), *inEdge );
 }
 
-void    NodeBehaviour::on_in_node_removed( WeakNode& target, WeakNode& weakInNode, const WeakEdge& edge ) noexcept
+void    NodeBehaviour::on_in_node_removed( const WeakNode& target, const WeakNode& weakInNode, const WeakEdge& edge ) noexcept
 {
     Q_UNUSED(target);
     auto inNode = weakInNode.lock();
@@ -78,7 +78,7 @@ void    NodeBehaviour::on_in_node_removed( WeakNode& target, WeakNode& weakInNod
         inNodeRemoved( *qobject_cast<qan::Node*>(inNode.get()), *inEdge );
 }
 
-void    NodeBehaviour::on_out_node_inserted( WeakNode& target, WeakNode& weakOutNode, const WeakEdge& edge ) noexcept
+void    NodeBehaviour::on_out_node_inserted( const WeakNode& target, const WeakNode& weakOutNode, const WeakEdge& edge ) noexcept
 {
     Q_UNUSED(target);
     auto outNode = weakOutNode.lock();
@@ -87,7 +87,7 @@ void    NodeBehaviour::on_out_node_inserted( WeakNode& target, WeakNode& weakOut
         outNodeInserted( *qobject_cast<qan::Node*>(outNode.get()), *outEdge );
 }
 
-void    NodeBehaviour::on_out_node_removed( WeakNode& target, WeakNode& weakOutNode, const WeakEdge& edge ) noexcept
+void    NodeBehaviour::on_out_node_removed( const WeakNode& target, const WeakNode& weakOutNode, const WeakEdge& edge ) noexcept
 {
     Q_UNUSED(target);
     auto outNode = weakOutNode.lock();
@@ -100,18 +100,18 @@ public:
     using WeakEdge  = gtpo::dynamic_node_behaviour< qan::Config >::weak_edge_t;
 
     //! \copydoc gtpo::dynamic_node_nehaviour::inNodeInserted()
-    virtual void    on_in_node_inserted(WeakNode& target, WeakNode& weakInNode, const WeakEdge& edge) noexcept override;
+    virtual void    on_in_node_inserted(const WeakNode& target, const WeakNode& weakInNode, const WeakEdge& edge) noexcept override;
     //! \copydoc gtpo::dynamic_node_nehaviour::inNodeRemoved()
-    virtual void    on_in_node_removed(WeakNode& target, WeakNode& weakInNode, const WeakEdge& edge) noexcept override;
+    virtual void    on_in_node_removed(const WeakNode& target, const WeakNode& weakInNode, const WeakEdge& edge) noexcept override;
     //! \copydoc gtpo::dynamic_node_nehaviour::inNodeRemoved()
-    virtual void    on_in_node_removed(WeakNode& target) noexcept override { Q_UNUSED(target); }
+    virtual void    on_in_node_removed(const WeakNode& target) noexcept override { Q_UNUSED(target); }
 
     //! \copydoc gtpo::dynamic_node_nehaviour::outNodeInserted()
-    virtual void    on_out_node_inserted(WeakNode& target, WeakNode& weakOutNode, const WeakEdge& edge) noexcept override;
+    virtual void    on_out_node_inserted(const WeakNode& target, const WeakNode& weakOutNode, const WeakEdge& edge) noexcept override;
     //! \copydoc gtpo::dynamic_node_nehaviour::outNodeRemoved()
-    virtual void    on_out_node_removed(WeakNode& target, WeakNode& weakOutNode, const WeakEdge& edge) noexcept override;
+    virtual void    on_out_node_removed(const WeakNode& target, const WeakNode& weakOutNode, const WeakEdge& edge) noexcept override;
     //! \copydoc gtpo::dynamic_node_nehaviour::outNodeRemoved()
-    virtual void    on_out_node_removed(WeakNode& target) noexcept override { Q_UNUSED(target); }
+    virtual void    on_out_node_removed(const WeakNode& target) noexcept override { Q_UNUSED(target); }
 
 protected:
     virtual void    inNodeInserted( qan::Node& inNode, qan::Edge& edge ) noexcept { Q_UNUSED( inNode ); Q_UNUSED(edge); }
@@ -38,6 +38,7 @@
 // Qt headers
 #include <QCursor>
 #include <QMouseEvent>
+#include <QQuickWindow>
 
 // QuickQanava headers
 #include "./qanBottomRightResizer.h"
@@ -371,20 +372,23 @@ bool   BottomRightResizer::eventFilter(QObject *item, QEvent *event)
                 const QPointF delta{curLocalPos - startLocalPos};
                 if (_target) {
                     // Do not resize below minimumSize
+                    QSizeF targetSize = _targetResizePending ? _pendingTargetSize :
+                                                               QSizeF{_target->width(), _target->height()};
                     const qreal targetWidth = _targetInitialSize.width() + delta.x();
                     if (targetWidth > _minimumTargetSize.width())
-                            _target->setWidth(targetWidth);
+                        targetSize.setWidth(targetWidth);
                     if (_preserveRatio) {
                         const qreal finalTargetWidth = targetWidth > _minimumTargetSize.width() ? targetWidth :
                                                                                                   _minimumTargetSize.width();
                         const qreal targetHeight = finalTargetWidth * getRatio();
                         if (targetHeight > _minimumTargetSize.height())
-                            _target->setHeight(targetHeight);
+                            targetSize.setHeight(targetHeight);
                     } else {
                         const qreal targetHeight = _targetInitialSize.height() + delta.y();
                         if (targetHeight > _minimumTargetSize.height())
-                            _target->setHeight(targetHeight);
+                            targetSize.setHeight(targetHeight);
                     }
+                    scheduleTargetResize(targetSize);
                     me->setAccepted(true);
                     accepted = true;
                 }
@@ -406,6 +410,7 @@ bool   BottomRightResizer::eventFilter(QObject *item, QEvent *event)
         }
             break;
         case QEvent::MouseButtonRelease: {
+            flushTargetResize();                // Apply last pending size before notifying resize end
             _dragInitialPos = { 0., 0. };       // Invalid all cached coordinates when button is released
             _targetInitialSize = { 0., 0. };
             emit resizeEnd( _target ? QSizeF{ _target->width(), _target->height() } :
@@ -420,6 +425,36 @@ bool   BottomRightResizer::eventFilter(QObject *item, QEvent *event)
     }
     return accepted ? true : QObject::eventFilter(item, event);
 }
+
+void    BottomRightResizer::scheduleTargetResize(const QSizeF& targetSize) noexcept
+{
+    _pendingTargetSize = targetSize;
+    const auto resizeWindow = window();
+    if (resizeWindow == nullptr) {
+        _targetResizePending = true;
+        flushTargetResize();
+        return;
+    }
+    if (_targetResizePending)
+        return;
+    _targetResizePending = true;
+    if (resizeWindow != _resizeWindow) {
+        if (_resizeWindow)
+            disconnect(_resizeWindow, &QQuickWindow::afterAnimating, this, &BottomRightResizer::flushTargetResize);
+        _resizeWindow = resizeWindow;
+        connect(resizeWindow, &QQuickWindow::afterAnimating, this, &BottomRightResizer::flushTargetResize);
+    }
+    resizeWindow->update();     // Ensure a frame is scheduled
+}
+
+void    BottomRightResizer::flushTargetResize() noexcept
+{
+    if (!_targetResizePending)
+        return;
+    _targetResizePending = false;
+    if (_target)
+        _target->setSize(_pendingTargetSize);
+}
 //-------------------------------------------------------------------------
 
 } // ::qan
@@ -238,6 +238,19 @@ private:
     QPointF         _dragInitialPos{ 0., 0. };
     //! Target item size at the beginning of a resizing handler drag.
     QSizeF          _targetInitialSize{ 0., 0. };
+
+private:
+    /*! \brief Request \c targetSize to be applied to target on next frame.
+     *
+     * Mouse moves are coalesced: target is resized at most once per frame (with a single
+     * QQuickItem::setSize() call), resize is applied immediately when there is no window.
+     */
+    void            scheduleTargetResize(const QSizeF& targetSize) noexcept;
+    //! Apply pending target size (if any).
+    void            flushTargetResize() noexcept;
+    QSizeF          _pendingTargetSize{};
+    bool            _targetResizePending = false;
+    QPointer<QQuickWindow>  _resizeWindow;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -0,0 +1,192 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanBoundingShape.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::max
+
+// Qt headers
+#include <QHash>
+#include <QDataStream>
+#include <QPainterPath>
+
+// QuickQanava headers
+#include "./qanBoundingShape.h"
+
+namespace qan { // ::qan
+
+namespace impl { // ::qan::impl
+
+//! Shared shape cache, keyed by provider cache key and node size (only accessed from GUI thread).
+QHash<QByteArray, QPolygonF>&   boundingShapeCache()
+{
+    static QHash<QByteArray, QPolygonF> cache;
+    return cache;
+}
+
+} // ::qan::impl
+
+/* BoundingShape Object Management *///----------------------------------------
+BoundingShape::BoundingShape( QObject* parent ) :
+    QObject{parent}
+{
+}
+//-----------------------------------------------------------------------------
+
+/* Shape Configuration *///----------------------------------------------------
+void    BoundingShape::setShape( Shape shape ) noexcept
+{
+    if ( shape != _shape ) {
+        _shape = shape;
+        emit shapeChanged();
+        invalidate();
+    }
+}
+
+void    BoundingShape::setRadius( qreal radius ) noexcept
+{
+    radius = std::max(0., radius);
+    if ( !qFuzzyCompare(1. + radius, 1. + _radius) ) {
+        _radius = radius;
+        emit radiusChanged();
+        invalidate();
+    }
+}
+
+QVariantList    BoundingShape::getPoints() const noexcept
+{
+    QVariantList points;
+    points.reserve(_points.size());
+    for ( const auto& p : _points )
+        points.append(p);
+    return points;
+}
+
+void    BoundingShape::setPoints( const QVariantList& points ) noexcept
+{
+    QPolygonF polygon;
+    polygon.reserve(points.size());
+    for ( const auto& vp : points )
+        polygon.append(vp.toPointF());
+    if ( polygon != _points ) {
+        _points = polygon;
+        emit pointsChanged();
+        invalidate();
+    }
+}
+
+void    BoundingShape::invalidate() noexcept
+{
+    _cacheKey.clear();
+    emit invalidated();
+}
+//-----------------------------------------------------------------------------
+
+/* Shape Generation and Caching *///-------------------------------------------
+QPolygonF   BoundingShape::getShape( const QSizeF& size ) const
+{
+    if ( _cacheKey.isEmpty() )
+        _cacheKey = cacheKey();
+
+    QByteArray key;
+    key.reserve(_cacheKey.size() + static_cast<int>(2 * sizeof(qreal)));
+    key.append(_cacheKey);
+    const qreal dimensions[2] = { size.width(), size.height() };
+    key.append(reinterpret_cast<const char*>(dimensions), static_cast<int>(sizeof(dimensions)));
+
+    auto& cache = impl::boundingShapeCache();
+    const auto cached = cache.constFind(key);
+    if ( cached != cache.constEnd() )
+        return *cached;
+
+    if ( static_cast<std::size_t>(cache.size()) >= cacheCapacity )
+        cache.clear();
+    const auto shape = generateShape(size);
+    cache.insert(key, shape);
+    return shape;
+}
+
+void    BoundingShape::clearCache() noexcept
+{
+    impl::boundingShapeCache().clear();
+}
+
+QPolygonF   BoundingShape::generateShape( const QSizeF& size ) const
+{
+    const qreal w = size.width();
+    const qreal h = size.height();
+    switch ( _shape ) {
+    case Shape::Ellipse: {
+        QPainterPath path;
+        path.addEllipse(QRectF{ 0., 0., w, h });
+        return path.toFillPolygon(QTransform{});
+    }
+    case Shape::Diamond:
+        return QPolygonF{ QVector<QPointF>{ { w / 2., 0. }, { w, h / 2. },
+                                            { w / 2., h }, { 0., h / 2. }, { w / 2., 0. } } };
+    case Shape::Polygon:
+        if ( _points.size() >= 3 ) {
+            QPolygonF polygon;
+            polygon.reserve(_points.size() + 1);
+            for ( const auto& p : _points )
+                polygon.append(QPointF{ p.x() * w, p.y() * h });
+            if ( !polygon.isClosed() )
+                polygon.append(polygon.first());
+            return polygon;
+        }
+        Q_FALLTHROUGH();    // Use a rounded rect for an invalid polygon
+    case Shape::RoundedRect:
+    default: {
+        QPainterPath path;
+        path.addRoundedRect(QRectF{ 0., 0., w, h }, _radius, _radius);
+        return path.toFillPolygon(QTransform{});
+    }
+    }
+}
+
+QByteArray  BoundingShape::cacheKey() const
+{
+    QByteArray key;
+    QDataStream stream{&key, QIODevice::WriteOnly};
+    stream << QByteArray{metaObject()->className()}
+           << static_cast<quint32>(_shape);
+    if ( _shape == Shape::RoundedRect ||
+         ( _shape == Shape::Polygon && _points.size() < 3 ) )
+        stream << _radius;
+    else if ( _shape == Shape::Polygon )
+        stream << _points;
+    return key;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
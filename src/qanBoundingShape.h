@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanBoundingShape.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <cstddef>  // std::size_t
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPolygonF>
+#include <QSizeF>
+#include <QVariantList>
+
+namespace qan { // ::qan
+
+/*! \brief Native bounding shape generator for non rectangular qan::NodeItem.
+ *
+ * A bounding shape provider replace a QML \c onRequestUpdateBoundingShape() handler for common non rectangular
+ * node shapes: set it as qan::NodeItem::shapeProvider and leave \c complexBoundingShape to false.
+ * \code
+ * Qan.NodeItem {
+ *   shapeProvider: Qan.BoundingShape { shape: Qan.BoundingShape.Diamond }
+ * }
+ * \endcode
+ *
+ * Generated polygons are cached in a shared cache keyed by (cacheKey(), size): every node using providers with
+ * the same configuration and the same size share one implicitly shared polygon. Node items only query the cache
+ * lazily on first hit-test or edge clipping after a resize.
+ *
+ * Subclasses could generate custom shapes by overriding generateShape() and cacheKey().
+ *
+ * \nosubgrouping
+ */
+class BoundingShape : public QObject
+{
+    /*! \name BoundingShape Object Management *///-----------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit BoundingShape( QObject* parent = nullptr );
+    virtual ~BoundingShape() override = default;
+    BoundingShape( const BoundingShape& ) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Shape Configuration *///-----------------------------------------
+    //@{
+public:
+    enum class Shape : unsigned int {
+        //! Rounded rectangle with \c radius corner radius (same shape than qan::NodeItem default bounding shape).
+        RoundedRect     = 0,
+        //! Ellipse inscribed in node bounding rect.
+        Ellipse         = 1,
+        //! Diamond joining node bounding rect sides middle points.
+        Diamond         = 2,
+        //! Polygon defined in \c points, with coordinates normalized in node bounding rect ([0., 1.] range).
+        Polygon         = 3
+    };
+    Q_ENUM(Shape)
+
+    Q_PROPERTY( Shape shape READ getShape WRITE setShape NOTIFY shapeChanged FINAL )
+    inline Shape    getShape() const noexcept { return _shape; }
+    void            setShape( Shape shape ) noexcept;
+private:
+    Shape           _shape{Shape::RoundedRect};
+signals:
+    void            shapeChanged();
+
+public:
+    //! Corner radius for \c RoundedRect shape (default to 5.).
+    Q_PROPERTY( qreal radius READ getRadius WRITE setRadius NOTIFY radiusChanged FINAL )
+    inline qreal    getRadius() const noexcept { return _radius; }
+    void            setRadius( qreal radius ) noexcept;
+private:
+    qreal           _radius{5.};
+signals:
+    void            radiusChanged();
+
+public:
+    //! Normalized polygon for \c Polygon shape (list of points with coordinates in [0., 1.] range).
+    Q_PROPERTY( QVariantList points READ getPoints WRITE setPoints NOTIFY pointsChanged FINAL )
+    QVariantList    getPoints() const noexcept;
+    void            setPoints( const QVariantList& points ) noexcept;
+private:
+    QPolygonF       _points;
+signals:
+    void            pointsChanged();
+    /*! \brief Emitted when any parameter affecting generated shapes is modified.
+     *
+     * Node items using this provider invalidate their bounding shape when this signal is emitted.
+     */
+    void            invalidated();
+protected:
+    //! Must be called by subclasses when a parameter affecting generateShape() is modified.
+    void            invalidate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Shape Generation and Caching *///--------------------------------
+    //@{
+public:
+    /*! \brief Return a polygon for \c size from the shared shape cache, generate it with generateShape() if necessary.
+     *
+     * Returned polygon is implicitly shared with every other node using an equivalent provider with the same size.
+     */
+    QPolygonF               getShape( const QSizeF& size ) const;
+
+    //! Clear shared shape cache (existing polygons remain valid in node items).
+    static void             clearCache() noexcept;
+    //! Maximum number of polygons stored in shared shape cache, cache is cleared when it is exceeded.
+    static constexpr std::size_t    cacheCapacity = 4096;
+
+protected:
+    //! Generate a bounding shape polygon in node local CS for a node of size \c size.
+    virtual QPolygonF       generateShape( const QSizeF& size ) const;
+
+    /*! \brief Key identifying generateShape() output for a given size.
+     *
+     * Default implementation encode class name, \c shape, \c radius and \c points: providers with equal keys must
+     * generate the same shapes. Subclasses with custom parameters must override this method.
+     */
+    virtual QByteArray      cacheKey() const;
+private:
+    mutable QByteArray      _cacheKey;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::BoundingShape)
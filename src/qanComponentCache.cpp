@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanComponentCache.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QQmlEngine>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanComponentCache.h"
+
+namespace qan { // ::qan
+
+/* ComponentCache Object Management *///--------------------------------------
+ComponentCache& ComponentCache::instance(QQmlEngine& engine) noexcept
+{
+    // Note: Cache is a child of engine, hash entry is removed when cache is destroyed with its engine.
+    static QHash<const QQmlEngine*, ComponentCache*> caches;
+    auto cache = caches.value(&engine, nullptr);
+    if (cache == nullptr) {
+        cache = new ComponentCache{engine};
+        caches.insert(&engine, cache);
+        QObject::connect(cache, &QObject::destroyed, [enginePtr = &engine]() { caches.remove(enginePtr); });
+    }
+    return *cache;
+}
+
+QQmlComponent*  ComponentCache::get(QQmlEngine& engine, const QString& url) noexcept
+{
+    return instance(engine).component(url);
+}
+
+ComponentCache::ComponentCache(QQmlEngine& engine) :
+    QObject{&engine},
+    _engine{engine} { }
+//-----------------------------------------------------------------------------
+
+/* Component Management *///--------------------------------------------------
+QQmlComponent*  ComponentCache::component(const QString& url) noexcept
+{
+    if (url.isEmpty()) {
+        qWarning() << "qan::ComponentCache::component(): Error: Empty url.";
+        return nullptr;
+    }
+    auto component = _components.value(url, nullptr);
+    if (component != nullptr &&
+        !component->isLoading())
+        return component;
+    if (component != nullptr)       // Preloading component: a synchronous component force type loader completion
+        component->deleteLater();
+    component = new QQmlComponent{&_engine, url, QQmlComponent::PreferSynchronous, this};
+    QQmlEngine::setObjectOwnership(component, QQmlEngine::CppOwnership);
+    if (component->isError()) {
+        qWarning() << "qan::ComponentCache::component(): Error while creating component from URL " << url;
+        qWarning() << "\tQML Component errors=" << component->errors();
+    }
+    _components.insert(url, component);
+    return component;
+}
+
+bool    ComponentCache::contains(const QString& url) const noexcept
+{
+    return _components.contains(url);
+}
+
+void    ComponentCache::preload(const QStringList& urls) noexcept
+{
+    for (const auto& url : urls) {
+        if (url.isEmpty() ||
+            _components.contains(url))
+            continue;
+        auto component = new QQmlComponent{&_engine, url, QQmlComponent::Asynchronous, this};
+        QQmlEngine::setObjectOwnership(component, QQmlEngine::CppOwnership);
+        _components.insert(url, component);
+    }
+}
+
+void    ComponentCache::preload() noexcept
+{
+    preload({QStringLiteral("qrc:/QuickQanava/Node.qml"),
+             QStringLiteral("qrc:/QuickQanava/Edge.qml"),
+             QStringLiteral("qrc:/QuickQanava/Group.qml"),
+             QStringLiteral("qrc:/QuickQanava/Port.qml"),
+             QStringLiteral("qrc:/QuickQanava/HorizontalDock.qml"),
+             QStringLiteral("qrc:/QuickQanava/VerticalDock.qml"),
+             QStringLiteral("qrc:/QuickQanava/SelectionItem.qml")});
+}
+
+void    ComponentDeleter::operator()(QQmlComponent* component) const noexcept
+{
+    if (component != nullptr &&
+        qobject_cast<const qan::ComponentCache*>(component->parent()) == nullptr)
+        delete component;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
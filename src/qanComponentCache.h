@@ -0,0 +1,130 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanComponentCache.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+
+// Qt headers
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QQmlComponent>
+
+QT_BEGIN_NAMESPACE
+class QQmlEngine;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+/*! \brief QML engine level registry of QML components keyed by URL.
+ *
+ * There is one cache per QML engine, it is owned by the engine and destroyed with it. Cached components
+ * are owned by the cache: they should never be deleted nor owned by the caller.
+ *
+ * Delegate factories such as qan::Node::delegate() should use the cache instead of a function local static
+ * component (which is also bound to the first engine that requested it):
+ * \code
+ * QQmlComponent*  CustomNode::delegate(QQmlEngine& engine, QObject* parent) noexcept
+ * {
+ *     Q_UNUSED(parent)
+ *     return qan::ComponentCache::get(engine, QStringLiteral("qrc:/CustomNode.qml"));
+ * }
+ * \endcode
+ *
+ * QuickQanava default templates (\c Node.qml, \c Edge.qml, \c Group.qml, \c Port.qml...) are preloaded
+ * asynchronously when QuickQanava is initialized with an engine (see preload()).
+ *
+ * \nosubgrouping
+ */
+class ComponentCache : public QObject
+{
+    /*! \name ComponentCache Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+public:
+    //! Return \c engine component cache, create it if necessary.
+    static ComponentCache&  instance(QQmlEngine& engine) noexcept;
+    //! Shortcut to instance(engine).component(url).
+    static QQmlComponent*   get(QQmlEngine& engine, const QString& url) noexcept;
+private:
+    explicit ComponentCache(QQmlEngine& engine);
+public:
+    virtual ~ComponentCache() override = default;
+    ComponentCache(const ComponentCache&) = delete;
+private:
+    QQmlEngine&             _engine;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Component Management *///----------------------------------------
+    //@{
+public:
+    /*! \brief Return cached component for \c url, component is created synchronously on first request.
+     *
+     * \return nullptr if \c url is empty, component loading errors are reported on stderr.
+     */
+    QQmlComponent*          component(const QString& url) noexcept;
+
+    //! Return true if a component has already been created (or is preloading) for \c url.
+    bool                    contains(const QString& url) const noexcept;
+
+    /*! \brief Asynchronously load and compile components for \c urls, later component() calls for the same urls are O(1).
+     *
+     * \note A component() call for a still loading url force a synchronous completion.
+     */
+    void                    preload(const QStringList& urls) noexcept;
+
+    //! Asynchronously preload all QuickQanava default templates (node, edge, group, port, docks and selection delegates).
+    void                    preload() noexcept;
+
+private:
+    QHash<QString, QQmlComponent*>  _components;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+//! std::unique_ptr<> deleter for QML components that might be owned by a qan::ComponentCache (cached components are never deleted).
+struct ComponentDeleter {
+    ComponentDeleter() noexcept = default;
+    ComponentDeleter(const std::default_delete<QQmlComponent>&) noexcept { }
+    void operator()(QQmlComponent* component) const noexcept;
+};
+
+//! Owning pointer on a QML component, does not delete component if it is cached in a qan::ComponentCache.
+using component_ptr = std::unique_ptr<QQmlComponent, ComponentDeleter>;
+
+} // ::qan
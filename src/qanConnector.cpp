@@ -34,6 +34,8 @@
 
 // Qt headers
 #include <QQuickItem>
+#include <QQuickWindow>
+#include <QTimer>
 
 // QuickQanava headers
 #include "./qanGraph.h"
@@ -50,6 +52,8 @@ Connector::Connector(QQuickItem* parent) :
 {
     setAcceptDrops(false);
     setVisible(false);
+    connect(this, &QQuickItem::xChanged, this, &Connector::scheduleHoveredTargetUpdate);
+    connect(this, &QQuickItem::yChanged, this, &Connector::scheduleHoveredTargetUpdate);
 }
 
 auto    Connector::setGraph(qan::Graph* graph) noexcept -> void
@@ -92,6 +96,9 @@ qan::NodeStyle* Connector::style(QObject* parent) noexcept
 /* Connector Configuration *///------------------------------------------------
 void    Connector::connectorReleased(QQuickItem* target) noexcept
 {
+    _connectorDragged = false;
+    setHoveredTarget(nullptr, false);
+
     // Restore original position
     if (_connectorItem)
         _connectorItem->setState("NORMAL");
@@ -137,6 +144,7 @@ void    Connector::connectorReleased(QQuickItem* target) noexcept
         else if ( srcPortItem &&
                   dstPortItem == nullptr )
             create = _graph->isEdgeSourceBindable(*srcPortItem);
+        create = create && _graph->isEdgeInsertable(*srcNode, *dstNode);
         if ( getCreateDefaultEdge() ) {
             if ( create )
                 createdEdge = _graph->insertEdge( srcNode, dstNode );
@@ -169,6 +177,7 @@ void    Connector::connectorPressed() noexcept
     _edgeItem->setSourceItem(srcItem);
     _edgeItem->setDestinationItem(this);
     _edgeItem->setVisible(true);
+    _connectorDragged = true;
 
     if (_sourceNode)
         _graph->selectNode(*_sourceNode);
@@ -350,6 +359,81 @@ void    Connector::sourceNodeDestroyed()
     if (sender() == _sourceNode.data())
         setSourceNode(nullptr);
 }
+
+void    Connector::scheduleHoveredTargetUpdate() noexcept
+{
+    if (!_connectorDragged ||
+        _hoverUpdateScheduled)
+        return;
+    _hoverUpdateScheduled = true;
+    const auto connectorWindow = window();
+    if (connectorWindow != nullptr) {
+        if (connectorWindow != _hoverUpdateWindow) {
+            if (_hoverUpdateWindow)
+                disconnect(_hoverUpdateWindow, &QQuickWindow::afterAnimating, this, &Connector::updateHoveredTarget);
+            _hoverUpdateWindow = connectorWindow;
+            connect(connectorWindow, &QQuickWindow::afterAnimating, this, &Connector::updateHoveredTarget);
+        }
+        connectorWindow->update();  // Ensure a frame is scheduled
+    } else
+        QTimer::singleShot(0, this, &Connector::updateHoveredTarget);
+}
+
+void    Connector::updateHoveredTarget() noexcept
+{
+    if (!_hoverUpdateScheduled)
+        return;
+    _hoverUpdateScheduled = false;
+    if (!_connectorDragged ||
+        !_graph ||
+        _graph->getContainerItem() == nullptr)
+        return;
+    const auto container = _graph->getContainerItem();
+    const auto p = mapToItem(container, QPointF{width() / 2., height() / 2.});
+
+    // Ports have priority over their host node (and might lie outside host node when docked)
+    QQuickItem* target = _graph->portAt(p);
+    if (target == nullptr) {
+        const auto graphPos = _graph->mapFromItem(container, p);
+        target = qobject_cast<qan::NodeItem*>(_graph->graphChildAt(graphPos.x(), graphPos.y()));
+    }
+    setHoveredTarget(target, isConnectableTarget(target));
+}
+
+void    Connector::setHoveredTarget(QQuickItem* target, bool connectable) noexcept
+{
+    if (target != _hoveredTarget ||
+        connectable != _hoveredTargetConnectable) {
+        _hoveredTarget = target;
+        _hoveredTargetConnectable = connectable;
+        emit hoveredTargetChanged();
+    }
+}
+
+bool    Connector::isConnectableTarget(const QQuickItem* target) const noexcept
+{
+    const auto targetItem = qobject_cast<const qan::NodeItem*>(target);
+    if (targetItem == nullptr ||
+        targetItem == this)
+        return false;
+    const auto targetGroupItem = qobject_cast<const qan::GroupItem*>(targetItem);
+    const auto targetNode = targetGroupItem != nullptr ? targetGroupItem->getGroup() : targetItem->getNode();
+    if (targetNode == nullptr ||
+        targetNode->getLocked())
+        return false;
+    const auto source = _sourceNode ? _sourceNode.data() :
+                                      _sourcePort ? _sourcePort->getNode() : nullptr;
+    if (source != nullptr) {
+        if (target == source->getItem())    // Prevent creation of a circuit on source node
+            return false;
+        const auto sourceGroup = source->getGroup();
+        if (sourceGroup != nullptr &&       // Prevent creation of an edge from source node to it's own group
+            target == sourceGroup->getItem())
+            return false;
+    }
+    return targetItem->getConnectable() == qan::NodeItem::Connectable::Connectable ||
+           targetItem->getConnectable() == qan::NodeItem::Connectable::InConnectable;
+}
 //-----------------------------------------------------------------------------
 
 
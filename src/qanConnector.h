@@ -180,6 +180,38 @@ signals:
 private slots:
     //! Called when the current source node is destroyed.
     void                sourceNodeDestroyed();
+
+public:
+    /*! \brief Node, group or port item currently under the dragged connector (nullptr when connector is not dragged).
+     *
+     * Target is resolved from graph spatial indexes (see qan::Graph::portAt() and qan::Graph::graphChildAt()) at most
+     * once per frame while the connector is dragged, ports have priority over nodes.
+     */
+    Q_PROPERTY(QQuickItem* hoveredTarget READ getHoveredTarget NOTIFY hoveredTargetChanged FINAL)
+    //! \copydoc hoveredTarget
+    inline QQuickItem*      getHoveredTarget() const noexcept { return _hoveredTarget.data(); }
+    //! True when \c hoveredTarget could be connected from connector source node or port.
+    Q_PROPERTY(bool hoveredTargetConnectable READ getHoveredTargetConnectable NOTIFY hoveredTargetChanged FINAL)
+    //! \copydoc hoveredTargetConnectable
+    inline bool             getHoveredTargetConnectable() const noexcept { return _hoveredTargetConnectable; }
+signals:
+    //! \copydoc hoveredTarget
+    void                    hoveredTargetChanged();
+private:
+    //! Request a hovered target update on next frame (called when connector is moved while dragged).
+    void                    scheduleHoveredTargetUpdate() noexcept;
+    //! Resolve item under connector center and update \c hoveredTarget.
+    void                    updateHoveredTarget() noexcept;
+    //! Set \c hoveredTarget and its connectable state.
+    void                    setHoveredTarget(QQuickItem* target, bool connectable) noexcept;
+    //! Return true if \c target is a node, group or port item that can be connected from connector source.
+    bool                    isConnectableTarget(const QQuickItem* target) const noexcept;
+
+    QPointer<QQuickItem>    _hoveredTarget;
+    bool                    _hoveredTargetConnectable = false;
+    bool                    _connectorDragged = false;
+    bool                    _hoverUpdateScheduled = false;
+    QPointer<QQuickWindow>  _hoverUpdateWindow;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -35,6 +35,11 @@
 #ifndef qanContainerAdapter_h
 #define qanContainerAdapter_h
 
+// Std headers
+#include <algorithm>        // std::remove_if
+#include <utility>          // std::move
+#include <vector>
+
 // Qt headers
 #include <QObject>
 #include <QList>
@@ -42,6 +47,7 @@
 #include <QSet>
 
 // GTpo headers
+#include "gtpo/container_adapter.h"
 #include "gtpo/qt_container_adapter.h"
 
 // QuickContainers headers
@@ -54,17 +60,19 @@ struct ContainerAdapter { };
 
 template < typename T >
 struct ContainerAdapter< QVector<T> > {
-    inline static void  insert( T t, QVector<T>& c ) { c.append( t ); }
+    inline static void  insert( T t, QVector<T>& c ) { c.append( std::move(t) ); }
     inline static void  insert( T t, QVector<T>& c, int i ) { c.insert( i, t ); }
     inline static void  remove( const T& t, QVector<T>& c ) { c.removeAll(t); }
     inline static   std::size_t size( QVector<T>& c ) { return c.size(); }
     inline static   bool        contains( const QVector<T>& c, const T& t ) { return c.contains(t); }
     inline static   void        reserve( QVector<T>& c, std::size_t s) { c.reserve(s); }
+    template < class P >
+    inline static   void        remove_if( QVector<T>& c, P p ) { c.erase( std::remove_if(c.begin(), c.end(), p), c.end() ); }
 };
 
 template < typename T >
 struct ContainerAdapter< QSet<T> > {
-    inline static void  insert( T t, QSet<T>& c ) { c.insert( t ); }
+    inline static void  insert( T t, QSet<T>& c ) { c.insert( std::move(t) ); }
     inline static void  insert( T t, QSet<T>& c, int i ) { c.insert( i, t ); }
     inline static void  remove( const T& t, QSet<T>& c ) { c.remove(t); }
     inline static   std::size_t size( QSet<T>& c ) { return c.size(); }
@@ -72,6 +80,10 @@ struct ContainerAdapter< QSet<T> > {
     inline static   void        reserve( QSet<T>& c, std::size_t s) { c.reserve(s); }
 };
 
+//! Plain std::vector adjacency containers (see qan::Config and QUICKQANAVA_STD_ADJACENCY).
+template < typename T >
+struct ContainerAdapter< std::vector<T> > : public gtpo::std_container_adapter< std::vector<T> > { };
+
 template < template<typename...CArgs> class C, typename T >
 struct ContainerAdapter< qcm::Container<C, T> > {
     inline static void  insert( T t, qcm::Container<C, T>& c ) { c.append( t ); }
@@ -80,6 +92,14 @@ struct ContainerAdapter< qcm::Container<C, T> > {
     inline static   std::size_t size( qcm::Container<C, T>& c ) { return c.size(); }
     inline static   bool        contains( const qcm::Container<C, T>& c, const T& t ) { return c.contains(t); }
     inline static   void        reserve( qcm::Container<C , T>& c, std::size_t s) { c.reserve(s); }
+    template < class P >
+    inline static   void        remove_if( qcm::Container<C, T>& c, P p ) {
+        QVector<T> removed;         // Use range removeAll() to keep qcm::Container model synchronized in a single pass
+        for ( const auto& t : c )
+            if ( p(t) )
+                removed.append(t);
+        c.removeAll(removed.cbegin(), removed.cend());
+    }
 };
 
 
@@ -39,6 +39,7 @@
 #include "./qanDraggableCtrl.h"
 #include "./qanNodeItem.h"
 #include "./qanGraph.h"
+#include "./qanTrace.h"
 
 namespace qan { // ::qan
 
@@ -132,7 +133,14 @@ bool    DraggableCtrl::handleMouseMoveEvent(QMouseEvent* event)
         } else {
             const auto delta = globalPos - _dragLastPos;
             _dragLastPos = globalPos;
-            dragMove(delta, _targetItem->getSelected());
+            if (graph->getFrameSynchronizedDrag()) {    // Accumulate delta, drag is applied in flushDragMove()
+                _pendingDragDelta += delta;
+                if (!_dragMovePending) {
+                    _dragMovePending = true;
+                    graph->scheduleDragMove(_targetItem);
+                }
+            } else
+                dragMove(delta, _targetItem->getSelected());
             return true;
         }
     }
@@ -148,8 +156,22 @@ void    DraggableCtrl::handleMouseReleaseEvent( QMouseEvent* event )
 {
     Q_UNUSED(event)
     if (_targetItem &&
-        _targetItem->getDragged())
+        _targetItem->getDragged()) {
+        flushDragMove();    // Apply last accumulated delta before drop
         endDragMove();
+    }
+}
+
+void    DraggableCtrl::flushDragMove()
+{
+    if (!_dragMovePending)
+        return;
+    _dragMovePending = false;
+    const auto delta = _pendingDragDelta;
+    _pendingDragDelta = QPointF{ 0., 0. };
+    if (_targetItem &&
+        _targetItem->getDragged())
+        dragMove(delta, _targetItem->getSelected());
 }
 
 void    DraggableCtrl::beginDragMove(const QPointF& dragInitialMousePos, bool dragSelection)
@@ -160,6 +182,28 @@ void    DraggableCtrl::beginDragMove(const QPointF& dragInitialMousePos, bool dr
     _targetItem->setDragged(true);
     _dragLastPos = dragInitialMousePos;
 
+    // A selection drag is recorded as a single undo entry: selected nodes ctrl macros are nested in primary target ctrl macro
+    const auto undoGraph = getGraph();
+    const auto containerItem = undoGraph != nullptr ? undoGraph->getContainerItem() : nullptr;
+    if (containerItem != nullptr &&
+        undoGraph->getUndoStack()->isRecording() &&
+        !_dragUndoStack) {
+        _dragUndoStack = undoGraph->getUndoStack();
+        _dragUndoStack->beginMacro(qan::UndoStack::tr("Move"));
+        _dragStartPositions.clear();
+        _dragStartPositions.emplace_back(_target, _targetItem->mapToItem(containerItem, QPointF{0., 0.}));
+        if (dragSelection &&                // Selected grouped nodes are translated but do not begin their own drag
+            undoGraph->hasMultipleSelection()) {
+            for (const auto selectedNode : undoGraph->getSelectedNodes())
+                if (selectedNode != nullptr &&
+                    selectedNode->getItem() != nullptr &&
+                    selectedNode != _target &&
+                    !selectedNode->get_group().expired())
+                    _dragStartPositions.emplace_back(selectedNode,
+                                                     selectedNode->getItem()->mapToItem(containerItem, QPointF{0., 0.}));
+        }
+    }
+
     // If there is a selection, keep start position for all selected nodes.
     if (dragSelection) {
         const auto graph = getGraph();
@@ -183,6 +227,7 @@ void    DraggableCtrl::beginDragMove(const QPointF& dragInitialMousePos, bool dr
 
 void    DraggableCtrl::dragMove(const QPointF& delta, bool dragSelection)
 {
+    QAN_TRACE_SCOPE("DraggableCtrl::dragMove");
     // PRECONDITIONS:
         // _graph must be configured (non nullptr)
         // _graph must have a container item for coordinate mapping
@@ -202,42 +247,28 @@ void    DraggableCtrl::dragMove(const QPointF& delta, bool dragSelection)
             // 1.1 For inside
             // 2.1 For outside groups
         // 2. For ungrouped nodes, perform the drag using scene coords.
-        // 3. If the node is ungroupped and the drag is not an inside group dragging, propose
+        // 3. Translate the whole selection in a single pass (no per item drop target query,
+        //    edges updates are coalesced by graph frame scheduler).
+        // 4. If the node is ungroupped and the drag is not an inside group dragging, propose
         //    the node for grouping (ie just hilight the potential target group item).
+    const auto movedInsideGroup = translate(*graph, *_target, *_targetItem, delta);   // 1., 2.
 
-    const auto targetGroup = _target->get_group().lock();
-    auto movedInsideGroup = false;
-    if (targetGroup &&
-        targetGroup->getItem() != nullptr) {
-        const QRectF targetRect{_targetItem->position() + delta,
-                                QSizeF{ _targetItem->width(), _targetItem->height() }};
-        const QRectF groupRect{QPointF{0., 0.},
-                               QSizeF{ targetGroup->getItem()->width(), targetGroup->getItem()->height() }};
-
-        movedInsideGroup = groupRect.contains(targetRect);
-        if (!movedInsideGroup) {
-            graph->ungroupNode(_target,_target->get_group().lock().get());
-        }
-    }
-
-    const auto localPos = _targetItem->position();
-    _targetItem->setPosition(localPos + delta);
-
-    if (dragSelection) {
-        auto dragMoveSelected = [this, &delta] (auto primitive) { // Call dragMove() on a given node or group
-            const auto primitiveIsNotSelf = static_cast<QQuickItem*>(primitive->getItem()) !=
-                                            static_cast<QQuickItem*>(this->_targetItem.data());
+    if (dragSelection &&        // 3.
+        graph->hasMultipleSelection()) {
+        const auto translateSelected = [this, graph, &delta] (auto primitive) {
             if ( primitive != nullptr &&
                  primitive->getItem() != nullptr &&
-                 primitiveIsNotSelf)       // Note: Contrary to beginDragMove(), drag nodes that are inside a group
-                primitive->getItem()->draggableCtrl().dragMove(delta, false);
+                 static_cast<QQuickItem*>(primitive->getItem()) != static_cast<QQuickItem*>(this->_targetItem.data()) )
+                // Note: Contrary to beginDragMove(), drag nodes that are inside a group
+                translate(*graph, *primitive, *primitive->getItem(), delta);
         };
-
-        std::for_each(graph->getSelectedNodes().begin(), graph->getSelectedNodes().end(), dragMoveSelected);
-        std::for_each(graph->getSelectedGroups().begin(), graph->getSelectedGroups().end(), dragMoveSelected);
+        for (const auto& selectedNode : graph->getSelectedNodes())
+            translateSelected(selectedNode);
+        for (const auto& selectedGroup : graph->getSelectedGroups())
+            translateSelected(selectedGroup);
     }
 
-    // Eventually, propose a node group drop after move
+    // 4. Eventually, propose a node group drop after move (only for primary drag target)
     if (!movedInsideGroup &&
         _targetItem->getDroppable()) {
         qan::Group* group = graph->groupAt( _targetItem->mapToItem(graphContainerItem, QPointF{0., 0.}),
@@ -262,24 +293,48 @@ void    DraggableCtrl::dragMove(const QPointF& delta, bool dragSelection)
     }
 }
 
+bool    DraggableCtrl::translate(qan::Graph& graph, qan::Node& node, qan::NodeItem& nodeItem, const QPointF& delta) noexcept
+{
+    // Ungroup a grouped node dragged outside of its group
+    const auto nodeGroup = node.get_group().lock();
+    auto movedInsideGroup = false;
+    if (nodeGroup &&
+        nodeGroup->getItem() != nullptr) {
+        const QRectF nodeRect{nodeItem.position() + delta,
+                              QSizeF{ nodeItem.width(), nodeItem.height() }};
+        const QRectF groupRect{QPointF{0., 0.},
+                               QSizeF{ nodeGroup->getItem()->width(), nodeGroup->getItem()->height() }};
+        movedInsideGroup = groupRect.contains(nodeRect);
+        if (!movedInsideGroup)
+            graph.ungroupNode(&node, nodeGroup.get());
+    }
+    nodeItem.setPosition(nodeItem.position() + delta);
+    return movedInsideGroup;
+}
+
 void    DraggableCtrl::endDragMove(bool dragSelection)
 {
     _dragLastPos = QPointF{ 0., 0. };  // Invalid all cached coordinates when drag ends
+    _pendingDragDelta = QPointF{ 0., 0. };
+    _dragMovePending = false;
     _lastProposedGroup = nullptr;
 
     // PRECONDITIONS:
         // _target and _targetItem must be configured (true)
         // _graph must be configured (non nullptr)
         // _graph must have a container item for coordinate mapping
+    recordDragMove();
     if (!_target ||
-        !_targetItem)
+        !_targetItem) {
+        endDragMoveMacro();
         return;
+    }
     const auto graph = getGraph();
-    if (graph == nullptr)
-        return;
-    const auto graphContainerItem = graph->getContainerItem();
-    if (graphContainerItem == nullptr)
+    const auto graphContainerItem = graph != nullptr ? graph->getContainerItem() : nullptr;
+    if (graphContainerItem == nullptr) {
+        endDragMoveMacro();
         return;
+    }
     emit graph->nodeMoved(_target);
 
     if (_targetItem->getDroppable()) {
@@ -306,6 +361,32 @@ void    DraggableCtrl::endDragMove(bool dragSelection)
         std::for_each(graph->getSelectedNodes().begin(), graph->getSelectedNodes().end(), enDragMoveSelected);
         std::for_each(graph->getSelectedGroups().begin(), graph->getSelectedGroups().end(), enDragMoveSelected);
     }
+    endDragMoveMacro();
+}
+
+void    DraggableCtrl::recordDragMove() noexcept
+{
+    if (!_dragUndoStack)
+        return;
+    const auto graph = getGraph();
+    const auto containerItem = graph != nullptr ? graph->getContainerItem() : nullptr;
+    if (containerItem != nullptr) {
+        // Note: deltas are measured in graph container, group items are not scaled, so deltas are valid in group coordinates
+        for (const auto& startPosition : _dragStartPositions) {
+            const auto node = startPosition.first.data();
+            if (node != nullptr &&
+                node->getItem() != nullptr)
+                _dragUndoStack->recordMove(*node, node->getItem()->mapToItem(containerItem, QPointF{0., 0.}) - startPosition.second);
+        }
+    }
+    _dragStartPositions.clear();
+}
+
+void    DraggableCtrl::endDragMoveMacro() noexcept
+{
+    if (_dragUndoStack)
+        _dragUndoStack->endMacro();
+    _dragUndoStack.clear();
 }
 //-----------------------------------------------------------------------------
 
@@ -41,11 +41,16 @@
 #include <QDrag>
 #include <QPointer>
 
+// Std headers
+#include <utility>
+#include <vector>
+
 // QuickQanava headers
 #include "./qanGraphConfig.h"
 #include "./qanAbstractDraggableCtrl.h"
 #include "./qanStyle.h"         // Used in handleDropEvent()
 #include "./qanGroup.h"
+#include "./qanUndoStack.h"
 
 namespace qan { // ::qan
 
@@ -102,9 +107,37 @@ public:
     virtual void    dragMove(const QPointF& delta, bool dragSelection = true) override;
     virtual void    endDragMove(bool dragSelection = true) override;
 
+    /*! \brief Apply mouse move deltas accumulated since last drag move.
+     *
+     * Called by qan::Graph before next frame when graph \c frameSynchronizedDrag is true (nothing is done if there is no pending delta).
+     */
+    void            flushDragMove();
+
+protected:
+    /*! \brief Translate \c nodeItem by \c delta, ungroup \c node if it is dragged outside of its group.
+     *
+     * \return true if \c node is grouped and has been moved inside its group.
+     * \note Only a primary drag target query graph for a potential drop group, selected items are just translated.
+     */
+    static bool     translate(qan::Graph& graph, qan::Node& node, qan::NodeItem& nodeItem, const QPointF& delta) noexcept;
+
+private:
+    //! Record dragged nodes moves since beginDragMove() in graph undo stack.
+    void            recordDragMove() noexcept;
+    //! End undo macro opened in beginDragMove().
+    void            endDragMoveMacro() noexcept;
+
+    //! Undo stack where a drag is recorded, non nullptr while a drag undo macro is open.
+    QPointer<qan::UndoStack>    _dragUndoStack{ nullptr };
+    //! Dragged nodes start position in graph container item (only when drag is recorded in undo stack).
+    std::vector<std::pair<QPointer<qan::Node>, QPointF>>    _dragStartPositions;
+
 private:
     //! Internal position cache.
     QPointF                 _dragLastPos{ 0., 0. };
+    //! Mouse move deltas accumulated until next flushDragMove() (when graph \c frameSynchronizedDrag is true).
+    QPointF                 _pendingDragDelta{ 0., 0. };
+    bool                    _dragMovePending{ false };
     //! Last group hovered during a node drag (cached to generate a dragLeave signal on qan::Group).
     QPointer<qan::Group>    _lastProposedGroup{ nullptr };
     //@}
@@ -39,6 +39,7 @@
 // QuickQanava headers
 #include "./qanNode.h"
 #include "./qanEdge.h"
+#include "./qanComponentCache.h"
 #include "./qanEdgeItem.h"
 #include "./qanGraph.h"
 
@@ -74,16 +75,20 @@ void    Edge::setItem(qan::EdgeItem* edgeItem) noexcept
             edgeItem->setEdge(this);
     }
 }
+
+qan::EdgeItem*  Edge::releaseItem() noexcept
+{
+    const auto item = _item.data();
+    _item.clear();
+    return item;
+}
 //-----------------------------------------------------------------------------
 
 /* Edge Static Factories *///--------------------------------------------------
 QQmlComponent*  Edge::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if (!delegate)
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/QuickQanava/Edge.qml",
-                                                   QQmlComponent::PreferSynchronous, parent);
-    return delegate.get();
+    Q_UNUSED(parent)
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/QuickQanava/Edge.qml"));
 }
 
 qan::EdgeStyle* Edge::style(QObject* parent) noexcept
@@ -105,6 +110,11 @@ qan::Node*  Edge::getDestination() noexcept
 {
     return qobject_cast<qan::Node*>(get_dst().lock().get());
 }
+
+qan::Edge*  Edge::getHDestination() noexcept
+{
+    return get_hdst().lock().get();
+}
 //-----------------------------------------------------------------------------
 
 /* Edge Properties Management *///---------------------------------------------
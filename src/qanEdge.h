@@ -74,6 +74,8 @@ public:
     Q_PROPERTY( qan::EdgeItem* item READ getItem CONSTANT )
     qan::EdgeItem*   getItem() noexcept;
     void             setItem(qan::EdgeItem* edgeItem) noexcept;
+    //! Detach edge item from this edge (item is no longer destroyed with edge), return detached item.
+    qan::EdgeItem*   releaseItem() noexcept;
 private:
     QPointer<qan::EdgeItem> _item;
     //@}
@@ -102,6 +104,8 @@ public:
 public:
     Q_INVOKABLE qan::Node* getSource() noexcept;
     Q_INVOKABLE qan::Node* getDestination() noexcept;
+    //! Return this edge destination edge when edge is an hyper edge, nullptr otherwise (see qan::Graph::insertHyperEdge()).
+    Q_INVOKABLE qan::Edge* getHDestination() noexcept;
     //@}
     //-------------------------------------------------------------------------
 
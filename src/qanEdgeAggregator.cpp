@@ -0,0 +1,353 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeAggregator.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::min std::max std::swap
+#include <cmath>        // std::sqrt
+#include <map>
+#include <unordered_map>
+
+// Qt headers
+#include <QTimer>
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanEdgeAggregator.h"
+#include "./qanEdgeItem.h"
+#include "./qanEdge.h"
+#include "./qanGroup.h"
+#include "./qanGroupItem.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* EdgeAggregator Object Management *///---------------------------------------
+EdgeAggregator::EdgeAggregator(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+EdgeAggregator::~EdgeAggregator()
+{
+    restoreEdgeItems();
+}
+
+void    EdgeAggregator::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph) {
+        disconnect(_graph, nullptr, this, nullptr);
+        restoreEdgeItems();
+    }
+    _graph = graph;
+    if (_graph) {
+        connect(_graph, &qan::Graph::groupCollapsed,    this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::edgeInserted,      this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodeRemoved,       this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodeMoved,         this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodesMoved,        this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodeResized,       this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::groupResized,      this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodeGrouped,       this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::nodeUngrouped,     this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::updateEnded,       this, &EdgeAggregator::invalidate);
+        connect(_graph, &qan::Graph::viewportRectChanged,   this, [this]() {
+            if (_graph && _graph->getVirtualized())     // Edge items are created and released with viewport
+                invalidate();
+        });
+    }
+    invalidate();
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Aggregation Settings *///---------------------------------------------------
+void    EdgeAggregator::setAggregationEnabled(bool aggregationEnabled) noexcept
+{
+    if (aggregationEnabled != _aggregationEnabled) {
+        _aggregationEnabled = aggregationEnabled;
+        generateProxies();
+        emit aggregationEnabledChanged();
+    }
+}
+
+void    EdgeAggregator::setLineWidth(qreal lineWidth) noexcept
+{
+    if (!qFuzzyCompare(1. + lineWidth, 1. + _lineWidth)) {
+        _lineWidth = lineWidth;
+        _geometryDirty = true;
+        update();
+        emit lineWidthChanged();
+    }
+}
+
+void    EdgeAggregator::setMaximumLineWidth(qreal maximumLineWidth) noexcept
+{
+    if (!qFuzzyCompare(1. + maximumLineWidth, 1. + _maximumLineWidth)) {
+        _maximumLineWidth = maximumLineWidth;
+        _geometryDirty = true;
+        update();
+        emit maximumLineWidthChanged();
+    }
+}
+
+void    EdgeAggregator::setColor(QColor color) noexcept
+{
+    if (color != _color) {
+        _color = color;
+        _geometryDirty = true;
+        update();
+        emit colorChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Edge Aggregation *///-------------------------------------------------------
+QVariantList    EdgeAggregator::getProxyEdges() const
+{
+    QVariantList proxies;
+    proxies.reserve(static_cast<int>(_proxies.size()));
+    for (const auto& proxy : _proxies) {
+        if (!proxy.a || !proxy.b)
+            continue;
+        proxies.append(QVariantMap{ { QStringLiteral("source"),         QVariant::fromValue<QObject*>(proxy.a.data()) },
+                                    { QStringLiteral("destination"),    QVariant::fromValue<QObject*>(proxy.b.data()) },
+                                    { QStringLiteral("multiplicity"),   proxy.multiplicity },
+                                    { QStringLiteral("p1"),             proxy.p1 },
+                                    { QStringLiteral("p2"),             proxy.p2 } });
+    }
+    return proxies;
+}
+
+int     EdgeAggregator::getMultiplicity(const qan::Node* a, const qan::Node* b) const noexcept
+{
+    if (a == nullptr || b == nullptr)
+        return 0;
+    if (b < a)
+        std::swap(a, b);
+    for (const auto& proxy : _proxies)
+        if (proxy.a.data() == a &&
+            proxy.b.data() == b)
+            return proxy.multiplicity;
+    return 0;
+}
+
+void    EdgeAggregator::invalidate() noexcept
+{
+    if (_generatePending)       // Merge multiple invalidations in a single generation
+        return;
+    _generatePending = true;
+    QTimer::singleShot(0, this, [this]() { generateProxies(); });
+}
+
+void    EdgeAggregator::generateProxies() noexcept
+{
+    // Algorithm:
+        // 1. Restore previously hidden edges, fast exit if there is no collapsed group.
+        // 2. Map every edge ends to their visible end: the outermost collapsed group containing the node, or the node.
+        // 3. Aggregate edges with at least one hidden end by visible ends pair, hide their edge items (edges
+        //    internal to a collapsed group are hidden without a proxy).
+        // 4. Generate proxies ends from visible ends bounding rects in graph container CS.
+    _generatePending = false;
+    restoreEdgeItems();                                 // 1.
+    const bool hadProxies = !_proxies.empty();
+    _proxies.clear();
+    _aggregatedCount = 0;
+    _geometryDirty = true;
+    update();
+
+    const auto graph = _graph.data();
+    const auto container = graph != nullptr ? graph->getContainerItem() : nullptr;
+    const auto isCollapsed = [](const qan::Group* group) -> bool {
+        return group != nullptr &&
+               group->getGroupItem() != nullptr &&
+               group->getGroupItem()->getCollapsed();
+    };
+    bool hasCollapsedGroup = false;
+    if (_aggregationEnabled &&
+        graph != nullptr &&
+        container != nullptr) {
+        for (const auto& weakGroup : graph->get_groups()) {
+            if (isCollapsed(qobject_cast<const qan::Group*>(weakGroup.lock().get()))) {
+                hasCollapsedGroup = true;
+                break;
+            }
+        }
+    }
+    if (!hasCollapsedGroup) {
+        if (hadProxies)
+            emit proxiesChanged();
+        return;
+    }
+
+    std::unordered_map<qan::Node*, qan::Node*> visibleEnds;   // 2.
+    const auto visibleEnd = [&visibleEnds, &isCollapsed](qan::Node* node) -> qan::Node* {
+        const auto found = visibleEnds.find(node);
+        if (found != visibleEnds.end())
+            return found->second;
+        qan::Node* end = node;
+        auto group = qobject_cast<qan::Group*>(node->get_group().lock().get());
+        while (group != nullptr) {
+            if (isCollapsed(group))
+                end = group;
+            group = qobject_cast<qan::Group*>(group->get_group().lock().get());
+        }
+        visibleEnds.emplace(node, end);
+        return end;
+    };
+
+    const auto hide = [this](qan::EdgeItem* edgeItem) {
+        if (edgeItem == nullptr ||
+            !edgeItem->isVisible())     // Edges hidden by user or by group collapse are left untouched
+            return;
+        edgeItem->setVisible(false);
+        _hiddenEdgeItems.push_back(edgeItem);
+    };
+    std::map<std::pair<qan::Node*, qan::Node*>, int>    aggregates;
+    for (const auto& edge : graph->get_edges()) {       // 3.
+        if (!edge)
+            continue;
+        const auto src = edge->get_src().lock();
+        const auto dst = edge->get_dst().lock();
+        if (!src || !dst)
+            continue;
+        auto a = visibleEnd(src.get());
+        auto b = visibleEnd(dst.get());
+        if (a == src.get() &&
+            b == dst.get())
+            continue;                   // Both ends are visible, edge is not aggregated
+        hide(edge->getItem());
+        if (a == b)
+            continue;                   // Edge is internal to a collapsed group
+        if (b < a)                      // Proxies are not oriented
+            std::swap(a, b);
+        ++aggregates[std::make_pair(a, b)];
+        ++_aggregatedCount;
+    }
+
+    const auto containerRect = [container](const qan::Node* node) -> QRectF {
+        const auto item = node->getItem();
+        return item != nullptr ? item->mapRectToItem(container, QRectF{0., 0., item->width(), item->height()}) :
+                                 QRectF{};
+    };
+    const auto clip = [](const QPointF& c, const QPointF& target, const QRectF& br) -> QPointF {
+        const QPointF d = target - c;   // Exit point of segment (c, target) from br (centered on c)
+        const qreal tx = std::abs(d.x()) > 0.00001 ? ( br.width() / 2. ) / std::abs(d.x()) : 1.;
+        const qreal ty = std::abs(d.y()) > 0.00001 ? ( br.height() / 2. ) / std::abs(d.y()) : 1.;
+        const qreal t = std::min(tx, ty);
+        return t < 1. ? c + d * t : c;
+    };
+    _proxies.reserve(aggregates.size());
+    for (const auto& aggregate : aggregates) {          // 4.
+        Proxy proxy;
+        proxy.a = aggregate.first.first;
+        proxy.b = aggregate.first.second;
+        proxy.multiplicity = aggregate.second;
+        const auto aBr = containerRect(aggregate.first.first);
+        const auto bBr = containerRect(aggregate.first.second);
+        if (!aBr.isEmpty() &&           // Proxies with a virtualized end are not rendered
+            !bBr.isEmpty()) {
+            proxy.p1 = clip(aBr.center(), bBr.center(), aBr);
+            proxy.p2 = clip(bBr.center(), aBr.center(), bBr);
+        }
+        _proxies.push_back(proxy);
+    }
+    emit proxiesChanged();
+}
+
+void    EdgeAggregator::restoreEdgeItems() noexcept
+{
+    for (const auto& edgeItem : _hiddenEdgeItems)
+        if (edgeItem)
+            edgeItem->setVisible(true);
+    _hiddenEdgeItems.clear();
+}
+
+QSGNode*    EdgeAggregator::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_proxies.empty()) {
+        delete node;
+        _geometryDirty = false;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGFlatColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        _geometryDirty = true;
+    }
+    if (!_geometryDirty)
+        return node;
+    _geometryDirty = false;
+
+    static_cast<QSGFlatColorMaterial*>(node->material())->setColor(_color);
+    node->markDirty(QSGNode::DirtyMaterial);
+
+    const auto container = _graph ? _graph->getContainerItem() : nullptr;
+    const auto offset = container != nullptr ? container->mapToItem(this, QPointF{0., 0.}) : QPointF{0., 0.};
+    auto geometry = node->geometry();
+    geometry->allocate(static_cast<int>(_proxies.size() * 6));
+    auto v = geometry->vertexDataAsPoint2D();
+    const auto push = [&v, &offset](const QPointF& p) {
+        v->set(static_cast<float>(p.x() + offset.x()), static_cast<float>(p.y() + offset.y()));
+        ++v;
+    };
+    for (const auto& proxy : _proxies) {    // Note: unrendered proxies generate degenerated triangles
+        const auto width = std::min(_maximumLineWidth, _lineWidth * std::sqrt(static_cast<qreal>(proxy.multiplicity)));
+        const QLineF line{proxy.p1, proxy.p2};
+        QPointF n{0., 0.};
+        if (line.length() > 0.00001) {
+            const auto normal = line.normalVector().unitVector();
+            n = QPointF{normal.dx() * width / 2., normal.dy() * width / 2.};
+        }
+        push(proxy.p1 + n); push(proxy.p1 - n); push(proxy.p2 + n);
+        push(proxy.p2 + n); push(proxy.p1 - n); push(proxy.p2 - n);
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,201 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeAggregator.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+#include <QVariantList>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class EdgeItem;
+
+/*! \brief Aggregate edges crossing collapsed groups boundaries in one proxy edge per external neighbour.
+ *
+ * When a group is collapsed, every edge with one end hidden inside the group is mapped to its nearest visible
+ * end (the outermost collapsed group containing it). All edges mapped to the same pair of visible nodes are
+ * replaced by a single proxy edge carrying their \c multiplicity, rendered in one scene graph geometry node (with
+ * width growing with multiplicity). Edge items of aggregated edges are hidden, and restored when groups are expanded.
+ *
+ * Aggregator must be a child of graph container item (at origin):
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   graph: Qan.Graph { id: graph }
+ *   Qan.EdgeAggregator {
+ *     parent: graphView.containerItem
+ *     graph: graph
+ *   }
+ * }
+ * \endcode
+ *
+ * Proxy edges could be queried with getProxyEdges() (for example to display multiplicity labels in QML).
+ *
+ * \note Proxies are regenerated when a group is collapsed or expanded, when graph topology change, or when a node
+ * or group is moved, resized, grouped or ungrouped, call invalidate() to force an update.
+ * \nosubgrouping
+ */
+class EdgeAggregator : public QQuickItem
+{
+    /*! \name EdgeAggregator Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit EdgeAggregator(QQuickItem* parent = nullptr);
+    virtual ~EdgeAggregator() override;
+    EdgeAggregator(const EdgeAggregator&) = delete;
+
+public:
+    //! Graph whose collapsed groups edges are aggregated.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Aggregation Settings *///----------------------------------------
+    //@{
+public:
+    //! Enable or disable aggregation (default to true).
+    Q_PROPERTY(bool aggregationEnabled READ getAggregationEnabled WRITE setAggregationEnabled NOTIFY aggregationEnabledChanged FINAL)
+    //! \copydoc aggregationEnabled
+    inline bool         getAggregationEnabled() const noexcept { return _aggregationEnabled; }
+    //! \copydoc aggregationEnabled
+    void                setAggregationEnabled(bool aggregationEnabled) noexcept;
+private:
+    bool                _aggregationEnabled = true;
+signals:
+    void                aggregationEnabledChanged();
+
+public:
+    //! Proxy edge width for a multiplicity of 1, width grow with sqrt(multiplicity) (default to 2.0).
+    Q_PROPERTY(qreal lineWidth READ getLineWidth WRITE setLineWidth NOTIFY lineWidthChanged FINAL)
+    //! \copydoc lineWidth
+    inline qreal        getLineWidth() const noexcept { return _lineWidth; }
+    //! \copydoc lineWidth
+    void                setLineWidth(qreal lineWidth) noexcept;
+private:
+    qreal               _lineWidth = 2.;
+signals:
+    void                lineWidthChanged();
+
+public:
+    //! Maximum proxy edge width (default to 20.0).
+    Q_PROPERTY(qreal maximumLineWidth READ getMaximumLineWidth WRITE setMaximumLineWidth NOTIFY maximumLineWidthChanged FINAL)
+    //! \copydoc maximumLineWidth
+    inline qreal        getMaximumLineWidth() const noexcept { return _maximumLineWidth; }
+    //! \copydoc maximumLineWidth
+    void                setMaximumLineWidth(qreal maximumLineWidth) noexcept;
+private:
+    qreal               _maximumLineWidth = 20.;
+signals:
+    void                maximumLineWidthChanged();
+
+public:
+    //! Proxy edges color (default to semi transparent black).
+    Q_PROPERTY(QColor color READ getColor WRITE setColor NOTIFY colorChanged FINAL)
+    //! \copydoc color
+    inline QColor       getColor() const noexcept { return _color; }
+    //! \copydoc color
+    void                setColor(QColor color) noexcept;
+private:
+    QColor              _color{0, 0, 0, 160};
+signals:
+    void                colorChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Aggregation *///--------------------------------------------
+    //@{
+public:
+    //! Number of proxy edges (read-only).
+    Q_PROPERTY(int proxyCount READ getProxyCount NOTIFY proxiesChanged FINAL)
+    //! \copydoc proxyCount
+    inline int          getProxyCount() const noexcept { return static_cast<int>(_proxies.size()); }
+    //! Number of graph edges replaced by proxy edges (read-only).
+    Q_PROPERTY(int aggregatedCount READ getAggregatedCount NOTIFY proxiesChanged FINAL)
+    //! \copydoc aggregatedCount
+    inline int          getAggregatedCount() const noexcept { return _aggregatedCount; }
+signals:
+    void                proxiesChanged();
+
+public:
+    /*! \brief Return proxy edges as a list of maps with \c source, \c destination (visible qan::Node or qan::Group),
+     * \c multiplicity, \c p1 and \c p2 (proxy ends in graph container CS) keys.
+     */
+    Q_INVOKABLE QVariantList    getProxyEdges() const;
+    //! Return the number of edges aggregated between visible nodes \c a and \c b (in both directions), 0 if no proxy exists.
+    Q_INVOKABLE int     getMultiplicity(const qan::Node* a, const qan::Node* b) const noexcept;
+
+    //! Force proxies regeneration (regeneration is deferred and merged with other invalidations).
+    Q_INVOKABLE void    invalidate() noexcept;
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+private:
+    //! Generate proxies and hide aggregated edge items.
+    void                generateProxies() noexcept;
+    //! Restore previously hidden edge items visibility.
+    void                restoreEdgeItems() noexcept;
+    //! Proxy edge between two visible nodes (\c a < \c b), ends in graph container CS.
+    struct Proxy {
+        QPointer<qan::Node> a, b;
+        QPointF             p1, p2;
+        int                 multiplicity = 0;
+    };
+    std::vector<Proxy>                      _proxies;
+    std::vector<QPointer<qan::EdgeItem>>    _hiddenEdgeItems;
+    int                 _aggregatedCount = 0;
+    bool                _generatePending = false;
+    bool                _geometryDirty = true;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeAggregator)
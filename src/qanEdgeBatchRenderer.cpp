@@ -0,0 +1,352 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max
+
+// Qt headers
+#include <QTimer>
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanEdgeItem.h"
+#include "./qanEdge.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* EdgeBatchRenderer Object Management *///-----------------------------------
+EdgeBatchRenderer::EdgeBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+void    EdgeBatchRenderer::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph) {
+        disconnect(_graph, nullptr, this, nullptr);
+        disconnect(_graph->getStyleManager(), nullptr, this, nullptr);
+    }
+    _graph = graph;
+    if (_graph) {
+        connect(_graph->getStyleManager(), &qan::StyleManager::styleTableModified,
+                this, &EdgeBatchRenderer::styleTableModified);
+        connect(_graph, &qan::Graph::edgeInserted,          this, &EdgeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeRemoved,           this, &EdgeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::updateEnded,           this, &EdgeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::viewportRectChanged,   this, [this]() {
+            if (_graph && _graph->getVirtualized())     // Edge items are created and released with viewport
+                invalidate();
+        });
+    }
+    invalidate();
+    emit graphChanged();
+}
+
+void    EdgeBatchRenderer::setCurveSegments(int curveSegments) noexcept
+{
+    curveSegments = std::max(2, curveSegments);
+    if (curveSegments != _curveSegments) {
+        _curveSegments = curveSegments;
+        invalidate();
+        emit curveSegmentsChanged();
+    }
+}
+
+void    EdgeBatchRenderer::invalidate() noexcept
+{
+    if (_collectPending)    // Merge multiple invalidations in a single collection
+        return;
+    _collectPending = true;
+    QTimer::singleShot(0, this, [this]() { collectEdgeItems(); });
+}
+//-----------------------------------------------------------------------------
+
+/* Batch Rendering *///--------------------------------------------------------
+void    EdgeBatchRenderer::collectEdgeItems() noexcept
+{
+    _collectPending = false;
+    for (const auto& group : _groups)
+        for (const auto& edge : group.edges)
+            if (edge.item)
+                disconnect(edge.item, nullptr, this, nullptr);
+    _groups.clear();
+    _styleGroups.clear();
+    _edgeRanges.clear();
+    _dirtyEdges.clear();
+    _vertexCount = 0;
+    _rebuild = true;
+    if (_graph) {
+        const auto styleManager = _graph->getStyleManager();
+        for (const auto& edge : _graph->get_edges()) {
+            const auto edgeItem = edge ? edge->getItem() : nullptr;
+            if (edgeItem == nullptr)
+                continue;
+            const auto styleIndex = styleManager->getStyleIndex(edgeItem->getStyle());
+            auto styleGroup = _styleGroups.find(styleIndex);
+            if (styleGroup == _styleGroups.end()) {
+                styleGroup = _styleGroups.emplace(styleIndex, _groups.size()).first;
+                _groups.emplace_back();
+                _groups.back().styleIndex = styleIndex;
+            }
+            auto& group = _groups[styleGroup->second];
+            const auto count = vertexCount(*edgeItem);
+            _edgeRanges.emplace(edgeItem, std::make_pair(styleGroup->second, group.edges.size()));
+            group.edges.push_back(EdgeRange{edgeItem, _vertexCount, count});
+            _vertexCount += count;
+
+            // Geometry modifications are notified by edge items once they have been updated
+            const auto modified = [this, edgeItem]() { edgeItemModified(edgeItem); };
+            connect(edgeItem, &qan::EdgeItem::lineGeometryChanged,      this, modified);
+            connect(edgeItem, &qan::EdgeItem::controlPointsChanged,     this, modified);
+            connect(edgeItem, &qan::EdgeItem::srcArrowGeometryChanged,  this, modified);
+            connect(edgeItem, &qan::EdgeItem::dstArrowGeometryChanged,  this, modified);
+            connect(edgeItem, &qan::EdgeItem::hiddenChanged,            this, modified);
+            connect(edgeItem, &QQuickItem::xChanged,                    this, modified);
+            connect(edgeItem, &QQuickItem::yChanged,                    this, modified);
+            connect(edgeItem, &QQuickItem::visibleChanged,              this, modified);
+            connect(edgeItem, &qan::EdgeItem::srcShapeChanged,          this, &EdgeBatchRenderer::invalidate);
+            connect(edgeItem, &qan::EdgeItem::dstShapeChanged,          this, &EdgeBatchRenderer::invalidate);
+            connect(edgeItem, &qan::EdgeItem::styleChanged,             this, &EdgeBatchRenderer::invalidate);
+            connect(edgeItem, &qan::EdgeItem::fanChanged,               this, &EdgeBatchRenderer::invalidate);   // Line type might change
+            connect(edgeItem, &QObject::destroyed,                      this, &EdgeBatchRenderer::invalidate);
+        }
+    }
+    update();
+}
+
+void    EdgeBatchRenderer::edgeItemModified(const qan::EdgeItem* edgeItem) noexcept
+{
+    if (_rebuild)
+        return;         // Everything will be tessellated anyway
+    const auto edgeRange = _edgeRanges.find(edgeItem);
+    if (edgeRange == _edgeRanges.end())
+        return;
+    const auto& range = _groups[edgeRange->second.first].edges[edgeRange->second.second];
+    if (!range.item)
+        return;
+    if (vertexCount(*range.item) != range.count)
+        invalidate();   // Line type modified, geometry layout must be rebuilt
+    else
+        _dirtyEdges.push_back(edgeItem);
+    update();
+}
+
+void    EdgeBatchRenderer::styleTableModified(int index) noexcept
+{
+    if (index < 0) {    // Style table cleared, indexes are no longer valid
+        invalidate();
+        return;
+    }
+    if (_rebuild)
+        return;
+    const auto styleGroup = _styleGroups.find(index);
+    if (styleGroup == _styleGroups.end())
+        return;         // Style is not used by any edge (or edges not collected yet)
+    // Colors and line width are baked in vertices, patch only this style edges
+    for (const auto& edge : _groups[styleGroup->second].edges)
+        if (edge.item)
+            _dirtyEdges.push_back(edge.item.data());
+    update();
+}
+
+int     EdgeBatchRenderer::vertexCount(const qan::EdgeItem& edgeItem) const noexcept
+{
+    const auto style = edgeItem.getStyle();
+    auto lineType = style != nullptr ? style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    if (!qFuzzyIsNull(edgeItem.getFanOffset()))     // Fanned parallel edges are drawn as curves
+        lineType = qan::EdgeStyle::LineType::Curved;
+    int segments = 1;
+    switch (lineType) {
+    case qan::EdgeStyle::LineType::Straight: segments = 1;              break;
+    case qan::EdgeStyle::LineType::Ortho:    segments = 2;              break;     // p1 -> c1 -> p2
+    case qan::EdgeStyle::LineType::Curved:   segments = _curveSegments; break;
+    case qan::EdgeStyle::LineType::Custom:   segments = std::max(1, static_cast<int>(edgeItem.getOrthoPolyline().size()) - 1); break;
+    }
+    const auto isArrow = [](qan::EdgeStyle::ArrowShape shape) {
+        return shape == qan::EdgeStyle::ArrowShape::Arrow ||
+               shape == qan::EdgeStyle::ArrowShape::ArrowOpen;
+    };
+    return segments * 6 +
+           ( isArrow(edgeItem.getSrcShape()) ? 3 : 0 ) +
+           ( isArrow(edgeItem.getDstShape()) ? 3 : 0 );
+}
+
+void    EdgeBatchRenderer::tessellate(const qan::EdgeItem& edgeItem, const qan::StyleManager::StyleEntry* entry,
+                                          QSGGeometry::ColoredPoint2D* vertices) const noexcept
+{
+    const auto count = vertexCount(edgeItem);
+    if (!edgeItem.isVisible() ||        // Keep the edge range with degenerated triangles
+        edgeItem.getHidden()) {
+        for (int v = 0; v < count; ++v)
+            vertices[v].set(0.f, 0.f, 0, 0, 0, 0);
+        return;
+    }
+    const auto style = edgeItem.getStyle();
+    auto lineType = style != nullptr ? style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    if (!qFuzzyIsNull(edgeItem.getFanOffset()))     // Fanned parallel edges are drawn as curves
+        lineType = qan::EdgeStyle::LineType::Curved;
+    // Edges with no style are drawn opaque black with a 1. line width
+    const auto halfWidth = ( entry != nullptr ? std::max(0.5, static_cast<qreal>(entry->strokeWidth)) : 1. ) / 2.;
+    const auto color = entry != nullptr ? entry->strokeColor : qan::StyleManager::StyleEntry::Rgba{0, 0, 0, 255};
+    const auto offset = edgeItem.mapToItem(this, QPointF{0., 0.});
+    auto v = vertices;
+    const auto push = [&v, &offset, &color](const QPointF& p) {
+        v->set(static_cast<float>(p.x() + offset.x()), static_cast<float>(p.y() + offset.y()),
+               color.r, color.g, color.b, color.a);
+        ++v;
+    };
+    const auto segment = [&push, halfWidth](const QPointF& a, const QPointF& b) {
+        const QLineF line{a, b};
+        QPointF n{0., 0.};
+        if (line.length() > 0.00001) {
+            const auto normal = line.normalVector().unitVector();
+            n = QPointF{normal.dx() * halfWidth, normal.dy() * halfWidth};
+        }
+        push(a + n); push(a - n); push(b + n);
+        push(b + n); push(a - n); push(b - n);
+    };
+    const auto& p1 = edgeItem.getP1();
+    const auto& p2 = edgeItem.getP2();
+    switch (lineType) {
+    case qan::EdgeStyle::LineType::Straight:
+        segment(p1, p2);
+        break;
+    case qan::EdgeStyle::LineType::Ortho:
+        segment(p1, edgeItem.getC1());
+        segment(edgeItem.getC1(), p2);
+        break;
+    case qan::EdgeStyle::LineType::Curved: {
+        const auto& c1 = edgeItem.getC1();
+        const auto& c2 = edgeItem.getC2();
+        const auto cubic = [&](qreal t) {
+            const auto u = 1. - t;
+            return p1 * (u * u * u) + c1 * (3. * u * u * t) + c2 * (3. * u * t * t) + p2 * (t * t * t);
+        };
+        auto previous = p1;
+        for (int s = 1; s <= _curveSegments; ++s) {
+            const auto current = cubic(static_cast<qreal>(s) / _curveSegments);
+            segment(previous, current);
+            previous = current;
+        }
+    }
+        break;
+    case qan::EdgeStyle::LineType::Custom: {     // Custom shape polyline
+        const auto& polyline = edgeItem.getOrthoPolyline();
+        if (polyline.size() < 2)
+            segment(p1, p2);
+        for (int p = 1; p < polyline.size(); ++p)
+            segment(polyline[p - 1], polyline[p]);
+    }
+        break;
+    }
+    const auto isArrow = [](qan::EdgeStyle::ArrowShape shape) {
+        return shape == qan::EdgeStyle::ArrowShape::Arrow ||
+               shape == qan::EdgeStyle::ArrowShape::ArrowOpen;
+    };
+    if (isArrow(edgeItem.getSrcShape())) {
+        push(edgeItem.getSrcA1()); push(edgeItem.getSrcA2()); push(edgeItem.getSrcA3());
+    }
+    if (isArrow(edgeItem.getDstShape())) {
+        push(edgeItem.getDstA1()); push(edgeItem.getDstA2()); push(edgeItem.getDstA3());
+    }
+}
+
+QSGNode*    EdgeBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    // Note: GUI thread is blocked while updatePaintNode() is called, edge items and style table can be safely read.
+    const auto styleManager = _graph ? _graph->getStyleManager() : nullptr;
+    const auto styleEntry = [styleManager](int styleIndex) {
+        return styleManager != nullptr ? styleManager->getStyleEntry(styleIndex) : nullptr;
+    };
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_rebuild) {
+        _rebuild = false;
+        _dirtyEdges.clear();
+        if (_vertexCount <= 0) {
+            delete node;
+            return nullptr;
+        }
+        if (node == nullptr) {
+            node = new QSGGeometryNode{};
+            auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), _vertexCount};
+            geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+            geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+            node->setGeometry(geometry);
+            node->setFlag(QSGNode::OwnsGeometry);
+            node->setMaterial(new QSGVertexColorMaterial{});
+            node->setFlag(QSGNode::OwnsMaterial);
+        } else if (node->geometry()->vertexCount() != _vertexCount)
+            node->geometry()->allocate(_vertexCount);
+        const auto vertices = node->geometry()->vertexDataAsColoredPoint2D();
+        for (const auto& group : _groups) {
+            const auto entry = styleEntry(group.styleIndex);
+            for (const auto& edge : group.edges)
+                if (edge.item)
+                    tessellate(*edge.item, entry, vertices + edge.first);
+        }
+        node->markDirty(QSGNode::DirtyGeometry);
+        return node;
+    }
+    // Rewrite only dirty edges vertex ranges (modified geometry or modified style table entry)
+    if (node == nullptr ||
+        _dirtyEdges.empty()) {
+        _dirtyEdges.clear();
+        return node;
+    }
+    const auto vertices = node->geometry()->vertexDataAsColoredPoint2D();
+    for (const auto dirtyEdge : _dirtyEdges) {
+        const auto edgeRange = _edgeRanges.find(dirtyEdge);
+        if (edgeRange == _edgeRanges.end())
+            continue;
+        const auto& group = _groups[edgeRange->second.first];
+        const auto& range = group.edges[edgeRange->second.second];
+        if (range.item)
+            tessellate(*range.item, styleEntry(group.styleIndex), vertices + range.first);
+    }
+    _dirtyEdges.clear();
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,171 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+#include "./qanStyleManager.h"
+
+QT_BEGIN_NAMESPACE
+class QSGGeometryNode;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+class Graph;
+class EdgeItem;
+
+/*! \brief Draw all graph edges lines and arrows in a single scene graph geometry node.
+ *
+ * Each qan::EdgeItem default visual (Edge.qml / EdgeTemplate.qml) is a Shape with its own scene graph subtree, usually
+ * resulting in one draw call per edge. EdgeBatchRenderer read edge items geometry (p1, p2, c1, c2 and arrows points)
+ * and tessellate straight, ortho and curved lines and arrows into a single vertex colored triangle buffer. Edges
+ * color and line width are read from graph qan::StyleManager style table, rendering all edges in one draw call
+ * whatever their style. When an edge geometry change, only its own vertex range is rewritten, when a style is
+ * modified, only vertex ranges of edges using that style are patched.
+ *
+ * Renderer must be a child of graph container item (at origin), and edges delegate should be a lightweight item with
+ * no visual content (edge items still manage geometry, selection and mouse events):
+ * \code
+ * Qan.GraphView {
+ *   graph: Qan.Graph {
+ *     id: graph
+ *     edgeDelegate: Component { Qan.EdgeItem { } }
+ *   }
+ *   Qan.EdgeBatchRenderer {
+ *     parent: graphView.containerItem
+ *     graph: graph
+ *   }
+ * }
+ * \endcode
+ *
+ * \note Filled and open arrows are both rendered as filled triangles, circle and rect end shapes are not rendered,
+ * dash patterns are ignored.
+ * \nosubgrouping
+ */
+class EdgeBatchRenderer : public QQuickItem
+{
+    /*! \name EdgeBatchRenderer Object Management *///-------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit EdgeBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~EdgeBatchRenderer() override = default;
+    EdgeBatchRenderer(const EdgeBatchRenderer&) = delete;
+
+public:
+    //! Graph whose edges are rendered.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+
+public:
+    //! Number of line segments used to tessellate a curved edge (default to 16, minimum 2).
+    Q_PROPERTY(int curveSegments READ getCurveSegments WRITE setCurveSegments NOTIFY curveSegmentsChanged FINAL)
+    //! \copydoc curveSegments
+    inline int          getCurveSegments() const noexcept { return _curveSegments; }
+    //! \copydoc curveSegments
+    void                setCurveSegments(int curveSegments) noexcept;
+private:
+    int                 _curveSegments = 16;
+signals:
+    void                curveSegmentsChanged();
+
+public:
+    //! Force a complete rebuild of edges geometry (geometry is rebuilt automatically when edges are inserted or removed).
+    Q_INVOKABLE void    invalidate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batch Rendering *///---------------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Collect graph edge items and track their geometry modifications.
+    void                collectEdgeItems() noexcept;
+    //! Mark \c edgeItem vertex range dirty.
+    void                edgeItemModified(const qan::EdgeItem* edgeItem) noexcept;
+    //! Mark vertex ranges of edges using style table entry \c index dirty (-1 to rebuild all edges).
+    void                styleTableModified(int index) noexcept;
+    //! Return the number of vertices needed to tessellate \c edgeItem.
+    int                 vertexCount(const qan::EdgeItem& edgeItem) const noexcept;
+    //! Tessellate \c edgeItem in \c vertices (\c vertices must have vertexCount() vertices) with \c entry style data.
+    void                tessellate(const qan::EdgeItem& edgeItem, const qan::StyleManager::StyleEntry* entry,
+                                   QSGGeometry::ColoredPoint2D* vertices) const noexcept;
+
+    //! Vertex range of an edge in renderer geometry.
+    struct EdgeRange {
+        QPointer<qan::EdgeItem> item;
+        int                     first = 0;
+        int                     count = 0;
+    };
+    //! All edges sharing a style table entry (patched together when their style is modified).
+    struct StyleGroup {
+        int                     styleIndex = -1;
+        std::vector<EdgeRange>  edges;
+    };
+    std::vector<StyleGroup>         _groups;
+    //! Style table index to style group index.
+    std::unordered_map<int, std::size_t>    _styleGroups;
+    //! Edge item to {style group index, edge range index}.
+    std::unordered_map<const qan::EdgeItem*, std::pair<std::size_t, std::size_t>>   _edgeRanges;
+    std::vector<const qan::EdgeItem*>   _dirtyEdges;
+    int                             _vertexCount = 0;
+    bool                            _rebuild = true;
+    bool                            _collectPending = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeBatchRenderer)
@@ -0,0 +1,397 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBundler.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::min std::max
+#include <cmath>        // std::sqrt std::floor
+#include <map>
+#include <tuple>
+
+// Qt headers
+#include <QTimer>
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+#include <QLineF>
+
+// QuickQanava headers
+#include "./qanEdgeBundler.h"
+#include "./qanNavigable.h"
+#include "./qanEdgeItem.h"
+#include "./qanEdge.h"
+#include "./qanGroup.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* EdgeBundler Object Management *///-----------------------------------------
+EdgeBundler::EdgeBundler(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+EdgeBundler::~EdgeBundler()
+{
+    restoreEdgeItems();
+}
+
+void    EdgeBundler::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph) {
+        disconnect(_graph, nullptr, this, nullptr);
+        restoreEdgeItems();
+    }
+    _graph = graph;
+    if (_graph) {
+        connect(_graph, &qan::Graph::edgeInserted,      this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::nodeRemoved,       this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::nodeMoved,         this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::nodeResized,       this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::groupResized,      this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::nodeGrouped,       this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::nodeUngrouped,     this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::updateEnded,       this, &EdgeBundler::invalidate);
+        connect(_graph, &qan::Graph::viewportRectChanged,   this, [this]() {
+            if (_graph && _graph->getVirtualized())     // Edge items are created and released with viewport
+                invalidate();
+        });
+    }
+    invalidate();
+    emit graphChanged();
+}
+
+void    EdgeBundler::setNavigable(qan::Navigable* navigable) noexcept
+{
+    if (navigable == _navigable)
+        return;
+    if (_navigable)
+        disconnect(_navigable, nullptr, this, nullptr);
+    _navigable = navigable;
+    if (_navigable)
+        connect(_navigable, &qan::Navigable::zoomChanged,   this, &EdgeBundler::updateBundled);
+    updateBundled();
+    emit navigableChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Bundling Settings *///------------------------------------------------------
+void    EdgeBundler::setBundlingEnabled(bool bundlingEnabled) noexcept
+{
+    if (bundlingEnabled != _bundlingEnabled) {
+        _bundlingEnabled = bundlingEnabled;
+        updateBundled();
+        emit bundlingEnabledChanged();
+    }
+}
+
+void    EdgeBundler::setZoomThreshold(qreal zoomThreshold) noexcept
+{
+    if (!qFuzzyCompare(1. + zoomThreshold, 1. + _zoomThreshold)) {
+        _zoomThreshold = zoomThreshold;
+        updateBundled();
+        emit zoomThresholdChanged();
+    }
+}
+
+void    EdgeBundler::setCellSize(qreal cellSize) noexcept
+{
+    cellSize = std::max(1., cellSize);
+    if (!qFuzzyCompare(1. + cellSize, 1. + _cellSize)) {
+        _cellSize = cellSize;
+        invalidate();
+        emit cellSizeChanged();
+    }
+}
+
+void    EdgeBundler::setMinimumMultiplicity(int minimumMultiplicity) noexcept
+{
+    minimumMultiplicity = std::max(1, minimumMultiplicity);
+    if (minimumMultiplicity != _minimumMultiplicity) {
+        _minimumMultiplicity = minimumMultiplicity;
+        invalidate();
+        emit minimumMultiplicityChanged();
+    }
+}
+
+void    EdgeBundler::setLineWidth(qreal lineWidth) noexcept
+{
+    if (!qFuzzyCompare(1. + lineWidth, 1. + _lineWidth)) {
+        _lineWidth = lineWidth;
+        _geometryDirty = true;
+        update();
+        emit lineWidthChanged();
+    }
+}
+
+void    EdgeBundler::setMaximumLineWidth(qreal maximumLineWidth) noexcept
+{
+    if (!qFuzzyCompare(1. + maximumLineWidth, 1. + _maximumLineWidth)) {
+        _maximumLineWidth = maximumLineWidth;
+        _geometryDirty = true;
+        update();
+        emit maximumLineWidthChanged();
+    }
+}
+
+void    EdgeBundler::setColor(QColor color) noexcept
+{
+    if (color != _color) {
+        _color = color;
+        _geometryDirty = true;
+        update();
+        emit colorChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Edge Bundling *///----------------------------------------------------------
+void    EdgeBundler::invalidate() noexcept
+{
+    if (!_bundled ||            // Bundles are generated when bundling is activated
+        _generatePending)       // Merge multiple invalidations in a single generation
+        return;
+    _generatePending = true;
+    QTimer::singleShot(0, this, [this]() { generateBundles(); });
+}
+
+void    EdgeBundler::updateBundled() noexcept
+{
+    const bool bundled = _bundlingEnabled &&
+                         _graph &&
+                         _navigable &&
+                         _navigable->getZoom() < _zoomThreshold;
+    if (bundled == _bundled)
+        return;
+    _bundled = bundled;
+    if (_bundled)
+        generateBundles();
+    else {
+        restoreEdgeItems();
+        _bundles.clear();
+        _geometryDirty = true;
+        update();
+    }
+    emit bundledChanged();
+}
+
+void    EdgeBundler::generateBundles() noexcept
+{
+    // Algorithm:
+        // 1. Restore previously hidden edges.
+        // 2. Map every edge (src, dst) to a pair of clusters (top level group or ungrouped node cell).
+        // 3. Hide edge items of bundles with enough multiplicity (and every intra cluster edge item).
+        // 4. Generate bundles ends from clusters centers (or group br).
+    _generatePending = false;
+    restoreEdgeItems();                                 // 1.
+    _bundles.clear();
+    _geometryDirty = true;
+    update();
+    if (!_bundled || !_graph)
+        return;
+
+    // Cluster key is a top level group, or a (cx, cy) cell for ungrouped nodes
+    using ClusterKey = std::tuple<const qan::Group*, qint64, qint64>;
+    struct Cluster {
+        QPointF     centerSum;
+        int         count = 0;
+        QRectF      br;                     // Top level group br, empty for cells
+    };
+    std::map<ClusterKey, Cluster>   clusters;
+    const auto topGroup = [](const qan::Node& node) -> const qan::Group* {
+        const qan::Group* group = node.isGroup() ? qobject_cast<const qan::Group*>(&node) : nullptr;
+        auto parent = qobject_cast<const qan::Group*>(node.get_group().lock().get());
+        while (parent != nullptr) {
+            group = parent;
+            parent = qobject_cast<const qan::Group*>(parent->get_group().lock().get());
+        }
+        return group;
+    };
+    const auto clusterOf = [this, &clusters, &topGroup](const qan::Node& node) -> ClusterKey {
+        const auto group = topGroup(node);
+        if (group != nullptr) {
+            const ClusterKey key{group, 0, 0};
+            auto& cluster = clusters[key];
+            if (cluster.count == 0) {
+                cluster.br = group->getGeometry();  // Top level group geometry is in container CS
+                cluster.centerSum = cluster.br.center();
+                cluster.count = 1;
+            }
+            return key;
+        }
+        const auto center = node.getGeometry().center();
+        const ClusterKey key{nullptr,
+                             static_cast<qint64>(std::floor(center.x() / _cellSize)),
+                             static_cast<qint64>(std::floor(center.y() / _cellSize))};
+        auto& cluster = clusters[key];
+        cluster.centerSum += center;
+        ++cluster.count;
+        return key;
+    };
+
+    struct BundleEdges {
+        int                             multiplicity = 0;
+        std::vector<qan::EdgeItem*>     items;
+    };
+    std::map<std::pair<ClusterKey, ClusterKey>, BundleEdges>  bundles;
+    std::vector<qan::EdgeItem*>     intraClusterItems;
+    std::map<const qan::Node*, ClusterKey>  nodeClusters;     // Count every node only once in cells centers
+    const auto nodeCluster = [&nodeClusters, &clusterOf](const qan::Node& node) -> ClusterKey {
+        const auto found = nodeClusters.find(&node);
+        if (found != nodeClusters.end())
+            return found->second;
+        return nodeClusters.emplace(&node, clusterOf(node)).first->second;
+    };
+    for (const auto& edge : _graph->get_edges()) {      // 2.
+        if (!edge)
+            continue;
+        const auto src = edge->get_src().lock();
+        const auto dst = edge->get_dst().lock();
+        if (!src || !dst)
+            continue;
+        const auto edgeItem = edge->getItem();
+        if (edgeItem != nullptr &&
+            !edgeItem->isVisible())     // Do not bundle edges hidden by user or collapsed groups
+            continue;
+        auto srcKey = nodeCluster(*src);
+        auto dstKey = nodeCluster(*dst);
+        if (srcKey == dstKey) {
+            if (edgeItem != nullptr)
+                intraClusterItems.push_back(edgeItem);
+            continue;
+        }
+        if (dstKey < srcKey)            // Bundles are not oriented
+            std::swap(srcKey, dstKey);
+        auto& bundle = bundles[std::make_pair(srcKey, dstKey)];
+        ++bundle.multiplicity;
+        if (edgeItem != nullptr)
+            bundle.items.push_back(edgeItem);
+    }
+
+    const auto hide = [this](qan::EdgeItem* edgeItem) {         // 3.
+        edgeItem->setVisible(false);
+        _hiddenEdgeItems.push_back(edgeItem);
+    };
+    for (const auto edgeItem : intraClusterItems)
+        hide(edgeItem);
+
+    const auto clip = [](const QPointF& c, const QPointF& target, const QRectF& br) -> QPointF {
+        if (br.isEmpty())
+            return c;
+        const QPointF d = target - c;   // Exit point of segment (c, target) from br (centered on c)
+        const qreal tx = std::abs(d.x()) > 0.00001 ? ( br.width() / 2. ) / std::abs(d.x()) : 1.;
+        const qreal ty = std::abs(d.y()) > 0.00001 ? ( br.height() / 2. ) / std::abs(d.y()) : 1.;
+        const qreal t = std::min(tx, ty);
+        return t < 1. ? c + d * t : c;
+    };
+    _bundles.reserve(bundles.size());
+    for (const auto& bundle : bundles) {                // 4.
+        if (bundle.second.multiplicity < _minimumMultiplicity)
+            continue;
+        for (const auto edgeItem : bundle.second.items)
+            hide(edgeItem);
+        const auto& srcCluster = clusters[bundle.first.first];
+        const auto& dstCluster = clusters[bundle.first.second];
+        const QPointF srcCenter = srcCluster.centerSum / srcCluster.count;
+        const QPointF dstCenter = dstCluster.centerSum / dstCluster.count;
+        _bundles.push_back(Bundle{clip(srcCenter, dstCenter, srcCluster.br),
+                                  clip(dstCenter, srcCenter, dstCluster.br),
+                                  bundle.second.multiplicity});
+    }
+    emit bundledChanged();
+}
+
+void    EdgeBundler::restoreEdgeItems() noexcept
+{
+    for (const auto& edgeItem : _hiddenEdgeItems)
+        if (edgeItem)
+            edgeItem->setVisible(true);
+    _hiddenEdgeItems.clear();
+}
+
+QSGNode*    EdgeBundler::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_bundles.empty()) {
+        delete node;
+        _geometryDirty = false;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGFlatColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        _geometryDirty = true;
+    }
+    if (!_geometryDirty)
+        return node;
+    _geometryDirty = false;
+
+    static_cast<QSGFlatColorMaterial*>(node->material())->setColor(_color);
+    node->markDirty(QSGNode::DirtyMaterial);
+
+    const auto container = _graph ? _graph->getContainerItem() : nullptr;
+    const auto offset = container != nullptr ? container->mapToItem(this, QPointF{0., 0.}) : QPointF{0., 0.};
+    auto geometry = node->geometry();
+    geometry->allocate(static_cast<int>(_bundles.size() * 6));
+    auto v = geometry->vertexDataAsPoint2D();
+    const auto push = [&v, &offset](const QPointF& p) {
+        v->set(static_cast<float>(p.x() + offset.x()), static_cast<float>(p.y() + offset.y()));
+        ++v;
+    };
+    for (const auto& bundle : _bundles) {
+        const auto width = std::min(_maximumLineWidth, _lineWidth * std::sqrt(static_cast<qreal>(bundle.multiplicity)));
+        const QLineF line{bundle.p1, bundle.p2};
+        QPointF n{0., 0.};
+        if (line.length() > 0.00001) {
+            const auto normal = line.normalVector().unitVector();
+            n = QPointF{normal.dx() * width / 2., normal.dy() * width / 2.};
+        }
+        push(bundle.p1 + n); push(bundle.p1 - n); push(bundle.p2 + n);
+        push(bundle.p2 + n); push(bundle.p1 - n); push(bundle.p2 - n);
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
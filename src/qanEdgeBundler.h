@@ -0,0 +1,251 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBundler.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+
+QT_BEGIN_NAMESPACE
+class QSGGeometryNode;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+class Graph;
+class EdgeItem;
+class Navigable;
+
+/*! \brief Level of detail edge bundling: render aggregated cluster to cluster edges at low zoom.
+ *
+ * When \c navigable zoom is less than \c zoomThreshold, graph edges are bundled by source and destination cluster:
+ * a node cluster is its top level group, or for ungrouped nodes a square cell of \c cellSize in graph container CS.
+ * Bundles of at least \c minimumMultiplicity edges are rendered as a single line (with width growing with edge
+ * multiplicity) in one scene graph geometry node, bundled edge items being hidden. Edges inside a single cluster
+ * are hidden (not rendered). Individual edges are restored when zoom is greater than \c zoomThreshold.
+ *
+ * Bundler must be a child of graph container item (at origin):
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   graph: Qan.Graph { id: graph }
+ *   Qan.EdgeBundler {
+ *     parent: graphView.containerItem
+ *     graph: graph
+ *     navigable: graphView
+ *     zoomThreshold: 0.4
+ *   }
+ * }
+ * \endcode
+ *
+ * \note Bundles are regenerated when graph topology change, when a node or group is moved, resized, grouped or
+ * ungrouped or when zoom cross threshold, call invalidate() to force an update.
+ * \nosubgrouping
+ */
+class EdgeBundler : public QQuickItem
+{
+    /*! \name EdgeBundler Object Management *///-------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit EdgeBundler(QQuickItem* parent = nullptr);
+    virtual ~EdgeBundler() override;
+    EdgeBundler(const EdgeBundler&) = delete;
+
+public:
+    //! Graph whose edges are bundled.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+
+public:
+    //! Navigable (usually a qan::GraphView) whose zoom drive bundling level of detail.
+    Q_PROPERTY(qan::Navigable* navigable READ getNavigable WRITE setNavigable NOTIFY navigableChanged FINAL)
+    //! \copydoc navigable
+    inline qan::Navigable*  getNavigable() const noexcept { return _navigable.data(); }
+    //! \copydoc navigable
+    void                setNavigable(qan::Navigable* navigable) noexcept;
+private:
+    QPointer<qan::Navigable>    _navigable;
+signals:
+    void                navigableChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Bundling Settings *///-------------------------------------------
+    //@{
+public:
+    //! Enable or disable bundling (default to true).
+    Q_PROPERTY(bool bundlingEnabled READ getBundlingEnabled WRITE setBundlingEnabled NOTIFY bundlingEnabledChanged FINAL)
+    //! \copydoc bundlingEnabled
+    inline bool         getBundlingEnabled() const noexcept { return _bundlingEnabled; }
+    //! \copydoc bundlingEnabled
+    void                setBundlingEnabled(bool bundlingEnabled) noexcept;
+private:
+    bool                _bundlingEnabled = true;
+signals:
+    void                bundlingEnabledChanged();
+
+public:
+    //! Edges are bundled when navigable zoom is less than \c zoomThreshold (default to 0.5).
+    Q_PROPERTY(qreal zoomThreshold READ getZoomThreshold WRITE setZoomThreshold NOTIFY zoomThresholdChanged FINAL)
+    //! \copydoc zoomThreshold
+    inline qreal        getZoomThreshold() const noexcept { return _zoomThreshold; }
+    //! \copydoc zoomThreshold
+    void                setZoomThreshold(qreal zoomThreshold) noexcept;
+private:
+    qreal               _zoomThreshold = 0.5;
+signals:
+    void                zoomThresholdChanged();
+
+public:
+    //! Size of the square cells used to cluster ungrouped nodes, in graph container CS (default to 500.0).
+    Q_PROPERTY(qreal cellSize READ getCellSize WRITE setCellSize NOTIFY cellSizeChanged FINAL)
+    //! \copydoc cellSize
+    inline qreal        getCellSize() const noexcept { return _cellSize; }
+    //! \copydoc cellSize
+    void                setCellSize(qreal cellSize) noexcept;
+private:
+    qreal               _cellSize = 500.;
+signals:
+    void                cellSizeChanged();
+
+public:
+    //! Minimum number of edges between two clusters to render an aggregated edge (default to 2).
+    Q_PROPERTY(int minimumMultiplicity READ getMinimumMultiplicity WRITE setMinimumMultiplicity NOTIFY minimumMultiplicityChanged FINAL)
+    //! \copydoc minimumMultiplicity
+    inline int          getMinimumMultiplicity() const noexcept { return _minimumMultiplicity; }
+    //! \copydoc minimumMultiplicity
+    void                setMinimumMultiplicity(int minimumMultiplicity) noexcept;
+private:
+    int                 _minimumMultiplicity = 2;
+signals:
+    void                minimumMultiplicityChanged();
+
+public:
+    //! Aggregated edge width for a multiplicity of 1, width grow with sqrt(multiplicity) (default to 2.0).
+    Q_PROPERTY(qreal lineWidth READ getLineWidth WRITE setLineWidth NOTIFY lineWidthChanged FINAL)
+    //! \copydoc lineWidth
+    inline qreal        getLineWidth() const noexcept { return _lineWidth; }
+    //! \copydoc lineWidth
+    void                setLineWidth(qreal lineWidth) noexcept;
+private:
+    qreal               _lineWidth = 2.;
+signals:
+    void                lineWidthChanged();
+
+public:
+    //! Maximum aggregated edge width (default to 40.0).
+    Q_PROPERTY(qreal maximumLineWidth READ getMaximumLineWidth WRITE setMaximumLineWidth NOTIFY maximumLineWidthChanged FINAL)
+    //! \copydoc maximumLineWidth
+    inline qreal        getMaximumLineWidth() const noexcept { return _maximumLineWidth; }
+    //! \copydoc maximumLineWidth
+    void                setMaximumLineWidth(qreal maximumLineWidth) noexcept;
+private:
+    qreal               _maximumLineWidth = 40.;
+signals:
+    void                maximumLineWidthChanged();
+
+public:
+    //! Aggregated edges color (default to semi transparent black).
+    Q_PROPERTY(QColor color READ getColor WRITE setColor NOTIFY colorChanged FINAL)
+    //! \copydoc color
+    inline QColor       getColor() const noexcept { return _color; }
+    //! \copydoc color
+    void                setColor(QColor color) noexcept;
+private:
+    QColor              _color{0, 0, 0, 160};
+signals:
+    void                colorChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Bundling *///-----------------------------------------------
+    //@{
+public:
+    //! True when edges are actually bundled (read-only).
+    Q_PROPERTY(bool bundled READ getBundled NOTIFY bundledChanged FINAL)
+    //! \copydoc bundled
+    inline bool         getBundled() const noexcept { return _bundled; }
+    //! Number of rendered aggregated edges (read-only).
+    Q_PROPERTY(int bundleCount READ getBundleCount NOTIFY bundledChanged FINAL)
+    //! \copydoc bundleCount
+    inline int          getBundleCount() const noexcept { return static_cast<int>(_bundles.size()); }
+signals:
+    void                bundledChanged();
+
+public:
+    //! Force bundles regeneration (regeneration is deferred and merged with other invalidations).
+    Q_INVOKABLE void    invalidate() noexcept;
+
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Update \c bundled according to settings and navigable zoom.
+    void                updateBundled() noexcept;
+    //! Generate bundles and hide bundled edge items.
+    void                generateBundles() noexcept;
+    //! Restore previously hidden edge items visibility.
+    void                restoreEdgeItems() noexcept;
+
+    //! Aggregated edge between two clusters, in graph container CS.
+    struct Bundle {
+        QPointF     p1, p2;
+        int         multiplicity = 0;
+    };
+    std::vector<Bundle>                     _bundles;
+    std::vector<QPointer<qan::EdgeItem>>    _hiddenEdgeItems;
+    bool                _bundled = false;
+    bool                _generatePending = false;
+    bool                _geometryDirty = true;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeBundler)
@@ -0,0 +1,81 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometry.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QPointF>
+
+namespace qan { // ::qan
+
+/*! \brief Value type holding a complete qan::EdgeItem geometry (expressed in edge item CS).
+ *
+ * Geometry is published as a whole in qan::EdgeItem::edgeGeometry with a single edgeGeometryChanged()
+ * notification per update, bind to it once in edge delegates:
+ * \code
+ *   readonly property var g: edgeItem.edgeGeometry
+ *   PathLine { x: g.p2.x; y: g.p2.y }
+ * \endcode
+ */
+struct EdgeGeometry
+{
+    Q_GADGET
+    Q_PROPERTY(QPointF p1 MEMBER p1)
+    Q_PROPERTY(QPointF p2 MEMBER p2)
+    Q_PROPERTY(QPointF c1 MEMBER c1)
+    Q_PROPERTY(QPointF c2 MEMBER c2)
+    Q_PROPERTY(QPointF srcA1 MEMBER srcA1)
+    Q_PROPERTY(QPointF srcA2 MEMBER srcA2)
+    Q_PROPERTY(QPointF srcA3 MEMBER srcA3)
+    Q_PROPERTY(qreal srcAngle MEMBER srcAngle)
+    Q_PROPERTY(QPointF dstA1 MEMBER dstA1)
+    Q_PROPERTY(QPointF dstA2 MEMBER dstA2)
+    Q_PROPERTY(QPointF dstA3 MEMBER dstA3)
+    Q_PROPERTY(qreal dstAngle MEMBER dstAngle)
+    Q_PROPERTY(QPointF labelPos MEMBER labelPos)
+public:
+    QPointF p1, p2;
+    QPointF c1, c2;
+    QPointF srcA1, srcA2, srcA3;
+    qreal   srcAngle{0.};
+    QPointF dstA1, dstA2, dstA3;
+    qreal   dstAngle{0.};
+    QPointF labelPos;
+};
+
+} // ::qan
+
+Q_DECLARE_METATYPE(qan::EdgeGeometry)
@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometryKernel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+
+// QuickQanava headers
+#include "./qanEdgeGeometryKernel.h"
+#include "./qanSimdLane.h"
+
+namespace qan { // ::qan
+
+/* EdgeGeometryBatch Management *///------------------------------------------
+void    EdgeGeometryBatch::resize(std::size_t size)
+{
+    for (auto v : { &srcX, &srcY, &srcW, &srcH, &srcR,
+                    &dstX, &dstY, &dstW, &dstH, &dstR,
+                    &arrowLength, &srcArrow, &dstArrow,
+                    &p1x, &p1y, &p2x, &p2y,
+                    &a1x, &a1y, &a2x, &a2y,
+                    &minX, &minY, &maxX, &maxY, &angle })
+        v->resize(size);
+    hidden.resize(size);
+}
+
+void    EdgeGeometryBatch::clear() noexcept
+{
+    resize(0);
+}
+//-----------------------------------------------------------------------------
+
+/* Edge Geometry Kernel *///--------------------------------------------------
+namespace { // ::qan::anonymous
+
+using qan::simd::ScalarLane;
+using qan::simd::SimdLane;
+using qan::simd::simdLaneIsa;
+
+/* Return the parameter t in [0, 1] where segment (c, c + d) exit a rounded rectangle of center c, half
+ * extents (hw, hh) and corner radius r, or 0 when segment does not exit the shape (same semantic than
+ * qan::EdgeItem::getLineIntersection() falling back to shape center).
+ */
+template <class V>
+inline V    exitParameter(V dx, V dy, V hw, V hh, V r) noexcept
+{
+    const V eps = V::set1(1e-12);
+    const V zero = V::set1(0.);
+    const V adx = V::abs(dx);
+    const V ady = V::abs(dy);
+    V t = V::min(hw / V::max(adx, eps), hh / V::max(ady, eps));  // Sharp rectangle intersection
+
+    // Intersection lay in a rounded corner, intersect with corner circle (in first quadrant, by symmetry)
+    r = V::min(r, V::min(hw, hh));
+    const V kx = hw - r;
+    const V ky = hh - r;
+    const V corner = V::mand(V::lt(kx, t * adx), V::lt(ky, t * ady));
+    const V a = adx * adx + ady * ady;
+    const V b = adx * kx + ady * ky;
+    const V c = kx * kx + ky * ky - r * r;
+    const V disc = V::max(b * b - a * c, zero);
+    const V tc = (b + V::sqrt(disc)) / V::max(a, eps);
+    t = V::select(corner, tc, t);
+    return V::select(V::le(t, V::set1(1.)), t, zero);
+}
+
+template <class V>
+inline void generateLanes(EdgeGeometryBatch& b, std::size_t i) noexcept
+{
+    const V half = V::set1(0.5);
+    const V zero = V::set1(0.);
+    const V one = V::set1(1.);
+
+    const V srcW = V::load(&b.srcW[i]), srcH = V::load(&b.srcH[i]);
+    const V dstW = V::load(&b.dstW[i]), dstH = V::load(&b.dstH[i]);
+    const V srcX = V::load(&b.srcX[i]), srcY = V::load(&b.srcY[i]);
+    const V dstX = V::load(&b.dstX[i]), dstY = V::load(&b.dstY[i]);
+    const V srcHw = srcW * half, srcHh = srcH * half;
+    const V dstHw = dstW * half, dstHh = dstH * half;
+    const V csx = srcX + srcHw, csy = srcY + srcHh;     // Source and destination centers
+    const V cdx = dstX + dstHw, cdy = dstY + dstHh;
+    const V dx = cdx - csx, dy = cdy - csy;
+
+    const V ts = exitParameter(dx, dy, srcHw, srcHh, V::load(&b.srcR[i]));
+    const V td = exitParameter(dx, dy, dstHw, dstHh, V::load(&b.dstR[i]));
+    const V p1x = csx + dx * ts, p1y = csy + dy * ts;
+    const V p2x = cdx - dx * td, p2y = cdy - dy * td;
+    p1x.store(&b.p1x[i]);   p1y.store(&b.p1y[i]);
+    p2x.store(&b.p2x[i]);   p2y.store(&b.p2y[i]);
+
+    const V minX = V::min(p1x, p2x), maxX = V::max(p1x, p2x);
+    const V minY = V::min(p1y, p2y), maxY = V::max(p1y, p2y);
+    minX.store(&b.minX[i]); minY.store(&b.minY[i]);
+    maxX.store(&b.maxX[i]); maxY.store(&b.maxY[i]);
+
+    // Hidden: line shorter than arrow length or line br contained in src or dst br (with QRectF::contains()
+    // semantic: a null line br is never contained).
+    const V lx = p2x - p1x, ly = p2y - p1y;
+    const V length = V::sqrt(lx * lx + ly * ly);
+    const V arrowLength = V::load(&b.arrowLength[i]);
+    const V notNull = V::mand(V::lt(minX, maxX), V::lt(minY, maxY));
+    const V inSrc = V::mand(V::mand(V::le(srcX, minX), V::le(maxX, srcX + srcW)),
+                            V::mand(V::le(srcY, minY), V::le(maxY, srcY + srcH)));
+    const V inDst = V::mand(V::mand(V::le(dstX, minX), V::le(maxX, dstX + dstW)),
+                            V::mand(V::le(dstY, minY), V::le(maxY, dstY + dstH)));
+    const V hidden = V::mor(V::lt(length, V::set1(2.) + arrowLength),
+                            V::mand(notNull, V::mor(inSrc, inDst)));
+    V::storeMask(hidden, &b.hidden[i]);
+
+    // Arrow ends: translate line ends by arrow length along line direction
+    const V valid = V::lt(V::set1(0.00001), length);
+    const V inv = V::select(valid, one / V::max(length, V::set1(1e-12)), zero);
+    const V ux = lx * inv, uy = ly * inv;
+    const V srcOffset = arrowLength * V::load(&b.srcArrow[i]);
+    const V dstOffset = arrowLength * V::load(&b.dstArrow[i]);
+    (p1x + ux * srcOffset).store(&b.a1x[i]);
+    (p1y + uy * srcOffset).store(&b.a1y[i]);
+    (p2x - ux * dstOffset).store(&b.a2x[i]);
+    (p2y - uy * dstOffset).store(&b.a2y[i]);
+}
+
+} // ::qan::anonymous
+
+void    generateEdgeGeometryBatch(EdgeGeometryBatch& batch) noexcept
+{
+    const std::size_t n = batch.size();
+    std::size_t i = 0;
+    for (; i + SimdLane::width <= n; i += SimdLane::width)
+        generateLanes<SimdLane>(batch, i);
+    for (; i < n; ++i)
+        generateLanes<ScalarLane>(batch, i);
+
+    // Angle pass is scalar (no portable SIMD acos), same formula than qan::EdgeItem::lineAngle()
+    static constexpr    double Pi = 3.141592653;
+    static constexpr    double TwoPi = 2. * Pi;
+    static constexpr    double MinLength = 0.00001;
+    for (i = 0; i < n; ++i) {
+        if (batch.hidden[i] != 0) {
+            batch.angle[i] = -1.;
+            continue;
+        }
+        const double dx = batch.p2x[i] - batch.p1x[i];
+        const double dy = batch.p2y[i] - batch.p1y[i];
+        const double length = std::sqrt(dx * dx + dy * dy);
+        if (length < MinLength) {
+            batch.angle[i] = -1.;
+            continue;
+        }
+        double angle = std::acos(dx / length);
+        if (dy < 0.)
+            angle = TwoPi - angle;
+        batch.angle[i] = angle * (360. / TwoPi);
+    }
+}
+
+const char* edgeGeometryBatchIsa() noexcept { return simdLaneIsa; }
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,98 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometryKernel.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace qan { // ::qan
+
+/*! \brief Structure of arrays input/output for qan::generateEdgeGeometryBatch().
+ *
+ * Every array has size() elements, element \c i describe edge \c i: source and destination
+ * bounding shapes are axis aligned rounded rectangles (x, y, w, h and corner radius r, in graph
+ * global CS) with \c arrowLength being edge arrow length.
+ *
+ * Use resize() then fill input arrays, output arrays are overwritten by generateEdgeGeometryBatch().
+ */
+struct EdgeGeometryBatch
+{
+    /*! \name Input *///-------------------------------------------------------
+    //@{
+    std::vector<double>     srcX, srcY, srcW, srcH, srcR;
+    std::vector<double>     dstX, dstY, dstW, dstH, dstR;
+    std::vector<double>     arrowLength;
+    //! 1.0 if edge has a source arrow shape (ie src shape is not None), 0.0 otherwise.
+    std::vector<double>     srcArrow;
+    //! 1.0 if edge has a destination arrow shape (ie dst shape is not None), 0.0 otherwise.
+    std::vector<double>     dstArrow;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Output *///------------------------------------------------------
+    //@{
+    //! Line intersection with source and destination shapes (fallback to shape center when there is no intersection).
+    std::vector<double>     p1x, p1y, p2x, p2y;
+    //! Line ends corrected by arrow length (straight edges, equal to p1/p2 when there is no arrow).
+    std::vector<double>     a1x, a1y, a2x, a2y;
+    //! Line (p1, p2) bounding rect.
+    std::vector<double>     minX, minY, maxX, maxY;
+    //! Line (p1, p2) angle in degree (or -1.0 for a degenerated line), only generated for visible edges.
+    std::vector<double>     angle;
+    //! 1 if edge is too short or entirely contained in its source or destination rect.
+    std::vector<std::uint8_t>   hidden;
+    //@}
+    //-------------------------------------------------------------------------
+
+    inline auto size() const noexcept -> std::size_t { return srcX.size(); }
+    void        resize(std::size_t size);
+    void        clear() noexcept;
+};
+
+/*! \brief Generate straight edges ends, arrow ends, bounding rects and angles for a batch of edges.
+ *
+ * Geometry is identical to qan::EdgeItem per edge path for rounded rectangle bounding shapes (including
+ * the hidden edge rules), main pass run on SIMD registers (AVX, SSE2 or NEON depending on target
+ * architecture), angles are generated in a second scalar pass.
+ */
+void    generateEdgeGeometryBatch(EdgeGeometryBatch& batch) noexcept;
+
+//! Return the instruction set used by generateEdgeGeometryBatch() ("avx", "sse2", "neon" or "scalar").
+const char* edgeGeometryBatchIsa() noexcept;
+
+} // ::qan
@@ -0,0 +1,96 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometryPolicy.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QPointF>
+#include <QRectF>
+#include <QPolygonF>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+/*! \name Edge Geometry Policies *///--------------------------------------------
+//@{
+/*! \brief Compile time geometry policies used to specialize qan::EdgeItem geometry generation for a line type.
+ *
+ * qan::EdgeItem resolve a policy from its style \c lineType (and \c customShape) when style is set or modified,
+ * every geometry generation step (ends, control points, arrows, label and projection) is then instantiated for
+ * this policy: there is no per step line type switch in edge update hot path.
+ */
+struct StraightEdgeGeometry { static constexpr auto lineType = qan::EdgeStyle::LineType::Straight; };
+//! \copydoc StraightEdgeGeometry
+struct CurvedEdgeGeometry   { static constexpr auto lineType = qan::EdgeStyle::LineType::Curved; };
+//! \copydoc StraightEdgeGeometry
+struct OrthoEdgeGeometry    { static constexpr auto lineType = qan::EdgeStyle::LineType::Ortho; };
+//! Policy for a polyline generated by a custom shape (see qan::EdgeItem::registerShape()).
+struct CustomEdgeGeometry   { static constexpr auto lineType = qan::EdgeStyle::LineType::Custom; };
+
+/*! \brief Input and output of a custom C++ edge shape, in graph container CS.
+ *
+ * A shape is a type with a static \c generate() method, registered by name with qan::EdgeItem::registerShape<>()
+ * and selected with qan::EdgeStyle::customShape. Shape \c generate() is inlined in its edge geometry generation
+ * path (no virtual call, no QML Shape delegate is necessary, edges are rendered from qan::EdgeItem::orthoPath or
+ * by qan::EdgeBatchRenderer):
+ * \code
+ *   struct WaveShape {
+ *       static void generate(qan::EdgeShapeGeometry& g) noexcept {
+ *           const QLineF line{g.p1, g.p2};
+ *           const auto normal = line.normalVector().unitVector();
+ *           const QPointF n{normal.dx() * 10., normal.dy() * 10.};
+ *           for (int s = 1; s < 8; ++s)
+ *               g.points << line.pointAt(s / 8.) + (s % 2 ? n : -n);
+ *       }
+ *   };
+ *   qan::EdgeItem::registerShape<WaveShape>(QStringLiteral("wave"));
+ *   // QML: Qan.EdgeStyle { lineType: Qan.EdgeStyle.Custom; customShape: "wave" }
+ * \endcode
+ */
+struct EdgeShapeGeometry
+{
+    //! Source and destination items bounding rect.
+    QRectF      srcBr, dstBr;
+    //! Edge ends on source and destination bounding shapes (a shape might modify them).
+    QPointF     p1, p2;
+    //! Shape polyline points between \c p1 and \c p2 (ends excluded), empty (ie a straight line) by default.
+    QPolygonF   points;
+};
+//@}
+//-----------------------------------------------------------------------------
+
+} // ::qan
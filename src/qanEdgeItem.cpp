@@ -32,6 +32,11 @@
 // \date	2017 03 02
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+
 // Qt headers
 #include <QBrush>
 #include <QPainter>
@@ -42,6 +47,8 @@
 #include "./qanNodeItem.h"      // Resolve forward declaration
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
+#include "./qanEdgeGeometryKernel.h"
+#include "./qanTrace.h"
 
 namespace qan { // ::qan
 
@@ -64,7 +71,10 @@ auto    EdgeItem::getEdge() noexcept -> qan::Edge* { return _edge.data(); }
 auto    EdgeItem::getEdge() const noexcept -> const qan::Edge* { return _edge.data(); }
 auto    EdgeItem::setEdge(qan::Edge* edge) noexcept -> void
 {
-    _edge = edge;
+    if ( edge != _edge.data() ) {
+        _edge = edge;
+        emit edgeChanged();
+    }
     if ( edge != nullptr&&
          edge->getItem() != this )
         edge->setItem(this);
@@ -90,6 +100,10 @@ auto    EdgeItem::setSourceItem( qan::NodeItem* source ) -> void
 {
     if ( source == nullptr )
         return;
+    if ( _sourceItem &&                         // Disconnect previous source, unless it is
+         _sourceItem != source &&               // also destination (self loop)
+         _sourceItem.data() != _destinationItem.data() )
+        disconnect( _sourceItem.data(), nullptr, this, nullptr );
 
     // Connect dst x and y monitored properties change notify signal to slot updateEdge()
     QMetaMethod updateItemSlot = metaObject()->method( metaObject()->indexOfSlot( "updateItemSlot()" ) );
@@ -97,7 +111,6 @@ auto    EdgeItem::setSourceItem( qan::NodeItem* source ) -> void
         auto srcMetaObj = source->metaObject();
         QMetaProperty srcX      = srcMetaObj->property( srcMetaObj->indexOfProperty( "x" ) );
         QMetaProperty srcY      = srcMetaObj->property( srcMetaObj->indexOfProperty( "y" ) );
-        QMetaProperty srcZ      = srcMetaObj->property( srcMetaObj->indexOfProperty( "z" ) );
         QMetaProperty srcWidth  = srcMetaObj->property( srcMetaObj->indexOfProperty( "width" ) );
         QMetaProperty srcHeight = srcMetaObj->property( srcMetaObj->indexOfProperty( "height" ) );
         if ( !srcX.isValid() || !srcX.hasNotifySignal() ) {
@@ -116,11 +129,11 @@ auto    EdgeItem::setSourceItem( qan::NodeItem* source ) -> void
             qWarning() << "qan::EdgeItem::setSourceItem(): Error: can't access source height property.";
             return;
         }
-        connect( source, srcX.notifySignal(),       this, updateItemSlot );
-        connect( source, srcY.notifySignal(),       this, updateItemSlot );
-        connect( source, srcZ.notifySignal(),       this, updateItemSlot );
-        connect( source, srcWidth.notifySignal(),   this, updateItemSlot );
-        connect( source, srcHeight.notifySignal(),  this, updateItemSlot );
+        connect( source, srcX.notifySignal(),       this, updateItemSlot, Qt::UniqueConnection );
+        connect( source, srcY.notifySignal(),       this, updateItemSlot, Qt::UniqueConnection );
+        connect( source, &QQuickItem::zChanged,     this, &EdgeItem::updateZSlot, Qt::UniqueConnection );  // Restacking does not modify geometry
+        connect( source, srcWidth.notifySignal(),   this, updateItemSlot, Qt::UniqueConnection );
+        connect( source, srcHeight.notifySignal(),  this, updateItemSlot, Qt::UniqueConnection );
         _sourceItem = source;
         emit sourceItemChanged();
         if ( source->z() < z() )
@@ -131,6 +144,10 @@ auto    EdgeItem::setSourceItem( qan::NodeItem* source ) -> void
 
 auto    EdgeItem::setDestinationItem( qan::NodeItem* destination ) -> void
 {
+    if ( _destinationItem &&                    // Disconnect previous destination, unless it is
+         _destinationItem != destination &&     // also source (self loop)
+         _destinationItem.data() != _sourceItem.data() )
+        disconnect( _destinationItem.data(), nullptr, this, nullptr );
     configureDestinationItem( destination );
     _destinationItem = destination;
     emit destinationItemChanged();
@@ -151,7 +168,6 @@ void    EdgeItem::configureDestinationItem( QQuickItem* item )
     auto dstMetaObj = item->metaObject( );
     QMetaProperty dstX      = dstMetaObj->property( dstMetaObj->indexOfProperty( "x" ) );
     QMetaProperty dstY      = dstMetaObj->property( dstMetaObj->indexOfProperty( "y" ) );
-    QMetaProperty dstZ      = dstMetaObj->property( dstMetaObj->indexOfProperty( "z" ) );
     QMetaProperty dstWidth  = dstMetaObj->property( dstMetaObj->indexOfProperty( "width" ) );
     QMetaProperty dstHeight = dstMetaObj->property( dstMetaObj->indexOfProperty( "height" ) );
     if ( !dstX.isValid() || !dstX.hasNotifySignal() ) {
@@ -170,14 +186,30 @@ void    EdgeItem::configureDestinationItem( QQuickItem* item )
         qWarning() << "qan::EdgeItem::setDestinationItem(): Error: can't access source height property.";
         return;
     }
-    connect( item, dstX.notifySignal(),       this, updateItemSlot );
-    connect( item, dstY.notifySignal(),       this, updateItemSlot );
-    connect( item, dstZ.notifySignal(),       this, updateItemSlot );
-    connect( item, dstWidth.notifySignal(),   this, updateItemSlot );
-    connect( item, dstHeight.notifySignal(),  this, updateItemSlot );
+    connect( item, dstX.notifySignal(),       this, updateItemSlot, Qt::UniqueConnection );
+    connect( item, dstY.notifySignal(),       this, updateItemSlot, Qt::UniqueConnection );
+    connect( item, &QQuickItem::zChanged,     this, &EdgeItem::updateZSlot, Qt::UniqueConnection );  // Restacking does not modify geometry
+    connect( item, dstWidth.notifySignal(),   this, updateItemSlot, Qt::UniqueConnection );
+    connect( item, dstHeight.notifySignal(),  this, updateItemSlot, Qt::UniqueConnection );
     if ( item->z() < z() )
         setZ( item->z() - 0.5);
 }
+
+void    EdgeItem::resetEndpoints() noexcept
+{
+    if ( _sourceItem )
+        disconnect( _sourceItem.data(), nullptr, this, nullptr );
+    if ( _destinationItem )
+        disconnect( _destinationItem.data(), nullptr, this, nullptr );
+    if ( _sourceItem ) {
+        _sourceItem = nullptr;
+        emit sourceItemChanged();
+    }
+    if ( _destinationItem ) {
+        _destinationItem = nullptr;
+        emit destinationItemChanged();
+    }
+}
 //-----------------------------------------------------------------------------
 
 /* Edge Drawing Management *///------------------------------------------------
@@ -189,6 +221,26 @@ void    EdgeItem::setHidden(bool hidden) noexcept
     }
 }
 
+void    EdgeItem::uncull() noexcept
+{
+    if ( _culled ) {
+        _culled = false;
+        emit culledChanged();
+    }
+}
+
+void    EdgeItem::setFan(qreal fanOffset, int fanCount, bool fanCollapsed) noexcept
+{
+    if ( !qFuzzyCompare(1. + fanOffset, 1. + _fanOffset) ||
+         fanCount != _fanCount ||
+         fanCollapsed != _fanCollapsed ) {
+        _fanOffset = fanOffset;
+        _fanCount = fanCount;
+        _fanCollapsed = fanCollapsed;
+        emit fanChanged();
+    }
+}
+
 void    EdgeItem::setArrowSize( qreal arrowSize ) noexcept
 {
     if ( !qFuzzyCompare(1. + arrowSize, 1. + _arrowSize ) ) {
@@ -216,35 +268,461 @@ auto    EdgeItem::setDstShape(ArrowShape dstShape) noexcept -> void
     }
 }
 
+void    EdgeItem::updateItemSlot()
+{
+    const auto graph = getGraph();
+    if ( graph != nullptr )
+        graph->scheduleEdgeItemUpdate(this);
+    else
+        updateItem();
+}
+
+void    EdgeItem::updateZSlot()
+{
+    const auto graph = getGraph();
+    if ( graph != nullptr )
+        graph->scheduleEdgeItemRestack(this);
+    else
+        updateZ();
+}
+
+void    EdgeItem::updateZ() noexcept
+{
+    if ( !_sourceItem ||
+         !_destinationItem )
+        return;
+    const auto z = qMax(qan::getItemGlobalZ_rec(_sourceItem.data()),      // See generateGeometryKey()
+                        qan::getItemGlobalZ_rec(_destinationItem.data())) - 0.1;
+    setZ(z);
+    if ( _geometryKey.isValid() )
+        _geometryKey.z = z;
+}
+
 void    EdgeItem::updateItem() noexcept
 {
+    QAN_TRACE_SCOPE("EdgeItem::updateItem");
+    QAN_TRACE_COUNT(EdgeItemUpdates);
+    const auto graph = getGraph();
+    if (graph != nullptr &&         // Geometry is updated once in qan::Graph::endUpdate()
+        graph->isUpdating()) {
+        graph->deferEdgeItemUpdate(this);
+        return;
+    }
     // Algorithm:
         // Generate cache step by step until it become invalid.
         // 1. Generate                 srcBr / dstBr / srcBrCenter / dstBrCenter / z
         // 2. generate edge ends:      P1 / P2
         // 3. generate control points: C1 / C2
+        // 0. Skip generation if geometry inputs are unchanged or just translated
+    auto key = generateGeometryKey();           // 0.
+    if ( cullItem(key) ||
+         applyGeometryKey(key) )
+        return;
     auto cache = generateGeometryCache();       // 1.
-    if ( cache.isValid() ) {
-        switch (cache.lineType) {               // 2.
-        case qan::EdgeStyle::LineType::Straight: generateStraightEnds(cache); break;
-        case qan::EdgeStyle::LineType::Curved:   generateStraightEnds(cache); break;
-        case qan::EdgeStyle::LineType::Ortho:    generateOrthoEnds(cache);    break;
+    applyFan(key, cache);
+    generateEnds(cache);                        // 2.
+    finalizeGeometry(cache);                    // 3.
+    _geometryKey = cache.isValid() ? key : GeometryKey{};
+}
+
+void    EdgeItem::routeModified() noexcept
+{
+    _geometryKey = GeometryKey{};   // Route is not part of geometry key
+    updateItem();
+}
+
+auto    EdgeItem::GeometryKey::isTranslationOf(const GeometryKey& other, QPointF& delta) const noexcept -> bool
+{
+    if ( !valid || !other.valid ||
+         srcItem != other.srcItem || dstItem != other.dstItem ||
+         lineType != other.lineType ||
+         policy != other.policy ||
+         !qFuzzyCompare(1. + arrowSize, 1. + other.arrowSize) ||
+         srcArrowShape != other.srcArrowShape || dstArrowShape != other.dstArrowShape ||
+         srcDock != other.srcDock || dstDock != other.dstDock ||
+         srcCollapsed != other.srcCollapsed || dstCollapsed != other.dstCollapsed ||
+         !qFuzzyCompare(1. + fanOffset, 1. + other.fanOffset) ||
+         fanCount != other.fanCount ||
+         fanCollapsed != other.fanCollapsed || fanHidden != other.fanHidden )
+        return false;
+    delta = srcTopLeft - other.srcTopLeft;
+    const auto sameDelta = [&delta](const QPointF& a, const QPointF& b) {
+        const QPointF d = a - b;
+        return qFuzzyCompare(1. + d.x(), 1. + delta.x()) &&
+               qFuzzyCompare(1. + d.y(), 1. + delta.y());
+    };
+    return sameDelta(srcBottomRight, other.srcBottomRight) &&
+           sameDelta(dstTopLeft, other.dstTopLeft) &&
+           sameDelta(dstBottomRight, other.dstBottomRight) &&
+           srcShape == other.srcShape &&    // Fast pointer comparison for unmodified shared shapes
+           dstShape == other.dstShape;
+}
+
+EdgeItem::GeometryKey   EdgeItem::generateGeometryKey() const noexcept
+{
+    GeometryKey key;
+    const QQuickItem* graphContainerItem = ( getGraph() != nullptr ? getGraph()->getContainerItem() : nullptr );
+    if ( graphContainerItem == nullptr ||
+         !_sourceItem ||
+         !_destinationItem )
+        return key;     // Return INVALID key
+
+    const auto groupCollapsed = [](qan::NodeItem* item) -> bool {
+        const auto node = item->getNode();
+        const auto group = node != nullptr ? qobject_cast<qan::Group*>(node->get_group().lock().get()) : nullptr;
+        return group != nullptr &&
+               group->getGroupItem() != nullptr &&
+               group->getGroupItem()->getCollapsed();
+    };
+    const auto dockType = [](const qan::NodeItem* item) -> int {
+        const auto port = qobject_cast<const qan::PortItem*>(item);
+        return port != nullptr ? static_cast<int>(port->getDockType()) : -1;
+    };
+
+    key.srcItem = _sourceItem.data();
+    key.dstItem = _destinationItem.data();
+    key.srcTopLeft = _sourceItem->mapToItem(graphContainerItem, QPointF{0., 0.});
+    key.srcBottomRight = _sourceItem->mapToItem(graphContainerItem, QPointF{_sourceItem->width(), _sourceItem->height()});
+    key.dstTopLeft = _destinationItem->mapToItem(graphContainerItem, QPointF{0., 0.});
+    key.dstBottomRight = _destinationItem->mapToItem(graphContainerItem, QPointF{_destinationItem->width(), _destinationItem->height()});
+    key.srcShape = _sourceItem->getBoundingShape();
+    key.dstShape = _destinationItem->getBoundingShape();
+    key.z = qMax(qan::getItemGlobalZ_rec(_sourceItem.data()),
+                 qan::getItemGlobalZ_rec(_destinationItem.data())) - 0.1;
+    if ( _style )
+        key.lineType = _style->getLineType();
+    key.policy = _geometryPolicy;
+    key.arrowSize = getArrowSize();
+    key.srcArrowShape = static_cast<int>(getSrcShape());
+    key.dstArrowShape = static_cast<int>(getDstShape());
+    key.srcDock = dockType(_sourceItem.data());
+    key.dstDock = dockType(_destinationItem.data());
+    key.srcCollapsed = groupCollapsed(_sourceItem.data());
+    key.dstCollapsed = groupCollapsed(_destinationItem.data());
+    generateFan(key);
+    key.valid = true;
+    return key;
+}
+
+void    EdgeItem::generateFan(GeometryKey& key) const noexcept
+{
+    const auto graph = getGraph();
+    if ( graph == nullptr ||
+         graph->getParallelEdgeSpacing() <= 0. ||
+         !_edge ||
+         key.srcDock != -1 || key.dstDock != -1 ||     // Port edges are not fanned
+         ( key.lineType != qan::EdgeStyle::LineType::Straight &&
+           key.lineType != qan::EdgeStyle::LineType::Curved ) )
+        return;
+    const auto src = _edge->get_src().lock();
+    const auto dst = _edge->get_dst().lock();
+    if ( !src || !dst ||
+         src == dst )
+        return;
+
+    // Algorithm:
+        // 1. Visit src to dst and dst to src edges with the adjacency index, keep edges with a straight or
+        //    curved non port item (this edge included).
+        // 2. Index is the number of siblings with a lower id, leader is the sibling with lowest id.
+        // 3. Offset is centered on nodes center line, expressed in leader direction (reversed edges normal is inverted).
+    const auto myId = _edge->get_id();
+    int count = 0;
+    int index = 0;
+    qan::Edge* leader = nullptr;
+    const auto visit = [&count, &index, &leader, myId](const std::weak_ptr<qan::Edge>& weakEdge) {
+        const auto edge = weakEdge.lock();      // 1.
+        const auto item = edge ? edge->getItem() : nullptr;
+        if ( item == nullptr ||
+             qobject_cast<const qan::PortItem*>(item->_sourceItem.data()) != nullptr ||
+             qobject_cast<const qan::PortItem*>(item->_destinationItem.data()) != nullptr ||
+             ( item->_style &&
+               item->_style->getLineType() != qan::EdgeStyle::LineType::Straight &&
+               item->_style->getLineType() != qan::EdgeStyle::LineType::Curved ) )
+            return;
+        ++count;                                // 2.
+        if ( edge->get_id() < myId )
+            ++index;
+        if ( leader == nullptr ||
+             edge->get_id() < leader->get_id() )
+            leader = edge.get();
+    };
+    src->for_each_out_edge(dst.get(), visit);
+    dst->for_each_out_edge(src.get(), visit);
+    if ( count <= 1 ||
+         leader == nullptr )
+        return;
+
+    key.fanCount = count;
+    key.fanLeader = leader->getItem();
+    key.fanReversed = leader->get_src().lock() != src;
+    if ( graph->isParallelEdgeCollapsed() &&
+         count >= graph->getParallelEdgeCollapseCount() ) {
+        key.fanCollapsed = index == 0;          // Leader is drawn for the whole set, siblings are hidden
+        key.fanHidden = index != 0;
+        return;
+    }
+    const auto offset = ( index - ( count - 1 ) / 2. ) * graph->getParallelEdgeSpacing();   // 3.
+    key.fanOffset = key.fanReversed ? -offset : offset;
+}
+
+void    EdgeItem::applyFan(const GeometryKey& key, GeometryCache& cache) const noexcept
+{
+    if ( !cache.isValid() ||
+         key.fanCount <= 1 )
+        return;
+    cache.fanOffset = key.fanOffset;
+    cache.fanCount = key.fanCount;
+    cache.fanCollapsed = key.fanCollapsed;
+    cache.fanHidden = key.fanHidden;
+    cache.fanReversed = key.fanReversed;
+    cache.fanLeader = key.fanLeader;
+    cache.hidden = key.fanHidden;
+    if ( !qFuzzyIsNull(cache.fanOffset) ) {     // Fanned straight edges are drawn as curves
+        cache.lineType = qan::EdgeStyle::LineType::Curved;
+        cache.policy = builtinGeometryPolicy(qan::EdgeStyle::LineType::Curved);
+    }
+}
+
+void    EdgeItem::generateFanEnds(GeometryCache& cache) const noexcept
+{
+    if ( cache.fanLeader == nullptr ) {
+        generateStraightEnds(cache);
+        return;
+    }
+    // Ends are clipped once on nodes center line and shared by siblings: cache is expressed in leader direction
+    auto& ends = cache.fanLeader->_fanEnds;
+    const auto& srcBr = cache.fanReversed ? cache.dstBr : cache.srcBr;
+    const auto& dstBr = cache.fanReversed ? cache.srcBr : cache.dstBr;
+    const auto& srcBs = cache.fanReversed ? cache.dstBs : cache.srcBs;
+    const auto& dstBs = cache.fanReversed ? cache.srcBs : cache.dstBs;
+    if ( ends.valid &&
+         ends.srcBr == srcBr && ends.dstBr == dstBr &&
+         ends.srcBs == srcBs && ends.dstBs == dstBs ) {    // Fast pointer comparison for unmodified shared shapes
+        cache.hidden = ends.hidden;
+        cache.p1 = cache.fanReversed ? ends.p2 : ends.p1;
+        cache.p2 = cache.fanReversed ? ends.p1 : ends.p2;
+        return;
+    }
+    generateStraightEnds(cache);
+    ends.valid = true;
+    ends.srcBr = srcBr;     ends.dstBr = dstBr;
+    ends.srcBs = srcBs;     ends.dstBs = dstBs;
+    ends.p1 = cache.fanReversed ? cache.p2 : cache.p1;
+    ends.p2 = cache.fanReversed ? cache.p1 : cache.p2;
+    ends.hidden = cache.hidden;
+}
+
+bool    EdgeItem::cullItem(const GeometryKey& key) noexcept
+{
+    const auto graph = getGraph();
+    if ( !key.isValid() ||
+         graph == nullptr ||
+         !graph->getViewportCulling() )
+        return false;
+    const auto br = QRectF{key.srcTopLeft, key.srcBottomRight}.normalized().united(
+                    QRectF{key.dstTopLeft, key.dstBottomRight}.normalized());
+    if ( !graph->isCulled(br) ) {
+        uncull();
+        return false;
+    }
+    _culledBr = br;
+    _geometryKey = GeometryKey{};   // Geometry is regenerated when edge is unculled
+    setHidden(true);
+    if ( !_culled ) {
+        _culled = true;
+        graph->cullEdgeItem(this);
+        emit culledChanged();
+    }
+    return true;
+}
+
+bool    EdgeItem::applyGeometryKey(const GeometryKey& key) noexcept
+{
+    QPointF delta;
+    if ( !key.isTranslationOf(_geometryKey, delta) )
+        return false;
+    if ( !delta.isNull() )
+        setPosition(position() + delta);    // Edge geometry is expressed in item CS, just translate item
+    setZ(key.z);
+    _geometryKey = key;
+    return true;
+}
+
+bool    EdgeItem::translateGeometry(const QPointF& delta) noexcept
+{
+    if ( !_geometryKey.isValid() ||
+         _culled ||
+         typeid(*this) != typeid(qan::EdgeItem) )   // updateItem() might be overriden
+        return false;
+    auto key = _geometryKey;
+    key.srcTopLeft += delta;    key.srcBottomRight += delta;
+    key.dstTopLeft += delta;    key.dstBottomRight += delta;
+    const auto graph = getGraph();
+    if ( graph != nullptr &&
+         graph->getViewportCulling() &&
+         graph->isCulled(QRectF{key.srcTopLeft, key.srcBottomRight}.normalized().united(
+                         QRectF{key.dstTopLeft, key.dstBottomRight}.normalized())) )
+        return false;           // Let updateItem() cull edge
+    if ( !delta.isNull() )
+        setPosition(position() + delta);
+    _geometryKey = key;
+    return true;
+}
+
+void    EdgeItem::updateItems(const std::vector<qan::EdgeItem*>& edgeItems) noexcept
+{
+    // Algorithm:
+        // 1. Generate geometry cache for every edge, batch edges with rounded rect ends, otherwise use per edge path.
+        // 2. Generate batched edges ends and straight arrows with qan::generateEdgeGeometryBatch().
+        // 3. Report batch results in edges caches and finalize geometry.
+    const auto isDefaultShape = [](const qan::NodeItem* item, const QRectF& br) -> bool {
+        static constexpr qreal epsilon = 0.001;     // Reject rotated or scaled items
+        return item != nullptr &&
+               qobject_cast<const qan::PortItem*>(item) == nullptr &&
+               !item->getComplexBoundingShape() &&
+               item->getShapeProvider() == nullptr &&
+               std::abs(br.width() - item->width()) < epsilon &&
+               std::abs(br.height() - item->height()) < epsilon;
+    };
+
+    // Scratch storage is reused across calls (dirty edges are updated once per frame from the GUI thread): it is
+    // cleared but never shrunk, so that a steady state update does not allocate.
+    struct Scratch {
+        std::vector<qan::EdgeItem*> batchedItems;
+        std::vector<GeometryCache>  caches;
+        qan::EdgeGeometryBatch      batch;
+        bool                        inUse = false;
+    };
+    struct ScratchGuard {       // Note: caches are cleared to release their shared bounding shapes
+        Scratch& scratch;
+        ~ScratchGuard() { scratch.batchedItems.clear(); scratch.caches.clear(); scratch.inUse = false; }
+    };
+    static Scratch  sharedScratch;
+    Scratch         localScratch;   // Used for reentrant calls (from a geometry notification handler)
+    ScratchGuard    guard{sharedScratch.inUse ? localScratch : sharedScratch};
+    guard.scratch.inUse = true;
+    auto& batchedItems = guard.scratch.batchedItems;
+    auto& caches = guard.scratch.caches;
+    batchedItems.reserve(edgeItems.size());
+    caches.reserve(edgeItems.size());
+    for (const auto edgeItem : edgeItems) {     // 1.
+        if (edgeItem == nullptr)
+            continue;
+        const auto graph = edgeItem->getGraph();
+        if (typeid(*edgeItem) != typeid(qan::EdgeItem) ||   // updateItem() might be overriden
+            (graph != nullptr && graph->isUpdating())) {
+            edgeItem->updateItem();
+            continue;
+        }
+        auto key = edgeItem->generateGeometryKey();
+        if (edgeItem->cullItem(key) ||          // Out of view, or unchanged or translated geometry
+            edgeItem->applyGeometryKey(key))
+            continue;
+        auto cache = edgeItem->generateGeometryCache();
+        edgeItem->applyFan(key, cache);
+        edgeItem->_geometryKey = cache.isValid() ? key : GeometryKey{};
+        if (cache.isValid() &&
+            qFuzzyIsNull(cache.fanOffset) &&        // Fanned edges share their ends, see generateFanEnds()
+            !cache.fanHidden &&
+            (cache.lineType == qan::EdgeStyle::LineType::Straight ||
+             cache.lineType == qan::EdgeStyle::LineType::Curved) &&
+            isDefaultShape(edgeItem->_sourceItem.data(), cache.srcBr) &&
+            isDefaultShape(edgeItem->_destinationItem.data(), cache.dstBr)) {
+            batchedItems.push_back(edgeItem);
+            caches.push_back(std::move(cache));
+        } else {
+            edgeItem->generateEnds(cache);
+            edgeItem->finalizeGeometry(cache);
         }
-        if ( cache.isValid() ) {
-            switch (cache.lineType) {           // 3.
-            case qan::EdgeStyle::LineType::Straight: /* Nil */                           break;
-            case qan::EdgeStyle::LineType::Curved:   generateCurvedControlPoints(cache); break;
-            case qan::EdgeStyle::LineType::Ortho:    /* Nil */                           break; // Ortho C1 control point is generated in generateOrthoEnds()
+    }
+    if (batchedItems.empty())
+        return;
+
+    auto& batch = guard.scratch.batch;          // 2.
+    batch.resize(batchedItems.size());
+    for (std::size_t i = 0; i < batchedItems.size(); ++i) {
+        const auto edgeItem = batchedItems[i];
+        const auto& cache = caches[i];
+        const bool straight = cache.lineType == qan::EdgeStyle::LineType::Straight;
+        batch.srcX[i] = cache.srcBr.x();  batch.srcY[i] = cache.srcBr.y();
+        batch.srcW[i] = cache.srcBr.width();  batch.srcH[i] = cache.srcBr.height();
+        batch.srcR[i] = qan::NodeItem::defaultBoundingShapeRadius;
+        batch.dstX[i] = cache.dstBr.x();  batch.dstY[i] = cache.dstBr.y();
+        batch.dstW[i] = cache.dstBr.width();  batch.dstH[i] = cache.dstBr.height();
+        batch.dstR[i] = qan::NodeItem::defaultBoundingShapeRadius;
+        batch.arrowLength[i] = edgeItem->getArrowSize() * 3.;
+        batch.srcArrow[i] = straight && edgeItem->getSrcShape() != ArrowShape::None ? 1. : 0.;
+        batch.dstArrow[i] = straight && edgeItem->getDstShape() != ArrowShape::None ? 1. : 0.;
+    }
+    qan::generateEdgeGeometryBatch(batch);
+
+    for (std::size_t i = 0; i < batchedItems.size(); ++i) {     // 3.
+        auto& cache = caches[i];
+        cache.hidden = batch.hidden[i] != 0;
+        if (!cache.hidden) {
+            if (cache.lineType == qan::EdgeStyle::LineType::Straight) {
+                const auto angle = batch.angle[i];
+                cache.p1 = QPointF{batch.a1x[i], batch.a1y[i]};
+                cache.p2 = QPointF{batch.a2x[i], batch.a2y[i]};
+                cache.dstAngle = angle;
+                cache.srcAngle = angle < 0. ? angle : std::fmod(angle + 180., 360.);
+                cache.arrowAnglesGenerated = true;
+            } else {
+                cache.p1 = QPointF{batch.p1x[i], batch.p1y[i]};
+                cache.p2 = QPointF{batch.p2x[i], batch.p2y[i]};
             }
-            generateArrowGeometry(cache);
-            generateLabelPosition(cache);
         }
+        batchedItems[i]->finalizeGeometry(cache);
+    }
+}
+
+void    EdgeItem::generateEnds(GeometryCache& cache) const noexcept
+{
+    if ( !cache.isValid() ||
+         cache.fanHidden )      // Sibling of a collapsed parallel edges set
+        return;
+    if ( !qFuzzyIsNull(cache.fanOffset) )
+        generateFanEnds(cache);
+    else if ( cache.policy != nullptr )
+        (this->*cache.policy->generateEnds)(cache);
+}
+
+void    EdgeItem::finalizeGeometry(GeometryCache& cache) noexcept
+{
+    setFan(cache.fanOffset, cache.fanCount, cache.fanCollapsed);
+    if ( cache.isValid() &&
+         cache.policy != nullptr )
+        (this->*cache.policy->finalizeGeometry)(cache);
+    else
+        setHidden(true);
+}
+
+template <class Policy>
+void    EdgeItem::generatePolicyEnds(GeometryCache& cache) const noexcept
+{
+    if ( !cache.isValid() )
+        return;
+    if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho )
+        generateOrthoEnds(cache);
+    else                            // Straight, curved and custom shapes start from straight ends
+        generateStraightEnds(cache);
+}
+
+template <class Policy>
+void    EdgeItem::finalizePolicyGeometry(GeometryCache& cache) noexcept
+{
+    if ( cache.isValid() ) {
+        // Note: Ortho C1 control point is generated in generateOrthoEnds(), custom shape polyline in finalizeShapeGeometry()
+        if ( Policy::lineType == qan::EdgeStyle::LineType::Curved )
+            generateCurvedControlPoints(cache);
+        generateArrowGeometry<Policy>(cache);
+        generateLabelPosition<Policy>(cache);
     }
 
     // A valid geometry has been generated, generate a bounding box for edge,
     // and project all geometry in edge CS.
     if ( cache.isValid() )
-        applyGeometry(cache);
+        applyGeometry<Policy>(cache);
     else
         setHidden(true);
 }
@@ -320,22 +798,11 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
         return cache;   // Return invalid cache
 
     // Generate bounding shapes for source and destination in global CS
-    {
-        if ( _sourceItem != nullptr ) {        // Generate source bounding shape polygon
-            cache.srcBs.resize(_sourceItem->getBoundingShape().size());
-            int p = 0;
-            for ( const auto& point: _sourceItem->getBoundingShape() )
-                cache.srcBs[p++] = _sourceItem->mapToItem( graphContainerItem, point );
-        }
-        // Generate destination bounding shape polygon
-        if ( dstNodeItem != nullptr ) {        // Regular Node -> Node edge
-            // Update edge z to source or destination maximum x
-            cache.dstBs.resize(dstNodeItem->getBoundingShape().size());
-            int p = 0;
-            for ( const auto& point: dstNodeItem->getBoundingShape() )
-                cache.dstBs[p++] = dstNodeItem->mapToItem( graphContainerItem, point );
-        }
-    }
+    // Note: mapped shapes are cached in node items, regenerated only on shape or transformation change
+    if ( _sourceItem != nullptr )           // Generate source bounding shape polygon
+        cache.srcBs = _sourceItem->getContainerBoundingShape( graphContainerItem );
+    if ( dstNodeItem != nullptr )           // Generate destination bounding shape polygon
+        cache.dstBs = dstNodeItem->getContainerBoundingShape( graphContainerItem );
 
     // Verify source and destination bounding shapes
     if ( cache.srcBs.isEmpty() ||
@@ -351,10 +818,11 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
 
     if ( _style )
         cache.lineType = _style->getLineType();
+    cache.policy = _geometryPolicy != nullptr ? _geometryPolicy : resolveGeometryPolicy();
 
     // Generate edge line P1 and P2 in global graph CS
-    const auto srcBr = cache.srcBs.boundingRect();
-    const auto dstBr = cache.dstBs.boundingRect();
+    const auto srcBr = _sourceItem->getContainerBoundingRect( graphContainerItem );
+    const auto dstBr = dstNodeItem->getContainerBoundingRect( graphContainerItem );
     const QPointF srcBrCenter = srcBr.center(); // Keep theses value in processor cache
     const QPointF dstBrCenter = dstBr.center();
     cache.srcBr = srcBr;
@@ -374,7 +842,7 @@ void    EdgeItem::generateStraightEnds(GeometryCache& cache) const noexcept
     if ( !cache.isValid() )
         return;
 
-    const QLineF line = getLineIntersection( cache.srcBrCenter, cache.dstBrCenter, cache.srcBs, cache.dstBs );
+    const QLineF line = getShapesIntersection( cache );
 
     // Update hidden: Edge is hidden if it's size is less than the src/dst shape size sum
     {
@@ -554,8 +1022,24 @@ void    EdgeItem::generateOrthoEnds(GeometryCache& cache) const noexcept
             }
         }
     }
+
+    // 3. Use router obstacle avoiding route if available (default elbow geometry is kept until edge is routed)
+    const auto graph = getGraph();
+    const auto router = graph != nullptr ? graph->getOrthoRouter() : nullptr;
+    if (router != nullptr) {
+        // Note: routing request only records this edge, cast is safe
+        cache.route = router->route(const_cast<qan::EdgeItem*>(this), cache.srcBr, cache.dstBr);
+        if (cache.route.size() >= 2) {
+            cache.p1 = cache.route.first();
+            cache.p2 = cache.route.last();
+            cache.c1 = cache.route.size() >= 3 ? cache.route[cache.route.size() - 2] :
+                                                 QLineF{cache.p1, cache.p2}.center();
+        } else
+            cache.route.clear();
+    }
 }
 
+template <class Policy>
 void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
 {
     // PRECONDITIONS:
@@ -620,28 +1104,33 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
     }
 
     // Generate start/end arrow angle
-    switch (cache.lineType) {
-        case qan::EdgeStyle::LineType::Straight:
-            cache.dstAngle = generateStraightArrowAngle(cache.p1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.p2, cache.p1, srcShape, arrowLength);
-            break;
-
-        case qan::EdgeStyle::LineType::Ortho:
-            cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
-            break;
-
-        case qan::EdgeStyle::LineType::Curved:
-            // Generate source arrow angle (p2 <-> p1 and c2 <-> c1)
-            cache.srcAngle = generateCurvedArrowAngle(cache.p2, cache.p1,
-                                                      cache.c2, cache.c1,
-                                                      srcShape, arrowLength);
-
-            // Generate destination arrow angle
-            cache.dstAngle = generateCurvedArrowAngle(cache.p1, cache.p2,
-                                                      cache.c1, cache.c2,
-                                                      dstShape, arrowLength);
-            break;
+    if ( Policy::lineType == qan::EdgeStyle::LineType::Straight ) {
+        if ( cache.arrowAnglesGenerated )   // Already generated in updateItems()
+            return;
+        cache.dstAngle = generateStraightArrowAngle(cache.p1, cache.p2, dstShape, arrowLength);
+        cache.srcAngle = generateStraightArrowAngle(cache.p2, cache.p1, srcShape, arrowLength);
+    } else if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho ) {
+        // Routed edge source arrow is oriented on route first segment
+        QPointF srcNext = cache.route.size() >= 3 ? cache.route[1] : cache.c1;
+        cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
+        cache.srcAngle = generateStraightArrowAngle(srcNext, cache.p1, srcShape, arrowLength);
+    } else if ( Policy::lineType == qan::EdgeStyle::LineType::Curved ) {
+        // Generate source arrow angle (p2 <-> p1 and c2 <-> c1)
+        cache.srcAngle = generateCurvedArrowAngle(cache.p2, cache.p1,
+                                                  cache.c2, cache.c1,
+                                                  srcShape, arrowLength);
+
+        // Generate destination arrow angle
+        cache.dstAngle = generateCurvedArrowAngle(cache.p1, cache.p2,
+                                                  cache.c1, cache.c2,
+                                                  dstShape, arrowLength);
+    } else if ( cache.route.size() >= 2 ) {     // Custom shape: arrows are oriented on polyline first and last segments
+        QPointF dstPrevious = cache.route[cache.route.size() - 2];
+        QPointF srcNext = cache.route[1];
+        cache.dstAngle = generateStraightArrowAngle(dstPrevious, cache.p2, dstShape, arrowLength);
+        cache.srcAngle = generateStraightArrowAngle(srcNext, cache.p1, srcShape, arrowLength);
+        cache.route.first() = cache.p1;         // Polyline ends follow arrow corrected p1 and p2
+        cache.route.last() = cache.p2;
     }
 }
 
@@ -697,8 +1186,18 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
         // cache style must be straight line
     if ( !cache.isValid() )
         return;
-    if ( cache.lineType != qan::EdgeStyle::LineType::Curved )
+
+    if ( cache.fanCount > 1 &&
+         !cache.fanCollapsed ) {    // Parallel edge: offset curve, control points at one and two thirds of (P1,P2) line
+        const QLineF line{cache.p1, cache.p2};
+        const auto lineLength = line.length();
+        const QPointF normal = lineLength > 0.001 ? QPointF{ -line.dy(), line.dx() } / lineLength : QPointF{0., 0.};
+        const QPointF offset = normal * ( cache.fanOffset * 4. / 3. );    // Cubic apex is at 3/4 of control points offset
+        const QPointF delta = cache.p2 - cache.p1;
+        cache.c1 = cache.p1 + delta / 3. + offset;
+        cache.c2 = cache.p1 + delta * 2. / 3. + offset;
         return;
+    }
 
     const auto srcPort = qobject_cast<const qan::PortItem*>(cache.srcItem);
     const auto dstPort = qobject_cast<const qan::PortItem*>(cache.dstItem);
@@ -852,11 +1351,18 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
     }
 
     // Finally, modify p1 and p2 according to c1 and c2
-    cache.p1 = getLineIntersection( cache.c1, cache.srcBrCenter, cache.srcBs);
-    cache.p2 = getLineIntersection( cache.c2, cache.dstBrCenter, cache.dstBs);
+    const QQuickItem* graphContainerItem = getGraph() != nullptr ? getGraph()->getContainerItem() : nullptr;
+    if ( _sourceItem && _destinationItem && graphContainerItem != nullptr ) {
+        cache.p1 = _sourceItem->clipContainerBoundingShape( graphContainerItem, cache.c1 );
+        cache.p2 = _destinationItem->clipContainerBoundingShape( graphContainerItem, cache.c2 );
+    } else {
+        cache.p1 = getLineIntersection( cache.c1, cache.srcBrCenter, cache.srcBs);
+        cache.p2 = getLineIntersection( cache.c2, cache.dstBrCenter, cache.dstBs);
+    }
 }
 
 
+template <class Policy>
 void    EdgeItem::generateLabelPosition(GeometryCache& cache) const noexcept
 {
     // PRECONDITIONS:
@@ -864,17 +1370,22 @@ void    EdgeItem::generateLabelPosition(GeometryCache& cache) const noexcept
     if ( !cache.isValid() )
         return;
 
-    const QLineF line{cache.p1, cache.p2};
-    if ( cache.lineType == qan::EdgeStyle::LineType::Straight ) {
+    if ( Policy::lineType == qan::EdgeStyle::LineType::Straight ) {
+        const QLineF line{cache.p1, cache.p2};
         cache.labelPosition = line.pointAt(0.5) + QPointF{10., 10.};
-    } else if ( cache.lineType == qan::EdgeStyle::LineType::Curved ) {
-        // Get the barycenter of polygon p1/p2/c1/c2
-        QPolygonF p{ {cache.p1, cache.p2, cache.c1, cache.c2 } };
-        if (!p.isEmpty())
-            cache.labelPosition = p.boundingRect().center();
-    }
+    } else if ( Policy::lineType == qan::EdgeStyle::LineType::Curved ) {
+        // Get the center of p1/p2/c1/c2 bounding rect
+        const qreal x1 = std::min({cache.p1.x(), cache.p2.x(), cache.c1.x(), cache.c2.x()});
+        const qreal x2 = std::max({cache.p1.x(), cache.p2.x(), cache.c1.x(), cache.c2.x()});
+        const qreal y1 = std::min({cache.p1.y(), cache.p2.y(), cache.c1.y(), cache.c2.y()});
+        const qreal y2 = std::max({cache.p1.y(), cache.p2.y(), cache.c1.y(), cache.c2.y()});
+        cache.labelPosition = QPointF{(x1 + x2) / 2., (y1 + y2) / 2.};
+    } else if ( Policy::lineType == qan::EdgeStyle::LineType::Custom &&
+                !cache.route.isEmpty() )
+        cache.labelPosition = cache.route[cache.route.size() / 2] + QPointF{10., 10.};
 }
 
+template <class Policy>
 void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
 {
     // PRECONDITIONS:
@@ -891,12 +1402,23 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
 
     const QQuickItem*   graphContainerItem = getGraph() != nullptr ? getGraph()->getContainerItem() : nullptr;
     if ( graphContainerItem != nullptr ) {
-        QPolygonF edgeBrPolygon;
-        edgeBrPolygon << cache.p1 << cache.p2;
-        if ( cache.lineType == qan::EdgeStyle::LineType::Curved )
-            edgeBrPolygon << cache.c1 << cache.c2;
-        //QRectF lineBr = QRectF{cache.p1, cache.p2}.normalized();  // Generate a Br with intersection points
-        const QRectF edgeBr = edgeBrPolygon.boundingRect();
+        // Generate edge Br from p1/p2, control points and route (no temporary polygon, see BM_edge_update_allocations)
+        qreal x1 = std::min(cache.p1.x(), cache.p2.x()), x2 = std::max(cache.p1.x(), cache.p2.x());
+        qreal y1 = std::min(cache.p1.y(), cache.p2.y()), y2 = std::max(cache.p1.y(), cache.p2.y());
+        const auto extend = [&x1, &y1, &x2, &y2](const QPointF& p) noexcept {
+            x1 = std::min(x1, p.x());   x2 = std::max(x2, p.x());
+            y1 = std::min(y1, p.y());   y2 = std::max(y2, p.y());
+        };
+        if ( Policy::lineType == qan::EdgeStyle::LineType::Curved ) {
+            extend(cache.c1);
+            extend(cache.c2);
+        } else if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho )
+            extend(cache.c1);
+        if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho ||
+             Policy::lineType == qan::EdgeStyle::LineType::Custom )
+            for ( const auto& p : cache.route )
+                extend(p);
+        const QRectF edgeBr{QPointF{x1, y1}, QPointF{x2, y2}};
         setPosition( edgeBr.topLeft() );    // Note: setPosition() call must occurs before mapFromItem()
         setSize( edgeBr.size() );
 
@@ -925,17 +1447,43 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
         // Apply control point geometry
             // For otho edge: 3 points for a line P1 -> C1 -> P2
             // For Curved edge: a cubic spline with C1 and C2
-        if ( cache.lineType == qan::EdgeStyle::LineType::Ortho ) {
-            _c1 = mapFromItem(graphContainerItem, cache.c1);
+            // For custom shape: shape polyline (published as an ortho polyline)
+        if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho ||
+             Policy::lineType == qan::EdgeStyle::LineType::Custom ) {
+            if ( Policy::lineType == qan::EdgeStyle::LineType::Ortho )
+                _c1 = mapFromItem(graphContainerItem, cache.c1);
+            _orthoPolyline.clear();
+            if ( cache.route.size() >= 2 ) {    // Route ends are replaced by arrow corrected p1 and p2
+                _orthoPolyline.reserve(cache.route.size());
+                _orthoPolyline << _p1;
+                for ( int p = 1; p < cache.route.size() - 1; ++p )
+                    _orthoPolyline << mapFromItem(graphContainerItem, cache.route[p]);
+                _orthoPolyline << _p2;
+            } else
+                _orthoPolyline << _p1 << _c1 << _p2;
+            _orthoPath = QStringLiteral("M %1 %2").arg(_orthoPolyline[0].x()).arg(_orthoPolyline[0].y());
+            for ( int p = 1; p < _orthoPolyline.size(); ++p )
+                _orthoPath += QStringLiteral(" L %1 %2").arg(_orthoPolyline[p].x()).arg(_orthoPolyline[p].y());
             emit controlPointsChanged();
-        } else if ( cache.lineType == qan::EdgeStyle::LineType::Curved ) { // Apply control point geometry
+        } else if ( Policy::lineType == qan::EdgeStyle::LineType::Curved ) { // Apply control point geometry
             _c1 = mapFromItem(graphContainerItem, cache.c1);
             _c2 = mapFromItem(graphContainerItem, cache.c2);
             emit controlPointsChanged();
         }
+        generateHitPolyline();
 
         setZ(cache.z);
         setLabelPos( mapFromItem(graphContainerItem, cache.labelPosition) );
+
+        // Publish the whole geometry with a single notification
+        _edgeGeometry.p1 = _p1;         _edgeGeometry.p2 = _p2;
+        _edgeGeometry.c1 = _c1;         _edgeGeometry.c2 = _c2;
+        _edgeGeometry.srcA1 = _srcA1;   _edgeGeometry.srcA2 = _srcA2;   _edgeGeometry.srcA3 = _srcA3;
+        _edgeGeometry.srcAngle = _srcAngle;
+        _edgeGeometry.dstA1 = _dstA1;   _edgeGeometry.dstA2 = _dstA2;   _edgeGeometry.dstA3 = _dstA3;
+        _edgeGeometry.dstAngle = _dstAngle;
+        _edgeGeometry.labelPos = _labelPos;
+        emit edgeGeometryChanged();
     }
 
     // Edge item geometry is now valid, set the item visibility to true and "unhide" it
@@ -943,6 +1491,57 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
     setHidden(false);
 }
 
+// Custom shapes geometry path (see registerShape()) is instantiated from user code, with these common steps
+template void   EdgeItem::generatePolicyEnds<qan::CustomEdgeGeometry>(GeometryCache& cache) const noexcept;
+template void   EdgeItem::finalizePolicyGeometry<qan::CustomEdgeGeometry>(GeometryCache& cache) noexcept;
+
+const EdgeItem::GeometryPolicy* EdgeItem::builtinGeometryPolicy(qan::EdgeStyle::LineType lineType) noexcept
+{
+    // Built-in policies in qan::EdgeStyle::LineType order, custom shapes policies are registered in customGeometryPolicies()
+    static const GeometryPolicy policies[] = {
+        { &EdgeItem::generatePolicyEnds<qan::StraightEdgeGeometry>, &EdgeItem::finalizePolicyGeometry<qan::StraightEdgeGeometry> },
+        { &EdgeItem::generatePolicyEnds<qan::CurvedEdgeGeometry>,   &EdgeItem::finalizePolicyGeometry<qan::CurvedEdgeGeometry> },
+        { &EdgeItem::generatePolicyEnds<qan::OrthoEdgeGeometry>,    &EdgeItem::finalizePolicyGeometry<qan::OrthoEdgeGeometry> }
+    };
+    switch ( lineType ) {
+    case qan::EdgeStyle::LineType::Straight:    return &policies[0];
+    case qan::EdgeStyle::LineType::Curved:      return &policies[1];
+    case qan::EdgeStyle::LineType::Ortho:       return &policies[2];
+    case qan::EdgeStyle::LineType::Custom:      break;
+    }
+    return &policies[0];
+}
+
+const EdgeItem::GeometryPolicy* EdgeItem::resolveGeometryPolicy() const noexcept
+{
+    if ( !_style )
+        return builtinGeometryPolicy(qan::EdgeStyle::LineType::Straight);
+    if ( _style->getLineType() == qan::EdgeStyle::LineType::Custom ) {
+        const auto& customPolicies = customGeometryPolicies();
+        const auto customPolicy = customPolicies.constFind(_style->getCustomShape());
+        if ( customPolicy != customPolicies.constEnd() )
+            return customPolicy.value();
+    }
+    return builtinGeometryPolicy(_style->getLineType());   // Unregistered custom shape are drawn as straight lines
+}
+
+QHash<QString, const EdgeItem::GeometryPolicy*>&    EdgeItem::customGeometryPolicies() noexcept
+{
+    static QHash<QString, const GeometryPolicy*> policies;
+    return policies;
+}
+
+bool    EdgeItem::registerGeometryPolicy(const QString& name, const GeometryPolicy* policy) noexcept
+{
+    if ( name.isEmpty() ||
+         policy == nullptr ) {
+        qWarning() << "qan::EdgeItem::registerShape(): Error: Invalid empty shape name.";
+        return false;
+    }
+    customGeometryPolicies().insert(name, policy);
+    return true;
+}
+
 qreal   EdgeItem::lineAngle(const QLineF& line) const noexcept
 {
     static constexpr    qreal Pi = 3.141592653;
@@ -961,7 +1560,23 @@ void    EdgeItem::setLine( QPoint src, QPoint dst )
 {
     _p1 = src;
     _p2 = dst;
+    _geometryKey = GeometryKey{};
+    _orthoPolyline.clear();
+    _orthoPath.clear();
+    generateHitPolyline();
     emit lineGeometryChanged();
+    _edgeGeometry.p1 = _p1;
+    _edgeGeometry.p2 = _p2;
+    emit edgeGeometryChanged();
+}
+
+QLineF  EdgeItem::getShapesIntersection(const GeometryCache& cache) const noexcept
+{
+    const QQuickItem* graphContainerItem = getGraph() != nullptr ? getGraph()->getContainerItem() : nullptr;
+    if ( !_sourceItem || !_destinationItem || graphContainerItem == nullptr )
+        return getLineIntersection( cache.srcBrCenter, cache.dstBrCenter, cache.srcBs, cache.dstBs );
+    return QLineF{ _sourceItem->clipContainerBoundingShape( graphContainerItem, cache.dstBrCenter ),
+                   _destinationItem->clipContainerBoundingShape( graphContainerItem, cache.srcBrCenter ) };
 }
 
 QPointF  EdgeItem::getLineIntersection(const QPointF& p1, const QPointF& p2,
@@ -1061,8 +1676,7 @@ qreal   EdgeItem::cubicCurveAngleAt(qreal pos, const QPointF& start, const QPoin
 /* Mouse Management *///-------------------------------------------------------
 void    EdgeItem::mouseDoubleClickEvent( QMouseEvent* event )
 {
-    const qreal d = distanceFromLine( event->localPos(), QLineF{_p1, _p2} );
-    if ( d > -0.0001 && d < 5. &&
+    if ( hitTest( event->localPos(), 5. ) &&
          event->button() == Qt::LeftButton ) {
         emit edgeDoubleClicked( this, event->localPos() );
         event->accept();
@@ -1087,21 +1701,124 @@ void    EdgeItem::mousePressEvent( QMouseEvent* event )
         event->ignore();
 }
 
-qreal   EdgeItem::distanceFromLine( const QPointF& p, const QLineF& line ) const noexcept
+void    EdgeItem::pickedClick( Qt::MouseButton button, const QPointF& pos, bool doubleClick ) noexcept
 {
-    // Inspired by DistancePointLine Unit Test, Copyright (c) 2002, All rights reserved
-    // Damian Coventry  Tuesday, 16 July 2002
-    static constexpr    qreal MinLength = 0.00001;
-    const qreal lLength = line.length();
-    if ( lLength < MinLength )
-        return -1.; // Protect generation of u from DIV0
-    const qreal u  = ( ( ( p.x() - line.x1() ) * ( line.x2() - line.x1() ) ) +
-                     ( ( p.y() - line.y1() ) * ( line.y2() - line.y1() ) ) ) / ( lLength * lLength );
-    if ( u < 0. || u > 1. )
-        return -1.;
-    const QPointF i { line.x1() + u * ( line.x2() - line.x1() ),
-                      line.y1() + u * ( line.y2() - line.y1() ) };
-    return QLineF{p, i}.length();
+    if ( doubleClick ) {
+        if ( button == Qt::LeftButton )
+            emit edgeDoubleClicked( this, pos );
+    } else if ( button == Qt::LeftButton )
+        emit edgeClicked( this, pos );
+    else if ( button == Qt::RightButton )
+        emit edgeRightClicked( this, pos );
+}
+
+void    EdgeItem::generateHitPolyline() noexcept
+{
+    _hitPolyline.clear();
+    _hitTree.clear();
+    _hitLeafCount = 0;
+
+    auto lineType = _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    if ( !qFuzzyIsNull(_fanOffset) )            // Fanned parallel edges are drawn as curves
+        lineType = qan::EdgeStyle::LineType::Curved;
+    switch (lineType) {
+    case qan::EdgeStyle::LineType::Straight:
+        _hitPolyline << _p1 << _p2;
+        break;
+    case qan::EdgeStyle::LineType::Ortho:       // [[fallthrough]]
+    case qan::EdgeStyle::LineType::Custom:
+        if ( _orthoPolyline.size() >= 2 )     // Note: copy points, sharing would detach (and allocate) on next clear()
+            for ( const auto& p : _orthoPolyline )
+                _hitPolyline << p;
+        else
+            _hitPolyline << _p1 << _c1 << _p2;
+        break;
+    case qan::EdgeStyle::LineType::Curved: {
+        // Flatten cubic (p1, c1, c2, p2), one segment every ~8px of control polygon length
+        const qreal controlLength = QLineF{_p1, _c1}.length() + QLineF{_c1, _c2}.length() + QLineF{_c2, _p2}.length();
+        const int segments = qBound(8, static_cast<int>(controlLength / 8.), 128);
+        _hitPolyline.reserve(segments + 1);
+        for (int s = 0; s <= segments; ++s) {
+            const qreal t = static_cast<qreal>(s) / segments;
+            const qreal mt = 1. - t;
+            const qreal b0 = mt * mt * mt;
+            const qreal b1 = 3. * mt * mt * t;
+            const qreal b2 = 3. * mt * t * t;
+            const qreal b3 = t * t * t;
+            _hitPolyline << QPointF{b0 * _p1.x() + b1 * _c1.x() + b2 * _c2.x() + b3 * _p2.x(),
+                                    b0 * _p1.y() + b1 * _c1.y() + b2 * _c2.y() + b3 * _p2.y()};
+        }
+    }
+        break;
+    }
+
+    // Build bounding box hierarchy bottom up
+    const int segmentCount = _hitPolyline.size() - 1;
+    int leafCount = 1;
+    while (leafCount < segmentCount)
+        leafCount *= 2;
+    _hitLeafCount = leafCount;
+    _hitTree.resize(static_cast<std::size_t>(2 * leafCount));
+    for (int s = 0; s < segmentCount; ++s) {
+        const auto& a = _hitPolyline[s];
+        const auto& b = _hitPolyline[s + 1];
+        _hitTree[static_cast<std::size_t>(leafCount + s)] = HitBox{ std::min(a.x(), b.x()), std::min(a.y(), b.y()),
+                                                                   std::max(a.x(), b.x()), std::max(a.y(), b.y()) };
+    }
+    for (int n = leafCount - 1; n >= 1; --n) {
+        const auto& l = _hitTree[static_cast<std::size_t>(2 * n)];
+        const auto& r = _hitTree[static_cast<std::size_t>(2 * n + 1)];
+        if (l.x1 > l.x2)
+            _hitTree[static_cast<std::size_t>(n)] = r;
+        else if (r.x1 > r.x2)
+            _hitTree[static_cast<std::size_t>(n)] = l;
+        else
+            _hitTree[static_cast<std::size_t>(n)] = HitBox{ std::min(l.x1, r.x1), std::min(l.y1, r.y1),
+                                                            std::max(l.x2, r.x2), std::max(l.y2, r.y2) };
+    }
+}
+
+bool    EdgeItem::hitTest( const QPointF& point, qreal tolerance ) const noexcept
+{
+    if ( _hidden ||
+         _hitLeafCount == 0 ||
+         _hitPolyline.size() < 2 )
+        return false;
+
+    const qreal tolerance2 = tolerance * tolerance;
+    const auto segmentDistance2 = [point](const QPointF& a, const QPointF& b) -> qreal {
+        const qreal dx = b.x() - a.x();
+        const qreal dy = b.y() - a.y();
+        const qreal l2 = dx * dx + dy * dy;
+        qreal u = 0.;
+        if ( l2 > 0.00001 )
+            u = qBound(0., ( ( point.x() - a.x() ) * dx + ( point.y() - a.y() ) * dy ) / l2, 1.);
+        const qreal ix = a.x() + u * dx - point.x();
+        const qreal iy = a.y() + u * dy - point.y();
+        return ix * ix + iy * iy;
+    };
+
+    // Depth first traversal of boxes containing point (inflated by tolerance), using an explicit stack
+    int stack[64];
+    int top = 0;
+    stack[top++] = 1;
+    while (top > 0) {
+        const int n = stack[--top];
+        const auto& box = _hitTree[static_cast<std::size_t>(n)];
+        if ( box.x1 > box.x2 ||
+             point.x() < box.x1 - tolerance || point.x() > box.x2 + tolerance ||
+             point.y() < box.y1 - tolerance || point.y() > box.y2 + tolerance )
+            continue;
+        if ( n >= _hitLeafCount ) {
+            const int s = n - _hitLeafCount;
+            if ( segmentDistance2(_hitPolyline[s], _hitPolyline[s + 1]) < tolerance2 )
+                return true;
+        } else {
+            stack[top++] = 2 * n + 1;
+            stack[top++] = 2 * n;
+        }
+    }
+    return false;
 }
 //-----------------------------------------------------------------------------
 
@@ -1113,21 +1830,16 @@ void    EdgeItem::setStyle( EdgeStyle* style ) noexcept
             QObject::disconnect( _style, nullptr,
                                  this,   nullptr );
         _style = style;
+        _geometryPolicy = resolveGeometryPolicy();
         if ( _style ) {
             connect( _style,    &QObject::destroyed,    // Monitor eventual style destruction
                      this,      &EdgeItem::styleDestroyed );
             // Note 20170909: _style.styleModified() signal is _not_ binded to updateItem() slot, since
             // it would be very unefficient to update edge for properties change affecting only
             // edge visual item (for example, _stye.lineWidth modification is watched directly
-            // from edge delegate). Since arrowSize affect concrete edge geometry, bind it manually to
-            // updateItem().
-            connect( _style,    &qan::EdgeStyle::arrowSizeChanged,
-                     this,      &EdgeItem::styleModified );
-            connect( _style,    &qan::EdgeStyle::lineTypeChanged,
-                     this,      &EdgeItem::styleModified );
-            connect( _style,    &qan::EdgeStyle::srcShapeChanged,   // FIXME: Add intelligent updating
-                     this,      &EdgeItem::styleModified );
-            connect( _style,    &qan::EdgeStyle::dstShapeChanged,   // FIXME: Add intelligent updating
+            // from edge delegate). Only geometryModified() (lineType, arrowSize, srcShape and dstShape)
+            // trigger a (batched) geometry update.
+            connect( _style,    &qan::EdgeStyle::geometryModified,
                      this,      &EdgeItem::styleModified );
         }
         emit styleChanged();
@@ -1143,15 +1855,29 @@ void    EdgeItem::styleDestroyed( QObject* style )
 
 void    EdgeItem::styleModified()
 {
-    if ( getStyle() != nullptr ) {
-        _arrowSize = getStyle()->getArrowSize();
+    const auto style = getStyle();
+    if ( style == nullptr )
+        return;
+    // Note: a shared style may be used by thousands of edges, only notify modified values and
+    // schedule geometry generation for next frame, graph will update all dirty edges in batch.
+    _geometryPolicy = resolveGeometryPolicy();      // lineType or customShape might have been modified
+    if ( !qFuzzyCompare( 1. + _arrowSize, 1. + style->getArrowSize() ) ) {
+        _arrowSize = style->getArrowSize();
         emit arrowSizeChanged();
-        _srcShape = getStyle()->getSrcShape();
+    }
+    if ( _srcShape != style->getSrcShape() ) {
+        _srcShape = style->getSrcShape();
         emit srcShapeChanged();
-        _dstShape = getStyle()->getDstShape();
+    }
+    if ( _dstShape != style->getDstShape() ) {
+        _dstShape = style->getDstShape();
         emit dstShapeChanged();
-        updateItem();
     }
+    const auto graph = getGraph();
+    if ( graph != nullptr )
+        graph->scheduleEdgeItemUpdate( this );
+    else
+        updateItem();
 }
 //-----------------------------------------------------------------------------
 
@@ -1159,26 +1885,7 @@ void    EdgeItem::styleModified()
 /* Drag'nDrop Management *///--------------------------------------------------
 bool    EdgeItem::contains(const QPointF& point) const
 {
-    const auto lineType = _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
-    bool r = false;
-    qreal d;
-    switch (lineType) {
-    case qan::EdgeStyle::LineType::Straight:
-        d = distanceFromLine(point, QLineF{_p1, _p2});
-        r = ( d > 0. && d < 5. );
-        break;
-    case qan::EdgeStyle::LineType::Curved:
-        break;
-    case qan::EdgeStyle::LineType::Ortho:
-        d = distanceFromLine(point, QLineF{_p1, _c1});
-        r = ( d > 0. && d < 5. );
-        if (!r) {
-            const qreal d2 = distanceFromLine(point, QLineF{_p2, _c1});
-            r = ( d2 > 0. && d2 < 5. );
-        }
-        break;
-    }
-    return r;
+    return hitTest(point, 5.);
 }
 
 void    EdgeItem::dragEnterEvent( QDragEnterEvent* event )
@@ -1210,8 +1917,7 @@ void    EdgeItem::dragEnterEvent( QDragEnterEvent* event )
 void	EdgeItem::dragMoveEvent( QDragMoveEvent* event )
 {
     if ( getAcceptDrops() ) {
-        qreal d = distanceFromLine( event->posF( ), QLineF{_p1, _p2} );
-        if ( d > 0. && d < 5. )
+        if ( hitTest( event->posF( ), 5. ) )
             event->accept();
         else event->ignore();
     }
@@ -1227,22 +1933,28 @@ void	EdgeItem::dragLeaveEvent( QDragLeaveEvent* event )
 
 void    EdgeItem::dropEvent( QDropEvent* event )
 {
-    if ( getAcceptDrops() && event->source() != nullptr ) { // Get the source item from the quick drag attached object received
-        QVariant source = event->source()->property( "source" );
-        if ( source.isValid() ) {
-            QQuickItem* sourceItem = source.value< QQuickItem* >( );
-            QVariant draggedStyle = sourceItem->property( "draggedEdgeStyle" ); // The source item (usually a style node or edge delegate must expose a draggedStyle property.
-            if ( draggedStyle.isValid() ) {
-                qan::EdgeStyle* draggedEdgeStyle = draggedStyle.value< qan::EdgeStyle* >( );
-                if ( draggedEdgeStyle != nullptr ) {
-                    setStyle( draggedEdgeStyle );
-                    event->accept();
-                }
-            }
+    if ( getAcceptDrops() ) {
+        const auto draggedEdgeStyle = getDraggedEdgeStyle( event );
+        if ( draggedEdgeStyle != nullptr ) {
+            setStyle( draggedEdgeStyle );
+            event->accept();
         }
     }
     QQuickItem::dropEvent( event );
 }
+
+qan::EdgeStyle* EdgeItem::getDraggedEdgeStyle( const QDropEvent* event ) noexcept
+{
+    if ( event == nullptr ||
+         event->source() == nullptr )
+        return nullptr;
+    const QVariant source = event->source()->property( "source" );    // Get the source item from the quick drag attached object received
+    const auto sourceItem = source.isValid() ? source.value< QQuickItem* >( ) : nullptr;
+    if ( sourceItem == nullptr )
+        return nullptr;
+    const QVariant draggedStyle = sourceItem->property( "draggedEdgeStyle" ); // The source item (usually a style node or edge delegate must expose a draggedStyle property.
+    return draggedStyle.isValid() ? draggedStyle.value< qan::EdgeStyle* >( ) : nullptr;
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
@@ -35,14 +35,20 @@
 #ifndef qanEdgeItem_h
 #define qanEdgeItem_h
 
+// Std headers
+#include <vector>
+
 // Qt headers
 #include <QLineF>
+#include <QHash>
 
 // QuickQanava headers
 #include "./qanGraphConfig.h"
 #include "./qanStyle.h"
 #include "./qanNodeItem.h"
 #include "./qanNode.h"
+#include "./qanEdgeGeometry.h"
+#include "./qanEdgeGeometryPolicy.h"
 
 namespace qan { // ::qan
 
@@ -68,12 +74,15 @@ public:
     EdgeItem( const EdgeItem& ) = delete;
 
 public:
-    Q_PROPERTY( qan::Edge* edge READ getEdge CONSTANT FINAL )
+    Q_PROPERTY( qan::Edge* edge READ getEdge NOTIFY edgeChanged FINAL )
     auto        getEdge() noexcept -> qan::Edge*;
     auto        getEdge() const noexcept -> const qan::Edge*;
     auto        setEdge(qan::Edge* edge) noexcept -> void;
 private:
     QPointer<qan::Edge>    _edge;
+signals:
+    //! Emitted when item is bound to another edge (recycled items, see qan::Graph::itemPoolSize).
+    void        edgeChanged();
 
 public:
     Q_PROPERTY( qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged )
@@ -109,6 +118,10 @@ private:
 signals:
     void                    destinationItemChanged( );
 
+public:
+    //! Disconnect and clear source and destination items (used when item is recycled, see qan::Graph::itemPoolSize).
+    void                    resetEndpoints() noexcept;
+
 protected:
     //! Configure either a node or an edge (for hyper edges) item.
     void            configureDestinationItem( QQuickItem* item );
@@ -131,6 +144,45 @@ signals:
 private:
     bool        _hidden{false};
 
+public:
+    /*! \brief True when edge ends lie fully outside graph culling area (see qan::Graph::viewportCulling), read-only.
+     *
+     * A culled edge is \c hidden and its geometry is not generated until it is unculled by qan::Graph.
+     */
+    Q_PROPERTY( bool culled READ getCulled NOTIFY culledChanged FINAL )
+    inline bool     getCulled() const noexcept { return _culled; }
+    //! Bounding rect of edge ends in graph container CS when edge has been culled.
+    inline const QRectF&    getCulledBr() const noexcept { return _culledBr; }
+    //! Reset culled state, geometry is regenerated (or item culled again) on next updateItem() (called by qan::Graph).
+    void        uncull() noexcept;
+signals:
+    void        culledChanged();
+private:
+    bool        _culled{false};
+    QRectF      _culledBr;
+
+public:
+    /*! \brief Signed offset of this edge curve from its nodes center line when it has parallel edges, read-only.
+     *
+     * Set when qan::Graph::parallelEdgeSpacing is not 0: edges connecting the same nodes pair are fanned around
+     * their center line, an edge with a non 0 offset is drawn as a curved edge whatever its style line type.
+     */
+    Q_PROPERTY( qreal fanOffset READ getFanOffset NOTIFY fanChanged FINAL )
+    inline qreal    getFanOffset() const noexcept { return _fanOffset; }
+    //! Number of parallel edges connecting this edge nodes pair, this edge included (1 when edge is not fanned), read-only.
+    Q_PROPERTY( int fanCount READ getFanCount NOTIFY fanChanged FINAL )
+    inline int      getFanCount() const noexcept { return _fanCount; }
+    //! True when this edge is drawn for its whole collapsed parallel edges set (see qan::Graph::parallelEdgeCollapseZoom), read-only.
+    Q_PROPERTY( bool fanCollapsed READ getFanCollapsed NOTIFY fanChanged FINAL )
+    inline bool     getFanCollapsed() const noexcept { return _fanCollapsed; }
+signals:
+    void        fanChanged();
+private:
+    void        setFan(qreal fanOffset, int fanCount, bool fanCollapsed) noexcept;
+    qreal       _fanOffset{0.};
+    int         _fanCount{1};
+    bool        _fanCollapsed{false};
+
 public:
     Q_PROPERTY( qreal arrowSize READ getArrowSize WRITE setArrowSize NOTIFY arrowSizeChanged FINAL )
     void            setArrowSize( qreal arrowSize ) noexcept;
@@ -170,9 +222,22 @@ signals:
     void                dstShapeChanged();
 
 public slots:
-    //! Call updateItem() (override updateItem() to an empty method for invisible edges).
-    virtual void        updateItemSlot( ) { updateItem(); }
+    /*! \brief Schedule an updateItem() call before next frame (override updateItem() to an empty method for invisible edges).
+     *
+     * Slot is connected to source and destination x, y, width and height notify signals, multiple notifications
+     * are coalesced in a single updateItem() call by qan::Graph::scheduleEdgeItemUpdate().
+     */
+    virtual void        updateItemSlot( );
+    /*! \brief Schedule an updateZ() call before next frame.
+     *
+     * Slot is connected to source and destination z notify signals: restacking an edge does not regenerate its geometry,
+     * multiple notifications are coalesced in a single updateZ() call by qan::Graph::scheduleEdgeItemRestack().
+     */
+    void                updateZSlot();
 public:
+    //! Set edge z below its source and destination global z, edge geometry is left unmodified (see updateZSlot()).
+    void                updateZ() noexcept;
+
     /*! \brief Update edge bounding box according to source and destination item actual position and size.
      *
      * \note When overriding, call base implementation at the beginning of user implementation.
@@ -180,7 +245,64 @@ public:
      */
     virtual void        updateItem() noexcept;
 
+    /*! \brief Update a batch of edge items geometry, equivalent to calling updateItem() on every item.
+     *
+     * Straight and curved edges between non port qan::NodeItem with a default (rounded rectangle) bounding shape
+     * have their ends, hidden state and straight arrow angles generated in a single vectorized pass
+     * with qan::generateEdgeGeometryBatch(). Other edges (ortho edges, ports, complex bounding shapes,
+     * transformed items or C++ qan::EdgeItem subclasses that might override updateItem()) fallback to the
+     * per edge path.
+     *
+     * \note Must be called from GUI thread: batch storage is a static scratch area reused across calls, once grown to
+     * the largest updated set, updating straight and curved edges geometry does not allocate (see BM_edge_update_allocations).
+     */
+    static void         updateItems(const std::vector<qan::EdgeItem*>& edgeItems) noexcept;
+
+    //! Force a complete geometry regeneration (called by qan::OrthoRouter when this edge route is available or modified).
+    void                routeModified() noexcept;
+
+    /*! \brief Translate edge current geometry by \c delta when both edge ends have been moved by \c delta (used for group moves).
+     *
+     * \return false if geometry can't be translated (no valid geometry, culled edge or an edge moving out of view, C++
+     * subclass that might override updateItem()), edge is then left unmodified and updateItem() must be called.
+     */
+    bool                translateGeometry(const QPointF& delta) noexcept;
+
+public:
+    /*! \brief Register a custom C++ edge \c Shape with name \c name (see qan::EdgeShapeGeometry), select it with qan::EdgeStyle::customShape.
+     *
+     * \c Shape::generate() is instantiated in a dedicated geometry generation path, register shapes before
+     * styles using them are applied (registering a name again replace its shape).
+     * \return false if \c name is empty.
+     */
+    template <class Shape>
+    static bool         registerShape(const QString& name) noexcept;
+
 protected:
+    struct GeometryCache;
+
+    /*! \brief Edge geometry generation steps specialized for a geometry policy (see qan::StraightEdgeGeometry).
+     *
+     * Resolved once from style line type (see resolveGeometryPolicy()), updateItem() then run the policy steps with no
+     * line type switch.
+     */
+    struct GeometryPolicy {
+        //! Generate edge ends, see generatePolicyEnds().
+        void    (EdgeItem::*generateEnds)(GeometryCache&) const;
+        //! Generate control points, arrows and label, then apply (or hide) geometry, see finalizePolicyGeometry().
+        void    (EdgeItem::*finalizeGeometry)(GeometryCache&);
+    };
+    //! Return geometry policy for actual style (straight policy when there is no style or when custom shape is not registered).
+    const GeometryPolicy*   resolveGeometryPolicy() const noexcept;
+    //! Return built-in geometry policy for \c lineType (straight policy for custom shapes).
+    static const GeometryPolicy*    builtinGeometryPolicy(qan::EdgeStyle::LineType lineType) noexcept;
+    //! Register \c policy for custom shape \c name.
+    static bool             registerGeometryPolicy(const QString& name, const GeometryPolicy* policy) noexcept;
+    //! Custom shapes policies, indexed by shape name (GUI thread only).
+    static QHash<QString, const GeometryPolicy*>&   customGeometryPolicies() noexcept;
+    //! Policy for actual style, updated when style is set or modified.
+    const GeometryPolicy*   _geometryPolicy{nullptr};
+
      /*! Cache current edge geometry state.
       *
       * \note Edge geometry cache is expressed in _graph global coordinate system_. Projection into
@@ -193,6 +315,7 @@ protected:
         GeometryCache(GeometryCache&& rha) :
             valid{rha.valid},
             lineType{rha.lineType},
+            policy{rha.policy},
             z{rha.z},
             hidden{rha.hidden},
             srcBs{std::move(rha.srcBs)},    dstBs{std::move(rha.dstBs)},
@@ -209,7 +332,15 @@ protected:
             srcA3{std::move(rha.srcA3)},
             srcAngle{rha.srcAngle},
             c1{std::move(rha.c1)},          c2{std::move(rha.c2)},
-            labelPosition{std::move(rha.labelPosition)}
+            route{std::move(rha.route)},
+            labelPosition{std::move(rha.labelPosition)},
+            arrowAnglesGenerated{rha.arrowAnglesGenerated},
+            fanOffset{rha.fanOffset},
+            fanCount{rha.fanCount},
+            fanCollapsed{rha.fanCollapsed},
+            fanHidden{rha.fanHidden},
+            fanReversed{rha.fanReversed},
+            fanLeader{rha.fanLeader}
         {
             srcItem.swap(rha.srcItem);
             dstItem.swap(rha.dstItem);
@@ -221,6 +352,7 @@ protected:
         QPointer<const QQuickItem>  srcItem{nullptr};
         QPointer<const QQuickItem>  dstItem{nullptr};
         qan::EdgeStyle::LineType    lineType{qan::EdgeStyle::LineType::Straight};
+        const GeometryPolicy*       policy{nullptr};
 
         qreal   z{0.};
 
@@ -241,10 +373,112 @@ protected:
 
         QPointF c1, c2;
 
+        //! Ortho edge route generated by qan::OrthoRouter (empty when edge is not routed), or custom shape polyline from p1 to p2.
+        QPolygonF   route;
+
         QPointF labelPosition;
+
+        //! True when straight line p1/p2 arrow correction and src/dst angles have already been generated (see updateItems()).
+        bool    arrowAnglesGenerated{false};
+
+        //! Parallel edges fan, see GeometryKey (an edge with a non 0 fan offset get its ends from generateFanEnds()).
+        qreal   fanOffset{0.};
+        int     fanCount{1};
+        bool    fanCollapsed{false};
+        bool    fanHidden{false};
+        bool    fanReversed{false};
+        const EdgeItem* fanLeader{nullptr};
     };
     inline GeometryCache    generateGeometryCache() const noexcept;
 
+    /*! \brief Geometry generation inputs, used to avoid regenerating an unchanged edge geometry.
+     *
+     * Key store source/destination items container space corners, local bounding shapes, style parameters
+     * and collapsed state: when two keys differ only by a common translation of both ends, edge geometry
+     * is translated, when they are equal geometry generation is skipped.
+     */
+    struct GeometryKey {
+        inline auto isValid() const noexcept -> bool { return valid; }
+        bool        valid{false};
+        const QQuickItem*   srcItem{nullptr};
+        const QQuickItem*   dstItem{nullptr};
+        QPointF     srcTopLeft, srcBottomRight;     // Container CS
+        QPointF     dstTopLeft, dstBottomRight;
+        QPolygonF   srcShape, dstShape;             // Item CS (implicitly shared with items bounding shape)
+        qreal       z{0.};
+        qan::EdgeStyle::LineType    lineType{qan::EdgeStyle::LineType::Straight};
+        const GeometryPolicy*       policy{nullptr};
+        qreal       arrowSize{0.};
+        int         srcArrowShape{0}, dstArrowShape{0};
+        int         srcDock{-1}, dstDock{-1};
+        bool        srcCollapsed{false}, dstCollapsed{false};
+        //! Parallel edges fan: offset from nodes center line, siblings count, collapsed set representative or hidden sibling.
+        qreal       fanOffset{0.};
+        int         fanCount{1};
+        bool        fanCollapsed{false}, fanHidden{false};
+        //! True when edge direction is opposite to its fan leader (the sibling with lowest id) direction.
+        bool        fanReversed{false};
+        const EdgeItem*     fanLeader{nullptr};
+
+        //! Return true if this and \c other have the same inputs except for a translation \c delta of both ends and z.
+        auto        isTranslationOf(const GeometryKey& other, QPointF& delta) const noexcept -> bool;
+    };
+    //! Generate current geometry key (return an invalid key if there is no valid source or destination).
+    GeometryKey             generateGeometryKey() const noexcept;
+
+    /*! \brief Update edge from its previous geometry when \c key is equal or a translation of previous geometry key.
+     *
+     * \return true if edge geometry is up to date, false if a full geometry generation is necessary.
+     */
+    bool                    applyGeometryKey(const GeometryKey& key) noexcept;
+
+    //! Key of latest applied geometry (invalid if geometry must be regenerated).
+    GeometryKey             _geometryKey;
+
+    /*! \brief Generate \c key parallel edges fan with the graph adjacency index (see qan::Graph::parallelEdgeSpacing).
+     *
+     * Siblings are straight or curved edges connecting the same non port items in either direction, ordered by edge id,
+     * complexity is O(parallel edges count).
+     */
+    void                    generateFan(GeometryKey& key) const noexcept;
+
+    //! Report \c key fan in \c cache, a non 0 fan offset edge use curved geometry policy.
+    void                    applyFan(const GeometryKey& key, GeometryCache& cache) const noexcept;
+
+    //! Generate a fanned edge ends from its nodes center line clipping, shared by siblings and computed once per pair.
+    void                    generateFanEnds(GeometryCache& cache) const noexcept;
+
+    //! Nodes center line clipping of a parallel edges set, cached in fan leader item, expressed in leader direction.
+    struct FanEnds {
+        bool        valid{false};
+        QRectF      srcBr, dstBr;
+        QPolygonF   srcBs, dstBs;       // Implicitly shared with cache bounding shapes
+        QPointF     p1, p2;
+        bool        hidden{false};
+    };
+    mutable FanEnds         _fanEnds;
+
+    //! Cull (hide and skip geometry generation) edge if \c key ends lie outside graph culling area, return true if edge is culled.
+    bool                    cullItem(const GeometryKey& key) noexcept;
+
+    //! Generate edge ends (GeometryCache::p1 and GeometryCache::p2) with cache geometry policy.
+    inline void             generateEnds(GeometryCache& cache) const noexcept;
+
+    //! Generate edge control points, arrows and label from a cache with valid ends, then apply (or hide) geometry with cache geometry policy.
+    inline void             finalizeGeometry(GeometryCache& cache) noexcept;
+
+    //! Generate edge ends for geometry policy \c Policy.
+    template <class Policy>
+    void                    generatePolicyEnds(GeometryCache& cache) const noexcept;
+
+    //! Generate edge control points, arrows and label, then apply (or hide) geometry for geometry policy \c Policy.
+    template <class Policy>
+    void                    finalizePolicyGeometry(GeometryCache& cache) noexcept;
+
+    //! Generate custom \c Shape polyline (in GeometryCache::route) from a cache with valid ends, then finalize it as a qan::CustomEdgeGeometry.
+    template <class Shape>
+    void                    finalizeShapeGeometry(GeometryCache& cache) noexcept;
+
     /*! \brief Generate edge line source and destination points (GeometryCache::p1 and GeometryCache::p2). */
     inline void             generateStraightEnds(GeometryCache& cache) const noexcept;
 
@@ -255,6 +489,7 @@ protected:
      *
      * \note Line geometry may (cache.p1 and cache.p2) could be modified to fit arrow geometry.
      */
+    template <class Policy>
     inline void             generateArrowGeometry(GeometryCache& cache) const noexcept;
 
     //! Generate arrow angle for a curved edge points.
@@ -272,9 +507,11 @@ protected:
     inline void             generateCurvedControlPoints(GeometryCache& cache) const noexcept;
 
     //! Generate edge line label position.
+    template <class Policy>
     inline void             generateLabelPosition(GeometryCache& cache) const noexcept;
 
     //! Apply a final valid geometry cache to this.
+    template <class Policy>
     inline void             applyGeometry(const GeometryCache& cache) noexcept;
 
     /*! Return line angle on line \c line.
@@ -299,6 +536,11 @@ protected:
 protected:
     QPointF         getLineIntersection( const QPointF& p1, const QPointF& p2, const QPolygonF& polygon ) const noexcept;
     QLineF          getLineIntersection( const QPointF& p1, const QPointF& p2, const QPolygonF& srcBp, const QPolygonF& dstBp ) const noexcept;
+    /*! \brief Intersect line (srcBrCenter, dstBrCenter) with source and destination bounding shapes.
+     *
+     * Use source and destination node items cached container bounding shape clipping (see qan::NodeItem::clipContainerBoundingShape()).
+     */
+    QLineF          getShapesIntersection( const GeometryCache& cache ) const noexcept;
     //@}
     //-------------------------------------------------------------------------
 
@@ -313,6 +555,16 @@ public:
     Q_PROPERTY( QPointF c2 READ getC2() NOTIFY controlPointsChanged FINAL )
     //! \copydoc c2
     inline  auto    getC2() const noexcept -> const QPointF& { return _c2; }
+    /*! \brief Ortho edge polyline as an SVG path in item CS (empty for straight and curved edges).
+     *
+     * Polyline is p1 -> c1 -> p2 for an unrouted edge, or the edge route when graph \c orthoRouting is enabled. For
+     * qan::EdgeStyle::LineType::Custom edges, polyline is generated by style custom shape (see registerShape()).
+     */
+    Q_PROPERTY( QString orthoPath READ getOrthoPath NOTIFY controlPointsChanged FINAL )
+    //! \copydoc orthoPath
+    inline  auto    getOrthoPath() const noexcept -> const QString& { return _orthoPath; }
+    //! Ortho edge polyline in item CS (empty for straight and curved edges).
+    inline  auto    getOrthoPolyline() const noexcept -> const QPolygonF& { return _orthoPolyline; }
 signals:
     //! \copydoc c1
     void            controlPointsChanged();
@@ -321,6 +573,9 @@ private:
     QPointF         _c1;
     //! \copydoc c2
     QPointF         _c2;
+    //! \copydoc orthoPath
+    QString         _orthoPath;
+    QPolygonF       _orthoPolyline;
 
 protected:
     /*! Return cubic curve angle at position \c pos between [0.; 1.] on curve defined by \c start, \c end and controls points \c c1 and \c c2.
@@ -411,9 +666,47 @@ signals:
     void            edgeClicked( qan::EdgeItem* edge, QPointF pos );
     void            edgeRightClicked( qan::EdgeItem* edge, QPointF pos );
     void            edgeDoubleClicked( qan::EdgeItem* edge, QPointF pos );
+public:
+    //! Emit edgeClicked(), edgeRightClicked() or edgeDoubleClicked() for a click resolved by graph central picking (\c pos in item CS).
+    void            pickedClick( Qt::MouseButton button, const QPointF& pos, bool doubleClick = false ) noexcept;
+protected:
+    /*! \brief Generate edge hit polyline (in item CS) from actual p1, p2, c1 and c2 geometry.
+     *
+     * Curved lines are flattened to a polyline (segment count depend on control polygon length), a
+     * bounding box hierarchy is built over polyline segments to make hitTest() O(log(segments)).
+     * \note Called from applyGeometry() and setLine().
+     */
+    void            generateHitPolyline() noexcept;
+
+    //! Return true if \c point (in item CS) is closer than \c tolerance from edge hit polyline.
+    bool            hitTest( const QPointF& point, qreal tolerance ) const noexcept;
+
+    //! Edge hit polyline in item CS (empty for an hidden edge).
+    inline auto     getHitPolyline() const noexcept -> const QPolygonF& { return _hitPolyline; }
 private:
-    //! Return orthogonal distance between point \c p and \c line, or -1 on error.
-    inline qreal    distanceFromLine( const QPointF& p, const QLineF& line ) const noexcept;
+    //! Axis aligned bounding box used in hit polyline bounding box hierarchy (empty when x1 > x2).
+    struct HitBox {
+        qreal x1{1.}, y1{1.}, x2{0.}, y2{0.};
+    };
+    QPolygonF               _hitPolyline;
+    //! Implicit complete binary tree over _hitPolyline segments: node i children are 2i and 2i + 1, leaves start at _hitLeafCount.
+    std::vector<HitBox>     _hitTree;
+    int                     _hitLeafCount{0};
+
+public:
+    /*! \brief Complete edge geometry (line, control points, arrows and label), updated with a single edgeGeometryChanged() notification.
+     *
+     * Prefer binding to \c edgeGeometry rather than to individual p1, p2, c1, c2, arrow and labelPos properties in
+     * edge delegates: every individual property notify signal is emitted during a geometry update.
+     */
+    Q_PROPERTY( qan::EdgeGeometry edgeGeometry READ getEdgeGeometry NOTIFY edgeGeometryChanged FINAL )
+    inline  auto    getEdgeGeometry() const noexcept -> const qan::EdgeGeometry& { return _edgeGeometry; }
+protected:
+    //! \copydoc edgeGeometry
+    qan::EdgeGeometry   _edgeGeometry;
+signals:
+    //! \copydoc edgeGeometry
+    void            edgeGeometryChanged();
 
 public:
     //! Edge label position.
@@ -470,6 +763,10 @@ private:
 signals:
     void            acceptDropsChanged( );
 
+public:
+    //! Return style exposed by \c event source item \c draggedEdgeStyle property (usually a style delegate), or nullptr.
+    static qan::EdgeStyle*  getDraggedEdgeStyle( const QDropEvent* event ) noexcept;
+
 protected:
     //! Return true if point is actually on the edge (not only in edge bounding rect).
     virtual bool    contains( const QPointF& point ) const override;
@@ -490,6 +787,30 @@ protected:
     //-------------------------------------------------------------------------
 };
 
+template <class Shape>
+bool    EdgeItem::registerShape(const QString& name) noexcept
+{
+    static const GeometryPolicy policy{ &EdgeItem::generatePolicyEnds<qan::CustomEdgeGeometry>,
+                                        &EdgeItem::finalizeShapeGeometry<Shape> };
+    return registerGeometryPolicy(name, &policy);
+}
+
+template <class Shape>
+void    EdgeItem::finalizeShapeGeometry(GeometryCache& cache) noexcept
+{
+    if ( cache.isValid() &&
+         !cache.hidden ) {
+        qan::EdgeShapeGeometry geometry{cache.srcBr, cache.dstBr, cache.p1, cache.p2, {}};
+        Shape::generate(geometry);
+        cache.p1 = geometry.p1;
+        cache.p2 = geometry.p2;
+        cache.route.clear();
+        cache.route.reserve(geometry.points.size() + 2);
+        cache.route << cache.p1 << geometry.points << cache.p2;
+    }
+    finalizePolicyGeometry<qan::CustomEdgeGeometry>(cache);
+}
+
 } // ::qan
 
 QML_DECLARE_TYPE( qan::EdgeItem )
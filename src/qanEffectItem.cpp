@@ -0,0 +1,338 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEffectItem.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGTextureMaterial>
+#include <QQuickWindow>
+#include <QImage>
+#include <QPainter>
+#include <QMutex>
+
+// QuickQanava headers
+#include "./qanEffectItem.h"
+
+namespace qan {  // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Effect texture layout, all values in texture pixels.
+struct EffectLayout {
+    EffectLayout(qan::NodeStyle::EffectType effectType, qreal effectRadius,
+                 qreal effectOffset, qreal backRadius) noexcept {
+        const bool shadow = effectType == qan::NodeStyle::EffectType::EffectShadow;
+        corner = static_cast<int>(std::ceil(std::max(0., backRadius)));
+        margin = std::max(1, static_cast<int>(std::ceil(std::max(0., effectRadius) * (shadow ? 1. : 2.))));
+        offset = shadow ? static_cast<int>(std::lround(effectOffset)) : 0;
+        // Item rect in texture is large enough to have a straight border under effect blur on its center pixel,
+        // texture is expanded by blur margin and shadow offset around item rect.
+        expand = margin + std::abs(offset);
+        const int k = corner + margin + std::abs(offset);
+        itemSize = 2 * k + 1;
+        padding = expand + k;
+        size = itemSize + 2 * expand;
+    }
+    int     corner = 0;
+    int     margin = 1;
+    int     offset = 0;
+    int     expand = 0;
+    int     itemSize = 1;
+    int     padding = 0;
+    int     size = 1;
+};
+
+//! Effect texture cache key (radii are rounded to half pixels).
+struct EffectKey {
+    EffectKey(qan::NodeStyle::EffectType effectType, qreal effectRadius,
+              qreal effectOffset, QColor effectColor, qreal backRadius) noexcept :
+        type{static_cast<unsigned int>(effectType)},
+        radius{static_cast<int>(std::lround(effectRadius * 2.))},
+        offset{effectType == qan::NodeStyle::EffectType::EffectShadow ? static_cast<int>(std::lround(effectOffset)) : 0},
+        color{effectColor.rgba()},
+        backRadius{static_cast<int>(std::lround(backRadius * 2.))} { }
+    bool operator==(const EffectKey& other) const noexcept {
+        return type == other.type && radius == other.radius && offset == other.offset &&
+               color == other.color && backRadius == other.backRadius;
+    }
+    unsigned int    type;
+    int             radius;
+    int             offset;
+    QRgb            color;
+    int             backRadius;
+};
+
+struct EffectKeyHash {
+    std::size_t operator()(const EffectKey& key) const noexcept {
+        std::size_t h = std::hash<unsigned int>{}(key.type);
+        const auto combine = [&h](std::size_t v) { h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2); };
+        combine(std::hash<int>{}(key.radius));
+        combine(std::hash<int>{}(key.offset));
+        combine(std::hash<QRgb>{}(key.color));
+        combine(std::hash<int>{}(key.backRadius));
+        return h;
+    }
+};
+
+using EffectTextures = std::unordered_map<EffectKey, QSGTexture*, EffectKeyHash>;
+
+//! Per window effect textures, textures are created and destroyed in window render thread.
+QMutex                                              effectTexturesMutex;
+std::unordered_map<const QQuickWindow*, EffectTextures> effectTextures;
+
+//! Approximate a gaussian blur with three separable box blur passes on a premultiplied image.
+void    blurImage(QImage& image, int radius) noexcept
+{
+    if (radius <= 0)
+        return;
+    const int w = image.width();
+    const int h = image.height();
+    std::vector<QRgb> line(static_cast<std::size_t>(std::max(w, h)));
+    const auto boxBlur = [radius, &line](QRgb* data, int count, int stride) {
+        const int window = 2 * radius + 1;
+        int sum[4] = {0, 0, 0, 0};
+        const auto at = [data, count, stride](int i) -> QRgb {
+            return i < 0 || i >= count ? 0 : data[i * stride];
+        };
+        for (int i = -radius; i <= radius; ++i) {
+            const auto p = at(i);
+            sum[0] += qAlpha(p); sum[1] += qRed(p); sum[2] += qGreen(p); sum[3] += qBlue(p);
+        }
+        for (int i = 0; i < count; ++i) {
+            line[static_cast<std::size_t>(i)] = qRgba(sum[1] / window, sum[2] / window, sum[3] / window, sum[0] / window);
+            const auto in = at(i + radius + 1);
+            const auto out = at(i - radius);
+            sum[0] += qAlpha(in) - qAlpha(out); sum[1] += qRed(in) - qRed(out);
+            sum[2] += qGreen(in) - qGreen(out); sum[3] += qBlue(in) - qBlue(out);
+        }
+        for (int i = 0; i < count; ++i)
+            data[i * stride] = line[static_cast<std::size_t>(i)];
+    };
+    auto bits = reinterpret_cast<QRgb*>(image.bits());
+    const int stride = image.bytesPerLine() / static_cast<int>(sizeof(QRgb));
+    for (int pass = 0; pass < 3; ++pass) {
+        for (int y = 0; y < h; ++y)
+            boxBlur(bits + y * stride, w, 1);
+        for (int x = 0; x < w; ++x)
+            boxBlur(bits + x, h, stride);
+    }
+}
+
+//! Render effect nine-patch image: blurred item shape with item area cleared.
+QImage  createEffectImage(const EffectLayout& layout, qan::NodeStyle::EffectType effectType,
+                          qreal effectRadius, QColor effectColor, qreal backRadius) noexcept
+{
+    QImage image{layout.size, layout.size, QImage::Format_ARGB32_Premultiplied};
+    image.fill(Qt::transparent);
+    const QRectF itemRect{static_cast<qreal>(layout.expand), static_cast<qreal>(layout.expand),
+                          static_cast<qreal>(layout.itemSize), static_cast<qreal>(layout.itemSize)};
+    {
+        QPainter painter{&image};
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(effectColor);
+        if (effectType == qan::NodeStyle::EffectType::EffectGlow) {
+            const qreal spread = effectRadius * 0.25;   // Same spread than former QtGraphicalEffects Glow
+            painter.drawRoundedRect(itemRect.adjusted(-spread, -spread, spread, spread),
+                                    backRadius + spread, backRadius + spread);
+        } else
+            painter.drawRoundedRect(itemRect.translated(layout.offset, layout.offset), backRadius, backRadius);
+    }
+    blurImage(image, std::max(1, layout.margin / 3));
+    QPainter painter{&image};       // Clear item area, item background might be translucent
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setCompositionMode(QPainter::CompositionMode_Clear);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::black);
+    painter.drawRoundedRect(itemRect, backRadius, backRadius);
+    return image;
+}
+
+} // ::qan::anonymous
+
+/* EffectItem Object Management *///------------------------------------------
+EffectItem::EffectItem(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+//-----------------------------------------------------------------------------
+
+/* Effect Management *///-----------------------------------------------------
+void    EffectItem::setEffectType(qan::NodeStyle::EffectType effectType) noexcept
+{
+    if (effectType != _effectType) {
+        _effectType = effectType;
+        update();
+        emit effectTypeChanged();
+    }
+}
+
+void    EffectItem::setEffectRadius(qreal effectRadius) noexcept
+{
+    if (!qFuzzyCompare(1. + effectRadius, 1. + _effectRadius)) {
+        _effectRadius = effectRadius;
+        update();
+        emit effectRadiusChanged();
+    }
+}
+
+void    EffectItem::setEffectOffset(qreal effectOffset) noexcept
+{
+    if (!qFuzzyCompare(1. + effectOffset, 1. + _effectOffset)) {
+        _effectOffset = effectOffset;
+        update();
+        emit effectOffsetChanged();
+    }
+}
+
+void    EffectItem::setEffectColor(QColor effectColor) noexcept
+{
+    if (effectColor != _effectColor) {
+        _effectColor = effectColor;
+        update();
+        emit effectColorChanged();
+    }
+}
+
+void    EffectItem::setBackRadius(qreal backRadius) noexcept
+{
+    if (!qFuzzyCompare(1. + backRadius, 1. + _backRadius)) {
+        _backRadius = backRadius;
+        update();
+        emit backRadiusChanged();
+    }
+}
+
+void    EffectItem::geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        update();
+}
+
+QSGNode*    EffectItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (window() == nullptr ||
+        _effectType == qan::NodeStyle::EffectType::EffectNone ||
+        _effectColor.alpha() == 0 ||
+        width() <= 0. || height() <= 0.) {
+        delete node;
+        return nullptr;
+    }
+
+    // 1. Get shared effect texture, eventually render it
+    QSGTexture* texture = nullptr;
+    const EffectLayout layout{_effectType, _effectRadius, _effectOffset, _backRadius};
+    {
+        QMutexLocker lock{&effectTexturesMutex};
+        const auto window = this->window();
+        auto windowTextures = effectTextures.find(window);
+        if (windowTextures == effectTextures.end()) {
+            windowTextures = effectTextures.emplace(window, EffectTextures{}).first;
+            // Note: sceneGraphInvalidated() is emitted from render thread, textures must be destroyed there
+            connect(window, &QQuickWindow::sceneGraphInvalidated, window, [window]() {
+                QMutexLocker lock{&effectTexturesMutex};
+                const auto windowTextures = effectTextures.find(window);
+                if (windowTextures != effectTextures.end()) {
+                    for (auto& texture : windowTextures->second)
+                        delete texture.second;
+                    effectTextures.erase(windowTextures);
+                }
+            }, Qt::DirectConnection);
+        }
+        const EffectKey key{_effectType, _effectRadius, _effectOffset, _effectColor, _backRadius};
+        auto cached = windowTextures->second.find(key);
+        if (cached == windowTextures->second.end()) {
+            const auto image = createEffectImage(layout, _effectType, _effectRadius, _effectColor, _backRadius);
+            cached = windowTextures->second.emplace(key, window->createTextureFromImage(image, QQuickWindow::TextureHasAlphaChannel)).first;
+            cached->second->setFiltering(QSGTexture::Linear);
+        }
+        texture = cached->second;
+    }
+
+    // 2. Create or update nine-patch geometry: 4x4 vertices, 9 quads
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 16, 54};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        auto indices = geometry->indexDataAsUShort();
+        for (int y = 0; y < 3; ++y)
+            for (int x = 0; x < 3; ++x) {
+                const auto i = static_cast<quint16>(y * 4 + x);
+                *indices++ = i;     *indices++ = i + 1; *indices++ = i + 4;
+                *indices++ = i + 1; *indices++ = i + 5; *indices++ = i + 4;
+            }
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGTextureMaterial{});    // Material does not own the shared texture
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+    auto material = static_cast<QSGTextureMaterial*>(node->material());
+    if (material->texture() != texture) {
+        material->setTexture(texture);
+        material->setFiltering(QSGTexture::Linear);
+        node->markDirty(QSGNode::DirtyMaterial);
+    }
+
+    const qreal expand = layout.expand;
+    const QRectF bounds = QRectF{0., 0., width(), height()}.adjusted(-expand, -expand, expand, expand);
+    // Patches are shrunk when item is smaller than texture corners
+    const qreal px = std::min(static_cast<qreal>(layout.padding), bounds.width() / 2.);
+    const qreal py = std::min(static_cast<qreal>(layout.padding), bounds.height() / 2.);
+    const qreal xs[4] = {bounds.left(), bounds.left() + px, bounds.right() - px, bounds.right()};
+    const qreal ys[4] = {bounds.top(), bounds.top() + py, bounds.bottom() - py, bounds.bottom()};
+    const auto subRect = texture->normalizedTextureSubRect();
+    const qreal uv = static_cast<qreal>(layout.padding) / layout.size;
+    const qreal us[4] = {0., uv, 1. - uv, 1.};
+    auto v = node->geometry()->vertexDataAsTexturedPoint2D();
+    for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 4; ++x)
+            (v++)->set(static_cast<float>(xs[x]), static_cast<float>(ys[y]),
+                       static_cast<float>(subRect.left() + us[x] * subRect.width()),
+                       static_cast<float>(subRect.top() + us[y] * subRect.height()));
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+}  // ::qan
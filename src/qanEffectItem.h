@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEffectItem.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QtQml>
+#include <QQuickItem>
+#include <QColor>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan {  // ::qan
+
+/*! \brief Draw a node or group drop shadow or glow effect with a cached nine-patch texture.
+ *
+ * Effect is rendered once in a small nine-patch texture keyed by (effectType, effectRadius, effectOffset,
+ * effectColor, backRadius): all items sharing the same style share the same texture and are drawn with a
+ * single textured geometry node, no per item layer nor effect pass is necessary. Effect is drawn outside
+ * item bounding rect, area under the item is left transparent (item might have a translucent background).
+ *
+ * Used by RectShadowEffect.qml and RectGlowEffect.qml:
+ * \code
+ *  Qan.EffectItem {
+ *    anchors.fill: parent
+ *    effectType: nodeItem.style.effectType
+ *    effectRadius: nodeItem.style.effectRadius
+ *    effectOffset: nodeItem.style.effectOffset
+ *    effectColor: nodeItem.style.effectColor
+ *    backRadius: nodeItem.style.backRadius
+ *  }
+ * \endcode
+ *
+ * \note Textures are cached per window and released when window scene graph is invalidated.
+ * \nosubgrouping
+ */
+class EffectItem : public QQuickItem
+{
+    /*! \name EffectItem Object Management *///--------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit EffectItem(QQuickItem* parent = nullptr);
+    virtual ~EffectItem() override = default;
+    EffectItem(const EffectItem&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Effect Management *///-------------------------------------------
+    //@{
+public:
+    //! Effect type (default to \c EffectShadow), nothing is drawn for \c EffectNone.
+    Q_PROPERTY(qan::NodeStyle::EffectType effectType READ getEffectType WRITE setEffectType NOTIFY effectTypeChanged FINAL)
+    //! \copydoc effectType
+    inline qan::NodeStyle::EffectType   getEffectType() const noexcept { return _effectType; }
+    //! \copydoc effectType
+    void                setEffectType(qan::NodeStyle::EffectType effectType) noexcept;
+private:
+    qan::NodeStyle::EffectType  _effectType{qan::NodeStyle::EffectType::EffectShadow};
+signals:
+    void                effectTypeChanged();
+
+public:
+    //! Shadow blur radius or glow radius (default to 3.0).
+    Q_PROPERTY(qreal effectRadius READ getEffectRadius WRITE setEffectRadius NOTIFY effectRadiusChanged FINAL)
+    //! \copydoc effectRadius
+    inline qreal        getEffectRadius() const noexcept { return _effectRadius; }
+    //! \copydoc effectRadius
+    void                setEffectRadius(qreal effectRadius) noexcept;
+private:
+    qreal               _effectRadius{3.};
+signals:
+    void                effectRadiusChanged();
+
+public:
+    //! Shadow horizontal and vertical offset (default to 3.0), ignored for glow effect.
+    Q_PROPERTY(qreal effectOffset READ getEffectOffset WRITE setEffectOffset NOTIFY effectOffsetChanged FINAL)
+    //! \copydoc effectOffset
+    inline qreal        getEffectOffset() const noexcept { return _effectOffset; }
+    //! \copydoc effectOffset
+    void                setEffectOffset(qreal effectOffset) noexcept;
+private:
+    qreal               _effectOffset{3.};
+signals:
+    void                effectOffsetChanged();
+
+public:
+    //! Effect color (default to translucent black).
+    Q_PROPERTY(QColor effectColor READ getEffectColor WRITE setEffectColor NOTIFY effectColorChanged FINAL)
+    //! \copydoc effectColor
+    inline QColor       getEffectColor() const noexcept { return _effectColor; }
+    //! \copydoc effectColor
+    void                setEffectColor(QColor effectColor) noexcept;
+private:
+    QColor              _effectColor{0, 0, 0, 127};
+signals:
+    void                effectColorChanged();
+
+public:
+    //! Item background corner radius (default to 4.0).
+    Q_PROPERTY(qreal backRadius READ getBackRadius WRITE setBackRadius NOTIFY backRadiusChanged FINAL)
+    //! \copydoc backRadius
+    inline qreal        getBackRadius() const noexcept { return _backRadius; }
+    //! \copydoc backRadius
+    void                setBackRadius(qreal backRadius) noexcept;
+private:
+    qreal               _backRadius{4.};
+signals:
+    void                backRadiusChanged();
+
+protected:
+    virtual void        geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+}  // ::qan
+
+QML_DECLARE_TYPE(qan::EffectItem);
@@ -0,0 +1,325 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFastNodeItem.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::min std::max
+#include <cmath>        // std::cos std::sin
+#include <vector>
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QSGSimpleTextureNode>
+#include <QQuickWindow>
+#include <QPainter>
+#include <QFont>
+#include <QFontMetricsF>
+#include <QTextLayout>
+
+// QuickQanava headers
+#include "./qanFastNodeItem.h"
+#include "./qanNode.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Return \c rect outline with \c radius rounded corners, always \c 4 * (segments + 1) points (clockwise).
+std::vector<QPointF>    roundedRectOutline(const QRectF& rect, qreal radius, int segments = 6)
+{
+    radius = std::max(0., std::min(radius, std::min(rect.width(), rect.height()) / 2.));
+    const QPointF centers[] = { {rect.right() - radius, rect.top() + radius},   {rect.right() - radius, rect.bottom() - radius},
+                                {rect.left() + radius, rect.bottom() - radius}, {rect.left() + radius, rect.top() + radius} };
+    constexpr qreal halfPi = 1.57079632679489661923;
+    std::vector<QPointF> outline;
+    outline.reserve(static_cast<std::size_t>(4 * (segments + 1)));
+    for (int corner = 0; corner < 4; ++corner) {
+        for (int s = 0; s <= segments; ++s) {
+            const auto angle = -halfPi + (corner + static_cast<qreal>(s) / segments) * halfPi;
+            outline.emplace_back(centers[corner].x() + radius * std::cos(angle),
+                                 centers[corner].y() + radius * std::sin(angle));
+        }
+    }
+    return outline;
+}
+
+//! Append a premultiplied colored triangle to \c vertices.
+inline void     pushTriangle(std::vector<QSGGeometry::ColoredPoint2D>& vertices, const QColor& color,
+                             const QPointF& a, const QPointF& b, const QPointF& c)
+{
+    const auto alpha = static_cast<uchar>(color.alpha());
+    const auto premultiply = [alpha](int c) { return static_cast<uchar>(c * alpha / 255); };
+    const uchar red = premultiply(color.red()), green = premultiply(color.green()), blue = premultiply(color.blue());
+    for (const auto& p : {a, b, c}) {
+        QSGGeometry::ColoredPoint2D v;
+        v.set(static_cast<float>(p.x()), static_cast<float>(p.y()), red, green, blue, alpha);
+        vertices.push_back(v);
+    }
+}
+
+//! Triangulate \c outline interior as a fan from \c center.
+void    pushFill(std::vector<QSGGeometry::ColoredPoint2D>& vertices, const QColor& color,
+                 const std::vector<QPointF>& outline, const QPointF& center)
+{
+    for (std::size_t i = 0; i < outline.size(); ++i)
+        pushTriangle(vertices, color, center, outline[i], outline[(i + 1) % outline.size()]);
+}
+
+//! Triangulate band between \c outer and \c inner outlines (outlines must have the same point count).
+void    pushRing(std::vector<QSGGeometry::ColoredPoint2D>& vertices, const QColor& color,
+                 const std::vector<QPointF>& outer, const std::vector<QPointF>& inner)
+{
+    for (std::size_t i = 0; i < outer.size(); ++i) {
+        const auto j = (i + 1) % outer.size();
+        pushTriangle(vertices, color, outer[i], outer[j], inner[j]);
+        pushTriangle(vertices, color, outer[i], inner[j], inner[i]);
+    }
+}
+
+} // ::qan::anonymous
+
+/* FastNodeItem Object Management *///----------------------------------------
+FastNodeItem::FastNodeItem(QQuickItem* parent) :
+    qan::NodeItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setWidth(110.);
+    setHeight(50.);
+    connect(this, &qan::NodeItem::styleChanged,         this, &FastNodeItem::onStyleChanged);
+    connect(this, &qan::NodeItem::selectedChanged,      this, &QQuickItem::update);
+    connect(this, &qan::NodeItem::levelOfDetailChanged, this, &QQuickItem::update);
+    connect(this, &qan::NodeItem::culledChanged,        this, &QQuickItem::update);
+    connect(this, &QQuickItem::widthChanged,            this, &QQuickItem::update);
+    connect(this, &QQuickItem::heightChanged,           this, &QQuickItem::update);
+}
+
+auto    FastNodeItem::setNode(qan::Node* node) noexcept -> void
+{
+    if (getNode() != nullptr)
+        disconnect(getNode(), nullptr, this, nullptr);
+    qan::NodeItem::setNode(node);
+    if (node != nullptr)
+        connect(node, &qan::Node::labelChanged, this, &QQuickItem::update);
+    update();
+}
+//-----------------------------------------------------------------------------
+
+/* Scene Graph Rendering *///--------------------------------------------------
+void    FastNodeItem::setLabelColor(QColor labelColor) noexcept
+{
+    if (labelColor != _labelColor) {
+        _labelColor = labelColor;
+        update();
+        emit labelColorChanged();
+    }
+}
+
+void    FastNodeItem::onStyleChanged()
+{
+    if (_monitoredStyle)
+        disconnect(_monitoredStyle, nullptr, this, nullptr);
+    _monitoredStyle = getStyle();
+    if (_monitoredStyle) {
+        const auto style = _monitoredStyle.data();
+        connect(style, &qan::NodeStyle::backColorChanged,     this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::backOpacityChanged,   this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::backRadiusChanged,    this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::borderColorChanged,   this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::borderWidthChanged,   this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::fontPointSizeChanged, this, &QQuickItem::update);
+        connect(style, &qan::NodeStyle::fontBoldChanged,      this, &QQuickItem::update);
+    }
+    update();
+}
+
+bool    FastNodeItem::isLabelVisible() const noexcept
+{
+    const auto graph = getGraph();
+    return getNode() != nullptr &&
+           !getNode()->getLabel().isEmpty() &&
+           getLevelOfDetail() == qan::NodeItem::LevelOfDetail::Full &&
+           !getCulled() &&
+           (graph == nullptr || !graph->getLabelsBatched());
+}
+
+bool    FastNodeItem::updateLabelImage()
+{
+    // Same layout as RectNodeTemplate label: top centered, wrapped and elided on 3 lines, 5px margins
+    constexpr qreal margin = 5.;
+    const auto style = getStyle();
+    QFont font;
+    if (style != nullptr) {
+        if (style->getFontPointSize() > 0)
+            font.setPointSize(style->getFontPointSize());
+        font.setBold(style->getFontBold());
+    }
+    const auto dpr = window() != nullptr ? window()->effectiveDevicePixelRatio() : 1.;
+    const QSizeF size{std::max(0., width() - 2. * margin), std::max(0., height() - 2. * margin)};
+    const auto label = getNode()->getLabel();
+    const auto key = label + QLatin1Char('\x1f') + font.toString() + QLatin1Char('\x1f') +
+                     QString::number(size.width()) + QLatin1Char('x') + QString::number(size.height()) +
+                     QLatin1Char('@') + QString::number(dpr) + QLatin1Char('#') + _labelColor.name(QColor::HexArgb);
+    if (key == _labelKey)
+        return false;
+    _labelKey = key;
+    _labelImage = QImage{};
+    if (size.isEmpty())
+        return true;
+
+    QImage image{static_cast<int>(std::ceil(size.width() * dpr)), static_cast<int>(std::ceil(size.height() * dpr)),
+                 QImage::Format_ARGB32_Premultiplied};
+    image.setDevicePixelRatio(dpr);
+    image.fill(Qt::transparent);
+    QPainter painter{&image};
+    painter.setRenderHint(QPainter::TextAntialiasing);
+    painter.setFont(font);
+    painter.setPen(_labelColor);
+    QTextLayout layout{label, font};
+    QTextOption option{Qt::AlignHCenter};
+    option.setWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
+    layout.setTextOption(option);
+    const QFontMetricsF fm{font};
+    constexpr int maximumLineCount = 3;
+    qreal y = 0.;
+    int lineCount = 0;
+    int layoutLineCount = 0;    // Lines drawn with text layout (last line might be elided)
+    layout.beginLayout();
+    for (auto line = layout.createLine(); line.isValid(); line = layout.createLine()) {
+        line.setLineWidth(size.width());
+        if (++lineCount == maximumLineCount ||
+            y + 2. * fm.height() > size.height()) {     // Last line: elide remaining text
+            const auto remaining = label.mid(line.textStart());
+            const auto elided = fm.elidedText(remaining.simplified(), Qt::ElideRight, size.width());
+            painter.drawText(QRectF{0., y, size.width(), fm.height()}, Qt::AlignHCenter | Qt::AlignTop, elided);
+            break;
+        }
+        line.setPosition(QPointF{0., y});
+        y += line.height();
+        ++layoutLineCount;
+    }
+    layout.endLayout();
+    for (int l = 0; l < layoutLineCount; ++l)
+        layout.lineAt(l).draw(&painter, QPointF{0., 0.});
+    painter.end();
+    _labelImage = image;
+    return true;
+}
+
+QSGNode*    FastNodeItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    // Note: GUI thread is blocked while updatePaintNode() is called, node and style can be safely read.
+    const auto graph = getGraph();
+    const auto style = getStyle();
+    // At Flat level, nodes are eventually drawn by a qan::NodeBatchRenderer
+    if (graph != nullptr &&
+        graph->getFlatBatched() &&
+        getLevelOfDetail() == qan::NodeItem::LevelOfDetail::Flat) {
+        delete oldNode;
+        _labelKey.clear();
+        return nullptr;
+    }
+    auto root = oldNode;
+    QSGGeometryNode* shapeNode = nullptr;
+    if (root == nullptr) {
+        root = new QSGNode{};
+        shapeNode = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        shapeNode->setGeometry(geometry);
+        shapeNode->setFlag(QSGNode::OwnsGeometry);
+        shapeNode->setMaterial(new QSGVertexColorMaterial{});
+        shapeNode->setFlag(QSGNode::OwnsMaterial);
+        root->appendChildNode(shapeNode);
+    } else
+        shapeNode = static_cast<QSGGeometryNode*>(root->firstChild());
+
+    // Background, border and selection frame
+    std::vector<QSGGeometry::ColoredPoint2D> vertices;
+    const QRectF r{0., 0., width(), height()};
+    const auto radius = style != nullptr ? style->getBackRadius() : 4.;
+    const auto borderWidth = style != nullptr ? std::max(0., style->getBorderWidth()) : 1.;
+    auto backColor = style != nullptr ? style->getBackColor() : QColor{Qt::white};
+    backColor.setAlphaF(backColor.alphaF() * (style != nullptr ? style->getBackOpacity() : 1.));
+    const auto outline = roundedRectOutline(r, radius);
+    const auto inner = roundedRectOutline(r.adjusted(borderWidth, borderWidth, -borderWidth, -borderWidth),
+                                          std::max(0., radius - borderWidth));
+    pushFill(vertices, backColor, borderWidth > 0. ? inner : outline, r.center());
+    if (borderWidth > 0.)
+        pushRing(vertices, style != nullptr ? style->getBorderColor() : QColor{Qt::black}, outline, inner);
+    if (getSelected() &&
+        graph != nullptr &&
+        !graph->getSelectionOverlay()) {
+        const auto margin = graph->getSelectionMargin();
+        const auto weight = graph->getSelectionWeight();
+        auto selectionColor = graph->getSelectionColor();
+        selectionColor.setAlphaF(selectionColor.alphaF() * 0.8);    // Same opacity as SelectionItem.qml
+        const auto selection = r.adjusted(-margin - weight, -margin - weight, margin + weight, margin + weight);
+        pushRing(vertices, selectionColor, roundedRectOutline(selection, radius + margin + weight),
+                 roundedRectOutline(selection.adjusted(weight, weight, -weight, -weight), radius + margin));
+    }
+    auto geometry = shapeNode->geometry();
+    if (geometry->vertexCount() != static_cast<int>(vertices.size()))
+        geometry->allocate(static_cast<int>(vertices.size()));
+    std::copy(vertices.begin(), vertices.end(), geometry->vertexDataAsColoredPoint2D());
+    shapeNode->markDirty(QSGNode::DirtyGeometry);
+
+    // Label texture node (second child), texture is regenerated only when label image changes
+    auto labelNode = static_cast<QSGSimpleTextureNode*>(shapeNode->nextSibling());
+    const auto labelVisible = isLabelVisible() && window() != nullptr;
+    if (labelVisible &&
+        (updateLabelImage() || labelNode == nullptr)) {
+        delete labelNode;
+        labelNode = nullptr;
+        if (!_labelImage.isNull()) {
+            labelNode = new QSGSimpleTextureNode{};
+            labelNode->setTexture(window()->createTextureFromImage(_labelImage));
+            labelNode->setOwnsTexture(true);
+            labelNode->setFiltering(QSGTexture::Linear);
+            const auto dpr = _labelImage.devicePixelRatio();
+            labelNode->setRect(QRectF{5., 5., _labelImage.width() / dpr, _labelImage.height() / dpr});
+            root->appendChildNode(labelNode);
+        }
+    } else if (!labelVisible &&
+               labelNode != nullptr) {
+        delete labelNode;
+        _labelKey.clear();      // Force label texture regeneration when label is visible again
+    }
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,116 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFastNodeItem.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Qt headers
+#include <QImage>
+#include <QPointer>
+
+// QuickQanava headers
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+/*! \brief Native node delegate drawing its background, border, label and selection from qan::NodeStyle without QML content.
+ *
+ * FastNodeItem is a qan::NodeItem whose updatePaintNode() draws node style background (\c backColor, \c backOpacity,
+ * \c backRadius), border (\c borderColor, \c borderWidth) and, when selected, a selection frame (graph \c selectionColor,
+ * \c selectionWeight and \c selectionMargin): no QML background, label, effect or selection items are created.
+ * Background and frames are vertex colored triangles using the same material for every fast node, so the scene graph
+ * batch renderer merges all fast nodes in a few draw calls.
+ *
+ * Label is rendered to a cached texture, regenerated only when label, size or font change. It is hidden below
+ * Full level of detail, when item is culled, or when labels are drawn by a qan::LabelBatchRenderer.
+ *
+ * Use FastNodeItem as graph default node delegate (default size is 110x50):
+ * \code
+ * Qan.Graph {
+ *   nodeDelegate: Component { Qan.FastNodeItem { } }
+ * }
+ * \endcode
+ *
+ * \note Style effects and gradient fill are not rendered.
+ * \nosubgrouping
+ */
+class FastNodeItem : public qan::NodeItem
+{
+    /*! \name FastNodeItem Object Management *///------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit FastNodeItem(QQuickItem* parent = nullptr);
+    virtual ~FastNodeItem() override = default;
+    FastNodeItem(const FastNodeItem&) = delete;
+
+public:
+    virtual auto    setNode(qan::Node* node) noexcept -> void override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Scene Graph Rendering *///---------------------------------------
+    //@{
+public:
+    //! Label text color (default to black).
+    Q_PROPERTY(QColor labelColor READ getLabelColor WRITE setLabelColor NOTIFY labelColorChanged FINAL)
+    //! \copydoc labelColor
+    inline QColor   getLabelColor() const noexcept { return _labelColor; }
+    //! \copydoc labelColor
+    void            setLabelColor(QColor labelColor) noexcept;
+private:
+    QColor          _labelColor{Qt::black};
+signals:
+    void            labelColorChanged();
+
+protected:
+    virtual bool        hasNativeSelection() const noexcept override { return true; }
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+private:
+    //! Monitor current style properties used in updatePaintNode().
+    void                onStyleChanged();
+    //! Return true if label must be drawn by this item.
+    bool                isLabelVisible() const noexcept;
+    //! Render label image (at window device pixel ratio), return false if label image is unchanged.
+    bool                updateLabelImage();
+
+    QPointer<qan::NodeStyle>    _monitoredStyle;
+    QImage              _labelImage;
+    QString             _labelKey;      // Label text, size and font used to render _labelImage
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::FastNodeItem)
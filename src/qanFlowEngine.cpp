@@ -0,0 +1,351 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFlowEngine.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// Qt headers
+#include <QMetaMethod>
+
+// QuickQanava headers
+#include "./qanFlowEngine.h"
+
+namespace qan { // ::qan
+
+/* FlowEngine Object Management *///-------------------------------------------
+FlowEngine::FlowEngine(QObject* parent) :
+    QObject{parent} { }
+
+void    FlowEngine::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph != _graph) {
+        _graph = graph;
+        _dirty.clear();
+        _memos.clear();
+        emit graphChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Dataflow Evaluation *///----------------------------------------------------
+void    FlowEngine::markDirty(qan::Node* node) noexcept
+{
+    if (node == nullptr)
+        return;
+    if (_evaluating &&
+        _pending.find(node) != _pending.cend())     // Will be evaluated by the running pass
+        return;
+    try {
+        _dirty.push_back(std::static_pointer_cast<qan::Graph::Node>(node->shared_from_this()));
+    } catch (const std::bad_weak_ptr&) {            // Node is not (or no longer) owned by a graph
+        return;
+    }
+    schedule();
+}
+
+void    FlowEngine::markOutputsDirty(qan::Node* node) noexcept
+{
+    if (node == nullptr)
+        return;
+    for (const auto& outNode : node->get_out_nodes())
+        markDirty(outNode.lock().get());
+}
+
+int     FlowEngine::evaluate() noexcept
+{
+    _scheduled = false;
+    if (_evaluating)            // Evaluation pass is not reentrant, dirty nodes are evaluated when running pass end
+        return 0;
+    if (!_graph ||
+        _dirty.empty())
+        return 0;
+    const auto snapshot = _graph->snapshot();
+    const auto& csr = snapshot->get_csr();
+    std::vector<std::size_t> roots;
+    roots.reserve(_dirty.size());
+    for (const auto& node : _dirty) {
+        const auto index = csr.index_of(node);
+        if (static_cast<std::size_t>(index) < static_cast<std::size_t>(csr.get_node_count()))
+            roots.push_back(static_cast<std::size_t>(index));
+    }
+    _dirty.clear();
+
+    const auto order = evaluationOrder(snapshot, roots);
+    _passStates.assign(static_cast<std::size_t>(csr.get_node_count()), PassState::None);
+    for (const auto n : order) {
+        _passStates[n] = PassState::Pending;
+        const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(n)).lock();
+        if (node)
+            _pending.insert(node.get());
+    }
+    for (const auto root : roots)
+        _passStates[root] = PassState::Root;
+    _evaluating = true;
+    return runPass(snapshot, order);
+}
+
+int     FlowEngine::runPass(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& order)
+{
+    const auto& csr = snapshot->get_csr();
+    std::vector<std::pair<std::size_t, qan::Graph::SharedNode>> nodes;  // Note: keep nodes alive while evaluating
+    nodes.reserve(order.size());
+    for (const auto n : order) {
+        auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(n)).lock();
+        if (node)
+            nodes.emplace_back(n, std::move(node));
+    }
+    int evaluatedCount = 0;
+    for (const auto& node : nodes) {
+        setEvaluated(node.second.get());
+        if (!needsEvaluation(snapshot, node.first)) {   // Early cutoff
+            setOutputChanged(node.first, false);
+            continue;
+        }
+        auto evaluation = evaluateMemoized(*node.second);
+        if (evaluation.computation)
+            evaluation.changed = applyOutput(*node.second, evaluation.key, evaluation.computation());
+        setOutputChanged(node.first, evaluation.changed);
+        ++evaluatedCount;
+    }
+    endPass(evaluatedCount);
+    return evaluatedCount;
+}
+
+void    FlowEngine::setEvaluated(const qan::Node* node) noexcept
+{
+    _pending.erase(node);
+}
+
+void    FlowEngine::endPass(int nodeCount) noexcept
+{
+    _evaluating = false;
+    _pending.clear();
+    _passStates.clear();
+    for (auto memo = _memos.begin(); memo != _memos.end(); )   // Drop memos of destroyed nodes
+        memo = memo->second.node ? std::next(memo) : _memos.erase(memo);
+    emit evaluated(nodeCount);
+    if (!_dirty.empty())        // Nodes dirtied during the pass after they had been evaluated
+        schedule();
+}
+
+bool    FlowEngine::needsEvaluation(const qan::Graph::Snapshot& snapshot, std::size_t n) const noexcept
+{
+    if (!snapshot ||
+        n >= _passStates.size() ||
+        _passStates[n] == PassState::Root)
+        return true;
+    const auto& csr = snapshot->get_csr();
+    const auto index = static_cast<qan::Graph::Snapshot::element_type::index_t>(n);
+    for (auto w = csr.in_begin(index); w != csr.in_end(index); ++w) {
+        const auto state = _passStates[static_cast<std::size_t>(*w)];
+        if (state == PassState::Root ||     // Not yet evaluated in node (circuit) or changed output
+            state == PassState::Pending ||
+            state == PassState::Changed)
+            return true;
+    }
+    return false;
+}
+
+void    FlowEngine::setOutputChanged(std::size_t n, bool changed) noexcept
+{
+    if (n < _passStates.size())
+        _passStates[n] = changed ? PassState::Changed : PassState::Unchanged;
+}
+
+void    FlowEngine::evaluateNode(qan::Node& node)
+{
+    static const auto signature = QMetaObject::normalizedSignature("evaluate()");
+    const auto metaObject = node.metaObject();
+    const auto index = metaObject->indexOfMethod(signature.constData());
+    if (index >= 0)
+        metaObject->method(index).invoke(&node, Qt::DirectConnection);
+}
+
+std::vector<std::size_t>    FlowEngine::evaluationOrder(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& roots)
+{
+    std::vector<std::size_t> order;
+    if (!snapshot)
+        return order;
+    const auto& csr = snapshot->get_csr();
+    const auto nodeCount = static_cast<std::size_t>(csr.get_node_count());
+
+    // Affected nodes: roots and their descendants (DFS)
+    std::vector<std::size_t> affected;
+    std::vector<std::uint32_t> degrees(nodeCount, 0);  // In degree in affected subgraph, +1 for affected nodes
+    std::vector<std::size_t> stack;
+    for (const auto root : roots) {
+        if (root >= nodeCount || degrees[root] != 0)
+            continue;
+        degrees[root] = 1;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const auto v = stack.back();
+            stack.pop_back();
+            affected.push_back(v);
+            for (auto w = csr.out_begin(v); w != csr.out_end(v); ++w) {
+                const auto t = static_cast<std::size_t>(*w);
+                if (degrees[t] == 0) {
+                    degrees[t] = 1;
+                    stack.push_back(t);
+                }
+            }
+        }
+    }
+    for (const auto v : affected)
+        for (auto w = csr.out_begin(v); w != csr.out_end(v); ++w)
+            ++degrees[static_cast<std::size_t>(*w)];
+
+    // Kahn topological sort of affected subgraph
+    order.reserve(affected.size());
+    for (const auto v : affected)
+        if (degrees[v] == 1)
+            order.push_back(v);
+    for (std::size_t i = 0; i < order.size(); ++i)
+        for (auto w = csr.out_begin(order[i]); w != csr.out_end(order[i]); ++w)
+            if (--degrees[static_cast<std::size_t>(*w)] == 1)
+                order.push_back(static_cast<std::size_t>(*w));
+    if (order.size() != affected.size()) {     // Circuits: remaining nodes are evaluated last
+        for (const auto v : affected)
+            if (degrees[v] > 1) {
+                order.push_back(v);
+                degrees[v] = 1;
+            }
+    }
+    return order;
+}
+
+void    FlowEngine::schedule() noexcept
+{
+    if (_scheduled)
+        return;
+    _scheduled = true;
+    QMetaObject::invokeMethod(this, [this]() { evaluate(); }, Qt::QueuedConnection);
+}
+//-----------------------------------------------------------------------------
+
+/* Output Memoization *///-----------------------------------------------------
+void    FlowEngine::setMemoSize(int memoSize) noexcept
+{
+    memoSize = std::max(0, memoSize);
+    if (memoSize != _memoSize) {
+        _memoSize = memoSize;
+        for (auto& memo : _memos) {
+            auto& history = memo.second.history;
+            if (history.size() > static_cast<std::size_t>(_memoSize))
+                history.erase(history.begin(), history.end() - _memoSize);
+        }
+        emit memoSizeChanged();
+    }
+}
+
+void    FlowEngine::clearMemos() noexcept
+{
+    _memos.clear();
+}
+
+auto    FlowEngine::getMemo(qan::Node& node) -> Memo&
+{
+    auto& memo = _memos[&node];
+    if (memo.node.data() != &node) {    // New memo, or memo of a destroyed node with the same address
+        memo = Memo{};
+        memo.node = &node;
+    }
+    return memo;
+}
+
+auto    FlowEngine::evaluateMemoized(qan::Node& node) -> Evaluation
+{
+    Evaluation evaluation;
+    const auto computable = dynamic_cast<qan::FlowComputable*>(&node);
+    if (computable == nullptr) {
+        evaluateNode(node);
+        return evaluation;
+    }
+    evaluation.key = computable->computationKey();
+    if (evaluation.key != 0) {
+        auto& memo = getMemo(node);
+        if (memo.key == evaluation.key) {       // Unchanged inputs and parameters
+            evaluation.changed = false;
+            return evaluation;
+        }
+        auto& history = memo.history;
+        const auto past = std::find_if(history.begin(), history.end(),
+                                       [&evaluation](const auto& entry) { return entry.first == evaluation.key; });
+        if (past != history.end()) {
+            auto output = std::move(past->second);
+            history.erase(past);
+            evaluation.changed = applyOutput(node, evaluation.key, std::move(output));
+            return evaluation;
+        }
+    }
+    evaluation.computation = computable->createComputation();
+    if (!evaluation.computation) {
+        if (evaluation.key != 0) {              // Output is evaluated without memoization, forget actual output
+            auto& memo = getMemo(node);
+            memo.key = 0;
+            memo.output = QVariant{};
+        }
+        evaluateNode(node);
+    }
+    return evaluation;
+}
+
+bool    FlowEngine::applyOutput(qan::Node& node, std::uint64_t key, QVariant output)
+{
+    const auto computable = dynamic_cast<qan::FlowComputable*>(&node);
+    if (computable == nullptr)
+        return false;
+    if (key == 0) {
+        computable->applyComputation(std::move(output));
+        return true;
+    }
+    auto& memo = getMemo(node);
+    const bool changed = memo.key == 0 ||
+                         memo.output != output;
+    if (memo.key != 0 &&
+        _memoSize > 0) {
+        memo.history.emplace_back(memo.key, std::move(memo.output));
+        if (memo.history.size() > static_cast<std::size_t>(_memoSize))
+            memo.history.erase(memo.history.begin());
+    }
+    memo.key = key;
+    memo.output = output;
+    if (changed)
+        computable->applyComputation(std::move(output));
+    return changed;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
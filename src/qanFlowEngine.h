@@ -0,0 +1,263 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFlowEngine.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QQmlEngine>
+#include <QVariant>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Interface of nodes whose output could be computed on a worker thread (see qan::FlowExecutor).
+ *
+ * Computation is split in three steps: createComputation() capture node inputs on the GUI thread, the
+ * returned computation is run on a worker thread, then applyComputation() set its result as node output
+ * on the GUI thread.
+ */
+class FlowComputable
+{
+public:
+    virtual ~FlowComputable() = default;
+    //! Thread independent computation of a node output (must only use state captured by value and must not throw).
+    using Computation = std::function<QVariant()>;
+    //! Return a computation of node output from actual inputs, or an empty computation to evaluate node synchronously.
+    virtual Computation createComputation() = 0;
+    //! Apply an \c output returned by a computation created with createComputation().
+    virtual void        applyComputation(QVariant output) = 0;
+
+    /*! \brief Return a hash of every input and parameter createComputation() depends on, or 0 to disable output memoization (default).
+     *
+     * Equal keys must lead to equal outputs: qan::FlowEngine does not evaluate again a node whose key is unchanged
+     * since its last evaluation, and apply memoized outputs of previous keys (see qan::FlowEngine::memoSize).
+     */
+    virtual std::uint64_t   computationKey() { return 0; }
+};
+
+/*! \brief Incremental dataflow evaluation of a qan::Graph: every node affected by a change is evaluated once, after its inputs.
+ *
+ * Nodes are marked dirty with markDirty() (usually when an input value or an upstream output change), dirty
+ * nodes and all their descendants are then evaluated in a single pass on next event loop iteration (or when
+ * evaluate() is called), in topological order of the affected subgraph: a node reachable from a changed node
+ * through several paths (a diamond) is evaluated once, after all its affected in nodes.
+ *
+ * Nodes marked dirty during a pass (for example by an output change signal emitted from evaluateNode()) are
+ * ignored if they are already part of the running pass and not yet evaluated, otherwise they are evaluated in
+ * the next pass.
+ *
+ * Nodes implementing qan::FlowComputable are evaluated with their computation, other nodes with evaluateNode(), default
+ * evaluateNode() implementation call node \c evaluate() slot or invokable method, override it to evaluate nodes differently.
+ *
+ * Outputs of qan::FlowComputable nodes with a non 0 qan::FlowComputable::computationKey() are memoized: a node whose key
+ * is unchanged is not evaluated again, a key found in the node past outputs (see \c memoSize) apply the memoized output
+ * without running the computation. A computed output equal to actual output is not applied. Evaluation has an early
+ * cutoff: a dirty node descendant is skipped when all its affected in nodes outputs are unchanged.
+ *
+ * \code
+ * Qan.FlowEngine {
+ *   id: flowEngine
+ *   graph: graph
+ * }
+ * // In a node delegate:
+ * onValueChanged: flowEngine.markDirty(node)
+ * \endcode
+ * \nosubgrouping
+ */
+class FlowEngine : public QObject
+{
+    Q_OBJECT
+    /*! \name FlowEngine Object Management *///--------------------------------
+    //@{
+public:
+    explicit FlowEngine(QObject* parent = nullptr);
+    virtual ~FlowEngine() override = default;
+    FlowEngine(const FlowEngine&) = delete;
+    FlowEngine& operator=(const FlowEngine&) = delete;
+
+public:
+    //! Graph evaluated by this engine (pending dirty nodes are dropped when graph is changed).
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    void            setGraph(qan::Graph* graph) noexcept;
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void            graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Dataflow Evaluation *///-----------------------------------------
+    //@{
+public:
+    //! Mark \c node dirty: \c node and its descendants are evaluated during next pass (scheduled on next event loop iteration).
+    Q_INVOKABLE void    markDirty(qan::Node* node) noexcept;
+
+    //! Mark out nodes of \c node dirty (typically called when \c node output has changed).
+    Q_INVOKABLE void    markOutputsDirty(qan::Node* node) noexcept;
+
+    //! Run an evaluation pass of actual dirty nodes, return the number of nodes evaluated synchronously.
+    Q_INVOKABLE int     evaluate() noexcept;
+
+public:
+    //! True while an evaluation pass is running.
+    inline bool     isEvaluating() const noexcept { return _evaluating; }
+
+signals:
+    //! Emitted at the end of an evaluation pass with the number of evaluated nodes (nodes skipped by early cutoff are not counted).
+    void            evaluated(int nodeCount);
+
+protected:
+    /*! \brief Evaluate \c node, called during an evaluation pass once all \c node affected in nodes have been evaluated.
+     *
+     * Default implementation invoke \c node \c evaluate() method (if any).
+     */
+    virtual void    evaluateNode(qan::Node& node);
+
+    /*! \brief Return affected nodes of \c roots in evaluation order (O(affected nodes + affected edges)).
+     *
+     * Affected nodes are \c roots and their descendants, they are ordered topologically (Kahn algorithm on the affected
+     * subgraph), nodes in a circuit are ordered last following their discovery order.
+     */
+    static std::vector<std::size_t> evaluationOrder(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& roots);
+
+    /*! \brief Evaluate \c order nodes of \c snapshot, return the number of nodes evaluated synchronously.
+     *
+     * Default implementation synchronously evaluate every node in \c order with evaluateMemoized(). An implementation
+     * must call setEvaluated() before evaluating a node, skip nodes that do not needsEvaluation(), report every node
+     * output change with setOutputChanged() and call endPass() once every node has been evaluated (possibly later,
+     * from the event loop).
+     */
+    virtual int     runPass(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& order);
+
+    //! Notify that \c node is being evaluated by the running pass, it could be dirtied again for the next pass.
+    void            setEvaluated(const qan::Node* node) noexcept;
+
+    //! End running pass (emit evaluated() and schedule next pass if nodes are dirty).
+    void            endPass(int nodeCount) noexcept;
+
+    //! Return true if running pass node \c n must be evaluated: a root, or a node with an affected in node changed (or not yet evaluated).
+    bool            needsEvaluation(const qan::Graph::Snapshot& snapshot, std::size_t n) const noexcept;
+
+    //! Record that running pass node \c n has been evaluated (or skipped), with a \c changed output.
+    void            setOutputChanged(std::size_t n, bool changed) noexcept;
+
+private:
+    //! Schedule an evaluation pass on next event loop iteration.
+    void            schedule() noexcept;
+
+    std::vector<qan::Graph::WeakNode>       _dirty;
+    //! Nodes of the running pass not yet evaluated.
+    std::unordered_set<const qan::Node*>    _pending;
+    bool            _scheduled = false;
+    bool            _evaluating = false;
+
+    //! Per snapshot node state in running pass.
+    enum class PassState : std::uint8_t {
+        None,       //!< Not affected by running pass
+        Root,       //!< Dirty node, not yet evaluated
+        Pending,    //!< Dirty node descendant, not yet evaluated
+        Unchanged,
+        Changed
+    };
+    std::vector<PassState>  _passStates;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Output Memoization *///------------------------------------------
+    //@{
+public:
+    //! Maximum number of past outputs memoized per node in addition to actual output, least recently used are dropped first (default to 0).
+    Q_PROPERTY(int memoSize READ getMemoSize WRITE setMemoSize NOTIFY memoSizeChanged FINAL)
+    void            setMemoSize(int memoSize) noexcept;
+    inline int      getMemoSize() const noexcept { return _memoSize; }
+private:
+    int             _memoSize = 0;
+signals:
+    void            memoSizeChanged();
+
+public:
+    //! Drop every memoized output, nodes are evaluated again by next pass.
+    Q_INVOKABLE void    clearMemos() noexcept;
+
+protected:
+    //! Result of evaluateMemoized().
+    struct Evaluation {
+        //! False when node output is known to be unchanged.
+        bool            changed = true;
+        //! Node memoization key (0 when node output is not memoized).
+        std::uint64_t   key = 0;
+        //! Node computation to run (possibly on a worker thread), its output must then be applied with applyOutput().
+        qan::FlowComputable::Computation    computation;
+    };
+
+    /*! \brief Evaluate \c node from its memoized outputs, or with evaluateNode() if node is not a qan::FlowComputable or
+     * has no computation, otherwise return node computation.
+     */
+    Evaluation      evaluateMemoized(qan::Node& node);
+
+    //! Memoize \c output of \c node computation for \c key and apply it, return false if output is unchanged (and not applied).
+    bool            applyOutput(qan::Node& node, std::uint64_t key, QVariant output);
+
+private:
+    struct Memo {
+        //! Memoized node, used to detect a memo of a destroyed node whose address has been reused.
+        QPointer<qan::Node>     node;
+        //! Key of actual node output (0 when actual output is unknown).
+        std::uint64_t           key = 0;
+        QVariant                output;
+        //! Past outputs, most recently used last.
+        std::vector<std::pair<std::uint64_t, QVariant>> history;
+    };
+    Memo&           getMemo(qan::Node& node);
+    std::unordered_map<const qan::Node*, Memo>  _memos;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::FlowEngine)
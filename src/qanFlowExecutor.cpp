@@ -0,0 +1,247 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFlowExecutor.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <mutex>
+
+// Qt headers
+#include <QThreadPool>
+#include <QRunnable>
+
+// QuickQanava headers
+#include "./qanFlowExecutor.h"
+
+namespace qan { // ::qan
+
+//! Shared between an executor and its running computations, outputs are only posted while executor is alive.
+struct FlowExecutor::Guard {
+    std::mutex              mutex;
+    qan::FlowExecutor*      executor = nullptr;
+};
+
+//! Evaluation pass state, outputs are shared with worker threads, other members are only used from GUI thread.
+struct FlowExecutor::Pass {
+    qan::Graph::Snapshot        snapshot;
+    //! Nodes of the pass in evaluation order.
+    std::vector<std::size_t>    order;
+    //! Per snapshot node: 1 + number of in nodes not yet evaluated for a pass node, 0 otherwise.
+    std::vector<std::uint32_t>  degrees;
+    std::vector<bool>           evaluated;
+    //! Per snapshot node: memoization key of a running computation (see qan::FlowEngine::applyOutput()).
+    std::vector<std::uint64_t>  keys;
+    std::vector<std::size_t>    ready;
+    std::size_t                 remaining = 0;
+    std::size_t                 running = 0;
+    int                         evaluatedCount = 0;
+    //! Cursor in order of first node that might not be evaluated (used to break circuits).
+    std::size_t                 cursor = 0;
+
+    std::mutex                                      outputsMutex;
+    std::vector<std::pair<std::size_t, QVariant>>   outputs;
+    bool                                            outputsPosted = false;
+};
+
+namespace { // ::qan::anonymous
+
+class ComputationRunnable : public QRunnable
+{
+public:
+    ComputationRunnable(std::shared_ptr<qan::FlowExecutor::Guard> guard,
+                        std::shared_ptr<qan::FlowExecutor::Pass> pass,
+                        std::size_t node, qan::FlowComputable::Computation computation) :
+        QRunnable{}, _guard{std::move(guard)}, _pass{std::move(pass)},
+        _node{node}, _computation{std::move(computation)} { setAutoDelete(true); }
+
+    virtual void run() override {
+        auto output = _computation();
+        {
+            std::lock_guard<std::mutex> lock{_pass->outputsMutex};
+            _pass->outputs.emplace_back(_node, std::move(output));
+            if (_pass->outputsPosted)       // Output is applied with an already posted batch
+                return;
+            _pass->outputsPosted = true;
+        }
+        std::lock_guard<std::mutex> lock{_guard->mutex};
+        if (_guard->executor == nullptr)
+            return;
+        const auto executor = _guard->executor;
+        QMetaObject::invokeMethod(executor, [executor, pass = _pass]() {
+            executor->outputsReady(pass);
+        }, Qt::QueuedConnection);
+    }
+
+private:
+    std::shared_ptr<qan::FlowExecutor::Guard>   _guard;
+    std::shared_ptr<qan::FlowExecutor::Pass>    _pass;
+    std::size_t                                 _node;
+    qan::FlowComputable::Computation            _computation;
+};
+
+} // ::qan::anonymous
+
+/* FlowExecutor Object Management *///-----------------------------------------
+FlowExecutor::FlowExecutor(QObject* parent) :
+    qan::FlowEngine{parent},
+    _guard{std::make_shared<Guard>()}
+{
+    _guard->executor = this;
+}
+
+FlowExecutor::~FlowExecutor()
+{
+    std::lock_guard<std::mutex> lock{_guard->mutex};
+    _guard->executor = nullptr;     // Running computations outputs are dropped
+}
+//-----------------------------------------------------------------------------
+
+/* Parallel Execution *///-----------------------------------------------------
+int     FlowExecutor::runPass(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& order)
+{
+    const auto& csr = snapshot->get_csr();
+    const auto nodeCount = static_cast<std::size_t>(csr.get_node_count());
+    auto pass = std::make_shared<Pass>();
+    pass->snapshot = snapshot;
+    pass->order = order;
+    pass->degrees.assign(nodeCount, 0);
+    pass->evaluated.assign(nodeCount, false);
+    pass->keys.assign(nodeCount, 0);
+    pass->remaining = order.size();
+    for (const auto n : order)
+        pass->degrees[n] = 1;
+    for (const auto n : order)
+        for (auto w = csr.out_begin(n); w != csr.out_end(n); ++w)
+            if (pass->degrees[*w] != 0)
+                ++pass->degrees[*w];
+    for (const auto n : order)
+        if (pass->degrees[n] == 1)
+            pass->ready.push_back(n);
+    _pass = std::move(pass);
+    dispatchReady();
+    return 0;
+}
+
+void    FlowExecutor::outputsReady(const std::shared_ptr<Pass>& pass) noexcept
+{
+    if (!pass ||
+        pass != _pass)
+        return;
+    std::vector<std::pair<std::size_t, QVariant>> outputs;
+    {
+        std::lock_guard<std::mutex> lock{pass->outputsMutex};
+        outputs.swap(pass->outputs);
+        pass->outputsPosted = false;
+    }
+    const auto& csr = pass->snapshot->get_csr();
+    for (auto& output : outputs) {
+        const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(output.first)).lock();
+        setOutputChanged(output.first, node &&
+                                       applyOutput(*node, pass->keys[output.first], std::move(output.second)));
+        ++pass->evaluatedCount;
+        --pass->running;
+        complete(output.first);
+    }
+    dispatchReady();
+}
+
+void    FlowExecutor::dispatchReady() noexcept
+{
+    const auto pass = _pass;
+    if (!pass)
+        return;
+    const auto& csr = pass->snapshot->get_csr();
+    while (!pass->ready.empty() ||
+           (pass->running == 0 && pass->remaining > 0)) {
+        if (pass->ready.empty()) {     // Circuit: nodes waiting on each other, force first one in evaluation order
+            while (pass->evaluated[pass->order[pass->cursor]])
+                ++pass->cursor;
+            pass->degrees[pass->order[pass->cursor]] = 1;
+            pass->ready.push_back(pass->order[pass->cursor]);
+        }
+        const auto n = pass->ready.back();
+        pass->ready.pop_back();
+        const auto node = csr.get_node(static_cast<qan::Graph::Snapshot::element_type::index_t>(n)).lock();
+        if (!node) {
+            complete(n);
+            continue;
+        }
+        setEvaluated(node.get());
+        if (!needsEvaluation(pass->snapshot, n)) {  // Early cutoff: affected in nodes outputs are unchanged
+            setOutputChanged(n, false);
+            complete(n);
+            continue;
+        }
+        auto evaluation = evaluateMemoized(*node);
+        if (!evaluation.computation) {              // Memoized or synchronously evaluated
+            setOutputChanged(n, evaluation.changed);
+            ++pass->evaluatedCount;
+            complete(n);
+            continue;
+        }
+        ++pass->running;
+        pass->evaluated[n] = true;      // Note: prevent a running node to be forced by circuit breaking
+        pass->keys[n] = evaluation.key;
+        QThreadPool::globalInstance()->start(new ComputationRunnable{_guard, pass, n, std::move(evaluation.computation)});
+    }
+    setRunningCount(static_cast<int>(pass->running));
+    if (pass->remaining == 0 &&
+        pass->running == 0) {
+        _pass.reset();
+        endPass(pass->evaluatedCount);
+    }
+}
+
+void    FlowExecutor::complete(std::size_t n) noexcept
+{
+    auto& pass = *_pass;
+    pass.evaluated[n] = true;
+    --pass.remaining;
+    const auto& csr = pass.snapshot->get_csr();
+    for (auto w = csr.out_begin(n); w != csr.out_end(n); ++w)
+        if (!pass.evaluated[*w] &&
+            pass.degrees[*w] > 1 &&
+            --pass.degrees[*w] == 1)
+            pass.ready.push_back(*w);
+}
+
+void    FlowExecutor::setRunningCount(int runningCount) noexcept
+{
+    if (runningCount != _runningCount) {
+        _runningCount = runningCount;
+        emit runningCountChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
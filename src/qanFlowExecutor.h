@@ -0,0 +1,115 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanFlowExecutor.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QVariant>
+
+// QuickQanava headers
+#include "./qanFlowEngine.h"
+
+namespace qan { // ::qan
+
+/*! \brief Flow engine computing independent nodes in parallel on the global QThreadPool.
+ *
+ * During a pass, a node is ready once all its affected in nodes have been evaluated (dependency counts on the
+ * affected subgraph). Ready nodes implementing qan::FlowComputable are computed on worker threads, computed
+ * outputs are marshalled back to the GUI thread in batches (every output available when the event loop
+ * process a batch is applied at once) with qan::FlowComputable::applyComputation(). Other nodes are evaluated
+ * synchronously with evaluateNode().
+ *
+ * Nodes with an unchanged or memoized output (see qan::FlowEngine) are not dispatched to worker threads.
+ *
+ * \note Nodes dirtied while a pass is running are evaluated by the next pass.
+ * \nosubgrouping
+ */
+class FlowExecutor : public qan::FlowEngine
+{
+    Q_OBJECT
+    /*! \name FlowExecutor Object Management *///------------------------------
+    //@{
+public:
+    explicit FlowExecutor(QObject* parent = nullptr);
+    virtual ~FlowExecutor() override;
+    FlowExecutor(const FlowExecutor&) = delete;
+    FlowExecutor& operator=(const FlowExecutor&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Parallel Execution *///------------------------------------------
+    //@{
+public:
+    //! Number of computations actually running (or queued) on worker threads.
+    Q_PROPERTY(int runningCount READ getRunningCount NOTIFY runningCountChanged FINAL)
+    inline int      getRunningCount() const noexcept { return _runningCount; }
+private:
+    int             _runningCount = 0;
+signals:
+    void            runningCountChanged();
+
+protected:
+    virtual int     runPass(const qan::Graph::Snapshot& snapshot, const std::vector<std::size_t>& order) override;
+
+public:
+    struct Guard;
+    struct Pass;
+
+    //! Apply computed outputs posted by worker threads (must be called from GUI thread).
+    void            outputsReady(const std::shared_ptr<Pass>& pass) noexcept;
+
+private:
+    //! Evaluate or dispatch ready nodes of running pass, end pass when every node has been evaluated.
+    void            dispatchReady() noexcept;
+    //! Node \c n of running pass has been evaluated, update its out nodes dependency counts.
+    void            complete(std::size_t n) noexcept;
+    void            setRunningCount(int runningCount) noexcept;
+
+    std::shared_ptr<Guard>  _guard;
+    std::shared_ptr<Pass>   _pass;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::FlowExecutor)
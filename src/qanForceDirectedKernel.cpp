@@ -0,0 +1,353 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedKernel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+
+// GTpo headers
+#include <gtpo/parallel.h>
+
+// QuickQanava headers
+#include "./qanForceDirectedKernel.h"
+#include "./qanSimdLane.h"
+
+namespace qan { // ::qan
+
+/* ForceDirectedBodies Management *///----------------------------------------
+void    ForceDirectedBodies::setAdjacency(const std::vector<std::size_t>& dirOffsets, const std::vector<std::uint32_t>& dirTargets)
+{
+    const auto n = size();
+    offsets.assign(n + 1, 0);
+    neighbours.clear();
+    if (dirOffsets.size() < n + 1)
+        return;
+    const auto isValid = [n](std::size_t s, std::uint32_t t) { return t != s && t < n; };
+    for (std::size_t s = 0; s < n; ++s)
+        for (auto e = dirOffsets[s]; e < dirOffsets[s + 1]; ++e) {
+            const auto t = dirTargets[e];
+            if (isValid(s, t)) {
+                ++offsets[s + 1];
+                ++offsets[t + 1];
+            }
+        }
+    for (std::size_t s = 0; s < n; ++s)
+        offsets[s + 1] += offsets[s];
+    neighbours.resize(offsets[n]);
+    std::vector<std::size_t> cursors(offsets.cbegin(), offsets.cend() - 1);
+    for (std::size_t s = 0; s < n; ++s)
+        for (auto e = dirOffsets[s]; e < dirOffsets[s + 1]; ++e) {
+            const auto t = dirTargets[e];
+            if (isValid(s, t)) {
+                neighbours[cursors[s]++] = t;
+                neighbours[cursors[t]++] = static_cast<std::uint32_t>(s);
+            }
+        }
+}
+
+void    ForceDirectedBodies::resize(std::size_t size)
+{
+    for (auto v : { &x, &y, &fx, &fy })
+        v->resize(size);
+    mobility.resize(size, 1.);
+}
+
+void    ForceDirectedBodies::clear() noexcept
+{
+    resize(0);
+    offsets.clear();
+    neighbours.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Force Directed Layout Kernel *///------------------------------------------
+namespace { // ::qan::anonymous
+
+/*! \brief Barnes-Hut quadtree stored in a flat cell array (cell 0 is root, children of a cell are contiguous).
+ *
+ * Coincident bodies (or bodies closer than the cell size at maxDepth) are aggregated in a single leaf.
+ */
+class QuadTree
+{
+public:
+    struct Cell {
+        double          x0, y0, size;   // Cell square
+        double          cx, cy;         // Bodies center of mass (sum of positions during build)
+        double          mass;           // Number of bodies in cell
+        std::int32_t    firstChild;     // -1 for a leaf
+        std::int32_t    body;           // Leaf single body, -1 for an empty or aggregated leaf
+    };
+
+    void    build(const ForceDirectedBodies& bodies)
+    {
+        _cells.clear();
+        const auto n = bodies.size();
+        if (n == 0)
+            return;
+        const auto xMinMax = std::minmax_element(bodies.x.cbegin(), bodies.x.cend());
+        const auto yMinMax = std::minmax_element(bodies.y.cbegin(), bodies.y.cend());
+        const double size = std::max(*xMinMax.second - *xMinMax.first,
+                                     *yMinMax.second - *yMinMax.first) + 1.;
+        _cells.reserve(n * 2);
+        _cells.push_back(Cell{*xMinMax.first, *yMinMax.first, size, 0., 0., 0., -1, -1});
+        for (std::size_t b = 0; b < n; ++b)
+            insert(bodies, static_cast<std::int32_t>(b));
+        for (auto& cell : _cells)
+            if (cell.mass > 0.) {
+                cell.cx /= cell.mass;
+                cell.cy /= cell.mass;
+            }
+    }
+
+    inline const std::vector<Cell>& getCells() const noexcept { return _cells; }
+
+    static inline std::int32_t  quadrant(const Cell& cell, double x, double y) noexcept {
+        const double half = cell.size * 0.5;
+        return (x >= cell.x0 + half ? 1 : 0) + (y >= cell.y0 + half ? 2 : 0);
+    }
+
+private:
+    void    insert(const ForceDirectedBodies& bodies, std::int32_t b)
+    {
+        static constexpr int maxDepth = 40;
+        const double bx = bodies.x[b];
+        const double by = bodies.y[b];
+        std::size_t c = 0;
+        for (int depth = 0; ; ++depth) {
+            auto& cell = _cells[c];
+            cell.mass += 1.;
+            cell.cx += bx;
+            cell.cy += by;
+            if (cell.firstChild >= 0) {
+                c = static_cast<std::size_t>(cell.firstChild + quadrant(cell, bx, by));
+                continue;
+            }
+            if (cell.mass == 1.) {          // Empty leaf
+                cell.body = b;
+                return;
+            }
+            if (cell.body < 0 ||            // Already aggregated leaf
+                depth >= maxDepth) {
+                cell.body = -1;
+                return;
+            }
+            // Split leaf: move its actual body to a child, then continue b insertion in children
+            const auto other = cell.body;
+            const auto firstChild = static_cast<std::int32_t>(_cells.size());
+            const double half = cell.size * 0.5;
+            const double x0 = cell.x0;
+            const double y0 = cell.y0;
+            cell.body = -1;
+            cell.firstChild = firstChild;
+            for (std::int32_t q = 0; q < 4; ++q)    // Note: cell reference is invalidated
+                _cells.push_back(Cell{x0 + (q & 1) * half, y0 + (q >> 1) * half, half, 0., 0., 0., -1, -1});
+            auto& otherCell = _cells[static_cast<std::size_t>(firstChild + quadrant(_cells[c], bodies.x[other], bodies.y[other]))];
+            otherCell.mass = 1.;
+            otherCell.cx = bodies.x[other];
+            otherCell.cy = bodies.y[other];
+            otherCell.body = other;
+            c = static_cast<std::size_t>(firstChild + quadrant(_cells[c], bx, by));
+        }
+    }
+
+    std::vector<Cell>   _cells;
+};
+
+//! Accumulate repulsion, attraction and gravity forces on bodies [first, last).
+void    accumulateForces(ForceDirectedBodies& bodies, const QuadTree& tree,
+                         const ForceDirectedParameters& p, std::size_t first, std::size_t last,
+                         std::vector<std::int32_t>& stack) noexcept
+{
+    const auto& cells = tree.getCells();
+    const double k = std::max(1., p.springLength);
+    const double k2 = p.repulsion * k * k;
+    const double theta2 = p.theta * p.theta;
+    const double jitter = k * 0.01;
+    const double gx = cells.front().cx;
+    const double gy = cells.front().cy;
+    for (auto i = first; i < last; ++i) {
+        if (bodies.mobility[i] == 0.) {     // Pinned bodies only exert forces
+            bodies.fx[i] = bodies.fy[i] = 0.;
+            continue;
+        }
+        const double xi = bodies.x[i];
+        const double yi = bodies.y[i];
+        double fx = 0.;
+        double fy = 0.;
+        // 1. Repulsion
+        stack.clear();
+        stack.push_back(0);
+        while (!stack.empty()) {
+            const auto& cell = cells[static_cast<std::size_t>(stack.back())];
+            stack.pop_back();
+            if (cell.mass <= 0. ||
+                cell.body == static_cast<std::int32_t>(i))
+                continue;
+            double dx = xi - cell.cx;
+            double dy = yi - cell.cy;
+            double d2 = dx * dx + dy * dy;
+            if (cell.firstChild >= 0 &&
+                cell.size * cell.size >= theta2 * d2) {     // Cell too close to be approximated
+                for (std::int32_t q = 0; q < 4; ++q)
+                    stack.push_back(cell.firstChild + q);
+                continue;
+            }
+            double mass = cell.mass;
+            if (cell.firstChild < 0 && cell.body < 0 &&     // Aggregated leaf might contain i
+                xi >= cell.x0 && xi < cell.x0 + cell.size &&
+                yi >= cell.y0 && yi < cell.y0 + cell.size)
+                mass -= 1.;
+            if (mass <= 0.)
+                continue;
+            if (d2 < 1e-6) {        // Coincident bodies: push i in a body specific (golden angle) direction
+                const double angle = static_cast<double>(i) * 2.399963229728653;
+                dx = std::cos(angle) * jitter;
+                dy = std::sin(angle) * jitter;
+                d2 = jitter * jitter;
+            }
+            const double f = k2 * mass / d2;
+            fx += dx * f;
+            fy += dy * f;
+        }
+        // 2. Attraction
+        for (auto e = bodies.offsets[i]; e < bodies.offsets[i + 1]; ++e) {
+            const auto j = bodies.neighbours[e];
+            const double dx = bodies.x[j] - xi;
+            const double dy = bodies.y[j] - yi;
+            const double f = p.springStrength * std::sqrt(dx * dx + dy * dy) / k;
+            fx += dx * f;
+            fy += dy * f;
+        }
+        // 3. Gravity
+        fx += (gx - xi) * p.gravity;
+        fy += (gy - yi) * p.gravity;
+        bodies.fx[i] = fx;
+        bodies.fy[i] = fy;
+    }
+}
+
+//! Move bodies i to i + V::width along their force limited to temperature, return displacement accumulator.
+template <class V>
+inline V    moveLanes(ForceDirectedBodies& bodies, std::size_t i, V temperature, V acc) noexcept
+{
+    const V fx = V::load(&bodies.fx[i]);
+    const V fy = V::load(&bodies.fy[i]);
+    const V mobility = V::load(&bodies.mobility[i]);
+    const V length = V::sqrt(fx * fx + fy * fy);
+    const V limited = V::min(length, temperature) * mobility;
+    const V scale = limited / V::max(length, V::set1(1e-12));
+    (V::load(&bodies.x[i]) + fx * scale).store(&bodies.x[i]);
+    (V::load(&bodies.y[i]) + fy * scale).store(&bodies.y[i]);
+    return acc + limited;
+}
+
+//! Move bodies [first, last), return sum of bodies displacements.
+double  moveBodies(ForceDirectedBodies& bodies, double temperature, std::size_t first, std::size_t last) noexcept
+{
+    using qan::simd::ScalarLane;
+    using qan::simd::SimdLane;
+    auto i = first;
+    SimdLane acc = SimdLane::set1(0.);
+    for (; i + SimdLane::width <= last; i += SimdLane::width)
+        acc = moveLanes<SimdLane>(bodies, i, SimdLane::set1(temperature), acc);
+    ScalarLane tailAcc = ScalarLane::set1(0.);
+    for (; i < last; ++i)
+        tailAcc = moveLanes<ScalarLane>(bodies, i, ScalarLane::set1(temperature), tailAcc);
+    double lanes[SimdLane::width];
+    acc.store(lanes);
+    double displacement = tailAcc.v;
+    for (const auto l : lanes)
+        displacement += l;
+    return displacement;
+}
+
+} // ::qan::anonymous
+
+int     runForceDirected(ForceDirectedBodies& bodies, const ForceDirectedParameters& p,
+                         const ForceDirectedCallback& callback)
+{
+    const auto n = bodies.size();
+    if (n == 0)
+        return 0;
+    bodies.fx.assign(n, 0.);
+    bodies.fy.assign(n, 0.);
+    bodies.mobility.resize(n, 1.);
+    if (bodies.offsets.size() != n + 1) {       // No (or invalid) adjacency
+        bodies.offsets.assign(n + 1, 0);
+        bodies.neighbours.clear();
+    }
+    const double k = std::max(1., p.springLength);
+    double temperature = p.temperature > 0. ? p.temperature :
+                                              k * std::max(1., std::sqrt(static_cast<double>(n))) * 0.1;
+    // Note: small graphs do not benefit from parallel force accumulation
+    const auto threadCount = n < 1024 ? std::size_t{1} : gtpo::impl::get_thread_count(p.threadCount);
+    QuadTree tree;
+    std::vector<double> displacements(threadCount, 0.);
+    int  iteration = 0;
+    bool stop = p.maxIterations <= 0;
+    gtpo::impl::parallel_run(threadCount, [&](std::size_t t, std::size_t effectiveThreadCount,
+                                              gtpo::impl::barrier& barrier) noexcept {
+        std::vector<std::int32_t> stack;
+        stack.reserve(256);
+        const auto first = (n * t) / effectiveThreadCount;
+        const auto last = (n * (t + 1)) / effectiveThreadCount;
+        for (;;) {
+            if (t == 0 && !stop)
+                tree.build(bodies);
+            barrier.wait();
+            if (stop)
+                break;
+            accumulateForces(bodies, tree, p, first, last, stack);
+            barrier.wait();     // Positions are modified only once every thread has read them
+            displacements[t] = moveBodies(bodies, temperature, first, last);
+            barrier.wait();
+            if (t == 0) {
+                ++iteration;
+                double displacement = 0.;
+                for (std::size_t d = 0; d < effectiveThreadCount; ++d)
+                    displacement += displacements[d];
+                displacement /= static_cast<double>(n);
+                temperature *= p.cooling;
+                stop = displacement < p.tolerance ||
+                       iteration >= p.maxIterations ||
+                       (callback && !callback(iteration, displacement));
+            }
+        }
+    });
+    return iteration;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,136 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedKernel.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <functional>
+
+namespace qan { // ::qan
+
+/*! \brief Structure of arrays bodies of a force directed layout (see qan::runForceDirected()).
+ *
+ * Every per body array has size() elements, body \c i is a node center (\c x, \c y) with a \c mobility
+ * (1.0 for a free body, 0.0 for a pinned body that only exert forces), undirected adjacency of body \c i
+ * is <tt>neighbours[offsets[i]]</tt> to <tt>neighbours[offsets[i + 1]]</tt>.
+ *
+ * Use resize() and setAdjacency(), then fill input arrays, \c x and \c y are updated in place.
+ */
+struct ForceDirectedBodies
+{
+    /*! \name Input / Output *///----------------------------------------------
+    //@{
+    //! Body center, updated in place by qan::runForceDirected().
+    std::vector<double>     x, y;
+    //! 1.0 if body is free, 0.0 if body is pinned.
+    std::vector<double>     mobility;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Adjacency *///---------------------------------------------------
+    //@{
+    std::vector<std::size_t>    offsets;
+    std::vector<std::uint32_t>  neighbours;
+
+    /*! \brief Build undirected adjacency from a directed CSR adjacency (\c dirOffsets has size() + 1 elements).
+     *
+     * Self loops are ignored, parallel edges (or reciprocal edges) are kept and attract twice. O(n + m).
+     */
+    void        setAdjacency(const std::vector<std::size_t>& dirOffsets, const std::vector<std::uint32_t>& dirTargets);
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Forces (Internal) *///-------------------------------------------
+    //@{
+    //! Force accumulated on every body during last iteration.
+    std::vector<double>     fx, fy;
+    //@}
+    //-------------------------------------------------------------------------
+
+    inline auto size() const noexcept -> std::size_t { return x.size(); }
+    void        resize(std::size_t size);
+    void        clear() noexcept;
+};
+
+//! Parameters of qan::runForceDirected().
+struct ForceDirectedParameters
+{
+    //! Ideal edge length, also used as repulsion distance scale.
+    double      springLength = 100.;
+    //! Attraction (spring) force multiplier.
+    double      springStrength = 1.;
+    //! Repulsion force multiplier.
+    double      repulsion = 1.;
+    //! Barnes-Hut approximation criterion: a quadtree cell of size s at distance d is approximated when s / d < theta.
+    double      theta = 0.9;
+    //! Attraction toward bodies barycenter (prevent disconnected components drifting away).
+    double      gravity = 0.02;
+    //! Maximum initial displacement of a body per iteration, automatically computed from body count when <= 0.
+    double      temperature = 0.;
+    //! Temperature is multiplied by \c cooling after each iteration.
+    double      cooling = 0.96;
+    //! Layout is converged when average body displacement during an iteration is lower than \c tolerance.
+    double      tolerance = 0.05;
+    //! Maximum number of iterations.
+    int         maxIterations = 500;
+    //! Number of threads used for force accumulation and position updates (0 for hardware concurrency).
+    std::size_t threadCount = 0;
+};
+
+/*! \brief Callback called after every iteration (with current iteration and average body displacement), return false to stop.
+ *
+ * Callback is called from the thread that called runForceDirected() while every other worker threads
+ * are waiting, it can safely read \c bodies positions.
+ */
+using ForceDirectedCallback = std::function<bool(int iteration, double displacement)>;
+
+/*! \brief Run a force directed (Fruchterman-Reingold) layout on \c bodies until convergence, return iteration count.
+ *
+ * Each iteration:
+ * \li Build a Barnes-Hut quadtree of bodies (O(n log n)).
+ * \li Accumulate repulsion (quadtree approximation), attraction and gravity forces on every body, bodies
+ *     are partitioned across \c threadCount threads (no synchronization, each thread write its own bodies forces).
+ * \li Move bodies along their force, displacement being limited by temperature (SIMD pass, AVX, SSE2 or NEON
+ *     depending on target architecture).
+ *
+ * \note Bodies sharing exactly the same position are separated using a deterministic jitter.
+ */
+int     runForceDirected(ForceDirectedBodies& bodies, const ForceDirectedParameters& parameters,
+                         const ForceDirectedCallback& callback = ForceDirectedCallback{});
+
+} // ::qan
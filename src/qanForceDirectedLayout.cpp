@@ -0,0 +1,148 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max
+
+// QuickQanava headers
+#include "./qanForceDirectedLayout.h"
+
+namespace qan { // ::qan
+
+/* ForceDirectedLayout Object Management *///----------------------------------
+ForceDirectedLayout::ForceDirectedLayout(QObject* parent) :
+    qan::AbstractLayout{parent} { }
+
+AbstractLayout::Task    ForceDirectedLayout::createTask()
+{
+    return [parameters = _parameters](qan::LayoutJob& job, qan::LayoutProgress& progress) {
+        qan::ForceDirectedBodies bodies;
+        bodies.resize(job.size());
+        bodies.x = job.x;
+        bodies.y = job.y;
+        bodies.mobility = job.mobility;
+        bodies.setAdjacency(job.offsets, job.targets);
+        const auto iterations = qan::runForceDirected(bodies, parameters, [&](int iteration, double) {
+            if (progress.isCancelled())
+                return false;
+            if (progress.isBatchDue()) {
+                job.x = bodies.x;
+                job.y = bodies.y;
+                progress.post(iteration);
+            }
+            return true;
+        });
+        job.x = std::move(bodies.x);
+        job.y = std::move(bodies.y);
+        return iterations;
+    };
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Parameters *///------------------------------------------------------
+void    ForceDirectedLayout::setSpringLength(qreal springLength) noexcept
+{
+    springLength = std::max(1., springLength);
+    if (!qFuzzyCompare(1. + springLength, 1. + _parameters.springLength)) {
+        _parameters.springLength = springLength;
+        emit springLengthChanged();
+    }
+}
+
+void    ForceDirectedLayout::setSpringStrength(qreal springStrength) noexcept
+{
+    springStrength = std::max(0., springStrength);
+    if (!qFuzzyCompare(1. + springStrength, 1. + _parameters.springStrength)) {
+        _parameters.springStrength = springStrength;
+        emit springStrengthChanged();
+    }
+}
+
+void    ForceDirectedLayout::setRepulsion(qreal repulsion) noexcept
+{
+    repulsion = std::max(0., repulsion);
+    if (!qFuzzyCompare(1. + repulsion, 1. + _parameters.repulsion)) {
+        _parameters.repulsion = repulsion;
+        emit repulsionChanged();
+    }
+}
+
+void    ForceDirectedLayout::setTheta(qreal theta) noexcept
+{
+    theta = std::max(0., theta);
+    if (!qFuzzyCompare(1. + theta, 1. + _parameters.theta)) {
+        _parameters.theta = theta;
+        emit thetaChanged();
+    }
+}
+
+void    ForceDirectedLayout::setGravity(qreal gravity) noexcept
+{
+    gravity = std::max(0., gravity);
+    if (!qFuzzyCompare(1. + gravity, 1. + _parameters.gravity)) {
+        _parameters.gravity = gravity;
+        emit gravityChanged();
+    }
+}
+
+void    ForceDirectedLayout::setMaxIterations(int maxIterations) noexcept
+{
+    maxIterations = std::max(0, maxIterations);
+    if (maxIterations != _parameters.maxIterations) {
+        _parameters.maxIterations = maxIterations;
+        emit maxIterationsChanged();
+    }
+}
+
+void    ForceDirectedLayout::setTolerance(qreal tolerance) noexcept
+{
+    tolerance = std::max(0., tolerance);
+    if (!qFuzzyCompare(1. + tolerance, 1. + _parameters.tolerance)) {
+        _parameters.tolerance = tolerance;
+        emit toleranceChanged();
+    }
+}
+
+void    ForceDirectedLayout::setThreadCount(int threadCount) noexcept
+{
+    threadCount = std::max(0, threadCount);
+    if (threadCount != getThreadCount()) {
+        _parameters.threadCount = static_cast<std::size_t>(threadCount);
+        emit threadCountChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
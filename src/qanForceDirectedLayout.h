@@ -0,0 +1,158 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+
+// QuickQanava headers
+#include "./qanAbstractLayout.h"
+#include "./qanForceDirectedKernel.h"
+
+namespace qan { // ::qan
+
+/*! \brief Force directed layout of a qan::Graph computed on a worker thread.
+ *
+ * Repulsion is approximated with a Barnes-Hut quadtree and forces are accumulated on \c threadCount
+ * threads (see qan::runForceDirected()). Intermediate positions are streamed back to the graph at most
+ * once per frame (see qan::AbstractLayout).
+ *
+ * \code
+ * Qan.ForceDirectedLayout {
+ *   id: forceDirectedLayout
+ *   graph: graph
+ *   springLength: 120
+ *   onFinished: graphView.fitInView()
+ * }
+ * Button { text: "Layout"; onClicked: forceDirectedLayout.start() }
+ * \endcode
+ *
+ * \note Nodes with a non draggable item are pinned.
+ * \nosubgrouping
+ */
+class ForceDirectedLayout : public qan::AbstractLayout
+{
+    Q_OBJECT
+    /*! \name ForceDirectedLayout Object Management *///-----------------------
+    //@{
+public:
+    explicit ForceDirectedLayout(QObject* parent = nullptr);
+    virtual ~ForceDirectedLayout() override = default;
+    ForceDirectedLayout(const ForceDirectedLayout&) = delete;
+    ForceDirectedLayout& operator=(const ForceDirectedLayout&) = delete;
+
+protected:
+    virtual Task    createTask() override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Parameters *///-------------------------------------------
+    //@{
+public:
+    //! Ideal edge length (default to 100.).
+    Q_PROPERTY(qreal springLength READ getSpringLength WRITE setSpringLength NOTIFY springLengthChanged FINAL)
+    void            setSpringLength(qreal springLength) noexcept;
+    inline qreal    getSpringLength() const noexcept { return _parameters.springLength; }
+signals:
+    void            springLengthChanged();
+
+public:
+    //! Edge attraction force multiplier (default to 1.).
+    Q_PROPERTY(qreal springStrength READ getSpringStrength WRITE setSpringStrength NOTIFY springStrengthChanged FINAL)
+    void            setSpringStrength(qreal springStrength) noexcept;
+    inline qreal    getSpringStrength() const noexcept { return _parameters.springStrength; }
+signals:
+    void            springStrengthChanged();
+
+public:
+    //! Node repulsion force multiplier (default to 1.).
+    Q_PROPERTY(qreal repulsion READ getRepulsion WRITE setRepulsion NOTIFY repulsionChanged FINAL)
+    void            setRepulsion(qreal repulsion) noexcept;
+    inline qreal    getRepulsion() const noexcept { return _parameters.repulsion; }
+signals:
+    void            repulsionChanged();
+
+public:
+    //! Barnes-Hut approximation criterion, 0. for an exact O(n²) repulsion (default to 0.9).
+    Q_PROPERTY(qreal theta READ getTheta WRITE setTheta NOTIFY thetaChanged FINAL)
+    void            setTheta(qreal theta) noexcept;
+    inline qreal    getTheta() const noexcept { return _parameters.theta; }
+signals:
+    void            thetaChanged();
+
+public:
+    //! Attraction toward nodes barycenter, keep disconnected components together (default to 0.02).
+    Q_PROPERTY(qreal gravity READ getGravity WRITE setGravity NOTIFY gravityChanged FINAL)
+    void            setGravity(qreal gravity) noexcept;
+    inline qreal    getGravity() const noexcept { return _parameters.gravity; }
+signals:
+    void            gravityChanged();
+
+public:
+    //! Maximum number of iterations (default to 500).
+    Q_PROPERTY(int maxIterations READ getMaxIterations WRITE setMaxIterations NOTIFY maxIterationsChanged FINAL)
+    void            setMaxIterations(int maxIterations) noexcept;
+    inline int      getMaxIterations() const noexcept { return _parameters.maxIterations; }
+signals:
+    void            maxIterationsChanged();
+
+public:
+    //! Layout stops when average node displacement during an iteration is lower than \c tolerance (default to 0.05).
+    Q_PROPERTY(qreal tolerance READ getTolerance WRITE setTolerance NOTIFY toleranceChanged FINAL)
+    void            setTolerance(qreal tolerance) noexcept;
+    inline qreal    getTolerance() const noexcept { return _parameters.tolerance; }
+signals:
+    void            toleranceChanged();
+
+public:
+    //! Number of threads used to accumulate forces, 0 for hardware concurrency (default to 0).
+    Q_PROPERTY(int threadCount READ getThreadCount WRITE setThreadCount NOTIFY threadCountChanged FINAL)
+    void            setThreadCount(int threadCount) noexcept;
+    inline int      getThreadCount() const noexcept { return static_cast<int>(_parameters.threadCount); }
+signals:
+    void            threadCountChanged();
+
+private:
+    qan::ForceDirectedParameters    _parameters;
+    //@}
+    //-------------------------------------------------------------------------
+
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::ForceDirectedLayout)
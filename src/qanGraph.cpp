@@ -34,23 +34,46 @@
 
 // Std headers
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <sstream>
+#include <cstdint>
+#include <cstring>       // std::memcpy
+#include <limits>
+#include <unordered_set>
+#include <algorithm>     // std::max
+#include <stdexcept>     // std::invalid_argument
+#include <cmath>         // std::isnan
 
 // Qt headers
 #include <QQmlProperty>
 #include <QVariant>
 #include <QQmlEngine>
 #include <QQmlComponent>
+#include <QFile>
+#include <QSaveFile>
+#include <QTimer>
+#include <QQmlIncubator>
+#include <QQuickWindow>
+#include <QElapsedTimer>
 
 // QuickQanava headers
 #include "./qanUtils.h"
 #include "./qanGraph.h"
 #include "./qanNavigable.h"
 #include "./qanNodeItem.h"
+#include "./qanDraggableCtrl.h"
 #include "./qanPortItem.h"
 #include "./qanEdgeItem.h"
 #include "./qanGroup.h"
 #include "./qanGroupItem.h"
 #include "./qanConnector.h"
+#include "./qanSelectionOverlay.h"
+
+// GTpo headers
+#include <gtpo/binary_format.h>
+#include <gtpo/algorithm.h>
+#include <gtpo/parallel.h>
 
 namespace qan { // ::qan
 
@@ -65,9 +88,19 @@ Graph::Graph( QQuickItem* parent ) noexcept :
     // GraphView containerItem.
 }
 
+Graph::~Graph()
+{
+    clearIncubators();
+    if (_incubationEngine &&
+        _incubationEngine->incubationController() == _incubationController.get())
+        _incubationEngine->setIncubationController(nullptr);
+    teardownItems(false);
+    clearItemPool();
+}
+
 void    Graph::classBegin()
 {
-    setPortDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/Port.qml")));
+    qmlSetPortDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/Port.qml")));
     setHorizontalDockDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/HorizontalDock.qml")));
     setVerticalDockDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/VerticalDock.qml")));
     setGroupDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/Group.qml")));
@@ -122,18 +155,105 @@ void    Graph::clearGraph() noexcept
 
 void    Graph::clear() noexcept
 {
+    teardownItems(true);
+    _selection.reset();
     _selectedNodes.clear();
+    _selectedGroups.clear();
+    _selectionModelsDirty = false;
+    clearIncubators();
+    _virtualDelegates.clear();
+    _nodesById.clear();
+    _edgesById.clear();
+    _primitiveIds.clear();
+    _undoStack.clear();
     gtpo::graph<qan::Config>::clear();
+    {   // Items not pooled are destroyed with their primitive, keep only pooled items components
+        decltype(_itemComponents) pooledComponents;
+        for (auto& pool : _itemPool)
+            for (const auto& item : pool.second)
+                if (item)
+                    pooledComponents.emplace(item.data(), _itemComponents[item.data()]);
+        _itemComponents.swap(pooledComponents);
+    }
+    _topologicalOrder = nullptr;    // Note: behaviours are destroyed in gtpo::graph<>::clear()
+    _fingerprint = nullptr;
+    _parallelEdgesBehaviour = nullptr;
+    _labelIndex.clear();
+    if ( _nodeColumns )
+        _nodeColumns->clear();
+    if ( _acyclic )
+        resetTopologicalOrder();
+    if ( _parallelEdgeSpacing > 0. )
+        installParallelEdgesBehaviour();
     _styleManager.clear();
+    if (!qFuzzyIsNull(_maxZ))
+        setMaxZ(0.);
+    if (_selectionOverlayItem)
+        _selectionOverlayItem->invalidate();
+}
+
+void    Graph::teardownItems(bool recycle) noexcept
+{
+    // Algorithm:
+    // 1. Detach items from their primitives (primitive destructors no longer delete them one by one).
+    // 2. Reset spatial indexes and deferred edge updates, they only reference graph items.
+    // 3. Recycle items while pool accept them, disconnect and hide others.
+    // 4. Destroy remaining items in container child order.
+    std::vector<QQuickItem*> items;             // 1.
+    items.reserve(get_node_count() + get_edge_count());
+    for (const auto& edge : get_edges())
+        if (edge && edge->getItem() != nullptr)
+            items.push_back(edge->releaseItem());
+    for (const auto& node : get_nodes())
+        if (node && node->getItem() != nullptr)
+            items.push_back(node->releaseItem());
+    if (items.empty())
+        return;
+
+    for (const auto& indexedItem : _indexedItems)  // 2.
+        if (indexedItem.second.item)
+            QObject::disconnect(indexedItem.second.item.data(), nullptr, this, nullptr);
+    _indexedItems.clear();
+    _dirtyIndexedItems.clear();
+    _childIndex.clear();
+    _groupIndex.clear();
+    _portIndex.clear();
+    _culledEdgeItems.clear();
+    _deferredEdgeItems.clear();
+    _deferredEdgeItemsSet.clear();
+    _restackEdgeItems.clear();
+    _restackEdgeItemsSet.clear();
+    scheduleSceneBoundsUpdate();
+
+    std::unordered_set<const QQuickItem*> destroyed;    // 3.
+    destroyed.reserve(items.size());
+    for (const auto item : items) {
+        if (recycle && recycleItem(item))
+            continue;
+        _itemComponents.erase(item);
+        item->disconnect();                 // Note: disconnect every item signal (graph, adjacent edges, QML)
+        QObject::disconnect(this, nullptr, item, nullptr);
+        item->setVisible(false);
+        destroyed.insert(item);
+    }
+
+    const auto container = getContainerItem();   // 4.
+    if (container != nullptr)
+        for (const auto child : container->childItems())
+            if (destroyed.erase(child) > 0)
+                child->deleteLater();
+    for (const auto item : destroyed)           // Items parented to groups or outside container
+        const_cast<QQuickItem*>(item)->deleteLater();
 }
 
 QQuickItem* Graph::graphChildAt(qreal x, qreal y) const
 {
     if ( getContainerItem() == nullptr )
         return nullptr;
-    const QList<QQuickItem*> children = getContainerItem()->childItems();
-    for (int i = children.count()-1; i >= 0; --i) {
-        QQuickItem *child = children.at(i);
+    updateSpatialIndex();
+    const auto containerPos = mapToItem( getContainerItem(), QPointF(x, y) );
+    for (const auto indexedChild : _childIndex.itemsAt( containerPos )) {
+        QQuickItem *child = const_cast<QQuickItem*>( indexedChild );  // Note: destroyed items are removed from index
         QPointF point = mapToItem( child, QPointF(x, y) );  // Map coordinates to the child element's coordinate space
         if ( child->isVisible() &&
              child->contains( point ) &&    // Note 20160508: childAt do not call contains()
@@ -173,51 +293,241 @@ qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem*
         // except can be nullptr
     if (!s.isValid())
         return nullptr;
+    if (getContainerItem() == nullptr)
+        return nullptr;
 
     // Algorithm:
-        // 1. Copy internal group list
-        // 2. Order the container of group from maximum to minimum z
+        // 1. Refresh dirty spatial index entries
+        // 2. Query groups under p, ordered from maximum to minimum global z
         // 3. Return the first group containing rect(p,s)
 
     // 1.
-    std::vector<qan::Group*> groups;
-    groups.reserve(static_cast<unsigned int>(get_groups().size()));
-    for (const auto& group_ptr : qAsConst(get_groups().getContainer())) {
-        const auto group = group_ptr.lock();
-        if (group)
-            groups.push_back(group.get());
-    }
+    updateSpatialIndex();
+
+    // 2., 3.
+    for (const auto indexedItem : _groupIndex.itemsAt(p)) {
+        const auto groupItem = qobject_cast<qan::GroupItem*>(const_cast<QQuickItem*>(indexedItem));
+        if (groupItem == nullptr ||
+            groupItem == except ||
+            groupItem->getGroup() == nullptr)
+            continue;
+        const auto groupRect =  QRectF{ groupItem->mapToItem(getContainerItem(), QPointF{0., 0.}),
+                                        QSizeF{ groupItem->width(), groupItem->height() } };
+        if ( groupRect.contains( QRectF{ p, s } ) )
+             return groupItem->getGroup();
+    } // for all groups under p
+    return nullptr;
+}
 
-    // 2.
-    std::sort(groups.begin(), groups.end(), [](const auto g1, const auto g2) -> bool {
-        if (g1 == nullptr || g2 == nullptr)
-            return false;
-        const auto g1Item = g1->getItem();
-        const auto g2Item = g2->getItem();
-        if (g1Item == nullptr ||
-            g2Item == nullptr)
-            return false;
-        const auto g1GlobalZ = qan::getItemGlobalZ_rec(g1Item);
-        const auto g2GlobalZ = qan::getItemGlobalZ_rec(g2Item);
-        return g1GlobalZ > g2GlobalZ;
-    });
+std::vector<const QQuickItem*>  Graph::graphChildrenIn(const QRectF& rect) const noexcept
+{
+    if (getContainerItem() == nullptr)
+        return {};
+    updateSpatialIndex();
+    return _childIndex.itemsIn(rect);
+}
 
-    // 3.
+qan::PortItem*  Graph::portAt(const QPointF& p) const noexcept
+{
+    const auto container = getContainerItem();
+    if (container == nullptr)
+        return nullptr;
+    updateSpatialIndex();
+    for (const auto indexedItem : _portIndex.itemsAt(p)) {
+        const auto portItem = qobject_cast<qan::PortItem*>(const_cast<QQuickItem*>(indexedItem));
+        if (portItem == nullptr ||
+            !portItem->isVisible())
+            continue;
+        if (portItem->contains(portItem->mapFromItem(container, p)))
+            return portItem;
+    }
+    return nullptr;
+}
+
+QQuickItem* Graph::pickItem(const QPointF& p) const noexcept
+{
     if (getContainerItem() == nullptr)
-            return nullptr;
-    for (const auto group : qAsConst(groups)) {
-        if (group &&
-            group->getItem() != nullptr &&
-            group->getItem() != except) {
-            const auto groupItem = group->getItem();
+        return nullptr;
+    QAN_TRACE_SCOPE("Graph::pickItem");
+    const auto portItem = portAt(p);        // Note: ports are drawn over their node, portAt() refresh spatial index
+    if (portItem != nullptr)
+        return portItem;
+    for (const auto indexedChild : _childIndex.itemsAt(p)) {   // Candidates are ordered from top to bottom z
+        const auto picked = pickItemRec(const_cast<QQuickItem*>(indexedChild), p);
+        if (picked != nullptr)
+            return picked;
+    }
+    return nullptr;
+}
 
-            const auto groupRect =  QRectF{ groupItem->mapToItem(getContainerItem(), QPointF{0., 0.}),
-                                            QSizeF{ groupItem->width(), groupItem->height() } };
-            if ( groupRect.contains( QRectF{ p, s } ) )
-                 return group;
+QQuickItem* Graph::pickItemRec(QQuickItem* item, const QPointF& p) const noexcept
+{
+    if (item == nullptr ||
+        !item->isVisible())
+        return nullptr;
+    const auto point = item->mapFromItem(getContainerItem(), p);
+    if (point.x() < 0. || point.x() > item->width() ||
+        point.y() < 0. || point.y() > item->height() ||
+        !item->contains(point))             // Edge hit polyline test
+        return nullptr;
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    if (nodeItem != nullptr &&
+        nodeItem->getComplexBoundingShape() &&
+        !nodeItem->isInsideBoundingShape(point))
+        return nullptr;
+    const auto groupItem = qobject_cast<qan::GroupItem*>(item);
+    if (groupItem != nullptr &&
+        groupItem->getContainer() != nullptr) {
+        const auto groupChildren = groupItem->getContainer()->childItems();
+        for (int gc = groupChildren.count() - 1; gc >= 0; --gc) {
+            const auto picked = pickItemRec(groupChildren.at(gc), p);
+            if (picked != nullptr)
+                return picked;
         }
-    } // for all groups
-    return nullptr;
+    }
+    return item;
+}
+
+void    Graph::invalidateSpatialIndex() noexcept
+{
+    for (const auto& indexedItem : _indexedItems)
+        markIndexedItemDirty(indexedItem.first);
+}
+
+void    Graph::indexItem(QQuickItem* item) noexcept
+{
+    if (item == nullptr)
+        return;
+    const auto inserted = _indexedItems.emplace(item, IndexedItem{item, false}).second;
+    markIndexedItemDirty(item);
+    if (!inserted)
+        return;
+    if (_centralPicking)
+        configurePicking(qobject_cast<qan::EdgeItem*>(item));
+    const auto markDirty = [this, item]() { markIndexedItemDirty(item); };
+    connect(item, &QQuickItem::xChanged,        this, markDirty);
+    connect(item, &QQuickItem::yChanged,        this, markDirty);
+    connect(item, &QQuickItem::widthChanged,    this, markDirty);
+    connect(item, &QQuickItem::heightChanged,   this, markDirty);
+    connect(item, &QQuickItem::zChanged,        this, markDirty);
+    connect(item, &QQuickItem::parentChanged,   this, markDirty);
+    const auto zModified = [this, item]() { childZModified(item); };
+    connect(item, &QQuickItem::zChanged,        this, zModified);
+    connect(item, &QQuickItem::parentChanged,   this, zModified);
+    connect(item, &QObject::destroyed,          this, [this, item]() { unindexItem(item); });
+}
+
+void    Graph::unindexItem(const QQuickItem* item) noexcept
+{
+    _indexedItems.erase(item);
+    _sceneDirtyRect = _sceneDirtyRect.united(_childIndex.rectOf(item));
+    _childIndex.remove(item);
+    _groupIndex.remove(item);
+    _portIndex.remove(item);
+    scheduleSceneBoundsUpdate();
+}
+
+void    Graph::markIndexedItemDirty(const QQuickItem* item) noexcept
+{
+    const auto indexedItem = _indexedItems.find(item);
+    if (indexedItem == _indexedItems.end() ||
+        !indexedItem->second.item)
+        return;
+    if (!indexedItem->second.dirty) {
+        indexedItem->second.dirty = true;
+        _dirtyIndexedItems.push_back(item);
+    }
+    if (qobject_cast<const qan::PortItem*>(indexedItem->second.item.data()) != nullptr)
+        return;     // Ports are neither obstacles nor part of scene bounds
+    if (_nodeColumns)
+        markNodeColumnsDirty(item);
+    markPortsDirty(qobject_cast<const qan::NodeItem*>(indexedItem->second.item.data()));
+    if (_orthoRouter)
+        _orthoRouter->obstacleModified(item);
+    scheduleSceneBoundsUpdate();
+    // Moving a group move its sub groups in container item coordinates
+    const auto groupItem = qobject_cast<const qan::GroupItem*>(indexedItem->second.item.data());
+    if (groupItem != nullptr &&
+        groupItem->getContainer() != nullptr)
+        for (const auto groupChild : groupItem->getContainer()->childItems())
+            if (qobject_cast<const qan::GroupItem*>(groupChild) != nullptr)
+                markIndexedItemDirty(groupChild);
+}
+
+void    Graph::markPortsDirty(const qan::NodeItem* nodeItem) noexcept
+{
+    if (nodeItem == nullptr)
+        return;
+    for (const auto portItem : nodeItem->getPorts())
+        markIndexedItemDirty(portItem);
+    // Moving a group move its grouped nodes ports in container item coordinates (sub groups are marked dirty in markIndexedItemDirty())
+    const auto groupItem = qobject_cast<const qan::GroupItem*>(nodeItem);
+    if (groupItem != nullptr &&
+        groupItem->getContainer() != nullptr)
+        for (const auto groupChild : groupItem->getContainer()->childItems())
+            if (qobject_cast<const qan::GroupItem*>(groupChild) == nullptr)
+                markPortsDirty(qobject_cast<const qan::NodeItem*>(groupChild));
+}
+
+void    Graph::updateSpatialIndex() const noexcept
+{
+    if (_dirtyIndexedItems.empty())
+        return;
+    const auto container = getContainerItem();
+    if (container == nullptr)
+        return;
+    for (const auto dirtyItem : _dirtyIndexedItems) {
+        const auto indexedItem = _indexedItems.find(dirtyItem);
+        if (indexedItem == _indexedItems.end())
+            continue;       // Item has been unindexed while dirty
+        indexedItem->second.dirty = false;
+        const auto item = indexedItem->second.item.data();
+        if (item == nullptr)
+            continue;
+        const auto rect = item->mapRectToItem(container, QRectF{0., 0., item->width(), item->height()});
+        if (qobject_cast<const qan::PortItem*>(item) != nullptr) {
+            _portIndex.insert(item, rect, qan::getItemGlobalZ_rec(item));
+            continue;
+        }
+        _sceneDirtyRect = _sceneDirtyRect.united(_childIndex.rectOf(item));
+        if (item->parentItem() == container) {
+            _childIndex.insert(item, rect, item->z());
+            _sceneDirtyRect = _sceneDirtyRect.united(rect);
+        } else
+            _childIndex.remove(item);
+        if (qobject_cast<const qan::GroupItem*>(item) != nullptr)
+            _groupIndex.insert(item, rect, qan::getItemGlobalZ_rec(item));
+    }
+    _dirtyIndexedItems.clear();
+}
+
+QRectF  Graph::getSceneBounds() const noexcept
+{
+    updateSpatialIndex();
+    return _childIndex.bounds();
+}
+
+void    Graph::scheduleSceneBoundsUpdate() noexcept
+{
+    if (_sceneBoundsUpdateScheduled)
+        return;
+    _sceneBoundsUpdateScheduled = true;
+    QTimer::singleShot(0, this, [this]() { updateSceneBounds(); });
+}
+
+void    Graph::updateSceneBounds() noexcept
+{
+    _sceneBoundsUpdateScheduled = false;
+    const auto sceneBounds = getSceneBounds();
+    if (!_sceneDirtyRect.isNull()) {
+        const auto dirtyRect = _sceneDirtyRect;
+        _sceneDirtyRect = QRectF{};
+        emit sceneModified(dirtyRect);
+    }
+    if (sceneBounds != _sceneBounds) {
+        _sceneBounds = sceneBounds;
+        emit sceneBoundsChanged();
+    }
 }
 
 void    Graph::setContainerItem(QQuickItem* containerItem)
@@ -231,6 +541,9 @@ void    Graph::setContainerItem(QQuickItem* containerItem)
     if (containerItem != nullptr &&
         containerItem != _containerItem.data()) {
         _containerItem = containerItem;
+        if (_selectionOverlayItem)
+            _selectionOverlayItem->setParentItem(_containerItem);
+        invalidateSpatialIndex();
         emit containerItemChanged();
     }
 }
@@ -322,6 +635,9 @@ void    Graph::setNodeDelegate(std::unique_ptr<QQmlComponent> nodeDelegate) noex
 
 void    Graph::setEdgeDelegate(QQmlComponent* edgeDelegate) noexcept
 {
+    if ( edgeDelegate == nullptr ||
+         edgeDelegate == _edgeDelegate.get() )
+        return;     // Actual delegate must not be wrapped in a temporary owning pointer
     QQmlEngine::setObjectOwnership( edgeDelegate, QQmlEngine::CppOwnership );
     setEdgeDelegate(std::unique_ptr<QQmlComponent>(edgeDelegate));
 }
@@ -366,16 +682,22 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
         if (!component->isReady())
             throw qan::Error{ "Error delegate component is not ready." };
 
-        const auto rootContext = qmlContext(this);
-        if (rootContext == nullptr)
-            throw qan::Error{ "Error can't access to local QML context." };
-        QObject* object = component->beginCreate(rootContext);
-        if (object == nullptr ||
-            component->isError()) {
-            if (object != nullptr)
-                object->deleteLater();
-            throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
-                              component->errorString() };
+        // Reuse a recycled item for graph primitives (see itemPoolSize)
+        QObject* object = ( node != nullptr || edge != nullptr || group != nullptr ) ? takePooledItem(component) :
+                                                                                      nullptr;
+        const bool recycled = object != nullptr;
+        if (!recycled) {
+            const auto rootContext = qmlContext(this);
+            if (rootContext == nullptr)
+                throw qan::Error{ "Error can't access to local QML context." };
+            object = component->beginCreate(rootContext);
+            if (object == nullptr ||
+                component->isError()) {
+                if (object != nullptr)
+                    object->deleteLater();
+                throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
+                                  component->errorString() };
+            }
         }
         // No error occurs
         if (node != nullptr) {
@@ -384,6 +706,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
                 node->setItem(nodeItem);
                 nodeItem->setNode(node);
                 nodeItem->setGraph(this);
+                nodeItem->setLevelOfDetail(_levelOfDetail);     // Set before completion, delegates do not load unnecessary content
                 nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
                 _styleManager.setStyleComponent(&style, component );
             }
@@ -409,19 +732,31 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
             if (nodeItem != nullptr)                                    // is a preview item, but now actual underlining node.
                 nodeItem->setItemStyle(&style);
         }
-        component->completeCreate();
-        if (!component->isError()) {
-            QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
+        if (recycled) {
             item = qobject_cast<QQuickItem*>(object);
-            item->setVisible(true);
             item->setParentItem(getContainerItem());
-        } // Note: There is no leak until cpp ownership is set
+            item->setVisible(true);
+        } else {
+            component->completeCreate();
+            if (!component->isError()) {
+                QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
+                item = qobject_cast<QQuickItem*>(object);
+                item->setVisible(true);
+                item->setParentItem(getContainerItem());
+                if (_itemPoolSize > 0 &&
+                    ( node != nullptr || edge != nullptr || group != nullptr ))
+                    _itemComponents[item] = ItemOrigin{component, item->size()};
+            } // Note: There is no leak until cpp ownership is set
+        }
     } catch (const qan::Error& e) {
         Q_UNUSED(e)
         qWarning() << "qan::Graph::createFromComponent(): " << component->errors();
     } catch (const std::exception& e) {
         qWarning() << "qan::Graph::createFromComponent(): " << e.what();
     }
+    if (item != nullptr &&
+        ( node != nullptr || edge != nullptr || group != nullptr ))
+        indexItem(item);
     return item;
 }
 
@@ -431,202 +766,2014 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component, qan::Style* sty
             style != nullptr ) ? createFromComponent( component, *style, nullptr, nullptr, nullptr ) :
                                  nullptr;
 }
+//-----------------------------------------------------------------------------
 
-void Graph::setSelectionDelegate(QQmlComponent* selectionDelegate) noexcept
-{
-    // Note: Cpp ownership is voluntarily not set to avoid destruction of
-    // objects owned from QML
-    setSelectionDelegate(std::unique_ptr<QQmlComponent>(selectionDelegate));
-}
-
-void Graph::setSelectionDelegate(std::unique_ptr<QQmlComponent> selectionDelegate) noexcept
+/* Delegate Item Pool *///-----------------------------------------------------
+void    Graph::setItemPoolSize(int itemPoolSize) noexcept
 {
-    bool delegateChanged{false};
-    if ( selectionDelegate ) {
-        if ( selectionDelegate != _selectionDelegate ) {
-            _selectionDelegate = std::move(selectionDelegate);
-            delegateChanged = true;
+    itemPoolSize = std::max(0, itemPoolSize);
+    if (itemPoolSize == _itemPoolSize)
+        return;
+    _itemPoolSize = itemPoolSize;
+    for (auto& pool : _itemPool) {   // Shrink pools to new high-water mark
+        auto& items = pool.second;
+        while (static_cast<int>(items.size()) > _itemPoolSize) {
+            const auto item = items.back();
+            items.pop_back();
+            if (item) {
+                _itemComponents.erase(item.data());
+                item->deleteLater();
+            }
         }
-    } else {    // Use QuickQanava default selection delegate
-        _selectionDelegate = createComponent(QStringLiteral("qrc:/QuickQanava/SelectionItem.qml"));
-        delegateChanged = true;
-    }
-    if ( delegateChanged ) {  // Update all existing delegates...
-        // Note: It could be done in a more more 'generic' way!
-        auto updateNodeSelectionItem = [this]( auto& primitive ) -> void {
-            auto finalPrimitive = qobject_cast<qan::Node*>(primitive.get());
-            if ( finalPrimitive != nullptr &&
-                 finalPrimitive->getItem() &&
-                 finalPrimitive->getItem()->getSelectionItem() != nullptr )   // Replace only existing selection items
-                    finalPrimitive->getItem()->setSelectionItem(this->createSelectionItem(finalPrimitive->getItem()));
-        };
-        auto updateGroupSelectionItem = [this]( auto& primitive ) -> void {
-            auto finalPrimitive = qobject_cast<qan::Group*>(primitive.lock().get());
-            if ( finalPrimitive != nullptr &&
-                 finalPrimitive->getItem() &&
-                 finalPrimitive->getItem()->getSelectionItem() != nullptr )   // Replace only existing selection items
-                    finalPrimitive->getItem()->setSelectionItem(this->createSelectionItem(finalPrimitive->getItem()));
-        };
-        std::for_each(get_groups().begin(), get_groups().end(), updateGroupSelectionItem);
-        std::for_each(get_nodes().begin(), get_nodes().end(), updateNodeSelectionItem);
-        emit selectionDelegateChanged();
     }
+    if (_itemPoolSize == 0)
+        _itemComponents.clear();
+    emit itemPoolSizeChanged();
 }
 
-QPointer<QQuickItem> Graph::createSelectionItem( QQuickItem* parent ) noexcept
+void    Graph::clearItemPool() noexcept
 {
-    const auto selectionItem = createItemFromComponent(_selectionDelegate.get());
-    if ( selectionItem ) {
-        selectionItem->setEnabled(false); // Avoid node/edge/group selection problems
-        selectionItem->setState("UNSELECTED");
-        selectionItem->setVisible(true);
-        QQmlEngine::setObjectOwnership( selectionItem, QQmlEngine::CppOwnership );
-        if (parent != nullptr ) {
-            selectionItem->setParentItem(parent);
-            selectionItem->setZ(1.0);
-        }
-        return selectionItem;
-    }
-    return QPointer<QQuickItem>{nullptr};
+    for (auto& pool : _itemPool)
+        for (const auto& item : pool.second)
+            if (item)
+                item->deleteLater();
+    _itemPool.clear();
+    _itemComponents.clear();
 }
 
-std::unique_ptr<QQmlComponent>  Graph::createComponent(const QString& url) noexcept
+int     Graph::getPooledItemCount(QQmlComponent* component) const noexcept
 {
-    // PRECONDITIONS
-        // url could not be empty
-    if ( url.isEmpty() ) {
-        qWarning() << "qan::Graph::createComponent(): Error: Empty url.";
-        return std::unique_ptr<QQmlComponent>();
-    }
-
-    QQmlEngine* engine = qmlEngine( this );
-    std::unique_ptr<QQmlComponent> component;
-    if ( engine != nullptr ) {
-        try {
-            component = std::make_unique<QQmlComponent>(engine, url);
-            if ( !component->isReady() ||
-                 component->isError() ||
-                 component->isNull()  ) {
-                qWarning() << "qan::Graph::createComponent(): Error while creating component from URL " << url;
-                qWarning() << "\tQML Component status=" << component->status();
-                qWarning() << "\tQML Component errors=" << component->errors();
-            }
-            return component;
-        } catch (...) { // Might be std::bad_alloc
-            qWarning() << "qan::Graph::createComponent(): Error while creating component " << url;
-        }
-    } else qWarning() << "qan::Graph::createComponent(): No access to QML engine.";
+    const auto pool = _itemPool.find(component);
+    return pool != _itemPool.cend() ? static_cast<int>(pool->second.size()) : 0;
+}
 
-    return component;
+int     Graph::getPooledItemCount() const noexcept
+{
+    std::size_t count = 0;
+    for (const auto& pool : _itemPool)
+        count += pool.second.size();
+    return static_cast<int>(count);
 }
 
-QPointer<QQuickItem> Graph::createItemFromComponent(QQmlComponent* component) noexcept
+QQuickItem* Graph::takePooledItem(QQmlComponent* component) noexcept
 {
-    // PRECONDITIONS:
-        // component should not be nullptr, warning issued
-    if ( component == nullptr ) {
-        qWarning() << "qan::Graph::createItemFromComponent(): Error called with a nullptr delegate component.";
+    const auto pool = _itemPool.find(component);
+    if (pool == _itemPool.end())
         return nullptr;
-    }
-    QQuickItem* item = nullptr;
-    try {
-        if ( !component->isReady() )
-            throw qan::Error{ "Error delegate component is not ready." };
-
-        const auto rootContext = qmlContext(this);
-        if ( rootContext == nullptr )
-            throw qan::Error{ "Error can't access to local QML context." };
-        QObject* object = component->beginCreate(rootContext);
-        if ( object == nullptr ||
-             component->isError() ) {
-            if ( object != nullptr )
-                object->deleteLater();
-            throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
-                              component->errorString() };
+    auto& items = pool->second;
+    while (!items.empty()) {
+        const auto item = items.back();
+        items.pop_back();
+        if (item) {                 // Pooled item might have been destroyed externally
+            QAN_TRACE_COUNT(ItemsReused);
+            return item.data();
         }
-        component->completeCreate();
-        if ( !component->isError() ) {
-            QQmlEngine::setObjectOwnership( object, QQmlEngine::CppOwnership );
-            item = qobject_cast< QQuickItem* >( object );
-            item->setVisible( true );
-            item->setParentItem( getContainerItem() );
-        } // Note QAN3: There is no leak until cpp ownership is set
-    } catch ( const qan::Error& e ) {
-        qWarning() << "qan::Graph::createItemFromComponent(): " << e.getMsg() << "\n" << component->errors();
-    } catch ( const std::exception& e ) {
-        qWarning() << "qan::Graph::createItemFromComponent(): " << e.what() << "\n" << component->errors();
     }
-    return QPointer<QQuickItem>{item};
+    return nullptr;
 }
-//-----------------------------------------------------------------------------
 
-/* Graph Factories *///--------------------------------------------------------
-auto    Graph::insertNonVisualNode( SharedNode node ) noexcept(false) -> WeakNode
+bool    Graph::recycleItem(QQuickItem* item) noexcept
 {
-    auto weakNode = gtpo_graph_t::insert_node(node);
-    auto insertedNode = weakNode.lock();
-    if (insertedNode) {
-        onNodeInserted(*insertedNode);
-        emit nodeInserted(insertedNode.get());
+    if (item == nullptr ||
+        _itemPoolSize <= 0)
+        return false;
+    const auto itemComponent = _itemComponents.find(item);
+    if (itemComponent == _itemComponents.end())
+        return false;
+    const auto component = itemComponent->second.component;
+    if (!component ||
+        getPooledItemCount(component.data()) >= _itemPoolSize) {
+        _itemComponents.erase(itemComponent);
+        return false;
     }
-    return weakNode;
+    auto& items = _itemPool[component.data()];
+    // Reset item: detach from graph signals, from its primitive and its endpoints, hide it in graph container item
+    QObject::disconnect(item, nullptr, this, nullptr);
+    unindexItem(item);
+    if (const auto groupItem = qobject_cast<qan::GroupItem*>(item))
+        groupItem->setGroup(nullptr);
+    else if (const auto nodeItem = qobject_cast<qan::NodeItem*>(item))
+        nodeItem->setNode(nullptr);
+    else if (const auto edgeItem = qobject_cast<qan::EdgeItem*>(item)) {
+        unbindEdgeItemPorts(*edgeItem);
+        edgeItem->resetEndpoints();
+        edgeItem->uncull();
+        edgeItem->setEdge(nullptr);
+        edgeItem->setGraph(nullptr);
+    }
+    if (const auto nodeItem = qobject_cast<qan::NodeItem*>(item)) {
+        for (const auto port : qAsConst(nodeItem->getPorts()))  // Ports are specific to recycled node
+            if (port != nullptr)
+                unindexItem(port);
+        nodeItem->clearPorts();
+        nodeItem->setSelected(false);
+        nodeItem->setCulled(false);
+    }
+    item->setVisible(false);
+    item->setParentItem(getContainerItem());
+    item->setPosition(QPointF{0., 0.});
+    item->setSize(itemComponent->second.size);
+    items.emplace_back(item);
+    QAN_TRACE_COUNT(ItemsRecycled);
+    return true;
 }
 
-qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+void    Graph::recycleNodeItems(qan::Node& node) noexcept
 {
-    return insertNode<qan::Node>(nodeComponent, nodeStyle);
+    if (_itemPoolSize <= 0)
+        return;
+    const auto recycleEdgeItem = [this](const auto& weakEdge) {
+        const auto edge = weakEdge.lock();
+        if (edge && edge->getItem() != nullptr) {
+            const auto edgeItem = edge->getItem();
+            if (recycleItem(edgeItem))
+                edge->releaseItem();
+        }
+    };
+    for (const auto& inEdge : node.get_in_edges())
+        recycleEdgeItem(inEdge);
+    for (const auto& outEdge : node.get_out_edges())
+        recycleEdgeItem(outEdge);
+    const auto nodeItem = node.getItem();
+    if (nodeItem != nullptr &&
+        recycleItem(nodeItem))
+        node.releaseItem();
 }
 
-bool    Graph::insertNode(const SharedNode& node, QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+/* Asynchronous Item Creation *///---------------------------------------------
+//! Incubate a node delegate item asynchronously, forward incubation callbacks to graph.
+class NodeIncubator : public QQmlIncubator
 {
-    // PRECONDITIONS:
-        // node must be dereferencable
-        // nodeComponent and nodeStyle can be nullptr
-    if (!node)
-        return false;
+public:
+    NodeIncubator(qan::Graph& graph, const qan::Graph::SharedNode& node,
+                  QQmlComponent* component, qan::NodeStyle* style) noexcept :
+        QQmlIncubator{QQmlIncubator::Asynchronous},
+        _graph{graph}, _node{node}, _component{component}, _style{style} { }
+    NodeIncubator(const NodeIncubator&) = delete;
+
+    qan::Graph&                 _graph;
+    qan::Graph::WeakNode        _node;
+    QPointer<QQmlComponent>     _component;
+    QPointer<qan::NodeStyle>    _style;
+    bool                        _finished = false;
+    bool                        _started = false;
+
+protected:
+    virtual void    setInitialState(QObject* object) override { _graph.initNodeIncubation(*this, object); }
+    virtual void    statusChanged(QQmlIncubator::Status status) override { _graph.nodeIncubationStatusChanged(*this, status); }
+};
 
-    if (nodeComponent == nullptr) {
-        nodeComponent = _nodeDelegate.get(); // If no delegate component is specified, try the default node delegate
+//! Time sliced incubation controller used when graph QML engine has no controller (ie graph is not displayed in a QQuickWindow).
+class GraphIncubationController : public QObject, public QQmlIncubationController
+{
+public:
+    GraphIncubationController() noexcept : QObject{nullptr} {
+        _timer.setInterval(0);
+        QObject::connect(&_timer, &QTimer::timeout, this, [this]() { incubateFor(5); });
     }
-    if (nodeComponent == nullptr) {               // Otherwise, throw an error, a visual node must have a delegate
-        qWarning() << "qan::Graph::insertNode(SharedNode): Can't find a valid node delegate component.";
-        return false;
+
+protected:
+    virtual void    incubatingObjectCountChanged(int count) override {
+        if (count > 0) {
+            if (!_timer.isActive())
+                _timer.start();
+        } else
+            _timer.stop();
+    }
+
+private:
+    QTimer  _timer;
+};
+
+qan::Node*  Graph::insertNodeAsync(QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+{
+    if (_headless)      // No item is created in headless mode, there is nothing to incubate
+        return insertNode(nodeComponent, nodeStyle);
+    const auto engine = qmlEngine(this);
+    const auto context = qmlContext(this);
+    if (engine == nullptr ||
+        context == nullptr) {
+        qWarning() << "qan::Graph::insertNodeAsync(): Error: No QML engine available for asynchronous item creation.";
+        return nullptr;
+    }
+    if (nodeComponent == nullptr)
+        nodeComponent = _nodeDelegate.get();
+    if (nodeComponent == nullptr)
+        nodeComponent = qan::Node::delegate(*engine);
+    if (nodeStyle == nullptr)
+        nodeStyle = qan::Node::style(nullptr);
+    if (nodeComponent == nullptr ||
+        nodeStyle == nullptr) {
+        qWarning() << "qan::Graph::insertNodeAsync(): Can't find a valid node delegate component or style.";
+        return nullptr;
     }
     if (nodeComponent->isError()) {
-        qWarning() << "qan::Graph::insertNode(SharedNode): Component error: " << nodeComponent->errors();
-        return false;
+        qWarning() << "qan::Graph::insertNodeAsync(): Component error: " << nodeComponent->errors();
+        return nullptr;
     }
+    const auto node = std::make_shared<qan::Node>();
     try {
         QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
-        qan::NodeItem* nodeItem = nullptr;
-        if (nodeStyle != nullptr) {
-            _styleManager.setStyleComponent(nodeStyle, nodeComponent);
-            nodeItem = static_cast<qan::NodeItem*>( createFromComponent( nodeComponent,
-                                                                         *nodeStyle,
-                                                                         node.get() ) );
-        }
-        if ( nodeItem  == nullptr )
-            throw qan::Error{"Node item creation failed."};
-        nodeItem->setNode(node.get());
+        gtpo_graph_t::insert_node(node);
+    } catch (const gtpo::bad_topology_error& e) {
+        qWarning() << "qan::Graph::insertNodeAsync(): Error: Topology error: " << e.what();
+        return nullptr;
+    } catch (...) {
+        qWarning() << "qan::Graph::insertNodeAsync(): Error: Topology error.";
+        return nullptr;
+    }
+    ensureIncubationController(*engine);
+    _styleManager.setStyleComponent(nodeStyle, nodeComponent);
+    _nodeIncubators.emplace_back(std::make_unique<qan::NodeIncubator>(*this, node, nodeComponent, nodeStyle));
+    ++_incubationTotal;
+    auto& incubator = *_nodeIncubators.back();
+    if (_attachmentBudget > 0) {    // Incubation is started by attachPendingItems(), closest to viewport center first
+        _pendingAttachments.push_back(PendingAttachment{node, &incubator});
+        _attachmentOrdered = false;
+        scheduleAttachmentFrame();
+        emit pendingAttachmentCountChanged();
+    } else
+        startIncubation(incubator);
+    onNodeInserted(*node);
+    notifyNodeInserted(node.get());
+    return node.get();
+}
+
+void    Graph::initNodeIncubation(qan::NodeIncubator& incubator, QObject* object) noexcept
+{
+    const auto node = incubator._node.lock();
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+    if (!node ||
+        nodeItem == nullptr)
+        return;
+    node->setItem(nodeItem);
+    nodeItem->setNode(node.get());
+    nodeItem->setGraph(this);
+    if (incubator._style)
+        nodeItem->setStyle(incubator._style.data());
+}
+
+void    Graph::nodeIncubationStatusChanged(qan::NodeIncubator& incubator, QQmlIncubator::Status status) noexcept
+{
+    if (status == QQmlIncubator::Loading ||
+        status == QQmlIncubator::Null)
+        return;
+    if (status == QQmlIncubator::Ready) {
+        const auto node = incubator._node.lock();
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(incubator.object());
+        if (!node ||                    // Node has been removed (or graph cleared) during incubation
+            nodeItem == nullptr) {
+            if (incubator.object() != nullptr)
+                incubator.object()->deleteLater();
+        } else {
+            QQmlEngine::setObjectOwnership(nodeItem, QQmlEngine::CppOwnership);
+            nodeItem->setParentItem(getContainerItem());
+            nodeItem->setVisible(true);
+            connect(nodeItem, &qan::NodeItem::nodeClicked, this, [this] (qan::NodeItem* nodeItem, QPointF p) {
+                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+                    emit this->nodeClicked(nodeItem->getNode(), p);
+            });
+            connect(nodeItem, &qan::NodeItem::nodeRightClicked, this, [this] (qan::NodeItem* nodeItem, QPointF p) {
+                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+                    emit this->nodeRightClicked(nodeItem->getNode(), p);
+            });
+            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked, this, [this] (qan::NodeItem* nodeItem, QPointF p) {
+                if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
+            });
+            {   // Send item to front
+                _maxZ += 1;
+                nodeItem->setZ(_maxZ);
+            }
+            indexItem(nodeItem);
+            // Edges inserted while node item was incubated have no source/destination item
+            for (const auto& inEdge : node->get_in_edges()) {
+                const auto edge = inEdge.lock();
+                if (edge && edge->getItem() != nullptr)
+                    edge->getItem()->setDestinationItem(nodeItem);
+            }
+            for (const auto& outEdge : node->get_out_edges()) {
+                const auto edge = outEdge.lock();
+                if (edge && edge->getItem() != nullptr)
+                    edge->getItem()->setSourceItem(nodeItem);
+            }
+            if (_itemPoolSize > 0 &&
+                incubator._component)
+                _itemComponents[nodeItem] = ItemOrigin{incubator._component, nodeItem->size()};
+            emit nodeItemReady(node.get());
+        }
+    } else if (status == QQmlIncubator::Error)
+        qWarning() << "qan::Graph::insertNodeAsync(): Node item incubation failed: " << incubator.errors();
+    finishIncubation(incubator);
+}
+
+void    Graph::startIncubation(qan::NodeIncubator& incubator) noexcept
+{
+    const auto context = qmlContext(this);
+    if (!incubator._component ||
+        context == nullptr) {
+        finishIncubation(incubator);
+        return;
+    }
+    incubator._started = true;
+    ++_runningIncubations;
+    incubator._component->create(incubator, context);  // Note: statusChanged() might be called synchronously
+}
+
+void    Graph::finishIncubation(qan::NodeIncubator& incubator) noexcept
+{
+    if (incubator._finished)
+        return;
+    if (incubator._started) {
+        --_runningIncubations;
+        if (!_pendingAttachments.empty())   // A running incubation slot is available
+            scheduleAttachmentFrame();
+    }
+    incubator._finished = true;
+    ++_incubationReady;
+    emit itemIncubationProgress(_incubationReady, _incubationTotal);
+    if (!_incubatorsPurgePending) {
+        _incubatorsPurgePending = true;
+        QTimer::singleShot(0, this, [this]() { purgeIncubators(); });
+    }
+}
+
+void    Graph::ensureIncubationController(QQmlEngine& engine) noexcept
+{
+    if (engine.incubationController() != nullptr)  // Usually QQuickWindow controller
+        return;
+    if (!_incubationController)
+        _incubationController = std::make_unique<qan::GraphIncubationController>();
+    engine.setIncubationController(_incubationController.get());
+    _incubationEngine = &engine;
+}
+
+void    Graph::purgeIncubators() noexcept
+{
+    _incubatorsPurgePending = false;
+    _nodeIncubators.erase(std::remove_if(_nodeIncubators.begin(), _nodeIncubators.end(),
+                                         [](const auto& incubator) { return !incubator || incubator->_finished; }),
+                          _nodeIncubators.end());
+    if (_nodeIncubators.empty() &&
+        _incubationTotal > 0) {
+        _incubationTotal = 0;
+        _incubationReady = 0;
+        emit itemIncubationFinished();
+    }
+}
+
+void    Graph::clearIncubators() noexcept
+{
+    for (auto& incubator : _nodeIncubators)     // Note: clear() on a loading incubator discard the pending object
+        if (incubator && !incubator->_finished) {
+            incubator->_finished = true;
+            incubator->clear();
+        }
+    _nodeIncubators.clear();
+    _incubationTotal = 0;
+    _incubationReady = 0;
+    _runningIncubations = 0;
+    if (!_pendingAttachments.empty()) {
+        _pendingAttachments.clear();
+        emit pendingAttachmentCountChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Progressive Attachment *///-------------------------------------------------
+namespace { // ::anonymous
+//! Maximum number of incubations started by attachPendingItems() and not yet finished.
+constexpr int   maxRunningIncubations = 16;
+} // ::anonymous
+
+void    Graph::setAttachmentBudget(int attachmentBudget) noexcept
+{
+    attachmentBudget = std::max(0, attachmentBudget);
+    if (attachmentBudget == _attachmentBudget)
+        return;
+    _attachmentBudget = attachmentBudget;
+    if (_attachmentBudget == 0 &&          // Flush everything that is pending
+        !_pendingAttachments.empty())
+        attachPendingItems();
+    emit attachmentBudgetChanged();
+}
+
+void    Graph::scheduleAttachmentFrame() noexcept
+{
+    if (_attachmentFramePending)
+        return;
+    _attachmentFramePending = true;
+    scheduleFrameUpdate();
+}
+
+void    Graph::attachPendingItems() noexcept
+{
+    _attachmentFramePending = false;
+    if (_pendingAttachments.empty())
+        return;
+    const auto center = _viewportRect.isValid() ? _viewportRect.center() : QPointF{0., 0.};
+    {   // Reorder pending nodes only when viewport moved significantly (or when nodes have been queued)
+        const auto span = std::max(_viewportRect.width(), _viewportRect.height());
+        const auto delta = center - _attachmentCenter;
+        if (!_attachmentOrdered ||
+            std::abs(delta.x()) + std::abs(delta.y()) > span / 10.) {
+            std::vector<std::pair<qreal, PendingAttachment>> ordered;
+            ordered.reserve(_pendingAttachments.size());
+            for (auto& pending : _pendingAttachments) {
+                const auto node = pending.node.lock();
+                qreal distance = -1.;   // Expired nodes are popped first (and discarded)
+                if (node) {
+                    const auto d = node->getGeometry().center() - center;
+                    distance = d.x() * d.x() + d.y() * d.y();
+                }
+                ordered.emplace_back(distance, pending);
+            }
+            std::stable_sort(ordered.begin(), ordered.end(),
+                             [](const auto& a, const auto& b) { return a.first > b.first; });
+            for (std::size_t i = 0; i < ordered.size(); ++i)
+                _pendingAttachments[i] = ordered[i].second;
+            _attachmentCenter = center;
+            _attachmentOrdered = true;
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    bool overBudget = false;
+    beginUpdate();
+    while (!_pendingAttachments.empty()) {
+        if (_attachmentBudget > 0 &&
+            timer.elapsed() >= _attachmentBudget) {
+            overBudget = true;
+            break;
+        }
+        auto pending = _pendingAttachments.back();
+        const auto node = pending.node.lock();
+        if (pending.incubator != nullptr) {
+            if (!node) {                    // Node removed before its incubation started
+                _pendingAttachments.pop_back();
+                finishIncubation(*pending.incubator);
+                continue;
+            }
+            if (_attachmentBudget > 0 &&
+                _runningIncubations >= maxRunningIncubations)
+                break;                      // Wait for a running incubation to finish (see finishIncubation())
+            _pendingAttachments.pop_back();
+            startIncubation(*pending.incubator);
+            continue;
+        }
+        _pendingAttachments.pop_back();
+        if (!node ||
+            node->getItem() != nullptr)
+            continue;
+        attachNodeItem(*node);
+        if (node->getItem() == nullptr)
+            continue;
+        // Edges are attached as soon as both their source and destination items exist
+        const auto attachEdge = [this](const auto& weakEdge) {
+            const auto edge = weakEdge.lock();
+            if (edge)
+                attachEdgeItem(*edge);
+        };
+        for (const auto& inEdge : node->get_in_edges())
+            attachEdge(inEdge);
+        for (const auto& outEdge : node->get_out_edges())
+            attachEdge(outEdge);
+    }
+    endUpdate();
+    if (overBudget)
+        scheduleAttachmentFrame();
+    emit pendingAttachmentCountChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Viewport Virtualization *///------------------------------------------------
+void    Graph::setVirtualized(bool virtualized) noexcept
+{
+    if (virtualized != _virtualized) {
+        _virtualized = virtualized;
+        if (!_virtualized &&        // Materialize everything back (headless graph items are created when it is attached)
+            !_headless) {
+            for (const auto& node : get_nodes())
+                if (node && node->getItem() == nullptr &&
+                    _virtualDelegates.find(node.get()) != _virtualDelegates.end())
+                    materializeNode(*node);
+            for (const auto& edge : get_edges())
+                if (edge && edge->getItem() == nullptr &&
+                    _virtualDelegates.find(edge.get()) != _virtualDelegates.end())
+                    materializeEdge(*edge);
+        } else
+            scheduleVirtualizationUpdate();
+        emit virtualizedChanged();
+    }
+}
+
+void    Graph::setVirtualizationMargin(qreal virtualizationMargin) noexcept
+{
+    if (!qFuzzyCompare(1. + virtualizationMargin, 1. + _virtualizationMargin)) {
+        _virtualizationMargin = std::max(0., virtualizationMargin);
+        scheduleVirtualizationUpdate();
+        emit virtualizationMarginChanged();
+    }
+}
+
+void    Graph::setViewportRect(const QRectF& viewportRect) noexcept
+{
+    if (viewportRect != _viewportRect) {
+        _viewportRect = viewportRect;
+        scheduleVirtualizationUpdate();
+        scheduleCullingUpdate();
+        emit viewportRectChanged();
+    }
+}
+
+void    Graph::setViewViewportRect(const QObject* view, const QRectF& viewportRect) noexcept
+{
+    if (view == nullptr)
+        return;
+    auto& rect = _viewViewports[view];
+    if (rect != viewportRect) {
+        rect = viewportRect;
+        scheduleVirtualizationUpdate();
+        scheduleCullingUpdate();
+    }
+}
+
+void    Graph::removeViewViewport(const QObject* view) noexcept
+{
+    if (_viewViewports.erase(view) > 0) {
+        scheduleVirtualizationUpdate();
+        scheduleCullingUpdate();
+    }
+}
+
+bool    Graph::intersectsViewports(const QRectF& br) const noexcept
+{
+    const auto r = br.isEmpty() ? QRectF{br.topLeft(), QSizeF{1., 1.}} : br;
+    const auto m = _virtualizationMargin;
+    if (_viewportRect.isValid() &&
+        _viewportRect.adjusted(-m, -m, m, m).intersects(r))
+        return true;
+    for (const auto& view : _viewViewports)
+        if (view.second.isValid() &&
+            view.second.adjusted(-m, -m, m, m).intersects(r))
+            return true;
+    return false;
+}
+
+bool    Graph::hasValidViewport() const noexcept
+{
+    if (_viewportRect.isValid())
+        return true;
+    for (const auto& view : _viewViewports)
+        if (view.second.isValid())
+            return true;
+    return false;
+}
+
+void    Graph::scheduleVirtualizationUpdate() noexcept
+{
+    if (!_virtualized ||
+        _headless ||
+        _virtualizationUpdatePending)
+        return;
+    _virtualizationUpdatePending = true;
+    QTimer::singleShot(0, this, [this]() { updateVirtualization(); });
+}
+
+void    Graph::updateVirtualization() noexcept
+{
+    _virtualizationUpdatePending = false;
+    if (!_virtualized ||
+        _headless ||
+        !hasValidViewport())
+        return;
+    // Note: nodes entering area at Flat level are drawn by a node batch renderer, their item creation is deferred
+    // until level of detail is raised
+    const bool deferMaterialization = _flatBatched &&
+                                      _levelOfDetail == qan::NodeItem::LevelOfDetail::Flat;
+    // 1. Release items of nodes leaving area (and their adjacent edges), create items for nodes entering area
+    for (const auto& node : get_nodes()) {
+        if (!node ||
+            !isVirtualizable(*node))
+            continue;
+        // Note: a node with no size is still visible when its position is in area
+        const bool visible = intersectsViewports(node->getGeometry());
+        if (visible && node->getItem() == nullptr &&
+            !deferMaterialization)
+            materializeNode(*node);
+        else if (!visible && node->getItem() != nullptr)
+            virtualizeNode(*node);
+    }
+    // 2. Create items for edges with both source and destination items
+    for (const auto& edge : get_edges()) {
+        if (!edge ||
+            edge->getItem() != nullptr)
+            continue;
+        const auto src = edge->get_src().lock();
+        const auto dst = edge->get_dst().lock();
+        if (src && src->getItem() != nullptr &&
+            dst && dst->getItem() != nullptr)
+            materializeEdge(*edge);
+    }
+}
+
+bool    Graph::isVirtualizable(const qan::Node& node) const noexcept
+{
+    return !node.is_group() &&
+           node.get_group().expired() &&
+           ( node.getItem() == nullptr || !_selection.contains(node) );    // Selected items are kept
+}
+
+bool    Graph::materializeNode(qan::Node& node) noexcept
+{
+    auto& delegate = _virtualDelegates[&node];
+    const auto engine = qmlEngine(this);
+    if (!delegate.component)
+        delegate.component = _nodeDelegate ? _nodeDelegate.get() :
+                                             ( engine != nullptr ? qan::Node::delegate(*engine) : nullptr );
+    if (!delegate.style)
+        delegate.style = qan::Node::style(nullptr);
+    const auto nodeStyle = qobject_cast<qan::NodeStyle*>(delegate.style.data());
+    if (!delegate.component ||
+        nodeStyle == nullptr)
+        return false;
+    const auto geometry = node.getGeometry();       // Note: read geometry before item is set
+    const auto nodeItem = createNodeItem(node, *delegate.component, *nodeStyle);
+    if (nodeItem == nullptr)
+        return false;
+    nodeItem->setPosition(geometry.topLeft());
+    if (!geometry.isEmpty())
+        nodeItem->setSize(geometry.size());
+    _maxZ += 1;
+    nodeItem->setZ(_maxZ);
+    if (_selection.contains(node))  // Node selected while virtualized (see selectAll())
+        selectItem(node);
+    return true;
+}
+
+void    Graph::virtualizeNode(qan::Node& node) noexcept
+{
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+    for (const auto& inEdge : node.get_in_edges())
+        if (const auto edge = inEdge.lock())
+            virtualizeEdge(*edge);
+    for (const auto& outEdge : node.get_out_edges())
+        if (const auto edge = outEdge.lock())
+            virtualizeEdge(*edge);
+    auto& delegate = _virtualDelegates[&node];
+    if (!delegate.component) {
+        const auto itemComponent = _itemComponents.find(nodeItem);
+        if (itemComponent != _itemComponents.end())
+            delegate.component = itemComponent->second.component;
+    }
+    if (!delegate.style)
+        delegate.style = nodeItem->getStyle();
+    node.storeItemGeometry();
+    node.releaseItem();
+    releaseVirtualizedItem(nodeItem);
+}
+
+bool    Graph::materializeEdge(qan::Edge& edge) noexcept
+{
+    const auto src = edge.get_src().lock();
+    const auto dst = edge.get_dst().lock();
+    if (!src || !dst)
+        return false;
+    auto& delegate = _virtualDelegates[&edge];
+    const auto engine = qmlEngine(this);
+    if (!delegate.component)
+        delegate.component = _edgeDelegate ? _edgeDelegate.get() :
+                                             ( engine != nullptr ? qan::Edge::delegate(*engine) : nullptr );
+    if (!delegate.style)
+        delegate.style = qan::Edge::style(nullptr);
+    const auto edgeStyle = qobject_cast<qan::EdgeStyle*>(delegate.style.data());
+    if (!delegate.component ||
+        edgeStyle == nullptr)
+        return false;
+    return configureEdge(edge, delegate.component.data(), *edgeStyle, *src, dst.get());
+}
+
+void    Graph::virtualizeEdge(qan::Edge& edge) noexcept
+{
+    const auto edgeItem = edge.getItem();
+    if (edgeItem == nullptr)
+        return;
+    auto& delegate = _virtualDelegates[&edge];
+    if (!delegate.component) {
+        const auto itemComponent = _itemComponents.find(edgeItem);
+        if (itemComponent != _itemComponents.end())
+            delegate.component = itemComponent->second.component;
+    }
+    if (!delegate.style)
+        delegate.style = edgeItem->getStyle();
+    edge.releaseItem();
+    releaseVirtualizedItem(edgeItem);
+}
+
+void    Graph::releaseVirtualizedItem(QQuickItem* item) noexcept
+{
+    if (item == nullptr)
+        return;
+    if (!recycleItem(item)) {
+        _itemComponents.erase(item);
+        item->setVisible(false);
+        item->deleteLater();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Viewport Culling *///-------------------------------------------------------
+void    Graph::setViewportCulling(bool viewportCulling) noexcept
+{
+    if (viewportCulling != _viewportCulling) {
+        _viewportCulling = viewportCulling;
+        scheduleCullingUpdate();
+        emit viewportCullingChanged();
+    }
+}
+
+bool    Graph::isCulled(const QRectF& br) const noexcept
+{
+    if (!_viewportCulling ||
+        !hasValidViewport())
+        return false;
+    return !intersectsViewports(br);
+}
+
+void    Graph::cullEdgeItem(qan::EdgeItem* edgeItem) noexcept
+{
+    if (edgeItem != nullptr)
+        _culledEdgeItems.emplace_back(edgeItem);
+}
+
+void    Graph::scheduleCullingUpdate() noexcept
+{
+    if (_cullingUpdatePending)
+        return;
+    _cullingUpdatePending = true;
+    QTimer::singleShot(0, this, [this]() { updateCulling(); });
+}
+
+void    Graph::updateCulling() noexcept
+{
+    _cullingUpdatePending = false;
+    // 1. Schedule a geometry update for culled edges entering culling area (their ends bounding rect is
+    //    cached in item, edge items ends moves re-cull them from qan::EdgeItem::updateItem())
+    std::size_t kept = 0;
+    for (auto& edgeItem : _culledEdgeItems) {
+        if (!edgeItem ||
+            !edgeItem->getCulled())
+            continue;
+        if (isCulled(edgeItem->getCulledBr())) {
+            _culledEdgeItems[kept++] = edgeItem;
+            continue;
+        }
+        edgeItem->uncull();
+        scheduleEdgeItemUpdate(edgeItem.data());
+    }
+    _culledEdgeItems.resize(kept);
+
+    // 2. Update node items culled flag
+    const auto container = getContainerItem();
+    if (container == nullptr)
+        return;
+    for (const auto& node : get_nodes()) {
+        const auto nodeItem = node ? node->getItem() : nullptr;
+        if (nodeItem == nullptr)
+            continue;
+        nodeItem->setCulled(isCulled(nodeItem->mapRectToItem(container,
+                                                             QRectF{0., 0., nodeItem->width(), nodeItem->height()})));
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Central Picking *///--------------------------------------------------------
+void    Graph::setCentralPicking(bool centralPicking) noexcept
+{
+    if (centralPicking == _centralPicking)
+        return;
+    _centralPicking = centralPicking;
+    for (const auto& edge : get_edges())
+        if (edge)
+            configurePicking(edge->getItem());
+    if (!_centralPicking)
+        setHoveredItem(nullptr);
+    emit centralPickingChanged();
+}
+
+void    Graph::configurePicking(qan::EdgeItem* edgeItem) const noexcept
+{
+    if (edgeItem == nullptr)
+        return;
+    edgeItem->setAcceptedMouseButtons(_centralPicking ? Qt::NoButton :
+                                                        Qt::RightButton | Qt::LeftButton);
+    // Note: edge acceptDrops property is not modified, it is tested by qan::GraphView
+    edgeItem->setFlag(QQuickItem::ItemAcceptsDrops, !_centralPicking && edgeItem->getAcceptDrops());
+}
+
+void    Graph::setHoveredItem(QQuickItem* hoveredItem) noexcept
+{
+    if (hoveredItem != _hoveredItem) {
+        _hoveredItem = hoveredItem;
+        emit hoveredItemChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Headless Mode *///----------------------------------------------------------
+void    Graph::setHeadless(bool headless) noexcept
+{
+    if (headless != _headless) {
+        _headless = headless;
+        if (!_headless)
+            attachItems();
+        emit headlessChanged();
+    }
+}
+
+void    Graph::attachItems() noexcept
+{
+    const auto isDetached = [this](const QObject* primitive) {
+        return _virtualDelegates.find(primitive) != _virtualDelegates.end();
+    };
+    // 1. Create group items, then reparent nested group items to their host group item
+    std::vector<qan::Group*> groups;
+    for (const auto& weakGroup : get_groups()) {
+        const auto group = weakGroup.lock();
+        if (group &&
+            group->getItem() == nullptr &&
+            isDetached(group.get()) &&
+            materializeGroup(*group))
+            groups.push_back(group.get());
+    }
+    for (const auto group : groups) {
+        const auto hostGroup = group->get_group().lock();
+        if (hostGroup &&
+            hostGroup->getGroupItem() != nullptr)
+            hostGroup->getGroupItem()->groupNodeItem(group->getItem(), true);
+    }
+    // 2. Create node items (virtualizable nodes are left to updateVirtualization() in a virtualized graph), with
+    // an attachment budget, node items are created by attachPendingItems() closest to viewport center first
+    const auto progressive = _attachmentBudget > 0;
+    if (progressive)
+        _pendingAttachments.erase(std::remove_if(_pendingAttachments.begin(), _pendingAttachments.end(),
+                                                 [](const auto& pending) { return pending.incubator == nullptr; }),
+                                  _pendingAttachments.end());
+    for (const auto& node : get_nodes()) {
+        if (!node ||
+            node->is_group() ||
+            node->getItem() != nullptr ||
+            !isDetached(node.get()))
+            continue;
+        if (_virtualized &&
+            isVirtualizable(*node))
+            continue;
+        if (progressive) {
+            _pendingAttachments.push_back(PendingAttachment{node, nullptr});
+            continue;
+        }
+        if (!materializeNode(*node))
+            continue;
+        const auto group = node->get_group().lock();
+        if (group &&
+            group->getGroupItem() != nullptr)
+            group->getGroupItem()->groupNodeItem(node->getItem(), true);
+    }
+    // 3. Create items for edges with both source and destination items
+    for (const auto& edge : get_edges()) {
+        if (!edge ||
+            edge->getItem() != nullptr ||
+            !isDetached(edge.get()))
+            continue;
+        const auto src = edge->get_src().lock();
+        const auto dst = edge->get_dst().lock();
+        if (src && src->getItem() != nullptr &&
+            dst && dst->getItem() != nullptr)
+            materializeEdge(*edge);
+    }
+    if (progressive) {
+        _attachmentOrdered = false;
+        scheduleAttachmentFrame();
+        emit pendingAttachmentCountChanged();
+    }
+    scheduleVirtualizationUpdate();
+}
+
+bool    Graph::attachNodeItem(qan::Node& node) noexcept
+{
+    if (node.getItem() != nullptr)
+        return true;
+    if (_virtualDelegates.find(&node) == _virtualDelegates.end())
+        return false;
+    if (node.is_group()) {
+        const auto group = qobject_cast<qan::Group*>(&node);
+        if (group == nullptr ||
+            !materializeGroup(*group))
+            return false;
+    } else {
+        if (_virtualized &&
+            isVirtualizable(node)) {
+            scheduleVirtualizationUpdate();
+            return false;
+        }
+        if (!materializeNode(node))
+            return false;
+    }
+    const auto group = node.get_group().lock();
+    if (group &&
+        group->getGroupItem() != nullptr)
+        group->getGroupItem()->groupNodeItem(node.getItem(), true);
+    return true;
+}
+
+bool    Graph::detachNodeItem(qan::Node& node) noexcept
+{
+    if (node.is_group() ||
+        node.getItem() == nullptr)
+        return false;
+    virtualizeNode(node);
+    return true;
+}
+
+bool    Graph::attachEdgeItem(qan::Edge& edge) noexcept
+{
+    if (edge.getItem() != nullptr)
+        return true;
+    if (_virtualDelegates.find(&edge) == _virtualDelegates.end())
+        return false;
+    const auto src = edge.get_src().lock();
+    const auto dst = edge.get_dst().lock();
+    if (src && src->getItem() != nullptr &&
+        dst && dst->getItem() != nullptr)
+        return materializeEdge(edge);
+    return false;
+}
+
+bool    Graph::materializeGroup(qan::Group& group) noexcept
+{
+    auto& delegate = _virtualDelegates[&group];
+    const auto engine = qmlEngine(this);
+    if (!delegate.component)
+        delegate.component = _groupDelegate ? _groupDelegate.get() :
+                                              ( engine != nullptr ? qan::Group::delegate(*engine) : nullptr );
+    if (!delegate.style)
+        delegate.style = qan::Group::style(nullptr);
+    const auto groupStyle = qobject_cast<qan::NodeStyle*>(delegate.style.data());
+    if (!delegate.component ||
+        groupStyle == nullptr)
+        return false;
+    const auto geometry = group.getGeometry();      // Note: read geometry before item is set
+    const auto groupItem = createGroupItem(group, *delegate.component, *groupStyle);
+    if (groupItem == nullptr)
+        return false;
+    _virtualDelegates.erase(&group);    // Note: groups are never virtualized
+    groupItem->setPosition(geometry.topLeft());
+    if (!geometry.isEmpty())
+        groupItem->setSize(geometry.size());
+    _maxZ += 1.;
+    groupItem->setZ(_maxZ);
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* Worker Thread Construction *///---------------------------------------------
+int     Graph::adopt(qan::GraphBuilder& builder) noexcept
+{
+    QAN_TRACE_SCOPE("Graph::adopt");
+    if (!builder.isFinished()) {
+        qWarning() << "qan::Graph::adopt(): Error: builder must be finished before being adopted.";
+        return 0;
+    }
+    std::vector<SharedNode> nodes;
+    std::vector<std::shared_ptr<qan::Edge>> edges;
+    builder.take(nodes, edges);
+    const auto isAdoptable = [this](const QObject* primitive) { return primitive->thread() == thread(); };
+    if (!std::all_of(nodes.cbegin(), nodes.cend(), [&](const SharedNode& node) { return isAdoptable(node.get()); }) ||
+        !std::all_of(edges.cbegin(), edges.cend(), [&](const std::shared_ptr<qan::Edge>& edge) { return isAdoptable(edge.get()); })) {
+        qWarning() << "qan::Graph::adopt(): Error: builder primitives have not been moved to graph thread.";
+        return 0;
+    }
+    beginUpdate();
+    try {
+        _virtualDelegates.reserve(_virtualDelegates.size() + nodes.size() + edges.size());
+        for (const auto& node : nodes) {    // Note: default delegate and style are resolved when item is attached
+            QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
+            _virtualDelegates[node.get()] = VirtualDelegate{};
+        }
+        for (const auto& edge : edges) {
+            QQmlEngine::setObjectOwnership(edge.get(), QQmlEngine::CppOwnership);
+            _virtualDelegates[edge.get()] = VirtualDelegate{};
+        }
+        gtpo_graph_t::insert_nodes_unchecked(nodes.cbegin(), nodes.cend());
+        gtpo_graph_t::adopt_edges_unchecked(edges.cbegin(), edges.cend());
+    } catch (const std::exception& e) {
+        qWarning() << "qan::Graph::adopt(): Error: " << e.what();
+        for (const auto& node : nodes)
+            _virtualDelegates.erase(node.get());
+        for (const auto& edge : edges)
+            _virtualDelegates.erase(edge.get());
+        endUpdate();
+        return 0;
+    }
+    for (const auto& node : nodes) {
+        onNodeInserted(*node);
+        notifyNodeInserted(node.get());
+    }
+    for (const auto& edge : edges)
+        notifyEdgeInserted(edge.get());
+    endUpdate();
+    if (_virtualized)
+        scheduleVirtualizationUpdate();
+    else
+        scheduleItemsAttachment();
+    return static_cast<int>(nodes.size() + edges.size());
+}
+
+void    Graph::scheduleItemsAttachment() noexcept
+{
+    if (_headless ||                // Items are attached when headless is set to false
+        _itemsAttachmentPending)
+        return;
+    _itemsAttachmentPending = true;
+    QTimer::singleShot(0, this, [this]() {
+        _itemsAttachmentPending = false;
+        if (!_headless)
+            attachItems();
+    });
+}
+//-----------------------------------------------------------------------------
+
+/* Memory Accounting *///------------------------------------------------------
+namespace { // ::qan::anonymous
+
+//! Number of items in \c item tree (\c item included), grouped node items are not counted in their group tree.
+int     countItemTree(const QQuickItem* item) noexcept
+{
+    if (item == nullptr)
+        return 0;
+    int count = 1;
+    for (const auto child : item->childItems())
+        if (qobject_cast<const qan::NodeItem*>(child) == nullptr)
+            count += countItemTree(child);
+    return count;
+}
+
+//! Return \c container storage bytes and account its model (if it has been created) in \c stats.
+template <class container_t>
+qint64  containerBytes(const container_t& container, qan::MemoryStats& stats) noexcept
+{
+    if (container.hasModel()) {     // Model with its QObject item map
+        ++stats.modelCount;
+        stats.modelBytes += static_cast<qint64>(sizeof(qcm::ContainerModel)) +
+                            static_cast<qint64>(container.size()) * 2 * static_cast<qint64>(sizeof(void*));
+    }
+    return static_cast<qint64>(container.getContainer().capacity()) *
+           static_cast<qint64>(sizeof(typename container_t::value_type));
+}
+
+//! Return plain std adjacency \c container storage bytes (QUICKQANAVA_STD_ADJACENCY, qan::AdjacencyModel store no per item data).
+template <class T>
+qint64  containerBytes(const std::vector<T>& container, qan::MemoryStats&) noexcept
+{
+    return static_cast<qint64>(container.capacity()) * static_cast<qint64>(sizeof(T));
+}
+
+} // ::qan::anonymous
+
+qan::MemoryStats    Graph::getMemoryStats() const noexcept
+{
+    qan::MemoryStats stats;
+    // Shared primitives control block (allocated with primitive by std::make_shared())
+    static constexpr qint64 controlBlockBytes = 2 * static_cast<qint64>(sizeof(void*));
+
+    const auto itemTreeBytes = [&stats](const QQuickItem* item, qint64 itemBytes) -> qint64 {
+        const auto count = countItemTree(item);
+        stats.quickItemCount += count;
+        return itemBytes + (count - 1) * static_cast<qint64>(sizeof(QQuickItem));
+    };
+
+    for (const auto& node : get_nodes()) {
+        if (!node)
+            continue;
+        auto bytes = controlBlockBytes +
+                     containerBytes(node->get_in_edges(), stats) + containerBytes(node->get_out_edges(), stats) +
+                     containerBytes(node->get_in_nodes(), stats) + containerBytes(node->get_out_nodes(), stats);
+        if (node->isGroup()) {
+            ++stats.groupCount;
+            stats.groupBytes += bytes + static_cast<qint64>(sizeof(qan::Group));
+            const auto group = qobject_cast<const qan::Group*>(node.get());
+            const auto groupItem = group != nullptr ? group->getGroupItem() : nullptr;
+            if (groupItem != nullptr) {
+                ++stats.groupItemCount;
+                stats.itemBytes += itemTreeBytes(groupItem, static_cast<qint64>(sizeof(qan::GroupItem)));
+            }
+        } else {
+            ++stats.nodeCount;
+            stats.nodeBytes += bytes + static_cast<qint64>(sizeof(qan::Node));
+            const auto nodeItem = node->getItem();
+            if (nodeItem != nullptr) {
+                ++stats.nodeItemCount;
+                stats.itemBytes += itemTreeBytes(nodeItem, static_cast<qint64>(sizeof(qan::NodeItem)));
+            }
+        }
+    }
+    for (const auto& edge : get_edges()) {
+        if (!edge)
+            continue;
+        ++stats.edgeCount;
+        stats.edgeBytes += controlBlockBytes + static_cast<qint64>(sizeof(qan::Edge));
+        const auto edgeItem = edge->getItem();
+        if (edgeItem != nullptr) {
+            ++stats.edgeItemCount;
+            stats.itemBytes += itemTreeBytes(edgeItem, static_cast<qint64>(sizeof(qan::EdgeItem)));
+        }
+    }
+
+    // Graph containers
+    stats.nodeBytes += containerBytes(get_nodes(), stats) + containerBytes(_selectedNodes, stats);
+    stats.edgeBytes += containerBytes(get_edges(), stats);
+    stats.groupBytes += containerBytes(get_groups(), stats) + containerBytes(_selectedGroups, stats);
+
+    // Recycled items
+    for (const auto& pool : _itemPool)
+        for (const auto& item : pool.second)
+            if (item) {
+                ++stats.pooledItemCount;
+                stats.itemBytes += itemTreeBytes(item.data(), static_cast<qint64>(sizeof(QQuickItem)));
+            }
+    return stats;
+}
+
+QVariantMap Graph::memoryStats() const noexcept
+{
+    return getMemoryStats().toVariantMap();
+}
+//-----------------------------------------------------------------------------
+
+/* Level of Detail Management *///---------------------------------------------
+void    Graph::setLodZoom(qreal lodZoom) noexcept
+{
+    if (!qFuzzyCompare(1. + lodZoom, 1. + _lodZoom)) {
+        const bool parallelEdgeCollapsed = isParallelEdgeCollapsed();
+        _lodZoom = lodZoom;
+        updateLevelOfDetail();
+        if (parallelEdgeCollapsed != isParallelEdgeCollapsed())
+            updateFannedEdges();
+        emit lodZoomChanged();
+    }
+}
+
+void    Graph::setSimplifiedZoom(qreal simplifiedZoom) noexcept
+{
+    if (!qFuzzyCompare(1. + simplifiedZoom, 1. + _simplifiedZoom)) {
+        _simplifiedZoom = std::max(0., simplifiedZoom);
+        updateLevelOfDetail();
+        emit simplifiedZoomChanged();
+    }
+}
+
+void    Graph::setFlatZoom(qreal flatZoom) noexcept
+{
+    if (!qFuzzyCompare(1. + flatZoom, 1. + _flatZoom)) {
+        _flatZoom = std::max(0., flatZoom);
+        updateLevelOfDetail();
+        emit flatZoomChanged();
+    }
+}
+
+void    Graph::setFlatBatched(bool flatBatched) noexcept
+{
+    if (flatBatched != _flatBatched) {
+        _flatBatched = flatBatched;
+        scheduleVirtualizationUpdate();
+        emit flatBatchedChanged();
+    }
+}
+
+void    Graph::setLabelsBatched(bool labelsBatched) noexcept
+{
+    if (labelsBatched != _labelsBatched) {
+        _labelsBatched = labelsBatched;
+        emit labelsBatchedChanged();
+    }
+}
+
+const qan::NodeStyle*   Graph::getNodeStyle(const qan::Node& node) const noexcept
+{
+    if (node.getItem() != nullptr)
+        return node.getItem()->getStyle();
+    const auto delegate = _virtualDelegates.find(&node);
+    return delegate != _virtualDelegates.end() ? qobject_cast<const qan::NodeStyle*>(delegate->second.style.data()) :
+                                                 nullptr;
+}
+
+void    Graph::setNodeStyle(qan::Node& node, qan::NodeStyle* style) noexcept
+{
+    if (style == nullptr)
+        return;
+    if (_undoStack.isRecording())
+        _undoStack.recordStyle(node, const_cast<qan::NodeStyle*>(getNodeStyle(node)), style);
+    if (node.getItem() != nullptr)
+        node.getItem()->setStyle(style);
+    else {
+        const auto delegate = _virtualDelegates.find(&node);
+        if (delegate != _virtualDelegates.end())
+            delegate->second.style = style;
+    }
+}
+
+QQmlComponent*  Graph::getNodeDelegate(const qan::Node& node) noexcept
+{
+    const auto itemComponent = node.getItem() != nullptr ? _itemComponents.find(node.getItem()) : _itemComponents.end();
+    if (itemComponent != _itemComponents.end())
+        return itemComponent->second.component.data();
+    const auto delegate = _virtualDelegates.find(&node);
+    if (delegate != _virtualDelegates.end())
+        return delegate->second.component.data();
+    return _styleManager.getStyleComponent(const_cast<qan::NodeStyle*>(getNodeStyle(node)));
+}
+
+const qan::EdgeStyle*   Graph::getEdgeStyle(const qan::Edge& edge) const noexcept
+{
+    if (edge.getItem() != nullptr)
+        return edge.getItem()->getStyle();
+    const auto delegate = _virtualDelegates.find(&edge);
+    return delegate != _virtualDelegates.end() ? qobject_cast<const qan::EdgeStyle*>(delegate->second.style.data()) :
+                                                 nullptr;
+}
+
+void    Graph::setEdgeStyle(qan::Edge& edge, qan::EdgeStyle* style) noexcept
+{
+    if (style == nullptr)
+        return;
+    if (_undoStack.isRecording())
+        _undoStack.recordStyle(edge, const_cast<qan::EdgeStyle*>(getEdgeStyle(edge)), style);
+    if (edge.getItem() != nullptr)
+        edge.getItem()->setStyle(style);
+    else {
+        const auto delegate = _virtualDelegates.find(&edge);
+        if (delegate != _virtualDelegates.end())
+            delegate->second.style = style;
+    }
+}
+
+void    Graph::updateLevelOfDetail() noexcept
+{
+    auto levelOfDetail = qan::NodeItem::LevelOfDetail::Full;
+    if (_lodZoom < _flatZoom)
+        levelOfDetail = qan::NodeItem::LevelOfDetail::Flat;
+    else if (_lodZoom < _simplifiedZoom)
+        levelOfDetail = qan::NodeItem::LevelOfDetail::Simplified;
+    if (levelOfDetail == _levelOfDetail)
+        return;     // Zoom has not crossed a threshold, no node item update
+    const bool wasFlat = _levelOfDetail == qan::NodeItem::LevelOfDetail::Flat;
+    _levelOfDetail = levelOfDetail;
+    for (const auto& node : get_nodes())
+        if (node && node->getItem() != nullptr)
+            node->getItem()->setLevelOfDetail(levelOfDetail);
+    if (wasFlat)        // Deferred node items might have to be created
+        scheduleVirtualizationUpdate();
+    emit levelOfDetailChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Parallel Edges Management *///---------------------------------------------
+class Graph::ParallelEdgesBehaviour : public gtpo::dynamic_graph_behaviour<qan::Config>
+{
+public:
+    explicit ParallelEdgesBehaviour(qan::Graph& graph) noexcept :
+        gtpo::dynamic_graph_behaviour<qan::Config>{}, _graph{graph} { }
+    virtual ~ParallelEdgesBehaviour() noexcept override = default;
+
+    virtual void    on_edge_inserted(weak_edge_t& weakEdge) noexcept override { updateParallelEdges(weakEdge, false); }
+    virtual void    on_edge_removed(weak_edge_t& weakEdge) noexcept override { updateParallelEdges(weakEdge, true); }
+
+private:
+    void    updateParallelEdges(const weak_edge_t& weakEdge, bool removed) noexcept {
+        const auto edge = weakEdge.lock();
+        if ( !edge ||
+             _graph.getParallelEdgeSpacing() <= 0. )
+            return;     // Note: removed edge is still indexed, exclude it, siblings are updated once it has been removed
+        _graph.updateParallelEdges(edge->get_src().lock().get(), edge->get_dst().lock().get(),
+                                   removed ? edge.get() : nullptr);
+    }
+    qan::Graph&     _graph;
+};
+
+void    Graph::setParallelEdgeSpacing(qreal parallelEdgeSpacing) noexcept
+{
+    parallelEdgeSpacing = std::max(0., parallelEdgeSpacing);
+    if (qFuzzyCompare(1. + parallelEdgeSpacing, 1. + _parallelEdgeSpacing))
+        return;
+    const bool enabled = _parallelEdgeSpacing <= 0.;
+    _parallelEdgeSpacing = parallelEdgeSpacing;
+    if (enabled) {      // Parallel edges are not known yet, update all edges
+        installParallelEdgesBehaviour();
+        for (const auto& edge : get_edges())
+            if (edge && edge->getItem() != nullptr)
+                scheduleEdgeItemUpdate(edge->getItem());
+    } else
+        updateFannedEdges();
+    emit parallelEdgeSpacingChanged();
+}
+
+void    Graph::setParallelEdgeCollapseZoom(qreal parallelEdgeCollapseZoom) noexcept
+{
+    if (!qFuzzyCompare(1. + parallelEdgeCollapseZoom, 1. + _parallelEdgeCollapseZoom)) {
+        _parallelEdgeCollapseZoom = std::max(0., parallelEdgeCollapseZoom);
+        updateFannedEdges();
+        emit parallelEdgeCollapseZoomChanged();
+    }
+}
+
+void    Graph::setParallelEdgeCollapseCount(int parallelEdgeCollapseCount) noexcept
+{
+    parallelEdgeCollapseCount = std::max(2, parallelEdgeCollapseCount);
+    if (parallelEdgeCollapseCount != _parallelEdgeCollapseCount) {
+        _parallelEdgeCollapseCount = parallelEdgeCollapseCount;
+        if (isParallelEdgeCollapsed())
+            updateFannedEdges();
+        emit parallelEdgeCollapseCountChanged();
+    }
+}
+
+void    Graph::updateParallelEdges(const qan::Node* source, const qan::Node* destination, const qan::Edge* except) noexcept
+{
+    if (source == nullptr ||
+        destination == nullptr ||
+        source == destination)
+        return;
+    const auto scheduleEdge = [this, except](const std::weak_ptr<qan::Edge>& weakEdge) {
+        const auto edge = weakEdge.lock();
+        if (edge &&
+            edge.get() != except &&
+            edge->getItem() != nullptr)
+            scheduleEdgeItemUpdate(edge->getItem());
+    };
+    source->for_each_out_edge(destination, scheduleEdge);       // O(parallel edges) with qan::Config adjacency index
+    destination->for_each_out_edge(source, scheduleEdge);
+}
+
+void    Graph::updateFannedEdges() noexcept
+{
+    for (const auto& edge : get_edges())
+        if (edge &&
+            edge->getItem() != nullptr &&
+            edge->getItem()->getFanCount() > 1)
+            scheduleEdgeItemUpdate(edge->getItem());
+}
+
+void    Graph::installParallelEdgesBehaviour() noexcept
+{
+    if (_parallelEdgesBehaviour != nullptr)
+        return;
+    try {
+        auto behaviour = std::make_unique<ParallelEdgesBehaviour>(*this);
+        _parallelEdgesBehaviour = behaviour.get();
+        gtpo_graph_t::add_dynamic_graph_behaviour(std::move(behaviour));
+    } catch ( ... ) {
+        qWarning() << "qan::Graph::installParallelEdgesBehaviour(): Error: Parallel edges behaviour initialization failed.";
+        _parallelEdgesBehaviour = nullptr;
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Batched Graph Update *///---------------------------------------------------
+void    Graph::beginUpdate() noexcept
+{
+    _undoStack.beginMacro(tr("Update"));    // Note: a batched update is a single undo entry
+    if (_updateDepth++ == 0) {
+        _updateInsertedNodes = 0;
+        _updateInsertedEdges = 0;
+        _updateMaxZModified = false;
+        emit updatingChanged();
+    }
+    gtpo_graph_t::begin_deferred_notifications();
+}
+
+void    Graph::endUpdate() noexcept
+{
+    if (_updateDepth <= 0) {
+        qWarning() << "qan::Graph::endUpdate(): Error: endUpdate() called without a matching beginUpdate().";
+        return;
+    }
+    gtpo_graph_t::end_deferred_notifications();
+    _undoStack.endMacro();
+    if (--_updateDepth > 0)
+        return;
+    // Note: edge items are updated after all nodes have been moved, once per edge
+    updateDeferredEdgeItems();
+    if (_updateMaxZModified) {
+        _updateMaxZModified = false;
+        emit maxZChanged();
+    }
+    emit updatingChanged();
+    emit updateEnded(_updateInsertedNodes, _updateInsertedEdges);
+}
+
+void    Graph::updateDeferredEdgeItems() noexcept
+{
+    auto deferredEdgeItems = std::move(_deferredEdgeItems);
+    _deferredEdgeItems.clear();
+    _deferredEdgeItemsSet.clear();
+    std::vector<qan::EdgeItem*> edgeItems;
+    edgeItems.reserve(deferredEdgeItems.size());
+    for (const auto& edgeItem : deferredEdgeItems)
+        if (edgeItem)
+            edgeItems.push_back(edgeItem.data());
+    if (get_hyper_edge_count() > 0)
+        orderHyperEdgeItems(edgeItems);
+    qan::EdgeItem::updateItems(edgeItems);      // Use batched geometry generation
+    restackDeferredEdgeItems();
+}
+
+void    Graph::orderHyperEdgeItems(std::vector<qan::EdgeItem*>& edgeItems) const noexcept
+{
+    // Hyper edges depending on an updated edge are updated in the same batch, once and after their destination
+    // edge (a chain of hyper edges is not updated multiple times through cascading geometry notifications).
+    std::vector<qan::Edge*> edges;
+    edges.reserve(edgeItems.size());
+    std::vector<qan::EdgeItem*> orderedItems;
+    for (const auto edgeItem : edgeItems) {
+        const auto edge = edgeItem->getEdge();
+        if (edge != nullptr)
+            edges.push_back(edge);
+        else
+            orderedItems.push_back(edgeItem);   // Keep items without edge
+    }
+    gtpo::order_hyper_dependents(edges);
+    orderedItems.reserve(orderedItems.size() + edges.size());
+    for (const auto edge : edges)
+        if (edge->getItem() != nullptr)
+            orderedItems.push_back(edge->getItem());
+    edgeItems.swap(orderedItems);
+}
+
+void    Graph::deferEdgeItemUpdate(qan::EdgeItem* edgeItem) noexcept
+{
+    if (edgeItem != nullptr &&
+        _deferredEdgeItemsSet.insert(edgeItem).second)
+        _deferredEdgeItems.emplace_back(edgeItem);
+}
+
+void    Graph::scheduleEdgeItemUpdate(qan::EdgeItem* edgeItem) noexcept
+{
+    if (edgeItem == nullptr)
+        return;
+    deferEdgeItemUpdate(edgeItem);
+    if (isUpdating())           // Dirty edges are updated in endUpdate()
+        return;
+    scheduleFrameUpdate();
+}
+
+void    Graph::scheduleFrameUpdate() noexcept
+{
+    if (_edgeUpdateScheduled)
+        return;
+    _edgeUpdateScheduled = true;
+    const auto graphWindow = window();
+    if (graphWindow != nullptr) {
+        if (graphWindow != _edgeUpdateWindow) {
+            if (_edgeUpdateWindow)
+                disconnect(_edgeUpdateWindow, &QQuickWindow::afterAnimating, this, &Graph::flushEdgeItemUpdates);
+            _edgeUpdateWindow = graphWindow;
+            connect(graphWindow, &QQuickWindow::afterAnimating, this, &Graph::flushEdgeItemUpdates);
+        }
+        graphWindow->update();  // Ensure a frame is scheduled
+    } else
+        QTimer::singleShot(0, this, &Graph::flushEdgeItemUpdates);
+}
+
+void    Graph::flushEdgeItemUpdates() noexcept
+{
+    // Note: apply drags first, while a frame update is still scheduled, moved items edges are then updated in this frame
+    flushDragMoves();
+    _edgeUpdateScheduled = false;
+    if (_attachmentFramePending)
+        attachPendingItems();
+    if (_nodeColumns &&
+        !isUpdating())
+        syncNodeColumns();
+    if (_changeFlushScheduled &&
+        _changeFlushPolicy == ChangeFlushPolicy::Frame)
+        flushChanges();
+    if (isUpdating() ||
+        (_deferredEdgeItems.empty() &&
+         _restackEdgeItems.empty()))
+        return;
+    updateDeferredEdgeItems();
+}
+
+/* Coalesced Change Notifications *///----------------------------------------
+void    Graph::CoalescedNodes::add(qan::Node* node) noexcept
+{
+    if (node != nullptr &&
+        set.insert(node).second)
+        nodes.emplace_back(node);
+}
+
+QObjectList Graph::CoalescedNodes::take() noexcept
+{
+    QObjectList r;
+    r.reserve(static_cast<int>(nodes.size()));
+    for (const auto& node : nodes)
+        if (node)
+            r.append(node.data());
+    nodes.clear();
+    set.clear();
+    return r;
+}
+
+void    Graph::setChangeFlushPolicy(ChangeFlushPolicy changeFlushPolicy) noexcept
+{
+    if (changeFlushPolicy != _changeFlushPolicy) {
+        _changeFlushPolicy = changeFlushPolicy;
+        configureChangeCollection();
+        emit changeFlushPolicyChanged();
+    }
+}
+
+void    Graph::setChangeFlushInterval(int changeFlushInterval) noexcept
+{
+    changeFlushInterval = std::max(0, changeFlushInterval);
+    if (changeFlushInterval != _changeFlushInterval) {
+        _changeFlushInterval = changeFlushInterval;
+        emit changeFlushIntervalChanged();
+    }
+}
+
+void    Graph::configureChangeCollection() noexcept
+{
+    for (const auto& connection : _changeConnections)
+        disconnect(connection);
+    _changeConnections.clear();
+    _movedNodes.take();
+    _resizedNodes.take();
+    _labelChangedNodes.take();
+    _changeInsertedNodes.clear();
+    _changeInsertedEdges.clear();
+    _changeInsertedNodeCount = _changeInsertedEdgeCount = _changeRemovedNodeCount = 0;
+    _changeRevision = get_topology_revision();
+    if (_changeFlushPolicy == ChangeFlushPolicy::Disabled)
+        return;
+    const auto collect = [this](CoalescedNodes& nodes) {
+        return [this, &nodes](qan::Node* node) { nodes.add(node); scheduleChangeFlush(); };
+    };
+    _changeConnections = {
+        connect(this, &qan::Graph::nodeMoved,           this, collect(_movedNodes)),
+        connect(this, &qan::Graph::nodeResized,         this, collect(_resizedNodes)),
+        connect(this, &qan::Graph::nodeLabelChanged,    this, collect(_labelChangedNodes)),
+        connect(this, &qan::Graph::groupResized,        this, [this](qan::Group* group) {
+            _resizedNodes.add(group);
+            scheduleChangeFlush();
+        }),
+        connect(this, &qan::Graph::nodesMoved,          this, [this](const QObjectList& nodes) {
+            for (const auto node : nodes)
+                _movedNodes.add(qobject_cast<qan::Node*>(node));
+            scheduleChangeFlush();
+        }),
+        connect(this, &qan::Graph::nodeInserted,        this, [this](qan::Node* node) {
+            _changeInsertedNodes.emplace_back(node);
+            ++_changeInsertedNodeCount;
+            scheduleChangeFlush();
+        }),
+        connect(this, &qan::Graph::edgeInserted,        this, [this](qan::Edge* edge) {
+            _changeInsertedEdges.emplace_back(edge);
+            ++_changeInsertedEdgeCount;
+            scheduleChangeFlush();
+        }),
+        connect(this, &qan::Graph::nodeRemoved,         this, [this](qan::Node*) {
+            ++_changeRemovedNodeCount;
+            scheduleChangeFlush();
+        }),
+        // Note: nodeInserted() and edgeInserted() are not emitted for batched insertions
+        connect(this, &qan::Graph::updateEnded,         this, [this](int insertedNodes, int insertedEdges) {
+            _changeInsertedNodeCount += insertedNodes;
+            _changeInsertedEdgeCount += insertedEdges;
+            if (hasPendingChanges())
+                scheduleChangeFlush();
+        })
+    };
+}
+
+bool    Graph::hasPendingChanges() const noexcept
+{
+    return !_movedNodes.empty() ||
+           !_resizedNodes.empty() ||
+           !_labelChangedNodes.empty() ||
+           _changeInsertedNodeCount > 0 ||
+           _changeInsertedEdgeCount > 0 ||
+           _changeRemovedNodeCount > 0 ||
+           _changeRevision != get_topology_revision();
+}
+
+void    Graph::scheduleChangeFlush() noexcept
+{
+    if (_changeFlushScheduled)
+        return;
+    switch (_changeFlushPolicy) {
+    case ChangeFlushPolicy::Frame:
+        _changeFlushScheduled = true;
+        scheduleFrameUpdate();      // Note: changes are flushed in flushEdgeItemUpdates()
+        break;
+    case ChangeFlushPolicy::Interval:
+        _changeFlushScheduled = true;
+        QTimer::singleShot(_changeFlushInterval, this, &qan::Graph::flushChanges);
+        break;
+    case ChangeFlushPolicy::Disabled:
+    case ChangeFlushPolicy::Manual:
+        break;
+    }
+}
+
+void    Graph::flushChanges() noexcept
+{
+    _changeFlushScheduled = false;
+    if (_changeFlushPolicy == ChangeFlushPolicy::Disabled ||
+        isUpdating())       // Note: a flush is scheduled again when update ends
+        return;
+    if (!_movedNodes.empty())
+        emit nodesMovedCoalesced(_movedNodes.take());
+    if (!_resizedNodes.empty())
+        emit nodesResizedCoalesced(_resizedNodes.take());
+    if (!_labelChangedNodes.empty())
+        emit nodesLabelChangedCoalesced(_labelChangedNodes.take());
+    if (_changeInsertedNodeCount > 0 ||
+        _changeInsertedEdgeCount > 0 ||
+        _changeRemovedNodeCount > 0 ||
+        _changeRevision != get_topology_revision()) {
+        QObjectList insertedNodes;
+        for (const auto& node : _changeInsertedNodes)
+            if (node)
+                insertedNodes.append(node.data());
+        QObjectList insertedEdges;
+        for (const auto& edge : _changeInsertedEdges)
+            if (edge)
+                insertedEdges.append(edge.data());
+        QVariantMap delta;
+        delta.insert(QStringLiteral("insertedNodes"), QVariant::fromValue(insertedNodes));
+        delta.insert(QStringLiteral("insertedEdges"), QVariant::fromValue(insertedEdges));
+        delta.insert(QStringLiteral("insertedNodeCount"), _changeInsertedNodeCount);
+        delta.insert(QStringLiteral("insertedEdgeCount"), _changeInsertedEdgeCount);
+        delta.insert(QStringLiteral("removedNodeCount"), _changeRemovedNodeCount);
+        _changeInsertedNodes.clear();
+        _changeInsertedEdges.clear();
+        _changeInsertedNodeCount = _changeInsertedEdgeCount = _changeRemovedNodeCount = 0;
+        _changeRevision = get_topology_revision();
+        emit topologyChanged(delta);
+    }
+}
+//-----------------------------------------------------------------------------
+
+void    Graph::setFrameSynchronizedDrag(bool frameSynchronizedDrag) noexcept
+{
+    if (frameSynchronizedDrag != _frameSynchronizedDrag) {
+        _frameSynchronizedDrag = frameSynchronizedDrag;
+        if (!_frameSynchronizedDrag)
+            flushDragMoves();
+        emit frameSynchronizedDragChanged();
+    }
+}
+
+void    Graph::scheduleDragMove(qan::NodeItem* nodeItem) noexcept
+{
+    if (nodeItem == nullptr)
+        return;
+    _pendingDragItems.emplace_back(nodeItem);
+    scheduleFrameUpdate();
+}
+
+void    Graph::flushDragMoves() noexcept
+{
+    if (_pendingDragItems.empty())
+        return;
+    auto pendingDragItems = std::move(_pendingDragItems);
+    _pendingDragItems.clear();
+    for (const auto& nodeItem : pendingDragItems) {
+        if (!nodeItem)
+            continue;
+        const auto draggableCtrl = dynamic_cast<qan::DraggableCtrl*>(&nodeItem->draggableCtrl());
+        if (draggableCtrl != nullptr)
+            draggableCtrl->flushDragMove();
+    }
+}
+
+void    Graph::notifyNodeInserted(qan::Node* node) noexcept
+{
+    if (node != nullptr &&
+        _undoStack.isRecording())
+        _undoStack.recordInsertNode(*node);
+    if (isUpdating())
+        ++_updateInsertedNodes;
+    else
+        emit nodeInserted(node);
+}
+
+void    Graph::notifyEdgeInserted(qan::Edge* edge) noexcept
+{
+    if (edge != nullptr &&
+        _undoStack.isRecording())
+        _undoStack.recordInsertEdge(*edge);
+    if (isUpdating())
+        ++_updateInsertedEdges;
+    else
+        emit edgeInserted(edge);
+}
+//-----------------------------------------------------------------------------
+
+/* Node Columns *///-----------------------------------------------------------
+void    Graph::setNodeColumnsEnabled(bool nodeColumnsEnabled) noexcept
+{
+    if (nodeColumnsEnabled == getNodeColumnsEnabled())
+        return;
+    if (nodeColumnsEnabled) {
+        try {
+            _nodeColumns = std::make_unique<qan::NodeColumns>();
+            for (const auto& node : get_nodes())    // Existing node items are pulled on first access
+                if (node && node->getItem() != nullptr)
+                    _nodeColumns->markItemDirty(*node);
+        } catch (const std::bad_alloc&) {
+            qWarning() << "qan::Graph::setNodeColumnsEnabled(): Error: Out of memory.";
+            _nodeColumns.reset();
+            return;
+        }
+    } else
+        _nodeColumns.reset();
+    emit nodeColumnsEnabledChanged();
+}
+
+qan::NodeColumns*   Graph::getNodeColumns() noexcept
+{
+    if (_nodeColumns)
+        _nodeColumns->pullItems();
+    return _nodeColumns.get();
+}
+
+const qan::NodeColumns* Graph::getNodeColumns() const noexcept
+{
+    if (_nodeColumns)
+        _nodeColumns->pullItems();
+    return _nodeColumns.get();
+}
+
+void    Graph::commitNodeColumns() noexcept
+{
+    if (_nodeColumns &&
+        _nodeColumns->isModified())
+        scheduleFrameUpdate();
+}
+
+void    Graph::syncNodeColumns() noexcept
+{
+    if (!_nodeColumns)
+        return;
+    _nodeColumns->pullItems();
+    if (!_nodeColumns->isModified())
+        return;
+    beginUpdate();          // Edges adjacent to pushed nodes are updated once in endUpdate()
+    _nodeColumns->pushItems();
+    endUpdate();
+    _nodeColumns->pullItems();  // Discard item notifications generated by push (values are identical)
+}
+
+void    Graph::markNodeColumnsDirty(const QQuickItem* item) noexcept
+{
+    const auto nodeItem = qobject_cast<const qan::NodeItem*>(item);
+    const auto node = nodeItem != nullptr ? nodeItem->getNode() : nullptr;
+    if (node == nullptr)
+        return;
+    try {   // Note: columns store mutable nodes to push rows to their items
+        _nodeColumns->markItemDirty(*const_cast<qan::Node*>(node));
+    } catch (const std::bad_alloc&) { /* Nil: row is pulled on next item modification */ }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Edge Routing *///-----------------------------------------------------
+void    Graph::setOrthoRouting(bool orthoRouting) noexcept
+{
+    if (orthoRouting == getOrthoRouting())
+        return;
+    if (orthoRouting)
+        _orthoRouter = new qan::OrthoRouter{this};
+    else {
+        delete _orthoRouter.data();
+        _orthoRouter.clear();
+    }
+    // Regenerate ortho edges geometry with (or without) routes
+    for (const auto& edge : get_edges()) {
+        const auto edgeItem = edge ? edge->getItem() : nullptr;
+        if (edgeItem != nullptr &&
+            edgeItem->getStyle() != nullptr &&
+            edgeItem->getStyle()->getLineType() == qan::EdgeStyle::LineType::Ortho)
+            edgeItem->routeModified();
+    }
+    emit orthoRoutingChanged();
+}
+//-----------------------------------------------------------------------------
+
+void Graph::setSelectionDelegate(QQmlComponent* selectionDelegate) noexcept
+{
+    // Note: Cpp ownership is voluntarily not set to avoid destruction of
+    // objects owned from QML
+    if ( selectionDelegate != nullptr &&
+         selectionDelegate == _selectionDelegate.get() )
+        return;     // Actual delegate must not be wrapped in a temporary owning pointer
+    setSelectionDelegate(std::unique_ptr<QQmlComponent>(selectionDelegate));
+}
+
+void Graph::setSelectionDelegate(std::unique_ptr<QQmlComponent> selectionDelegate) noexcept
+{
+    bool delegateChanged{false};
+    if ( selectionDelegate ) {
+        if ( selectionDelegate != _selectionDelegate ) {
+            _selectionDelegate = std::move(selectionDelegate);
+            delegateChanged = true;
+        }
+    } else {    // Use QuickQanava default selection delegate
+        _selectionDelegate.reset(createComponent(QStringLiteral("qrc:/QuickQanava/SelectionItem.qml")));
+        delegateChanged = true;
+    }
+    if ( delegateChanged ) {  // Update all existing delegates...
+        // Note: It could be done in a more more 'generic' way!
+        auto updateNodeSelectionItem = [this]( auto& primitive ) -> void {
+            auto finalPrimitive = qobject_cast<qan::Node*>(primitive.get());
+            if ( finalPrimitive != nullptr &&
+                 finalPrimitive->getItem() &&
+                 finalPrimitive->getItem()->getSelectionItem() != nullptr )   // Replace only existing selection items
+                    finalPrimitive->getItem()->setSelectionItem(this->createSelectionItem(finalPrimitive->getItem()));
+        };
+        auto updateGroupSelectionItem = [this]( auto& primitive ) -> void {
+            auto finalPrimitive = qobject_cast<qan::Group*>(primitive.lock().get());
+            if ( finalPrimitive != nullptr &&
+                 finalPrimitive->getItem() &&
+                 finalPrimitive->getItem()->getSelectionItem() != nullptr )   // Replace only existing selection items
+                    finalPrimitive->getItem()->setSelectionItem(this->createSelectionItem(finalPrimitive->getItem()));
+        };
+        std::for_each(get_groups().begin(), get_groups().end(), updateGroupSelectionItem);
+        std::for_each(get_nodes().begin(), get_nodes().end(), updateNodeSelectionItem);
+        emit selectionDelegateChanged();
+    }
+}
+
+QPointer<QQuickItem> Graph::createSelectionItem( QQuickItem* parent ) noexcept
+{
+    const auto selectionItem = createItemFromComponent(_selectionDelegate.get());
+    if ( selectionItem ) {
+        selectionItem->setEnabled(false); // Avoid node/edge/group selection problems
+        selectionItem->setState("UNSELECTED");
+        selectionItem->setVisible(true);
+        QQmlEngine::setObjectOwnership( selectionItem, QQmlEngine::CppOwnership );
+        if (parent != nullptr ) {
+            selectionItem->setParentItem(parent);
+            selectionItem->setZ(1.0);
+        }
+        return selectionItem;
+    }
+    return QPointer<QQuickItem>{nullptr};
+}
+
+QQmlComponent*  Graph::createComponent(const QString& url) noexcept
+{
+    // PRECONDITIONS
+        // url could not be empty
+    if ( url.isEmpty() ) {
+        qWarning() << "qan::Graph::createComponent(): Error: Empty url.";
+        return nullptr;
+    }
+    // Note: Components are shared by all graphs using the same engine, they are loaded only once (and
+    // eventually preloaded asynchronously when QuickQanava is initialized, see qan::ComponentCache::preload()).
+    QQmlEngine* engine = qmlEngine( this );
+    if ( engine == nullptr ) {
+        qWarning() << "qan::Graph::createComponent(): No access to QML engine.";
+        return nullptr;
+    }
+    return qan::ComponentCache::get(*engine, url);
+}
+
+QPointer<QQuickItem> Graph::createItemFromComponent(QQmlComponent* component) noexcept
+{
+    QAN_TRACE_SCOPE("Graph::createItemFromComponent");
+    // PRECONDITIONS:
+        // component should not be nullptr, warning issued
+    if ( component == nullptr ) {
+        qWarning() << "qan::Graph::createItemFromComponent(): Error called with a nullptr delegate component.";
+        return nullptr;
+    }
+    QQuickItem* item = nullptr;
+    try {
+        if ( !component->isReady() )
+            throw qan::Error{ "Error delegate component is not ready." };
+
+        const auto rootContext = qmlContext(this);
+        if ( rootContext == nullptr )
+            throw qan::Error{ "Error can't access to local QML context." };
+        QObject* object = component->beginCreate(rootContext);
+        if ( object == nullptr ||
+             component->isError() ) {
+            if ( object != nullptr )
+                object->deleteLater();
+            throw qan::Error{ "Failed to create a concrete QQuickItem from QML component:\n\t" +
+                              component->errorString() };
+        }
+        component->completeCreate();
+        if ( !component->isError() ) {
+            QQmlEngine::setObjectOwnership( object, QQmlEngine::CppOwnership );
+            item = qobject_cast< QQuickItem* >( object );
+            item->setVisible( true );
+            item->setParentItem( getContainerItem() );
+            QAN_TRACE_COUNT(ItemsCreated);
+        } // Note QAN3: There is no leak until cpp ownership is set
+    } catch ( const qan::Error& e ) {
+        qWarning() << "qan::Graph::createItemFromComponent(): " << e.getMsg() << "\n" << component->errors();
+    } catch ( const std::exception& e ) {
+        qWarning() << "qan::Graph::createItemFromComponent(): " << e.what() << "\n" << component->errors();
+    }
+    return QPointer<QQuickItem>{item};
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Factories *///--------------------------------------------------------
+auto    Graph::insertNonVisualNode( SharedNode node ) noexcept(false) -> WeakNode
+{
+    auto weakNode = gtpo_graph_t::insert_node(node);
+    auto insertedNode = weakNode.lock();
+    if (insertedNode) {
+        onNodeInserted(*insertedNode);
+        notifyNodeInserted(insertedNode.get());
+    }
+    return weakNode;
+}
+
+qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+{
+    return insertNode<qan::Node>(nodeComponent, nodeStyle);
+}
+
+bool    Graph::insertNode(const SharedNode& node, QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+{
+    QAN_TRACE_SCOPE("Graph::insertNode");
+    // PRECONDITIONS:
+        // node must be dereferencable
+        // nodeComponent and nodeStyle can be nullptr
+    if (!node)
+        return false;
+
+    if (nodeComponent == nullptr) {
+        nodeComponent = _nodeDelegate.get(); // If no delegate component is specified, try the default node delegate
+    }
+    if (_headless) {        // Node item is created when headless graph is attached to a view
+        try {
+            QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
+            _virtualDelegates[node.get()] = VirtualDelegate{nodeComponent, nodeStyle};
+            return !insertNonVisualNode(node).expired();
+        } catch ( const gtpo::bad_topology_error& e ) {
+            qWarning() << "qan::Graph::insertNode(): Error: Topology error: " << e.what();
+            _virtualDelegates.erase(node.get());
+        }
+        return false;
+    }
+    if (nodeComponent == nullptr) {               // Otherwise, throw an error, a visual node must have a delegate
+        qWarning() << "qan::Graph::insertNode(SharedNode): Can't find a valid node delegate component.";
+        return false;
+    }
+    if (nodeComponent->isError()) {
+        qWarning() << "qan::Graph::insertNode(SharedNode): Component error: " << nodeComponent->errors();
+        return false;
+    }
+    try {
+        QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
+        qan::NodeItem* nodeItem = nullptr;
+        if (nodeStyle != nullptr) {
+            _styleManager.setStyleComponent(nodeStyle, nodeComponent);
+            nodeItem = static_cast<qan::NodeItem*>( createFromComponent( nodeComponent,
+                                                                         *nodeStyle,
+                                                                         node.get() ) );
+        }
+        if ( nodeItem  == nullptr )
+            throw qan::Error{"Node item creation failed."};
+        nodeItem->setNode(node.get());
         nodeItem->setGraph(this);
         node->setItem(nodeItem);
         auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
             if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
                 emit this->nodeClicked(nodeItem->getNode(), p);
         };
-        connect( nodeItem, &qan::NodeItem::nodeClicked, notifyNodeClicked );
+        connect( nodeItem, &qan::NodeItem::nodeClicked, this, notifyNodeClicked );
 
         auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
             if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
                 emit this->nodeRightClicked(nodeItem->getNode(), p);
         };
-        connect( nodeItem, &qan::NodeItem::nodeRightClicked, notifyNodeRightClicked );
+        connect( nodeItem, &qan::NodeItem::nodeRightClicked, this, notifyNodeRightClicked );
 
         auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
             if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
                 emit this->nodeDoubleClicked(nodeItem->getNode(), p);
         };
-        connect( nodeItem, &qan::NodeItem::nodeDoubleClicked, notifyNodeDoubleClicked );
+        connect( nodeItem, &qan::NodeItem::nodeDoubleClicked, this, notifyNodeDoubleClicked );
         node->setItem(nodeItem);
         {   // Send item to front
             _maxZ += 1;
@@ -648,22 +2795,25 @@ bool    Graph::insertNode(const SharedNode& node, QQmlComponent* nodeComponent,
     const auto nodePtr = node.get();
     if (nodePtr != nullptr) {       // Notify user.
         onNodeInserted(*nodePtr);
-        emit nodeInserted(nodePtr);
+        notifyNodeInserted(nodePtr);
     }
     return node.get();
 }
 
 void    Graph::removeNode( qan::Node* node )
 {
+    QAN_TRACE_SCOPE("Graph::removeNode");
     // PRECONDITIONS:
         // node can't be nullptr
     if ( node == nullptr )
         return;
     try {
-        onNodeRemoved(*node);
-        emit nodeRemoved(node);
-        if ( _selectedNodes.contains(node) )
-            _selectedNodes.removeAll(node);
+        if ( _undoStack.isRecording() ) {    // Adjacent edges are removed with node
+            const qan::UndoStack::MacroScope macro{_undoStack, tr("Remove node")};
+            node->forEachAdjacentEdge0([this](qan::Edge* edge) { _undoStack.recordRemoveEdge(*edge); });
+            _undoStack.recordRemoveNode(*node);
+        }
+        prepareNodeRemoval(*node);
         gtpo_graph_t::remove_node( std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()) );
     } catch ( std::bad_weak_ptr ) {
         qWarning() << "qan::Graph::removeNode(): Internal error for node " << node;
@@ -671,6 +2821,27 @@ void    Graph::removeNode( qan::Node* node )
     }
 }
 
+void    Graph::prepareNodeRemoval(qan::Node& node)
+{
+    removeHyperEdges(node);
+    onNodeRemoved(node);
+    emit nodeRemoved(&node);
+    if ( _nodeColumns )
+        _nodeColumns->removeRow(_nodeColumns->rowOf(node));
+    if ( _selection.contains(node) )
+        scheduleSelectionUpdate();
+    _selection.erase(node);
+    if ( !_virtualDelegates.empty() ) {
+        _virtualDelegates.erase(&node);
+        node.forEachAdjacentEdge0([this](qan::Edge* edge) { _virtualDelegates.erase(edge); });
+    }
+    if ( !_primitiveIds.empty() ) {
+        unindexPrimitive(&node);
+        node.forEachAdjacentEdge0([this](qan::Edge* edge) { unindexPrimitive(edge); });
+    }
+    recycleNodeItems(node);
+}
+
 int     Graph::getNodeCount() const noexcept { return gtpo_graph_t::get_node_count(); }
 
 void    Graph::onNodeInserted(qan::Node& node) { Q_UNUSED(node) /* Nil */ }
@@ -690,11 +2861,11 @@ qan::Edge*  Graph::insertEdge(QObject* source, QObject* destination, QQmlCompone
         else if (qobject_cast<qan::Group*>(destination) != nullptr)
             edge = insertEdge(sourceNode, qobject_cast<qan::Group*>(destination), edgeComponent);
         else if (qobject_cast<qan::Edge*>(destination) != nullptr)
-            edge = insertEdge(sourceNode, qobject_cast<qan::Edge*>(destination), edgeComponent);
+            return insertHyperEdge(sourceNode, qobject_cast<qan::Edge*>(destination));
     }
     if (edge != nullptr) {
         QQmlEngine::setObjectOwnership(edge, QQmlEngine::CppOwnership);
-        emit edgeInserted(edge);
+        notifyEdgeInserted(edge);
     } else
         qWarning() << "qan::Graph::insertEdge(): Error: Unable to find a valid insertEdge() method for arguments " << source << " and " << destination;
     qWarning() << "qan::Graph::insertEdge(): edge.ownership=" << QQmlEngine::objectOwnership(edge);
@@ -711,6 +2882,43 @@ qan::Edge*  Graph::insertEdge( qan::Node* source, qan::Node* destination, QQmlCo
     return insertEdge<qan::Edge>(*source, destination, edgeComponent);
 }
 
+qan::Edge*  Graph::insertHyperEdge(qan::Node* source, qan::Edge* destination)
+{
+    // PRECONDITIONS:
+        // source and destination can't be nullptr
+    if ( source == nullptr ||
+         destination == nullptr )
+        return nullptr;
+    try {
+        const WeakNode sharedSource = std::static_pointer_cast<Config::final_node_t>(source->shared_from_this());
+        const std::weak_ptr<qan::Edge> sharedDestination = destination->shared_from_this();
+        const auto hyperEdge = gtpo_graph_t::create_edge(sharedSource, sharedDestination).lock();
+        if ( hyperEdge ) {
+            QQmlEngine::setObjectOwnership(hyperEdge.get(), QQmlEngine::CppOwnership);
+            return hyperEdge.get();
+        }
+    } catch ( const gtpo::bad_topology_error& e ) {
+        qWarning() << "qan::Graph::insertHyperEdge(): Error: Topology error:" << e.what();
+    } catch ( ... ) {
+        qWarning() << "qan::Graph::insertHyperEdge(): Error: Topology error.";
+    }
+    return nullptr;
+}
+
+void    Graph::removeHyperEdges(qan::Node& node)
+{
+    if ( get_hyper_edge_count() == 0 )  // Fast exit
+        return;
+    const auto outHEdges = node.get_out_hedges();
+    for ( const auto& outHEdge : outHEdges )
+        removeEdge(outHEdge.lock().get());
+    node.forEachAdjacentEdge0([this](qan::Edge* edge) {
+        const auto inHEdges = edge->get_in_hedges();
+        for ( const auto& inHEdge : inHEdges )
+            removeEdge(inHEdge.lock().get());
+    });
+}
+
 void    Graph::bindEdgeSource( qan::Edge* edge, qan::PortItem* outPort) noexcept
 {
     // PRECONDITIONS:
@@ -775,6 +2983,49 @@ bool    Graph::isEdgeDestinationBindable( const qan::PortItem& inPort ) const no
     return false;
 }
 
+bool    Graph::isEdgeInsertable(qan::Node& source, qan::Node& destination) const noexcept
+{
+    if ( !_acyclic ||
+         _topologicalOrder == nullptr )
+        return true;
+    try {
+        const WeakNode sharedSource = std::static_pointer_cast<Config::final_node_t>(source.shared_from_this());
+        const WeakNode sharedDestination = std::static_pointer_cast<Config::final_node_t>(destination.shared_from_this());
+        return !_topologicalOrder->would_create_cycle(sharedSource, sharedDestination);
+    } catch ( std::bad_weak_ptr ) { }
+    return false;
+}
+
+void    Graph::setAcyclic(bool acyclic) noexcept
+{
+    if ( acyclic != _acyclic ) {
+        if ( acyclic ) {
+            if ( !resetTopologicalOrder() )
+                return;
+        } else if ( _topologicalOrder != nullptr )
+            _topologicalOrder->disable();   // Note: a disabled behaviour ignore topology changes
+        _acyclic = acyclic;
+        emit acyclicChanged();
+    }
+}
+
+bool    Graph::resetTopologicalOrder() noexcept
+{
+    try {
+        if ( _topologicalOrder == nullptr ) {
+            auto topologicalOrder = std::make_unique<TopologicalOrder>();
+            _topologicalOrder = topologicalOrder.get();
+            gtpo_graph_t::add_dynamic_graph_behaviour(std::move(topologicalOrder));
+        }
+        _topologicalOrder->reset(*this);
+        _topologicalOrder->enable();
+    } catch ( ... ) {
+        qWarning() << "qan::Graph::resetTopologicalOrder(): Error: Topological order initialization failed.";
+        return false;
+    }
+    return true;
+}
+
 void    Graph::bindEdgeSource( qan::Edge& edge, qan::PortItem& outPort ) noexcept
 {
     // PRECONDITION:
@@ -784,8 +3035,12 @@ void    Graph::bindEdgeSource( qan::Edge& edge, qan::PortItem& outPort ) noexcep
         return;
 
     if ( isEdgeSourceBindable(outPort) ) {
+        const auto previousPort = qobject_cast<qan::PortItem*>(edgeItem->getSourceItem());
+        if ( previousPort != nullptr &&
+             previousPort != &outPort )
+            previousPort->removeOutEdgeItem(*edgeItem);
         edgeItem->setSourceItem(&outPort);
-        outPort.getOutEdgeItems().append(edgeItem);
+        outPort.addOutEdgeItem(*edgeItem);
     }
 }
 
@@ -798,16 +3053,41 @@ void    Graph::bindEdgeDestination( qan::Edge& edge, qan::PortItem& inPort ) noe
         return;
 
     if ( isEdgeDestinationBindable(inPort) ) {
+        const auto previousPort = qobject_cast<qan::PortItem*>(edgeItem->getDestinationItem());
+        if ( previousPort != nullptr &&
+             previousPort != &inPort )
+            previousPort->removeInEdgeItem(*edgeItem);
         edgeItem->setDestinationItem(&inPort);
-        inPort.getInEdgeItems().append(edgeItem);
+        inPort.addInEdgeItem(*edgeItem);
     }
 }
 
-bool    Graph::configureEdge( qan::Edge& edge, QQmlComponent& edgeComponent, qan::EdgeStyle& style,
+void    Graph::unbindEdgeItemPorts(qan::EdgeItem& edgeItem) noexcept
+{
+    const auto srcPort = qobject_cast<qan::PortItem*>(edgeItem.getSourceItem());
+    if ( srcPort != nullptr )
+        srcPort->removeOutEdgeItem(edgeItem);
+    const auto dstPort = qobject_cast<qan::PortItem*>(edgeItem.getDestinationItem());
+    if ( dstPort != nullptr )
+        dstPort->removeInEdgeItem(edgeItem);
+}
+
+bool    Graph::configureEdge( qan::Edge& edge, QQmlComponent* edgeComponent, qan::EdgeStyle& style,
                               qan::Node& src, qan::Node* dstNode )
 {
-    _styleManager.setStyleComponent(&style, &edgeComponent);
-    auto edgeItem = qobject_cast< qan::EdgeItem* >( createFromComponent( &edgeComponent, style, nullptr, &edge ) );
+    _styleManager.setStyleComponent(&style, edgeComponent);
+    if ( _headless ||               // Edge item is created when headless graph is attached to a view, or
+         ( _virtualized &&          // by updateVirtualization() once both end nodes have an item
+           ( src.getItem() == nullptr || dstNode == nullptr || dstNode->getItem() == nullptr ) ) ) {
+        _virtualDelegates[&edge] = VirtualDelegate{edgeComponent, &style};
+        edge.set_src( std::static_pointer_cast<Config::final_node_t>(src.shared_from_this()) );
+        if ( dstNode != nullptr )
+            edge.set_dst( std::static_pointer_cast<Config::final_node_t>(dstNode->shared_from_this()) );
+        return true;
+    }
+    if ( edgeComponent == nullptr )
+        return false;
+    auto edgeItem = qobject_cast< qan::EdgeItem* >( createFromComponent( edgeComponent, style, nullptr, &edge ) );
     if ( edgeItem == nullptr ) {
         qWarning() << "qan::Graph::insertEdge(): Warning: Edge creation from QML delegate failed.";
         return false;
@@ -825,53 +3105,266 @@ bool    Graph::configureEdge( qan::Edge& edge, QQmlComponent& edgeComponent, qan
         if ( edgeItem != nullptr && edgeItem->getEdge() != nullptr )
             emit this->edgeClicked(edgeItem->getEdge(), p);
     };
-    connect( edgeItem, &qan::EdgeItem::edgeClicked, notifyEdgeClicked );
+    connect( edgeItem, &qan::EdgeItem::edgeClicked, this, notifyEdgeClicked );
 
     auto notifyEdgeRightClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if ( edgeItem != nullptr && edgeItem->getEdge() != nullptr )
             emit this->edgeRightClicked(edgeItem->getEdge(), p);
     };
-    connect( edgeItem, &qan::EdgeItem::edgeRightClicked, notifyEdgeRightClicked );
+    connect( edgeItem, &qan::EdgeItem::edgeRightClicked, this, notifyEdgeRightClicked );
 
     auto notifyEdgeDoubleClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if ( edgeItem != nullptr && edgeItem->getEdge() != nullptr )
             emit this->edgeDoubleClicked(edgeItem->getEdge(), p);
     };
-    connect( edgeItem, &qan::EdgeItem::edgeDoubleClicked, notifyEdgeDoubleClicked );
+    connect( edgeItem, &qan::EdgeItem::edgeDoubleClicked, this, notifyEdgeDoubleClicked );
+    return true;
+}
+
+void    Graph::removeEdge(qan::Node* source, qan::Node* destination)
+{
+    if ( source == nullptr || destination == nullptr )
+        return;
+    WeakNode sharedSource;
+    WeakNode sharedDestination;
+    try {
+        sharedSource = std::static_pointer_cast<Config::final_node_t>( source->shared_from_this() );
+        sharedDestination = std::static_pointer_cast<Config::final_node_t>( destination->shared_from_this() );
+    } catch ( std::bad_weak_ptr ) { return; }
+    if ( _undoStack.isRecording() ) {
+        for ( const auto& outEdge : source->get_out_edges() ) {    // Note: only first source to destination edge is removed
+            const auto edge = outEdge.lock();
+            if ( edge && edge->get_dst().lock().get() == destination ) {
+                _undoStack.recordRemoveEdge(*edge);
+                break;
+            }
+        }
+    }
+    if ( !_primitiveIds.empty() ) {
+        for ( const auto& outEdge : source->get_out_edges() ) {
+            const auto edge = outEdge.lock();
+            if ( edge && edge->get_dst().lock().get() == destination )
+                unindexPrimitive(edge.get());
+        }
+    }
+    return gtpo_graph_t::remove_edge( sharedSource, sharedDestination );
+}
+
+void    Graph::removeEdge(qan::Edge* edge)
+{
+    using WeakEdge = std::weak_ptr<qan::Edge>;
+    if ( edge != nullptr ) {
+        if ( edge->get_in_hdegree() > 0 ) {     // Dependent hyper edges are removed with edge, release their items first
+            const auto inHEdges = edge->get_in_hedges();
+            for ( const auto& inHEdge : inHEdges )
+                removeEdge(inHEdge.lock().get());
+        }
+        if ( _undoStack.isRecording() )
+            _undoStack.recordRemoveEdge(*edge);
+        _virtualDelegates.erase(edge);
+        unindexPrimitive(edge);
+        if ( edge->getItem() != nullptr )
+            unbindEdgeItemPorts(*edge->getItem());  // Update ports multiplicity before deferred item deletion
+        if ( edge->getItem() != nullptr &&
+             recycleItem( edge->getItem() ) )
+            edge->releaseItem();
+        gtpo_graph_t::remove_edge( WeakEdge{edge->shared_from_this()} );
+    }
+}
+
+bool    Graph::hasEdge(qan::Node* source, qan::Node* destination) const
+{
+    if ( source == nullptr || destination == nullptr )
+        return false;
+    WeakNode sharedSource;
+    WeakNode sharedDestination;
+    try {
+        sharedSource = std::static_pointer_cast<Config::final_node_t>( source->shared_from_this() );
+        sharedDestination = std::static_pointer_cast<Config::final_node_t>( destination->shared_from_this() );
+    } catch ( std::bad_weak_ptr e ) { return false; }
+    return gtpo_graph_t::has_edge(sharedSource, sharedDestination);
+}
+//-----------------------------------------------------------------------------
+
+/* External Id Index *///-----------------------------------------------------
+qan::Node*  Graph::insertNode(const QString& id, QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
+{
+    if (id.isEmpty() ||
+        nodeById(id) != nullptr)
+        return nullptr;
+    const auto node = insertNode(nodeComponent, nodeStyle);
+    if (node != nullptr)
+        setNodeId(node, id);
+    return node;
+}
+
+qan::Edge*  Graph::insertEdge(const QString& id, qan::Node* source, qan::Node* destination, QQmlComponent* edgeComponent)
+{
+    if (id.isEmpty() ||
+        edgeById(id) != nullptr)
+        return nullptr;
+    const auto edge = insertEdge(source, destination, edgeComponent);
+    if (edge != nullptr)
+        setEdgeId(edge, id);
+    return edge;
+}
+
+qan::Node*  Graph::nodeById(const QString& id) const noexcept
+{
+    const auto node = _nodesById.constFind(id);
+    return node != _nodesById.cend() ? node->data() : nullptr;
+}
+
+qan::Edge*  Graph::edgeById(const QString& id) const noexcept
+{
+    const auto edge = _edgesById.constFind(id);
+    return edge != _edgesById.cend() ? edge->data() : nullptr;
+}
+
+QString     Graph::getPrimitiveId(QObject* primitive) const noexcept
+{
+    const auto id = _primitiveIds.find(primitive);
+    return id != _primitiveIds.end() ? id->second : QString{};
+}
+
+bool        Graph::setNodeId(qan::Node* node, const QString& id) noexcept
+{
+    if (node == nullptr)
+        return false;
+    const auto indexed = nodeById(id);
+    if (indexed == node)
+        return true;
+    if (indexed != nullptr)
+        return false;
+    unindexPrimitive(node);
+    if (!id.isEmpty()) {
+        _nodesById.insert(id, node);
+        _primitiveIds[node] = id;
+    }
+    return true;
+}
+
+bool        Graph::setEdgeId(qan::Edge* edge, const QString& id) noexcept
+{
+    if (edge == nullptr)
+        return false;
+    const auto indexed = edgeById(id);
+    if (indexed == edge)
+        return true;
+    if (indexed != nullptr)
+        return false;
+    unindexPrimitive(edge);
+    if (!id.isEmpty()) {
+        _edgesById.insert(id, edge);
+        _primitiveIds[edge] = id;
+    }
     return true;
 }
 
-void    Graph::removeEdge(qan::Node* source, qan::Node* destination)
+void        Graph::unindexPrimitive(const QObject* primitive) noexcept
 {
-    if ( source == nullptr || destination == nullptr )
+    if (_primitiveIds.empty())
         return;
-    WeakNode sharedSource;
-    WeakNode sharedDestination;
-    try {
-        sharedSource = std::static_pointer_cast<Config::final_node_t>( source->shared_from_this() );
-        sharedDestination = std::static_pointer_cast<Config::final_node_t>( destination->shared_from_this() );
-    } catch ( std::bad_weak_ptr ) { return; }
-    return gtpo_graph_t::remove_edge( sharedSource, sharedDestination );
+    const auto id = _primitiveIds.find(primitive);
+    if (id == _primitiveIds.end())
+        return;
+    if (qobject_cast<const qan::Edge*>(primitive) != nullptr)
+        _edgesById.remove(id->second);
+    else
+        _nodesById.remove(id->second);
+    _primitiveIds.erase(id);
 }
 
-void    Graph::removeEdge(qan::Edge* edge)
+qan::Graph::IdTopology  Graph::getIdTopology() const
 {
-    using WeakEdge = std::weak_ptr<qan::Edge>;
-    if ( edge != nullptr )
-        gtpo_graph_t::remove_edge( WeakEdge{edge->shared_from_this()} );
+    IdTopology topology;
+    topology.nodes.reserve(static_cast<std::size_t>(_nodesById.size()));
+    for (auto node = _nodesById.cbegin(); node != _nodesById.cend(); ++node)
+        if (node.value())
+            topology.nodes.push_back(node.key());
+    const auto nodeId = [this](const WeakNode& weakNode) -> QString {
+        const auto node = weakNode.lock();
+        const auto id = node ? _primitiveIds.find(node.get()) : _primitiveIds.end();
+        return id != _primitiveIds.end() ? id->second : QString{};
+    };
+    topology.edges.reserve(static_cast<std::size_t>(_edgesById.size()));
+    for (auto edge = _edgesById.cbegin(); edge != _edgesById.cend(); ++edge)
+        if (edge.value())
+            topology.edges.push_back({edge.key(),
+                                      nodeId(edge.value()->get_src()),
+                                      nodeId(edge.value()->get_dst())});
+    return topology;
 }
 
-bool    Graph::hasEdge(qan::Node* source, qan::Node* destination) const
+int     Graph::synchronize(const IdTopology& topology) noexcept
 {
-    if ( source == nullptr || destination == nullptr )
-        return false;
-    WeakNode sharedSource;
-    WeakNode sharedDestination;
     try {
-        sharedSource = std::static_pointer_cast<Config::final_node_t>( source->shared_from_this() );
-        sharedDestination = std::static_pointer_cast<Config::final_node_t>( destination->shared_from_this() );
-    } catch ( std::bad_weak_ptr e ) { return false; }
-    return gtpo_graph_t::has_edge(sharedSource, sharedDestination);
+        return applyTopologyDiff(gtpo::diff_topology<QString, IdHash>(getIdTopology(), topology));
+    } catch (...) { qWarning() << "qan::Graph::synchronize(): Error: Topology diff failed."; }
+    return 0;
+}
+
+int     Graph::applyTopologyDiff(const TopologyDiff& diff) noexcept
+{
+    // ALGORITHM:
+        // Operations are applied in gtpo::topology_diff order: remove edges, remove nodes, add nodes,
+        // rewire edges and add edges, so that an inserted edge never reference a missing node. Rewired
+        // edges are detached first: a removed node would otherwise remove them with its adjacent edges.
+    int changeCount = 0;
+    beginUpdate();
+    std::vector<QPointer<qan::EdgeStyle>> rewiredStyles;
+    rewiredStyles.reserve(diff.rewired_edges.size());
+    for (const auto& rewiredEdge : diff.rewired_edges) {
+        const auto edge = edgeById(rewiredEdge.id);
+        rewiredStyles.emplace_back(edge != nullptr ? const_cast<qan::EdgeStyle*>(getEdgeStyle(*edge)) : nullptr);
+        if (edge != nullptr)
+            removeEdge(edge);
+    }
+    for (const auto& id : diff.removed_edges) {
+        const auto edge = edgeById(id);
+        if (edge == nullptr)
+            continue;
+        removeEdge(edge);
+        ++changeCount;
+    }
+    for (const auto& id : diff.removed_nodes) {
+        const auto node = nodeById(id);
+        if (node == nullptr)
+            continue;
+        const auto group = qobject_cast<qan::Group*>(node);
+        if (group != nullptr)
+            removeGroup(group);
+        else
+            removeNode(node);
+        ++changeCount;
+    }
+    for (const auto& id : diff.added_nodes)
+        if (insertNode(id) != nullptr)
+            ++changeCount;
+    for (std::size_t r = 0; r < diff.rewired_edges.size(); ++r) {
+        const auto& rewiredEdge = diff.rewired_edges[r];
+        const auto source = nodeById(rewiredEdge.src);
+        const auto destination = nodeById(rewiredEdge.dst);
+        if (source == nullptr ||
+            destination == nullptr)
+            continue;
+        const auto rewired = insertEdge(rewiredEdge.id, source, destination);
+        if (rewired == nullptr)
+            continue;
+        if (rewiredStyles[r])
+            setEdgeStyle(*rewired, rewiredStyles[r].data());
+        ++changeCount;
+    }
+    for (const auto& addedEdge : diff.added_edges) {
+        const auto source = nodeById(addedEdge.src);
+        const auto destination = nodeById(addedEdge.dst);
+        if (source != nullptr &&
+            destination != nullptr &&
+            insertEdge(addedEdge.id, source, destination) != nullptr)
+            ++changeCount;
+    }
+    endUpdate();
+    return changeCount;
 }
 //-----------------------------------------------------------------------------
 
@@ -896,6 +3389,18 @@ bool    Graph::insertGroup(const SharedGroup& group, QQmlComponent* groupCompone
 
     if (groupStyle == nullptr)
         groupStyle = qobject_cast<qan::NodeStyle*>(qan::Group::style());
+    if (_headless) {        // Group item is created when headless graph is attached to a view
+        try {
+            gtpo_graph_t::insert_group(group);
+        } catch (const gtpo::bad_topology_error& e) {
+            qWarning() << "qan::Graph::insertGroup(): Error: Internal topology error: " << e.what();
+            return false;
+        }
+        _virtualDelegates[group.get()] = VirtualDelegate{groupComponent, groupStyle};
+        onNodeInserted(*group);
+        notifyNodeInserted(group.get());
+        return true;
+    }
     if (groupStyle != nullptr &&
         groupComponent != nullptr) {
         // FIXME: Group styles are still not well supported (20170317)
@@ -931,19 +3436,19 @@ bool    Graph::insertGroup(const SharedGroup& group, QQmlComponent* groupCompone
         if ( groupItem != nullptr && groupItem->getGroup() != nullptr )
             emit this->groupClicked(groupItem->getGroup(), p);
     };
-    connect( groupItem, &qan::GroupItem::groupClicked, notifyGroupClicked );
+    connect( groupItem, &qan::GroupItem::groupClicked, this, notifyGroupClicked );
 
     auto notifyGroupRightClicked = [this] (qan::GroupItem* groupItem, QPointF p) {
         if ( groupItem != nullptr && groupItem->getGroup() != nullptr )
             emit this->groupRightClicked(groupItem->getGroup(), p);
     };
-    connect( groupItem, &qan::GroupItem::groupRightClicked, notifyGroupRightClicked );
+    connect( groupItem, &qan::GroupItem::groupRightClicked, this, notifyGroupRightClicked );
 
     auto notifyGroupDoubleClicked = [this] (qan::GroupItem* groupItem, QPointF p) {
         if ( groupItem != nullptr && groupItem->getGroup() != nullptr )
             emit this->groupDoubleClicked(groupItem->getGroup(), p);
     };
-    connect( groupItem, &qan::GroupItem::groupDoubleClicked, notifyGroupDoubleClicked );
+    connect( groupItem, &qan::GroupItem::groupDoubleClicked, this, notifyGroupDoubleClicked );
 
     { // Send group item to front
         _maxZ += 1.0;
@@ -951,7 +3456,7 @@ bool    Graph::insertGroup(const SharedGroup& group, QQmlComponent* groupCompone
     }
     if (group) {       // Notify user.
         onNodeInserted(*group);
-        emit nodeInserted(group.get());
+        notifyNodeInserted(group.get());
     }
     return true;
 }
@@ -961,21 +3466,32 @@ void    Graph::removeGroup(qan::Group* group)
     if (group == nullptr)
         return;
 
+    if (_undoStack.isRecording()) {     // Group content is ungrouped and adjacent edges are removed with group
+        const qan::UndoStack::MacroScope macro{_undoStack, tr("Remove group")};
+        for (auto& node : group->get_nodes()) {
+            const auto qanNode = qobject_cast<qan::Node*>(node.lock().get());
+            if (qanNode != nullptr)
+                _undoStack.recordUngroup(*qanNode, *group);
+        }
+        group->forEachAdjacentEdge0([this](qan::Edge* edge) { _undoStack.recordRemoveEdge(*edge); });
+        _undoStack.recordRemoveNode(*group);
+    }
+
     // Reparent all group childrens (ie node) to graph before destructing the group
     // otherwise all child items get destructed too
-    for (auto& node : group->get_nodes()) {
-        const auto qanNode = qobject_cast<qan::Node*>(node.lock().get());
-        if (qanNode != nullptr &&
-            qanNode->getItem() != nullptr &&
-            group->getGroupItem() != nullptr )
-            group->getGroupItem()->ungroupNodeItem(qanNode->getItem());
+    if (group->getGroupItem() != nullptr) {
+        std::vector<qan::NodeItem*> nodeItems;
+        nodeItems.reserve(group->get_nodes().size());
+        for (auto& node : group->get_nodes()) {
+            const auto qanNode = qobject_cast<qan::Node*>(node.lock().get());
+            if (qanNode != nullptr &&
+                qanNode->getItem() != nullptr)
+                nodeItems.push_back(qanNode->getItem());
+        }
+        group->getGroupItem()->ungroupNodeItems(nodeItems);
     }
 
-    onNodeRemoved(*group);      // group are node, notify group
-    emit nodeRemoved(group);    // removed as a node
-
-    if (_selectedNodes.contains(group))
-        _selectedNodes.removeAll(group);
+    prepareNodeRemoval(*group); // group are node, notify group and release its node bookkeeping
 
     auto nodeGroupPtr = std::static_pointer_cast<gtpo_graph_t::group_t>(group->shared_from_this());
     gtpo_graph_t::weak_group_t weakNodeGroupPtr = nodeGroupPtr;
@@ -1009,6 +3525,9 @@ bool    qan::Graph::groupNode(qan::Group* group, qan::Node* node, bool transform
             emit nodeGrouped(node, group);
             group->getGroupItem()->groupNodeItem(node->getItem(), transform);
         }
+        if ( node->get_group().lock().get() == group &&
+             _undoStack.isRecording() )
+            _undoStack.recordGroup(*node, *group);
         return true;
     } catch (...) { qWarning() << "qan::Graph::groupNode(): Topology error."; }
     return false;
@@ -1039,6 +3558,8 @@ bool    qan::Graph::ungroupNode(qan::Node* node, Group* group, bool transform) n
             gtpo_graph_t::ungroup_node( std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()),
                                        std::static_pointer_cast<Group>(group->shared_from_this()) );
             emit nodeUngrouped(node, group);
+            if (_undoStack.isRecording())
+                _undoStack.recordUngroup(*node, *group);
             if (node != nullptr &&
                 node->getItem() != nullptr) {
                 // Update node z to maxZ: otherwise an undroupped node might be behind it's host group.
@@ -1050,6 +3571,794 @@ bool    qan::Graph::ungroupNode(qan::Node* node, Group* group, bool transform) n
     }
     return false;
 }
+
+bool    qan::Graph::groupNodes(qan::Group* group, const std::vector<qan::Node*>& nodes, bool transform) noexcept
+{
+    // PRECONDITIONS:
+        // group can't be nullptr
+        // nullptr nodes, group itself and nodes already in group are ignored
+    if (group == nullptr)
+        return false;
+    std::vector<WeakNode>   weakNodes;
+    std::vector<qan::Node*> groupedNodes;
+    weakNodes.reserve(nodes.size());
+    groupedNodes.reserve(nodes.size());
+    for (const auto node : nodes) {
+        if (node == nullptr ||
+            static_cast<const QObject*>(group) == static_cast<const QObject*>(node))
+            continue;
+        if (node->get_group().lock().get() == group)
+            continue;
+        weakNodes.push_back(std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()));
+        groupedNodes.push_back(node);
+    }
+    if (weakNodes.empty())
+        return true;
+    try {
+        gtpo_graph_t::group_nodes(std::static_pointer_cast<Group>(group->shared_from_this()),
+                                  weakNodes.cbegin(), weakNodes.cend());
+        std::vector<qan::NodeItem*> nodeItems;
+        nodeItems.reserve(groupedNodes.size());
+        const qan::UndoStack::MacroScope macro{_undoStack, tr("Group")};
+        for (const auto node : groupedNodes) {
+            if (node->get_group().lock().get() != group)   // Check that group insertion succeed
+                continue;
+            if (_undoStack.isRecording())
+                _undoStack.recordGroup(*node, *group);
+            emit nodeGrouped(node, group);
+            if (node->getItem() != nullptr)
+                nodeItems.push_back(node->getItem());
+        }
+        if (group->getGroupItem() != nullptr)
+            group->getGroupItem()->groupNodeItems(nodeItems, transform);
+        return true;
+    } catch (...) { qWarning() << "qan::Graph::groupNodes(): Topology error."; }
+    return false;
+}
+
+bool    qan::Graph::ungroupNodes(const std::vector<qan::Node*>& nodes, qan::Group* group, bool transform) noexcept
+{
+    // PRECONDITIONS:
+        // nullptr nodes are ignored
+        // if group is not nullptr, nodes group should be group
+    std::unordered_map<qan::Group*, std::vector<qan::Node*>> groupsNodes;
+    for (const auto node : nodes) {
+        if (node == nullptr)
+            continue;
+        const auto nodeGroup = node->get_group().lock().get();
+        if (nodeGroup == nullptr ||
+            (group != nullptr && nodeGroup != group))
+            return false;
+        groupsNodes[nodeGroup].push_back(node);
+    }
+    try {
+        const qan::UndoStack::MacroScope macro{_undoStack, tr("Ungroup")};
+        for (const auto& groupNodes : groupsNodes) {
+            const auto nodeGroup = groupNodes.first;
+            std::vector<WeakNode>       weakNodes;
+            std::vector<qan::NodeItem*> nodeItems;
+            weakNodes.reserve(groupNodes.second.size());
+            nodeItems.reserve(groupNodes.second.size());
+            for (const auto node : groupNodes.second) {
+                weakNodes.push_back(std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()));
+                if (node->getItem() != nullptr)
+                    nodeItems.push_back(node->getItem());
+            }
+            if (nodeGroup->getGroupItem())
+                nodeGroup->getGroupItem()->ungroupNodeItems(nodeItems, transform);
+            gtpo_graph_t::ungroup_nodes(std::static_pointer_cast<Group>(nodeGroup->shared_from_this()),
+                                        weakNodes.cbegin(), weakNodes.cend());
+            for (const auto node : groupNodes.second) {
+                if (_undoStack.isRecording())
+                    _undoStack.recordUngroup(*node, *nodeGroup);
+                emit nodeUngrouped(node, nodeGroup);
+                if (node->getItem() != nullptr) {
+                    // Update node z to maxZ: otherwise an undroupped node might be behind it's host group.
+                    _maxZ += 1.0;
+                    node->getItem()->setZ(_maxZ);
+                }
+            }
+        }
+        return true;
+    } catch ( ... ) { qWarning() << "qan::Graph::ungroupNodes(): Topology error."; }
+    return false;
+}
+
+int     qan::Graph::groupComponents(bool strongly, int minimumSize) noexcept
+{
+    try {
+        const auto graphSnapshot = snapshot();
+        const auto& csr = graphSnapshot->get_csr();
+        const auto components = strongly ? gtpo::strongly_connected_components(csr) :
+                                           gtpo::weakly_connected_components(csr);
+        return groupPartition(graphSnapshot, components, minimumSize, false, tr("Group components"));
+    } catch (...) { qWarning() << "qan::Graph::groupComponents(): Error: Components computation failed."; }
+    return 0;
+}
+
+int     qan::Graph::groupCommunities(int maxIterations, int minimumSize, bool collapse) noexcept
+{
+    try {
+        const auto graphSnapshot = snapshot();
+        const auto communities = gtpo::parallel_label_propagation(graphSnapshot->get_csr(),
+                                                                  static_cast<std::size_t>(std::max(0, maxIterations)));
+        return groupPartition(graphSnapshot, communities, minimumSize, collapse, tr("Group communities"));
+    } catch (...) { qWarning() << "qan::Graph::groupCommunities(): Error: Communities detection failed."; }
+    return 0;
+}
+
+int     qan::Graph::groupPartition(const Snapshot& graphSnapshot, const std::vector<Snapshot::element_type::index_t>& partition,
+                                   int minimumSize, bool collapse, const QString& undoText) noexcept
+{
+    // PRECONDITIONS:
+        // graphSnapshot can't be nullptr
+        // partition must be indexed by graphSnapshot dense node indexes
+    if (!graphSnapshot)
+        return 0;
+    const auto& csr = graphSnapshot->get_csr();
+    if (partition.size() != static_cast<std::size_t>(csr.get_node_count()))
+        return 0;
+    std::vector<std::vector<qan::Node*>> partsNodes;
+    try {
+        for (std::size_t n = 0; n < partition.size(); ++n) {
+            const auto node = csr.get_node(static_cast<Snapshot::element_type::index_t>(n)).lock();
+            if (!node ||
+                node->is_group() ||
+                !node->get_group().expired())     // Only top level nodes are grouped
+                continue;
+            const auto part = static_cast<std::size_t>(partition[n]);
+            if (part >= partsNodes.size())
+                partsNodes.resize(part + 1);
+            partsNodes[part].push_back(node.get());
+        }
+    } catch (...) {     // std::bad_alloc
+        qWarning() << "qan::Graph::groupPartition(): Error: Partition nodes collection failed.";
+        return 0;
+    }
+
+    const auto minimumNodeCount = static_cast<std::size_t>(std::max(1, minimumSize));
+    constexpr qreal padding = 10.;
+    int groupCount = 0;
+    beginUpdate();
+    {
+        const qan::UndoStack::MacroScope macro{_undoStack, undoText};
+        for (const auto& partNodes : partsNodes) {
+            if (partNodes.size() < minimumNodeCount)
+                continue;
+            QRectF bounds;
+            for (const auto node : partNodes)
+                bounds = bounds.united(node->getGeometry());
+            const auto group = insertGroup();
+            if (group == nullptr)
+                continue;
+            group->setGeometry(bounds.adjusted(-padding, -padding, padding, padding));
+            if (!groupNodes(group, partNodes))
+                continue;
+            ++groupCount;
+            if (collapse &&
+                group->getGroupItem() != nullptr)
+                group->getGroupItem()->setCollapsed(true);
+        }
+    }
+    endUpdate();
+    return groupCount;
+}
+//-----------------------------------------------------------------------------
+
+
+/* Binary Serialization *///---------------------------------------------------
+namespace impl { // ::qan::impl
+
+//! Return \c node visual item (group item for groups), or nullptr for a non visual node.
+const QQuickItem*   binaryNodeItem(const qan::Node& node) noexcept
+{
+    if (node.is_group()) {
+        const auto group = qobject_cast<const qan::Group*>(&node);
+        return group != nullptr ? group->getGroupItem() : nullptr;
+    }
+    return node.getItem();
+}
+
+//! Induced subgraph adapter exposing a node subset to gtpo::write_binary_graph().
+template <class Graph_t>
+struct BinarySubgraph {
+    using node_t = typename Graph_t::node_t;
+    using shared_node_t = typename Graph_t::shared_node_t;
+
+    std::vector<shared_node_t>  nodes;
+    int                         edgeCount = 0;
+
+    inline auto get_nodes() const noexcept -> const std::vector<shared_node_t>& { return nodes; }
+    inline auto get_node_count() const noexcept -> int { return static_cast<int>(nodes.size()); }
+    inline auto get_edge_count() const noexcept -> int { return edgeCount; }
+};
+
+//! Clipboard style and delegate references record (indexes in qan::Graph clipboard references, or noReference).
+struct BinaryReferences {
+    static constexpr std::uint32_t noReference = 0xFFFFFFFF;
+    std::uint32_t   style = noReference;
+    std::uint32_t   component = noReference;
+};
+static_assert(sizeof(BinaryReferences) == 8, "qan::impl::BinaryReferences: unexpected record padding.");
+
+//! Return offset of references table following binary graph in clipboard buffer.
+inline std::size_t  binaryReferencesOffset(const gtpo::binary_header& header) noexcept
+{
+    return static_cast<std::size_t>((header.strings_offset + header.strings_size + 7) & ~std::uint64_t{7});
+}
+
+} // ::qan::impl
+
+bool    Graph::saveBinary(const QString& filePath) const noexcept
+{
+    QSaveFile file{filePath};
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "qan::Graph::saveBinary(): Error: Can't open file " << filePath;
+        return false;
+    }
+    try {
+        std::ostringstream os{std::ios::out | std::ios::binary};
+        gtpo::write_binary_graph(static_cast<const gtpo_graph_t&>(*this), os,
+                                 [](const qan::Node& node) noexcept {
+                                     gtpo::binary_geometry geometry;
+                                     const auto item = impl::binaryNodeItem(node);
+                                     if (item != nullptr) {   // Note: grouped items are saved in their group coordinate system
+                                         geometry.x = static_cast<float>(item->x());
+                                         geometry.y = static_cast<float>(item->y());
+                                         geometry.w = static_cast<float>(item->width());
+                                         geometry.h = static_cast<float>(item->height());
+                                         geometry.z = static_cast<float>(item->z());
+                                     }
+                                     return geometry;
+                                 },
+                                 [](const qan::Node& node) {
+                                     return node.getLabel().toStdString();   // QString::toStdString() is UTF-8
+                                 });
+        const auto data = os.str();
+        if (file.write(data.data(), static_cast<qint64>(data.size())) != static_cast<qint64>(data.size()) ||
+            !file.commit()) {
+            qWarning() << "qan::Graph::saveBinary(): Error: Can't write file " << filePath;
+            return false;
+        }
+    } catch (const gtpo::bad_format_error& e) {
+        qWarning() << "qan::Graph::saveBinary(): Error: " << e.what();
+        return false;
+    } catch (...) {
+        qWarning() << "qan::Graph::saveBinary(): Error: Unable to serialize graph.";
+        return false;
+    }
+    return true;
+}
+
+bool    Graph::loadBinary(const QString& filePath) noexcept
+{
+    // PRECONDITIONS:
+        // Default node, group and edge delegates and styles must be available
+    const auto engine = qmlEngine(this);
+    QQmlComponent* nodeComponent = _nodeDelegate ? _nodeDelegate.get() :
+                                                   (engine != nullptr ? qan::Node::delegate(*engine) : nullptr);
+    QQmlComponent* groupComponent = _groupDelegate ? _groupDelegate.get() :
+                                                     (engine != nullptr ? qan::Group::delegate(*engine) : nullptr);
+    QQmlComponent* edgeComponent = _edgeDelegate ? _edgeDelegate.get() :
+                                                   (engine != nullptr ? qan::Edge::delegate(*engine) : nullptr);
+    const auto nodeStyle = qan::Node::style(nullptr);
+    const auto groupStyle = qan::Group::style(nullptr);
+    const auto edgeStyle = qan::Edge::style(nullptr);
+    if (nodeComponent == nullptr || groupComponent == nullptr || edgeComponent == nullptr ||
+        nodeStyle == nullptr || groupStyle == nullptr || edgeStyle == nullptr) {
+        qWarning() << "qan::Graph::loadBinary(): Error: Can't find valid node, group or edge delegates and styles.";
+        return false;
+    }
+
+    // ALGORITHM:
+        // 1. Memory map file (fallback to a full read if mapping is not supported) and validate its content.
+        // 2. Bulk load topology (nodes, groups, edges and group membership), labels are set from factories.
+        // 3. Create groups and nodes items and set their geometry, then reparent grouped items.
+        // 4. Create edges items.
+        // 5. Notify user.
+    QFile file{filePath};
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "qan::Graph::loadBinary(): Error: Can't open file " << filePath;
+        return false;
+    }
+    // 1.
+    const auto size = static_cast<std::size_t>(file.size());
+    const void* data = size != 0 ? file.map(0, file.size()) : nullptr;
+    std::vector<std::uint64_t> buffer;     // Fallback storage (8 bytes aligned)
+    if (data == nullptr) {
+        buffer.resize((size + 7) / 8);
+        if (file.read(reinterpret_cast<char*>(buffer.data()), file.size()) != file.size()) {
+            qWarning() << "qan::Graph::loadBinary(): Error: Can't read file " << filePath;
+            return false;
+        }
+        data = buffer.data();
+    }
+    std::vector<WeakNode> nodes;
+    try {
+        const gtpo::binary_graph_view view{data, size};
+        auto labelOf = [&view](std::uint32_t n) {
+            return QString::fromUtf8(view.get_label_data(n), static_cast<int>(view.get_node(n).label_size));
+        };
+        // 2.
+        nodes = gtpo::load_binary_graph(static_cast<gtpo_graph_t&>(*this), view,
+                                        [&labelOf](std::uint32_t n, const gtpo::binary_node&) {
+                                            auto node = std::make_shared<qan::Node>();
+                                            QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
+                                            node->setLabel(labelOf(n));
+                                            return node;
+                                        },
+                                        [&labelOf](std::uint32_t n, const gtpo::binary_node&) {
+                                            auto group = std::make_shared<qan::Group>();
+                                            QQmlEngine::setObjectOwnership(group.get(), QQmlEngine::CppOwnership);
+                                            group->setLabel(labelOf(n));
+                                            return group;
+                                        },
+                                        [](const SharedNode&, const SharedNode&) {
+                                            auto edge = std::make_shared<qan::Edge>();
+                                            QQmlEngine::setObjectOwnership(edge.get(), QQmlEngine::CppOwnership);
+                                            return edge;
+                                        });
+
+        // 3.
+        _styleManager.setStyleComponent(nodeStyle, nodeComponent);
+        std::unordered_map<qan::Group*, std::vector<qan::NodeItem*>> groupsItems;
+        for (std::uint32_t n = 0; n < view.get_node_count(); ++n) {
+            const auto node = nodes[n].lock();
+            if (!node)
+                continue;
+            qan::NodeItem* item = nullptr;
+            if (node->is_group())
+                item = createGroupItem(*qobject_cast<qan::Group*>(node.get()), *groupComponent, *groupStyle);
+            else
+                item = createNodeItem(*node, *nodeComponent, *nodeStyle);
+            if (item == nullptr)
+                continue;
+            const auto& geometry = view.get_geometry(n);
+            item->setX(static_cast<qreal>(geometry.x));
+            item->setY(static_cast<qreal>(geometry.y));
+            if (geometry.w > 0.f && geometry.h > 0.f) {
+                item->setWidth(static_cast<qreal>(geometry.w));
+                item->setHeight(static_cast<qreal>(geometry.h));
+            }
+            item->setZ(static_cast<qreal>(geometry.z));
+            _maxZ = std::max(_maxZ, item->z());
+            const auto group = view.get_node(n).group;
+            if (group != gtpo::binary_node::no_group)
+                groupsItems[qobject_cast<qan::Group*>(nodes[group].lock().get())].push_back(item);
+        }
+        for (const auto& groupItems : groupsItems) {
+            if (groupItems.first != nullptr &&
+                groupItems.first->getGroupItem() != nullptr)
+                groupItems.first->getGroupItem()->groupNodeItems(groupItems.second, false);   // Geometry is already in group coordinates
+        }
+
+        // 4.
+        _styleManager.setStyleComponent(edgeStyle, edgeComponent);
+        for (std::uint32_t n = 0; n < view.get_node_count(); ++n) {
+            const auto node = nodes[n].lock();
+            if (!node)
+                continue;
+            for (const auto& outEdge : node->get_out_edges()) {
+                const auto edge = outEdge.lock();
+                const auto dst = edge ? edge->get_dst().lock() : nullptr;
+                if (dst &&
+                    edge->getItem() == nullptr)
+                    configureEdge(*edge, *edgeComponent, *edgeStyle, *node, dst.get());
+            }
+        }
+    } catch (const gtpo::bad_format_error& e) {
+        qWarning() << "qan::Graph::loadBinary(): Error: Invalid binary graph " << filePath << ": " << e.what();
+        return false;
+    } catch (const gtpo::bad_topology_error& e) {
+        qWarning() << "qan::Graph::loadBinary(): Error: Topology error: " << e.what();
+        return false;
+    } catch (...) {
+        qWarning() << "qan::Graph::loadBinary(): Error: Unable to load binary graph " << filePath;
+        return false;
+    }
+
+    // 5.
+    const qan::UndoStack::MacroScope macro{_undoStack, tr("Load")};
+    for (const auto& weakNode : nodes) {
+        const auto node = weakNode.lock();
+        if (!node)
+            continue;
+        onNodeInserted(*node);
+        notifyNodeInserted(node.get());
+        const auto group = qobject_cast<qan::Group*>(node->get_group().lock().get());
+        if (group != nullptr)
+            emit nodeGrouped(node.get(), group);
+        for (const auto& outEdge : node->get_out_edges()) {
+            const auto edge = outEdge.lock();
+            if (edge)
+                notifyEdgeInserted(edge.get());
+        }
+    }
+    return true;
+}
+
+int     Graph::copySelection() noexcept
+{
+    // ALGORITHM:
+        // 1. Collect selected nodes and groups, and recursively groups content (group members must be part of subgraph).
+        // 2. Compute top level items bounding rectangle origin and out edges count (edges with both ends copied).
+        // 3. Write binary graph, top level geometry is relative to origin, grouped geometry is in group coordinates.
+        // 4. Append styles and delegates references records.
+    using Subgraph = impl::BinarySubgraph<gtpo_graph_t>;
+    Subgraph subgraph;
+    std::unordered_set<const qan::Node*> copied;
+    const auto collect = [&subgraph, &copied](qan::Node* node) {
+        std::vector<qan::Node*> stack{node};
+        while (!stack.empty()) {
+            const auto top = stack.back();
+            stack.pop_back();
+            if (top == nullptr ||
+                !copied.insert(top).second)
+                continue;
+            try {
+                subgraph.nodes.push_back(std::static_pointer_cast<Config::final_node_t>(top->shared_from_this()));
+            } catch (const std::bad_weak_ptr&) { continue; }
+            if (top->is_group())
+                for (const auto& member : top->get_nodes())
+                    stack.push_back(qobject_cast<qan::Node*>(member.lock().get()));
+        }
+    };
+    // 1.
+    _selection.forEach(collect);
+    if (subgraph.nodes.empty())
+        return 0;
+
+    // 2.
+    const auto isTopLevel = [&copied](const qan::Node& node) {
+        const auto group = node.get_group().lock();
+        return !group || copied.find(group.get()) == copied.end();
+    };
+    const auto containerItem = getContainerItem();
+    const auto topLevelPosition = [containerItem](const qan::Node& node) {
+        const auto item = impl::binaryNodeItem(node);
+        if (item == nullptr)
+            return node.getGeometry().topLeft();
+        return containerItem != nullptr ? item->mapToItem(containerItem, QPointF{0., 0.}) :
+                                          item->position();
+    };
+    QPointF origin{std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::max()};
+    for (const auto& node : subgraph.nodes) {
+        if (isTopLevel(*node)) {
+            const auto position = topLevelPosition(*node);
+            origin.rx() = std::min(origin.x(), position.x());
+            origin.ry() = std::min(origin.y(), position.y());
+        }
+        for (const auto& outEdge : node->get_out_edges()) {
+            const auto edge = outEdge.lock();
+            const auto dst = edge ? edge->get_dst().lock() : nullptr;
+            if (dst &&
+                copied.find(dst.get()) != copied.end())
+                ++subgraph.edgeCount;
+        }
+    }
+
+    // 3.
+    std::vector<QPointer<QObject>> references;
+    std::unordered_map<const QObject*, std::uint32_t> referencesIndex;
+    const auto reference = [&references, &referencesIndex](const QObject* object) {
+        if (object == nullptr)
+            return impl::BinaryReferences::noReference;
+        const auto index = referencesIndex.emplace(object, static_cast<std::uint32_t>(references.size()));
+        if (index.second)
+            references.push_back(const_cast<QObject*>(object));
+        return index.first->second;
+    };
+    const auto componentOf = [this](const QObject* primitive, const QQuickItem* item) -> const QQmlComponent* {
+        const auto itemComponent = item != nullptr ? _itemComponents.find(item) : _itemComponents.end();
+        if (itemComponent != _itemComponents.end())
+            return itemComponent->second.component.data();
+        const auto delegate = _virtualDelegates.find(primitive);
+        return delegate != _virtualDelegates.end() ? delegate->second.component.data() : nullptr;
+    };
+    std::vector<impl::BinaryReferences> nodesReferences;
+    std::vector<impl::BinaryReferences> edgesReferences;
+    nodesReferences.reserve(subgraph.nodes.size());
+    edgesReferences.reserve(static_cast<std::size_t>(subgraph.edgeCount));
+    std::string data;
+    try {
+        std::ostringstream os{std::ios::out | std::ios::binary};
+        gtpo::write_binary_graph(subgraph, os,
+                                 [&isTopLevel, &topLevelPosition, &origin](const qan::Node& node) noexcept {
+                                     gtpo::binary_geometry geometry;
+                                     const auto item = impl::binaryNodeItem(node);
+                                     const auto nodeGeometry = item != nullptr ? QRectF{item->position(), QSizeF{item->width(), item->height()}} :
+                                                                                 node.getGeometry();
+                                     const auto position = isTopLevel(node) ? topLevelPosition(node) - origin :
+                                                                              nodeGeometry.topLeft();
+                                     geometry.x = static_cast<float>(position.x());
+                                     geometry.y = static_cast<float>(position.y());
+                                     geometry.w = static_cast<float>(nodeGeometry.width());
+                                     geometry.h = static_cast<float>(nodeGeometry.height());
+                                     geometry.z = item != nullptr ? static_cast<float>(item->z()) : 0.f;
+                                     return geometry;
+                                 },
+                                 [](const qan::Node& node) {
+                                     return node.getLabel().toStdString();
+                                 });
+        data = os.str();
+    } catch (...) {
+        qWarning() << "qan::Graph::copySelection(): Error: Unable to serialize selection.";
+        return 0;
+    }
+    // 4. Note: records follow gtpo::write_binary_graph() node and CSR out edges order
+    for (const auto& node : subgraph.nodes) {
+        impl::BinaryReferences nodeReferences;
+        nodeReferences.style = reference(getNodeStyle(*node));
+        nodeReferences.component = reference(componentOf(node.get(), impl::binaryNodeItem(*node)));
+        nodesReferences.push_back(nodeReferences);
+        for (const auto& outEdge : node->get_out_edges()) {
+            const auto edge = outEdge.lock();
+            const auto dst = edge ? edge->get_dst().lock() : nullptr;
+            if (!dst ||
+                copied.find(dst.get()) == copied.end())
+                continue;
+            impl::BinaryReferences edgeReferences;
+            edgeReferences.style = reference(getEdgeStyle(*edge));
+            edgeReferences.component = reference(componentOf(edge.get(), edge->getItem()));
+            edgesReferences.push_back(edgeReferences);
+        }
+    }
+    const auto referencesOffset = (data.size() + 7) & ~std::size_t{7};
+    const auto referencesSize = (nodesReferences.size() + edgesReferences.size()) * sizeof(impl::BinaryReferences);
+    _clipboardSize = referencesOffset + referencesSize;
+    _clipboard.assign((_clipboardSize + 7) / 8, 0);
+    auto buffer = reinterpret_cast<char*>(_clipboard.data());
+    std::memcpy(buffer, data.data(), data.size());
+    std::memcpy(buffer + referencesOffset, nodesReferences.data(), nodesReferences.size() * sizeof(impl::BinaryReferences));
+    std::memcpy(buffer + referencesOffset + nodesReferences.size() * sizeof(impl::BinaryReferences),
+                edgesReferences.data(), edgesReferences.size() * sizeof(impl::BinaryReferences));
+    _clipboardReferences = std::move(references);
+    _clipboardCount = static_cast<int>(subgraph.nodes.size());
+    emit clipboardChanged();
+    return _clipboardCount;
+}
+
+int     Graph::pasteSubgraph(QPointF at) noexcept
+{
+    // PRECONDITIONS:
+        // Clipboard must not be empty
+        // Default node, group and edge delegates and styles must be available
+    if (_clipboardCount == 0)
+        return 0;
+    const auto engine = qmlEngine(this);
+    QQmlComponent* nodeComponent = _nodeDelegate ? _nodeDelegate.get() :
+                                                   (engine != nullptr ? qan::Node::delegate(*engine) : nullptr);
+    QQmlComponent* groupComponent = _groupDelegate ? _groupDelegate.get() :
+                                                     (engine != nullptr ? qan::Group::delegate(*engine) : nullptr);
+    QQmlComponent* edgeComponent = _edgeDelegate ? _edgeDelegate.get() :
+                                                   (engine != nullptr ? qan::Edge::delegate(*engine) : nullptr);
+    const auto nodeStyle = qan::Node::style(nullptr);
+    const auto groupStyle = qan::Group::style(nullptr);
+    const auto edgeStyle = qan::Edge::style(nullptr);
+    if (nodeComponent == nullptr || groupComponent == nullptr || edgeComponent == nullptr ||
+        nodeStyle == nullptr || groupStyle == nullptr || edgeStyle == nullptr) {
+        qWarning() << "qan::Graph::pasteSubgraph(): Error: Can't find valid node, group or edge delegates and styles.";
+        return 0;
+    }
+    const auto referenced = [this](std::uint32_t index) -> QObject* {
+        return index < _clipboardReferences.size() ? _clipboardReferences[index].data() : nullptr;
+    };
+    const auto referencedComponent = [&referenced](std::uint32_t index, QQmlComponent* defaultComponent) {
+        const auto component = qobject_cast<QQmlComponent*>(referenced(index));
+        return component != nullptr ? component : defaultComponent;
+    };
+
+    // ALGORITHM:
+        // 1. Bulk load clipboard topology (same path than loadBinary()).
+        // 2. Create groups and nodes items from copied delegates and styles, translate top level items to \c at and
+        //    stack them over existing items, then reparent grouped items.
+        // 3. Create edges items.
+        // 4. Notify user and select pasted top level nodes and groups.
+    const qan::UndoStack::MacroScope macro{_undoStack, tr("Paste")};
+    beginUpdate();
+    std::vector<WeakNode> nodes;
+    try {
+        const gtpo::binary_graph_view view{_clipboard.data(), _clipboardSize};
+        const auto referencesOffset = impl::binaryReferencesOffset(view.get_header());
+        if (referencesOffset + (static_cast<std::size_t>(view.get_node_count()) + view.get_edge_count()) *
+                               sizeof(impl::BinaryReferences) > _clipboardSize)
+            throw gtpo::bad_format_error{"Invalid references table."};
+        const auto nodesReferences = reinterpret_cast<const impl::BinaryReferences*>(
+                                        reinterpret_cast<const char*>(_clipboard.data()) + referencesOffset);
+        const auto edgesReferences = nodesReferences + view.get_node_count();
+        auto labelOf = [&view](std::uint32_t n) {
+            return QString::fromUtf8(view.get_label_data(n), static_cast<int>(view.get_node(n).label_size));
+        };
+        // 1.
+        nodes = gtpo::load_binary_graph(static_cast<gtpo_graph_t&>(*this), view,
+                                        [&labelOf](std::uint32_t n, const gtpo::binary_node&) {
+                                            auto node = std::make_shared<qan::Node>();
+                                            QQmlEngine::setObjectOwnership(node.get(), QQmlEngine::CppOwnership);
+                                            node->setLabel(labelOf(n));
+                                            return node;
+                                        },
+                                        [&labelOf](std::uint32_t n, const gtpo::binary_node&) {
+                                            auto group = std::make_shared<qan::Group>();
+                                            QQmlEngine::setObjectOwnership(group.get(), QQmlEngine::CppOwnership);
+                                            group->setLabel(labelOf(n));
+                                            return group;
+                                        },
+                                        [](const SharedNode&, const SharedNode&) {
+                                            auto edge = std::make_shared<qan::Edge>();
+                                            QQmlEngine::setObjectOwnership(edge.get(), QQmlEngine::CppOwnership);
+                                            return edge;
+                                        });
+
+        // 2.
+        _styleManager.setStyleComponent(nodeStyle, nodeComponent);
+        auto minZ = std::numeric_limits<qreal>::max();
+        for (std::uint32_t n = 0; n < view.get_node_count(); ++n)
+            if (view.get_node(n).group == gtpo::binary_node::no_group)
+                minZ = std::min(minZ, static_cast<qreal>(view.get_geometry(n).z));
+        const auto zOffset = _maxZ + 1. - minZ;
+        auto maxZ = _maxZ;
+        std::unordered_map<qan::Group*, std::vector<qan::NodeItem*>> groupsItems;
+        for (std::uint32_t n = 0; n < view.get_node_count(); ++n) {
+            const auto node = nodes[n].lock();
+            if (!node)
+                continue;
+            const auto& references = nodesReferences[n];
+            const auto style = qobject_cast<qan::NodeStyle*>(referenced(references.style));
+            qan::NodeItem* item = nullptr;
+            if (node->is_group())
+                item = createGroupItem(*qobject_cast<qan::Group*>(node.get()),
+                                       *referencedComponent(references.component, groupComponent),
+                                       style != nullptr ? *style : *groupStyle);
+            else
+                item = createNodeItem(*node, *referencedComponent(references.component, nodeComponent),
+                                      style != nullptr ? *style : *nodeStyle);
+            if (item == nullptr)
+                continue;
+            const auto& geometry = view.get_geometry(n);
+            const auto group = view.get_node(n).group;
+            const auto topLevel = group == gtpo::binary_node::no_group;
+            const QPointF position{static_cast<qreal>(geometry.x), static_cast<qreal>(geometry.y)};
+            item->setPosition(topLevel ? at + position : position);
+            if (geometry.w > 0.f && geometry.h > 0.f) {
+                item->setWidth(static_cast<qreal>(geometry.w));
+                item->setHeight(static_cast<qreal>(geometry.h));
+            }
+            item->setZ(topLevel ? static_cast<qreal>(geometry.z) + zOffset : static_cast<qreal>(geometry.z));
+            if (topLevel)
+                maxZ = std::max(maxZ, item->z());
+            else
+                groupsItems[qobject_cast<qan::Group*>(nodes[group].lock().get())].push_back(item);
+        }
+        for (const auto& groupItems : groupsItems) {
+            if (groupItems.first != nullptr &&
+                groupItems.first->getGroupItem() != nullptr)
+                groupItems.first->getGroupItem()->groupNodeItems(groupItems.second, false);   // Geometry is already in group coordinates
+        }
+        setMaxZ(maxZ);      // Note: maxZChanged() is emitted once in endUpdate()
+
+        // 3.
+        _styleManager.setStyleComponent(edgeStyle, edgeComponent);
+        std::uint32_t e = 0;
+        for (std::uint32_t n = 0; n < view.get_node_count(); ++n) {
+            const auto node = nodes[n].lock();
+            if (!node)
+                continue;
+            for (const auto& outEdge : node->get_out_edges()) {
+                const auto edge = outEdge.lock();
+                const auto dst = edge ? edge->get_dst().lock() : nullptr;
+                if (!dst ||
+                    edge->getItem() != nullptr)
+                    continue;
+                const auto references = e < view.get_edge_count() ? edgesReferences[e++] : impl::BinaryReferences{};
+                const auto style = qobject_cast<qan::EdgeStyle*>(referenced(references.style));
+                configureEdge(*edge, referencedComponent(references.component, edgeComponent),
+                              style != nullptr ? *style : *edgeStyle, *node, dst.get());
+            }
+        }
+    } catch (const gtpo::bad_format_error& e) {
+        qWarning() << "qan::Graph::pasteSubgraph(): Error: Invalid clipboard content: " << e.what();
+        endUpdate();
+        return 0;
+    } catch (const gtpo::bad_topology_error& e) {
+        qWarning() << "qan::Graph::pasteSubgraph(): Error: Topology error: " << e.what();
+        endUpdate();
+        return 0;
+    } catch (...) {
+        qWarning() << "qan::Graph::pasteSubgraph(): Error: Unable to paste clipboard content.";
+        endUpdate();
+        return 0;
+    }
+
+    // 4.
+    std::vector<qan::Node*> selectedNodes;
+    std::vector<qan::Group*> selectedGroups;
+    for (const auto& weakNode : nodes) {
+        const auto node = weakNode.lock();
+        if (!node)
+            continue;
+        onNodeInserted(*node);
+        notifyNodeInserted(node.get());
+        const auto group = qobject_cast<qan::Group*>(node->get_group().lock().get());
+        if (group != nullptr)
+            emit nodeGrouped(node.get(), group);
+        else if (node->is_group())
+            selectedGroups.push_back(qobject_cast<qan::Group*>(node.get()));
+        else
+            selectedNodes.push_back(node.get());
+        for (const auto& outEdge : node->get_out_edges()) {
+            const auto edge = outEdge.lock();
+            if (edge)
+                notifyEdgeInserted(edge.get());
+        }
+    }
+    if (getSelectionPolicy() != SelectionPolicy::NoSelection) {
+        clearSelection();
+        setNodesSelected(selectedNodes, true);
+        for (const auto group : selectedGroups)
+            if (group != nullptr)
+                addToSelection(*group);
+    }
+    endUpdate();
+    return static_cast<int>(nodes.size());
+}
+
+qan::NodeItem*  Graph::createNodeItem(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle)
+{
+    const auto nodeItem = static_cast<qan::NodeItem*>(createFromComponent(&nodeComponent, nodeStyle, &node));
+    if (nodeItem == nullptr)
+        return nullptr;
+    nodeItem->setNode(&node);
+    nodeItem->setGraph(this);
+    node.setItem(nodeItem);
+    auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeClicked(nodeItem->getNode(), p);
+    };
+    connect( nodeItem, &qan::NodeItem::nodeClicked, this, notifyNodeClicked );
+
+    auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeRightClicked(nodeItem->getNode(), p);
+    };
+    connect( nodeItem, &qan::NodeItem::nodeRightClicked, this, notifyNodeRightClicked );
+
+    auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeDoubleClicked(nodeItem->getNode(), p);
+    };
+    connect( nodeItem, &qan::NodeItem::nodeDoubleClicked, this, notifyNodeDoubleClicked );
+    return nodeItem;
+}
+
+qan::GroupItem* Graph::createGroupItem(qan::Group& group, QQmlComponent& groupComponent, qan::NodeStyle& groupStyle)
+{
+    const auto groupItem = static_cast<qan::GroupItem*>(createFromComponent(&groupComponent, groupStyle,
+                                                                             nullptr, nullptr, &group));
+    if (groupItem == nullptr)
+        return nullptr;
+    groupItem->setGroup(&group);
+    groupItem->setGraph(this);
+    group.setItem(groupItem);
+
+    auto notifyGroupClicked = [this] (qan::GroupItem* groupItem, QPointF p) {
+        if (groupItem != nullptr && groupItem->getGroup() != nullptr)
+            emit this->groupClicked(groupItem->getGroup(), p);
+    };
+    connect( groupItem, &qan::GroupItem::groupClicked, this, notifyGroupClicked );
+
+    auto notifyGroupRightClicked = [this] (qan::GroupItem* groupItem, QPointF p) {
+        if (groupItem != nullptr && groupItem->getGroup() != nullptr)
+            emit this->groupRightClicked(groupItem->getGroup(), p);
+    };
+    connect( groupItem, &qan::GroupItem::groupRightClicked, this, notifyGroupRightClicked );
+
+    auto notifyGroupDoubleClicked = [this] (qan::GroupItem* groupItem, QPointF p) {
+        if (groupItem != nullptr && groupItem->getGroup() != nullptr)
+            emit this->groupDoubleClicked(groupItem->getGroup(), p);
+    };
+    connect( groupItem, &qan::GroupItem::groupDoubleClicked, this, notifyGroupDoubleClicked );
+    return groupItem;
+}
 //-----------------------------------------------------------------------------
 
 
@@ -1091,17 +4400,75 @@ void    Graph::setSelectionMargin( qreal selectionMargin ) noexcept
     }
 }
 
+void    Graph::setSelectionOverlay( bool selectionOverlay ) noexcept
+{
+    if ( selectionOverlay == _selectionOverlay )
+        return;
+    _selectionOverlay = selectionOverlay;
+    if ( _selectionOverlay ) {
+        _selectionOverlayItem = new qan::SelectionOverlay{*this, getContainerItem()};
+        _selectionOverlayItem->setZ(std::numeric_limits<qreal>::max());    // Above nodes and groups
+        QQmlEngine::setObjectOwnership(_selectionOverlayItem.data(), QQmlEngine::CppOwnership);
+    } else if ( _selectionOverlayItem )
+        _selectionOverlayItem->deleteLater();
+    // Hide (or show) existing selection items of actually selected primitives
+    _selection.forEach([this](qan::Node* node) {
+        if ( node->getItem() != nullptr &&
+             node->getItem()->getSelectionItem() != nullptr )
+            node->getItem()->getSelectionItem()->setVisible(!_selectionOverlay);
+    });
+    if ( !_selectionOverlay )
+        configureSelectionItems();
+    emit selectionOverlayChanged();
+}
+
 void    Graph::configureSelectionItems() noexcept
 {
     // PRECONDITIONS: None
-    for ( auto node : _selectedNodes )
-        if ( node != nullptr &&
-             node->getItem() != nullptr )
+    if ( _selectionOverlay ) {      // Selection items are not used, overlay is rebuilt on next frame
+        if ( _selectionOverlayItem )
+            _selectionOverlayItem->invalidate();
+        return;
+    }
+    _selection.forEach([](qan::Node* node) {
+        if ( node->getItem() != nullptr )
             node->getItem()->configureSelectionItem();
-    for ( auto group : _selectedGroups )
-        if ( group != nullptr &&
-             group->getItem() != nullptr )
-            group->getItem()->configureSelectionItem();
+    });
+}
+
+void    Graph::scheduleSelectionUpdate() noexcept
+{
+    _selectionModelsDirty = true;
+    if ( _selectionUpdatePending )
+        return;
+    _selectionUpdatePending = true;
+    QTimer::singleShot(0, this, [this]() {
+        _selectionUpdatePending = false;
+        syncSelectionModels();
+        if ( _selection.takeDelta(_selectionDelta) )
+            emit selectionModified(_selectionDelta);
+    });
+}
+
+void    Graph::syncSelectionModels() const noexcept
+{
+    if ( !_selectionModelsDirty )
+        return;
+    _selectionModelsDirty = false;
+    std::vector<qan::Node*> nodes;
+    std::vector<qan::Group*> groups;
+    nodes.reserve(_selection.size());
+    _selection.forEachInSelectionOrder([&nodes, &groups](qan::Node* node) {
+        if ( node->is_group() )
+            groups.push_back(static_cast<qan::Group*>(node));
+        else
+            nodes.push_back(node);
+    });
+    // Note: qcm::Container::clear() and append() of a range trigger a single model reset and rows insertion
+    _selectedNodes.clear();
+    _selectedNodes.append(nodes.cbegin(), nodes.cend());
+    _selectedGroups.clear();
+    _selectedGroups.append(groups.cbegin(), groups.cend());
 }
 
 namespace impl { // qan::impl
@@ -1175,106 +4542,166 @@ void    Graph::setNodeSelected(qan::Node* node, bool selected)
         impl::setPrimitiveSelected<qan::Node>(*node, selected, *this);
 }
 
-bool    Graph::selectGroup(qan::Group& group, Qt::KeyboardModifiers modifiers) { return impl::selectPrimitive<qan::Group>(group, modifiers, *this); }
+void    Graph::setNodesSelected(const std::vector<qan::Node*>& nodes, bool selected)
+{
+    if (selected) {
+        for (const auto node : nodes)
+            if (node != nullptr &&
+                node->getItem() != nullptr &&
+                _selection.insert(*node))
+                selectItem(*node);
+    } else {
+        // Note: Nodes are removed from selection before their items are unselected, removeFromSelection()
+        // called from qan::Selectable::setSelected() is then a no-op O(1) lookup.
+        for (const auto node : nodes)
+            if (node != nullptr &&
+                _selection.remove(*node) &&
+                node->getItem() != nullptr)
+                node->getItem()->setSelected(false);
+    }
+    scheduleSelectionUpdate();
+}
 
-template < class Primitive_t >
-void    addToSelectionImpl( Primitive_t& primitive,
-                            qcm::Container< QVector, Primitive_t* >& selectedPrimitives,
-                            qan::Graph& graph )
+void    Graph::selectAll()
 {
-    if ( !selectedPrimitives.contains( &primitive ) ) {
-        selectedPrimitives.append( &primitive );
-        if ( primitive.getItem() != nullptr ) {
-            // Eventually, create and configure node item selection item
-            if ( primitive.getItem()->getSelectionItem() == nullptr )
-                primitive.getItem()->setSelectionItem(graph.createSelectionItem(primitive.getItem()).data());   // Safe, any argument might be nullptr
-            primitive.getItem()->configureSelectionItem();
-            primitive.getItem()->setSelected(true);
-        }
+    if (getSelectionPolicy() == SelectionPolicy::NoSelection)
+        return;
+    for (const auto& node : get_nodes())
+        if (node &&
+            !node->is_group() &&
+            _selection.insert(*node) &&
+            node->getItem() != nullptr)
+            selectItem(*node);
+    scheduleSelectionUpdate();
+}
+
+void    Graph::invertSelection()
+{
+    if (getSelectionPolicy() == SelectionPolicy::NoSelection)
+        return;
+    for (const auto& node : get_nodes()) {
+        if (!node)
+            continue;
+        if (_selection.remove(*node)) {
+            if (node->getItem() != nullptr)
+                node->getItem()->setSelected(false);
+        } else if (!node->is_group() &&
+                   _selection.insert(*node) &&
+                   node->getItem() != nullptr)
+            selectItem(*node);
+    }
+    scheduleSelectionUpdate();
+}
+
+void    Graph::selectItem(qan::Node& node) noexcept
+{
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return;
+    if (!_selectionOverlay) {   // Eventually, create and configure node item selection item
+        if (nodeItem->getSelectionItem() == nullptr)
+            nodeItem->setSelectionItem(createSelectionItem(nodeItem).data());   // Safe, any argument might be nullptr
+        nodeItem->configureSelectionItem();
     }
+    nodeItem->setSelected(true);    // Only selected flag is set when selection is drawn by graph overlay
 }
 
-void    Graph::addToSelection( qan::Node& node ) { addToSelectionImpl<qan::Node>(node, _selectedNodes, *this); }
-void    Graph::addToSelection( qan::Group& group ) { addToSelectionImpl<qan::Group>(group, _selectedGroups, *this); }
+bool    Graph::selectGroup(qan::Group& group, Qt::KeyboardModifiers modifiers) { return impl::selectPrimitive<qan::Group>(group, modifiers, *this); }
 
-template < class Primitive_t >
-void    removeFromSelectionImpl( Primitive_t& primitive,
-                             qcm::Container< QVector, Primitive_t* >& selectedPrimitives )
+void    Graph::addToSelection( qan::Node& node )
 {
-    if ( selectedPrimitives.contains( &primitive ) )
-        selectedPrimitives.removeAll( &primitive );
+    if ( _selection.insert(node) ) {
+        selectItem(node);
+        scheduleSelectionUpdate();
+    }
 }
+void    Graph::addToSelection( qan::Group& group ) { addToSelection(static_cast<qan::Node&>(group)); }
 
-void    Graph::removeFromSelection( qan::Node& node ) { removeFromSelectionImpl<qan::Node>(node, _selectedNodes); }
-void    Graph::removeFromSelection( qan::Group& group ) { removeFromSelectionImpl<qan::Group>(group, _selectedGroups); }
+void    Graph::removeFromSelection( qan::Node& node )
+{
+    if ( _selection.remove(node) )
+        scheduleSelectionUpdate();
+}
+void    Graph::removeFromSelection( qan::Group& group ) { removeFromSelection(static_cast<qan::Node&>(group)); }
 
-// Note: Called from
+// Note: Called from qan::Selectable::setSelected()
 void    Graph::removeFromSelection( QQuickItem* item ) {
-    const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(item);  // Note: qan::GroupItem is a qan::NodeItem
     if ( nodeItem != nullptr &&
-         nodeItem->getNode() != nullptr ) {
-        _selectedNodes.removeAll(nodeItem->getNode());
-        //nodeItem->setSelected(false);
-    } else {
-        const auto groupItem = qobject_cast<qan::GroupItem*>(item);
-        if ( groupItem != nullptr &&
-             groupItem->getGroup() != nullptr ) {
-            _selectedGroups.removeAll(groupItem->getGroup());
-        }
-    }
+         nodeItem->getNode() != nullptr )
+        removeFromSelection(*nodeItem->getNode());
 }
 
 void    Graph::removeSelection()
 {
-    const auto& selectedNodes = getSelectedNodes();
-    for (const auto node: qAsConst(selectedNodes))
-        removeNode(node);
-    const auto& selectedGroups = getSelectedGroups();
-    for (const auto group: qAsConst(selectedGroups))
+    // Selected nodes are removed in a single gtpo::graph<>::remove_nodes() batch, calling
+    // removeNode() for each node is quadratic in the number of selected nodes edges.
+    std::vector<qan::Node*> nodes;
+    std::vector<qan::Group*> selectedGroups;
+    _selection.forEach([&nodes, &selectedGroups](qan::Node* node) {
+        if (node->is_group())
+            selectedGroups.push_back(static_cast<qan::Group*>(node));
+        else
+            nodes.push_back(node);
+    });
+    // Selection removal is recorded as a single undo entry, adjacent edges removal is recorded before nodes removal
+    const qan::UndoStack::MacroScope macro{_undoStack, tr("Remove selection")};
+    if (_undoStack.isRecording()) {
+        std::unordered_set<const qan::Edge*> recordedEdges;    // Note: Edges between selected nodes are recorded once
+        for (const auto node: nodes)
+            node->forEachAdjacentEdge0([this, &recordedEdges](qan::Edge* edge) {
+                if (recordedEdges.insert(edge).second)
+                    _undoStack.recordRemoveEdge(*edge);
+            });
+        for (const auto node: nodes)
+            _undoStack.recordRemoveNode(*node);
+    }
+    std::vector<gtpo_graph_t::weak_node_t> selectedNodes;
+    selectedNodes.reserve(nodes.size());
+    for (const auto node: nodes) {
+        try {
+            selectedNodes.push_back(std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()));
+            prepareNodeRemoval(*node);
+        } catch ( std::bad_weak_ptr ) {
+            qWarning() << "qan::Graph::removeSelection(): Internal error for node " << node;
+        }
+    }
+    try {
+        gtpo_graph_t::remove_nodes(selectedNodes.cbegin(), selectedNodes.cend());
+    } catch ( const gtpo::bad_topology_error& e ) {
+        qWarning() << "qan::Graph::removeSelection(): Error: " << e.what();
+    }
+    for (const auto group: selectedGroups)
         removeGroup(group);
     clearSelection();
 }
 
 void    Graph::clearSelection()
 {
-    // Note: getItem()->setSelected() actually _modify_ content
-    // of _selectedNodes and _selectedGroups, a deep copy of theses
-    // container is necessary to avoid iterating on a vector that
-    // has changed while iterator has been modified.
-    SelectedNodes selectedNodesCopy;
-    std::copy( _selectedNodes.cbegin(),
-                _selectedNodes.cend(),
-                std::back_inserter(selectedNodesCopy) );
-    for (auto node : selectedNodesCopy)
-        if (node != nullptr &&
-            node->getItem() != nullptr)
-            node->getItem()->setSelected(false);
-    _selectedNodes.clear();
-
-    SelectedGroups selectedGroupsCopy;
-    std::copy( _selectedGroups.cbegin(),
-                _selectedGroups.cend(),
-                std::back_inserter(selectedGroupsCopy) );
-    for ( auto group : selectedGroupsCopy )
-        if ( group != nullptr &&
-             group->getItem() != nullptr )
-            group->getItem()->setSelected(false);
-    _selectedGroups.clear();
+    if ( _selection.empty() )
+        return;
+    // Note: getItem()->setSelected() call removeFromSelection(), items are collected before
+    // selection is cleared, removeFromSelection() is then a no-op O(1) lookup.
+    std::vector<qan::NodeItem*> selectedItems;
+    _selection.forEach([&selectedItems](qan::Node* node) {
+        if ( node->getItem() != nullptr )
+            selectedItems.push_back(node->getItem());
+    });
+    _selection.clear();
+    for ( const auto item : selectedItems )
+        item->setSelected(false);
+    scheduleSelectionUpdate();
 }
 
 std::vector<QQuickItem*>    Graph::getSelectedItems() const
 {
     using item_vector_t = std::vector<QQuickItem*>;
     item_vector_t items;
-    items.reserve(static_cast<item_vector_t::size_type>(_selectedNodes.size() + _selectedGroups.size()));
-    for (const auto& selectedNode: _selectedNodes) {
-        if (selectedNode->getItem() != nullptr)
-            items.push_back(selectedNode->getItem());
-    }
-    for (const auto& selectedGroup: _selectedGroups) {
-        if (selectedGroup->getItem() != nullptr)
-            items.push_back(selectedGroup->getItem());
-    }
+    items.reserve(_selection.size());
+    _selection.forEach([&items](qan::Node* node) {
+        if (node->getItem() != nullptr)
+            items.push_back(node->getItem());
+    });
     return items;   // Expect RVA
 }
 //-----------------------------------------------------------------------------
@@ -1300,27 +4727,28 @@ void    Graph::alignHorizontalCenter(std::vector<QQuickItem*>&& items)
         // Get min left and max right.
         // Compute center of min left and max right
         // Align all items on this center
-    qreal maxRight = std::numeric_limits<qreal>::min();
+    qreal maxRight = std::numeric_limits<qreal>::lowest();
     qreal minLeft = std::numeric_limits<qreal>::max();
     for (const auto item: items) {
         maxRight = std::max(maxRight, item->x() + item->width());
         minLeft = std::min(minLeft, item->x());
     }
-
-    qreal center = minLeft + (maxRight - minLeft) / 2.;
-    for (auto item: items)
-        item->setX(center - (item->width() / 2.));
+    const qreal center = minLeft + (maxRight - minLeft) / 2.;
+    moveAlignedItems(items, [center](const QQuickItem& item) {
+        return QPointF{center - (item.width() / 2.), item.y()};
+    });
 }
 
 void    Graph::alignRight(std::vector<QQuickItem*>&& items)
 {
     if (items.size() <= 1)
         return;
-    qreal maxRight = std::numeric_limits<qreal>::min();
+    qreal maxRight = std::numeric_limits<qreal>::lowest();
     for (const auto item: items)
         maxRight = std::max(maxRight, item->x() + item->width());
-    for (auto item: items)
-        item->setX(maxRight - item->width());
+    moveAlignedItems(items, [maxRight](const QQuickItem& item) {
+        return QPointF{maxRight - item.width(), item.y()};
+    });
 }
 
 void    Graph::alignLeft(std::vector<QQuickItem*>&& items)
@@ -1330,8 +4758,9 @@ void    Graph::alignLeft(std::vector<QQuickItem*>&& items)
     qreal minLeft = std::numeric_limits<qreal>::max();
     for (const auto item: items)
         minLeft = std::min(minLeft, item->x());
-    for (auto item: items)
-        item->setX(minLeft);
+    moveAlignedItems(items, [minLeft](const QQuickItem& item) {
+        return QPointF{minLeft, item.y()};
+    });
 }
 
 void    Graph::alignTop(std::vector<QQuickItem*>&& items)
@@ -1341,19 +4770,53 @@ void    Graph::alignTop(std::vector<QQuickItem*>&& items)
     qreal minTop = std::numeric_limits<qreal>::max();
     for (const auto item: items)
         minTop = std::min(minTop, item->y());
-    for (auto item: items)
-        item->setY(minTop);
+    moveAlignedItems(items, [minTop](const QQuickItem& item) {
+        return QPointF{item.x(), minTop};
+    });
 }
 
 void    Graph::alignBottom(std::vector<QQuickItem*>&& items)
 {
     if (items.size() <= 1)
         return;
-    qreal maxBottom = std::numeric_limits<qreal>::min();
+    qreal maxBottom = std::numeric_limits<qreal>::lowest();
     for (const auto item: items)
         maxBottom = std::max(maxBottom, item->y() + item->height());
-    for (auto item: items)
-        item->setY(maxBottom - item->height());
+    moveAlignedItems(items, [maxBottom](const QQuickItem& item) {
+        return QPointF{item.x(), maxBottom - item.height()};
+    });
+}
+
+void    Graph::moveAlignedItems(const std::vector<QQuickItem*>& items,
+                                const std::function<QPointF(const QQuickItem&)>& position) noexcept
+{
+    // ALGORITHM:
+        // 1. Write all positions in a single update transaction (one undo entry, edges are not updated per item).
+        // 2. Update dirty edges once in endUpdate().
+        // 3. Notify moved nodes with a single nodesMoved() signal.
+    const qan::UndoStack::MacroScope macro{_undoStack, tr("Align")};
+    QObjectList movedNodes;
+    movedNodes.reserve(static_cast<int>(items.size()));
+    beginUpdate();
+    for (const auto item : items) {     // 1.
+        if (item == nullptr)
+            continue;
+        const auto target = position(*item);
+        const auto delta = target - item->position();
+        if (delta.isNull())
+            continue;
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        const auto node = nodeItem != nullptr ? nodeItem->getNode() : nullptr;
+        if (node != nullptr) {
+            if (_undoStack.isRecording())
+                _undoStack.recordMove(*node, delta);
+            movedNodes.append(node);
+        }
+        item->setPosition(target);
+    }
+    endUpdate();                        // 2.
+    if (!movedNodes.isEmpty())          // 3.
+        emit nodesMoved(movedNodes);
 }
 //-----------------------------------------------------------------------------
 
@@ -1406,21 +4869,30 @@ qan::PortItem*  Graph::insertPort(qan::Node* node,
             connect( portItem, &qan::NodeItem::nodeRightClicked, notifyPortRightClicked );
 
             if ( node->getItem() != nullptr ) {
+                const auto nodeItem = node->getItem();
                 portItem->setNode(node); // portitem node in fact map to this concrete node.
-                node->getItem()->getPorts().append(portItem);
-                auto dockItem = node->getItem()->getDock(dockType);
-                if ( dockItem == nullptr ) {
+                nodeItem->getPorts().append(portItem);
+                nodeItem->indexPort(*portItem);
+                const auto nativeDock = nodeItem->getNativeDockLayout();
+                auto dockItem = nativeDock ? nullptr : nodeItem->getDock(dockType);
+                if ( dockItem == nullptr &&
+                     !nativeDock ) {
                     // Create a dock item from the default dock delegate
                     dockItem = createDockFromDelegate(dockType, *node);
                     if ( dockItem != nullptr )
-                        node->getItem()->setDock(dockType, dockItem);
+                        nodeItem->setDock(dockType, dockItem);
                 }
                 if ( dockItem != nullptr )
                     portItem->setParentItem(dockItem);
                 else {
-                    portItem->setParentItem(node->getItem());
+                    portItem->setParentItem(nodeItem);
                     portItem->setZ(1.5);    // 1.5 because port item should be on top of selection item and under node resizer (selection item z=1.0, resizer z=2.0)
                 }
+                // Native docks are laid out again when a port is inserted or resized (see qan::NodeItem::nativeDockLayout)
+                connect( portItem, &QQuickItem::widthChanged,   nodeItem, &qan::NodeItem::invalidateDockLayout );
+                connect( portItem, &QQuickItem::heightChanged,  nodeItem, &qan::NodeItem::invalidateDockLayout );
+                nodeItem->invalidateDockLayout();
+                indexItem(portItem);        // Index port for connector drop target resolution (see portAt())
             }
         }
     }
@@ -1449,6 +4921,9 @@ void    Graph::removePort(qan::Node* node, qan::PortItem* port) noexcept
     auto& ports = node->getItem()->getPorts();
     if (ports.contains(port))
         ports.removeAll(port);
+    node->getItem()->unindexPort(*port);
+    disconnect(port, nullptr, node->getItem(), nullptr);
+    node->getItem()->invalidateDockLayout();
     port->deleteLater();        // Note: port is owned by ports qcm::Container
 }
 
@@ -1566,12 +5041,16 @@ void    Graph::sendToFront(QQuickItem* item)
         return;
     }
 
+    // Note: edges adjacent to a raised item are restacked by qan::EdgeItem::updateZSlot(), edges adjacent to
+    // raised group content are explicitely restacked (see scheduleEdgesRestack()), their geometry is not updated.
+    qan::GroupItem* raisedGroupItem = nullptr;
     if (nodeItem != nullptr &&      // 1. If item is an ungrouped node OR a root group: update maxZ and set item.z to maxZ.
         groupItem == nullptr) {
         nodeItem->setZ(nextMaxZ());
     } else if (groupItem != nullptr &&      // 1.
                groupItem->parentItem() == graphContainerItem ) {
         groupItem->setZ(nextMaxZ());
+        raisedGroupItem = groupItem;
     } else if (groupItem != nullptr) {
         // 2. If item is a group (or is a node inside a group)
         const auto groups = collectGroups_rec(groupItem);       // 2.1 Collect all parents groups.
@@ -1588,12 +5067,64 @@ void    Graph::sendToFront(QQuickItem* item)
                 updateMaxZ(maxZ + 1.);
                 groupItem->setZ(maxZ + 1.);
             }
+            raisedGroupItem = groupItem;        // Outer raised group content includes inner groups
         } // For all group items
     }
+    if (raisedGroupItem != nullptr &&
+        raisedGroupItem->getGroup() != nullptr)
+        scheduleEdgesRestack(*raisedGroupItem->getGroup());
+}
+
+void    Graph::scheduleEdgeItemRestack(qan::EdgeItem* edgeItem) noexcept
+{
+    if (edgeItem == nullptr ||
+        !_restackEdgeItemsSet.insert(edgeItem).second)
+        return;
+    _restackEdgeItems.emplace_back(edgeItem);
+    if (isUpdating())           // Dirty edges are restacked in endUpdate()
+        return;
+    scheduleFrameUpdate();
+}
+
+void    Graph::scheduleEdgesRestack(const qan::Node& node) noexcept
+{
+    const auto restackEdges = [this](const auto& edges) {
+        for (const auto& weakEdge : edges) {
+            const auto edge = weakEdge.lock();
+            if (edge &&
+                edge->getItem() != nullptr)
+                scheduleEdgeItemRestack(edge->getItem());
+        }
+    };
+    std::vector<const qan::Node*> stack{&node};
+    while (!stack.empty()) {
+        const auto top = stack.back();
+        stack.pop_back();
+        if (top == nullptr)
+            continue;
+        restackEdges(top->get_in_edges());
+        restackEdges(top->get_out_edges());
+        if (top->is_group())
+            for (const auto& member : top->get_nodes())
+                stack.push_back(qobject_cast<const qan::Node*>(member.lock().get()));
+    }
+}
+
+void    Graph::restackDeferredEdgeItems() noexcept
+{
+    auto restackEdgeItems = std::move(_restackEdgeItems);
+    _restackEdgeItems.clear();
+    _restackEdgeItemsSet.clear();
+    for (const auto& edgeItem : restackEdgeItems)
+        if (edgeItem)
+            edgeItem->updateZ();
 }
 
 void    Graph::findMaxZ() noexcept
 {
+    const auto cached = _childsMaxZ.find(getContainerItem());
+    if (cached != _childsMaxZ.end())        // Force a full container childs scan (entry is kept, it is erased on item destruction)
+        cached->second = scanChildsZ(*getContainerItem());
     const auto maxZ = maxChildsZ(getContainerItem());
     setMaxZ(maxZ);
 }
@@ -1602,13 +5133,19 @@ qreal   Graph::getMaxZ() const noexcept { return _maxZ; }
 void    Graph::setMaxZ(const qreal maxZ) noexcept
 {
     _maxZ = maxZ;
-    emit maxZChanged();
+    if (isUpdating())
+        _updateMaxZModified = true;
+    else
+        emit maxZChanged();
 }
 
 qreal   Graph::nextMaxZ() noexcept
 {
     _maxZ += 1.;
-    emit maxZChanged();
+    if (isUpdating())
+        _updateMaxZModified = true;
+    else
+        emit maxZChanged();
     return _maxZ;
 }
 
@@ -1621,17 +5158,42 @@ void    Graph::updateMaxZ(qreal z) noexcept
 auto    Graph::maxChildsZ(QQuickItem* item) const noexcept -> qreal {
     if (item == nullptr)
         return 0.;
+    const auto cached = _childsMaxZ.find(item);
+    if (cached != _childsMaxZ.end())
+        return cached->second;
+    // Note: Cache is populated on first query with a childs scan, it is then maintained incrementally from
+    // indexed items z and parent modifications (see childZModified()).
+    const auto maxZ = scanChildsZ(*item);
+    _childsMaxZ.emplace(item, maxZ);
+    connect(item, &QObject::destroyed, this, [this, item]() { _childsMaxZ.erase(item); });
+    return maxZ;
+};
+
+auto    Graph::scanChildsZ(const QQuickItem& item) const noexcept -> qreal {
     qreal maxZ = std::numeric_limits<qreal>::min();
     bool hasChild = false;
-    const auto childs = item->childItems();
+    const auto childs = item.childItems();
     for (const auto childItem : qAsConst(childs)) {
-        if (childItem != nullptr) {
+        if (childItem != nullptr &&
+            childItem != _selectionOverlayItem.data()) {     // Selection overlay is always on top
             hasChild = true;
             maxZ = std::max(maxZ, childItem->z());
         }
     }
     return hasChild ? maxZ : 0.;
-};
+}
+
+void    Graph::childZModified(const QQuickItem* item) noexcept
+{
+    if (item == nullptr ||
+        item->parentItem() == nullptr)
+        return;
+    // Cached value is an upper bound: lowering a child z or removing a child keep previous maximum,
+    // sendToFront() still stack items above all their siblings.
+    const auto cached = _childsMaxZ.find(item->parentItem());
+    if (cached != _childsMaxZ.end())
+        cached->second = std::max(cached->second, item->z());
+}
 //-----------------------------------------------------------------------------
 
 
@@ -1649,110 +5211,598 @@ std::vector<QPointer<const qan::Node>>  Graph::collectRootNodes() const noexcept
 std::vector<const qan::Node*>   Graph::collectDfs(bool collectGroup) const noexcept
 {
     std::vector<const qan::Node*> nodes;
-    std::unordered_set<const qan::Node*> marks;
-    auto& rootNodes = get_root_nodes();
-    for (const auto& rootNode : rootNodes) {
-        collectDfsRec(rootNode.lock().get(), marks, nodes, collectGroup);
-    }
+    const auto& rootNodes = get_root_nodes();
+    gtpo::collect_dfs(rootNodes.cbegin(), rootNodes.cend(), std::back_inserter(nodes), _dfsScratch, collectGroup);
     return nodes;
 }
 
 std::vector<const qan::Node*>   Graph::collectDfs(const qan::Node& node, bool collectGroup) const noexcept
 {
     std::vector<const qan::Node*> childs;
-    std::unordered_set<const qan::Node*> marks;
-    if (collectGroup &&
-        node.isGroup()) {
-        const auto group = qobject_cast<const qan::Group*>(&node);
-        if (group) {
-            for (const auto& groupNode : group->get_nodes())
-                collectDfsRec(groupNode.lock().get(), marks, childs, collectGroup);
-        }
-    }
-    for (const auto& outNode : node.get_out_nodes())
-        collectDfsRec(outNode.lock().get(), marks, childs, collectGroup);
+    collectDfs(node, std::back_inserter(childs), collectGroup);
     return childs;
 }
 
-void    Graph::collectDfsRec(const qan::Node* node,
-                             std::unordered_set<const qan::Node*>& marks,
-                             std::vector<const qan::Node*>& childs,
-                             bool collectGroup) const noexcept
+bool    Graph::isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept
 {
-    if (node == nullptr)
-        return;
-    if (marks.find(node) != marks.end())    // Do not collect on already visited
-        return;                             // branchs
-    marks.insert(node);
-    childs.push_back(node);
-    if (collectGroup &&
-        node->isGroup()) {
-        const auto group = qobject_cast<const qan::Group*>(node);
-        if (group) {
-            for (const auto& groupNode : group->get_nodes())
-                collectDfsRec(groupNode.lock().get(), marks, childs, collectGroup);
-        }
-    }
-    for (const auto& outNode : node->get_out_nodes())
-        collectDfsRec(outNode.lock().get(), marks, childs, collectGroup);
+    return &node != &candidate &&
+           isReachable(const_cast<qan::Node*>(&candidate), const_cast<qan::Node*>(&node));
 }
 
-bool    Graph::isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept
+bool    Graph::isReachable(qan::Node* source, qan::Node* destination) const noexcept
 {
-    Q_UNUSED(node)
-    Q_UNUSED(candidate)
-    qWarning() << "qan::Graph::isAncestor(): Not implemented.";
+    if (source == nullptr ||
+        destination == nullptr)
+        return false;
+    const auto reachability = this->reachability();
+    if (reachability == nullptr)
+        return false;
+    try {
+        const auto& csr = _reachabilitySnapshot->get_csr();
+        const auto indexOf = [&csr](qan::Node* n) {
+            return csr.index_of(std::static_pointer_cast<Config::final_node_t>(n->shared_from_this()));
+        };
+        return reachability->is_reachable(indexOf(source), indexOf(destination));
+    } catch (const std::bad_weak_ptr&) { }  // Node is not owned by a graph
     return false;
 }
 
+auto    Graph::reachability() const noexcept -> const Reachability*
+{
+    if (_reachability &&
+        _reachabilitySnapshot &&
+        _reachabilitySnapshot->get_revision() == get_topology_revision())
+        return _reachability.get();
+    try {
+        _reachabilitySnapshot = this->snapshot();
+        if (!_reachability)
+            _reachability = std::make_unique<Reachability>();
+        _reachability->rebuild(_reachabilitySnapshot->get_csr());    // Note: index storage is reused
+        return _reachability.get();
+    } catch (...) {
+        qWarning() << "qan::Graph::reachability(): Error: Reachability index construction failed.";
+    }
+    _reachabilitySnapshot.reset();
+    _reachability.reset();
+    return nullptr;
+}
+
 std::vector<const qan::Node*>   Graph::collectAncestorsDfs(const qan::Node& node, bool collectGroup) const noexcept
 {
+    using csr_t = Snapshot::element_type::csr_t;
+    using index_t = csr_t::index_t;
     std::vector<const qan::Node*> parents;
-    std::unordered_set<const qan::Node*> marks;
-    if (collectGroup &&
-        node.isGroup()) {
-        // Collect all nodes in a group
-        const auto group = qobject_cast<const qan::Group*>(&node);
-        if (group) {
-            for (const auto& groupNode : group->get_nodes())
-                collectAncestorsDfsRec(groupNode.lock().get(), marks, parents, collectGroup);
-        }
-    }
-    // Collect the parent group of a node
-    /*if (collectGroup) {
-        const auto nodeGroup = node.getGroup();
-        if (nodeGroup != nullptr)
-            collectAncestorsDfsRec(nodeGroup, marks, parents, collectGroup);
-    }*/
-    for (const auto& inNode : node.get_in_nodes())
-        collectAncestorsDfsRec(inNode.lock().get(), marks, parents, collectGroup);
+    try {
+        const auto snapshot = this->snapshot();
+        const auto& csr = snapshot->get_csr();
+        const auto indexOf = [&csr](const qan::Node* n) -> index_t {
+            return n != nullptr ? csr.index_of(std::static_pointer_cast<Config::final_node_t>(const_cast<qan::Node*>(n)->shared_from_this())) :
+                                  csr_t::invalid_index;
+        };
+        const auto root = indexOf(&node);
+        if (root == csr_t::invalid_index)
+            return parents;
+
+        std::vector<bool>       marks(csr.get_node_count(), false);
+        std::vector<index_t>    stack;
+        // Push n successors in reverse order, they are then visited in the same order than the former
+        // recursive implementation: group nodes, node group, in nodes.
+        const auto pushSuccessors = [&](index_t n, const qan::Node& current, bool withGroup) {
+            for (auto inNode = csr.in_end(n); inNode != csr.in_begin(n); )
+                stack.push_back(*--inNode);
+            if (!collectGroup)
+                return;
+            if (withGroup) {
+                const auto index = indexOf(current.getGroup());
+                if (index != csr_t::invalid_index)
+                    stack.push_back(index);
+            }
+            if (current.isGroup()) {
+                const auto group = qobject_cast<const qan::Group*>(&current);
+                if (group != nullptr) {
+                    const auto& groupNodes = group->get_nodes();
+                    for (auto g = static_cast<int>(groupNodes.size()) - 1; g >= 0; --g) {
+                        const auto index = csr.index_of(groupNodes.at(g));
+                        if (index != csr_t::invalid_index)
+                            stack.push_back(index);
+                    }
+                }
+            }
+        };
+        pushSuccessors(root, node, false);  // Note: root node group is not collected
+        while (!stack.empty()) {
+            const auto n = stack.back();
+            stack.pop_back();
+            if (marks[n])
+                continue;
+            marks[n] = true;
+            const auto current = csr.get_node(n).lock();
+            if (!current)
+                continue;
+            parents.push_back(current.get());
+            pushSuccessors(n, *current, true);
+        }
+    } catch (...) {
+        qWarning() << "qan::Graph::collectAncestorsDfs(): Error: ancestors can't be collected.";
+        parents.clear();
+    }
     return parents;
 }
 
-void    Graph::collectAncestorsDfsRec(const qan::Node* node,
-                             std::unordered_set<const qan::Node*>& marks,
-                             std::vector<const qan::Node*>& parents,
-                             bool collectGroup) const noexcept
+void    Graph::setNodesVisible(const std::vector<qan::Node*>& nodes, bool visible) noexcept
 {
-    if (node == nullptr)
+    beginUpdate();
+    std::unordered_set<qan::Edge*> edges;
+    edges.reserve(nodes.size() * 2);
+    const auto collectEdges = [&edges](const auto& adjacentEdges) {
+        for (const auto& edge : adjacentEdges) {
+            const auto edgePtr = edge.lock();
+            if (edgePtr)
+                edges.insert(edgePtr.get());
+        }
+    };
+    for (const auto node : nodes) {
+        if (node == nullptr)
+            continue;
+        collectEdges(node->get_in_edges());
+        collectEdges(node->get_out_edges());
+    }
+    for (const auto edge : edges)
+        if (edge->getItem() != nullptr)
+            edge->getItem()->setVisible(visible);
+    for (const auto node : nodes)
+        if (node != nullptr &&
+            node->getItem() != nullptr)
+            node->getItem()->setVisible(visible);
+    endUpdate();
+}
+//-----------------------------------------------------------------------------
+
+/* Topology Snapshot *///------------------------------------------------------
+void    Graph::applyNodePositions(const Snapshot& snapshot, const std::vector<QPointF>& positions) noexcept
+{
+    // PRECONDITIONS:
+        // snapshot can't be nullptr
+        // positions size must match snapshot node count
+    if (!snapshot)
+        return;
+    const auto& csr = snapshot->get_csr();
+    if (positions.size() != static_cast<std::size_t>(csr.get_node_count())) {
+        qWarning() << "qan::Graph::applyNodePositions(): Error: positions count does not match snapshot node count.";
+        return;
+    }
+    for (std::size_t n = 0; n < positions.size(); ++n) {
+        const auto node = csr.get_node(static_cast<Snapshot::element_type::index_t>(n)).lock();
+        if (!node)
+            continue;
+        QQuickItem* item = node->is_group() ? qobject_cast<qan::Group*>(node.get())->getGroupItem() :
+                                              node->getItem();
+        if (item != nullptr)
+            item->setPosition(positions[n]);    // Note: group items update their adjacent edges on position change
+        else {                                  // Headless or virtualized node: geometry is stored in node
+            auto geometry = node->getGeometry();
+            geometry.moveTopLeft(positions[n]);
+            node->setGeometry(geometry);
+        }
+    }
+    scheduleVirtualizationUpdate();
+}
+
+void    Graph::postNodePositions(Snapshot snapshot, std::vector<QPointF> positions) noexcept
+{
+    // Note: called from a worker thread, snapshot and positions are moved to the queued functor
+    QPointer<qan::Graph> graph{this};
+    QMetaObject::invokeMethod(this, [graph, snapshot = std::move(snapshot), positions = std::move(positions)]() {
+        if (graph)
+            graph->applyNodePositions(snapshot, positions);
+    }, Qt::QueuedConnection);
+}
+//-----------------------------------------------------------------------------
+
+/* Bulk Node Properties *///---------------------------------------------------
+namespace { // ::qan::anonymous
+
+//! Copy \c values in a new byte array (QByteArray data alignment is not guaranteed for T).
+template <class T>
+QByteArray  packValues(const std::vector<T>& values)
+{
+    QByteArray buffer{static_cast<int>(values.size() * sizeof(T)), Qt::Uninitialized};
+    if (!values.empty())
+        std::memcpy(buffer.data(), values.data(), values.size() * sizeof(T));
+    return buffer;
+}
+
+//! Copy \c buffer content in a vector of T, trailing bytes are ignored.
+template <class T>
+std::vector<T>  unpackValues(const QByteArray& buffer)
+{
+    std::vector<T> values(static_cast<std::size_t>(buffer.size()) / sizeof(T));
+    if (!values.empty())
+        std::memcpy(values.data(), buffer.constData(), values.size() * sizeof(T));
+    return values;
+}
+
+} // ::qan::anonymous
+
+QByteArray  Graph::nodePositions() const noexcept
+{
+    try {
+        std::vector<float> positions;
+        positions.reserve(gtpo_graph_t::get_nodes().size() * 2);
+        for (const auto& node : gtpo_graph_t::get_nodes()) {
+            if (!node)
+                continue;
+            const auto position = node->getGeometry().topLeft();
+            positions.push_back(static_cast<float>(position.x()));
+            positions.push_back(static_cast<float>(position.y()));
+        }
+        return packValues(positions);
+    } catch (...) { qWarning() << "qan::Graph::nodePositions(): Error: Can't allocate positions buffer."; }
+    return QByteArray{};
+}
+
+int     Graph::setNodePositions(const QByteArray& positions) noexcept
+{
+    std::vector<float> values;
+    try {
+        values = unpackValues<float>(positions);
+    } catch (...) {
+        qWarning() << "qan::Graph::setNodePositions(): Error: Can't allocate positions buffer.";
+        return 0;
+    }
+    int modified = 0;
+    std::size_t n = 0;
+    beginUpdate();
+    for (const auto& node : gtpo_graph_t::get_nodes()) {
+        if (!node)
+            continue;
+        if (2 * n + 1 >= values.size())
+            break;
+        const auto x = values[2 * n];
+        const auto y = values[2 * n + 1];
+        ++n;
+        if (std::isnan(x) || std::isnan(y))
+            continue;
+        const QPointF position{static_cast<qreal>(x), static_cast<qreal>(y)};
+        if (node->getItem() != nullptr)
+            node->getItem()->setPosition(position);
+        else {                  // Headless or virtualized node: geometry is stored in node
+            auto geometry = node->getGeometry();
+            geometry.moveTopLeft(position);
+            node->setGeometry(geometry);
+        }
+        ++modified;
+    }
+    endUpdate();
+    scheduleVirtualizationUpdate();
+    return modified;
+}
+
+QByteArray  Graph::nodeSizes() const noexcept
+{
+    try {
+        std::vector<float> sizes;
+        sizes.reserve(gtpo_graph_t::get_nodes().size() * 2);
+        for (const auto& node : gtpo_graph_t::get_nodes()) {
+            if (!node)
+                continue;
+            const auto size = node->getGeometry().size();
+            sizes.push_back(static_cast<float>(size.width()));
+            sizes.push_back(static_cast<float>(size.height()));
+        }
+        return packValues(sizes);
+    } catch (...) { qWarning() << "qan::Graph::nodeSizes(): Error: Can't allocate sizes buffer."; }
+    return QByteArray{};
+}
+
+int     Graph::setNodeSizes(const QByteArray& sizes) noexcept
+{
+    std::vector<float> values;
+    try {
+        values = unpackValues<float>(sizes);
+    } catch (...) {
+        qWarning() << "qan::Graph::setNodeSizes(): Error: Can't allocate sizes buffer.";
+        return 0;
+    }
+    int modified = 0;
+    std::size_t n = 0;
+    beginUpdate();
+    for (const auto& node : gtpo_graph_t::get_nodes()) {
+        if (!node)
+            continue;
+        if (2 * n + 1 >= values.size())
+            break;
+        const auto width = values[2 * n];
+        const auto height = values[2 * n + 1];
+        ++n;
+        if (!(width >= 0.f) || !(height >= 0.f))  // Note: false for NaN
+            continue;
+        const QSizeF size{static_cast<qreal>(width), static_cast<qreal>(height)};
+        if (node->getItem() != nullptr)
+            node->getItem()->setSize(size);
+        else
+            node->setGeometry(QRectF{node->getGeometry().topLeft(), size});
+        ++modified;
+    }
+    endUpdate();
+    scheduleVirtualizationUpdate();
+    return modified;
+}
+
+QByteArray  Graph::nodeVisibilities() const noexcept
+{
+    try {
+        std::vector<std::uint8_t> visibilities;
+        visibilities.reserve(gtpo_graph_t::get_nodes().size());
+        for (const auto& node : gtpo_graph_t::get_nodes())
+            if (node)
+                visibilities.push_back(node->getItem() == nullptr ||
+                                       node->getItem()->isVisible() ? 1 : 0);
+        return packValues(visibilities);
+    } catch (...) { qWarning() << "qan::Graph::nodeVisibilities(): Error: Can't allocate visibilities buffer."; }
+    return QByteArray{};
+}
+
+int     Graph::setNodeVisibilities(const QByteArray& visibilities) noexcept
+{
+    std::vector<qan::Node*> shownNodes;
+    std::vector<qan::Node*> hiddenNodes;
+    try {
+        std::size_t n = 0;
+        for (const auto& node : gtpo_graph_t::get_nodes()) {
+            if (!node)
+                continue;
+            if (n >= static_cast<std::size_t>(visibilities.size()))
+                break;
+            const bool visible = visibilities.at(static_cast<int>(n++)) != 0;
+            if (node->getItem() == nullptr ||
+                node->getItem()->isVisible() == visible)
+                continue;
+            (visible ? shownNodes : hiddenNodes).push_back(node.get());
+        }
+    } catch (...) {
+        qWarning() << "qan::Graph::setNodeVisibilities(): Error: Can't allocate nodes buffer.";
+        return 0;
+    }
+    beginUpdate();
+    setNodesVisible(hiddenNodes, false);
+    setNodesVisible(shownNodes, true);
+    endUpdate();
+    return static_cast<int>(shownNodes.size() + hiddenNodes.size());
+}
+
+QByteArray  Graph::nodeStyles() const noexcept
+{
+    try {
+        const auto& styles = _styleManager.getStyles();
+        std::unordered_map<const QObject*, std::int32_t> styleIndexes;
+        styleIndexes.reserve(static_cast<std::size_t>(styles.size()));
+        for (int s = 0; s < styles.size(); ++s)
+            styleIndexes.insert({styles.at(s), static_cast<std::int32_t>(s)});
+        std::vector<std::int32_t> indexes;
+        indexes.reserve(gtpo_graph_t::get_nodes().size());
+        for (const auto& node : gtpo_graph_t::get_nodes()) {
+            if (!node)
+                continue;
+            const auto index = styleIndexes.find(getNodeStyle(*node));
+            indexes.push_back(index != styleIndexes.end() ? index->second : -1);
+        }
+        return packValues(indexes);
+    } catch (...) { qWarning() << "qan::Graph::nodeStyles(): Error: Can't allocate styles buffer."; }
+    return QByteArray{};
+}
+
+int     Graph::setNodeStyles(const QByteArray& styles) noexcept
+{
+    std::vector<std::int32_t> indexes;
+    try {
+        indexes = unpackValues<std::int32_t>(styles);
+    } catch (...) {
+        qWarning() << "qan::Graph::setNodeStyles(): Error: Can't allocate styles buffer.";
+        return 0;
+    }
+    const auto& managerStyles = _styleManager.getStyles();
+    int modified = 0;
+    std::size_t n = 0;
+    beginUpdate();
+    for (const auto& node : gtpo_graph_t::get_nodes()) {
+        if (!node)
+            continue;
+        if (n >= indexes.size())
+            break;
+        const auto index = indexes[n++];
+        if (index < 0 ||
+            index >= managerStyles.size())
+            continue;
+        const auto style = qobject_cast<qan::NodeStyle*>(managerStyles.at(index));
+        if (style == nullptr ||
+            style == getNodeStyle(*node))
+            continue;
+        setNodeStyle(*node, style);
+        ++modified;
+    }
+    endUpdate();
+    return modified;
+}
+//-----------------------------------------------------------------------------
+
+/* Structural Fingerprint *///-------------------------------------------------
+std::uint64_t   Graph::getFingerprint() noexcept
+{
+    if ( _fingerprint == nullptr ) {
+        try {
+            auto fingerprint = std::make_unique<Fingerprint>();
+            fingerprint->set_node_hasher([](const qan::Node& node) { return Graph::getStructuralHash(node); });
+            fingerprint->reset(*this);
+            _fingerprint = fingerprint.get();
+            gtpo_graph_t::add_dynamic_graph_behaviour(std::move(fingerprint));
+            _fingerprint->enable();
+            // Label is part of node hash: rehash node and its adjacent edges on label change
+            connect(this, &qan::Graph::nodeLabelChanged, this, &qan::Graph::onFingerprintNodeChanged, Qt::UniqueConnection);
+        } catch ( ... ) {
+            qWarning() << "qan::Graph::getFingerprint(): Error: Fingerprint initialization failed.";
+            _fingerprint = nullptr;
+            return 0;
+        }
+    }
+    return _fingerprint->get_fingerprint();
+}
+
+QString Graph::getFingerprintString() noexcept
+{
+    return QString::number(static_cast<qulonglong>(getFingerprint()), 16).rightJustified(16, QLatin1Char('0'));
+}
+
+std::uint64_t   Graph::getStructuralHash(const qan::Node& node) noexcept
+{
+    // FNV-1a over label UTF-16 code units: unlike qHash(), result is not seeded per process
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    const auto label = node.getLabel();
+    for ( const QChar c : label ) {
+        hash ^= static_cast<std::uint64_t>(c.unicode());
+        hash *= 0x100000001b3ull;
+    }
+    hash ^= node.isGroup() ? 0x67ull : 0x6eull;
+    hash *= 0x100000001b3ull;
+    return hash;
+}
+
+void    Graph::onFingerprintNodeChanged(qan::Node* node) noexcept
+{
+    if ( _fingerprint == nullptr ||
+         node == nullptr )
+        return;
+    try {
+        _fingerprint->update_node(std::static_pointer_cast<Config::final_node_t>(node->shared_from_this()));
+    } catch ( std::bad_weak_ptr ) { }
+}
+//-----------------------------------------------------------------------------
+
+/* Label Search *///----------------------------------------------------------
+QObjectList Graph::findNodes(const QString& query, int limit) noexcept
+{
+    QObjectList nodes;
+    if (query.isEmpty())
+        return nodes;
+    syncLabelIndex();
+    const auto matches = _labelIndex.find(query, limit);
+    nodes.reserve(static_cast<int>(matches.size()));
+    for (const auto node : matches)
+        nodes.append(const_cast<qan::Node*>(node));
+    return nodes;
+}
+
+int     Graph::selectNodesByLabel(const QString& query, int limit) noexcept
+{
+    std::vector<qan::Node*> nodes;
+    if (!query.isEmpty()) {
+        syncLabelIndex();
+        for (const auto node : _labelIndex.find(query, limit))
+            nodes.push_back(const_cast<qan::Node*>(node));
+    }
+    beginUpdate();
+    clearSelection();
+    setNodesSelected(nodes, true);
+    endUpdate();
+    return static_cast<int>(nodes.size());
+}
+
+void    Graph::syncLabelIndex() noexcept
+{
+    if (!_labelIndexEnabled) {
+        _labelIndexEnabled = true;
+        _labelIndexRevision = get_topology_revision() + 1;     // Force initial synchronization
+        connect(this, &qan::Graph::nodeLabelChanged, this, &qan::Graph::onLabelIndexNodeChanged);
+        connect(this, &qan::Graph::nodeRemoved,
+                this, [this](qan::Node* node) { _labelIndex.remove(node); });
+    }
+    if (_labelIndexRevision == get_topology_revision())
         return;
-    if (marks.find(node) != marks.end())    // Do not collect on already visited
-        return;                             // branchs
-    marks.insert(node);
-    parents.push_back(node);
-    if (collectGroup &&
-        node->isGroup()) {
-        const auto group = qobject_cast<const qan::Group*>(node);
-        if (group) {
-            for (const auto& groupNode : group->get_nodes())
-                collectAncestorsDfsRec(groupNode.lock().get(), marks, parents, collectGroup);
-        }
-    }
-    const auto nodeGroup = node->getGroup();
-    if (nodeGroup != nullptr)
-        collectAncestorsDfsRec(nodeGroup, marks, parents, collectGroup);
-    for (const auto& inNode : node->get_in_nodes())
-        collectAncestorsDfsRec(inNode.lock().get(), marks, parents, collectGroup);
+    _labelIndexRevision = get_topology_revision();
+    // Note: insert() is a no-op for indexed nodes with an unchanged label
+    for (const auto& node : get_nodes())
+        if (node)
+            _labelIndex.insert(node.get(), node->getLabel());
+    if (_labelIndex.size() > static_cast<int>(get_node_count())) {  // Drop nodes removed without notification
+        std::unordered_set<const qan::Node*> nodes;
+        nodes.reserve(get_node_count());
+        for (const auto& node : get_nodes())
+            nodes.insert(node.get());
+        for (const auto node : _labelIndex.nodes())
+            if (nodes.find(node) == nodes.end())
+                _labelIndex.remove(node);
+    }
+}
+
+void    Graph::onLabelIndexNodeChanged(qan::Node* node) noexcept
+{
+    if (node != nullptr &&
+        _labelIndex.contains(node))     // Note: nodes not yet indexed are inserted on next synchronization
+        _labelIndex.insert(node, node->getLabel());
+}
+//-----------------------------------------------------------------------------
+
+/* Path and Neighbourhood Queries *///-----------------------------------------
+namespace impl { // ::qan::impl
+
+template <class csr_t>
+QObjectList csrNodes(const csr_t& csr, const std::vector<typename csr_t::index_t>& indexes)
+{
+    QObjectList nodes;
+    nodes.reserve(static_cast<int>(indexes.size()));
+    for (const auto index : indexes) {
+        const auto node = csr.get_node(index).lock();
+        if (node)
+            nodes.append(node.get());
+    }
+    return nodes;
+}
+
+} // ::qan::impl
+
+QObjectList Graph::shortestPath(qan::Node* source, qan::Node* destination, bool weighted) const noexcept
+{
+    if (source == nullptr ||
+        destination == nullptr)
+        return QObjectList{};
+    try {
+        const WeakNode weakSource = std::static_pointer_cast<Config::final_node_t>(source->shared_from_this());
+        const WeakNode weakDestination = std::static_pointer_cast<Config::final_node_t>(destination->shared_from_this());
+        if (weighted) {     // Note: weight modifications do not change topology revision, weighted view can't be cached
+            gtpo::csr_view<gtpo_graph_t> csr;
+            csr.rebuild(*this, [](const qan::Edge& edge) { return edge.getWeight(); });
+            return impl::csrNodes(csr, gtpo::shortest_path(csr, csr.index_of(weakSource), csr.index_of(weakDestination)));
+        }
+        const auto snapshot = this->snapshot();
+        const auto& csr = snapshot->get_csr();
+        return impl::csrNodes(csr, gtpo::shortest_path(csr, csr.index_of(weakSource), csr.index_of(weakDestination)));
+    } catch (const std::invalid_argument&) {
+        qWarning() << "qan::Graph::shortestPath(): Error: negative edge weight.";
+    } catch (...) {
+        qWarning() << "qan::Graph::shortestPath(): Error: path can't be computed.";
+    }
+    return QObjectList{};
+}
+
+QObjectList Graph::neighbourhood(qan::Node* node, int hops, bool directed) const noexcept
+{
+    if (node == nullptr ||
+        hops < 0)
+        return QObjectList{};
+    try {
+        const WeakNode weakNode = std::static_pointer_cast<Config::final_node_t>(node->shared_from_this());
+        const auto snapshot = this->snapshot();
+        const auto& csr = snapshot->get_csr();
+        const auto index = csr.index_of(weakNode);
+        if (index == Snapshot::element_type::csr_t::invalid_index)
+            return QObjectList{};
+        return impl::csrNodes(csr, gtpo::k_hop_neighbourhood(csr, {index}, static_cast<std::size_t>(hops),
+                                                            directed ? gtpo::traversal_direction::out :
+                                                                       gtpo::traversal_direction::both));
+    } catch (...) {
+        qWarning() << "qan::Graph::neighbourhood(): Error: neighbourhood can't be computed.";
+    }
+    return QObjectList{};
 }
 //-----------------------------------------------------------------------------
 
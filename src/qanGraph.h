@@ -36,6 +36,11 @@
 
 // GTpo headers
 #include <gtpo/GTpo>
+#include <gtpo/topological_order.h>
+#include <gtpo/fingerprint.h>
+#include <gtpo/algorithm.h>
+#include <gtpo/topology_diff.h>
+#include <gtpo/reachability.h>
 
 // QuickQanava headers
 #include "./qanUtils.h"
@@ -44,21 +49,44 @@
 #include "./qanEdge.h"
 #include "./qanNode.h"
 #include "./qanGroup.h"
+#include "./qanNodeItem.h"
 #include "./qanNavigable.h"
 #include "./qanSelectable.h"
 #include "./qanConnector.h"
+#include "./qanSpatialIndex.h"
+#include "./qanLabelIndex.h"
+#include "./qanNodeColumns.h"
+#include "./qanSelectionSet.h"
+#include "./qanGraphBuilder.h"
+#include "./qanOrthoRouter.h"
+#include "./qanComponentCache.h"
+#include "./qanMemoryStats.h"
+#include "./qanTrace.h"
+#include "./qanUndoStack.h"
 
 // Qt headers
 #include <QQuickItem>
 #include <QQmlParserStatus>
 #include <QSharedPointer>
 #include <QAbstractListModel>
+#include <QQmlIncubator>
+#include <QHash>
+
+// Std headers
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <cstdint>
+#include <functional>
 
 //! Main QuickQanava namespace
 namespace qan { // ::qan
 
 class Graph;
 class PortItem;
+class NodeIncubator;
+class SelectionOverlay;
 
 /*! \brief Main interface to manage graph topology.
  *
@@ -87,7 +115,7 @@ public:
      * Graph is a factory for inserted nodes and edges, even if they have been created trought
      * QML delegates, they will be destroyed with the graph they have been created in.
      */
-    virtual ~Graph() override = default;
+    virtual ~Graph() override;
     Graph(const Graph&) = delete;
     Graph& operator=(const Graph&) = delete;
     Graph(Graph&&) = delete;
@@ -101,6 +129,9 @@ public:
 public:
     /*! \brief Clear this graph topology and styles.
      *
+     * Clear is a bulk operation: no per primitive removal signal is emitted, graph models are reset once,
+     * items are detached from all signals at once and recycled in item pool (see \c itemPoolSize) or
+     * destroyed, selection, z and spatial indexes are reset without visiting primitives.
      */
     Q_INVOKABLE virtual void    clearGraph() noexcept;
 
@@ -111,22 +142,110 @@ public:
      */
     void                        clear() noexcept;
 
+private:
+    /*! \brief Detach all primitives items, then recycle (when \c recycle is true and pooling is enabled) or destroy them.
+     *
+     * Items are disconnected from every signal before destruction (destroying an item no longer notify adjacent
+     * edges items or graph indexes) and destroyed in container child order (Qt remove children with a linear
+     * search from first child).
+     */
+    void                        teardownItems(bool recycle) noexcept;
+
 public:
     /*! \brief Similar to QQuickItem::childAt() method, except that it take edge bounding shape into account.
      *
      * Using childAt() method will most of the time return qan::Edge items since childAt() use bounding boxes
-     * for item detection.
+     * for item detection. Candidates are read from graph spatial index and tested from top to bottom z.
      *
      * \return nullptr if there is no child at requested position, or a QQuickItem that can be casted qan::Node, qan::Edge or qan::Group with qobject_cast<>.
      */
     Q_INVOKABLE QQuickItem* graphChildAt(qreal x, qreal y) const;
 
-    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account (and is hence faster, but still O(n)).
+    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account.
      *
+     * Candidates are read from graph spatial index, cost is proportional to the number of groups at \c p.
      * \arg except Return every compatible group except \c except (can be nullptr).
      */
     Q_INVOKABLE qan::Group* groupAt(const QPointF& p, const QSizeF& s, const QQuickItem* except = nullptr) const;
 
+    /*! \brief Return graph container item direct childs (ungrouped nodes, edges, root groups) whose rect intersects \c rect.
+     *
+     * \c rect is expressed in graph container item CS, candidates are read from graph spatial index (returned items are unordered).
+     */
+    std::vector<const QQuickItem*>  graphChildrenIn(const QRectF& rect) const noexcept;
+
+    /*! \brief Return the top most visible port item under \c p (in graph container item CS), or nullptr.
+     *
+     * Candidates are read from graph port spatial index (ports are indexed with their global z), cost
+     * does not depend on the number of ports in graph.
+     */
+    Q_INVOKABLE qan::PortItem*      portAt(const QPointF& p) const noexcept;
+
+    /*! \brief Return the top most visible port, edge, node or group item under \c p (in graph container item CS), or nullptr.
+     *
+     * Candidates are read from graph spatial index, only candidates whose bounding rect contains \c p are exactly tested
+     * (edge hit polyline, node complex bounding shape), nested groups are searched recursively.
+     * \sa centralPicking
+     */
+    Q_INVOKABLE QQuickItem*         pickItem(const QPointF& p) const noexcept;
+private:
+    //! Return \c item or one of its grouped items if \c p (in graph container item CS) is exactly inside \c item.
+    QQuickItem*                     pickItemRec(QQuickItem* item, const QPointF& p) const noexcept;
+
+public:
+    //! Mark all indexed items dirty, spatial index is lazily refreshed on next graphChildAt() or groupAt() call.
+    void                    invalidateSpatialIndex() noexcept;
+protected:
+    //! Track primitive \c item geometry in graph spatial index (called when a node, edge or group item is created).
+    void                    indexItem(QQuickItem* item) noexcept;
+    //! Stop tracking \c item in graph spatial index.
+    void                    unindexItem(const QQuickItem* item) noexcept;
+    //! Mark \c item dirty (and recursively its sub groups for a group item, and ports for a node or group item).
+    void                    markIndexedItemDirty(const QQuickItem* item) noexcept;
+    //! Mark \c nodeItem ports dirty (and recursively ports of grouped nodes for a group item).
+    void                    markPortsDirty(const qan::NodeItem* nodeItem) noexcept;
+    //! Refresh index entries of dirty items.
+    void                    updateSpatialIndex() const noexcept;
+private:
+    struct IndexedItem {
+        QPointer<QQuickItem>    item;
+        bool                    dirty = false;
+    };
+    //! Index of graph container item direct childs (ungrouped nodes, edges, root groups) in container item coordinates.
+    mutable qan::SpatialIndex   _childIndex;
+    //! Index of every group (including sub groups) in container item coordinates, with their global z.
+    mutable qan::SpatialIndex   _groupIndex;
+    //! Index of every port item in container item coordinates, with their global z.
+    mutable qan::SpatialIndex   _portIndex;
+    mutable std::unordered_map<const QQuickItem*, IndexedItem>  _indexedItems;
+    mutable std::vector<const QQuickItem*>                      _dirtyIndexedItems;
+
+public:
+    /*! \brief Bounding rect of graph container item direct childs (ungrouped nodes, edges, root groups) in container item CS.
+     *
+     * Scene bounds are maintained incrementally from graph spatial index (see qan::SpatialIndex::bounds()), reading
+     * bounds is O(1) unless an item standing on bounds border has been shrinked or removed. \c sceneBoundsChanged is
+     * emitted at most once per event loop iteration.
+     */
+    Q_PROPERTY(QRectF sceneBounds READ getSceneBounds NOTIFY sceneBoundsChanged FINAL)
+    QRectF                  getSceneBounds() const noexcept;
+signals:
+    void                    sceneBoundsChanged();
+    /*! \brief Emitted at most once per event loop iteration when graph container childs are moved, resized, inserted or removed.
+     *
+     * \arg rect union of modified items previous and actual rects in container item CS.
+     */
+    void                    sceneModified(QRectF rect);
+private:
+    //! Call updateSceneBounds() on next event loop iteration.
+    void                    scheduleSceneBoundsUpdate() noexcept;
+    //! Emit sceneModified() and sceneBoundsChanged() if scene bounds has been modified.
+    void                    updateSceneBounds() noexcept;
+    QRectF                  _sceneBounds;
+    bool                    _sceneBoundsUpdateScheduled = false;
+    //! Union of modified child items previous and actual rects since last updateSceneBounds() call.
+    mutable QRectF          _sceneDirtyRect;
+
 public:
     /*! \brief Quick item used as a parent for all graphics item "factored" by this graph (default to this).
      *
@@ -232,7 +351,7 @@ protected:
 signals:
     void                    nodeDelegateChanged();
 private:
-    std::unique_ptr<QQmlComponent> _nodeDelegate;
+    qan::component_ptr             _nodeDelegate;
 
 public:
     //! Default delegate for qan::Edge and Qan.Edge edges.
@@ -244,7 +363,7 @@ protected:
 signals:
     void                    edgeDelegateChanged();
 private:
-    std::unique_ptr<QQmlComponent> _edgeDelegate;
+    qan::component_ptr             _edgeDelegate;
 
 public:
     //! Default delegate for qan::Group and Qan.Group groups.
@@ -256,7 +375,7 @@ protected:
 signals:
     void                    groupDelegateChanged();
 private:
-    std::unique_ptr<QQmlComponent> _groupDelegate;
+    qan::component_ptr             _groupDelegate;
 
 protected:
     //! Create a _styleable_ graph primitive using the given delegate \c component with either a source \c node or \c edge.
@@ -303,15 +422,922 @@ protected:
     template<typename T>
     using unique_qptr = std::unique_ptr<T, QObjectDeleteLater>;
 
-    std::unique_ptr<QQmlComponent>  _selectionDelegate{nullptr};
+    qan::component_ptr              _selectionDelegate{nullptr};
 private:
-    //! Secure factory for QML components, errors are reported on stderr.
-    std::unique_ptr<QQmlComponent>  createComponent(const QString& url) noexcept;
+    //! Return graph QML engine cached component for \c url (owned by qan::ComponentCache), errors are reported on stderr.
+    QQmlComponent*                  createComponent(const QString& url) noexcept;
     //! Secure utility to create a QQuickItem from a given QML component \c component (might issue warning if component is nullptr or not successfully loaded).
     QPointer<QQuickItem>            createItemFromComponent(QQmlComponent* component) noexcept;
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Delegate Item Pool *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Maximum number of recycled node, edge and group items kept for every delegate component (default to 0, pooling disabled).
+     *
+     * When set, items of removed nodes, edges and groups are reset (hidden, detached from their primitive and from graph
+     * signals) and reused by createFromComponent() for next insertion with the same delegate component, avoiding
+     * QQmlComponent::beginCreate()/completeCreate() cost. Items above high-water mark are destroyed.
+     *
+     * Recycled items are detached from their previous endpoints, ports and docks, their size is reset to the size they
+     * had when created (node, edge and group items notify nodeChanged(), edgeChanged() and groupChanged() on reuse).
+     * \warning Recycled items keep their custom QML state (delegate properties), delegate must bind its visual state
+     * to node/edge/group properties, not initialize it once in Component.onCompleted.
+     */
+    Q_PROPERTY(int itemPoolSize READ getItemPoolSize WRITE setItemPoolSize NOTIFY itemPoolSizeChanged FINAL)
+    //! \copydoc itemPoolSize
+    inline int              getItemPoolSize() const noexcept { return _itemPoolSize; }
+    //! \copydoc itemPoolSize
+    void                    setItemPoolSize(int itemPoolSize) noexcept;
+signals:
+    //! \copydoc itemPoolSize
+    void                    itemPoolSizeChanged();
+private:
+    int                     _itemPoolSize = 0;
+
+public:
+    //! Destroy all pooled items.
+    Q_INVOKABLE void        clearItemPool() noexcept;
+    //! Return the number of pooled items available for \c component.
+    Q_INVOKABLE int         getPooledItemCount(QQmlComponent* component) const noexcept;
+    //! Return the total number of pooled items (for all delegate components).
+    int                     getPooledItemCount() const noexcept;
+
+protected:
+    //! Return a pooled item for \c component, or nullptr if there is no recycled item available.
+    QQuickItem*             takePooledItem(QQmlComponent* component) noexcept;
+    /*! \brief Reset and pool \c item, return false if \c item can't be pooled (pooling disabled, pool is full or item has not been created by graph).
+     *
+     * \note On false, caller remains responsible for \c item destruction.
+     */
+    bool                    recycleItem(QQuickItem* item) noexcept;
+    //! Detach \c node item (and its adjacent edges items) from their primitive and recycle them before \c node is removed.
+    void                    recycleNodeItems(qan::Node& node) noexcept;
+
+private:
+    //! Recycled items per delegate component.
+    std::unordered_map<QQmlComponent*, std::vector<QPointer<QQuickItem>>>  _itemPool;
+    //! Delegate component and size at creation of an item created while pooling is enabled (size is restored on recycling).
+    struct ItemOrigin {
+        QPointer<QQmlComponent> component;
+        QSizeF                  size;
+    };
+    //! Origin of items created from createFromComponent() while pooling is enabled.
+    std::unordered_map<const QQuickItem*, ItemOrigin>                       _itemComponents;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Asynchronous Item Creation *///---------------------------------
+    //@{
+public:
+    /*! \brief Insert a node in graph topology immediately, and incubate its visual item asynchronously with QQmlIncubator.
+     *
+     * Node item is created in time sliced chunks by QML engine incubation controller (the QQuickWindow controller when
+     * graph is displayed in a window, otherwise a graph owned controller slicing incubation in 5ms chunks), GUI thread
+     * is not blocked while inserting thousands of nodes:
+     * \code
+     * Qan.Graph {
+     *   onNodeItemReady: { node.item.x = Math.random() * 1000 }
+     *   onItemIncubationProgress: progressBar.value = ready / total
+     *   Component.onCompleted: { for (var n = 0; n < 5000; n++) insertNodeAsync() }
+     * }
+     * \endcode
+     *
+     * \return inserted node, node getItem() is nullptr until nodeItemReady() is emitted for this node.
+     * \note Edges might be inserted between nodes with a pending item, edge items are bound to node items once incubated.
+     * \note With a non zero \c attachmentBudget, incubations closest to viewport center are started first.
+     */
+    Q_INVOKABLE qan::Node*  insertNodeAsync(QQmlComponent* nodeComponent = nullptr, qan::NodeStyle* nodeStyle = nullptr);
+
+    //! Number of node items still being incubated.
+    Q_PROPERTY(int pendingItemCount READ getPendingItemCount NOTIFY itemIncubationProgress FINAL)
+    //! \copydoc pendingItemCount
+    inline int              getPendingItemCount() const noexcept { return _incubationTotal - _incubationReady; }
+
+signals:
+    //! Emitted when an asynchronously inserted \c node item has been incubated and is visible in graph.
+    void                    nodeItemReady(qan::Node* node);
+    //! Emitted when an item incubation ends, \c ready on \c total items have been incubated since the beginning of the actual batch.
+    void                    itemIncubationProgress(int ready, int total);
+    //! Emitted when all pending items have been incubated.
+    void                    itemIncubationFinished();
+
+private:
+    friend class qan::NodeIncubator;
+    //! Configure incubated node item before its bindings are evaluated (called from NodeIncubator::setInitialState()).
+    void                    initNodeIncubation(qan::NodeIncubator& incubator, QObject* object) noexcept;
+    //! Finalize (or discard) an incubated node item (called from NodeIncubator::statusChanged()).
+    void                    nodeIncubationStatusChanged(qan::NodeIncubator& incubator, QQmlIncubator::Status status) noexcept;
+    //! Install a graph owned time sliced incubation controller on \c engine if it has none.
+    void                    ensureIncubationController(QQmlEngine& engine) noexcept;
+    //! Destroy finished incubators (deferred, an incubator can't be destroyed from its own callbacks).
+    void                    purgeIncubators() noexcept;
+    //! Cancel pending incubations and destroy all incubators.
+    void                    clearIncubators() noexcept;
+    //! Start \c incubator node item incubation (with graph QML context).
+    void                    startIncubation(qan::NodeIncubator& incubator) noexcept;
+    //! Count \c incubator as finished and schedule incubators purge.
+    void                    finishIncubation(qan::NodeIncubator& incubator) noexcept;
+
+    std::vector<std::unique_ptr<qan::NodeIncubator>>    _nodeIncubators;
+    std::unique_ptr<QQmlIncubationController>           _incubationController;
+    QPointer<QQmlEngine>    _incubationEngine;
+    int                     _incubationTotal = 0;
+    int                     _incubationReady = 0;
+    //! Number of started and not yet finished incubations.
+    int                     _runningIncubations = 0;
+    bool                    _incubatorsPurgePending = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Progressive Attachment *///-------------------------------------
+    //@{
+public:
+    /*! \brief Time budget in ms per frame used to create pending items, closest to viewport center first (default to 0, disabled).
+     *
+     * Pending items are node items of primitives inserted detached (see adopt() and \c headless) and node items inserted
+     * with insertNodeAsync(). When \c attachmentBudget is 0, detached primitives items are all created on next event
+     * loop iteration and incubations are started in insertion order.
+     *
+     * Otherwise, pending nodes are ordered by the distance of their geometry center (see qan::Node::geometry) to
+     * \c viewportRect center and attached once per frame until budget is exhausted (at most 16 incubations are running
+     * at a time): the region the user is looking at appears first even if total work is the same. Pending nodes are
+     * reordered when viewport center move by more than a tenth of viewport size (user pan or zoom). Edge items are
+     * created as soon as both their source and destination items exist.
+     * \code
+     * Qan.Graph {
+     *   attachmentBudget: 8    // ms per frame
+     *   onPendingAttachmentCountChanged: progressBar.visible = pendingAttachmentCount > 0
+     * }
+     * \endcode
+     */
+    Q_PROPERTY(int attachmentBudget READ getAttachmentBudget WRITE setAttachmentBudget NOTIFY attachmentBudgetChanged FINAL)
+    //! \copydoc attachmentBudget
+    inline int          getAttachmentBudget() const noexcept { return _attachmentBudget; }
+    //! \copydoc attachmentBudget
+    void                setAttachmentBudget(int attachmentBudget) noexcept;
+private:
+    int                 _attachmentBudget = 0;
+signals:
+    void                attachmentBudgetChanged();
+
+public:
+    //! Number of pending nodes whose item has not been created (or whose incubation has not been started).
+    Q_PROPERTY(int pendingAttachmentCount READ getPendingAttachmentCount NOTIFY pendingAttachmentCountChanged FINAL)
+    //! \copydoc pendingAttachmentCount
+    inline int          getPendingAttachmentCount() const noexcept { return static_cast<int>(_pendingAttachments.size()); }
+signals:
+    void                pendingAttachmentCountChanged();
+
+private:
+    //! Attach pending nodes items closest to viewport center for at most \c attachmentBudget ms (without limit when budget is 0).
+    void                attachPendingItems() noexcept;
+    //! Call attachPendingItems() on next frame (multiple calls within a frame are merged).
+    void                scheduleAttachmentFrame() noexcept;
+
+    struct PendingAttachment {
+        WeakNode                node;
+        //! Unstarted incubation of an asynchronously inserted node, nullptr for a detached node.
+        qan::NodeIncubator*     incubator = nullptr;
+    };
+    //! Pending nodes, ordered by decreasing distance to \c _attachmentCenter (closest is last) when \c _attachmentOrdered is true.
+    std::vector<PendingAttachment>  _pendingAttachments;
+    QPointF             _attachmentCenter;
+    bool                _attachmentOrdered = false;
+    bool                _attachmentFramePending = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Virtualization *///------------------------------------
+    //@{
+public:
+    /*! \brief When true, visual items are created only for nodes (and edges between them) intersecting \c viewportRect (default to false).
+     *
+     * In a virtualized graph, topology and geometry live in qan::Node (see qan::Node::geometry), node and edge items
+     * are created when primitives enter the viewport extended by \c virtualizationMargin and released (or recycled in
+     * item pool, see \c itemPoolSize) when they leave it, much like a ListView virtualize its delegates.
+     * \code
+     * Qan.GraphView {
+     *   graph: Qan.Graph {
+     *     virtualized: true
+     *     itemPoolSize: 256
+     *     Component.onCompleted: {
+     *       for (var n = 0; n < 100000; n++)
+     *         insertNode().geometry = Qt.rect(Math.random() * 50000, Math.random() * 50000, 100, 45)
+     *     }
+     *   }
+     * }
+     * \endcode
+     *
+     * \note Groups, grouped nodes and selected nodes always have an item.
+     * \note viewportRect is updated automatically by qan::GraphView when graph container item is zoomed or panned.
+     */
+    Q_PROPERTY(bool virtualized READ getVirtualized WRITE setVirtualized NOTIFY virtualizedChanged FINAL)
+    //! \copydoc virtualized
+    inline bool         getVirtualized() const noexcept { return _virtualized; }
+    //! \copydoc virtualized
+    void                setVirtualized(bool virtualized) noexcept;
+private:
+    bool                _virtualized = false;
+signals:
+    void                virtualizedChanged();
+
+public:
+    //! Margin (in container item coordinates) added around \c viewportRect when creating visual items (default to 200.).
+    Q_PROPERTY(qreal virtualizationMargin READ getVirtualizationMargin WRITE setVirtualizationMargin NOTIFY virtualizationMarginChanged FINAL)
+    //! \copydoc virtualizationMargin
+    inline qreal        getVirtualizationMargin() const noexcept { return _virtualizationMargin; }
+    //! \copydoc virtualizationMargin
+    void                setVirtualizationMargin(qreal virtualizationMargin) noexcept;
+private:
+    qreal               _virtualizationMargin = 200.;
+signals:
+    void                virtualizationMarginChanged();
+
+public:
+    //! Visible rectangle in graph container item coordinates (usually set by qan::GraphView).
+    Q_PROPERTY(QRectF viewportRect READ getViewportRect WRITE setViewportRect NOTIFY viewportRectChanged FINAL)
+    //! \copydoc viewportRect
+    inline QRectF       getViewportRect() const noexcept { return _viewportRect; }
+    //! \copydoc viewportRect
+    void                setViewportRect(const QRectF& viewportRect) noexcept;
+private:
+    QRectF              _viewportRect{};
+signals:
+    void                viewportRectChanged();
+
+public:
+    /*! \brief Register (or update) the visible rectangle of a secondary \c view (in graph container item coordinates).
+     *
+     * A graph has a single set of node and edge items, owned by its container item. Secondary views (see
+     * qan::GraphView::mirror) do not instantiate items, they render the region of the shared container they show:
+     * virtualization and culling use the union of \c viewportRect and all registered view rectangles, an item
+     * visible in several views is created only once.
+     */
+    void                setViewViewportRect(const QObject* view, const QRectF& viewportRect) noexcept;
+    //! Unregister a secondary \c view registered with setViewViewportRect().
+    void                removeViewViewport(const QObject* view) noexcept;
+    //! Return the number of registered secondary views.
+    inline std::size_t  getViewViewportCount() const noexcept { return _viewViewports.size(); }
+protected:
+    //! Return true if \c br intersect \c viewportRect or any secondary view rect extended by \c virtualizationMargin.
+    bool                intersectsViewports(const QRectF& br) const noexcept;
+    //! Return true if at least one viewport (main or secondary) is valid.
+    bool                hasValidViewport() const noexcept;
+private:
+    std::unordered_map<const QObject*, QRectF>  _viewViewports;
+
+public:
+    /*! \brief Create items of nodes and edges entering the viewport, release items of primitives leaving it.
+     *
+     * Complexity is O(V + E), update is usually triggered automatically (scheduled once per event loop iteration
+     * when viewport changes or nodes are inserted), call it manually after moving non visual nodes with qan::Node::setGeometry().
+     */
+    Q_INVOKABLE void    updateVirtualization() noexcept;
+
+protected:
+    //! Return true if \c node is eligible to virtualization (ungrouped non group node, without a selected item).
+    bool                isVirtualizable(const qan::Node& node) const noexcept;
+    //! Create \c node item from its registered delegate (item is positionned from node geometry).
+    bool                materializeNode(qan::Node& node) noexcept;
+    //! Release \c node item and its adjacent edges items, node geometry is stored in \c node.
+    void                virtualizeNode(qan::Node& node) noexcept;
+    //! Create \c edge item from its registered delegate (\c edge source and destination must have an item).
+    bool                materializeEdge(qan::Edge& edge) noexcept;
+    //! Release \c edge item.
+    void                virtualizeEdge(qan::Edge& edge) noexcept;
+    //! Schedule a deferred updateVirtualization() call (multiple calls within an event loop iteration are merged).
+    void                scheduleVirtualizationUpdate() noexcept;
+    //! Release (recycle or delete) a virtualized primitive \c item.
+    void                releaseVirtualizedItem(QQuickItem* item) noexcept;
+
+private:
+    //! Delegate component and style used to (re)create a virtualized node or edge item.
+    struct VirtualDelegate {
+        QPointer<QQmlComponent> component;
+        QPointer<qan::Style>    style;
+    };
+    std::unordered_map<const QObject*, VirtualDelegate> _virtualDelegates;
+    bool                _virtualizationUpdatePending = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Culling *///-------------------------------------------
+    //@{
+public:
+    /*! \brief When true, edge items and node labels lying fully outside \c viewportRect are culled (default to false).
+     *
+     * Culling area is \c viewportRect extended by \c virtualizationMargin. A culled edge item skip geometry generation
+     * (and is hidden) until its ends enter culling area, a culled node item has its \c culled property set (default
+     * delegates hide their label text). Unlike virtualization, items are not released.
+     * \note Culling is mainly useful for large non virtualized graphs, where most edges endpoints move (while dragging a
+     * group or laying out nodes) while being out of view.
+     * \warning Do not enable culling when grabbing a complete graph to an image.
+     */
+    Q_PROPERTY(bool viewportCulling READ getViewportCulling WRITE setViewportCulling NOTIFY viewportCullingChanged FINAL)
+    //! \copydoc viewportCulling
+    inline bool         getViewportCulling() const noexcept { return _viewportCulling; }
+    //! \copydoc viewportCulling
+    void                setViewportCulling(bool viewportCulling) noexcept;
+private:
+    bool                _viewportCulling = false;
+signals:
+    void                viewportCullingChanged();
+
+public:
+    //! Return true if \c br (in graph container item CS) lies fully outside culling area (always false when \c viewportCulling is false).
+    bool                isCulled(const QRectF& br) const noexcept;
+    //! Register a culled edge item, its geometry is updated when it enters culling area (called by qan::EdgeItem).
+    void                cullEdgeItem(qan::EdgeItem* edgeItem) noexcept;
+    //! Schedule a deferred updateCulling() call (multiple calls within an event loop iteration are merged).
+    void                scheduleCullingUpdate() noexcept;
+protected:
+    //! Update culled edges entering culling area and node items \c culled property, complexity is O(V + culled edges).
+    void                updateCulling() noexcept;
+private:
+    std::vector<QPointer<qan::EdgeItem>>    _culledEdgeItems;
+    bool                _cullingUpdatePending = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Central Picking *///--------------------------------------------
+    //@{
+public:
+    /*! \brief When true, edge items no longer accept mouse buttons and drops, pointer events are resolved by qan::GraphView with pickItem() (default to false).
+     *
+     * Qt Quick call QQuickItem::contains() on every item accepting mouse buttons (or drops) whose bounding rect overlap
+     * the cursor: in dense areas, hundreds of edge hit tests are run for a single press. With central picking, view resolve
+     * clicks, double clicks, drag enter/move/drop and hover with a single pickItem() spatial index query, edge signals
+     * (qan::EdgeItem::edgeClicked(), etc.) are then emitted on release instead of press.
+     * \note Node and group items are not modified (their drag controller still require press events).
+     */
+    Q_PROPERTY(bool centralPicking READ getCentralPicking WRITE setCentralPicking NOTIFY centralPickingChanged FINAL)
+    //! \copydoc centralPicking
+    inline bool         getCentralPicking() const noexcept { return _centralPicking; }
+    //! \copydoc centralPicking
+    void                setCentralPicking(bool centralPicking) noexcept;
+private:
+    //! Configure \c edgeItem mouse buttons and drops acceptance according to \c centralPicking.
+    void                configurePicking(qan::EdgeItem* edgeItem) const noexcept;
+    bool                _centralPicking = false;
+signals:
+    void                centralPickingChanged();
+
+public:
+    //! Item under cursor when \c centralPicking is enabled (a port, edge, node or group item, maintained by qan::GraphView).
+    Q_PROPERTY(QQuickItem* hoveredItem READ getHoveredItem NOTIFY hoveredItemChanged FINAL)
+    //! \copydoc hoveredItem
+    inline QQuickItem*  getHoveredItem() const noexcept { return _hoveredItem.data(); }
+    //! \copydoc hoveredItem
+    void                setHoveredItem(QQuickItem* hoveredItem) noexcept;
+private:
+    QPointer<QQuickItem>    _hoveredItem;
+signals:
+    void                hoveredItemChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Headless Mode *///----------------------------------------------
+    //@{
+public:
+    /*! \brief When true, nodes, edges and groups are inserted without creating any visual item (default to false).
+     *
+     * A headless graph keep topology, geometry (see qan::Node::geometry) and styles in qan::Node, qan::Edge and
+     * qan::Group: it could be built, laid out or exported without a window and without loading QML delegates (delegate
+     * components are optional, graph default delegates are used when items are finally created).
+     * Items are attached when \c headless is set back to false (only for primitives in viewport when graph is \c virtualized).
+     * \code
+     * qan::Graph graph;
+     * graph.setHeadless(true);
+     * const auto n1 = graph.insertNode();
+     * const auto n2 = graph.insertNode();
+     * n1->setGeometry(QRectF{0., 0., 100., 45.});
+     * n2->setGeometry(QRectF{200., 0., 100., 45.});
+     * graph.insertEdge(n1, n2);
+     * // ... Once graph has been embedded in a view:
+     * graph.setHeadless(false);
+     * \endcode
+     *
+     * \note Headless node geometry is expressed in graph coordinates, including grouped nodes geometry.
+     * \note Setting \c headless to true does not release already existing items.
+     */
+    Q_PROPERTY(bool headless READ getHeadless WRITE setHeadless NOTIFY headlessChanged FINAL)
+    //! \copydoc headless
+    inline bool         getHeadless() const noexcept { return _headless; }
+    //! \copydoc headless
+    void                setHeadless(bool headless) noexcept;
+private:
+    bool                _headless = false;
+signals:
+    void                headlessChanged();
+
+public:
+    /*! \brief Create item of a \c node (or group) inserted while graph was headless, grouped node item is reparented to its group item.
+     *
+     * Could be used to attach items progressively (for example in time sliced chunks, see qan::GraphImporter), host
+     * groups must be attached before their content.
+     * \return true if \c node has an item, false if it could not be created or if \c node is left to virtualization
+     * (see isVirtualizable()).
+     */
+    bool                attachNodeItem(qan::Node& node) noexcept;
+    /*! \brief Release item of a non group \c node (and its adjacent edges items), inverse of attachNodeItem().
+     *
+     * Node geometry, delegate and style are stored in \c node, item could be attached again with attachNodeItem().
+     * \return false if \c node is a group or has no item.
+     */
+    bool                detachNodeItem(qan::Node& node) noexcept;
+    //! Create item of an \c edge inserted while graph was headless (\c edge source and destination items must be attached).
+    bool                attachEdgeItem(qan::Edge& edge) noexcept;
+
+protected:
+    //! Create items of primitives inserted while graph was headless, grouped node items are reparented to their group item (node items are queued for attachPendingItems() with a non zero \c attachmentBudget).
+    void                attachItems() noexcept;
+    //! Create \c group item from its registered delegate (item is positionned from group geometry).
+    bool                materializeGroup(qan::Group& group) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Worker Thread Construction *///---------------------------------
+    //@{
+public:
+    /*! \brief Insert nodes and edges built on a worker thread with a finished qan::GraphBuilder.
+     *
+     * Primitives are inserted in one batch (see beginUpdate()) with gtpo::graph<>::insert_nodes_unchecked() and
+     * gtpo::graph<>::adopt_edges_unchecked(): their adjacency has already been linked by \c builder, GUI thread
+     * cost is O(V + E) containers insertions. Primitives are inserted detached, as in a headless graph, with
+     * graph default delegates and styles: their items are attached on next event loop iteration (or by
+     * updateVirtualization() in a virtualized graph, or when \c headless is set to false), progressively from
+     * viewport center with a non zero \c attachmentBudget.
+     *
+     * \return number of adopted nodes and edges, \c builder is empty after a successful adoption.
+     */
+    int                 adopt(qan::GraphBuilder& builder) noexcept;
+
+private:
+    //! Call attachItems() on next event loop iteration (multiple calls within an event loop iteration are merged).
+    void                scheduleItemsAttachment() noexcept;
+    bool                _itemsAttachmentPending = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Memory Accounting *///------------------------------------------
+    //@{
+public:
+    /*! \brief Return an estimation of graph memory footprint (see qan::MemoryStats for accounted objects).
+     *
+     * \code
+     * const auto stats = graph.getMemoryStats();
+     * qDebug() << "Bytes per node:" << (stats.nodeBytes + stats.itemBytes) / qMax(1, stats.nodeCount);
+     * \endcode
+     * \note Complexity is O(n + m + i) with i the number of items in primitives items trees, containers models are not created.
+     */
+    qan::MemoryStats    getMemoryStats() const noexcept;
+    //! QML interface to getMemoryStats(), returned map keys are qan::MemoryStats member names.
+    Q_INVOKABLE QVariantMap memoryStats() const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Level of Detail Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Actual view zoom used to select node items level of detail (default to 1.0, usually set by qan::GraphView).
+     *
+     * Graph \c levelOfDetail is Full above \c simplifiedZoom, Simplified between \c flatZoom and \c simplifiedZoom and
+     * Flat below \c flatZoom. Node items are only updated when zoom cross a threshold.
+     * \code
+     * Qan.GraphView {
+     *   graph: Qan.Graph {
+     *     id: graph
+     *     simplifiedZoom: 0.6
+     *     flatZoom: 0.3
+     *   }
+     *   Qan.NodeBatchRenderer {     // Optional, draw all nodes in a single scene graph node at Flat level
+     *     parent: graphView.containerItem
+     *     graph: graph
+     *   }
+     * }
+     * \endcode
+     */
+    Q_PROPERTY(qreal lodZoom READ getLodZoom WRITE setLodZoom NOTIFY lodZoomChanged FINAL)
+    //! \copydoc lodZoom
+    inline qreal        getLodZoom() const noexcept { return _lodZoom; }
+    //! \copydoc lodZoom
+    void                setLodZoom(qreal lodZoom) noexcept;
+private:
+    qreal               _lodZoom = 1.;
+signals:
+    void                lodZoomChanged();
+
+public:
+    //! Zoom below which node items are switched to Simplified level of detail (default to 0.5, 0. to disable).
+    Q_PROPERTY(qreal simplifiedZoom READ getSimplifiedZoom WRITE setSimplifiedZoom NOTIFY simplifiedZoomChanged FINAL)
+    //! \copydoc simplifiedZoom
+    inline qreal        getSimplifiedZoom() const noexcept { return _simplifiedZoom; }
+    //! \copydoc simplifiedZoom
+    void                setSimplifiedZoom(qreal simplifiedZoom) noexcept;
+private:
+    qreal               _simplifiedZoom = 0.5;
+signals:
+    void                simplifiedZoomChanged();
+
+public:
+    //! Zoom below which node items are switched to Flat level of detail (default to 0.25, 0. to disable).
+    Q_PROPERTY(qreal flatZoom READ getFlatZoom WRITE setFlatZoom NOTIFY flatZoomChanged FINAL)
+    //! \copydoc flatZoom
+    inline qreal        getFlatZoom() const noexcept { return _flatZoom; }
+    //! \copydoc flatZoom
+    void                setFlatZoom(qreal flatZoom) noexcept;
+private:
+    qreal               _flatZoom = 0.25;
+signals:
+    void                flatZoomChanged();
+
+public:
+    //! Actual node items level of detail (read-only, computed from \c lodZoom, \c simplifiedZoom and \c flatZoom).
+    Q_PROPERTY(qan::NodeItem::LevelOfDetail levelOfDetail READ getLevelOfDetail NOTIFY levelOfDetailChanged FINAL)
+    //! \copydoc levelOfDetail
+    inline qan::NodeItem::LevelOfDetail getLevelOfDetail() const noexcept { return _levelOfDetail; }
+private:
+    qan::NodeItem::LevelOfDetail    _levelOfDetail{qan::NodeItem::LevelOfDetail::Full};
+signals:
+    void                levelOfDetailChanged();
+
+public:
+    /*! \brief True when Flat nodes are drawn by a qan::NodeBatchRenderer (default to false, set by the renderer).
+     *
+     * When set, delegates hide their content at Flat level and a virtualized graph does not create items for nodes
+     * entering the viewport at Flat level: node items are created once a node first needs a real delegate.
+     */
+    Q_PROPERTY(bool flatBatched READ getFlatBatched WRITE setFlatBatched NOTIFY flatBatchedChanged FINAL)
+    //! \copydoc flatBatched
+    inline bool         getFlatBatched() const noexcept { return _flatBatched; }
+    //! \copydoc flatBatched
+    void                setFlatBatched(bool flatBatched) noexcept;
+private:
+    bool                _flatBatched = false;
+signals:
+    void                flatBatchedChanged();
+
+public:
+    //! True when node labels are drawn by a qan::LabelBatchRenderer (default to false, set by the renderer): delegates hide their label.
+    Q_PROPERTY(bool labelsBatched READ getLabelsBatched WRITE setLabelsBatched NOTIFY labelsBatchedChanged FINAL)
+    //! \copydoc labelsBatched
+    inline bool         getLabelsBatched() const noexcept { return _labelsBatched; }
+    //! \copydoc labelsBatched
+    void                setLabelsBatched(bool labelsBatched) noexcept;
+private:
+    bool                _labelsBatched = false;
+signals:
+    void                labelsBatchedChanged();
+
+public:
+    //! Return \c node actual style (node item style, or style used to create a virtualized node item), might return nullptr.
+    const qan::NodeStyle*   getNodeStyle(const qan::Node& node) const noexcept;
+    //! Set \c node item style, or style used to create \c node item when it is headless or virtualized.
+    void                    setNodeStyle(qan::Node& node, qan::NodeStyle* style) noexcept;
+    /*! \brief Return delegate component used to create \c node item (or to create it when it is headless or virtualized), might return nullptr.
+     *
+     * \note Delegate is known for pooled items, headless and virtualized nodes, otherwise delegate registered in styleManager
+     * for \c node style is returned.
+     */
+    QQmlComponent*          getNodeDelegate(const qan::Node& node) noexcept;
+    //! Return \c edge actual style (edge item style, or style used to create a virtualized edge item), might return nullptr.
+    const qan::EdgeStyle*   getEdgeStyle(const qan::Edge& edge) const noexcept;
+    //! Set \c edge item style, or style used to create \c edge item when it is headless or virtualized.
+    void                    setEdgeStyle(qan::Edge& edge, qan::EdgeStyle* style) noexcept;
+
+private:
+    //! Update \c levelOfDetail from actual zoom and thresholds, propagate a modified level to all node items.
+    void                updateLevelOfDetail() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Parallel Edges Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Distance between parallel edges connecting the same nodes pair (default to 0., fan-out disabled).
+     *
+     * When set, straight and curved edges connecting the same pair of nodes (in either direction) are drawn as
+     * offset curves fanned around their nodes center line instead of on top of each other. Siblings are detected
+     * with the graph adjacency index (see gtpo::node::for_each_out_edge()), ordered by edge id, and share their ends
+     * clipping (computed once per pair). Edges connected to ports, ortho and custom shape edges are not fanned.
+     * \code
+     * Qan.Graph {
+     *   parallelEdgeSpacing: 14
+     *   parallelEdgeCollapseZoom: 0.4   // Draw 3 or more parallel edges as a single counted edge below 0.4 zoom
+     *   parallelEdgeCollapseCount: 3
+     * }
+     * \endcode
+     */
+    Q_PROPERTY(qreal parallelEdgeSpacing READ getParallelEdgeSpacing WRITE setParallelEdgeSpacing NOTIFY parallelEdgeSpacingChanged FINAL)
+    //! \copydoc parallelEdgeSpacing
+    inline qreal        getParallelEdgeSpacing() const noexcept { return _parallelEdgeSpacing; }
+    //! \copydoc parallelEdgeSpacing
+    void                setParallelEdgeSpacing(qreal parallelEdgeSpacing) noexcept;
+private:
+    qreal               _parallelEdgeSpacing = 0.;
+signals:
+    void                parallelEdgeSpacingChanged();
+
+public:
+    //! \c lodZoom below which large parallel edges sets are collapsed in a single counted edge (default to 0., disabled).
+    Q_PROPERTY(qreal parallelEdgeCollapseZoom READ getParallelEdgeCollapseZoom WRITE setParallelEdgeCollapseZoom NOTIFY parallelEdgeCollapseZoomChanged FINAL)
+    //! \copydoc parallelEdgeCollapseZoom
+    inline qreal        getParallelEdgeCollapseZoom() const noexcept { return _parallelEdgeCollapseZoom; }
+    //! \copydoc parallelEdgeCollapseZoom
+    void                setParallelEdgeCollapseZoom(qreal parallelEdgeCollapseZoom) noexcept;
+private:
+    qreal               _parallelEdgeCollapseZoom = 0.;
+signals:
+    void                parallelEdgeCollapseZoomChanged();
+
+public:
+    //! Minimum parallel edges count for a set to be collapsed below \c parallelEdgeCollapseZoom (default to 4, minimum 2).
+    Q_PROPERTY(int parallelEdgeCollapseCount READ getParallelEdgeCollapseCount WRITE setParallelEdgeCollapseCount NOTIFY parallelEdgeCollapseCountChanged FINAL)
+    //! \copydoc parallelEdgeCollapseCount
+    inline int          getParallelEdgeCollapseCount() const noexcept { return _parallelEdgeCollapseCount; }
+    //! \copydoc parallelEdgeCollapseCount
+    void                setParallelEdgeCollapseCount(int parallelEdgeCollapseCount) noexcept;
+private:
+    int                 _parallelEdgeCollapseCount = 4;
+signals:
+    void                parallelEdgeCollapseCountChanged();
+
+public:
+    //! Return true if parallel edges sets are actually collapsed (\c lodZoom is below \c parallelEdgeCollapseZoom).
+    inline bool         isParallelEdgeCollapsed() const noexcept { return _lodZoom < _parallelEdgeCollapseZoom; }
+
+    //! Schedule a geometry update for all edge items connecting \c source and \c destination (in either direction), except \c except.
+    void                updateParallelEdges(const qan::Node* source, const qan::Node* destination,
+                                            const qan::Edge* except = nullptr) noexcept;
+
+private:
+    //! Schedule a geometry update of all fanned edge items (see qan::EdgeItem::getFanCount()).
+    void                updateFannedEdges() noexcept;
+
+    class ParallelEdgesBehaviour;
+    //! Reschedule parallel edges on edge insertion or removal, installed with a non 0 \c parallelEdgeSpacing.
+    void                installParallelEdgesBehaviour() noexcept;
+    //! Parallel edges behaviour is owned by gtpo::graph<>, it is destroyed by clear().
+    ParallelEdgesBehaviour* _parallelEdgesBehaviour = nullptr;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batched Graph Update *///---------------------------------------
+    //@{
+public:
+    /*! \brief Start a batched graph update, calls can be nested.
+     *
+     * Until the outermost endUpdate() call:
+     * \li nodeInserted() and edgeInserted() signals are not emitted (onNodeInserted() is still called).
+     * \li maxZChanged() is not emitted.
+     * \li GTpo behaviours insertion notifications are deferred (see gtpo::graph<>::notification_scope).
+     * \li Edge items geometry updates are deferred, each modified edge is updated once in endUpdate().
+     * \li qan::GraphView does not resize its container item on every inserted item.
+     *
+     * A single updateEnded() signal is emitted in endUpdate():
+     * \code
+     * graph.beginUpdate()
+     * for (var n = 0; n < 10000; n++)
+     *   graph.insertNode()
+     * graph.endUpdate()    // onUpdateEnded: called once
+     * \endcode
+     */
+    Q_INVOKABLE void    beginUpdate() noexcept;
+    //! End a batched graph update started with beginUpdate(), pending notifications are sent when outermost update ends.
+    Q_INVOKABLE void    endUpdate() noexcept;
+
+    //! True while a batched update is in progress (see beginUpdate()).
+    Q_PROPERTY(bool updating READ isUpdating NOTIFY updatingChanged FINAL)
+    //! \copydoc updating
+    inline bool         isUpdating() const noexcept { return _updateDepth > 0; }
+
+    //! Defer \c edgeItem geometry update to endUpdate() (called from qan::EdgeItem::updateItem() while graph is updating).
+    void                deferEdgeItemUpdate(qan::EdgeItem* edgeItem) noexcept;
+
+    /*! \brief Mark \c edgeItem dirty, dirty edges geometry is updated once before next frame.
+     *
+     * Called from qan::EdgeItem::updateItemSlot() when an edge source or destination item is moved or resized: a node move
+     * usually modify multiple properties (x, y, width, height) that are coalesced in a single qan::EdgeItem::updateItem().
+     * Dirty edges are updated on graph window QQuickWindow::afterAnimating() (or on next event loop iteration when graph
+     * is not displayed in a window).
+     */
+    void                scheduleEdgeItemUpdate(qan::EdgeItem* edgeItem) noexcept;
+    //! Immediately apply pending drags and update all dirty edge items geometry (see scheduleEdgeItemUpdate() and scheduleDragMove()).
+    Q_INVOKABLE void    flushEdgeItemUpdates() noexcept;
+
+    /*! \brief Apply node and group mouse drags once per frame (default to false).
+     *
+     * When enabled, qan::DraggableCtrl accumulate mouse move deltas and the complete drag move (group
+     * proposal, selection translation, edges update) is applied once before next frame: high frequency mice and
+     * tablets no longer trigger multiple drag moves per frame.
+     */
+    Q_PROPERTY(bool frameSynchronizedDrag READ getFrameSynchronizedDrag WRITE setFrameSynchronizedDrag NOTIFY frameSynchronizedDragChanged FINAL)
+    void                setFrameSynchronizedDrag(bool frameSynchronizedDrag) noexcept;
+    inline bool         getFrameSynchronizedDrag() const noexcept { return _frameSynchronizedDrag; }
+signals:
+    void                frameSynchronizedDragChanged();
+
+public:
+    //! Apply \c nodeItem pending drag move before next frame (called from qan::DraggableCtrl when \c frameSynchronizedDrag is true).
+    void                scheduleDragMove(qan::NodeItem* nodeItem) noexcept;
+protected:
+    //! Apply all pending drag moves (see scheduleDragMove()).
+    void                flushDragMoves() noexcept;
+private:
+    //! Expand \c edgeItems with dependent hyper edges items, in dependency order (see gtpo::order_hyper_dependents()).
+    void                orderHyperEdgeItems(std::vector<qan::EdgeItem*>& edgeItems) const noexcept;
+    //! Ensure flushEdgeItemUpdates() is called before next frame.
+    void                scheduleFrameUpdate() noexcept;
+    bool                                            _frameSynchronizedDrag = false;
+    std::vector<QPointer<qan::NodeItem>>            _pendingDragItems;
+
+signals:
+    //! \copydoc updating
+    void                updatingChanged();
+    //! Emitted once when the outermost batched update ends, with the number of nodes (and groups) and edges inserted during update.
+    void                updateEnded(int insertedNodes, int insertedEdges);
+
+protected:
+    //! Update deferred edge items geometry with qan::EdgeItem::updateItems(), every edge is updated once.
+    void                updateDeferredEdgeItems() noexcept;
+    //! Emit nodeInserted(), or count \c node insertion while graph is updating.
+    void                notifyNodeInserted(qan::Node* node) noexcept;
+    //! Emit edgeInserted(), or count \c edge insertion while graph is updating.
+    void                notifyEdgeInserted(qan::Edge* edge) noexcept;
+
+private:
+    int                 _updateDepth = 0;
+    int                 _updateInsertedNodes = 0;
+    int                 _updateInsertedEdges = 0;
+    bool                _updateMaxZModified = false;
+    std::vector<QPointer<qan::EdgeItem>>            _deferredEdgeItems;
+    std::unordered_set<const qan::EdgeItem*>        _deferredEdgeItemsSet;
+    QPointer<QQuickWindow>                          _edgeUpdateWindow;
+    bool                                            _edgeUpdateScheduled = false;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Coalesced Change Notifications *///-----------------------------
+    //@{
+public:
+    /*! \brief Flush policy of coalesced change signals (default to \c Disabled).
+     *
+     * \li \c Disabled: no change is collected, coalesced signals are never emitted (no overhead).
+     * \li \c Frame: changes are flushed once per frame (or on next event loop iteration when graph is not in a window).
+     * \li \c Interval: changes are flushed at most every \c changeFlushInterval milliseconds.
+     * \li \c Manual: changes are flushed on flushChanges() calls only.
+     *
+     * Changes are never flushed while graph is updating (see beginUpdate()).
+     */
+    enum ChangeFlushPolicy { Disabled, Frame, Interval, Manual };
+    Q_ENUM(ChangeFlushPolicy)
+
+    /*! \brief Collect per primitive change signals and emit them in batches.
+     *
+     * QML consumers (sidebars, minimaps, autosave) could subscribe to one batched notification instead of
+     * nodeMoved(), nodeResized(), groupResized(), nodeLabelChanged() and insertion signals emitted once per
+     * primitive. Every node appear once in a batch, nodes destroyed before flush are skipped:
+     * \code
+     * Qan.Graph {
+     *   changeFlushPolicy: Qan.Graph.Interval
+     *   changeFlushInterval: 500
+     *   onNodesMovedCoalesced: autosave.save()
+     *   onTopologyChanged: minimap.refresh()
+     * }
+     * \endcode
+     */
+    Q_PROPERTY(ChangeFlushPolicy changeFlushPolicy READ getChangeFlushPolicy WRITE setChangeFlushPolicy NOTIFY changeFlushPolicyChanged FINAL)
+    //! \copydoc changeFlushPolicy
+    inline ChangeFlushPolicy    getChangeFlushPolicy() const noexcept { return _changeFlushPolicy; }
+    //! \copydoc changeFlushPolicy
+    void                        setChangeFlushPolicy(ChangeFlushPolicy changeFlushPolicy) noexcept;
+private:
+    ChangeFlushPolicy           _changeFlushPolicy = ChangeFlushPolicy::Disabled;
+signals:
+    void                        changeFlushPolicyChanged();
+
+public:
+    //! Minimum delay in milliseconds between two flushes with \c Interval \c changeFlushPolicy (default to 100).
+    Q_PROPERTY(int changeFlushInterval READ getChangeFlushInterval WRITE setChangeFlushInterval NOTIFY changeFlushIntervalChanged FINAL)
+    //! \copydoc changeFlushInterval
+    inline int                  getChangeFlushInterval() const noexcept { return _changeFlushInterval; }
+    //! \copydoc changeFlushInterval
+    void                        setChangeFlushInterval(int changeFlushInterval) noexcept;
+private:
+    int                         _changeFlushInterval = 100;
+signals:
+    void                        changeFlushIntervalChanged();
+
+public:
+    //! Emit pending coalesced change signals (nothing is done while graph is updating or if there is no pending change).
+    Q_INVOKABLE void            flushChanges() noexcept;
+
+signals:
+    //! Coalesced nodeMoved() and nodesMoved(): nodes (and groups) moved since last flush.
+    void                        nodesMovedCoalesced(const QObjectList& nodes);
+    //! Coalesced nodeResized() and groupResized(): nodes (and groups) resized since last flush.
+    void                        nodesResizedCoalesced(const QObjectList& nodes);
+    //! Coalesced nodeLabelChanged(): nodes whose label has changed since last flush.
+    void                        nodesLabelChangedCoalesced(const QObjectList& nodes);
+    /*! \brief Emitted when graph topology has changed since last flush.
+     *
+     * \c delta contains \c insertedNodes and \c insertedEdges lists (primitives inserted outside of a batched update and
+     * still alive), \c insertedNodeCount and \c insertedEdgeCount (including batched insertions) and \c removedNodeCount.
+     * Modifications without a dedicated signal (edge removal, grouping) are reported on next flush with an otherwise empty delta.
+     */
+    void                        topologyChanged(const QVariantMap& delta);
+
+private:
+    //! Ordered set of nodes modified since last flush.
+    struct CoalescedNodes {
+        std::vector<QPointer<qan::Node>>        nodes;
+        std::unordered_set<const qan::Node*>    set;
+        void        add(qan::Node* node) noexcept;
+        //! Return alive nodes and reset.
+        QObjectList take() noexcept;
+        inline bool empty() const noexcept { return nodes.empty(); }
+    };
+    //! Connect (or disconnect) change collection according to \c changeFlushPolicy.
+    void                        configureChangeCollection() noexcept;
+    //! Schedule next flush according to \c changeFlushPolicy.
+    void                        scheduleChangeFlush() noexcept;
+    bool                        hasPendingChanges() const noexcept;
+    CoalescedNodes              _movedNodes;
+    CoalescedNodes              _resizedNodes;
+    CoalescedNodes              _labelChangedNodes;
+    std::vector<QPointer<qan::Node>>    _changeInsertedNodes;
+    std::vector<QPointer<qan::Edge>>    _changeInsertedEdges;
+    int                         _changeInsertedNodeCount = 0;
+    int                         _changeInsertedEdgeCount = 0;
+    int                         _changeRemovedNodeCount = 0;
+    //! Topology revision at last flush.
+    std::uint64_t               _changeRevision = 0;
+    bool                        _changeFlushScheduled = false;
+    std::vector<QMetaObject::Connection>    _changeConnections;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Node Columns *///-----------------------------------------------
+    //@{
+public:
+    /*! \brief Maintain a columnar copy of node items geometry indexed by node handle (default to false, see qan::NodeColumns).
+     *
+     * When enabled, batch algorithms (layout, indexing, export) read node geometry from contiguous arrays
+     * instead of calling QQuickItem properties on every node item. Columns and items are synchronized in
+     * both directions at frame boundary (see syncNodeColumns()).
+     */
+    Q_PROPERTY(bool nodeColumnsEnabled READ getNodeColumnsEnabled WRITE setNodeColumnsEnabled NOTIFY nodeColumnsEnabledChanged FINAL)
+    void                setNodeColumnsEnabled(bool nodeColumnsEnabled) noexcept;
+    inline bool         getNodeColumnsEnabled() const noexcept { return _nodeColumns != nullptr; }
+signals:
+    void                nodeColumnsEnabledChanged();
+
+public:
+    /*! \brief Return node columns with item modifications pulled, or nullptr when \c nodeColumnsEnabled is false.
+     *
+     * Call commitNodeColumns() after modifying geometry rows (see qan::NodeColumns::markModified()).
+     */
+    qan::NodeColumns*       getNodeColumns() noexcept;
+    const qan::NodeColumns* getNodeColumns() const noexcept;
+    //! Push modified columns rows to node items at next frame boundary.
+    void                commitNodeColumns() noexcept;
+    /*! \brief Immediately synchronize node columns: pull modified items geometry, then push modified rows to items.
+     *
+     * Rows are pushed in a batched update (see beginUpdate()), adjacent edges are updated once.
+     */
+    Q_INVOKABLE void    syncNodeColumns() noexcept;
+private:
+    //! Mark \c nodeItem node row dirty in node columns.
+    void                markNodeColumnsDirty(const QQuickItem* item) noexcept;
+    mutable std::unique_ptr<qan::NodeColumns>   _nodeColumns;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Edge Routing *///------------------------------------------
+    //@{
+public:
+    /*! \brief Route orthogonal edges around nodes and groups (default to false).
+     *
+     * When enabled, qan::EdgeStyle::LineType::Ortho edges are routed around graph container childs with
+     * a qan::OrthoRouter (see \c orthoRouter to configure routing margin and bend penalty).
+     */
+    Q_PROPERTY(bool orthoRouting READ getOrthoRouting WRITE setOrthoRouting NOTIFY orthoRoutingChanged FINAL)
+    void                setOrthoRouting(bool orthoRouting) noexcept;
+    inline bool         getOrthoRouting() const noexcept { return _orthoRouter != nullptr; }
+signals:
+    void                orthoRoutingChanged();
+
+public:
+    //! Orthogonal edge router, nullptr when \c orthoRouting is false.
+    Q_PROPERTY(qan::OrthoRouter* orthoRouter READ getOrthoRouter NOTIFY orthoRoutingChanged FINAL)
+    inline qan::OrthoRouter*    getOrthoRouter() const noexcept { return _orthoRouter.data(); }
+private:
+    QPointer<qan::OrthoRouter>  _orthoRouter;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Node Management *///---------------------------------------
     //@{
 public:
@@ -366,6 +1392,11 @@ public:
      */
     Q_INVOKABLE void        removeNode(qan::Node* node);
 
+private:
+    //! Notify and release graph bookkeeping for \c node (or group) before it is removed from topology.
+    void                    prepareNodeRemoval(qan::Node& node);
+
+public:
     //! Shortcut to gtpo::GenGraph<>::getNodeCount().
     Q_INVOKABLE int         getNodeCount() const noexcept;
 
@@ -421,6 +1452,12 @@ signals:
      */
     void            nodeMoved(qan::Node* node);
 
+    /*! \brief Emitted _after_ a batch of nodes (or groups) has been moved (for example by alignSelection*() methods).
+     *
+     * \note nodeMoved() is not emitted for nodes moved in a batch.
+     */
+    void            nodesMoved(const QObjectList& nodes);
+
     /*! \brief Emitted _after_ a node has been resized.
      */
     void            nodeResized(qan::Node* node);
@@ -429,6 +1466,10 @@ signals:
      */
     void            groupResized(qan::Group* group);
 
+    /*! \brief Emitted _after_ a group has been collapsed or expanded.
+     */
+    void            groupCollapsed(qan::Group* group, bool collapsed);
+
     //! Emitted when a node setLabel() method is called.
     void            nodeLabelChanged(qan::Node* node);
     //-------------------------------------------------------------------------
@@ -468,12 +1509,43 @@ public:
      */
     virtual bool            isEdgeDestinationBindable(const qan::PortItem& inPort) const noexcept;
 
+    /*! \brief Test if an edge from \c source to \c destination could be inserted in graph.
+     *
+     * Method is called by insertEdge() and visual connector _before_ an edge is inserted, an
+     * edge is not inserted if it return false. Default implementation return false if
+     * \c acyclic property is set and edge would create a circuit.
+     */
+    virtual bool            isEdgeInsertable(qan::Node& source, qan::Node& destination) const noexcept;
+
+public:
+    /*! \brief When set to true, edges that would create a circuit are not inserted (default to false).
+     *
+     * Graph maintains an incremental topological order (gtpo::topological_order_behaviour), checking
+     * an edge insertion does not require a full gtpo::is_dag() traversal.
+     * \note Existing circuits are not removed when acyclic is set.
+     */
+    Q_PROPERTY(bool acyclic READ getAcyclic WRITE setAcyclic NOTIFY acyclicChanged FINAL)
+    inline bool             getAcyclic() const noexcept { return _acyclic; }
+    void                    setAcyclic(bool acyclic) noexcept;
+signals:
+    void                    acyclicChanged();
+private:
+    //! Install (if necessary) and reset topological order behaviour, return false on error.
+    bool                    resetTopologicalOrder() noexcept;
+    bool                    _acyclic = false;
+    using TopologicalOrder  = gtpo::topological_order_behaviour<qan::Config>;
+    //! Topological order behaviour is owned by gtpo::graph<>, it is destroyed by clear().
+    TopologicalOrder*       _topologicalOrder = nullptr;
+
     //! Bind an existing edge source to a visual out port.
     virtual void            bindEdgeSource(qan::Edge& edge, qan::PortItem& outPort) noexcept;
 
     //! Bind an existing edge destination to a visual in port.
     virtual void            bindEdgeDestination(qan::Edge& edge, qan::PortItem& inPort) noexcept;
 
+    //! Remove \c edgeItem from its source and destination ports edges lists (edge is removed or its item recycled).
+    void                    unbindEdgeItemPorts(qan::EdgeItem& edgeItem) noexcept;
+
 public:
     template <class Edge_t>
     qan::Edge*              insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent* edgeComponent = nullptr);
@@ -481,13 +1553,28 @@ private:
     /*! \brief Internal utility used to insert an existing edge \c edge to either a destination \c dstNode node OR edge \c dstEdge.
      *
      * \note insertEdgeImpl() will automatically create \c edge graphical delegate using \c edgeComponent and \c style.
+     * \note \c edgeComponent might be nullptr only in headless mode.
      */
-    bool                    configureEdge(qan::Edge& source, QQmlComponent& edgeComponent, qan::EdgeStyle& style,
+    bool                    configureEdge(qan::Edge& source, QQmlComponent* edgeComponent, qan::EdgeStyle& style,
                                           qan::Node& src, qan::Node* dstNode);
 public:
     template <class Edge_t>
     qan::Edge*              insertNonVisualEdge(qan::Node& src, qan::Node* dstNode);
 
+    /*! \brief Insert a non visual restricted hyper edge from \c source node to \c destination edge (for example an annotation link).
+     *
+     * Hyper edges are indexed per destination edge (see gtpo::edge<>::get_in_hedges()) and removed with their destination
+     * edge or source node. Hyper edges have no default delegate and are not recorded in undo stack: when an item is
+     * set with qan::Edge::setItem(), it is updated by edge frame scheduler once, after its destination edge item
+     * (see scheduleEdgeItemUpdate()).
+     * \return inserted hyper edge or nullptr if \c source or \c destination is nullptr or not part of this graph.
+     */
+    Q_INVOKABLE qan::Edge*  insertHyperEdge(qan::Node* source, qan::Edge* destination);
+
+private:
+    //! Remove hyper edges from \c node and hyper edges to \c node adjacent edges (with their items).
+    void                    removeHyperEdges(qan::Node& node);
+
 public:
     //! Shortcut to gtpo::GenGraph<>::removeEdge().
     Q_INVOKABLE virtual void    removeEdge(qan::Node* source, qan::Node* destination);
@@ -526,6 +1613,90 @@ signals:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name External Id Index *///------------------------------------------
+    //@{
+public:
+    /*! \brief Insert a node indexed with an external \c id, return nullptr if \c id is empty or already used.
+     *
+     * Index is optional and costs nothing when no id is set, it is maintained when primitives are removed:
+     * \code
+     * // Synchronize graph with a domain model in O(changes)
+     * for (const auto& change : changes) {
+     *     auto node = graph.nodeById(change.id);
+     *     if (node == nullptr)
+     *         node = graph.insertNode(change.id);
+     *     node->setLabel(change.label);
+     * }
+     * \endcode
+     * \note Node (and group) ids and edge ids are independent namespaces.
+     */
+    Q_INVOKABLE qan::Node*  insertNode(const QString& id, QQmlComponent* nodeComponent = nullptr, qan::NodeStyle* nodeStyle = nullptr);
+    //! Insert an edge indexed with an external \c id, return nullptr if \c id is empty or already used.
+    Q_INVOKABLE qan::Edge*  insertEdge(const QString& id, qan::Node* source, qan::Node* destination, QQmlComponent* edgeComponent = nullptr);
+
+    //! Return node (or group) with external \c id, or nullptr.
+    Q_INVOKABLE qan::Node*  nodeById(const QString& id) const noexcept;
+    //! Return edge with external \c id, or nullptr.
+    Q_INVOKABLE qan::Edge*  edgeById(const QString& id) const noexcept;
+    //! Return external id of a node, group or edge \c primitive (empty if \c primitive is not indexed).
+    Q_INVOKABLE QString     getPrimitiveId(QObject* primitive) const noexcept;
+
+    //! Index \c node with external \c id (an empty \c id remove \c node from index), return false if \c id is used by another node.
+    Q_INVOKABLE bool        setNodeId(qan::Node* node, const QString& id) noexcept;
+    //! Index \c edge with external \c id (an empty \c id remove \c edge from index), return false if \c id is used by another edge.
+    Q_INVOKABLE bool        setEdgeId(qan::Edge* edge, const QString& id) noexcept;
+
+public:
+    //! External id hash functor (std::hash<QString> is not available with all supported Qt versions).
+    struct IdHash {
+        std::size_t operator()(const QString& id) const noexcept { return static_cast<std::size_t>(qHash(id)); }
+    };
+    //! Graph topology described with external ids, see gtpo::id_topology.
+    using IdTopology    = gtpo::id_topology<QString>;
+    //! Operations transforming an IdTopology into another one, see gtpo::diff_topology().
+    using TopologyDiff  = gtpo::topology_diff<QString>;
+
+    /*! \brief Return indexed graph topology: nodes (and groups) and edges with an external id.
+     *
+     * An indexed edge end that has no external id is described with an empty id.
+     */
+    IdTopology              getIdTopology() const;
+
+    /*! \brief Synchronize graph indexed primitives with \c topology (for example a fresh backend snapshot) in O(changes).
+     *
+     * Actual indexed topology is compared to \c topology with gtpo::diff_topology() and resulting operations are
+     * applied with applyTopologyDiff(): unchanged nodes and edges keep their items, positions and layout state,
+     * unlike a clearGraph() followed by a full reinsertion.
+     * \code
+     * qan::Graph::IdTopology fresh;
+     * fresh.nodes = {"a", "b"};
+     * fresh.edges = {{"ab", "a", "b"}};
+     * graph.synchronize(fresh);
+     * \endcode
+     * \return number of applied operations.
+     */
+    int                     synchronize(const IdTopology& topology) noexcept;
+
+    /*! \brief Apply \c diff operations to graph indexed primitives in a single beginUpdate() / endUpdate() batch.
+     *
+     * Added nodes and edges are inserted with default delegates and indexed with their id, rewired edges are
+     * removed and inserted again between their new ends with their actual style (rewired edge items are recreated).
+     * Operations referencing a missing primitive are ignored.
+     * \return number of applied operations.
+     */
+    int                     applyTopologyDiff(const TopologyDiff& diff) noexcept;
+
+protected:
+    //! Remove \c primitive from external id index.
+    void                    unindexPrimitive(const QObject* primitive) noexcept;
+
+private:
+    QHash<QString, QPointer<qan::Node>>         _nodesById;
+    QHash<QString, QPointer<qan::Edge>>         _edgesById;
+    std::unordered_map<const QObject*, QString> _primitiveIds;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Group Management *///--------------------------------------
     //@{
 public:
@@ -572,6 +1743,55 @@ public:
     //! Ungroup node \c node from group \c group (using nullptr for \c group ungroup node from it's current group without further topology checks).
     Q_INVOKABLE virtual bool    ungroupNode(qan::Node* node, qan::Group* group = nullptr, bool transform = true) noexcept;
 
+    /*! \brief Group all \c nodes inside \c group in one pass (topology and visual items are modified once).
+     *
+     * Faster than multiple groupNode() calls for large selections: group membership is hashed and node items
+     * are reparented with a single group adjacent edges update. nullptr nodes, \c group itself and nodes already
+     * in \c group are ignored.
+     *
+     * \return true if all nodes were grouped, false on error.
+     * \sa groupNode()
+     */
+    virtual bool    groupNodes(qan::Group* group, const std::vector<qan::Node*>& nodes, bool transform = true) noexcept;
+
+    /*! \brief Ungroup all \c nodes from \c group in one pass (using nullptr for \c group ungroup nodes from their current group).
+     *
+     * \return true if all nodes were ungrouped, false on error (for example when a node is not part of \c group).
+     * \sa ungroupNode()
+     */
+    virtual bool    ungroupNodes(const std::vector<qan::Node*>& nodes, qan::Group* group = nullptr, bool transform = true) noexcept;
+
+    /*! \brief Group nodes of every connected component with at least \c minimumSize nodes in a new group.
+     *
+     * Components are computed on a topology snapshot with gtpo::weakly_connected_components(), or with
+     * gtpo::strongly_connected_components() when \c strongly is true. Only top level nodes are grouped (groups
+     * and already grouped nodes are ignored), each group is created around its nodes bounding rectangle.
+     * All groups are inserted in a single beginUpdate() / endUpdate() batch and recorded as one undo entry.
+     *
+     * \return number of created groups.
+     * \sa groupNodes()
+     */
+    Q_INVOKABLE int groupComponents(bool strongly = false, int minimumSize = 2) noexcept;
+
+    /*! \brief Detect communities with gtpo::parallel_label_propagation() and group every community with at least \c minimumSize nodes.
+     *
+     * Intended to reduce visual load on large unstructured graphs: groups are created as in groupComponents(), when
+     * \c collapse is true they are collapsed (use a qan::EdgeAggregator to aggregate edges between collapsed groups).
+     * Community detection run on a topology snapshot with \c maxIterations label propagation sweeps.
+     *
+     * \return number of created groups.
+     */
+    Q_INVOKABLE int groupCommunities(int maxIterations = 20, int minimumSize = 2, bool collapse = true) noexcept;
+
+private:
+    /*! \brief Group top level nodes of \c graphSnapshot with the same \c partition id in a new group (\c partition is indexed by snapshot dense node index).
+     *
+     * Partitions with less than \c minimumSize nodes are ignored, groups are inserted in one batch and one \c undoText undo macro.
+     */
+    int             groupPartition(const gtpo_graph_t::shared_snapshot_t& graphSnapshot,
+                                   const std::vector<gtpo_graph_t::snapshot_t::index_t>& partition,
+                                   int minimumSize, bool collapse, const QString& undoText) noexcept;
+
 signals:
 
     /*! \brief Emitted when a group registered in this graph is clicked.
@@ -586,6 +1806,67 @@ signals:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Binary Serialization *///----------------------------------------
+    //@{
+public:
+    /*! \brief Save graph topology, node and group geometry (x, y, width, height, z), labels and group membership to \c filePath.
+     *
+     * Graph is written in GTpo binary graph format (see gtpo::binary_header).
+     * \note Ports, edge labels and styles are not saved.
+     * \return true on success, false on IO error.
+     */
+    Q_INVOKABLE bool    saveBinary(const QString& filePath) const noexcept;
+
+    /*! \brief Load a GTpo binary graph from \c filePath and insert it in this graph.
+     *
+     * File is memory mapped and topology is bulk created first (nodes, groups, edges and group membership) with a
+     * single behaviours notification, visual items are then created with default node, group and edge delegates and
+     * configured from file geometry and labels.
+     * \return true on success, false if file can't be read or is not a valid binary graph.
+     */
+    Q_INVOKABLE bool    loadBinary(const QString& filePath) noexcept;
+
+    /*! \brief Copy selected nodes and groups (with their content) and edges between them to graph clipboard.
+     *
+     * Selection induced subgraph is serialized in a compact binary buffer: a GTpo binary graph (topology, labels,
+     * geometry and group membership) followed by node and edge style and delegate references. Geometry of top
+     * level copied items is stored relative to their bounding rectangle top left corner.
+     * \return number of copied nodes and groups (0 if selection is empty or on error).
+     */
+    Q_INVOKABLE int     copySelection() noexcept;
+
+    /*! \brief Paste graph clipboard content with its top left corner at \c at (in graph container coordinates).
+     *
+     * Topology is bulk inserted in a single beginUpdate() / endUpdate() batch, items are created with copied
+     * delegates and styles through the item pool (default delegates and styles are used when a referenced one
+     * has been destroyed). Pasted items are stacked over existing items with one maxZ update and pasted top level
+     * nodes and groups become the current selection. Paste is recorded as a single undo entry.
+     * \return number of pasted nodes and groups.
+     */
+    Q_INVOKABLE int     pasteSubgraph(QPointF at) noexcept;
+
+    //! Number of nodes and groups in graph clipboard (0 when clipboard is empty).
+    Q_PROPERTY(int clipboardCount READ getClipboardCount NOTIFY clipboardChanged FINAL)
+    //! \copydoc clipboardCount
+    inline int          getClipboardCount() const noexcept { return _clipboardCount; }
+private:
+    //! Clipboard binary buffer (8 bytes aligned storage, as expected by gtpo::binary_graph_view).
+    std::vector<std::uint64_t>      _clipboard;
+    std::size_t                     _clipboardSize = 0;
+    int                             _clipboardCount = 0;
+    //! Styles and delegate components referenced from clipboard buffer.
+    std::vector<QPointer<QObject>>  _clipboardReferences;
+signals:
+    void                clipboardChanged();
+
+private:
+    //! Create and configure \c node visual item from \c nodeComponent (\c node must already be inserted in graph).
+    qan::NodeItem*      createNodeItem(qan::Node& node, QQmlComponent& nodeComponent, qan::NodeStyle& nodeStyle);
+    //! Create and configure \c group visual item from \c groupComponent (\c group must already be inserted in graph).
+    qan::GroupItem*     createGroupItem(qan::Group& group, QQmlComponent& groupComponent, qan::NodeStyle& groupStyle);
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Selection Management *///----------------------------------------
     //@{
 public:
@@ -641,8 +1922,26 @@ private:
 signals:
     void            selectionMarginChanged();
 
+public:
+    /*! \brief Draw all selection rectangles from a single qan::SelectionOverlay scene graph node (default to false).
+     *
+     * When enabled, no selection item is created from \c selectionDelegate for selected nodes and groups, they only
+     * keep their \c selected flag, existing selection items are hidden. Should be enabled for large selections
+     * (rubber band selection of thousands of nodes).
+     */
+    Q_PROPERTY( bool selectionOverlay READ getSelectionOverlay WRITE setSelectionOverlay NOTIFY selectionOverlayChanged FINAL )
+    void            setSelectionOverlay( bool selectionOverlay ) noexcept;
+    inline bool     getSelectionOverlay() const noexcept { return _selectionOverlay; }
+private:
+    bool            _selectionOverlay = false;
+    QPointer<qan::SelectionOverlay> _selectionOverlayItem;
+signals:
+    void            selectionOverlayChanged();
+
 protected:
     /*! \brief Force a call to qan::Selectable::configureSelectionItem() call on all currently selected primitives (either nodes or group).
+     *
+     * \note O(1) when \c selectionOverlay is enabled, overlay is rebuilt once on next frame.
      */
     void            configureSelectionItems() noexcept;
 
@@ -662,6 +1961,26 @@ public:
     //! \copydoc setNodeSelected
     Q_INVOKABLE void    setNodeSelected(qan::Node* node, bool selected);
 
+    /*! \brief Set the selection state of multiple nodes in one batch (graph selectionPolicy is not taken into account).
+     *
+     * Cost is O(nodes.size()), selection models are rebuilt once (see \c selectedNodes).
+     */
+    void                setNodesSelected(const std::vector<qan::Node*>& nodes, bool selected);
+
+    /*! \brief Select all nodes (groups are not selected), O(nodes) and independent of current selection size.
+     *
+     * Only existing items \c selected flag are set: virtualized or headless nodes are selected without creating
+     * their item (item is selected once materialized). Does nothing with a \c NoSelection policy.
+     */
+    Q_INVOKABLE void    selectAll();
+    //! Invert selection state of all nodes (groups are unselected), see selectAll().
+    Q_INVOKABLE void    invertSelection();
+
+    //! Return true if \c node (or group) is selected, O(1).
+    inline bool         isSelected(const qan::Node& node) const noexcept { return _selection.contains(node); }
+    //! \copydoc isSelected
+    Q_INVOKABLE bool    isNodeSelected(qan::Node* node) const noexcept { return node != nullptr && _selection.contains(*node); }
+
     //! Similar to selectNode() for qan::Group (internally group is a node).
     bool            selectGroup(qan::Group& group, Qt::KeyboardModifiers modifiers = Qt::NoModifier);
 
@@ -685,33 +2004,62 @@ public:
     Q_INVOKABLE void    clearSelection();
 
     //! Return true if multiple node are selected.
-    inline  bool    hasMultipleSelection() const noexcept { return _selectedNodes.size() > 0 || _selectedGroups.size() > 0; }
+    inline  bool    hasMultipleSelection() const noexcept { return !_selection.empty(); }
+
+public:
+    //! Selection bitset (selected nodes and groups), source of \c selectedNodes and \c selectedGroups models.
+    inline const qan::SelectionSet& getSelection() const noexcept { return _selection; }
+    //! Selection version, incremented on every effective selection modification.
+    inline quint64      getSelectionVersion() const noexcept { return _selection.getVersion(); }
+private:
+    qan::SelectionSet   _selection;
+    //! Delta published with selectionModified() (vectors capacity is reused).
+    qan::SelectionDelta _selectionDelta;
+    bool                _selectionUpdatePending = false;
+    //! True when \c selectedNodes and \c selectedGroups must be rebuilt from selection bitset.
+    mutable bool        _selectionModelsDirty = false;
+    //! Mark selection models dirty and schedule publication of a selection delta on next event loop iteration.
+    void                scheduleSelectionUpdate() noexcept;
+    //! Rebuild \c selectedNodes and \c selectedGroups from selection bitset if necessary (single model reset).
+    void                syncSelectionModels() const noexcept;
+    //! Create and configure \c node item selection item (unless \c selectionOverlay is set) and set item \c selected flag.
+    void                selectItem(qan::Node& node) noexcept;
+signals:
+    /*! \brief Emitted at most once per event loop iteration with nodes (and groups) selected and unselected since previous emission.
+     *
+     * Selection models are synchronized before emission.
+     */
+    void                selectionModified(const qan::SelectionDelta& delta);
 
 public:
     using SelectedNodes = qcm::Container<QVector, qan::Node*>;
 
-    //! Read-only list model of currently selected nodes.
+    /*! \brief Read-only list model of currently selected nodes.
+     *
+     * Model is derived lazily from selection bitset: it is rebuilt with a single reset when accessed (or once per
+     * event loop iteration) after selection modifications, in selection order.
+     */
     Q_PROPERTY(QAbstractItemModel* selectedNodes READ getSelectedNodesModel NOTIFY selectedNodesChanged FINAL)  // In fact non-notifiable, avoid QML warning
-    QAbstractItemModel* getSelectedNodesModel() { return qobject_cast<QAbstractItemModel*>(_selectedNodes.model()); }
+    QAbstractItemModel* getSelectedNodesModel() { syncSelectionModels(); return qobject_cast<QAbstractItemModel*>(_selectedNodes.model()); }
 
-    inline auto         getSelectedNodes() noexcept -> SelectedNodes& { return _selectedNodes; }
-    inline auto         getSelectedNodes() const noexcept -> const SelectedNodes& { return _selectedNodes; }
+    //! Currently selected nodes, in selection order (read-only, modify selection with setNodeSelected() or clearSelection()).
+    inline auto         getSelectedNodes() const noexcept -> const SelectedNodes& { syncSelectionModels(); return _selectedNodes; }
 private:
-    SelectedNodes       _selectedNodes;
+    mutable SelectedNodes   _selectedNodes;
 signals:
     void                selectedNodesChanged();
 
 public:
     using SelectedGroups = qcm::Container<QVector, qan::Group*>;
 
-    //! Read-only list model of currently selected groups.
+    //! Read-only list model of currently selected groups (derived lazily, see \c selectedNodes).
     Q_PROPERTY(QAbstractItemModel* selectedGroups READ getSelectedGroupsModel NOTIFY selectedGroupsChanged FINAL)   // In fact non-notifiable, avoid QML warning
-    QAbstractItemModel* getSelectedGroupsModel() { return qobject_cast<QAbstractItemModel*>(_selectedGroups.model()); }
+    QAbstractItemModel* getSelectedGroupsModel() { syncSelectionModels(); return qobject_cast<QAbstractItemModel*>(_selectedGroups.model()); }
 
-    inline auto         getSelectedGroups() noexcept -> SelectedGroups& { return _selectedGroups; }
-    inline auto         getSelectedGroups() const noexcept -> const SelectedGroups& { return _selectedGroups; }
+    //! Currently selected groups, in selection order (read-only, see getSelectedNodes()).
+    inline auto         getSelectedGroups() const noexcept -> const SelectedGroups& { syncSelectionModels(); return _selectedGroups; }
 private:
-    SelectedGroups      _selectedGroups;
+    mutable SelectedGroups  _selectedGroups;
 signals:
     void                selectedGroupsChanged();
 
@@ -745,6 +2093,13 @@ protected:
     void    alignTop(std::vector<QQuickItem*>&& items);
     //! \brief Align \c items bottom.
     void    alignBottom(std::vector<QQuickItem*>&& items);
+private:
+    /*! \brief Move aligned nodes and groups \c items to \c position(item) in a single update transaction.
+     *
+     * Dirty edges are updated once, moves are recorded as one undo entry and a single nodesMoved() signal is emitted.
+     */
+    void    moveAlignedItems(const std::vector<QQuickItem*>& items,
+                             const std::function<QPointF(const QQuickItem&)>& position) noexcept;
     //@}
     //-------------------------------------------------------------------------
 
@@ -761,6 +2116,23 @@ private:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Undo Stack *///--------------------------------------------------
+    //@{
+public:
+    /*! \brief Graph undo stack, disabled by default (see qan::UndoStack::enabled).
+     *
+     * Node and group moves, insertion and removal of nodes, groups and edges, grouping and style changes made
+     * with graph API are recorded as compact deltas, alignSelection*() and a selection drag are recorded as
+     * a single entry.
+     */
+    Q_PROPERTY( qan::UndoStack* undoStack READ getUndoStack CONSTANT FINAL )
+    inline qan::UndoStack*          getUndoStack() noexcept { return &_undoStack; }
+    inline const qan::UndoStack*    getUndoStack() const noexcept { return &_undoStack; }
+private:
+    qan::UndoStack      _undoStack{*this};
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Port/Dock Management *///----------------------------------------
     //@{
 public:
@@ -805,7 +2177,7 @@ signals:
     void                    portDelegateChanged();
 private:
     //! \copydoc portDelegate
-    std::unique_ptr<QQmlComponent> _portDelegate;
+    qan::component_ptr             _portDelegate;
 
 signals:
     /*! \brief Emitted whenever a port node registered in this graph is clicked.
@@ -830,7 +2202,7 @@ signals:
     void                    horizontalDockDelegateChanged();
 private:
     //! \copydoc horizontalDockDelegate
-    std::unique_ptr<QQmlComponent> _horizontalDockDelegate;
+    qan::component_ptr             _horizontalDockDelegate;
 
 public:
     //! Default delegate for vertical (either NodeItem::Dock::Left or NodeItem::Dock::Right) docks.
@@ -847,7 +2219,7 @@ signals:
     void                    verticalDockDelegateChanged();
 private:
     //! \copydoc verticalDockDelegate
-    std::unique_ptr<QQmlComponent> _verticalDockDelegate;
+    qan::component_ptr             _verticalDockDelegate;
 
 protected:
     //! Create a dock item from an existing dock item delegate.
@@ -866,6 +2238,26 @@ public:
      */
     Q_INVOKABLE void    sendToFront(QQuickItem* item);
 
+    /*! \brief Mark \c edgeItem stacking dirty, dirty edges are restacked once before next frame (see qan::EdgeItem::updateZ()).
+     *
+     * Called from qan::EdgeItem::updateZSlot() when an edge source or destination item z is modified: restacking an edge
+     * does not regenerate its geometry, raising a hub node restack all its edges in a single pass.
+     */
+    void                scheduleEdgeItemRestack(qan::EdgeItem* edgeItem) noexcept;
+
+    /*! \brief Mark all \c node adjacent edges stacking dirty, including edges adjacent to \c node content when it is a group.
+     *
+     * Used by sendToFront(): nodes nested in a raised group have a modified global z but do not notify a z modification.
+     */
+    void                scheduleEdgesRestack(const qan::Node& node) noexcept;
+private:
+    //! Restack all dirty edge items in one pass (called after deferred edge items geometry update).
+    void                restackDeferredEdgeItems() noexcept;
+    std::vector<QPointer<qan::EdgeItem>>            _restackEdgeItems;
+    std::unordered_set<const qan::EdgeItem*>        _restackEdgeItemsSet;
+
+public:
+
     /*! \brief Iterate over all graph container items, find and update the maxZ property.
      *
      * \note O(N) with N beeing the graph item count (might be quite costly, mainly defined to update
@@ -895,9 +2287,17 @@ public:
 protected:
     /*! \brief Utility to find a QQuickItem maximum z value of \c item childs.
      *
+     * Childs are scanned only on first query for a given \c item, following queries are O(1).
      * \return 0. if there is no child, maximum child z value otherwise.
      */
     auto                maxChildsZ(QQuickItem* item) const noexcept -> qreal;
+private:
+    //! Scan \c item childs and return their maximum z (0. if there is no child), O(childs count).
+    auto                scanChildsZ(const QQuickItem& item) const noexcept -> qreal;
+    //! Update \c item parent cached maximum childs z when an indexed item z or parent is modified.
+    void                childZModified(const QQuickItem* item) noexcept;
+    //! Cached maximum childs z (an upper bound) for items queried with maxChildsZ().
+    mutable std::unordered_map<const QQuickItem*, qreal>    _childsMaxZ;
     //@}
     //-------------------------------------------------------------------------
 
@@ -912,46 +2312,240 @@ public:
 
     /*! \brief Synchronously collect all sub-nodes of graph root nodes using DFS.
      *
-     * \warning this method is synchronous and recursive.
+     * \note Traversal is iterative and use a graph owned scratch (see collectDfs(const qan::Node&, OutputIt, bool)).
      */
     std::vector<const qan::Node*>   collectDfs(bool collectGroup = false) const noexcept;
 
     /*! \brief Synchronously collect all child nodes of \c node using DFS.
      *
-     * \note \c node is automatically added to the result and returned as the first
-     * node of the return set.
-     * \warning this method is synchronous and recursive.
+     * \note \c node is part of the result only if it is reachable from one of its childs (ie \c node is in a circuit).
+     * \note Traversal is iterative and use a graph owned scratch (see collectDfs(const qan::Node&, OutputIt, bool)).
      */
     std::vector<const qan::Node*>   collectDfs(const qan::Node& node, bool collectGroup = false) const noexcept;
 
+    /*! \brief Write all child nodes of \c node to \c out (as \c const qan::Node*) in DFS preorder.
+     *
+     * Visited marks and DFS stack are kept in a graph owned scratch reused between calls: with a preallocated
+     * output, collecting a DFS does not allocate once the scratch has grown to graph size.
+     * \warning Not reentrant, must be called from GUI thread.
+     */
+    template <class OutputIt>
+    OutputIt    collectDfs(const qan::Node& node, OutputIt out, bool collectGroup = false) const {
+        return gtpo::collect_dfs(node, out, _dfsScratch, collectGroup);
+    }
+
 private:
-    void                    collectDfsRec(const qan::Node*,
-                                          std::unordered_set<const qan::Node*>& marks,
-                                          std::vector<const qan::Node*>& childs,
-                                          bool collectGroup) const noexcept;
+    //! Reusable DFS visited marks and stack (see collectDfs()).
+    mutable gtpo::dfs_scratch<qan::Node>    _dfsScratch;
 
 public:
     /*! \brief Synchronously collect all parent nodes of \c node using DFS.
      *
-     * \note \c node is automatically added to the result and returned as the first
-     * node of the return set.
-     * \warning this method is synchronous and recursive.
+     * Traversal is iterative (no recursion depth limit) and read in adjacency from the cached topology
+     * snapshot (see gtpo::graph::snapshot()), group membership is read from graph groups.
+     * \note With \c collectGroup, nodes of a visited group and the group of a visited node are also collected.
      */
     std::vector<const qan::Node*>   collectAncestorsDfs(const qan::Node& node, bool collectGroup = false) const noexcept;
 
+    /*! \brief Show or hide \c nodes items and their adjacent edge items in one batch.
+     *
+     * Visibility changes are applied in a single beginUpdate()/endUpdate() scope: adjacent edges are
+     * collected once (without per node temporary sets) and edge geometry updates are deferred to endUpdate().
+     */
+    void                    setNodesVisible(const std::vector<qan::Node*>& nodes, bool visible) noexcept;
+
     /*! \brief Return true if \c candidate node is an ancestor of given \c node.
      *
-     * \warning this method is synchronous and recursive.
+     * Query is answered by a gtpo::reachability_index rebuilt lazily (O(V + E)) on first query after a topology
+     * modification, most queries are then O(1) (see isReachable()).
      * \return true if \c candidate is an ancestor of \c node (ie \c node is an out
-     * node of \c candidate at any degree.
+     * node of \c candidate at any degree), false if \c node and \c candidate are the same node.
      */
     bool                    isAncestor(const qan::Node& node, const qan::Node& candidate) const noexcept;
 
+    /*! \brief Return true if a directed path exist from \c source to \c destination (groups membership is ignored).
+     *
+     * Intended for interactive connection validation, inserting edge \c source -> \c destination would create
+     * a circuit if isReachable(destination, source):
+     * \code
+     * Qan.Graph {
+     *   onConnectorRequestEdgeCreation: {
+     *     if (!graph.isReachable(dst, src))
+     *       graph.insertEdge(src, dst)
+     *   }
+     * }
+     * \endcode
+     * \note A node is reachable from itself.
+     */
+    Q_INVOKABLE bool        isReachable(qan::Node* source, qan::Node* destination) const noexcept;
+
 private:
-    void                    collectAncestorsDfsRec(const qan::Node*,
-                                                   std::unordered_set<const qan::Node*>& marks,
-                                                   std::vector<const qan::Node*>& parents,
-                                                   bool collectGroup) const noexcept;
+    using Reachability = gtpo::reachability_index<gtpo_graph_t>;
+    //! Return reachability index of actual topology (rebuilt if topology has changed since last query), nullptr on error.
+    const Reachability*     reachability() const noexcept;
+    //! Snapshot reachability index has been built from, index is valid while snapshot revision is graph revision.
+    mutable gtpo_graph_t::shared_snapshot_t _reachabilitySnapshot;
+    mutable std::unique_ptr<Reachability>   _reachability;
+
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Topology Snapshot *///------------------------------------------
+    //@{
+public:
+    //! Immutable, thread shareable topology snapshot, see gtpo::graph::snapshot().
+    using Snapshot = gtpo_graph_t::shared_snapshot_t;
+
+    /*! \brief Apply node item \c positions computed on a worker thread from \c snapshot in one batch.
+     *
+     * \c positions are indexed by \c snapshot dense node indexes and expressed in node item parent coordinates,
+     * nodes removed since the snapshot was taken are ignored, geometry of nodes without items (headless or virtualized
+     * nodes) is updated.
+     * \warning Must be called from the graph (GUI) thread, use postNodePositions() from a worker thread.
+     */
+    void    applyNodePositions(const Snapshot& snapshot, const std::vector<QPointF>& positions) noexcept;
+
+    /*! \brief Thread safe version of applyNodePositions(), positions are applied later from graph thread event loop.
+     *
+     * \code
+     *   auto snapshot = graph->snapshot();     // GUI thread
+     *   QtConcurrent::run([graph, snapshot]() {
+     *       std::vector<QPointF> positions = layout(snapshot->get_csr());
+     *       graph->postNodePositions(snapshot, std::move(positions));
+     *   });
+     * \endcode
+     */
+    void    postNodePositions(Snapshot snapshot, std::vector<QPointF> positions) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Bulk Node Properties *///-----------------------------------------
+    //@{
+public:
+    /*! \brief Return all nodes (and groups) positions packed in a Float32 buffer [x0, y0, x1, y1, ...].
+     *
+     * Nodes are ordered as in gtpo::graph::get_nodes() (ie topology snapshot dense indexes), positions are node
+     * items positions in their parent CS (or stored geometry for headless and virtualized nodes). Buffers are
+     * exchanged with JS as ArrayBuffer, avoiding per node property marshalling:
+     * \code
+     * const positions = new Float32Array(graph.nodePositions())
+     * for (let n = 0; n < positions.length; n += 2)
+     *     positions[n] += 10.
+     * graph.setNodePositions(positions.buffer)
+     * \endcode
+     */
+    Q_INVOKABLE QByteArray  nodePositions() const noexcept;
+    /*! \brief Set nodes positions from a Float32 buffer packed as in nodePositions(), in one beginUpdate() / endUpdate() transaction.
+     *
+     * A NaN coordinate leave node unchanged, entries past node count are ignored.
+     * \return number of modified nodes.
+     */
+    Q_INVOKABLE int         setNodePositions(const QByteArray& positions) noexcept;
+
+    //! Return all nodes sizes packed in a Float32 buffer [width0, height0, width1, height1, ...] (see nodePositions()).
+    Q_INVOKABLE QByteArray  nodeSizes() const noexcept;
+    //! Set nodes sizes from a Float32 buffer packed as in nodeSizes() (NaN or negative sizes leave node unchanged), return number of modified nodes.
+    Q_INVOKABLE int         setNodeSizes(const QByteArray& sizes) noexcept;
+
+    //! Return all nodes visibility packed in an Uint8 buffer (0 for hidden nodes, 1 for visible nodes).
+    Q_INVOKABLE QByteArray  nodeVisibilities() const noexcept;
+    /*! \brief Set nodes visibility from an Uint8 buffer packed as in nodeVisibilities() (adjacent edges are shown or hidden with their nodes).
+     *
+     * \return number of modified nodes.
+     * \sa setNodesVisible()
+     */
+    Q_INVOKABLE int         setNodeVisibilities(const QByteArray& visibilities) noexcept;
+
+    //! Return all nodes style index in \c styleManager \c styles packed in an Int32 buffer (-1 when node style is not registered).
+    Q_INVOKABLE QByteArray  nodeStyles() const noexcept;
+    //! Set nodes style from an Int32 buffer of \c styleManager \c styles indexes (negative or non node style indexes are ignored), return number of modified nodes.
+    Q_INVOKABLE int         setNodeStyles(const QByteArray& styles) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Structural Fingerprint *///-------------------------------------
+    //@{
+public:
+    /*! \brief Return an order independent hash of graph topology and node labels.
+     *
+     * Fingerprint is maintained incrementally by a gtpo::fingerprint_behaviour installed on first call, it
+     * is deterministic across sessions and could be used to key persistent data (see qan::LayoutCache).
+     */
+    std::uint64_t               getFingerprint() noexcept;
+
+    //! Return getFingerprint() as an hexadecimal string (QML has no 64 bits integer type).
+    Q_INVOKABLE QString         getFingerprintString() noexcept;
+
+    //! Deterministic \c node hash used by graph fingerprint (label and group flag, position independent).
+    static std::uint64_t        getStructuralHash(const qan::Node& node) noexcept;
+
+private:
+    void                        onFingerprintNodeChanged(qan::Node* node) noexcept;
+    using Fingerprint           = gtpo::fingerprint_behaviour<qan::Config>;
+    //! Fingerprint behaviour is owned by gtpo::graph<>, it is destroyed by clear().
+    Fingerprint*                _fingerprint = nullptr;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Label Search *///-----------------------------------------------
+    //@{
+public:
+    /*! \brief Return at most \c limit nodes (or groups) whose label contains \c query (case insensitive).
+     *
+     * Query is resolved with a qan::LabelIndex built on first call and maintained incrementally on node label
+     * changes, node insertions and removals are synchronized lazily on next query. When typing, successive
+     * queries extending the previous one only verify previous matches.
+     * \code
+     * TextField {
+     *   onTextChanged: {
+     *     var nodes = graph.findNodes(text, 20)
+     *     if (nodes.length > 0)
+     *       graphView.centerOnNode(nodes[0])
+     *   }
+     * }
+     * \endcode
+     */
+    Q_INVOKABLE QObjectList findNodes(const QString& query, int limit = 100) noexcept;
+
+    /*! \brief Replace current selection by nodes returned by findNodes(\c query, \c limit), return number of found nodes.
+     *
+     * Selection is modified in a single batch. Only nodes with an item are highlighted (see \c virtualized).
+     */
+    Q_INVOKABLE int         selectNodesByLabel(const QString& query, int limit = 100) noexcept;
+
+private:
+    //! Install label index on first call, synchronize it with graph nodes when topology has changed.
+    void                    syncLabelIndex() noexcept;
+    void                    onLabelIndexNodeChanged(qan::Node* node) noexcept;
+    qan::LabelIndex         _labelIndex;
+    bool                    _labelIndexEnabled = false;
+    //! Topology revision labelIndex was last synchronized with.
+    std::uint64_t           _labelIndexRevision = 0;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Path and Neighbourhood Queries *///-------------------------------
+    //@{
+public:
+    /*! \brief Return nodes on a shortest directed path from \c source to \c destination (\c source first, empty if there is no path).
+     *
+     * When \c weighted is true, path minimize the sum of edges qan::Edge::getWeight() (Dijkstra), otherwise it
+     * minimize edge count (bidirectional BFS on the cached topology snapshot).
+     * \code
+     *   // QML
+     *   var path = graph.shortestPath(n1, n2, true)
+     *   for ( var n = 0; n < path.length; n++ )
+     *       path[n].item.selected = true
+     * \endcode
+     * \note Edge weights must be positive or 0.
+     */
+    Q_INVOKABLE QObjectList shortestPath(qan::Node* source, qan::Node* destination, bool weighted = false) const noexcept;
+
+    /*! \brief Return all nodes at most \c hops edges away from \c node (\c node first, then ordered by hop count).
+     *
+     * \param directed when true only out edges are followed, otherwise edges are considered undirected.
+     */
+    Q_INVOKABLE QObjectList neighbourhood(qan::Node* node, int hops, bool directed = false) const noexcept;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -39,6 +39,7 @@ namespace qan { // ::qan
 template < class Node_t >
 qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* nodeStyle)
 {
+    QAN_TRACE_SCOPE("Graph::insertNode");
     if (nodeComponent == nullptr) {
         const auto engine = qmlEngine(this);
         nodeComponent = _nodeDelegate.get(); // If no delegate component is specified, try the node type delegate() factory
@@ -46,11 +47,13 @@ qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* node
             engine != nullptr) // Otherwise, use default node delegate component
             nodeComponent = Node_t::delegate(*engine);
     }
-    if (nodeComponent == nullptr) {          // Otherwise, generate a warning and create a "non visual node"
+    if (nodeComponent == nullptr &&
+        !_headless) {                       // Otherwise, generate a warning and create a "non visual node"
         qWarning() << "qan::Graph::insertNode(): Can't find a valid node delegate component.";
         return nullptr;
     }
-    if (nodeComponent->isError()) { // If component exists, it should be instanciable
+    if (nodeComponent != nullptr &&
+        nodeComponent->isError()) { // If component exists, it should be instanciable
         qWarning() << "Component error: " << nodeComponent->errors();
         return nullptr;
     }
@@ -62,34 +65,18 @@ qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* node
         if (nodeStyle == nullptr)
             throw qan::Error{"style() factory has returned a nullptr style."};
         _styleManager.setStyleComponent(nodeStyle, nodeComponent);      // nullptr nodeComponent is ok
-        qan::NodeItem* nodeItem = static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                                  *nodeStyle,
-                                                                                  node.get()));
-        if (nodeItem == nullptr)
-            throw qan::Error{"Node item creation failed."};
-        nodeItem->setNode(node.get());
-        nodeItem->setGraph(this);
-        node->setItem(nodeItem);
-        auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-            if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                emit this->nodeClicked(nodeItem->getNode(), p);
-        };
-        connect(nodeItem, &qan::NodeItem::nodeClicked, notifyNodeClicked);
-
-        auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-            if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                emit this->nodeRightClicked(nodeItem->getNode(), p);
-        };
-        connect( nodeItem, &qan::NodeItem::nodeRightClicked, notifyNodeRightClicked );
-
-        auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-            if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
-                emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-        };
-        connect(nodeItem, &qan::NodeItem::nodeDoubleClicked, notifyNodeDoubleClicked);
-        {   // Send item to front
-            _maxZ += 1;
-            nodeItem->setZ(_maxZ);
+        if (_virtualized ||     // Node item is created by updateVirtualization() once node is in viewport
+            _headless) {        // or when headless graph is attached to a view
+            _virtualDelegates[node.get()] = VirtualDelegate{nodeComponent, nodeStyle};
+            scheduleVirtualizationUpdate();
+        } else {
+            qan::NodeItem* nodeItem = createNodeItem(*node, *nodeComponent, *nodeStyle);
+            if (nodeItem == nullptr)
+                throw qan::Error{"Node item creation failed."};
+            {   // Send item to front
+                _maxZ += 1;
+                nodeItem->setZ(_maxZ);
+            }
         }
         gtpo_graph_t::insert_node(node);        // Insert visual or non visual node
     } catch (const gtpo::bad_topology_error& e) {
@@ -107,7 +94,7 @@ qan::Node*  Graph::insertNode(QQmlComponent* nodeComponent, qan::NodeStyle* node
     const auto nodePtr = node.get();
     if (nodePtr != nullptr) {       // Notify user.
         onNodeInserted(*nodePtr);
-        emit nodeInserted(nodePtr);
+        notifyNodeInserted(nodePtr);
     }
     return node.get();
 }
@@ -130,7 +117,7 @@ qan::Node*  Graph::insertNonVisualNode()
     const auto nodePtr = node.get();
     if (nodePtr != nullptr) {       // Notify user.
         onNodeInserted(*nodePtr);
-        emit nodeInserted(nodePtr);
+        notifyNodeInserted(nodePtr);
     }
     return node.get();
 }
@@ -140,8 +127,11 @@ qan::Node*  Graph::insertNonVisualNode()
 template < class Edge_t >
 qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent* edgeComponent)
 {
+    QAN_TRACE_SCOPE("Graph::insertEdge");
     if (dstNode == nullptr)
         return nullptr;
+    if (!isEdgeInsertable(src, *dstNode))
+        return nullptr;
     if (edgeComponent == nullptr) {
         const auto engine = qmlEngine(this);
         if (engine != nullptr)
@@ -149,7 +139,8 @@ qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent*
         if (edgeComponent == nullptr)
             edgeComponent = _edgeDelegate.get();    // Otherwise, use default edge delegate component
     }
-    if (edgeComponent == nullptr) {               // Otherwise, throw an error, a visual edge must have a delegate
+    if (edgeComponent == nullptr &&
+        !_headless) {                             // Otherwise, throw an error, a visual edge must have a delegate
         qWarning() << "qan::Graph::insertEdge<>(): Error: Can't find a valid edge delegate component.";
         return nullptr;
     }
@@ -162,7 +153,7 @@ qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent*
     try {
         auto edge = std::make_shared<Edge_t>(nullptr);
         QQmlEngine::setObjectOwnership(edge.get(), QQmlEngine::CppOwnership);
-        if (configureEdge(*edge,  *edgeComponent, *style,
+        if (configureEdge(*edge,  edgeComponent, *style,
                            src,    dstNode)) {
             gtpo_graph_t::insert_edge(edge);
             configuredEdge = edge.get();
@@ -178,7 +169,7 @@ qan::Edge*  Graph::insertEdge(qan::Node& src, qan::Node* dstNode, QQmlComponent*
         // Note: edge is cleaned automatically if it has still not been inserted to graph
     }
     if (configuredEdge != nullptr)
-        emit edgeInserted(configuredEdge);
+        notifyEdgeInserted(configuredEdge);
     return configuredEdge;
 }
 
@@ -187,6 +178,8 @@ qan::Edge*  Graph::insertNonVisualEdge( qan::Node& src, qan::Node* dstNode )
 {
     if ( dstNode == nullptr )
         return nullptr;
+    if ( !isEdgeInsertable(src, *dstNode) )
+        return nullptr;
     auto edge = std::make_shared<Edge_t>();
     try {
         QQmlEngine::setObjectOwnership( edge.get(), QQmlEngine::CppOwnership );
@@ -0,0 +1,175 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphBuilder.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <memory>       // std::addressof
+#include <vector>
+
+// Qt headers
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanGraphBuilder.h"
+#include "./qanNode.h"
+#include "./qanEdge.h"
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Move a node adjacency container (a QObject member of \c node, not a child) to \c thread.
+template <class container_t>
+void    moveContainerToThread(const container_t& container, QThread* thread) noexcept
+{
+    const_cast<container_t&>(container).moveToThread(thread);
+}
+
+//! Plain std adjacency containers (QUICKQANAVA_STD_ADJACENCY) are not QObjects and have no thread affinity.
+template <class T>
+void    moveContainerToThread(const std::vector<T>&, QThread*) noexcept { }
+
+} // ::qan::anonymous
+
+/* GraphBuilder Object Management *///-----------------------------------------
+GraphBuilder::GraphBuilder(QThread* targetThread) noexcept :
+    _targetThread{targetThread}
+{
+}
+
+GraphBuilder::~GraphBuilder() noexcept
+{
+    // Note: edges are released first, nodes only reference them weakly
+    _edges.clear();
+    _nodes.clear();
+}
+
+void    GraphBuilder::reserve(std::size_t nodeCount, std::size_t edgeCount)
+{
+    _nodes.reserve(nodeCount);
+    _edges.reserve(edgeCount);
+}
+
+qan::Node*  GraphBuilder::insertNode(const QRectF& geometry, const QString& label)
+{
+    if (isFinished()) {
+        qWarning() << "qan::GraphBuilder::insertNode(): Error: builder is finished.";
+        return nullptr;
+    }
+    auto node = std::make_shared<qan::Node>();
+    if (!geometry.isNull())
+        node->setGeometry(geometry);
+    if (!label.isEmpty())
+        node->setLabel(label);
+    _nodes.push_back(node);
+    return node.get();
+}
+
+qan::Node*  GraphBuilder::insertNode(std::shared_ptr<qan::Node> node)
+{
+    if (!node ||
+        node->is_group() ||
+        node->get_graph() != nullptr ||
+        node->thread() != QThread::currentThread() ||
+        isFinished()) {
+        qWarning() << "qan::GraphBuilder::insertNode(): Error: node can't be inserted in builder.";
+        return nullptr;
+    }
+    _nodes.push_back(node);
+    return node.get();
+}
+
+qan::Edge*  GraphBuilder::insertEdge(qan::Node* source, qan::Node* destination, const QString& label, qreal weight)
+{
+    if (source == nullptr ||
+        destination == nullptr ||
+        isFinished())
+        return nullptr;
+    QAN_TRACE_SCOPE("GraphBuilder::insertEdge");
+    try {
+        auto edge = std::make_shared<qan::Edge>();
+        edge->set_src(std::static_pointer_cast<qan::Node>(source->shared_from_this()));
+        edge->set_dst(std::static_pointer_cast<qan::Node>(destination->shared_from_this()));
+        if (!label.isEmpty())
+            edge->setLabel(label);
+        if (!qFuzzyCompare(weight, 1.))
+            edge->setWeight(weight);
+        source->add_out_edge(edge);         // Note: nodes are not in a graph, behaviours are not notified
+        destination->add_in_edge(edge);
+        _edges.push_back(edge);
+        return edge.get();
+    } catch (const std::bad_weak_ptr&) {
+        qWarning() << "qan::GraphBuilder::insertEdge(): Error: source or destination is not a builder node.";
+    } catch (const std::exception& e) {
+        qWarning() << "qan::GraphBuilder::insertEdge(): Error: " << e.what();
+    }
+    return nullptr;
+}
+
+bool    GraphBuilder::finish() noexcept
+{
+    if (isFinished())
+        return false;
+    QAN_TRACE_SCOPE("GraphBuilder::finish");
+    if (_targetThread != nullptr &&
+        _targetThread != QThread::currentThread()) {
+        for (const auto& node : _nodes) {
+            if (node->thread() != QThread::currentThread()) {
+                qWarning() << "qan::GraphBuilder::finish(): Warning: node " << node.get() << " has not been built from current thread.";
+                continue;
+            }
+            node->moveToThread(_targetThread);
+            moveContainerToThread(node->get_in_edges(), _targetThread);
+            moveContainerToThread(node->get_out_edges(), _targetThread);
+            moveContainerToThread(node->get_in_nodes(), _targetThread);
+            moveContainerToThread(node->get_out_nodes(), _targetThread);
+        }
+        for (const auto& edge : _edges)
+            edge->moveToThread(_targetThread);
+    }
+    _finished.store(true, std::memory_order_release);
+    return true;
+}
+
+void    GraphBuilder::take(std::vector<std::shared_ptr<qan::Node>>& nodes,
+                           std::vector<std::shared_ptr<qan::Edge>>& edges) noexcept
+{
+    nodes = std::move(_nodes);
+    edges = std::move(_edges);
+    _nodes.clear();
+    _edges.clear();
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphBuilder.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QRectF>
+#include <QString>
+#include <QThread>
+
+namespace qan { // ::qan
+
+class Node;
+class Edge;
+class Graph;
+
+/*! \brief Build qan::Node and qan::Edge primitives and their adjacency on a worker thread, for qan::Graph::adopt().
+ *
+ * qan::Node and qan::Edge are QObjects: building a large topology with qan::Graph::insertNode() and insertEdge()
+ * has to be done on the GUI thread. A builder create primitives on the calling (worker) thread and link edges
+ * to their source and destination nodes, then finish() move every primitive to the graph thread in a single
+ * pass. GUI thread only has to insert already linked primitives in graph containers:
+ * \code
+ * auto builder = std::make_shared<qan::GraphBuilder>(graph->thread());
+ * QThreadPool::globalInstance()->start([builder, graph = QPointer<qan::Graph>{graph}]() {
+ *     auto n1 = builder->insertNode(QRectF{0., 0., 100., 45.}, QStringLiteral("n1"));
+ *     auto n2 = builder->insertNode(QRectF{200., 0., 100., 45.}, QStringLiteral("n2"));
+ *     builder->insertEdge(n1, n2);
+ *     builder->finish();
+ *     QMetaObject::invokeMethod(graph, [builder, graph]() { if (graph) graph->adopt(*builder); }, Qt::QueuedConnection);
+ * });
+ * \endcode
+ *
+ * \note Only nodes and edges could be built, groups require a visual item and must be inserted from GUI thread.
+ * \warning A builder is owned by one thread at a time: primitives are built and finish() is called from the same
+ * thread, the builder is then only accessed from the graph thread. Qt can only push a QObject to another thread
+ * from its own thread, this is why moving primitives is done in finish() and not in qan::Graph::adopt().
+ */
+class GraphBuilder
+{
+    /*! \name GraphBuilder Object Management *///------------------------------
+    //@{
+public:
+    //! Build primitives that will be adopted by a graph living in \c targetThread (usually graph->thread()).
+    explicit GraphBuilder(QThread* targetThread) noexcept;
+    ~GraphBuilder() noexcept;
+    GraphBuilder(const GraphBuilder&) = delete;
+    GraphBuilder& operator=(const GraphBuilder&) = delete;
+
+public:
+    //! Reserve storage for \c nodeCount nodes and \c edgeCount edges.
+    void                reserve(std::size_t nodeCount, std::size_t edgeCount);
+
+    //! Create a node with \c geometry (in graph coordinates) and \c label, return nullptr once builder is finished.
+    qan::Node*          insertNode(const QRectF& geometry = QRectF{}, const QString& label = QString{});
+    //! Append an already created \c node (with current thread affinity and no graph), return nullptr on error.
+    qan::Node*          insertNode(std::shared_ptr<qan::Node> node);
+
+    /*! \brief Create an edge between builder nodes \c source and \c destination and link it in both nodes adjacency.
+     *
+     * \return created edge, nullptr if \c source or \c destination is nullptr or once builder is finished.
+     */
+    qan::Edge*          insertEdge(qan::Node* source, qan::Node* destination, const QString& label = QString{}, qreal weight = 1.);
+
+    inline std::size_t  getNodeCount() const noexcept { return _nodes.size(); }
+    inline std::size_t  getEdgeCount() const noexcept { return _edges.size(); }
+
+    /*! \brief End construction and move every built primitive to target thread (must be called from building thread).
+     *
+     * \return false if builder was already finished.
+     */
+    bool                finish() noexcept;
+    //! True once finish() has been called, builder could then be adopted from target thread.
+    inline bool         isFinished() const noexcept { return _finished.load(std::memory_order_acquire); }
+
+private:
+    friend qan::Graph;
+    //! Move built nodes and edges out of builder (called from qan::Graph::adopt()).
+    void                take(std::vector<std::shared_ptr<qan::Node>>& nodes,
+                             std::vector<std::shared_ptr<qan::Edge>>& edges) noexcept;
+
+    QThread*                                _targetThread = nullptr;
+    std::vector<std::shared_ptr<qan::Node>> _nodes;
+    std::vector<std::shared_ptr<qan::Edge>> _edges;
+    std::atomic<bool>                       _finished{false};
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
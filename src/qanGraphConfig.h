@@ -73,6 +73,40 @@ class Node;
 class Edge;
 class Group;
 
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+/*! \brief Emit qan::Node inDegreeChanged() and outDegreeChanged() when plain std adjacency containers are modified.
+ *
+ * Static node behaviour used when QUICKQANAVA_STD_ADJACENCY is defined: std::vector adjacency containers do not
+ * notify length changes like qcm::Container does.
+ */
+template <class config_t>
+class NodeDegreeNotifier : public gtpo::node_behaviour<config_t>
+{
+public:
+    using weak_node_t = std::weak_ptr<typename config_t::final_node_t>;
+    using weak_edge_t = std::weak_ptr<typename config_t::final_edge_t>;
+
+    void    in_node_inserted( const weak_node_t& target, const weak_node_t&, const weak_edge_t& ) noexcept { notifyInDegree(target); }
+    void    in_node_removed( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept { }
+    void    in_node_removed( const weak_node_t& target ) noexcept { notifyInDegree(target); }
+    void    out_node_inserted( const weak_node_t& target, const weak_node_t&, const weak_edge_t& ) noexcept { notifyOutDegree(target); }
+    void    out_node_removed( const weak_node_t&, const weak_node_t&, const weak_edge_t& ) noexcept { }
+    void    out_node_removed( const weak_node_t& target ) noexcept { notifyOutDegree(target); }
+
+private:
+    static void notifyInDegree( const weak_node_t& target ) noexcept {
+        const auto node = target.lock();
+        if ( node )
+            emit node->inDegreeChanged();
+    }
+    static void notifyOutDegree( const weak_node_t& target ) noexcept {
+        const auto node = target.lock();
+        if ( node )
+            emit node->outDegreeChanged();
+    }
+};
+#endif
+
 struct Config final : public gtpo::config<Config>
 {
     typedef QQuickItem  graph_base;
@@ -95,6 +129,23 @@ struct Config final : public gtpo::config<Config>
 
     template < class ...Args >
     using search_container_t = QSet< Args... >;
+
+    // Connectors and visual edge creation query qan::Graph::hasEdge() interactively.
+    static constexpr bool   enable_adjacency_index = true;
+
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+    // Node in/out edges and nodes are plain std::vector: topology hot paths no longer synchronize a qcm::Container
+    // model, qan::Node inNodes, outNodes and outEdges are then lazy qan::AdjacencyModel projections.
+    template <class ...Args>
+    using adjacent_edges_container_t = std::vector< Args... >;
+
+    template <class ...Args>
+    using adjacent_nodes_container_t = std::vector< Args... >;
+
+    using node_behaviours = std::tuple< gtpo::enable_node_dynamic_behaviour<Config>,
+                                        qan::NodeDegreeNotifier<Config>
+                                      >; // std::tuple
+#endif
 };
 
 } // ::qan
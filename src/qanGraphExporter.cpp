@@ -0,0 +1,818 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphExporter.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::min std::max
+#include <cmath>        // std::ceil std::floor
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Qt headers
+#include <QFile>
+#include <QFileInfo>
+#include <QUrl>
+#include <QDataStream>
+#include <QImage>
+#include <QImageWriter>
+#include <QPainter>
+#include <QPdfWriter>
+#include <QPageSize>
+#include <QFontMetricsF>
+#include <QXmlStreamWriter>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanGraphExporter.h"
+#include "./qanGraph.h"
+#include "./qanNode.h"
+#include "./qanNodeItem.h"
+#include "./qanEdge.h"
+#include "./qanEdgeItem.h"
+#include "./qanStyle.h"
+#include "./qanTilePyramid.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Node or group rounded rectangle with an optional single line label (in graph container CS).
+struct NodePrimitive {
+    QRectF  rect;
+    qreal   radius = 0.;
+    QColor  fill;
+    QColor  stroke;
+    qreal   strokeWidth = 0.;
+    QString label;          // Elided to label rect width
+    QRectF  labelRect;
+    QFont   font;
+    bool    group = false;
+};
+
+//! Edge end shape (arrow triangle, circle or rect inscribed in arrow triangle bounding rect).
+struct ArrowPrimitive {
+    qan::EdgeStyle::ArrowShape  shape = qan::EdgeStyle::ArrowShape::None;
+    QPolygonF                   polygon;
+};
+
+//! Edge polyline with ends and an optional label centered on labelPos (in graph container CS).
+struct EdgePrimitive {
+    QPolygonF       line;
+    QRectF          bounds;
+    QColor          color{Qt::black};
+    qreal           width = 2.;
+    bool            dashed = false;
+    ArrowPrimitive  src;
+    ArrowPrimitive  dst;
+    QString         label;
+    QPointF         labelPos;
+};
+
+struct Scene {
+    std::vector<NodePrimitive>  groups;
+    std::vector<NodePrimitive>  nodes;
+    std::vector<EdgePrimitive>  edges;
+    QRectF                      bounds;
+};
+
+//! Return \c node geometry in graph container CS, empty rect if node is not visible.
+QRectF  nodeRect(const qan::Node& node, const QQuickItem* container) noexcept
+{
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)    // Virtualized node geometry is in container CS
+        return node.getGeometry();
+    if (!nodeItem->isVisible())
+        return QRectF{};
+    return container != nullptr ? nodeItem->mapRectToItem(container, QRectF{0., 0., nodeItem->width(), nodeItem->height()}) :
+                                  QRectF{nodeItem->position(), QSizeF{nodeItem->width(), nodeItem->height()}};
+}
+
+Scene   collectScene(qan::Graph& graph, bool labels)
+{
+    Scene scene;
+    const auto container = graph.getContainerItem();
+    constexpr qreal labelMargin = 5.;
+    for (const auto& node : graph.get_nodes()) {
+        if (!node)
+            continue;
+        const auto rect = nodeRect(*node, container);
+        if (rect.isEmpty())
+            continue;
+        NodePrimitive primitive;
+        primitive.rect = rect;
+        primitive.group = node->is_group();
+        const auto style = graph.getNodeStyle(*node);
+        primitive.radius = style != nullptr ? style->getBackRadius() : 4.;
+        primitive.fill = style != nullptr ? style->getBackColor() : QColor{Qt::white};
+        primitive.fill.setAlphaF(primitive.fill.alphaF() * (style != nullptr ? style->getBackOpacity() : 1.));
+        primitive.stroke = style != nullptr ? style->getBorderColor() : QColor{Qt::black};
+        primitive.strokeWidth = style != nullptr ? std::max(0., style->getBorderWidth()) : 1.;
+        if (style != nullptr) {
+            if (style->getFontPointSize() > 0)
+                primitive.font.setPointSize(style->getFontPointSize());
+            primitive.font.setBold(style->getFontBold());
+        }
+        if (labels &&
+            !node->getLabel().isEmpty()) {
+            primitive.labelRect = rect.adjusted(labelMargin, labelMargin, -labelMargin, -labelMargin);
+            const QFontMetricsF fm{primitive.font};
+            primitive.labelRect.setHeight(std::min(primitive.labelRect.height(), fm.height()));
+            primitive.label = fm.elidedText(node->getLabel().simplified(), Qt::ElideRight, primitive.labelRect.width());
+        }
+        scene.bounds |= rect;
+        (primitive.group ? scene.groups : scene.nodes).push_back(primitive);
+    }
+    for (const auto& edge : graph.get_edges()) {
+        if (!edge)
+            continue;
+        const auto edgeItem = edge->getItem();
+        if (edgeItem != nullptr &&
+            (!edgeItem->isVisible() || edgeItem->getHidden()))
+            continue;
+        EdgePrimitive primitive;
+        // Culled edge items geometry is not maintained: fallback to a straight line between nodes like virtualized edges
+        if (edgeItem != nullptr &&
+            !edgeItem->getCulled()) {
+            const auto offset = container != nullptr ? edgeItem->mapToItem(container, QPointF{0., 0.}) : edgeItem->position();
+            primitive.line = edgeItem->getHitPolyline().translated(offset);
+            const auto& geometry = edgeItem->getEdgeGeometry();
+            primitive.src.shape = edgeItem->getSrcShape();
+            primitive.src.polygon = QPolygonF{{geometry.srcA1, geometry.srcA2, geometry.srcA3}}.translated(offset);
+            primitive.dst.shape = edgeItem->getDstShape();
+            primitive.dst.polygon = QPolygonF{{geometry.dstA1, geometry.dstA2, geometry.dstA3}}.translated(offset);
+            primitive.labelPos = edgeItem->getLabelPos() + offset;
+        } else {
+            const auto src = edge->get_src().lock();
+            const auto dst = edge->get_dst().lock();
+            if (!src || !dst)
+                continue;
+            const auto srcRect = nodeRect(*src, container);
+            const auto dstRect = nodeRect(*dst, container);
+            if (srcRect.isEmpty() || dstRect.isEmpty())
+                continue;
+            primitive.line = QPolygonF{{srcRect.center(), dstRect.center()}};
+            primitive.labelPos = (srcRect.center() + dstRect.center()) / 2.;
+        }
+        if (primitive.line.size() < 2)
+            continue;
+        const auto style = edgeItem != nullptr ? edgeItem->getStyle() : nullptr;
+        if (style != nullptr) {
+            primitive.color = style->getLineColor();
+            primitive.width = style->getLineWidth();
+            primitive.dashed = style->getDashed();
+        }
+        if (labels)
+            primitive.label = edge->getLabel();
+        primitive.bounds = primitive.line.boundingRect() | primitive.src.polygon.boundingRect() | primitive.dst.polygon.boundingRect();
+        primitive.bounds.adjust(-primitive.width, -primitive.width, primitive.width, primitive.width);
+        scene.bounds |= primitive.bounds;
+        scene.edges.push_back(primitive);
+    }
+    return scene;
+}
+
+//! Scene primitive output (either a QPainter or an SVG stream).
+class SceneSink
+{
+public:
+    virtual ~SceneSink() = default;
+    virtual void    node(const NodePrimitive& node) = 0;
+    virtual void    edge(const EdgePrimitive& edge) = 0;
+};
+
+//! Output scene primitives intersecting \c clip to \c sink, groups first, then edges and nodes.
+void    drawScene(const Scene& scene, SceneSink& sink, const QRectF& clip)
+{
+    for (const auto& group : scene.groups)
+        if (group.rect.intersects(clip))
+            sink.node(group);
+    for (const auto& edge : scene.edges)
+        if (edge.bounds.intersects(clip))
+            sink.edge(edge);
+    for (const auto& node : scene.nodes)
+        if (node.rect.intersects(clip))
+            sink.node(node);
+}
+
+class PainterSink : public SceneSink
+{
+public:
+    explicit PainterSink(QPainter& painter) : _painter(painter) {
+        _painter.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
+    }
+    virtual void    node(const NodePrimitive& node) override {
+        const auto hw = node.strokeWidth / 2.;
+        _painter.setPen(node.strokeWidth > 0. ? QPen{node.stroke, node.strokeWidth} : QPen{Qt::NoPen});
+        _painter.setBrush(node.fill);
+        _painter.drawRoundedRect(node.rect.adjusted(hw, hw, -hw, -hw), node.radius, node.radius);
+        if (!node.label.isEmpty()) {
+            _painter.setFont(node.font);
+            _painter.setPen(Qt::black);
+            _painter.drawText(node.labelRect, (node.group ? Qt::AlignLeft : Qt::AlignHCenter) | Qt::AlignTop, node.label);
+        }
+    }
+    virtual void    edge(const EdgePrimitive& edge) override {
+        QPen pen{edge.color, edge.width};
+        if (edge.dashed)
+            pen.setStyle(Qt::DashLine);
+        _painter.setPen(pen);
+        _painter.setBrush(Qt::NoBrush);
+        _painter.drawPolyline(edge.line);
+        pen.setStyle(Qt::SolidLine);
+        _painter.setPen(pen);
+        arrow(edge.src, edge.color);
+        arrow(edge.dst, edge.color);
+        if (!edge.label.isEmpty()) {
+            _painter.setFont(QFont{});
+            _painter.setPen(Qt::black);
+            const QRectF r{edge.labelPos - QPointF{500., 50.}, QSizeF{1000., 100.}};
+            _painter.drawText(r, Qt::AlignCenter, edge.label);
+        }
+    }
+private:
+    void    arrow(const ArrowPrimitive& arrow, const QColor& color) {
+        using ArrowShape = qan::EdgeStyle::ArrowShape;
+        const auto filled = arrow.shape == ArrowShape::Arrow || arrow.shape == ArrowShape::Circle || arrow.shape == ArrowShape::Rect;
+        _painter.setBrush(filled ? QBrush{color} : QBrush{Qt::NoBrush});
+        switch (arrow.shape) {
+        case ArrowShape::Arrow:
+        case ArrowShape::ArrowOpen: _painter.drawPolygon(arrow.polygon); break;
+        case ArrowShape::Circle:
+        case ArrowShape::CircleOpen: _painter.drawEllipse(arrow.polygon.boundingRect()); break;
+        case ArrowShape::Rect:
+        case ArrowShape::RectOpen: _painter.drawRect(arrow.polygon.boundingRect()); break;
+        case ArrowShape::None: break;
+        }
+    }
+    QPainter&   _painter;
+};
+
+class SvgSink : public SceneSink
+{
+public:
+    explicit SvgSink(QXmlStreamWriter& xml) : _xml(xml) { }
+    virtual void    node(const NodePrimitive& node) override {
+        const auto hw = node.strokeWidth / 2.;
+        const auto r = node.rect.adjusted(hw, hw, -hw, -hw);
+        _xml.writeStartElement(QStringLiteral("rect"));
+        _xml.writeAttribute(QStringLiteral("x"), QString::number(r.x()));
+        _xml.writeAttribute(QStringLiteral("y"), QString::number(r.y()));
+        _xml.writeAttribute(QStringLiteral("width"), QString::number(r.width()));
+        _xml.writeAttribute(QStringLiteral("height"), QString::number(r.height()));
+        _xml.writeAttribute(QStringLiteral("rx"), QString::number(node.radius));
+        fill(node.fill);
+        if (node.strokeWidth > 0.)
+            stroke(node.stroke, node.strokeWidth);
+        _xml.writeEndElement();
+        if (!node.label.isEmpty()) {
+            const QFontMetricsF fm{node.font};
+            _xml.writeStartElement(QStringLiteral("text"));
+            _xml.writeAttribute(QStringLiteral("x"), QString::number(node.group ? node.labelRect.left() : node.labelRect.center().x()));
+            _xml.writeAttribute(QStringLiteral("y"), QString::number(node.labelRect.top() + fm.ascent()));
+            if (!node.group)
+                _xml.writeAttribute(QStringLiteral("text-anchor"), QStringLiteral("middle"));
+            font(node.font);
+            _xml.writeCharacters(node.label);
+            _xml.writeEndElement();
+        }
+    }
+    virtual void    edge(const EdgePrimitive& edge) override {
+        _xml.writeStartElement(QStringLiteral("polyline"));
+        _xml.writeAttribute(QStringLiteral("points"), points(edge.line));
+        _xml.writeAttribute(QStringLiteral("fill"), QStringLiteral("none"));
+        stroke(edge.color, edge.width);
+        if (edge.dashed)
+            _xml.writeAttribute(QStringLiteral("stroke-dasharray"), QString::number(edge.width * 3.));
+        _xml.writeEndElement();
+        arrow(edge.src, edge.color, edge.width);
+        arrow(edge.dst, edge.color, edge.width);
+        if (!edge.label.isEmpty()) {
+            const QFont labelFont;
+            _xml.writeStartElement(QStringLiteral("text"));
+            _xml.writeAttribute(QStringLiteral("x"), QString::number(edge.labelPos.x()));
+            _xml.writeAttribute(QStringLiteral("y"), QString::number(edge.labelPos.y()));
+            _xml.writeAttribute(QStringLiteral("text-anchor"), QStringLiteral("middle"));
+            _xml.writeAttribute(QStringLiteral("dominant-baseline"), QStringLiteral("middle"));
+            font(labelFont);
+            _xml.writeCharacters(edge.label);
+            _xml.writeEndElement();
+        }
+    }
+private:
+    void    arrow(const ArrowPrimitive& arrow, const QColor& color, qreal width) {
+        using ArrowShape = qan::EdgeStyle::ArrowShape;
+        const auto br = arrow.polygon.boundingRect();
+        switch (arrow.shape) {
+        case ArrowShape::Arrow:
+        case ArrowShape::ArrowOpen:
+            _xml.writeStartElement(QStringLiteral("polygon"));
+            _xml.writeAttribute(QStringLiteral("points"), points(arrow.polygon));
+            break;
+        case ArrowShape::Circle:
+        case ArrowShape::CircleOpen:
+            _xml.writeStartElement(QStringLiteral("ellipse"));
+            _xml.writeAttribute(QStringLiteral("cx"), QString::number(br.center().x()));
+            _xml.writeAttribute(QStringLiteral("cy"), QString::number(br.center().y()));
+            _xml.writeAttribute(QStringLiteral("rx"), QString::number(br.width() / 2.));
+            _xml.writeAttribute(QStringLiteral("ry"), QString::number(br.height() / 2.));
+            break;
+        case ArrowShape::Rect:
+        case ArrowShape::RectOpen:
+            _xml.writeStartElement(QStringLiteral("rect"));
+            _xml.writeAttribute(QStringLiteral("x"), QString::number(br.x()));
+            _xml.writeAttribute(QStringLiteral("y"), QString::number(br.y()));
+            _xml.writeAttribute(QStringLiteral("width"), QString::number(br.width()));
+            _xml.writeAttribute(QStringLiteral("height"), QString::number(br.height()));
+            break;
+        case ArrowShape::None:
+            return;
+        }
+        const auto filled = arrow.shape == ArrowShape::Arrow || arrow.shape == ArrowShape::Circle || arrow.shape == ArrowShape::Rect;
+        if (filled)
+            fill(color);
+        else
+            _xml.writeAttribute(QStringLiteral("fill"), QStringLiteral("none"));
+        stroke(color, width);
+        _xml.writeEndElement();
+    }
+    void    fill(const QColor& color) {
+        _xml.writeAttribute(QStringLiteral("fill"), color.name(QColor::HexRgb));
+        if (color.alpha() != 255)
+            _xml.writeAttribute(QStringLiteral("fill-opacity"), QString::number(color.alphaF()));
+    }
+    void    stroke(const QColor& color, qreal width) {
+        _xml.writeAttribute(QStringLiteral("stroke"), color.name(QColor::HexRgb));
+        _xml.writeAttribute(QStringLiteral("stroke-width"), QString::number(width));
+        if (color.alpha() != 255)
+            _xml.writeAttribute(QStringLiteral("stroke-opacity"), QString::number(color.alphaF()));
+    }
+    void    font(const QFont& font) {
+        _xml.writeAttribute(QStringLiteral("font-family"), font.family());
+        _xml.writeAttribute(QStringLiteral("font-size"), QString::number(QFontInfo{font}.pixelSize()));
+        if (font.bold())
+            _xml.writeAttribute(QStringLiteral("font-weight"), QStringLiteral("bold"));
+    }
+    static QString  points(const QPolygonF& polygon) {
+        QString result;
+        for (const auto& p : polygon)
+            result += QString::number(p.x()) + QLatin1Char(',') + QString::number(p.y()) + QLatin1Char(' ');
+        return result.trimmed();
+    }
+    QXmlStreamWriter&   _xml;
+};
+
+//! PackBits encode \c size bytes from \c data to \c out (TIFF compression 32773).
+void    packBits(const uchar* data, int size, QByteArray& out)
+{
+    int i = 0;
+    while (i < size) {
+        if (i + 1 < size &&
+            data[i] == data[i + 1]) {       // Run of repeated bytes
+            int run = 2;
+            while (i + run < size && run < 128 && data[i + run] == data[i])
+                ++run;
+            out.append(static_cast<char>(1 - run));
+            out.append(static_cast<char>(data[i]));
+            i += run;
+        } else {                            // Literal bytes, until next run
+            int literal = 1;
+            while (i + literal < size && literal < 128 &&
+                   !(i + literal + 1 < size && data[i + literal] == data[i + literal + 1]))
+                ++literal;
+            out.append(static_cast<char>(literal - 1));
+            out.append(reinterpret_cast<const char*>(data + i), literal);
+            i += literal;
+        }
+    }
+}
+
+} // ::qan::anonymous
+
+/* GraphExporter Object Management *///---------------------------------------
+GraphExporter::GraphExporter(QObject* parent) :
+    QObject{parent}
+{
+}
+
+void    GraphExporter::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph != _graph) {
+        _graph = graph;
+        emit graphChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Export Settings *///--------------------------------------------------------
+void    GraphExporter::setZoom(qreal zoom) noexcept
+{
+    zoom = std::max(0.01, zoom);
+    if (!qFuzzyCompare(1. + zoom, 1. + _zoom)) {
+        _zoom = zoom;
+        emit zoomChanged();
+    }
+}
+
+void    GraphExporter::setBorder(qreal border) noexcept
+{
+    border = std::max(0., border);
+    if (!qFuzzyCompare(1. + border, 1. + _border)) {
+        _border = border;
+        emit borderChanged();
+    }
+}
+
+void    GraphExporter::setTileSize(int tileSize) noexcept
+{
+    tileSize = std::max(16, (tileSize + 15) / 16 * 16);     // TIFF tile size must be a multiple of 16
+    if (tileSize != _tileSize) {
+        _tileSize = tileSize;
+        emit tileSizeChanged();
+    }
+}
+
+void    GraphExporter::setBackgroundColor(QColor backgroundColor) noexcept
+{
+    if (backgroundColor != _backgroundColor) {
+        _backgroundColor = backgroundColor;
+        emit backgroundColorChanged();
+    }
+}
+
+void    GraphExporter::setLabels(bool labels) noexcept
+{
+    if (labels != _labels) {
+        _labels = labels;
+        emit labelsChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Export *///-----------------------------------------------------------
+QRectF  GraphExporter::getSceneBounds() const noexcept
+{
+    return _graph ? collectScene(*_graph, false).bounds : QRectF{};
+}
+
+QString GraphExporter::localFilePath(const QString& filePath)
+{
+    const QUrl url{filePath};
+    return url.isLocalFile() ? url.toLocalFile() : filePath;
+}
+
+bool    GraphExporter::fail(const QString& error)
+{
+    qWarning() << "qan::GraphExporter:" << error;
+    emit exportFailed(error);
+    return false;
+}
+
+bool    GraphExporter::exportImage(const QString& filePath)
+{
+    const auto suffix = QFileInfo{localFilePath(filePath)}.suffix().toLower();
+    if (suffix == QStringLiteral("tif") ||
+        suffix == QStringLiteral("tiff"))
+        return exportTiff(localFilePath(filePath));
+    if (!_graph)
+        return fail(QStringLiteral("exportImage(): no graph."));
+    const auto scene = collectScene(*_graph, _labels);
+    if (scene.bounds.isEmpty())
+        return fail(QStringLiteral("exportImage(): graph is empty."));
+    const auto sceneRect = scene.bounds.adjusted(-_border, -_border, _border, _border);
+    const QSize imageSize{static_cast<int>(std::ceil(sceneRect.width() * _zoom)),
+                          static_cast<int>(std::ceil(sceneRect.height() * _zoom))};
+    QImage image{imageSize, QImage::Format_ARGB32_Premultiplied};
+    if (image.isNull())
+        return fail(QStringLiteral("exportImage(): image is too large, use a TIFF file or a lower zoom."));
+    image.fill(_backgroundColor);
+
+    // Compose image from tiles: each tile only draws the primitives it intersects
+    const auto tileCountX = (imageSize.width() + _tileSize - 1) / _tileSize;
+    const auto tileCountY = (imageSize.height() + _tileSize - 1) / _tileSize;
+    const auto tileCount = tileCountX * tileCountY;
+    QPainter painter{&image};
+    PainterSink sink{painter};
+    for (int t = 0; t < tileCount; ++t) {
+        const QRect tile{(t % tileCountX) * _tileSize, (t / tileCountX) * _tileSize, _tileSize, _tileSize};
+        painter.save();
+        painter.setClipRect(tile);
+        painter.scale(_zoom, _zoom);
+        painter.translate(-sceneRect.topLeft());
+        drawScene(scene, sink, QRectF{sceneRect.topLeft() + QPointF{tile.topLeft()} / _zoom, QSizeF{tile.size()} / _zoom});
+        painter.restore();
+        emit exportProgress(static_cast<qreal>(t + 1) / tileCount);
+    }
+    painter.end();
+    QImageWriter writer{localFilePath(filePath)};
+    if (!writer.write(image))
+        return fail(QStringLiteral("exportImage(): ") + writer.errorString());
+    return true;
+}
+
+bool    GraphExporter::exportTiff(const QString& filePath)
+{
+    if (!_graph)
+        return fail(QStringLiteral("exportImage(): no graph."));
+    const auto scene = collectScene(*_graph, _labels);
+    if (scene.bounds.isEmpty())
+        return fail(QStringLiteral("exportImage(): graph is empty."));
+    const auto sceneRect = scene.bounds.adjusted(-_border, -_border, _border, _border);
+    const auto width = static_cast<quint32>(std::ceil(sceneRect.width() * _zoom));
+    const auto height = static_cast<quint32>(std::ceil(sceneRect.height() * _zoom));
+    const auto tileSize = static_cast<quint32>(_tileSize);
+    const auto tileCountX = (width + tileSize - 1) / tileSize;
+    const auto tileCountY = (height + tileSize - 1) / tileSize;
+    const auto tileCount = tileCountX * tileCountY;
+
+    QFile file{filePath};
+    if (!file.open(QIODevice::WriteOnly))
+        return fail(QStringLiteral("exportImage(): ") + file.errorString());
+    QDataStream out{&file};
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.writeRawData("II", 2);
+    out << quint16{42} << quint32{0};               // IFD offset is written once tiles are written
+
+    // Tiles are rendered and PackBits compressed row by row (premultiplied RGBA, ie associated alpha)
+    std::vector<quint32> tileOffsets, tileByteCounts;
+    tileOffsets.reserve(tileCount);
+    tileByteCounts.reserve(tileCount);
+    QImage tile{_tileSize, _tileSize, QImage::Format_RGBA8888_Premultiplied};
+    QByteArray packed;
+    for (quint32 t = 0; t < tileCount; ++t) {
+        const QPointF tileOrigin{static_cast<qreal>((t % tileCountX) * tileSize), static_cast<qreal>((t / tileCountX) * tileSize)};
+        tile.fill(_backgroundColor);
+        {
+            QPainter painter{&tile};
+            PainterSink sink{painter};
+            painter.translate(-tileOrigin);
+            painter.scale(_zoom, _zoom);
+            painter.translate(-sceneRect.topLeft());
+            drawScene(scene, sink, QRectF{sceneRect.topLeft() + tileOrigin / _zoom, QSizeF{tile.size()} / _zoom});
+        }
+        packed.clear();
+        for (int y = 0; y < tile.height(); ++y)
+            packBits(tile.constScanLine(y), tile.width() * 4, packed);
+        const auto offset = file.pos();
+        if (offset + packed.size() > std::numeric_limits<quint32>::max())
+            return fail(QStringLiteral("exportImage(): TIFF file would exceed 4GB, use a lower zoom."));
+        tileOffsets.push_back(static_cast<quint32>(offset));
+        tileByteCounts.push_back(static_cast<quint32>(packed.size()));
+        out.writeRawData(packed.constData(), packed.size());
+        emit exportProgress(static_cast<qreal>(t + 1) / tileCount);
+    }
+
+    // Out of line tag values, then IFD (word aligned)
+    if (file.pos() % 2)
+        out << quint8{0};
+    const auto bitsPerSampleOffset = static_cast<quint32>(file.pos());
+    out << quint16{8} << quint16{8} << quint16{8} << quint16{8};
+    const auto resolutionOffset = static_cast<quint32>(file.pos());
+    out << quint32{72} << quint32{1};
+    const auto arrayOffset = [&out, &file, tileCount](const std::vector<quint32>& values) -> quint32 {
+        if (tileCount == 1)                         // Single value is stored in IFD entry
+            return values.front();
+        const auto offset = static_cast<quint32>(file.pos());
+        for (const auto value : values)
+            out << value;
+        return offset;
+    };
+    const auto tileOffsetsValue = arrayOffset(tileOffsets);
+    const auto tileByteCountsValue = arrayOffset(tileByteCounts);
+    const auto ifdOffset = static_cast<quint32>(file.pos());
+    enum : quint16 { Short = 3, Long = 4, Rational = 5 };
+    const auto entry = [&out](quint16 tag, quint16 type, quint32 count, quint32 value) {
+        out << tag << type << count;
+        if (type == Short && count == 1)            // Short values are left justified
+            out << static_cast<quint16>(value) << quint16{0};
+        else
+            out << value;
+    };
+    out << quint16{15};
+    entry(256, Long, 1, width);                     // ImageWidth
+    entry(257, Long, 1, height);                    // ImageLength
+    entry(258, Short, 4, bitsPerSampleOffset);      // BitsPerSample
+    entry(259, Short, 1, 32773);                    // Compression: PackBits
+    entry(262, Short, 1, 2);                        // PhotometricInterpretation: RGB
+    entry(277, Short, 1, 4);                        // SamplesPerPixel
+    entry(282, Rational, 1, resolutionOffset);      // XResolution
+    entry(283, Rational, 1, resolutionOffset);      // YResolution
+    entry(284, Short, 1, 1);                        // PlanarConfiguration: chunky
+    entry(296, Short, 1, 2);                        // ResolutionUnit: inch
+    entry(322, Long, 1, tileSize);                  // TileWidth
+    entry(323, Long, 1, tileSize);                  // TileLength
+    entry(324, Long, tileCount, tileOffsetsValue);  // TileOffsets
+    entry(325, Long, tileCount, tileByteCountsValue);   // TileByteCounts
+    entry(338, Short, 1, 1);                        // ExtraSamples: associated alpha
+    out << quint32{0};                              // No next IFD
+    file.seek(4);
+    out << ifdOffset;
+    if (out.status() != QDataStream::Ok)
+        return fail(QStringLiteral("exportImage(): error while writing ") + filePath);
+    return true;
+}
+
+bool    GraphExporter::exportTilePyramid(const QString& filePath)
+{
+    if (!_graph)
+        return fail(QStringLiteral("exportTilePyramid(): no graph."));
+    const auto scene = collectScene(*_graph, _labels);
+    if (scene.bounds.isEmpty())
+        return fail(QStringLiteral("exportTilePyramid(): graph is empty."));
+    const auto sceneRect = scene.bounds.adjusted(-_border, -_border, _border, _border);
+
+    // Zoom is halved from a level to the next one, until scene fits in a single tile
+    struct Level {
+        qreal   zoom = 1.;
+        quint32 tileCountX = 1;
+        quint32 tileCountY = 1;
+    };
+    constexpr std::size_t maxLevels = 32;
+    std::vector<Level> levels;
+    std::size_t tileCount = 0;
+    for (auto zoom = _zoom; levels.size() < maxLevels; zoom /= 2.) {
+        Level level;
+        level.zoom = zoom;
+        level.tileCountX = static_cast<quint32>(std::max(1., std::ceil(sceneRect.width() * zoom / _tileSize)));
+        level.tileCountY = static_cast<quint32>(std::max(1., std::ceil(sceneRect.height() * zoom / _tileSize)));
+        levels.push_back(level);
+        tileCount += static_cast<std::size_t>(level.tileCountX) * level.tileCountY;
+        if (level.tileCountX == 1 &&
+            level.tileCountY == 1)
+            break;
+    }
+
+    QFile file{localFilePath(filePath)};
+    if (!file.open(QIODevice::WriteOnly))
+        return fail(QStringLiteral("exportTilePyramid(): ") + file.errorString());
+    QDataStream out{&file};
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+    out.writeRawData(qan::TilePyramid::magic, 8);
+    out << qan::TilePyramid::version << static_cast<quint32>(_tileSize)
+        << static_cast<quint32>(levels.size()) << quint32{0};
+    out << sceneRect.x() << sceneRect.y() << sceneRect.width() << sceneRect.height();
+    for (const auto& level : levels)
+        out << level.zoom << level.tileCountX << level.tileCountY;
+    const auto indexOffset = file.pos();
+    std::vector<quint64> tileOffsets(tileCount, 0);     // Index is written once tiles are written
+    for (std::size_t t = 0; t < tileCount; ++t)
+        out << quint64{0};
+
+    QImage tile{_tileSize, _tileSize, QImage::Format_RGBA8888_Premultiplied};
+    std::size_t firstTile = 0;
+    for (const auto& level : levels) {
+        // Bucket primitives (in groups, edges then nodes drawing order) in the level tiles they intersect
+        enum class Kind : quint8 { Group, Edge, Node };
+        using Primitive = std::pair<Kind, std::uint32_t>;
+        std::vector<std::vector<Primitive>> buckets(static_cast<std::size_t>(level.tileCountX) * level.tileCountY);
+        const auto span = _tileSize / level.zoom;       // Tile size in graph units
+        const auto bucket = [&](const QRectF& r, Kind kind, std::size_t p) {
+            const auto tileCoord = [span](qreal c, quint32 count) {
+                return static_cast<quint32>(std::max(0., std::min(static_cast<qreal>(count - 1), std::floor(c / span))));
+            };
+            const auto x0 = tileCoord(r.left() - sceneRect.left(), level.tileCountX);
+            const auto x1 = tileCoord(r.right() - sceneRect.left(), level.tileCountX);
+            const auto y0 = tileCoord(r.top() - sceneRect.top(), level.tileCountY);
+            const auto y1 = tileCoord(r.bottom() - sceneRect.top(), level.tileCountY);
+            for (auto y = y0; y <= y1; ++y)
+                for (auto x = x0; x <= x1; ++x)
+                    buckets[static_cast<std::size_t>(y) * level.tileCountX + x].emplace_back(kind, static_cast<std::uint32_t>(p));
+        };
+        for (std::size_t p = 0; p < scene.groups.size(); ++p)
+            bucket(scene.groups[p].rect, Kind::Group, p);
+        for (std::size_t p = 0; p < scene.edges.size(); ++p)
+            bucket(scene.edges[p].bounds, Kind::Edge, p);
+        for (std::size_t p = 0; p < scene.nodes.size(); ++p)
+            bucket(scene.nodes[p].rect, Kind::Node, p);
+
+        for (std::size_t t = 0; t < buckets.size(); ++t) {
+            const auto& primitives = buckets[t];
+            if (!primitives.empty()) {      // Empty tiles are not stored
+                const QPointF tileOrigin{static_cast<qreal>((t % level.tileCountX) * static_cast<quint32>(_tileSize)),
+                                         static_cast<qreal>((t / level.tileCountX) * static_cast<quint32>(_tileSize))};
+                tile.fill(_backgroundColor);
+                {
+                    QPainter painter{&tile};
+                    PainterSink sink{painter};
+                    painter.translate(-tileOrigin);
+                    painter.scale(level.zoom, level.zoom);
+                    painter.translate(-sceneRect.topLeft());
+                    for (const auto& primitive : primitives) {
+                        switch (primitive.first) {
+                        case Kind::Group:   sink.node(scene.groups[primitive.second]);  break;
+                        case Kind::Edge:    sink.edge(scene.edges[primitive.second]);   break;
+                        case Kind::Node:    sink.node(scene.nodes[primitive.second]);   break;
+                        }
+                    }
+                }
+                tileOffsets[firstTile + t] = static_cast<quint64>(file.pos());
+                out.writeRawData(reinterpret_cast<const char*>(tile.constBits()), tile.bytesPerLine() * tile.height());
+            }
+            emit exportProgress(static_cast<qreal>(firstTile + t + 1) / tileCount);
+        }
+        firstTile += buckets.size();
+    }
+    file.seek(indexOffset);
+    for (const auto offset : tileOffsets)
+        out << offset;
+    if (out.status() != QDataStream::Ok)
+        return fail(QStringLiteral("exportTilePyramid(): error while writing ") + filePath);
+    return true;
+}
+
+bool    GraphExporter::exportSvg(const QString& filePath)
+{
+    if (!_graph)
+        return fail(QStringLiteral("exportSvg(): no graph."));
+    const auto scene = collectScene(*_graph, _labels);
+    if (scene.bounds.isEmpty())
+        return fail(QStringLiteral("exportSvg(): graph is empty."));
+    QFile file{localFilePath(filePath)};
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return fail(QStringLiteral("exportSvg(): ") + file.errorString());
+    const auto sceneRect = scene.bounds.adjusted(-_border, -_border, _border, _border);
+    QXmlStreamWriter xml{&file};
+    xml.writeStartDocument();
+    xml.writeStartElement(QStringLiteral("svg"));
+    xml.writeDefaultNamespace(QStringLiteral("http://www.w3.org/2000/svg"));
+    xml.writeAttribute(QStringLiteral("version"), QStringLiteral("1.1"));
+    xml.writeAttribute(QStringLiteral("width"), QString::number(sceneRect.width()));
+    xml.writeAttribute(QStringLiteral("height"), QString::number(sceneRect.height()));
+    xml.writeAttribute(QStringLiteral("viewBox"), QStringLiteral("%1 %2 %3 %4").arg(sceneRect.x()).arg(sceneRect.y())
+                                                                               .arg(sceneRect.width()).arg(sceneRect.height()));
+    if (_backgroundColor.alpha() > 0) {
+        xml.writeStartElement(QStringLiteral("rect"));
+        xml.writeAttribute(QStringLiteral("x"), QString::number(sceneRect.x()));
+        xml.writeAttribute(QStringLiteral("y"), QString::number(sceneRect.y()));
+        xml.writeAttribute(QStringLiteral("width"), QString::number(sceneRect.width()));
+        xml.writeAttribute(QStringLiteral("height"), QString::number(sceneRect.height()));
+        xml.writeAttribute(QStringLiteral("fill"), _backgroundColor.name(QColor::HexRgb));
+        xml.writeEndElement();
+    }
+    SvgSink sink{xml};
+    drawScene(scene, sink, sceneRect);
+    xml.writeEndElement();
+    xml.writeEndDocument();
+    if (xml.hasError())
+        return fail(QStringLiteral("exportSvg(): error while writing ") + filePath);
+    return true;
+}
+
+bool    GraphExporter::exportPdf(const QString& filePath)
+{
+    if (!_graph)
+        return fail(QStringLiteral("exportPdf(): no graph."));
+    const auto scene = collectScene(*_graph, _labels);
+    if (scene.bounds.isEmpty())
+        return fail(QStringLiteral("exportPdf(): graph is empty."));
+    const auto sceneRect = scene.bounds.adjusted(-_border, -_border, _border, _border);
+    QPdfWriter writer{localFilePath(filePath)};
+    writer.setPageSize(QPageSize{sceneRect.size(), QPageSize::Point});
+    writer.setPageMargins(QMarginsF{0., 0., 0., 0.});
+    QPainter painter;
+    if (!painter.begin(&writer))
+        return fail(QStringLiteral("exportPdf(): can't write ") + filePath);
+    const auto scale = writer.width() / sceneRect.width();
+    painter.scale(scale, scale);
+    painter.translate(-sceneRect.topLeft());
+    if (_backgroundColor.alpha() > 0)
+        painter.fillRect(sceneRect, _backgroundColor);
+    PainterSink sink{painter};
+    drawScene(scene, sink, sceneRect);
+    painter.end();
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,210 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphExporter.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QColor>
+#include <QRectF>
+#include <QString>
+
+namespace qan { // ::qan
+
+class Graph;
+
+/*! \brief Export a complete graph (not only the viewport) to raster images, SVG or PDF documents.
+ *
+ * Exporter draws graph groups, edges and nodes from their current geometry (node items, edge items hit polyline and
+ * arrows, or node geometry for virtualized nodes) with node and edge styles: output does not depend on viewport,
+ * graph view zoom nor GPU maximum texture size.
+ *
+ * \li exportImage() renders scene in \c tileSize square tiles. TIFF files are streamed tile by tile (tiled TIFF with
+ * PackBits compression): memory usage is bounded to a single tile whatever the image size. Other formats (PNG, JPG,
+ * etc.) are composed from tiles in a single image saved with QImageWriter.
+ * \li exportSvg() streams SVG elements directly to file.
+ * \li exportPdf() draws scene on a single PDF page sized to scene bounds.
+ * \li exportTilePyramid() pre-renders scene to a memory mappable zoom level tile pyramid (see qan::TileView).
+ *
+ * \code
+ * Qan.GraphExporter {
+ *   id: exporter
+ *   graph: graphView.graph
+ *   zoom: 2.0
+ * }
+ * exporter.exportImage("file:///tmp/poster.tif")
+ * \endcode
+ *
+ * \note Custom QML delegates content is not exported: nodes are drawn as rounded rectangles with a single line label.
+ * \nosubgrouping
+ */
+class GraphExporter : public QObject
+{
+    /*! \name GraphExporter Object Management *///-----------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit GraphExporter(QObject* parent = nullptr);
+    virtual ~GraphExporter() override = default;
+    GraphExporter(const GraphExporter&) = delete;
+
+public:
+    //! Exported graph.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Export Settings *///---------------------------------------------
+    //@{
+public:
+    //! Raster export scale, image pixels per graph unit (default to 1.0).
+    Q_PROPERTY(qreal zoom READ getZoom WRITE setZoom NOTIFY zoomChanged FINAL)
+    //! \copydoc zoom
+    inline qreal        getZoom() const noexcept { return _zoom; }
+    //! \copydoc zoom
+    void                setZoom(qreal zoom) noexcept;
+private:
+    qreal               _zoom = 1.;
+signals:
+    void                zoomChanged();
+
+public:
+    //! Margin around scene bounds in graph units (default to 10.0).
+    Q_PROPERTY(qreal border READ getBorder WRITE setBorder NOTIFY borderChanged FINAL)
+    //! \copydoc border
+    inline qreal        getBorder() const noexcept { return _border; }
+    //! \copydoc border
+    void                setBorder(qreal border) noexcept;
+private:
+    qreal               _border = 10.;
+signals:
+    void                borderChanged();
+
+public:
+    //! Raster export tile size in pixels, rounded to a multiple of 16 (default to 1024).
+    Q_PROPERTY(int tileSize READ getTileSize WRITE setTileSize NOTIFY tileSizeChanged FINAL)
+    //! \copydoc tileSize
+    inline int          getTileSize() const noexcept { return _tileSize; }
+    //! \copydoc tileSize
+    void                setTileSize(int tileSize) noexcept;
+private:
+    int                 _tileSize = 1024;
+signals:
+    void                tileSizeChanged();
+
+public:
+    //! Export background color (default to white, transparent is supported for raster formats with alpha and SVG).
+    Q_PROPERTY(QColor backgroundColor READ getBackgroundColor WRITE setBackgroundColor NOTIFY backgroundColorChanged FINAL)
+    //! \copydoc backgroundColor
+    inline QColor       getBackgroundColor() const noexcept { return _backgroundColor; }
+    //! \copydoc backgroundColor
+    void                setBackgroundColor(QColor backgroundColor) noexcept;
+private:
+    QColor              _backgroundColor{Qt::white};
+signals:
+    void                backgroundColorChanged();
+
+public:
+    //! Export node, group and edge labels (default to true).
+    Q_PROPERTY(bool labels READ getLabels WRITE setLabels NOTIFY labelsChanged FINAL)
+    //! \copydoc labels
+    inline bool         getLabels() const noexcept { return _labels; }
+    //! \copydoc labels
+    void                setLabels(bool labels) noexcept;
+private:
+    bool                _labels = true;
+signals:
+    void                labelsChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Export *///------------------------------------------------
+    //@{
+public:
+    //! Return exported scene bounds in graph container CS (nodes, groups and edges bounding rect, without border).
+    Q_INVOKABLE QRectF  getSceneBounds() const noexcept;
+
+    /*! \brief Render graph to raster image \c filePath (local file path or url), image format is deduced from file suffix.
+     *
+     * \return false and emit exportFailed() if graph is empty or file can't be written.
+     */
+    Q_INVOKABLE bool    exportImage(const QString& filePath);
+
+    //! Write graph to \c filePath SVG file (local file path or url).
+    Q_INVOKABLE bool    exportSvg(const QString& filePath);
+
+    //! Write graph to \c filePath PDF file (local file path or url).
+    Q_INVOKABLE bool    exportPdf(const QString& filePath);
+
+    /*! \brief Pre-render graph to a zoom level tile pyramid file \c filePath (local file path or url), see qan::TilePyramid.
+     *
+     * Level 0 is rendered at \c zoom with \c tileSize tiles, zoom is halved for each next level until scene fits in a
+     * single tile. Primitives are bucketed once per level in the tiles they intersect: every tile only draws its own
+     * primitives, tiles with no primitives are not rendered nor stored (use a transparent \c backgroundColor, or a
+     * color matching the view background). Pyramid is displayed with qan::TileView.
+     *
+     * \return false and emit exportFailed() if graph is empty or file can't be written.
+     */
+    Q_INVOKABLE bool    exportTilePyramid(const QString& filePath);
+
+signals:
+    //! Emitted during raster export after each tile, \c progress in [0, 1].
+    void                exportProgress(qreal progress);
+    //! Emitted when an export fails with an \c error description.
+    void                exportFailed(QString error);
+
+private:
+    //! Return local path for \c filePath (either a local path or a file url).
+    static QString      localFilePath(const QString& filePath);
+    //! Report \c error with a warning and exportFailed(), always return false.
+    bool                fail(const QString& error);
+    //! Write a tiled TIFF file without holding full image in memory.
+    bool                exportTiff(const QString& filePath);
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::GraphExporter)
@@ -0,0 +1,718 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphImporter.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+// Qt headers
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QElapsedTimer>
+#include <QXmlStreamReader>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QThreadPool>
+#include <QRunnable>
+
+// QuickQanava headers
+#include "./qanGraphImporter.h"
+#include "./qanGroup.h"
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+/* ImportedGraph Parsing *///--------------------------------------------------
+namespace { // ::qan::anonymous
+
+//! Edge with unresolved source and destination ids.
+struct PendingEdge {
+    QString     src;
+    QString     dst;
+    QString     label;
+    qreal       weight = 1.;
+};
+
+//! Resolve \c pendingEdges ids in \c graph, return an error on unknown id.
+QString resolveEdges(const std::vector<PendingEdge>& pendingEdges, const QHash<QString, std::uint32_t>& ids, qan::ImportedGraph& graph)
+{
+    graph.edges.reserve(pendingEdges.size());
+    for (const auto& pendingEdge : pendingEdges) {
+        const auto src = ids.constFind(pendingEdge.src);
+        const auto dst = ids.constFind(pendingEdge.dst);
+        if (src == ids.cend() || dst == ids.cend())
+            return QStringLiteral("Edge references an unknown node: ") + (src == ids.cend() ? pendingEdge.src : pendingEdge.dst);
+        qan::ImportedGraph::Edge edge;
+        edge.src = *src;
+        edge.dst = *dst;
+        edge.label = pendingEdge.label;
+        edge.weight = pendingEdge.weight;
+        graph.edges.push_back(std::move(edge));
+    }
+    return QString{};
+}
+
+//! Set \c node geometry component \c name to \c value (x, y, width or height), return false if \c name is not a geometry component.
+bool    setGeometryValue(qan::ImportedGraph::Node& node, const QString& name, qreal value) noexcept
+{
+    if (name == QStringLiteral("x")) {
+        node.geometry.moveLeft(value);
+        node.hasPosition = true;
+    } else if (name == QStringLiteral("y")) {
+        node.geometry.moveTop(value);
+        node.hasPosition = true;
+    } else if (name == QStringLiteral("width")) {
+        node.geometry.setWidth(value);
+        node.hasSize = true;
+    } else if (name == QStringLiteral("height")) {
+        node.geometry.setHeight(value);
+        node.hasSize = true;
+    } else
+        return false;
+    return true;
+}
+
+} // ::qan::anonymous
+
+QString ImportedGraph::parseGraphML(QIODevice& device, ImportedGraph& graph, const std::atomic<bool>* cancel,
+                                    const std::function<void(qreal)>& progress)
+{
+    QXmlStreamReader xml{&device};
+    const auto size = device.size();
+    QHash<QString, QString>         keyNames;       // Key id to lower case attr.name
+    QHash<QString, std::uint32_t>   ids;
+    std::vector<PendingEdge>        pendingEdges;
+    std::vector<std::int32_t>       nodeStack;      // Actually parsed node elements
+    std::vector<std::int32_t>       graphStack;     // Actually parsed graph elements host group (-1 for top level graph)
+    bool        inEdge = false;
+    std::size_t tokens = 0;
+
+    while (!xml.atEnd()) {
+        const auto token = xml.readNext();
+        if ((++tokens & 0xFFF) == 0) {
+            if (cancel != nullptr && cancel->load())
+                return QStringLiteral("Import cancelled.");
+            if (progress && size > 0)
+                progress(static_cast<qreal>(device.pos()) / size);
+        }
+        if (token == QXmlStreamReader::StartElement) {
+            const auto name = xml.name();
+            const auto attributes = xml.attributes();
+            if (name == QLatin1String("key")) {
+                keyNames.insert(attributes.value(QLatin1String("id")).toString(),
+                                attributes.value(QLatin1String("attr.name")).toString().toLower());
+            } else if (name == QLatin1String("graph")) {
+                const auto host = nodeStack.empty() ? -1 : nodeStack.back();
+                if (host >= 0)
+                    graph.nodes[static_cast<std::size_t>(host)].isGroup = true;
+                graphStack.push_back(host);
+            } else if (name == QLatin1String("node")) {
+                const auto id = attributes.value(QLatin1String("id")).toString();
+                const auto index = static_cast<std::uint32_t>(graph.nodes.size());
+                if (ids.contains(id))
+                    return QStringLiteral("Duplicate node id: ") + id;
+                ids.insert(id, index);
+                ImportedGraph::Node node;
+                node.id = id;
+                node.parent = graphStack.empty() ? -1 : graphStack.back();
+                graph.nodes.push_back(std::move(node));
+                nodeStack.push_back(static_cast<std::int32_t>(index));
+            } else if (name == QLatin1String("edge")) {
+                PendingEdge edge;
+                edge.src = attributes.value(QLatin1String("source")).toString();
+                edge.dst = attributes.value(QLatin1String("target")).toString();
+                pendingEdges.push_back(std::move(edge));
+                inEdge = true;
+            } else if (name == QLatin1String("data")) {
+                const auto key = attributes.value(QLatin1String("key")).toString();
+                const auto keyName = keyNames.value(key, key);
+                if (keyName != QLatin1String("label") && keyName != QLatin1String("weight") &&
+                    keyName != QLatin1String("x") && keyName != QLatin1String("y") &&
+                    keyName != QLatin1String("width") && keyName != QLatin1String("height"))
+                    continue;       // Unsupported data, nested elements (yEd graphics) are parsed
+                const auto text = xml.readElementText(QXmlStreamReader::IncludeChildElements).trimmed();
+                if (inEdge) {
+                    auto& edge = pendingEdges.back();
+                    if (keyName == QLatin1String("label"))
+                        edge.label = text;
+                    else if (keyName == QLatin1String("weight"))
+                        edge.weight = text.toDouble();
+                } else if (!nodeStack.empty()) {
+                    auto& node = graph.nodes[static_cast<std::size_t>(nodeStack.back())];
+                    if (keyName == QLatin1String("label"))
+                        node.label = text;
+                    else
+                        setGeometryValue(node, keyName, text.toDouble());
+                }
+            } else if (name == QLatin1String("Geometry") &&     // yEd node geometry
+                       !inEdge && !nodeStack.empty()) {
+                auto& node = graph.nodes[static_cast<std::size_t>(nodeStack.back())];
+                for (const auto& attribute : attributes)
+                    setGeometryValue(node, attribute.name().toString(), attribute.value().toDouble());
+            } else if (name == QLatin1String("NodeLabel") ||    // yEd labels
+                       name == QLatin1String("EdgeLabel")) {
+                const auto text = xml.readElementText(QXmlStreamReader::IncludeChildElements).trimmed();
+                if (inEdge) {
+                    if (pendingEdges.back().label.isEmpty())
+                        pendingEdges.back().label = text;
+                } else if (!nodeStack.empty()) {
+                    auto& node = graph.nodes[static_cast<std::size_t>(nodeStack.back())];
+                    if (node.label.isEmpty())
+                        node.label = text;
+                }
+            }
+        } else if (token == QXmlStreamReader::EndElement) {
+            const auto name = xml.name();
+            if (name == QLatin1String("node") && !nodeStack.empty())
+                nodeStack.pop_back();
+            else if (name == QLatin1String("graph") && !graphStack.empty())
+                graphStack.pop_back();
+            else if (name == QLatin1String("edge"))
+                inEdge = false;
+        }
+    }
+    if (xml.hasError())
+        return QStringLiteral("GraphML error line %1: %2").arg(xml.lineNumber()).arg(xml.errorString());
+    return resolveEdges(pendingEdges, ids, graph);
+}
+
+QString ImportedGraph::parseJson(QIODevice& device, ImportedGraph& graph, const std::atomic<bool>* cancel,
+                                 const std::function<void(qreal)>& progress)
+{
+    QJsonParseError parseError;
+    const auto document = QJsonDocument::fromJson(device.readAll(), &parseError);
+    if (document.isNull())
+        return QStringLiteral("JSON error at offset %1: %2").arg(parseError.offset).arg(parseError.errorString());
+    if (progress)
+        progress(0.5);
+    const auto root = document.object();
+    const auto groups = root.value(QLatin1String("groups")).toArray();
+    const auto nodes = root.value(QLatin1String("nodes")).toArray();
+    const auto edges = root.value(QLatin1String("edges")).toArray();
+    const auto toId = [](const QJsonValue& value) -> QString {
+        return value.isString() ? value.toString() :
+                                  ( value.isDouble() ? QString::number(value.toDouble(), 'g', 17) : QString{} );
+    };
+
+    QHash<QString, std::uint32_t>   ids;
+    std::vector<QString>            parentIds;
+    graph.nodes.reserve(static_cast<std::size_t>(groups.size() + nodes.size()));
+    parentIds.reserve(graph.nodes.capacity());
+    const auto total = static_cast<qreal>(std::max(1, groups.size() + nodes.size() + edges.size()));
+    int count = 0;
+    const auto tick = [&]() -> bool {
+        if ((++count & 0xFFF) == 0) {
+            if (cancel != nullptr && cancel->load())
+                return false;
+            if (progress)
+                progress(0.5 + 0.5 * count / total);
+        }
+        return true;
+    };
+    const auto readNodes = [&](const QJsonArray& array, bool isGroup) -> QString {
+        for (const auto& value : array) {
+            if (!tick())
+                return QStringLiteral("Import cancelled.");
+            const auto object = value.toObject();
+            const auto id = toId(object.value(QLatin1String("id")));
+            if (id.isEmpty())
+                return QStringLiteral("Node without id.");
+            if (ids.contains(id))
+                return QStringLiteral("Duplicate node id: ") + id;
+            ids.insert(id, static_cast<std::uint32_t>(graph.nodes.size()));
+            ImportedGraph::Node node;
+            node.id = id;
+            node.label = object.value(QLatin1String("label")).toString();
+            node.isGroup = isGroup;
+            for (const auto component : { QStringLiteral("x"), QStringLiteral("y"), QStringLiteral("width"), QStringLiteral("height") }) {
+                const auto componentValue = object.value(component);
+                if (componentValue.isDouble())
+                    setGeometryValue(node, component, componentValue.toDouble());
+            }
+            graph.nodes.push_back(std::move(node));
+            parentIds.push_back(toId(object.value(QLatin1String("group"))));
+        }
+        return QString{};
+    };
+    auto error = readNodes(groups, true);
+    if (error.isEmpty())
+        error = readNodes(nodes, false);
+    if (!error.isEmpty())
+        return error;
+    for (std::size_t n = 0; n < graph.nodes.size(); n++) {
+        if (parentIds[n].isEmpty())
+            continue;
+        const auto parent = ids.constFind(parentIds[n]);
+        if (parent == ids.cend() ||
+            !graph.nodes[*parent].isGroup)
+            return QStringLiteral("Node %1 references an unknown group: %2").arg(graph.nodes[n].id, parentIds[n]);
+        graph.nodes[n].parent = static_cast<std::int32_t>(*parent);
+    }
+
+    std::vector<PendingEdge> pendingEdges;
+    pendingEdges.reserve(static_cast<std::size_t>(edges.size()));
+    for (const auto& value : edges) {
+        if (!tick())
+            return QStringLiteral("Import cancelled.");
+        const auto object = value.toObject();
+        PendingEdge edge;
+        edge.src = toId(object.value(QLatin1String("source")));
+        edge.dst = toId(object.value(QLatin1String("target")));
+        edge.label = object.value(QLatin1String("label")).toString();
+        edge.weight = object.value(QLatin1String("weight")).toDouble(1.);
+        pendingEdges.push_back(std::move(edge));
+    }
+    return resolveEdges(pendingEdges, ids, graph);
+}
+//-----------------------------------------------------------------------------
+
+bool    ImportedGraph::completeGeometry(const QSizeF& nodeSize)
+{
+    static constexpr qreal padding = 20.;
+    static constexpr qreal header = 30.;       // Group label
+    static constexpr qreal spacing = 30.;
+    const auto count = nodes.size();
+
+    // 1. Compute nodes depth in group hierarchy (and detect circuits), collect containers content
+    std::vector<std::size_t> depths(count, 0);
+    std::vector<std::vector<std::uint32_t>> children(count + 1);     // Indexed by parent + 1
+    for (std::size_t n = 0; n < count; n++) {
+        for (auto p = nodes[n].parent; p >= 0; p = nodes[static_cast<std::size_t>(p)].parent)
+            if (++depths[n] > count)
+                return false;
+        children[static_cast<std::size_t>(nodes[n].parent + 1)].push_back(static_cast<std::uint32_t>(n));
+        if (!nodes[n].isGroup &&
+            !nodes[n].hasSize)
+            nodes[n].geometry.setSize(nodeSize);
+    }
+    std::vector<std::int32_t> containers;
+    for (std::size_t n = 0; n < count; n++)
+        if (nodes[n].isGroup)
+            containers.push_back(static_cast<std::int32_t>(n));
+    std::stable_sort(containers.begin(), containers.end(), [&depths](std::int32_t a, std::int32_t b) {
+        return depths[static_cast<std::size_t>(a)] > depths[static_cast<std::size_t>(b)];
+    });
+    containers.push_back(-1);   // Top level graph is processed last
+
+    // 2. Deepest containers first: lay out unpositioned content on a grid, then compute container geometry.
+    // Content of a group without position (and without positioned content) is laid out in group local
+    // coordinates, it is translated once group has been laid out in its own container.
+    std::vector<bool> relative(count, false);
+    const std::function<void(std::size_t, QPointF)> translate = [&](std::size_t n, QPointF delta) {
+        for (const auto child : children[n + 1]) {
+            nodes[child].geometry.translate(delta);
+            translate(child, delta);
+        }
+    };
+    for (const auto c : containers) {
+        const auto& content = children[static_cast<std::size_t>(c + 1)];
+        QRectF positionedRect;
+        std::vector<std::uint32_t> unpositioned;
+        QSizeF cell;
+        for (const auto n : content) {
+            if (nodes[n].hasPosition)
+                positionedRect |= nodes[n].geometry;
+            else {
+                unpositioned.push_back(n);
+                cell = cell.expandedTo(nodes[n].geometry.size());
+            }
+        }
+        auto* container = c >= 0 ? &nodes[static_cast<std::size_t>(c)] : nullptr;
+        QPointF origin{0., 0.};
+        if (container != nullptr && container->hasPosition)
+            origin = container->geometry.topLeft() + QPointF{padding, header};
+        else if (!positionedRect.isNull())
+            origin = QPointF{positionedRect.left(), positionedRect.bottom() + spacing};
+        else if (container != nullptr)
+            origin = QPointF{padding, header};
+        const auto columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(unpositioned.size()))));
+        for (std::size_t u = 0; u < unpositioned.size(); u++) {
+            auto& node = nodes[unpositioned[u]];
+            const QPointF position{origin.x() + (u % columns) * (cell.width() + spacing),
+                                   origin.y() + (u / columns) * (cell.height() + spacing)};
+            const auto delta = position - node.geometry.topLeft();
+            node.geometry.moveTopLeft(position);
+            node.hasPosition = true;
+            if (relative[unpositioned[u]]) {
+                relative[unpositioned[u]] = false;
+                translate(unpositioned[u], delta);
+            }
+        }
+        if (container == nullptr)
+            continue;
+        QRectF contentRect;
+        for (const auto n : content)
+            contentRect |= nodes[n].geometry;
+        if (!container->hasPosition) {
+            if (!positionedRect.isNull()) {
+                container->geometry.moveTopLeft(contentRect.topLeft() - QPointF{padding, header});
+                container->hasPosition = true;
+            } else {
+                container->geometry.moveTopLeft(QPointF{0., 0.});
+                relative[static_cast<std::size_t>(c)] = true;
+            }
+        }
+        if (!container->hasSize) {
+            if (contentRect.isNull())
+                container->geometry.setSize(nodeSize * 2.);
+            else
+                container->geometry.setBottomRight(contentRect.bottomRight() + QPointF{padding, padding});
+            container->hasSize = true;
+        }
+    }
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+/* GraphImporter Object Management *///---------------------------------------
+//! Shared between an importer and its parsing jobs, parsing results are only posted while importer is alive.
+struct GraphImporter::Guard {
+    std::mutex              mutex;
+    qan::GraphImporter*     importer = nullptr;
+};
+
+//! Import job, \c graph and \c error are written by worker thread and read from GUI thread once parsed() is called.
+struct GraphImporter::Job {
+    QString                 fileName;
+    std::atomic<bool>       cancel{false};
+    qan::ImportedGraph      graph;
+    QString                 error;
+};
+
+namespace { // ::qan::anonymous
+
+class ParseRunnable : public QRunnable
+{
+public:
+    ParseRunnable(std::shared_ptr<qan::GraphImporter::Guard> guard,
+                  std::shared_ptr<qan::GraphImporter::Job> job) :
+        QRunnable{}, _guard{std::move(guard)}, _job{std::move(job)} { setAutoDelete(true); }
+
+    virtual void run() override {
+        _job->error = parse();
+        post([job = _job](qan::GraphImporter* importer) { importer->parsed(job); });
+    }
+
+private:
+    QString parse() {
+        QFile file{_job->fileName};
+        if (!file.open(QIODevice::ReadOnly))
+            return QStringLiteral("Can't open ") + _job->fileName + QStringLiteral(": ") + file.errorString();
+        const auto suffix = QFileInfo{_job->fileName}.suffix().toLower();
+        bool json = suffix == QLatin1String("json");
+        if (suffix != QLatin1String("json") &&
+            suffix != QLatin1String("graphml") &&
+            suffix != QLatin1String("xml")) {       // Detect format from first non space character
+            char c = 0;
+            while (file.peek(&c, 1) == 1 && QChar::isSpace(c))
+                file.read(&c, 1);
+            json = c == '{';
+        }
+        qreal lastProgress = 0.;
+        const auto progress = [this, &lastProgress](qreal value) {
+            if (value - lastProgress < 0.01)    // Limit posted events
+                return;
+            lastProgress = value;
+            post([job = _job, value](qan::GraphImporter* importer) { importer->parseProgress(job, value); });
+        };
+        auto error = json ? qan::ImportedGraph::parseJson(file, _job->graph, &_job->cancel, progress) :
+                            qan::ImportedGraph::parseGraphML(file, _job->graph, &_job->cancel, progress);
+        if (error.isEmpty() &&
+            !_job->graph.completeGeometry())
+            error = QStringLiteral("Group hierarchy contains a circuit.");
+        return error;
+    }
+
+    template <class F>
+    void    post(F&& f) {
+        std::lock_guard<std::mutex> lock{_guard->mutex};
+        if (_guard->importer == nullptr)
+            return;
+        const auto importer = _guard->importer;
+        QMetaObject::invokeMethod(importer, [importer, f]() { f(importer); }, Qt::QueuedConnection);
+    }
+
+    std::shared_ptr<qan::GraphImporter::Guard>  _guard;
+    std::shared_ptr<qan::GraphImporter::Job>    _job;
+};
+
+} // ::qan::anonymous
+
+GraphImporter::GraphImporter(QObject* parent) :
+    QObject{parent},
+    _guard{std::make_shared<Guard>()}
+{
+    _guard->importer = this;
+    _chunkTimer.setSingleShot(true);
+    _chunkTimer.setInterval(0);
+    connect(&_chunkTimer, &QTimer::timeout, this, &GraphImporter::attachChunk);
+}
+
+GraphImporter::~GraphImporter()
+{
+    if (_job)
+        _job->cancel = true;
+    std::lock_guard<std::mutex> lock{_guard->mutex};
+    _guard->importer = nullptr;     // Running job result is dropped
+}
+
+void    GraphImporter::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (isRunning()) {
+        qWarning() << "qan::GraphImporter::setGraph(): Error: graph can't be changed while an import is running.";
+        return;
+    }
+    _graph = graph;
+    emit graphChanged();
+}
+
+void    GraphImporter::setChunkDuration(int chunkDuration) noexcept
+{
+    chunkDuration = qMax(1, chunkDuration);
+    if (chunkDuration != _chunkDuration) {
+        _chunkDuration = chunkDuration;
+        emit chunkDurationChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Import Management *///------------------------------------------------------
+bool    GraphImporter::load(const QUrl& url)
+{
+    if (isRunning() ||
+        !_graph)
+        return false;
+    QString fileName;
+    if (url.isLocalFile())
+        fileName = url.toLocalFile();
+    else if (url.scheme() == QLatin1String("qrc"))
+        fileName = QStringLiteral(":") + url.path();
+    else
+        fileName = url.toString();      // Plain file path
+    _job = std::make_shared<Job>();
+    _job->fileName = fileName;
+    _error.clear();
+    setProgress(0.);
+    setPhase(Phase::Parsing);
+    QThreadPool::globalInstance()->start(new ParseRunnable{_guard, _job});
+    return true;
+}
+
+void    GraphImporter::cancel()
+{
+    if (!isRunning())
+        return;
+    finish(QStringLiteral("Import cancelled."));
+}
+
+void    GraphImporter::parseProgress(const std::shared_ptr<Job>& job, qreal progress) noexcept
+{
+    if (job == _job &&
+        _phase == Phase::Parsing)
+        setProgress(progress * 0.5);
+}
+
+void    GraphImporter::parsed(const std::shared_ptr<Job>& job) noexcept
+{
+    if (job != _job ||              // Cancelled (or stale) job
+        _phase != Phase::Parsing)
+        return;
+    if (!_job->error.isEmpty())
+        finish(_job->error);
+    else if (!_graph)
+        finish(QStringLiteral("Graph has been destroyed."));
+    else
+        insert();
+}
+
+void    GraphImporter::setPhase(Phase phase) noexcept
+{
+    if (phase != _phase) {
+        _phase = phase;
+        emit phaseChanged();
+    }
+}
+
+void    GraphImporter::setProgress(qreal progress) noexcept
+{
+    if (!qFuzzyCompare(1. + progress, 1. + _progress)) {
+        _progress = progress;
+        emit progressChanged();
+    }
+}
+
+void    GraphImporter::insert() noexcept
+{
+    QAN_TRACE_SCOPE("GraphImporter::insert");
+    setPhase(Phase::Inserting);
+    const auto& imported = _job->graph;
+    const auto count = imported.nodes.size();
+
+    // Groups are inserted first (host groups before their content), in attachment order
+    std::vector<std::size_t> depths(count, 0);
+    std::vector<std::size_t> order;
+    order.reserve(count);
+    for (std::size_t n = 0; n < count; n++) {
+        for (auto p = imported.nodes[n].parent; p >= 0; p = imported.nodes[static_cast<std::size_t>(p)].parent)
+            ++depths[n];        // Note: group hierarchy has no circuit, see ImportedGraph::completeGeometry()
+        if (imported.nodes[n].isGroup)
+            order.push_back(n);
+    }
+    std::stable_sort(order.begin(), order.end(), [&depths](std::size_t a, std::size_t b) { return depths[a] < depths[b]; });
+    for (std::size_t n = 0; n < count; n++)
+        if (!imported.nodes[n].isGroup)
+            order.push_back(n);
+
+    _headless = _graph->getHeadless();
+    _graph->setHeadless(true);
+    _graph->beginUpdate();
+    std::vector<qan::Node*> nodes(count, nullptr);      // Indexed by imported node index
+    std::unordered_map<qan::Group*, std::vector<qan::Node*>> groupsContent;
+    _nodes.clear();
+    _nodes.reserve(count);
+    for (const auto n : order) {
+        const auto& importedNode = imported.nodes[n];
+        qan::Node* node = importedNode.isGroup ? _graph->insertGroup() : _graph->insertNode();
+        if (node == nullptr)
+            continue;
+        node->setGeometry(importedNode.geometry);
+        if (!importedNode.label.isEmpty())
+            node->setLabel(importedNode.label);
+        nodes[n] = node;
+        _nodes.emplace_back(node);
+        if (importedNode.parent >= 0) {
+            const auto group = qobject_cast<qan::Group*>(nodes[static_cast<std::size_t>(importedNode.parent)]);
+            if (importedNode.isGroup)
+                _graph->groupNode(group, node);
+            else
+                groupsContent[group].push_back(node);
+        }
+    }
+    for (const auto& groupContent : groupsContent)
+        _graph->groupNodes(groupContent.first, groupContent.second);
+    _edges.clear();
+    _edges.reserve(imported.edges.size());
+    for (const auto& importedEdge : imported.edges) {
+        const auto edge = _graph->insertEdge(nodes[importedEdge.src], nodes[importedEdge.dst]);
+        if (edge == nullptr)
+            continue;
+        if (!importedEdge.label.isEmpty())
+            edge->setLabel(importedEdge.label);
+        if (!qFuzzyCompare(importedEdge.weight, 1.))
+            edge->setWeight(importedEdge.weight);
+        _edges.emplace_back(edge);
+    }
+    _graph->endUpdate();
+    _job.reset();           // Release imported topology
+
+    setProgress(0.6);
+    setPhase(Phase::Attaching);
+    _attachCursor = 0;
+    _chunkTimer.start();
+}
+
+void    GraphImporter::attachChunk() noexcept
+{
+    if (!_graph) {
+        finish(QStringLiteral("Graph has been destroyed."));
+        return;
+    }
+    QAN_TRACE_SCOPE("GraphImporter::attachChunk");
+    QElapsedTimer timer;
+    timer.start();
+    const auto total = _nodes.size() + _edges.size();
+    _graph->beginUpdate();      // Defer edges geometry update to the end of chunk
+    while (_attachCursor < total &&
+           timer.elapsed() < _chunkDuration) {
+        if (_attachCursor < _nodes.size()) {
+            const auto node = _nodes[_attachCursor];
+            if (node)
+                _graph->attachNodeItem(*node);
+        } else {
+            const auto edge = _edges[_attachCursor - _nodes.size()];
+            if (edge)
+                _graph->attachEdgeItem(*edge);
+        }
+        ++_attachCursor;
+    }
+    _graph->endUpdate();
+    setProgress(0.6 + 0.4 * static_cast<qreal>(_attachCursor) / qMax<std::size_t>(1, total));
+    if (_attachCursor < total)
+        _chunkTimer.start();    // Let the event loop render a frame before next chunk
+    else
+        finish(QString{});
+}
+
+void    GraphImporter::finish(const QString& error) noexcept
+{
+    _chunkTimer.stop();
+    if (_job) {
+        _job->cancel = true;    // Parsing result will be ignored in parsed()
+        _job.reset();
+    }
+    if (_graph &&
+        (_phase == Phase::Inserting || _phase == Phase::Attaching)) {
+        if (!error.isEmpty()) {     // Remove imported primitives, content before groups, nested groups first
+            _graph->beginUpdate();
+            for (auto n = _nodes.rbegin(); n != _nodes.rend(); ++n) {
+                if (!*n)
+                    continue;
+                const auto group = qobject_cast<qan::Group*>(n->data());
+                if (group != nullptr)
+                    _graph->removeGroup(group);
+                else
+                    _graph->removeNode(n->data());
+            }
+            _graph->endUpdate();
+        }
+        _graph->setHeadless(_headless);
+    }
+    _nodes.clear();
+    _edges.clear();
+    _error = error;
+    if (error.isEmpty())
+        setProgress(1.);
+    setPhase(Phase::Idle);
+    emit finished(error.isEmpty());
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
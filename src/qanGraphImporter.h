@@ -0,0 +1,243 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphImporter.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QRectF>
+#include <QSizeF>
+#include <QIODevice>
+#include <QString>
+#include <QTimer>
+#include <QUrl>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Thread independent topology parsed by qan::GraphImporter (nodes, groups and edges indexed from 0).
+ *
+ * Groups are stored in \c nodes with \c isGroup set, a node (or group) \c parent is the index of its
+ * group in \c nodes (or -1 for a top level node). Geometries are expressed in graph coordinates.
+ */
+struct ImportedGraph
+{
+    struct Node {
+        QString         id;
+        QString         label;
+        QRectF          geometry;
+        bool            hasPosition = false;
+        bool            hasSize = false;
+        bool            isGroup = false;
+        std::int32_t    parent = -1;
+    };
+    struct Edge {
+        std::uint32_t   src = 0;
+        std::uint32_t   dst = 0;
+        QString         label;
+        qreal           weight = 1.;
+    };
+    std::vector<Node>   nodes;
+    std::vector<Edge>   edges;
+
+    /*! \brief Parse GraphML \c device content (streamed with QXmlStreamReader).
+     *
+     * Supported content: \c node, \c edge and nested \c graph elements (a node with a nested graph is imported
+     * as a group), \c data elements with \c label, \c x, \c y, \c width, \c height and \c weight key names, and
+     * yEd \c Geometry and \c NodeLabel / \c EdgeLabel elements.
+     * \return an empty string on success, an error description otherwise.
+     */
+    static QString  parseGraphML(QIODevice& device, ImportedGraph& graph, const std::atomic<bool>* cancel = nullptr,
+                                 const std::function<void(qreal)>& progress = nullptr);
+
+    /*! \brief Parse JSON \c device content.
+     *
+     * \code
+     * { "groups": [ { "id": "g1", "label": "Group", "x": 0, "y": 0, "width": 400, "height": 300, "group": "g0" } ],
+     *   "nodes":  [ { "id": "n1", "label": "Node", "x": 10, "y": 40, "width": 100, "height": 45, "group": "g1" } ],
+     *   "edges":  [ { "source": "n1", "target": "n2", "label": "", "weight": 1.0 } ] }
+     * \endcode
+     * Only \c id, \c source and \c target are mandatory, ids could be strings or numbers.
+     * \return an empty string on success, an error description otherwise.
+     */
+    static QString  parseJson(QIODevice& device, ImportedGraph& graph, const std::atomic<bool>* cancel = nullptr,
+                              const std::function<void(qreal)>& progress = nullptr);
+
+    /*! \brief Position nodes without a position on a grid below positionned nodes, and compute geometry of groups without size.
+     *
+     * \return false if group hierarchy contains a circuit.
+     */
+    bool            completeGeometry(const QSizeF& nodeSize = QSizeF{100., 45.});
+};
+
+/*! \brief Import large GraphML or JSON files in a qan::Graph without blocking the GUI thread.
+ *
+ * Import is done in three steps:
+ * \li File is parsed on a worker thread (global QThreadPool) into a qan::ImportedGraph topology.
+ * \li Nodes, groups and edges are inserted in one batch (see qan::Graph::beginUpdate()) while graph is headless.
+ * \li Visual items are attached in time sliced chunks of \c chunkDuration ms (see qan::Graph::attachNodeItem()).
+ *
+ * \code
+ * Qan.GraphImporter {
+ *   id: importer
+ *   graph: graphView.graph
+ *   onFinished: if (!success) console.error(error)
+ * }
+ * ProgressBar { value: importer.progress; visible: importer.running }
+ * Button { text: "Cancel"; onClicked: importer.cancel() }
+ * // ...
+ * importer.load("file:///path/to/graph.graphml")
+ * \endcode
+ *
+ * \note File format is detected from file extension (\c .graphml, \c .xml or \c .json), or from file content.
+ * \note Cancelling an import while items are being attached remove the already imported primitives.
+ * \nosubgrouping
+ */
+class GraphImporter : public QObject
+{
+    Q_OBJECT
+    /*! \name GraphImporter Object Management *///-----------------------------
+    //@{
+public:
+    explicit GraphImporter(QObject* parent = nullptr);
+    virtual ~GraphImporter() override;
+    GraphImporter(const GraphImporter&) = delete;
+    GraphImporter& operator=(const GraphImporter&) = delete;
+
+public:
+    //! Target graph (could not be changed while an import is running).
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*      getGraph() const noexcept { return _graph.data(); }
+    void                    setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                    graphChanged();
+
+public:
+    //! Maximum duration in ms of an item attachment chunk (default to 8ms, minimum 1ms).
+    Q_PROPERTY(int chunkDuration READ getChunkDuration WRITE setChunkDuration NOTIFY chunkDurationChanged FINAL)
+    inline int              getChunkDuration() const noexcept { return _chunkDuration; }
+    void                    setChunkDuration(int chunkDuration) noexcept;
+private:
+    int                     _chunkDuration = 8;
+signals:
+    void                    chunkDurationChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Import Management *///-------------------------------------------
+    //@{
+public:
+    enum class Phase {
+        Idle        = 0,
+        Parsing     = 1,
+        Inserting   = 2,
+        Attaching   = 3
+    };
+    Q_ENUM(Phase)
+
+    /*! \brief Start importing \c url (a local file or a Qt resource) in \c graph.
+     *
+     * \return false if an import is already running or if \c graph is not set, finished() is emitted otherwise.
+     */
+    Q_INVOKABLE bool        load(const QUrl& url);
+    //! Cancel running import, finished() is emitted with \c success set to false.
+    Q_INVOKABLE void        cancel();
+
+    //! True while an import is running.
+    Q_PROPERTY(bool running READ isRunning NOTIFY phaseChanged FINAL)
+    inline bool             isRunning() const noexcept { return _phase != Phase::Idle; }
+    //! Actual import step.
+    Q_PROPERTY(Phase phase READ getPhase NOTIFY phaseChanged FINAL)
+    inline Phase            getPhase() const noexcept { return _phase; }
+    //! Overall import progress from 0.0 to 1.0 (parsing up to 0.5, insertion up to 0.6, attachment up to 1.0).
+    Q_PROPERTY(qreal progress READ getProgress NOTIFY progressChanged FINAL)
+    inline qreal            getProgress() const noexcept { return _progress; }
+    //! Description of the last import error (empty if last import succeed).
+    Q_PROPERTY(QString error READ getError NOTIFY finished FINAL)
+    inline QString          getError() const noexcept { return _error; }
+
+signals:
+    void                    phaseChanged();
+    void                    progressChanged();
+    //! Emitted when an import ends, \c success is false on error or cancellation (see \c error).
+    void                    finished(bool success);
+
+public:
+    struct Guard;
+    struct Job;
+    //! Worker thread parsing ended (called from GUI thread).
+    void                    parsed(const std::shared_ptr<Job>& job) noexcept;
+    //! Parsing progress (called from GUI thread).
+    void                    parseProgress(const std::shared_ptr<Job>& job, qreal progress) noexcept;
+
+private:
+    void                    setPhase(Phase phase) noexcept;
+    void                    setProgress(qreal progress) noexcept;
+    //! Insert parsed topology in graph (in one batch).
+    void                    insert() noexcept;
+    //! Attach items of inserted primitives until chunkDuration is elapsed.
+    void                    attachChunk() noexcept;
+    //! End import, remove inserted primitives on error.
+    void                    finish(const QString& error) noexcept;
+
+    std::shared_ptr<Guard>  _guard;
+    std::shared_ptr<Job>    _job;
+    Phase                   _phase = Phase::Idle;
+    qreal                   _progress = 0.;
+    QString                 _error;
+    bool                    _headless = false;       // Graph headless state before import
+    QTimer                  _chunkTimer;
+    std::size_t             _attachCursor = 0;
+    std::vector<QPointer<qan::Node>>    _nodes;     // Index by ImportedGraph node index
+    std::vector<QPointer<qan::Edge>>    _edges;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::GraphImporter)
@@ -0,0 +1,263 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphUpdateQueue.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Qt headers
+#include <QTimer>
+
+// QuickQanava headers
+#include "./qanGraphUpdateQueue.h"
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+/* GraphUpdateQueue Object Management *///-------------------------------------
+GraphUpdateQueue::GraphUpdateQueue(QObject* parent) :
+    QObject{parent}
+{ /* Nil */ }
+
+void    GraphUpdateQueue::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _pendingNodes.clear();
+        _pendingEdges.clear();
+        _pendingNodesIndex.clear();
+        _pendingEdgesIndex.clear();
+        _enqueued = 0;
+    }
+    _graph = graph;
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Mutations Management *///---------------------------------------------------
+auto    GraphUpdateQueue::pending(std::vector<Pending>& pendings, QHash<QString, std::size_t>& index, const QString& id) -> Pending&
+{
+    ++_enqueued;
+    scheduleFlush();
+    const auto p = index.constFind(id);
+    if (p != index.cend())
+        return pendings[*p];
+    index.insert(id, pendings.size());
+    pendings.emplace_back();
+    pendings.back().id = id;
+    return pendings.back();
+}
+
+void    GraphUpdateQueue::addNode(const QString& id, const QString& label)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingNodes, _pendingNodesIndex, id);
+    if (p.existence == Pending::Existence::Unchanged)
+        p.existence = Pending::Existence::Add;
+    else if (p.existence == Pending::Existence::Remove)
+        p.existence = Pending::Existence::Recreate;
+    if (!label.isEmpty()) {
+        p.hasLabel = true;
+        p.label = label;
+    }
+}
+
+void    GraphUpdateQueue::removeNode(const QString& id)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingNodes, _pendingNodesIndex, id);
+    p = Pending{};
+    p.id = id;
+    p.existence = Pending::Existence::Remove;
+}
+
+void    GraphUpdateQueue::addEdge(const QString& id, const QString& srcId, const QString& dstId, const QString& label)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingEdges, _pendingEdgesIndex, id);
+    if (p.existence == Pending::Existence::Unchanged)
+        p.existence = Pending::Existence::Add;
+    else if (p.existence == Pending::Existence::Remove)
+        p.existence = Pending::Existence::Recreate;
+    p.srcId = srcId;
+    p.dstId = dstId;
+    if (!label.isEmpty()) {
+        p.hasLabel = true;
+        p.label = label;
+    }
+}
+
+void    GraphUpdateQueue::removeEdge(const QString& id)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingEdges, _pendingEdgesIndex, id);
+    p = Pending{};
+    p.id = id;
+    p.existence = Pending::Existence::Remove;
+}
+
+void    GraphUpdateQueue::setLabel(const QString& id, const QString& label)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingNodes, _pendingNodesIndex, id);
+    p.hasLabel = true;
+    p.label = label;
+}
+
+void    GraphUpdateQueue::setStyle(const QString& id, qan::Style* style)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingNodes, _pendingNodesIndex, id);
+    p.hasStyle = true;
+    p.style = style;
+}
+
+void    GraphUpdateQueue::setPosition(const QString& id, QPointF position)
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& p = pending(_pendingNodes, _pendingNodesIndex, id);
+    p.hasPosition = true;
+    p.position = position;
+}
+
+int     GraphUpdateQueue::getPendingCount() const noexcept
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    return static_cast<int>(_pendingNodes.size() + _pendingEdges.size());
+}
+
+void    GraphUpdateQueue::scheduleFlush()
+{
+    if (_flushScheduled)
+        return;
+    _flushScheduled = true;
+    QMetaObject::invokeMethod(this, [this]() { requestFrame(); }, Qt::QueuedConnection);
+}
+
+void    GraphUpdateQueue::requestFrame() noexcept
+{
+    const auto graphWindow = _graph ? _graph->window() : nullptr;
+    if (graphWindow != nullptr) {
+        if (graphWindow != _window) {
+            if (_window)
+                disconnect(_window, &QQuickWindow::afterAnimating, this, &GraphUpdateQueue::frameFlush);
+            _window = graphWindow;
+            connect(graphWindow, &QQuickWindow::afterAnimating, this, &GraphUpdateQueue::frameFlush);
+        }
+        graphWindow->update();      // Ensure a frame is scheduled
+    } else
+        QTimer::singleShot(0, this, &GraphUpdateQueue::flush);
+}
+
+void    GraphUpdateQueue::frameFlush() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_flushScheduled)
+            return;
+    }
+    flush();
+}
+
+void    GraphUpdateQueue::flush() noexcept
+{
+    std::vector<Pending> pendingNodes;
+    std::vector<Pending> pendingEdges;
+    int enqueued = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _flushScheduled = false;
+        std::swap(pendingNodes, _pendingNodes);
+        std::swap(pendingEdges, _pendingEdges);
+        _pendingNodesIndex.clear();
+        _pendingEdgesIndex.clear();
+        std::swap(enqueued, _enqueued);
+    }
+    if (!_graph ||
+        (pendingNodes.empty() && pendingEdges.empty()))
+        return;
+    QAN_TRACE_SCOPE("GraphUpdateQueue::flush");
+    using Existence = Pending::Existence;
+    const auto isRemoved = [](const Pending& p) {
+        return p.existence == Existence::Remove || p.existence == Existence::Recreate;
+    };
+    const auto isAdded = [](const Pending& p) {
+        return p.existence == Existence::Add || p.existence == Existence::Recreate;
+    };
+    _graph->beginUpdate();
+    // 1. Remove edges, then nodes (and their adjacent edges)
+    for (const auto& p : pendingEdges)
+        if (isRemoved(p))
+            _graph->removeEdge(_graph->edgeById(p.id));
+    for (const auto& p : pendingNodes)
+        if (isRemoved(p))
+            _graph->removeNode(_graph->nodeById(p.id));
+    // 2. Insert nodes, then edges between existing nodes
+    for (const auto& p : pendingNodes)
+        if (isAdded(p) &&
+            _graph->nodeById(p.id) == nullptr)
+            _graph->insertNode(p.id);
+    for (const auto& p : pendingEdges) {
+        if (!isAdded(p))
+            continue;
+        auto edge = _graph->edgeById(p.id);
+        if (edge == nullptr) {
+            const auto src = _graph->nodeById(p.srcId);
+            const auto dst = _graph->nodeById(p.dstId);
+            if (src != nullptr && dst != nullptr)
+                edge = _graph->insertEdge(p.id, src, dst);
+        }
+        if (edge != nullptr && p.hasLabel)
+            edge->setLabel(p.label);
+    }
+    // 3. Update nodes (or edges) properties
+    for (const auto& p : pendingNodes) {
+        if (const auto node = _graph->nodeById(p.id)) {
+            if (p.hasLabel)
+                node->setLabel(p.label);
+            if (p.hasStyle)
+                _graph->setNodeStyle(*node, qobject_cast<qan::NodeStyle*>(p.style.data()));
+            if (p.hasPosition)
+                node->setGeometry(QRectF{p.position, node->getGeometry().size()});
+        } else if (const auto edge = _graph->edgeById(p.id)) {
+            if (p.hasLabel)
+                edge->setLabel(p.label);
+            if (p.hasStyle)
+                _graph->setEdgeStyle(*edge, qobject_cast<qan::EdgeStyle*>(p.style.data()));
+        }
+    }
+    _graph->endUpdate();
+    emit applied(enqueued, static_cast<int>(pendingNodes.size() + pendingEdges.size()));
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
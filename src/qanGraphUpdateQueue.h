@@ -0,0 +1,167 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGraphUpdateQueue.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <mutex>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QPointF>
+#include <QString>
+#include <QHash>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Thread safe queue of graph mutations, addressed by external ids and applied once per frame.
+ *
+ * Mutations could be enqueued from any thread at a high rate, they are coalesced and applied to \c graph
+ * from its thread in a single qan::Graph::beginUpdate() / qan::Graph::endUpdate() scope before next frame
+ * (or on next event loop iteration when graph is not displayed in a window):
+ * \li Multiple property updates of a primitive keep only the last value.
+ * \li A primitive added and removed before a flush is never created.
+ * \li A primitive removed and added again before a flush is created again (its adjacent edges are removed).
+ *
+ * \code
+ * // Worker thread
+ * queue->addNode(QStringLiteral("svc-a"), QStringLiteral("Service A"));
+ * queue->addNode(QStringLiteral("svc-b"), QStringLiteral("Service B"));
+ * queue->addEdge(QStringLiteral("a-b"), QStringLiteral("svc-a"), QStringLiteral("svc-b"));
+ * queue->setPosition(QStringLiteral("svc-b"), QPointF{200., 0.});
+ * \endcode
+ *
+ * Primitives are addressed with graph external id index (see qan::Graph::nodeById()), node and edge ids are
+ * independent namespaces: setLabel() and setStyle() apply to the node with \c id, or to the edge with \c id when
+ * there is no such node.
+ * \nosubgrouping
+ */
+class GraphUpdateQueue : public QObject
+{
+    Q_OBJECT
+    /*! \name GraphUpdateQueue Object Management *///--------------------------
+    //@{
+public:
+    explicit GraphUpdateQueue(QObject* parent = nullptr);
+    virtual ~GraphUpdateQueue() override = default;
+    GraphUpdateQueue(const GraphUpdateQueue&) = delete;
+    GraphUpdateQueue& operator=(const GraphUpdateQueue&) = delete;
+
+public:
+    //! Updated graph, changing graph clear pending mutations.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*      getGraph() const noexcept { return _graph.data(); }
+    void                    setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                    graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Mutations Management *///----------------------------------------
+    //@{
+public:
+    //! Add a node with external \c id (existing node with \c id is kept, and its \c label updated).
+    Q_INVOKABLE void        addNode(const QString& id, const QString& label = QString{});
+    //! Remove node with external \c id and its adjacent edges.
+    Q_INVOKABLE void        removeNode(const QString& id);
+    //! Add an edge with external \c id from node \c srcId to node \c dstId (ignored if a node is missing once mutations are applied).
+    Q_INVOKABLE void        addEdge(const QString& id, const QString& srcId, const QString& dstId, const QString& label = QString{});
+    //! Remove edge with external \c id.
+    Q_INVOKABLE void        removeEdge(const QString& id);
+    //! Set label of node (or edge) with external \c id.
+    Q_INVOKABLE void        setLabel(const QString& id, const QString& label);
+    //! Set style of node (or edge) with external \c id (\c style must be a qan::NodeStyle for a node and a qan::EdgeStyle for an edge).
+    Q_INVOKABLE void        setStyle(const QString& id, qan::Style* style);
+    //! Set position (in graph coordinates) of node with external \c id.
+    Q_INVOKABLE void        setPosition(const QString& id, QPointF position);
+
+    //! Apply pending mutations immediately (must be called from graph thread).
+    Q_INVOKABLE void        flush() noexcept;
+
+    //! Number of primitives with pending mutations (after coalescing).
+    Q_PROPERTY(int pendingCount READ getPendingCount NOTIFY applied FINAL)
+    int                     getPendingCount() const noexcept;
+
+signals:
+    //! Emitted after pending mutations have been applied, \c enqueued mutations have been coalesced in \c applied ones.
+    void                    applied(int enqueued, int applied);
+
+private:
+    //! Pending mutations of a primitive.
+    struct Pending {
+        enum class Existence { Unchanged, Add, Remove, Recreate };
+        QString             id;
+        Existence           existence = Existence::Unchanged;
+        QString             srcId, dstId;   // Edge only
+        bool                hasLabel = false;
+        QString             label;
+        QPointer<qan::Style> style;
+        bool                hasStyle = false;
+        bool                hasPosition = false;
+        QPointF             position;
+    };
+    //! Return pending mutations for \c id, \c mutex must be locked.
+    Pending&                pending(std::vector<Pending>& pendings, QHash<QString, std::size_t>& index, const QString& id);
+    //! Schedule a flush() before next frame (thread safe, \c mutex must be locked).
+    void                    scheduleFlush();
+    //! Schedule a flush() before next frame (called from graph thread).
+    void                    requestFrame() noexcept;
+    //! Called on graph window afterAnimating().
+    void                    frameFlush() noexcept;
+
+    mutable std::mutex              _mutex;
+    std::vector<Pending>            _pendingNodes;
+    std::vector<Pending>            _pendingEdges;
+    QHash<QString, std::size_t>     _pendingNodesIndex;
+    QHash<QString, std::size_t>     _pendingEdgesIndex;
+    int                             _enqueued = 0;
+    bool                            _flushScheduled = false;
+
+    QPointer<QQuickWindow>          _window;       // Only accessed from graph thread
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::GraphUpdateQueue)
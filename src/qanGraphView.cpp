@@ -39,6 +39,7 @@
 #include "./qanNavigable.h"
 #include "./qanGraphView.h"
 #include "./qanGraph.h"
+#include "./qanEdgeItem.h"
 
 namespace qan { // ::qan
 
@@ -48,6 +49,16 @@ GraphView::GraphView(QQuickItem* parent) :
 {
     setAntialiasing(true);
     setSmooth(true);
+    connect(this, &qan::Navigable::interactionCacheActiveChanged,   // Update viewport deferred during interaction
+            this, [this]() { if (!getInteractionCacheActive()) updateGraphViewport(); });
+    connect(this, &qan::Navigable::zoomChanged,     // Graph node items level of detail follow view zoom
+            this, [this]() { if (_graph && !_mirror) _graph->setLodZoom(getZoom()); });
+}
+
+GraphView::~GraphView()
+{
+    if (_graph && _mirror)
+        _graph->removeViewViewport(this);
 }
 
 void    GraphView::setGraph(qan::Graph* graph)
@@ -57,9 +68,28 @@ void    GraphView::setGraph(qan::Graph* graph)
         return;
     }
     if (graph != _graph) {
-        if (_graph != nullptr)
+        if (_graph != nullptr) {
             disconnect(_graph, 0, this, 0);
+            if (_mirror)
+                _graph->removeViewViewport(this);
+        }
         _graph = graph;
+        // Note: a graph already shown in another view keep its container item, this view is a mirror
+        const auto graphContainer = _graph->getContainerItem();
+        const bool mirror = graphContainer != nullptr &&
+                            graphContainer != getContainerItem();
+        if (mirror != _mirror) {
+            _mirror = mirror;
+            emit mirrorChanged();
+        }
+        if (_mirror) {
+            connect(_graph, &qan::Graph::sceneBoundsChanged,
+                    this,   &qan::GraphView::contentRectModified);
+            contentRectModified();
+            updateGraphViewport();
+            emit graphChanged();
+            return;
+        }
         auto graphViewQmlContext = qmlContext(this);
         auto containerQmlContext = qmlContext(getContainerItem());
         QQmlEngine::setContextForObject(getContainerItem(), graphViewQmlContext);
@@ -93,28 +123,184 @@ void    GraphView::setGraph(qan::Graph* graph)
                 this,   &qan::GraphView::groupRightClicked);
         connect(_graph, &qan::Graph::groupDoubleClicked,
                 this,   &qan::GraphView::groupDoubleClicked);
+
+        connect(_graph, &qan::Graph::centralPickingChanged,
+                this,   &qan::GraphView::centralPickingChanged);
+        centralPickingChanged();
+
+        connect(_graph, &qan::Graph::updatingChanged,
+                this,   [this]() { setContainerResizeSuspended(_graph && _graph->isUpdating()); });
+
+        // Use graph incrementally maintained scene bounds as content rect instead of container childrenRect
+        disconnect(getContainerItem(), &QQuickItem::childrenRectChanged,
+                   this,               &qan::GraphView::contentRectModified);
+        connect(_graph, &qan::Graph::sceneBoundsChanged,
+                this,   &qan::GraphView::contentRectModified);
+        connect(_graph, &qan::Graph::sceneModified,
+                this,   &qan::GraphView::contentModified);
+        contentRectModified();
+        updateGraphViewport();
+        _graph->setLodZoom(getZoom());
         emit graphChanged();
     }
 }
 
+QRectF  GraphView::getContentRect() noexcept
+{
+    return _graph ? _graph->getSceneBounds() : qan::Navigable::getContentRect();
+}
+
+void    GraphView::centerOnNode(qan::Node* node)
+{
+    if (node == nullptr ||
+        getContainerItem() == nullptr)
+        return;
+    if (node->getItem() != nullptr)
+        centerOn(node->getItem());
+    else
+        centerOnPosition(node->getGeometry().center());
+}
+
 void    GraphView::navigableClicked(QPointF pos)
 {
-    Q_UNUSED(pos)
+    const auto edgeItem = pickEdgeItem(pos);    // Edge items do not receive press events with central picking
+    if (edgeItem != nullptr) {
+        edgeItem->pickedClick(Qt::LeftButton, edgeItem->mapFromItem(this, pos));
+        return;
+    }
     if (_graph)
         _graph->clearSelection();
 }
 
 void    GraphView::navigableRightClicked(QPointF pos)
 {
+    const auto edgeItem = pickEdgeItem(pos);
+    if (edgeItem != nullptr) {
+        edgeItem->pickedClick(Qt::RightButton, edgeItem->mapFromItem(this, pos));
+        return;
+    }
     emit    rightClicked(pos);
 }
 
+void    GraphView::navigableContainerItemModified()
+{
+    // Note: materializing virtualized items while content is rendered from interaction cache would
+    // invalidate the cache, viewport is updated when interaction ends
+    if (!getInteractionCacheActive())
+        updateGraphViewport();
+}
+
+void    GraphView::geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    qan::Navigable::geometryChanged(newGeometry, oldGeometry);
+    updateGraphViewport();
+}
+
+void    GraphView::updateGraphViewport()
+{
+    if (getContainerItem() == nullptr)
+        return;
+    const auto viewportRect = mapRectToItem(getContainerItem(), boundingRect());
+    if (viewportRect != _viewportRect) {
+        _viewportRect = viewportRect;
+        emit viewportRectChanged();
+    }
+    if (_graph) {
+        if (_mirror)
+            _graph->setViewViewportRect(this, _viewportRect);
+        else
+            _graph->setViewportRect(_viewportRect);
+    }
+}
+
 QString GraphView::urlToLocalFile(QUrl url) const noexcept
 {
     if (url.isLocalFile())
         return url.toLocalFile();
     return QString{};
 }
+
+void    GraphView::hoverMoveEvent(QHoverEvent* event)
+{
+    if (_graph &&
+        !_mirror &&
+        _graph->getCentralPicking() &&
+        getContainerItem() != nullptr)
+        _graph->setHoveredItem(_graph->pickItem(mapToItem(getContainerItem(), event->posF())));
+    qan::Navigable::hoverMoveEvent(event);
+}
+
+void    GraphView::hoverLeaveEvent(QHoverEvent* event)
+{
+    if (_graph)
+        _graph->setHoveredItem(nullptr);
+    qan::Navigable::hoverLeaveEvent(event);
+}
+
+void    GraphView::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    const auto edgeItem = pickEdgeItem(event->localPos());
+    if (edgeItem != nullptr &&
+        event->button() == Qt::LeftButton) {
+        edgeItem->pickedClick(Qt::LeftButton, edgeItem->mapFromItem(this, event->localPos()), true);
+        event->accept();
+        return;
+    }
+    qan::Navigable::mouseDoubleClickEvent(event);
+}
+
+void    GraphView::dragEnterEvent(QDragEnterEvent* event)
+{
+    // Accept edge style drags anywhere, drop position is checked in dragMoveEvent()
+    if (_graph &&
+        _graph->getCentralPicking() &&
+        qan::EdgeItem::getDraggedEdgeStyle(event) != nullptr) {
+        event->accept();
+        return;
+    }
+    qan::Navigable::dragEnterEvent(event);
+}
+
+void    GraphView::dragMoveEvent(QDragMoveEvent* event)
+{
+    const auto edgeItem = pickEdgeItem(event->posF());
+    if (edgeItem != nullptr &&
+        edgeItem->getAcceptDrops())
+        event->accept();
+    else
+        event->ignore();
+}
+
+void    GraphView::dropEvent(QDropEvent* event)
+{
+    const auto edgeItem = pickEdgeItem(event->posF());
+    const auto draggedEdgeStyle = qan::EdgeItem::getDraggedEdgeStyle(event);
+    if (edgeItem != nullptr &&
+        edgeItem->getAcceptDrops() &&
+        draggedEdgeStyle != nullptr) {
+        edgeItem->setStyle(draggedEdgeStyle);
+        event->accept();
+        return;
+    }
+    qan::Navigable::dropEvent(event);
+}
+
+void    GraphView::centralPickingChanged()
+{
+    const bool centralPicking = _graph && _graph->getCentralPicking();
+    setAcceptHoverEvents(centralPicking);
+    setFlag(QQuickItem::ItemAcceptsDrops, centralPicking);
+}
+
+qan::EdgeItem*  GraphView::pickEdgeItem(const QPointF& pos) noexcept
+{
+    if (!_graph ||
+        _mirror ||              // Mirror views are read-only
+        !_graph->getCentralPicking() ||
+        getContainerItem() == nullptr)
+        return nullptr;
+    return qobject_cast<qan::EdgeItem*>(_graph->pickItem(mapToItem(getContainerItem(), pos)));
+}
 //-----------------------------------------------------------------------------
 
 
@@ -127,42 +313,43 @@ void    GraphView::selectionRectActivated(const QRectF& rect)
     if (rect.isEmpty())
         return;
     // Algorithm:
-    // 1. Iterate over all already selected items, remove one that are no longer inside selection rect
-    //    (for example, if selection rect has grown down...)
-    // 2. Iterate over all graph items, select items inside selection rect.
+    // 1. Query graph spatial index for container childs intersecting selection rect, keep nodes inside rect.
+    // 2. Unselect items selected by this rubber band that are no longer inside rect (for example, if
+    //    selection rect has shrinked...), select items entering rect, delta is committed in two batches.
 
     // 1.
-    QSetIterator<QQuickItem*> selectedItem(_selectedItems);
-    while (selectedItem.hasNext()) {
-        const auto item = selectedItem.next();
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    QSet<QQuickItem*> insideItems;
+    std::vector<qan::Node*> selectedNodes;
+    const auto container = _graph->getContainerItem();
+    for (const auto item: _graph->graphChildrenIn(rect)) {
+        auto nodeItem = qobject_cast<qan::NodeItem*>(const_cast<QQuickItem*>(item));
         if (nodeItem != nullptr &&
-            nodeItem->getNode() != nullptr ) {
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (!rect.contains(itemBr)) {
-                _graph->setNodeSelected(*nodeItem->getNode(), false);
-                        _selectedItems.remove(item);
+            nodeItem->getNode() != nullptr) {
+            const auto itemBr = nodeItem->mapRectToItem(container, nodeItem->boundingRect());
+            if (rect.contains(itemBr)) {
+                insideItems.insert(nodeItem);
+                if (!_selectedItems.contains(nodeItem))
+                    selectedNodes.push_back(nodeItem->getNode());
             }
         }
     }
 
     // 2.
-    const auto items = _graph->getContainerItem()->childItems();
-    for (const auto item: items) {
+    std::vector<qan::Node*> unselectedNodes;
+    for (const auto item: qAsConst(_selectedItems)) {
         auto nodeItem = qobject_cast<qan::NodeItem*>(item);
         if (nodeItem != nullptr &&
-            nodeItem->getNode() != nullptr ) {
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (rect.contains(itemBr)) {
-                _graph->setNodeSelected(*nodeItem->getNode(), true);
-                // Note we assume that items are not deleted while the selection
-                // is in progress... (QPointer can't be trivially inserted in QSet)
-                _selectedItems.insert(nodeItem);
-            }
-        }
+            nodeItem->getNode() != nullptr &&
+            !insideItems.contains(item))
+            unselectedNodes.push_back(nodeItem->getNode());
     }
+    // Note we assume that items are not deleted while the selection
+    // is in progress... (QPointer can't be trivially inserted in QSet)
+    _selectedItems = insideItems;
+    if (!unselectedNodes.empty())
+        _graph->setNodesSelected(unselectedNodes, false);
+    if (!selectedNodes.empty())
+        _graph->setNodesSelected(selectedNodes, true);
 }
 
 void    GraphView::selectionRectEnd()
@@ -61,7 +61,7 @@ class GraphView : public qan::Navigable
 public:
     //! GraphView default constructor.
     explicit GraphView(QQuickItem* parent = nullptr);
-    virtual ~GraphView() override = default;
+    virtual ~GraphView() override;
     GraphView(const GraphView&) = delete;
 
 public:
@@ -74,14 +74,80 @@ private:
 signals:
     void                    graphChanged();
 
+public:
+    /*! \brief True when this view display a graph already shown in another view (read-only).
+     *
+     * Graph node and edge items are owned by the container of the first view the graph is set to. Other views
+     * showing the same graph are mirrors: they are zoomed and panned independently, do not instantiate any
+     * item and render the shared container region they show (see \c viewportRect). Mirror view viewport is
+     * registered in graph (qan::Graph::setViewViewportRect()), virtualized or culled items visible in any view
+     * are created once. Primary view must outlive its mirrors.
+     * \code
+     * Qan.GraphView { id: mainView; graph: Qan.Graph { id: graph } }
+     * Qan.GraphView { graph: graph }   // mirror == true
+     * \endcode
+     */
+    Q_PROPERTY(bool mirror READ isMirror NOTIFY mirrorChanged FINAL)
+    //! \copydoc mirror
+    inline bool             isMirror() const noexcept { return _mirror; }
+private:
+    bool                    _mirror = false;
+signals:
+    void                    mirrorChanged();
+
+public:
+    //! Rectangle shown by this view in graph container item coordinates (updated on zoom, pan and resize).
+    Q_PROPERTY(QRectF viewportRect READ getViewportRect NOTIFY viewportRectChanged FINAL)
+    //! \copydoc viewportRect
+    inline QRectF           getViewportRect() const noexcept { return _viewportRect; }
+private:
+    QRectF                  _viewportRect{};
+signals:
+    void                    viewportRectChanged();
+
+public:
+    //! Return graph qan::Graph::sceneBounds (O(1), see qan::Navigable::contentRect).
+    virtual QRectF          getContentRect() noexcept override;
+
+public:
+    /*! \brief Center the view on \c node (zoom level is not modified).
+     *
+     * Unlike qan::Navigable::centerOn(), \c node might have no item (virtualized node), view is then centered on
+     * qan::Node::geometry (see qan::Graph::findNodes()).
+     */
+    Q_INVOKABLE void    centerOnNode(qan::Node* node);
+
 protected:
     //! Called when the mouse is clicked in the container (base implementation empty).
     virtual void    navigableClicked(QPointF pos) override;
     virtual void    navigableRightClicked(QPointF pos) override;
+    //! Update graph viewport rect (see qan::Graph::virtualized).
+    virtual void    navigableContainerItemModified() override;
+    virtual void    geometryChanged(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+    //! Set graph viewportRect (or mirror view viewport) to this view bounding rect mapped in graph container item.
+    void            updateGraphViewport();
 
     //! Utilisty method to convert a given \c url to a local file path (if possible, otherwise return an empty string).
     Q_INVOKABLE QString urlToLocalFile(QUrl url) const noexcept;
 
+protected:
+    /*! \brief Pointer events resolved with qan::Graph::pickItem() when graph \c centralPicking is enabled.
+     *
+     * Edge items no longer receive mouse and drop events: view pick the item under cursor once and dispatch clicks to
+     * qan::EdgeItem::pickedClick(), edge style drops to qan::EdgeItem::setStyle() and maintain graph \c hoveredItem.
+     */
+    virtual void    hoverMoveEvent(QHoverEvent* event) override;
+    virtual void    hoverLeaveEvent(QHoverEvent* event) override;
+    virtual void    mouseDoubleClickEvent(QMouseEvent* event) override;
+    virtual void    dragEnterEvent(QDragEnterEvent* event) override;
+    virtual void    dragMoveEvent(QDragMoveEvent* event) override;
+    virtual void    dropEvent(QDropEvent* event) override;
+private:
+    //! Enable view hover and drop events according to graph \c centralPicking.
+    void            centralPickingChanged();
+    //! Return the edge item under \c pos (in view CS) when graph \c centralPicking is enabled, nullptr otherwise.
+    qan::EdgeItem*  pickEdgeItem(const QPointF& pos) noexcept;
+
 signals:
     void            connectorChanged();
 
@@ -43,6 +43,7 @@
 // QuickQanava headers
 #include "./qanNode.h"
 #include "./qanGroup.h"
+#include "./qanComponentCache.h"
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
 
@@ -65,26 +66,8 @@ const qan::Graph*   Group::getGraph() const noexcept {
 
 std::unordered_set<qan::Edge*>  Group::collectAdjacentEdges() const
 {
-    std::unordered_set<qan::Edge*> edges = collectAdjacentEdges0();
-    if (is_group()) {
-        for (const auto& group_node_ptr: qAsConst(group_nodes())) {
-            const auto group_node = group_node_ptr.lock();
-            if (group_node) {
-                const auto qanGroupNode = qobject_cast<qan::Group*>(group_node.get());
-                if (qanGroupNode != nullptr) {
-                    const auto groupNodeEdges = qanGroupNode->collectAdjacentEdges();
-                    edges.insert(groupNodeEdges.begin(),
-                                 groupNodeEdges.end());
-                } else {
-                    auto qanNode = qobject_cast<qan::Node*>(group_node.get());
-                    if (qanNode != nullptr) {
-                        auto nodeEdges = qanNode->collectAdjacentEdges0();
-                        edges.insert(nodeEdges.begin(), nodeEdges.end());
-                    }
-                }
-            }
-        }
-    }
+    std::unordered_set<qan::Edge*> edges;
+    forEachAdjacentEdge([&edges](qan::Edge* edge) { edges.insert(edge); });
     return edges;
 }
 
@@ -119,11 +102,8 @@ void    Group::itemEndProposeNodeDrop()
 /* Group Static Factories *///-------------------------------------------------
 QQmlComponent*  Group::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if (!delegate)
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/QuickQanava/Group.qml",
-                                                   QQmlComponent::PreferSynchronous, parent);
-    return delegate.get();
+    Q_UNUSED(parent)
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/QuickQanava/Group.qml"));
 }
 
 qan::NodeStyle* Group::style(QObject* parent) noexcept
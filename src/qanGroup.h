@@ -80,6 +80,28 @@ public:
      */
     std::unordered_set<qan::Edge*>  collectAdjacentEdges() const;
 
+    /*! \brief Call \c f(qan::Edge*) on this group adjacent edges (ie adjacent edges of group and group nodes, recursively).
+     *
+     * \note Contrary to collectAdjacentEdges(), no temporary edge set is allocated: an edge between two grouped nodes
+     * is visited twice, \c f must be idempotent and must not modify group nodes adjacency.
+     */
+    template <class Functor_t>
+    void    forEachAdjacentEdge(Functor_t&& f) const {
+        forEachAdjacentEdge0(f);
+        if (!is_group())
+            return;
+        for (const auto& group_node_ptr: group_nodes()) {
+            const auto group_node = group_node_ptr.lock();
+            if (!group_node)
+                continue;
+            const auto qanGroupNode = qobject_cast<const qan::Group*>(group_node.get());
+            if (qanGroupNode != nullptr)
+                qanGroupNode->forEachAdjacentEdge(f);
+            else
+                group_node->forEachAdjacentEdge0(f);
+        }
+    }
+
 public:
     friend class qan::GroupItem;
 
@@ -32,12 +32,16 @@
 // \date	2016 03 22
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>    // std::sort(), std::unique()
+
 // QuickQanava headers
 #include "./qanGraph.h"
 #include "./qanGroupItem.h"
 #include "./qanEdgeItem.h"
 #include "./qanGroup.h"
 #include "./qanDraggableCtrl.h"
+#include "./qanTrace.h"
 
 namespace qan { // ::qan
 
@@ -58,7 +62,7 @@ GroupItem::GroupItem( QQuickItem* parent ) :
     connect( this, &qan::GroupItem::yChanged,
              this, &qan::GroupItem::groupMoved );
     // Update adjacent edges z when group item z is modified.
-    connect( this, &qan::GroupItem::zChanged, [this]() { this->groupMoved(); } );
+    connect( this, &qan::GroupItem::zChanged, [this]() { this->updateAdjacentEdges(); } );
 
     setItemStyle(qan::Group::style(parent));
     setObjectName(QStringLiteral("qan::GroupItem"));
@@ -73,7 +77,10 @@ auto    GroupItem::setGroup(qan::Group* group) noexcept -> void
     qan::NodeItem::setNode(static_cast<qan::Node*>(group));
 
     // Configuration specific to group
-    _group = group;
+    if ( group != _group.data() ) {
+        _group = group;
+        emit groupChanged();
+    }
     if ( group != nullptr &&            // Warning: Do that after having set _group
          group->getItem() != this )
         group->setItem(this);
@@ -123,17 +130,22 @@ void    GroupItem::setMinimumGroupHeight(qreal minimumGroupHeight) noexcept
 /* Collapse Management *///----------------------------------------------------
 void    GroupItem::setCollapsed(bool collapsed) noexcept
 {
+    const bool wasCollapsed = getCollapsed();
     qan::NodeItem::setCollapsed(collapsed);
     // Note: Selection is hidden in base implementation
     if (_group) {
-        const auto adjacentEdges = _group->collectAdjacentEdges();
-        for (auto edge : adjacentEdges) {    // When a group is collapsed, all adjacent edges shouldbe hidden/shown...
+        const bool visible = !getCollapsed();
+        _group->forEachAdjacentEdge([visible](qan::Edge* edge) {   // When a group is collapsed, all adjacent edges shouldbe hidden/shown...
             if (edge &&
                 edge->getItem() != nullptr)
-                edge->getItem()->setVisible(!getCollapsed());
-        }
+                edge->getItem()->setVisible(visible);
+        });
         if (!getCollapsed())
-            groupMoved();   // Force update of all adjacent edges
+            updateAdjacentEdges();  // Force update of all adjacent edges
+        const auto graph = getGraph();
+        if (graph != nullptr &&
+            wasCollapsed != getCollapsed())
+            emit graph->groupCollapsed(_group.data(), getCollapsed());
     }
 }
 
@@ -154,7 +166,7 @@ void    GroupItem::collapseAncestors(bool collapsed)
         // 1. Collect all ancestors of group
         // 2. Filter from ancestors every nodes that are part of this group
         // 3. Collect adjacent edges of selected nodes
-        // 4. Hide selected edges and nodes
+        // 4. Hide selected edges and nodes (in one batch, see qan::Graph::setNodesVisible())
 
     // 1.
     const auto allAncestors = graph->collectAncestorsDfs(*group, true);
@@ -167,71 +179,138 @@ void    GroupItem::collapseAncestors(bool collapsed)
             ancestors.push_back(const_cast<qan::Node*>(ancestor));
     }
 
-    // 3.
-    std::unordered_set<qan::Edge*> ancestorsEdges;
-    for (const auto ancestor: ancestors) {
-        const auto edges = ancestor->collectAdjacentEdges0();
-        //ancestorsEdges.insert(std::inserter += edges;
-        // FIXME use STL std::inserter here ?
-        for (const auto edge : edges)
-            ancestorsEdges.insert(edge);
-    }
-
-    // 4.
-    for (const auto ancestorEdge: ancestorsEdges)
-        ancestorEdge->getItem()->setVisible(collapsed);
-    for (const auto ancestor: ancestors)
-        ancestor->getItem()->setVisible(collapsed);
+    // 3., 4.
+    graph->setNodesVisible(ancestors, collapsed);
 }
 //-----------------------------------------------------------------------------
 
 /* Group DnD Management *///---------------------------------------------------
 void    GroupItem::groupMoved()
+{
+    if (getCollapsed())   // Do not update edges when the group is collapsed (updated when group is expanded)
+        return;
+    const auto delta = position() - _movedPosition;
+    if (delta.isNull())     // x and y changes are notified separately for a single move
+        return;
+    const auto graph = getGraph();
+    if (!_group ||
+        graph == nullptr) {
+        updateAdjacentEdges();
+        return;
+    }
+    _movedPosition = position();
+
+    // Algorithm:
+        // 1. Collect edges internal to this group subtree, they move with this group item: schedule an update of crossing edges.
+        // 2. Translate internal edges (an internal edge is visited twice), use a scheduled update if edge can't be translated.
+    QAN_TRACE_SCOPE("GroupItem::groupMoved");
+    _internalEdgeItems.clear();
+    _group->forEachAdjacentEdge([this, graph](qan::Edge* edge) {    // 1.
+        const auto edgeItem = edge != nullptr ? edge->getItem() : nullptr;
+        if (edgeItem == nullptr)
+            return;
+        if (isSubtreeItem(edgeItem->getSourceItem()) &&
+            isSubtreeItem(edgeItem->getDestinationItem()))
+            _internalEdgeItems.push_back(edgeItem);
+        else
+            graph->scheduleEdgeItemUpdate(edgeItem);
+    });
+    std::sort(_internalEdgeItems.begin(), _internalEdgeItems.end());   // 2.
+    _internalEdgeItems.erase(std::unique(_internalEdgeItems.begin(), _internalEdgeItems.end()), _internalEdgeItems.end());
+    for (const auto edgeItem : _internalEdgeItems)
+        if (!edgeItem->translateGeometry(delta))
+            graph->scheduleEdgeItemUpdate(edgeItem);
+    _internalEdgeItems.clear();
+}
+
+bool    GroupItem::isSubtreeItem(const QQuickItem* item) const noexcept
+{
+    return item != nullptr &&
+           (item == this || isAncestorOf(item));
+}
+
+void    GroupItem::updateAdjacentEdges()
 {
     if (getCollapsed())   // Do not update edges when the group is collapsed
         return;
+    _movedPosition = position();
 
     // Group node adjacent edges must be updated manually since node are children of this group,
     // their x an y position does not change and is no longer monitored by their edges.
+    // Note: a group move usually modify x and y, edges updates are coalesced by graph frame scheduler and
+    // generated in a single qan::EdgeItem::updateItems() batch (see qan::Graph::scheduleEdgeItemUpdate()).
     if (_group) {
-        auto adjacentEdges = _group->collectAdjacentEdges();
-        for (auto edge : adjacentEdges) {
-            if (edge != nullptr &&
-                edge->getItem() != nullptr)
-                edge->getItem()->updateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
+        const auto graph = getGraph();
+        if (graph != nullptr) {     // Scheduled updates are deduplicated, edges are visited without a temporary set
+            _group->forEachAdjacentEdge([graph](qan::Edge* edge) {
+                if (edge != nullptr &&      // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
+                    edge->getItem() != nullptr)
+                    graph->scheduleEdgeItemUpdate(edge->getItem());
+            });
+        } else {
+            const auto adjacentEdges = _group->collectAdjacentEdges();
+            std::vector<qan::EdgeItem*> edgeItems;
+            edgeItems.reserve(adjacentEdges.size());
+            for (auto edge : adjacentEdges) {
+                if (edge != nullptr &&
+                    edge->getItem() != nullptr)
+                    edgeItems.push_back(edge->getItem());
+            }
+            if (!edgeItems.empty())
+                qan::EdgeItem::updateItems(edgeItems);     // Use batched geometry generation
         }
     }
 }
 
 void    GroupItem::groupNodeItem(qan::NodeItem* nodeItem, bool transform)
+{
+    groupNodeItems(std::vector<qan::NodeItem*>{nodeItem}, transform);
+}
+
+void    GroupItem::ungroupNodeItem(qan::NodeItem* nodeItem, bool transform)
+{
+    ungroupNodeItems(std::vector<qan::NodeItem*>{nodeItem}, transform);
+}
+
+void    GroupItem::groupNodeItems(const std::vector<qan::NodeItem*>& nodeItems, bool transform)
 {
     // PRECONDITIONS:
-        // nodeItem can't be nullptr
+        // nullptr node items are ignored
         // A 'container' must have been configured
-    if ( nodeItem == nullptr ||
-         getContainer() == nullptr )   // A container must have configured in concrete QML group component
+    if ( getContainer() == nullptr )   // A container must have configured in concrete QML group component
         return;
 
     // Note: no need for the container to be visible or open.
-    auto groupPos = QPointF{nodeItem->x(), nodeItem->y()};
-    if (transform) {
-        const auto globalPos = nodeItem->mapToGlobal(QPointF{0., 0.});
-        groupPos = getContainer()->mapFromGlobal(globalPos);
-        nodeItem->setPosition(groupPos);
+    bool grouped = false;
+    for (auto nodeItem : nodeItems) {
+        if (nodeItem == nullptr)
+            continue;
+        auto groupPos = QPointF{nodeItem->x(), nodeItem->y()};
+        if (transform) {
+            const auto globalPos = nodeItem->mapToGlobal(QPointF{0., 0.});
+            groupPos = getContainer()->mapFromGlobal(globalPos);
+            nodeItem->setPosition(groupPos);
+        }
+        nodeItem->setParentItem(getContainer());
+        grouped = true;
     }
-    nodeItem->setParentItem(getContainer());
-    groupMoved();           // Force call to groupMoved() to update group adjacent edges
+    if (!grouped)
+        return;
+    updateAdjacentEdges();  // Update group adjacent edges (once for all node items)
     endProposeNodeDrop();
 }
 
-void    GroupItem::ungroupNodeItem(qan::NodeItem* nodeItem, bool transform)
+void    GroupItem::ungroupNodeItems(const std::vector<qan::NodeItem*>& nodeItems, bool transform)
 {
-    if (nodeItem == nullptr)   // A container must have configured in concrete QML group component
+    if (!getGraph() ||
+        getGraph()->getContainerItem() == nullptr)
         return;
-    if (getGraph() &&
-        getGraph()->getContainerItem() != nullptr) {
-        QPointF nodeGlobalPos = mapToItem(getGraph()->getContainerItem(), nodeItem->position());
-        nodeItem->setParentItem(getGraph()->getContainerItem());
+    const auto graphContainerItem = getGraph()->getContainerItem();
+    for (auto nodeItem : nodeItems) {
+        if (nodeItem == nullptr)
+            continue;
+        QPointF nodeGlobalPos = mapToItem(graphContainerItem, nodeItem->position());
+        nodeItem->setParentItem(graphContainerItem);
         if (transform)
             nodeItem->setPosition(nodeGlobalPos);
         nodeItem->setZ(z()+1.);
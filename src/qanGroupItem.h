@@ -34,6 +34,9 @@
 
 #pragma once
 
+// STD headers
+#include <vector>
+
 // Qt headers
 #include <QQuickItem>
 #include <QPointF>
@@ -75,12 +78,15 @@ public:
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY(qan::Group* group READ getGroup CONSTANT FINAL)
+    Q_PROPERTY(qan::Group* group READ getGroup NOTIFY groupChanged FINAL)
     auto        getGroup() noexcept -> qan::Group*;
     auto        getGroup() const noexcept -> const qan::Group*;
     auto        setGroup(qan::Group* group) noexcept -> void;
 private:
     QPointer<qan::Group> _group{nullptr};
+signals:
+    //! Emitted when item is bound to another group (recycled items, see qan::Graph::itemPoolSize).
+    void        groupChanged();
 
 public:
     //! Utility function to ease initialization from c++, call setX(), setY(), setWidth() and setHEight() with the content of \c rect bounding rect.
@@ -161,9 +167,24 @@ public:
     /*! \name Dragging Support Management *///---------------------------------
     //@{
 protected slots:
-    //! Group is monitored for position change, since group's nodes edges should be updated manually in that case.
+    /*! \brief Group is monitored for position change, since group's nodes edges should be updated manually in that case.
+     *
+     * Move is propagated hierarchically: edges internal to this group subtree (both ends are this group item or one of its
+     * descendants items, including nested groups) are translated with qan::EdgeItem::translateGeometry(), only edges crossing
+     * group boundary are updated with qan::Graph::scheduleEdgeItemUpdate().
+     */
     void            groupMoved();
 
+private:
+    //! Schedule an update of all group adjacent edges (used when group z, collapsed state or content change).
+    void            updateAdjacentEdges();
+    //! Return true if \c item is this group item or one of its descendants.
+    bool            isSubtreeItem(const QQuickItem* item) const noexcept;
+    //! Group item position when its adjacent edges were last updated (or translated).
+    QPointF         _movedPosition;
+    //! Internal edges collected during a group move (storage is reused between moves).
+    std::vector<qan::EdgeItem*> _internalEdgeItems;
+
 public:
     /*! \brief Configure \c nodeItem in this group item (modify target item parenthcip, but keep same visual position).
      */
@@ -172,6 +193,15 @@ public:
     //! Configure \c nodeItem outside this group item (modify parentship, keep same visual position).
     virtual void    ungroupNodeItem(qan::NodeItem* nodeItem, bool transform = true);
 
+    /*! \brief Configure all \c nodeItems in this group item in one pass (group adjacent edges are updated once).
+     *
+     * \sa groupNodeItem()
+     */
+    virtual void    groupNodeItems(const std::vector<qan::NodeItem*>& nodeItems, bool transform = true);
+
+    //! Configure all \c nodeItems outside this group item in one pass, \sa ungroupNodeItem().
+    virtual void    ungroupNodeItems(const std::vector<qan::NodeItem*>& nodeItems, bool transform = true);
+
     //! Call at the beginning of another group or node hover operation on this group (usually trigger a visual change to notify user that insertion is possible trought DND).
     inline void     proposeNodeDrop() noexcept { emit nodeDragEnter( ); }
 
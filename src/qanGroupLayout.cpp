@@ -0,0 +1,257 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGroupLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+// Qt headers
+#include <QDebug>
+
+// GTpo headers
+#include <gtpo/parallel.h>
+
+// QuickQanava headers
+#include "./qanGroupLayout.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Progress of a group content layout: cancellation is forwarded, no intermediate batches are posted.
+class ContentProgress : public qan::LayoutProgress
+{
+public:
+    explicit ContentProgress(const qan::LayoutProgress& progress) : _progress(progress) { }
+    virtual bool    isCancelled() const noexcept override { return _progress.isCancelled(); }
+    virtual bool    isBatchDue() const noexcept override { return false; }
+    virtual void    post(int) noexcept override { }
+private:
+    const qan::LayoutProgress&  _progress;
+};
+
+/*! \brief Lay out hierarchical \c job bottom up, content of container \c c is laid out with \c tasks[i], return total iteration count.
+ *
+ * Containers of the same depth are independent: they are laid out in parallel (each container only writes
+ * its children coordinates and its own size).
+ */
+int     layoutGroups(qan::LayoutJob& job, const std::vector<qan::AbstractLayout::Task>& tasks,
+                     double padding, std::size_t threadCount, const qan::LayoutProgress& progress)
+{
+    const auto n = job.size();
+    const auto root = n;        // Top level nodes "container"
+    const auto parentOf = [&job, root](std::size_t v) -> std::size_t {
+        return job.parents[v] < 0 ? root : static_cast<std::size_t>(job.parents[v]);
+    };
+
+    // Containers children, children index in their container and depth
+    std::vector<std::vector<std::uint32_t>> children(n + 1);
+    std::vector<std::uint32_t> locals(n, 0);
+    for (std::size_t v = 0; v < n; ++v) {
+        auto& siblings = children[parentOf(v)];
+        locals[v] = static_cast<std::uint32_t>(siblings.size());
+        siblings.push_back(static_cast<std::uint32_t>(v));
+    }
+    std::vector<int> depths(n, -1);
+    std::vector<std::size_t> chain;
+    for (std::size_t v = 0; v < n; ++v) {
+        chain.clear();
+        auto u = v;
+        for (; u != root && depths[u] < 0; u = parentOf(u))
+            chain.push_back(u);
+        auto depth = u == root ? -1 : depths[u];
+        for (auto c = chain.crbegin(); c != chain.crend(); ++c)
+            depths[*c] = ++depth;
+    }
+
+    // Edges are lifted to the children of their ends lowest common container
+    std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> edges(n + 1);
+    for (std::size_t s = 0; s < n; ++s)
+        for (auto e = job.offsets[s]; e < job.offsets[s + 1]; ++e) {
+            auto a = s;
+            auto b = static_cast<std::size_t>(job.targets[e]);
+            if (b >= n || a == b)
+                continue;
+            while (depths[a] > depths[b])
+                a = parentOf(a);
+            while (depths[b] > depths[a])
+                b = parentOf(b);
+            while (parentOf(a) != parentOf(b)) {
+                a = parentOf(a);
+                b = parentOf(b);
+            }
+            if (a != b)     // Edges between a group and its content are ignored
+                edges[parentOf(a)].emplace_back(locals[a], locals[b]);
+        }
+
+    std::atomic<int> iterations{0};
+    const auto layoutContent = [&](std::size_t c, std::size_t slot) {
+        const auto& nodes = children[c];
+        qan::LayoutJob content;
+        for (const auto v : nodes) {
+            content.x.push_back(job.x[v]);
+            content.y.push_back(job.y[v]);
+            content.width.push_back(job.width[v]);
+            content.height.push_back(job.height[v]);
+            content.mobility.push_back(job.mobility[v]);
+            content.keys.push_back(job.keys[v]);
+        }
+        content.offsets.assign(nodes.size() + 1, 0);
+        for (const auto& edge : edges[c])
+            ++content.offsets[edge.first + 1];
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            content.offsets[i + 1] += content.offsets[i];
+        content.targets.resize(edges[c].size());
+        std::vector<std::size_t> cursors(content.offsets.cbegin(), content.offsets.cend() - 1);
+        for (const auto& edge : edges[c])
+            content.targets[cursors[edge.first]++] = edge.second;
+
+        if (slot < tasks.size() && tasks[slot]) {
+            ContentProgress contentProgress{progress};
+            iterations += tasks[slot](content, contentProgress);
+        }
+
+        // Content is moved at padding distance from its container top left corner, container is resized to fit
+        auto left = std::numeric_limits<double>::max();
+        auto top = std::numeric_limits<double>::max();
+        auto right = std::numeric_limits<double>::lowest();
+        auto bottom = std::numeric_limits<double>::lowest();
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            left = std::min(left, content.x[i] - content.width[i] / 2.);
+            top = std::min(top, content.y[i] - content.height[i] / 2.);
+            right = std::max(right, content.x[i] + content.width[i] / 2.);
+            bottom = std::max(bottom, content.y[i] + content.height[i] / 2.);
+        }
+        const auto dx = c == root ? 0. : padding - left;
+        const auto dy = c == root ? 0. : padding - top;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            job.x[nodes[i]] = content.x[i] + dx;
+            job.y[nodes[i]] = content.y[i] + dy;
+        }
+        if (c != root) {
+            job.width[c] = std::max(job.width[c], right - left + 2. * padding);
+            job.height[c] = std::max(job.height[c], bottom - top + 2. * padding);
+        }
+    };
+
+    // Containers are laid out by decreasing depth, top level nodes last
+    const auto maxDepth = n > 0 ? *std::max_element(depths.cbegin(), depths.cend()) : 0;
+    std::vector<std::vector<std::size_t>> waves(static_cast<std::size_t>(maxDepth) + 1);
+    for (std::size_t c = 0; c < n; ++c)
+        if (job.containers[c] != 0 && !children[c].empty())
+            waves[static_cast<std::size_t>(depths[c])].push_back(c);
+    std::size_t slot = 0;
+    for (auto wave = waves.crbegin(); wave != waves.crend() && !progress.isCancelled(); ++wave) {
+        if (wave->empty())
+            continue;
+        std::atomic<std::size_t> next{0};
+        const auto& containers = *wave;
+        const auto waveThreadCount = std::min(gtpo::impl::get_thread_count(threadCount), containers.size());
+        gtpo::impl::parallel_run(waveThreadCount, [&](std::size_t, std::size_t, gtpo::impl::barrier&) {
+            for (auto i = next++; i < containers.size() && !progress.isCancelled(); i = next++)
+                layoutContent(containers[i], slot + i);
+        });
+        slot += containers.size();
+    }
+    if (!progress.isCancelled() && !children[root].empty())
+        layoutContent(root, tasks.size() - 1);
+    return iterations.load();
+}
+
+} // ::qan::anonymous
+
+/* GroupLayout Object Management *///------------------------------------------
+GroupLayout::GroupLayout(QObject* parent) :
+    qan::AbstractLayout{parent} { }
+
+AbstractLayout::Task    GroupLayout::createTask()
+{
+    if (!_layout ||
+        getGraph() == nullptr)
+        return Task{};
+    // Note: a task is created for every group content (and top level nodes), tasks could then safely run concurrently
+    std::vector<Task> tasks;
+    const auto taskCount = static_cast<std::size_t>(getGraph()->get_group_count()) + 1;
+    tasks.reserve(taskCount);
+    for (std::size_t t = 0; t < taskCount; ++t) {
+        auto task = _layout->createTask();
+        if (!task)
+            return Task{};
+        tasks.push_back(std::move(task));
+    }
+    const auto threadCount = static_cast<std::size_t>(_threadCount);
+    return [tasks = std::move(tasks), padding = _padding, threadCount](qan::LayoutJob& job, qan::LayoutProgress& progress) {
+        if (!job.isHierarchical())
+            return tasks.back()(job, progress);
+        return layoutGroups(job, tasks, padding, threadCount, progress);
+    };
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Parameters *///------------------------------------------------------
+void    GroupLayout::setLayout(qan::AbstractLayout* layout) noexcept
+{
+    if (qobject_cast<qan::GroupLayout*>(layout) != nullptr) {
+        qWarning() << "qan::GroupLayout::setLayout(): Error: a GroupLayout can't be used as a group content layout.";
+        return;
+    }
+    if (layout != _layout) {
+        _layout = layout;
+        emit layoutChanged();
+    }
+}
+
+void    GroupLayout::setPadding(qreal padding) noexcept
+{
+    padding = std::max(0., padding);
+    if (!qFuzzyCompare(1. + padding, 1. + _padding)) {
+        _padding = padding;
+        emit paddingChanged();
+    }
+}
+
+void    GroupLayout::setThreadCount(int threadCount) noexcept
+{
+    threadCount = std::max(0, threadCount);
+    if (threadCount != _threadCount) {
+        _threadCount = threadCount;
+        emit threadCountChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
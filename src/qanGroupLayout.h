@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanGroupLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QQmlEngine>
+
+// QuickQanava headers
+#include "./qanAbstractLayout.h"
+
+namespace qan { // ::qan
+
+/*! \brief Lay out a grouped graph, content of every qan::Group being laid out independently with \c layout.
+ *
+ * Groups are laid out bottom up: groups of the deepest nesting level are laid out first, in parallel on
+ * \c threadCount threads, each group is then resized to fit its content (see qan::GroupItem::preferredGroupWidth,
+ * group is never smaller than qan::GroupItem::minimumGroupWidth), then their parent group are laid out with
+ * child groups as super nodes, up to top level nodes. Edges between nodes of different groups are lifted to the
+ * children of their common ancestor group.
+ *
+ * \code
+ * Qan.LayeredLayout { id: layeredLayout }
+ * Qan.GroupLayout {
+ *   id: groupLayout
+ *   graph: graph
+ *   layout: layeredLayout
+ * }
+ * Button { text: "Layout"; onClicked: groupLayout.start() }
+ * \endcode
+ *
+ * \note Content of collapsed groups is not laid out. When \c layout is itself multithreaded (for example
+ * qan::ForceDirectedLayout), set its \c threadCount to 1 to avoid oversubscribing cores.
+ * \nosubgrouping
+ */
+class GroupLayout : public qan::AbstractLayout
+{
+    Q_OBJECT
+    /*! \name GroupLayout Object Management *///-------------------------------
+    //@{
+public:
+    explicit GroupLayout(QObject* parent = nullptr);
+    virtual ~GroupLayout() override = default;
+    GroupLayout(const GroupLayout&) = delete;
+    GroupLayout& operator=(const GroupLayout&) = delete;
+
+protected:
+    virtual Task    createTask() override;
+    virtual bool    isHierarchical() const noexcept override { return true; }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Parameters *///-------------------------------------------
+    //@{
+public:
+    /*! \brief Layout used for every group content and for top level nodes (can't be a qan::GroupLayout, default to nullptr).
+     *
+     * Only \c layout parameters are used, its \c graph property could be left unset.
+     */
+    Q_PROPERTY(qan::AbstractLayout* layout READ getLayout WRITE setLayout NOTIFY layoutChanged FINAL)
+    void            setLayout(qan::AbstractLayout* layout) noexcept;
+    inline qan::AbstractLayout* getLayout() const noexcept { return _layout.data(); }
+private:
+    QPointer<qan::AbstractLayout>   _layout;
+signals:
+    void            layoutChanged();
+
+public:
+    //! Space between a group border and its content (default to 20.).
+    Q_PROPERTY(qreal padding READ getPadding WRITE setPadding NOTIFY paddingChanged FINAL)
+    void            setPadding(qreal padding) noexcept;
+    inline qreal    getPadding() const noexcept { return _padding; }
+private:
+    qreal           _padding = 20.;
+signals:
+    void            paddingChanged();
+
+public:
+    //! Number of threads used to lay out groups of the same nesting level, 0 for hardware concurrency (default to 0).
+    Q_PROPERTY(int threadCount READ getThreadCount WRITE setThreadCount NOTIFY threadCountChanged FINAL)
+    void            setThreadCount(int threadCount) noexcept;
+    inline int      getThreadCount() const noexcept { return _threadCount; }
+private:
+    int             _threadCount = 0;
+signals:
+    void            threadCountChanged();
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::GroupLayout)
@@ -0,0 +1,260 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanImageCache.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max
+#include <memory>
+#include <mutex>
+
+// Qt headers
+#include <QImageReader>
+#include <QMetaObject>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QUrl>
+
+// QuickQanava headers
+#include "./qanImageCache.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Cache cost of \c image in KB.
+inline int  imageCost(const QImage& image) noexcept
+{
+    return static_cast<int>(image.sizeInBytes() / 1024) + 1;
+}
+
+//! Local file or resource path of \c source url, empty for an unsupported (remote) url.
+QString     localPath(const QString& source)
+{
+    const QUrl url{source};
+    if (url.scheme() == QLatin1String("qrc"))
+        return QStringLiteral(":") + url.path();
+    if (url.isLocalFile())
+        return url.toLocalFile();
+    if (url.scheme().isEmpty() ||
+        source.startsWith(QLatin1Char(':')))
+        return source;
+    return QString{};
+}
+
+} // ::qan::anonymous
+
+class DecodeRunnable : public QRunnable
+{
+public:
+    DecodeRunnable(QString source, int level, QString key) :
+        QRunnable{}, _source{std::move(source)}, _level{level}, _key{std::move(key)} { setAutoDelete(true); }
+
+    virtual void run() override {
+        QImage image;
+        QString error;
+        const auto path = localPath(_source);
+        if (path.isEmpty())
+            error = QStringLiteral("qan::ImageCache: Unsupported image url ") + _source;
+        else {
+            QImageReader reader{path};
+            reader.setAutoTransform(true);
+            const auto size = reader.size();
+            if (_level > 0 &&
+                size.isValid() &&
+                std::max(size.width(), size.height()) > _level)
+                reader.setScaledSize(size.scaled(_level, _level, Qt::KeepAspectRatio));
+            image = reader.read();
+            if (image.isNull())
+                error = reader.errorString();
+            else if (image.hasAlphaChannel() &&
+                     image.format() != QImage::Format_ARGB32_Premultiplied)
+                image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        }
+        ImageCache::instance().decoded(_key, image, error);
+    }
+
+private:
+    const QString   _source;
+    const int       _level;
+    const QString   _key;
+};
+
+/* ImageCache Management *///--------------------------------------------------
+ImageCache&     ImageCache::instance() noexcept
+{
+    static ImageCache cache;
+    return cache;
+}
+
+ImageCache::ImageCache()
+{
+    _images.setMaxCost(64 * 1024);
+}
+
+void    ImageCache::setCapacity(qint64 capacity) noexcept
+{
+    QMutexLocker lock{&_mutex};
+    _images.setMaxCost(static_cast<int>(std::max(qint64{0}, capacity) / 1024));
+}
+
+qint64  ImageCache::getCapacity() const noexcept
+{
+    QMutexLocker lock{&_mutex};
+    return static_cast<qint64>(_images.maxCost()) * 1024;
+}
+
+qint64  ImageCache::getCost() const noexcept
+{
+    QMutexLocker lock{&_mutex};
+    return static_cast<qint64>(_images.totalCost()) * 1024;
+}
+
+void    ImageCache::clear() noexcept
+{
+    QMutexLocker lock{&_mutex};
+    _images.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Image Decoding *///---------------------------------------------------------
+int     ImageCache::level(const QSize& requestedSize) noexcept
+{
+    const auto extent = std::max(requestedSize.width(), requestedSize.height());
+    if (extent <= 0)
+        return 0;
+    int level = 1;
+    while (level < extent && level < (1 << 16))
+        level <<= 1;
+    return level;
+}
+
+void    ImageCache::request(const QString& source, int level, Callback callback) noexcept
+{
+    if (!callback)
+        return;
+    const auto key = source + QLatin1Char('@') + QString::number(level);
+    {
+        QMutexLocker lock{&_mutex};
+        const auto cached = _images.object(key);
+        if (cached != nullptr) {
+            const QImage image = *cached;   // Note: implicitly shared, callback is called out of lock
+            lock.unlock();
+            callback(image, QString{});
+            return;
+        }
+        auto& waiting = _pending[key];
+        waiting.push_back(std::move(callback));
+        if (waiting.size() > 1)             // Already decoding
+            return;
+    }
+    QThreadPool::globalInstance()->start(new DecodeRunnable{source, level, key});
+}
+
+void    ImageCache::decoded(const QString& key, const QImage& image, const QString& error) noexcept
+{
+    std::vector<Callback> waiting;
+    {
+        QMutexLocker lock{&_mutex};
+        if (!image.isNull())
+            _images.insert(key, new QImage{image}, imageCost(image));
+        waiting = _pending.take(key);
+    }
+    for (const auto& callback : waiting)
+        callback(image, error);
+}
+//-----------------------------------------------------------------------------
+
+/* ImageProvider *///----------------------------------------------------------
+namespace { // ::qan::anonymous
+
+class ImageResponse : public QQuickImageResponse
+{
+public:
+    //! Shared with cache callback, reset when response is destroyed (a response could be destroyed while decoding).
+    struct Guard {
+        std::mutex      mutex;
+        ImageResponse*  response = nullptr;
+    };
+
+    ImageResponse() : QQuickImageResponse{}, _guard{std::make_shared<Guard>()} { _guard->response = this; }
+    virtual ~ImageResponse() override {
+        std::lock_guard<std::mutex> lock{_guard->mutex};
+        _guard->response = nullptr;
+    }
+
+    virtual QQuickTextureFactory*   textureFactory() const override {
+        // Note: default factory texture might be allocated in scene graph atlas
+        return _image.isNull() ? nullptr : QQuickTextureFactory::textureFactoryForImage(_image);
+    }
+    virtual QString errorString() const override { return _error; }
+
+    //! Post \c image to this response (response thread), response finished() is always emitted asynchronously.
+    static void     post(const std::shared_ptr<Guard>& guard, const QImage& image, const QString& error) {
+        std::lock_guard<std::mutex> lock{guard->mutex};
+        const auto response = guard->response;
+        if (response == nullptr)
+            return;
+        QMetaObject::invokeMethod(response, [response, image, error]() {
+            response->_image = image;
+            response->_error = error;
+            emit response->finished();
+        }, Qt::QueuedConnection);
+    }
+
+    const std::shared_ptr<Guard>&   guard() const noexcept { return _guard; }
+
+private:
+    std::shared_ptr<Guard>  _guard;
+    QImage                  _image;
+    QString                 _error;
+};
+
+} // ::qan::anonymous
+
+QQuickImageResponse*    ImageProvider::requestImageResponse(const QString& id, const QSize& requestedSize)
+{
+    auto response = new ImageResponse{};
+    if (id.isEmpty())
+        ImageResponse::post(response->guard(), QImage{}, QStringLiteral("qan::ImageProvider: Empty image url."));
+    else
+        ImageCache::instance().request(id, ImageCache::level(requestedSize),
+                                       [guard = response->guard()](const QImage& image, const QString& error) {
+            ImageResponse::post(guard, image, error);
+        });
+    return response;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
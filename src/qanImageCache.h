@@ -0,0 +1,149 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanImageCache.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <functional>
+#include <vector>
+
+// Qt headers
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QSize>
+#include <QString>
+#include <QQuickAsyncImageProvider>
+
+namespace qan { // ::qan
+
+/*! \brief Process wide, thread safe cache of decoded images shared by every qan::ImageProvider.
+ *
+ * Images are decoded on the global QThreadPool at a power of two size level (see level()): sources are decoded
+ * once per level whatever the number of nodes displaying them, concurrent requests for a source level that is
+ * already decoding wait for the running decoding. Least recently used images are evicted once cached images
+ * memory exceed \c capacity.
+ *
+ * \nosubgrouping
+ */
+class ImageCache
+{
+    /*! \name ImageCache Management *///---------------------------------------
+    //@{
+public:
+    //! Return the process wide image cache.
+    static ImageCache&  instance() noexcept;
+
+    ImageCache();
+    ~ImageCache() = default;
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+public:
+    //! Set maximum cached decoded images memory in bytes (default to 64MB).
+    void        setCapacity(qint64 capacity) noexcept;
+    qint64      getCapacity() const noexcept;
+    //! Actual cached decoded images memory in bytes.
+    qint64      getCost() const noexcept;
+    //! Clear cached images (running decodings are not affected).
+    void        clear() noexcept;
+
+private:
+    mutable QMutex          _mutex;
+    //! Decoded images keyed by source and level, cost is in KB.
+    QCache<QString, QImage> _images;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Image Decoding *///----------------------------------------------
+    //@{
+public:
+    //! Called with decoded image (or a null image and an error string) from a worker thread, or synchronously when cached.
+    using Callback = std::function<void(const QImage& image, const QString& error)>;
+
+    /*! \brief Return decoding level for a \c requestedSize: smallest power of two greater or equal to its largest dimension.
+     *
+     * \return 0 (full resolution) for an invalid or empty \c requestedSize.
+     */
+    static int  level(const QSize& requestedSize) noexcept;
+
+    /*! \brief Get \c source image decoded at \c level (see level()), \c callback is called once image is available.
+     *
+     * \c source is a local file or resource URL (\c file:, \c qrc: or a plain path). Images larger than \c level
+     * are downscaled while decoding (JPEG decoder scales its DCT), smaller images are never upscaled. Images
+     * with an alpha channel are converted to premultiplied ARGB32 on worker thread, so that Qt Quick scene graph
+     * upload them without conversion.
+     */
+    void        request(const QString& source, int level, Callback callback) noexcept;
+
+private:
+    friend class DecodeRunnable;
+    void        decoded(const QString& key, const QImage& image, const QString& error) noexcept;
+
+    //! Callbacks waiting for a running decoding, keyed by source and level.
+    QHash<QString, std::vector<Callback>>   _pending;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+/*! \brief Asynchronous QML image provider backed by qan::ImageCache, registered as \c qan by QuickQanava::initialize().
+ *
+ * Prefix a node image source with \c image://qan/ and set a requested \c sourceSize to share decoded images
+ * between nodes and decode them at a zoom appropriate resolution:
+ * \code
+ * Image {
+ *   anchors.fill: parent
+ *   source: "image://qan/" + nodeItem.node.image
+ *   // Decoded at a power of two size following node on screen size
+ *   sourceSize.width: Math.pow(2, Math.ceil(Math.log(Math.max(1, width * nodeItem.graph.lodZoom)) / Math.LN2))
+ * }
+ * \endcode
+ *
+ * Decoded images are small, Qt Quick scene graph pack them into its texture atlas (textures smaller than half
+ * an atlas page are batched in a single texture, see \c QSG_ATLAS_WIDTH), avoiding a texture and a draw call per
+ * image node.
+ */
+class ImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    ImageProvider() = default;
+    virtual ~ImageProvider() override = default;
+    ImageProvider(const ImageProvider&) = delete;
+
+    virtual QQuickImageResponse*    requestImageResponse(const QString& id, const QSize& requestedSize) override;
+};
+
+} // ::qan
@@ -0,0 +1,516 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::min std::max
+#include <cmath>        // std::sqrt
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGMaterial>
+#include <QSGTexture>
+#include <QQuickWindow>
+#include <QOpenGLShaderProgram>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QVector4D>
+
+// QuickQanava headers
+#include "./qanLabelBatchRenderer.h"
+#include "./qanNodeItem.h"
+#include "./qanEdgeItem.h"
+#include "./qanNode.h"
+#include "./qanEdge.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Distance field text material (color is premultiplied, material owns its atlas texture).
+class DistanceFieldLabelMaterial : public QSGMaterial
+{
+public:
+    DistanceFieldLabelMaterial() { setFlag(QSGMaterial::Blending); }
+    virtual ~DistanceFieldLabelMaterial() override { delete texture; }
+    virtual QSGMaterialType*    type() const override { static QSGMaterialType type; return &type; }
+    virtual QSGMaterialShader*  createShader() const override;
+    virtual int                 compare(const QSGMaterial* other) const override {
+        return other == this ? 0 : (other < this ? -1 : 1);
+    }
+
+    QSGTexture* texture = nullptr;
+    QVector4D   color;
+    float       scale = 1.f;    // Item pixels per atlas pixel
+    float       spread = 1.f;   // Distance field spread in atlas pixels
+};
+
+class DistanceFieldLabelMaterialShader : public QSGMaterialShader
+{
+public:
+    virtual const char*         vertexShader() const override {
+        return  "attribute highp vec4 qt_VertexPosition;\n"
+                "attribute highp vec2 qt_VertexTexCoord;\n"
+                "uniform highp mat4 qt_Matrix;\n"
+                "varying highp vec2 uv;\n"
+                "void main() {\n"
+                "    uv = qt_VertexTexCoord;\n"
+                "    gl_Position = qt_Matrix * qt_VertexPosition;\n"
+                "}\n";
+    }
+    // Distance is encoded in alpha, 0.5 on glyph outline: smoothing is half a screen pixel expressed in distance units.
+    virtual const char*         fragmentShader() const override {
+        return  "uniform lowp float qt_Opacity;\n"
+                "uniform sampler2D atlas;\n"
+                "uniform lowp vec4 color;\n"
+                "uniform highp float smoothing;\n"
+                "varying highp vec2 uv;\n"
+                "void main() {\n"
+                "    highp float d = texture2D(atlas, uv).a;\n"
+                "    gl_FragColor = color * smoothstep(0.5 - smoothing, 0.5 + smoothing, d) * qt_Opacity;\n"
+                "}\n";
+    }
+    virtual char const* const*  attributeNames() const override {
+        static const char* const names[] = { "qt_VertexPosition", "qt_VertexTexCoord", nullptr };
+        return names;
+    }
+    virtual void                updateState(const RenderState& state, QSGMaterial* newMaterial, QSGMaterial* oldMaterial) override {
+        Q_UNUSED(oldMaterial)
+        auto p = program();
+        if (state.isMatrixDirty())
+            p->setUniformValue(_matrixId, state.combinedMatrix());
+        if (state.isOpacityDirty())
+            p->setUniformValue(_opacityId, state.opacity());
+        const auto material = static_cast<DistanceFieldLabelMaterial*>(newMaterial);
+        // Screen pixels per item pixel, from model view matrix scaling (zoom) and device pixel ratio
+        const auto m = state.modelViewMatrix();
+        const auto itemScale = std::sqrt(std::abs(m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0))) *
+                               static_cast<float>(state.devicePixelRatio());
+        const auto screenSpread = std::max(0.0001f, material->spread * material->scale * itemScale);
+        p->setUniformValue(_smoothingId, std::min(0.5f, 0.25f / screenSpread));
+        p->setUniformValue(_colorId, material->color);
+        p->setUniformValue(_atlasId, 0);
+        if (material->texture != nullptr)
+            material->texture->bind();
+    }
+
+protected:
+    virtual void                initialize() override {
+        auto p = program();
+        _matrixId = p->uniformLocation("qt_Matrix");
+        _opacityId = p->uniformLocation("qt_Opacity");
+        _atlasId = p->uniformLocation("atlas");
+        _colorId = p->uniformLocation("color");
+        _smoothingId = p->uniformLocation("smoothing");
+    }
+
+private:
+    int _matrixId = -1;
+    int _opacityId = -1;
+    int _atlasId = -1;
+    int _colorId = -1;
+    int _smoothingId = -1;
+};
+
+QSGMaterialShader*  DistanceFieldLabelMaterial::createShader() const { return new DistanceFieldLabelMaterialShader{}; }
+
+inline QVector4D    premultiplied(const QColor& color) noexcept
+{
+    const auto a = static_cast<float>(color.alphaF());
+    return QVector4D{static_cast<float>(color.redF()) * a,
+                     static_cast<float>(color.greenF()) * a,
+                     static_cast<float>(color.blueF()) * a, a};
+}
+
+} // ::qan::anonymous
+
+/* LabelBatchRenderer Object Management *///----------------------------------
+LabelBatchRenderer::LabelBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+LabelBatchRenderer::~LabelBatchRenderer()
+{
+    if (_graph)
+        _graph->setLabelsBatched(false);
+}
+
+void    LabelBatchRenderer::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph) {
+        disconnect(_graph, nullptr, this, nullptr);
+        for (const auto& edge : _graph->get_edges())
+            if (edge)
+                disconnect(edge.get(), nullptr, this, nullptr);
+        _graph->setLabelsBatched(false);
+    }
+    _graph = graph;
+    if (_graph) {
+        _graph->setLabelsBatched(true);
+        connect(_graph, &qan::Graph::lodZoomChanged,        this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::viewportRectChanged,   this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeLabelChanged,      this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeInserted,          this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeRemoved,           this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::updateEnded,           this, &LabelBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::sceneModified,         this, &LabelBatchRenderer::invalidate);
+        // Edge labels have no graph level notification: monitor edges label
+        const auto monitorEdge = [this](qan::Edge* edge) {
+            if (edge != nullptr)
+                connect(edge, &qan::Edge::labelChanged, this, &LabelBatchRenderer::invalidate);
+        };
+        for (const auto& edge : _graph->get_edges())
+            monitorEdge(edge.get());
+        connect(_graph, &qan::Graph::edgeInserted, this, [this, monitorEdge](qan::Edge* edge) {
+            monitorEdge(edge);
+            invalidate();
+        });
+    }
+    invalidate();
+    emit graphChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Label Settings *///---------------------------------------------------------
+void    LabelBatchRenderer::setFont(const QFont& font) noexcept
+{
+    if (font != _font) {
+        _font = font;
+        resetAtlas();
+        invalidate();
+        emit fontChanged();
+    }
+}
+
+void    LabelBatchRenderer::setPixelSize(qreal pixelSize) noexcept
+{
+    pixelSize = std::max(1., pixelSize);
+    if (!qFuzzyCompare(1. + pixelSize, 1. + _pixelSize)) {
+        _pixelSize = pixelSize;
+        invalidate();
+        emit pixelSizeChanged();
+    }
+}
+
+void    LabelBatchRenderer::setMinimumPixelSize(qreal minimumPixelSize) noexcept
+{
+    minimumPixelSize = std::max(0., minimumPixelSize);
+    if (!qFuzzyCompare(1. + minimumPixelSize, 1. + _minimumPixelSize)) {
+        _minimumPixelSize = minimumPixelSize;
+        invalidate();
+        emit minimumPixelSizeChanged();
+    }
+}
+
+void    LabelBatchRenderer::setColor(QColor color) noexcept
+{
+    if (color != _color) {
+        _color = color;
+        update();   // Color is a material uniform, no layout necessary
+        emit colorChanged();
+    }
+}
+
+void    LabelBatchRenderer::setEdgeLabels(bool edgeLabels) noexcept
+{
+    if (edgeLabels != _edgeLabels) {
+        _edgeLabels = edgeLabels;
+        invalidate();
+        emit edgeLabelsChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Batch Rendering *///--------------------------------------------------------
+void    LabelBatchRenderer::invalidate() noexcept
+{
+    if (_rebuild)       // Merge multiple invalidations until next frame
+        return;
+    _rebuild = true;
+    polish();
+}
+
+QFont   LabelBatchRenderer::atlasFont() const noexcept
+{
+    auto font = _font;
+    font.setPixelSize(atlasGlyphSize);
+    return font;
+}
+
+void    LabelBatchRenderer::resetAtlas() noexcept
+{
+    _glyphs.clear();
+    _atlas = QImage{};
+    _atlasCell = 0;
+    _atlasDirty = true;
+}
+
+const LabelBatchRenderer::Glyph&    LabelBatchRenderer::glyph(QChar c)
+{
+    const auto cached = _glyphs.find(c.unicode());
+    if (cached != _glyphs.end())
+        return cached->second;
+    auto& g = _glyphs[c.unicode()];
+    const QFontMetricsF fm{atlasFont()};
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 11, 0))
+    g.advance = fm.horizontalAdvance(c);
+#else
+    g.advance = fm.width(c);
+#endif
+    const auto br = fm.boundingRect(c);
+    const auto cellCount = atlasColumns * atlasMaximumRows;
+    if (br.isEmpty() ||             // Whitespace: advance only
+        _atlasCell >= cellCount)    // Atlas full: glyph is not rendered
+        return g;
+
+    // Grow atlas by doubling its rows (glyphs uv are in atlas pixels and stay valid)
+    const auto cell = _atlasCell++;
+    const auto rows = cell / atlasColumns + 1;
+    if (_atlas.isNull() ||
+        _atlas.height() < rows * atlasCellSize) {
+        const auto atlasRows = std::min(atlasMaximumRows, std::max(rows, _atlas.isNull() ? 1 : 2 * _atlas.height() / atlasCellSize));
+        if (_atlas.isNull()) {
+            _atlas = QImage{atlasColumns * atlasCellSize, atlasRows * atlasCellSize, QImage::Format_ARGB32_Premultiplied};
+            _atlas.fill(Qt::transparent);
+        } else      // Note: areas outside source image are filled with 0 (transparent)
+            _atlas = _atlas.copy(0, 0, _atlas.width(), atlasRows * atlasCellSize);
+    }
+
+    // Render glyph coverage with pen origin so that glyph bounding rect starts at spread
+    const QPointF pen{atlasSpread - br.left(), atlasSpread - br.top()};
+    QImage mask{atlasCellSize, atlasCellSize, QImage::Format_ARGB32_Premultiplied};
+    mask.fill(Qt::transparent);
+    {
+        QPainter painter{&mask};
+        painter.setRenderHint(QPainter::TextAntialiasing);
+        painter.setFont(atlasFont());
+        painter.setPen(Qt::white);
+        painter.drawText(pen, QString{c});
+    }
+    std::vector<bool> inside(atlasCellSize * atlasCellSize);
+    for (int y = 0; y < atlasCellSize; ++y) {
+        const auto line = reinterpret_cast<const QRgb*>(mask.constScanLine(y));
+        for (int x = 0; x < atlasCellSize; ++x)
+            inside[y * atlasCellSize + x] = qAlpha(line[x]) >= 128;
+    }
+
+    // Brute force signed distance to nearest opposite pixel, limited to spread and mapped to [0, 1] (0.5 on outline)
+    const auto cellX = (cell % atlasColumns) * atlasCellSize;
+    const auto cellY = (cell / atlasColumns) * atlasCellSize;
+    for (int y = 0; y < atlasCellSize; ++y) {
+        auto line = reinterpret_cast<QRgb*>(_atlas.scanLine(cellY + y)) + cellX;
+        for (int x = 0; x < atlasCellSize; ++x) {
+            const bool in = inside[y * atlasCellSize + x];
+            int d2 = atlasSpread * atlasSpread;
+            for (int dy = -atlasSpread; dy <= atlasSpread; ++dy) {
+                const auto sy = y + dy;
+                if (sy < 0 || sy >= atlasCellSize)
+                    continue;
+                for (int dx = -atlasSpread; dx <= atlasSpread; ++dx) {
+                    const auto sx = x + dx;
+                    if (sx < 0 || sx >= atlasCellSize ||
+                        inside[sy * atlasCellSize + sx] == in)
+                        continue;
+                    d2 = std::min(d2, dx * dx + dy * dy);
+                }
+            }
+            const auto d = std::sqrt(static_cast<qreal>(d2)) - 0.5;     // Outline lies between pixel centers
+            const auto sd = in ? d : -d;
+            const auto v = static_cast<int>(std::max(0., std::min(1., 0.5 + sd / (2. * atlasSpread))) * 255.);
+            line[x] = qRgba(v, v, v, v);
+        }
+    }
+    const auto w = std::min(static_cast<qreal>(atlasCellSize), br.width() + 2. * atlasSpread);
+    const auto h = std::min(static_cast<qreal>(atlasCellSize), br.height() + 2. * atlasSpread);
+    g.uv = QRectF{static_cast<qreal>(cellX), static_cast<qreal>(cellY), w, h};
+    g.quad = QRectF{br.left() - atlasSpread, br.top() - atlasSpread, w, h};
+    _atlasDirty = true;
+    return g;
+}
+
+bool    LabelBatchRenderer::layoutLabel(const QString& text, QPointF top, qreal maxWidth)
+{
+    if (text.isEmpty())
+        return false;
+    const auto s = _pixelSize / atlasGlyphSize;     // Item pixels per atlas pixel
+    const QFontMetricsF fm{atlasFont()};
+    const auto lineHeight = fm.height() * s;
+
+    // Single line: stop at first line break, elide right to maxWidth
+    auto line = text.left(text.indexOf(QChar{'\n'}));
+    qreal width = 0.;
+    for (const auto c : line)
+        width += glyph(c).advance * s;
+    if (maxWidth > 0. &&
+        width > maxWidth) {
+        const QChar ellipsis{0x2026};
+        const auto ellipsisWidth = glyph(ellipsis).advance * s;
+        while (!line.isEmpty() &&
+               width + ellipsisWidth > maxWidth) {
+            width -= glyph(line.at(line.size() - 1)).advance * s;
+            line.chop(1);
+        }
+        if (line.isEmpty())
+            return false;
+        line.append(ellipsis);
+        width += ellipsisWidth;
+    }
+
+    const QRectF br{top.x() - width / 2., top.y(), width, lineHeight};
+    const auto viewportRect = _graph->getViewportRect();
+    if (viewportRect.isValid() &&
+        !viewportRect.intersects(br))
+        return false;
+    auto penX = br.left();
+    const auto baseline = top.y() + fm.ascent() * s;
+    for (const auto c : line) {
+        const auto& g = glyph(c);
+        if (!g.uv.isEmpty()) {
+            const auto x0 = static_cast<float>(penX + g.quad.left() * s);
+            const auto y0 = static_cast<float>(baseline + g.quad.top() * s);
+            const auto x1 = static_cast<float>(penX + g.quad.right() * s);
+            const auto y1 = static_cast<float>(baseline + g.quad.bottom() * s);
+            const auto u0 = static_cast<float>(g.uv.left()), v0 = static_cast<float>(g.uv.top());
+            const auto u1 = static_cast<float>(g.uv.right()), v1 = static_cast<float>(g.uv.bottom());
+            _vertices.push_back({x0, y0, u0, v0});  _vertices.push_back({x1, y0, u1, v0});  _vertices.push_back({x0, y1, u0, v1});
+            _vertices.push_back({x1, y0, u1, v0});  _vertices.push_back({x1, y1, u1, v1});  _vertices.push_back({x0, y1, u0, v1});
+        }
+        penX += g.advance * s;
+    }
+    return true;
+}
+
+void    LabelBatchRenderer::updatePolish()
+{
+    if (!_rebuild)
+        return;
+    _rebuild = false;
+    _vertices.clear();
+    int labelCount = 0;
+    // Labels are unreadable (and not rendered) below minimumPixelSize on screen
+    if (_graph &&
+        _pixelSize * _graph->getLodZoom() >= _minimumPixelSize) {
+        constexpr qreal padding = 4.;
+        for (const auto& node : _graph->get_nodes()) {
+            if (!node ||
+                node->is_group())
+                continue;
+            const auto nodeItem = node->getItem();
+            if (nodeItem == nullptr ||          // Virtualized nodes have no visible label
+                !nodeItem->isVisible() ||
+                nodeItem->getCulled())
+                continue;
+            // Grouped nodes items have group relative coordinates
+            const auto r = nodeItem->mapRectToItem(this, QRectF{0., 0., nodeItem->width(), nodeItem->height()});
+            if (layoutLabel(node->getLabel(), QPointF{r.center().x(), r.top() + padding}, r.width() - 2. * padding))
+                ++labelCount;
+        }
+        if (_edgeLabels) {
+            const auto lineHeight = QFontMetricsF{atlasFont()}.height() * _pixelSize / atlasGlyphSize;
+            for (const auto& edge : _graph->get_edges()) {
+                const auto edgeItem = edge ? edge->getItem() : nullptr;
+                if (edgeItem == nullptr ||
+                    !edgeItem->isVisible() ||
+                    edgeItem->getCulled())
+                    continue;
+                const auto p = edgeItem->mapToItem(this, edgeItem->getLabelPos());
+                if (layoutLabel(edge->getLabel(), QPointF{p.x(), p.y() - lineHeight / 2.}, 0.))
+                    ++labelCount;
+            }
+        }
+    }
+    if (labelCount != _labelCount) {
+        _labelCount = labelCount;
+        emit labelCountChanged();
+    }
+    update();
+}
+
+QSGNode*    LabelBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    // Note: GUI thread is blocked while updatePaintNode() is called, layout and atlas can be safely read.
+    if (_vertices.empty() ||
+        _atlas.isNull() ||
+        window() == nullptr) {
+        delete oldNode;         // Atlas texture is owned by node material
+        _atlasDirty = true;
+        return nullptr;
+    }
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new DistanceFieldLabelMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        _atlasDirty = true;
+    }
+    auto material = static_cast<DistanceFieldLabelMaterial*>(node->material());
+    if (_atlasDirty) {
+        _atlasDirty = false;
+        delete material->texture;
+        material->texture = window()->createTextureFromImage(_atlas);
+        material->texture->setFiltering(QSGTexture::Linear);
+    }
+    material->color = premultiplied(_color);
+    material->scale = static_cast<float>(_pixelSize / atlasGlyphSize);
+    material->spread = static_cast<float>(atlasSpread);
+    node->markDirty(QSGNode::DirtyMaterial);
+
+    auto geometry = node->geometry();
+    const auto vertexCount = static_cast<int>(_vertices.size());
+    if (geometry->vertexCount() != vertexCount)
+        geometry->allocate(vertexCount);
+    // Glyphs uv are laid out in atlas pixels
+    const auto tw = static_cast<float>(_atlas.width()), th = static_cast<float>(_atlas.height());
+    auto v = geometry->vertexDataAsTexturedPoint2D();
+    for (const auto& vertex : _vertices) {
+        v->set(vertex.x, vertex.y, vertex.tx / tw, vertex.ty / th);
+        ++v;
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,226 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+#include <QFont>
+#include <QImage>
+#include <QRectF>
+#include <QSGGeometry>
+
+namespace qan { // ::qan
+
+class Graph;
+
+/*! \brief Draw all node and edge labels with shared distance field glyphs in a single scene graph node.
+ *
+ * Node labels (qan::Node::label) and edge labels (qan::Edge::label, at qan::EdgeItem::labelPos) are laid out on a
+ * single line and drawn with textured quads sampling a shared signed distance field glyph atlas: glyphs stay sharp
+ * at any zoom, and all labels are rendered in one draw call instead of one QML Text item (and glyph node) per label.
+ * Renderer set qan::Graph::labelsBatched: default node delegates hide their QML label when it is set.
+ *
+ * Labels are culled when they are unreadable, ie when \c pixelSize multiplied by graph \c lodZoom is less than
+ * \c minimumPixelSize, and when they lie outside graph \c viewportRect or belong to a culled node item.
+ *
+ * Renderer must be a child of graph container item (at origin), above nodes:
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   graph: Qan.Graph { id: graph }
+ *   Qan.LabelBatchRenderer {
+ *     parent: graphView.containerItem
+ *     graph: graph
+ *     z: 1000
+ *   }
+ * }
+ * \endcode
+ *
+ * \note Glyphs are generated per character without complex shaping (no ligatures, no bidirectional text), node labels
+ * are elided to node width. Group labels are left to group delegates.
+ * \nosubgrouping
+ */
+class LabelBatchRenderer : public QQuickItem
+{
+    /*! \name LabelBatchRenderer Object Management *///------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit LabelBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~LabelBatchRenderer() override;
+    LabelBatchRenderer(const LabelBatchRenderer&) = delete;
+
+public:
+    //! Graph whose labels are rendered.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Label Settings *///----------------------------------------------
+    //@{
+public:
+    //! Labels font family, weight and style (font size is ignored, see \c pixelSize).
+    Q_PROPERTY(QFont font READ getFont WRITE setFont NOTIFY fontChanged FINAL)
+    //! \copydoc font
+    inline QFont        getFont() const noexcept { return _font; }
+    //! \copydoc font
+    void                setFont(const QFont& font) noexcept;
+private:
+    QFont               _font;
+signals:
+    void                fontChanged();
+
+public:
+    //! Labels size in graph container CS (default to 13.0).
+    Q_PROPERTY(qreal pixelSize READ getPixelSize WRITE setPixelSize NOTIFY pixelSizeChanged FINAL)
+    //! \copydoc pixelSize
+    inline qreal        getPixelSize() const noexcept { return _pixelSize; }
+    //! \copydoc pixelSize
+    void                setPixelSize(qreal pixelSize) noexcept;
+private:
+    qreal               _pixelSize = 13.;
+signals:
+    void                pixelSizeChanged();
+
+public:
+    //! Labels are not rendered when their on screen size is less than \c minimumPixelSize (default to 6.0).
+    Q_PROPERTY(qreal minimumPixelSize READ getMinimumPixelSize WRITE setMinimumPixelSize NOTIFY minimumPixelSizeChanged FINAL)
+    //! \copydoc minimumPixelSize
+    inline qreal        getMinimumPixelSize() const noexcept { return _minimumPixelSize; }
+    //! \copydoc minimumPixelSize
+    void                setMinimumPixelSize(qreal minimumPixelSize) noexcept;
+private:
+    qreal               _minimumPixelSize = 6.;
+signals:
+    void                minimumPixelSizeChanged();
+
+public:
+    //! Labels color (default to black).
+    Q_PROPERTY(QColor color READ getColor WRITE setColor NOTIFY colorChanged FINAL)
+    //! \copydoc color
+    inline QColor       getColor() const noexcept { return _color; }
+    //! \copydoc color
+    void                setColor(QColor color) noexcept;
+private:
+    QColor              _color{Qt::black};
+signals:
+    void                colorChanged();
+
+public:
+    //! Render edge labels (default to true).
+    Q_PROPERTY(bool edgeLabels READ getEdgeLabels WRITE setEdgeLabels NOTIFY edgeLabelsChanged FINAL)
+    //! \copydoc edgeLabels
+    inline bool         getEdgeLabels() const noexcept { return _edgeLabels; }
+    //! \copydoc edgeLabels
+    void                setEdgeLabels(bool edgeLabels) noexcept;
+private:
+    bool                _edgeLabels = true;
+signals:
+    void                edgeLabelsChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batch Rendering *///---------------------------------------------
+    //@{
+public:
+    //! Number of labels rendered in last frame (read-only).
+    Q_PROPERTY(int labelCount READ getLabelCount NOTIFY labelCountChanged FINAL)
+    //! \copydoc labelCount
+    inline int          getLabelCount() const noexcept { return _labelCount; }
+signals:
+    void                labelCountChanged();
+
+public:
+    //! Force a rebuild of labels geometry (rebuild is automatic when graph scene, labels or zoom change).
+    Q_INVOKABLE void    invalidate() noexcept;
+protected:
+    //! Layout visible labels glyphs (on GUI thread, generating missing glyphs in atlas).
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+private:
+    //! Append \c text glyphs quads, centered horizontally on \c top, return false if label is culled.
+    bool                layoutLabel(const QString& text, QPointF top, qreal maxWidth);
+    bool                _rebuild = false;
+    int                 _labelCount = 0;
+    std::vector<QSGGeometry::TexturedPoint2D>   _vertices;  // Glyphs quads vertices, uv in atlas pixels
+
+private:
+    //! Distance field glyph in atlas (\c uv and \c quad in atlas pixels, \c quad relative to pen position on baseline).
+    struct Glyph {
+        QRectF  uv;
+        QRectF  quad;
+        qreal   advance = 0.;
+    };
+    //! Return \c c glyph, generating its distance field in atlas if necessary.
+    const Glyph&        glyph(QChar c);
+    //! Clear atlas and glyph cache (glyphs are regenerated on demand).
+    void                resetAtlas() noexcept;
+    //! Font used to render glyphs in atlas (\c font at \c atlasGlyphSize pixel size).
+    QFont               atlasFont() const noexcept;
+    //! Glyph font pixel size in atlas.
+    static constexpr int    atlasGlyphSize = 32;
+    //! Distance field spread (in atlas pixels) around glyphs outline.
+    static constexpr int    atlasSpread = 4;
+    //! Atlas cell size (in atlas pixels), large enough for wide glyphs and descenders.
+    static constexpr int    atlasCellSize = atlasGlyphSize + atlasGlyphSize / 2;
+    //! Atlas cells per row.
+    static constexpr int    atlasColumns = 16;
+    //! Maximum atlas cell rows, glyphs are not generated once atlas is full.
+    static constexpr int    atlasMaximumRows = 64;
+    std::unordered_map<ushort, Glyph>   _glyphs;
+    QImage              _atlas;
+    int                 _atlasCell = 0;         // Next free atlas cell index
+    bool                _atlasDirty = false;    // Atlas texture must be uploaded
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::LabelBatchRenderer)
@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelIndex.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::sort std::unique std::find
+
+// QuickQanava headers
+#include "./qanLabelIndex.h"
+
+namespace qan { // ::qan
+
+/* LabelIndex Object Management *///-------------------------------------------
+template <class F>
+void    LabelIndex::forEachTrigram(const QString& folded, F f) const noexcept
+{
+    if (folded.size() < 3)
+        return;
+    _trigrams.clear();
+    const auto data = folded.utf16();
+    for (int c = 0; c + 2 < folded.size(); ++c)
+        _trigrams.push_back(( static_cast<Trigram>(data[c]) << 32 ) |
+                            ( static_cast<Trigram>(data[c + 1]) << 16 ) |
+                            static_cast<Trigram>(data[c + 2]));
+    std::sort(_trigrams.begin(), _trigrams.end());
+    _trigrams.erase(std::unique(_trigrams.begin(), _trigrams.end()), _trigrams.end());
+    for (const auto trigram : _trigrams)
+        f(trigram);
+}
+
+void    LabelIndex::insert(const qan::Node* node, const QString& label) noexcept
+{
+    if (node == nullptr)
+        return;
+    auto entry = _entries.find(node);
+    if (entry != _entries.end()) {
+        if (entry->second.label == label)
+            return;
+        unlink(node, entry->second.folded);
+    } else
+        entry = _entries.emplace(node, Entry{}).first;
+    invalidateLastQuery();
+    entry->second.label = label;
+    entry->second.folded = label.toCaseFolded();
+    forEachTrigram(entry->second.folded, [this, node](Trigram trigram) {
+        _postings[trigram].push_back(node);
+    });
+}
+
+void    LabelIndex::remove(const qan::Node* node) noexcept
+{
+    const auto entry = _entries.find(node);
+    if (entry == _entries.end())
+        return;
+    invalidateLastQuery();
+    unlink(node, entry->second.folded);
+    _entries.erase(entry);
+}
+
+void    LabelIndex::unlink(const qan::Node* node, const QString& folded) noexcept
+{
+    forEachTrigram(folded, [this, node](Trigram trigram) {
+        const auto posting = _postings.find(trigram);
+        if (posting == _postings.end())
+            return;
+        auto& nodes = posting->second;
+        const auto n = std::find(nodes.begin(), nodes.end(), node);
+        if (n != nodes.end()) {     // Note: posting order is irrelevant, swap and pop
+            *n = nodes.back();
+            nodes.pop_back();
+        }
+        if (nodes.empty())
+            _postings.erase(posting);
+    });
+}
+
+QString LabelIndex::labelOf(const qan::Node* node) const noexcept
+{
+    const auto entry = _entries.find(node);
+    return entry != _entries.end() ? entry->second.label : QString{};
+}
+
+std::vector<const qan::Node*>   LabelIndex::nodes() const noexcept
+{
+    std::vector<const qan::Node*> nodes;
+    nodes.reserve(_entries.size());
+    for (const auto& entry : _entries)
+        nodes.push_back(entry.first);
+    return nodes;
+}
+
+void    LabelIndex::clear() noexcept
+{
+    invalidateLastQuery();
+    _entries.clear();
+    _postings.clear();
+}
+
+std::vector<const qan::Node*>   LabelIndex::find(const QString& query, int limit) const noexcept
+{
+    std::vector<const qan::Node*> matches;
+    if (query.isEmpty() ||
+        limit == 0)
+        return matches;
+    const auto folded = query.toCaseFolded();
+    bool complete = true;
+    const auto verify = [&](const qan::Node* node) -> bool {   // Return false when limit is reached
+        const auto entry = _entries.find(node);
+        if (entry != _entries.end() &&
+            entry->second.folded.contains(folded))
+            matches.push_back(node);
+        return limit < 0 ||
+               static_cast<int>(matches.size()) < limit;
+    };
+
+    // Algorithm:
+    // 1. If query contains previous query and previous result was complete, verify previous matches only.
+    // 2. Otherwise, for short queries scan indexed labels.
+    // 3. Otherwise, verify the shortest posting list of query trigrams (no match if a trigram is not indexed).
+    std::vector<const qan::Node*> candidates;
+    const std::vector<const qan::Node*>* verified = nullptr;
+    if (_lastComplete &&                        // 1.
+        folded.contains(_lastQuery)) {
+        candidates.swap(_lastMatches);
+        verified = &candidates;
+    } else if (folded.size() < 3) {             // 2.
+        for (const auto& entry : _entries)
+            if (!verify(entry.first)) {
+                complete = false;
+                break;
+            }
+    } else {                                    // 3.
+        const std::vector<const qan::Node*>* shortest = nullptr;
+        bool missing = false;
+        forEachTrigram(folded, [&](Trigram trigram) {
+            const auto posting = _postings.find(trigram);
+            if (posting == _postings.end())
+                missing = true;
+            else if (shortest == nullptr ||
+                     posting->second.size() < shortest->size())
+                shortest = &posting->second;
+        });
+        verified = missing ? nullptr : shortest;
+    }
+    if (verified != nullptr) {
+        const auto& nodes = *verified;
+        for (std::size_t n = 0; n < nodes.size(); ++n)
+            if (!verify(nodes[n])) {
+                complete = n + 1 == nodes.size();
+                break;
+            }
+    }
+    _lastQuery = folded;
+    _lastMatches = matches;
+    _lastComplete = complete;
+    return matches;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,117 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLabelIndex.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QString>
+
+namespace qan { // ::qan
+
+class Node;
+
+/*! \brief Case insensitive substring index of node labels (trigram inverted index).
+ *
+ * Every distinct trigram of a case folded label reference its node in a posting list. A query of three
+ * characters or more is resolved by verifying the nodes of its shortest trigram posting list, shorter queries
+ * scan indexed labels until \c limit matches are found (short queries usually match many labels early).
+ *
+ * When a query extend the previous one (search as you type) and previous result was complete, only previous
+ * matches are verified.
+ *
+ * Index store node key and label, nodes are never dereferenced.
+ */
+class LabelIndex
+{
+    /*! \name LabelIndex Object Management *///--------------------------------
+    //@{
+public:
+    LabelIndex() noexcept = default;
+    ~LabelIndex() noexcept = default;
+    LabelIndex(const LabelIndex&) = delete;
+    LabelIndex& operator=(const LabelIndex&) = delete;
+
+public:
+    //! Insert \c node with \c label, or update \c node label if it is already indexed.
+    void        insert(const qan::Node* node, const QString& label) noexcept;
+    //! Remove \c node from index (nothing is done if \c node is not indexed).
+    void        remove(const qan::Node* node) noexcept;
+    //! Return true if \c node is indexed.
+    inline bool contains(const qan::Node* node) const noexcept { return _entries.find(node) != _entries.end(); }
+    //! Return \c node indexed label (an empty string if \c node is not indexed).
+    QString     labelOf(const qan::Node* node) const noexcept;
+    //! Remove all nodes from index.
+    void        clear() noexcept;
+    //! Number of nodes actually indexed.
+    inline int  size() const noexcept { return static_cast<int>(_entries.size()); }
+    //! Return all indexed nodes (unordered).
+    std::vector<const qan::Node*>   nodes() const noexcept;
+
+    /*! \brief Return at most \c limit nodes whose label contains \c query (case insensitive, unordered).
+     *
+     * An empty \c query match nothing, a negative \c limit return all matches.
+     */
+    std::vector<const qan::Node*>   find(const QString& query, int limit) const noexcept;
+
+private:
+    using   Trigram = std::uint64_t;
+    //! Call \c f with every distinct trigram of case folded \c label.
+    template <class F>
+    void    forEachTrigram(const QString& folded, F f) const noexcept;
+    void    unlink(const qan::Node* node, const QString& folded) noexcept;
+    //! Forget cached previous query result (called on every modification).
+    inline void invalidateLastQuery() noexcept { _lastQuery.clear(); _lastMatches.clear(); _lastComplete = false; }
+
+    struct Entry {
+        QString     label;
+        QString     folded;
+    };
+    std::unordered_map<const qan::Node*, Entry>                 _entries;
+    std::unordered_map<Trigram, std::vector<const qan::Node*>>  _postings;
+    mutable std::vector<Trigram>                                _trigrams;
+
+    //! Previous query and its matches, \c _lastComplete is true when matches were not truncated by limit.
+    mutable QString                         _lastQuery;
+    mutable std::vector<const qan::Node*>   _lastMatches;
+    mutable bool                            _lastComplete = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -0,0 +1,635 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayeredKernel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+// GTpo headers
+#include <gtpo/utils.h>
+
+// QuickQanava headers
+#include "./qanLayeredKernel.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+constexpr auto  invalidNode = std::numeric_limits<std::uint32_t>::max();
+
+using Edge = std::pair<std::uint32_t, std::uint32_t>;
+
+//! Return \c job edges without self loops and parallel edges, edges closing a cycle during a DFS are reversed. O(n + m log m).
+std::vector<Edge>   acyclicEdges(const LayoutJob& job)
+{
+    const auto n = job.size();
+    enum : std::uint8_t { Unvisited, Visiting, Visited };
+    std::vector<std::uint8_t> state(n, Unvisited);
+    std::vector<std::pair<std::uint32_t, std::size_t>> stack;     // Node and its next out edge
+    std::vector<Edge> edges;
+    edges.reserve(job.targets.size());
+    for (std::uint32_t r = 0; r < n; ++r) {
+        if (state[r] != Unvisited)
+            continue;
+        state[r] = Visiting;
+        stack.emplace_back(r, job.offsets[r]);
+        while (!stack.empty()) {
+            auto& top = stack.back();
+            const auto s = top.first;
+            if (top.second == job.offsets[s + 1]) {
+                state[s] = Visited;
+                stack.pop_back();
+                continue;
+            }
+            const auto t = job.targets[top.second++];
+            if (t == s || t >= n)
+                continue;
+            if (state[t] == Visiting)       // Back edge
+                edges.emplace_back(t, s);
+            else {
+                edges.emplace_back(s, t);
+                if (state[t] == Unvisited) {
+                    state[t] = Visiting;
+                    stack.emplace_back(t, job.offsets[t]);
+                }
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    return edges;
+}
+
+//! Longest path layering of acyclic \c edges, sources are pulled down just above their closest successor. O(n + m).
+std::vector<int>    assignLayers(std::size_t n, const std::vector<Edge>& edges)
+{
+    std::vector<std::size_t> offsets(n + 1, 0);
+    std::vector<std::uint32_t> inDegrees(n, 0);
+    for (const auto& e : edges) {
+        ++offsets[e.first + 1];
+        ++inDegrees[e.second];
+    }
+    for (std::size_t v = 0; v < n; ++v)
+        offsets[v + 1] += offsets[v];
+    // Note: edges are sorted by source, targets are directly indexed by offsets
+    std::vector<std::uint32_t> order;      // Topological order
+    order.reserve(n);
+    auto degrees = inDegrees;
+    for (std::uint32_t v = 0; v < n; ++v)
+        if (degrees[v] == 0)
+            order.push_back(v);
+    std::vector<int> layers(n, 0);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const auto v = order[i];
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e) {
+            const auto t = edges[e].second;
+            layers[t] = std::max(layers[t], layers[v] + 1);
+            if (--degrees[t] == 0)
+                order.push_back(t);
+        }
+    }
+    for (auto o = order.crbegin(); o != order.crend(); ++o) {
+        const auto v = *o;
+        if (inDegrees[v] != 0 || offsets[v] == offsets[v + 1])
+            continue;
+        auto layer = std::numeric_limits<int>::max();
+        for (auto e = offsets[v]; e < offsets[v + 1]; ++e)
+            layer = std::min(layer, layers[edges[e].second]);
+        layers[v] = layer - 1;
+    }
+    const auto minLayer = n > 0 ? *std::min_element(layers.cbegin(), layers.cend()) : 0;
+    for (auto& layer : layers)
+        layer -= minLayer;
+    return layers;
+}
+
+//! Proper layered graph: real nodes followed by long edges dummy nodes, edges only link consecutive layers.
+struct Layering
+{
+    std::size_t                 realCount = 0;
+    std::vector<int>            layer;
+    //! Node extent along layers (width for a vertical layout), 0. for dummy nodes.
+    std::vector<double>         extent;
+    std::vector<std::uint64_t>  keys;
+    //! Neighbours in previous (up) and next (down) layer, sorted by position once order is final.
+    std::vector<std::vector<std::uint32_t>> up, down;
+    //! Nodes of every layer, in order.
+    std::vector<std::vector<std::uint32_t>> layers;
+    //! Position of node in its layer.
+    std::vector<std::uint32_t>  pos;
+
+    inline bool isDummy(std::uint32_t v) const noexcept { return v >= realCount; }
+    inline std::size_t size() const noexcept { return layer.size(); }
+
+    std::uint32_t   addNode(int l, double e, std::uint64_t key) {
+        const auto v = static_cast<std::uint32_t>(layer.size());
+        layer.push_back(l);
+        extent.push_back(e);
+        keys.push_back(key);
+        up.emplace_back();
+        down.emplace_back();
+        return v;
+    }
+    void            link(std::uint32_t s, std::uint32_t t) {
+        down[s].push_back(t);
+        up[t].push_back(s);
+    }
+    void            updatePositions(std::size_t l) {
+        const auto& nodes = layers[l];
+        for (std::size_t p = 0; p < nodes.size(); ++p)
+            pos[nodes[p]] = static_cast<std::uint32_t>(p);
+    }
+};
+
+Layering    buildLayering(const LayoutJob& job, const std::vector<double>& extents,
+                          const std::vector<Edge>& edges, const std::vector<int>& layers)
+{
+    Layering g;
+    g.realCount = job.size();
+    const auto n = job.size();
+    for (std::size_t v = 0; v < n; ++v)
+        g.addNode(layers[v], extents[v], job.keys[v]);
+    for (const auto& e : edges) {
+        auto s = e.first;
+        const auto t = e.second;
+        for (int l = layers[s] + 1; l < layers[t]; ++l) {
+            const auto key = gtpo::hash_combine(gtpo::hash_combine(gtpo::hash_combine(0, job.keys[e.first]), job.keys[t]),
+                                                static_cast<std::uint64_t>(l));
+            const auto d = g.addNode(l, 0., key);
+            g.link(s, d);
+            s = d;
+        }
+        g.link(s, t);
+    }
+    const auto layerCount = n > 0 ? *std::max_element(layers.cbegin(), layers.cend()) + 1 : 0;
+    g.layers.resize(static_cast<std::size_t>(layerCount));
+    for (std::uint32_t v = 0; v < g.size(); ++v)
+        g.layers[static_cast<std::size_t>(g.layer[v])].push_back(v);
+    g.pos.resize(g.size());
+    for (std::size_t l = 0; l < g.layers.size(); ++l)
+        g.updatePositions(l);
+    return g;
+}
+
+//! Count edge crossings between every pair of consecutive layers (Barth, Jünger and Mutzel accumulator tree).
+std::size_t countCrossings(const Layering& g)
+{
+    std::size_t crossings = 0;
+    std::vector<std::size_t> tree;
+    std::vector<std::uint32_t> lowers;
+    for (std::size_t l = 0; l + 1 < g.layers.size(); ++l) {
+        const auto lowerCount = g.layers[l + 1].size();
+        tree.assign(lowerCount + 1, 0);     // Fenwick tree of inserted lower ends positions
+        std::size_t inserted = 0;
+        for (const auto u : g.layers[l]) {
+            lowers.clear();
+            for (const auto v : g.down[u])
+                lowers.push_back(g.pos[v]);
+            std::sort(lowers.begin(), lowers.end());
+            for (const auto p : lowers) {
+                std::size_t lowerOrEqual = 0;
+                for (auto i = static_cast<std::size_t>(p) + 1; i > 0; i -= i & (~i + 1))
+                    lowerOrEqual += tree[i];
+                crossings += inserted - lowerOrEqual;
+                for (auto i = static_cast<std::size_t>(p) + 1; i <= lowerCount; i += i & (~i + 1))
+                    ++tree[i];
+                ++inserted;
+            }
+        }
+    }
+    return crossings;
+}
+
+/*! \brief Order layer \c l by barycenter of its neighbours in adjacent layer (\c up or \c down).
+ *
+ * Nodes without neighbours keep their position, ties keep actual order.
+ */
+void    orderLayer(Layering& g, std::size_t l, bool useUp)
+{
+    auto& nodes = g.layers[l];
+    std::vector<std::pair<double, std::uint32_t>> movables;
+    movables.reserve(nodes.size());
+    std::vector<bool> fixed(nodes.size(), false);
+    for (std::size_t p = 0; p < nodes.size(); ++p) {
+        const auto& neighbours = useUp ? g.up[nodes[p]] : g.down[nodes[p]];
+        if (neighbours.empty()) {
+            fixed[p] = true;
+            continue;
+        }
+        double sum = 0.;
+        for (const auto u : neighbours)
+            sum += g.pos[u];
+        movables.emplace_back(sum / neighbours.size(), nodes[p]);
+    }
+    std::stable_sort(movables.begin(), movables.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    auto movable = movables.cbegin();
+    for (std::size_t p = 0; p < nodes.size(); ++p)
+        if (!fixed[p])
+            nodes[p] = (movable++)->second;
+    g.updatePositions(l);
+}
+
+//! Initial order of incremental layout: nodes known in \c previous are sorted by their previous rank, new nodes by barycenter.
+void    restoreOrder(Layering& g, const LayeredState& previous)
+{
+    std::vector<double> ranks(g.size(), 0.);
+    for (std::size_t l = 0; l < g.layers.size(); ++l) {
+        for (const auto v : g.layers[l]) {
+            const auto entry = previous.entries.find(g.keys[v]);
+            if (entry != previous.entries.cend())
+                ranks[v] = entry->second.rank;
+            else if (l > 0 && !g.up[v].empty()) {
+                double sum = 0.;
+                for (const auto u : g.up[v])
+                    sum += (g.pos[u] + 0.5) / g.layers[l - 1].size();
+                ranks[v] = sum / g.up[v].size();
+            } else
+                ranks[v] = 2.;          // Last
+        }
+        std::stable_sort(g.layers[l].begin(), g.layers[l].end(),
+                         [&ranks](auto a, auto b) { return ranks[a] < ranks[b]; });
+        g.updatePositions(l);
+    }
+}
+
+//! Set of type 1 conflicts (non inner segment crossing an inner segment between two dummy nodes).
+class Conflicts
+{
+public:
+    void    mark(std::uint32_t u, std::uint32_t v) { _marked.insert(key(u, v)); }
+    bool    isMarked(std::uint32_t u, std::uint32_t v) const {
+        return !_marked.empty() && (_marked.count(key(u, v)) > 0 || _marked.count(key(v, u)) > 0);
+    }
+private:
+    static inline std::uint64_t key(std::uint32_t u, std::uint32_t v) noexcept {
+        return (static_cast<std::uint64_t>(u) << 32) | v;
+    }
+    std::unordered_set<std::uint64_t>   _marked;
+};
+
+//! Brandes-Köpf "Algorithm 1", mark type 1 conflicts, O(n + m).
+Conflicts   markConflicts(const Layering& g)
+{
+    Conflicts conflicts;
+    for (std::size_t l = 0; l + 1 < g.layers.size(); ++l) {
+        const auto& upper = g.layers[l];
+        const auto& lower = g.layers[l + 1];
+        if (upper.empty())
+            continue;
+        std::size_t k0 = 0;
+        std::size_t next = 0;
+        for (std::size_t l1 = 0; l1 < lower.size(); ++l1) {
+            const auto v = lower[l1];
+            const auto innerUpper = g.isDummy(v) && g.up[v].size() == 1 &&
+                                    g.isDummy(g.up[v].front()) ? g.up[v].front() : invalidNode;
+            if (l1 + 1 != lower.size() && innerUpper == invalidNode)
+                continue;
+            const std::size_t k1 = innerUpper != invalidNode ? g.pos[innerUpper] : upper.size() - 1;
+            for (; next <= l1; ++next) {
+                const auto w = lower[next];
+                for (const auto u : g.up[w])
+                    if (g.pos[u] < k0 || g.pos[u] > k1)
+                        conflicts.mark(u, w);
+            }
+            k0 = k1;
+        }
+    }
+    return conflicts;
+}
+
+/*! \brief Brandes-Köpf vertical alignment and horizontal compaction for one of the four alignment directions.
+ *
+ * Direction is transformed to leftmost/upper alignment: \c fromBottom reverse layers order, \c fromRight reverse
+ * nodes order in every layer (returned coordinates are then negated).
+ */
+std::vector<double> alignedCoordinates(const Layering& g, const Conflicts& conflicts,
+                                       bool fromBottom, bool fromRight, double nodeSpacing)
+{
+    const auto n = g.size();
+    const auto h = g.layers.size();
+    const auto tpos = [&](std::uint32_t v) -> std::size_t {
+        return fromRight ? g.layers[static_cast<std::size_t>(g.layer[v])].size() - 1 - g.pos[v] : g.pos[v];
+    };
+    const auto at = [&](std::size_t l, std::size_t p) -> std::uint32_t {
+        const auto& nodes = g.layers[l];
+        return fromRight ? nodes[nodes.size() - 1 - p] : nodes[p];
+    };
+    const auto separation = [&](std::uint32_t p, std::uint32_t w) {
+        const auto spacing = g.isDummy(p) || g.isDummy(w) ? nodeSpacing / 2. : nodeSpacing;
+        return (g.extent[p] + g.extent[w]) / 2. + spacing;
+    };
+
+    // Vertical alignment: align every node with a median upper neighbour
+    std::vector<std::uint32_t> root(n), align(n);
+    for (std::uint32_t v = 0; v < n; ++v)
+        root[v] = align[v] = v;
+    for (std::size_t li = 1; li < h; ++li) {
+        const auto l = fromBottom ? h - 1 - li : li;
+        long long r = -1;
+        for (std::size_t k = 0; k < g.layers[l].size(); ++k) {
+            const auto v = at(l, k);
+            const auto& neighbours = fromBottom ? g.down[v] : g.up[v];
+            const auto d = neighbours.size();
+            if (d == 0)
+                continue;
+            for (auto m : { (d - 1) / 2, d / 2 }) {
+                if (align[v] != v)
+                    break;
+                const auto u = neighbours[fromRight ? d - 1 - m : m];
+                const auto upos = static_cast<long long>(tpos(u));
+                if (!conflicts.isMarked(u, v) && r < upos) {
+                    align[u] = v;
+                    root[v] = root[u];
+                    align[v] = root[v];
+                    r = upos;
+                }
+            }
+        }
+    }
+
+    // Horizontal compaction: place blocks (iterative place_block()) then shift classes
+    constexpr auto undefined = std::numeric_limits<double>::lowest();
+    std::vector<double> x(n, undefined);
+    std::vector<std::uint32_t> sink(n);
+    for (std::uint32_t v = 0; v < n; ++v)
+        sink[v] = v;
+    struct Frame {
+        std::uint32_t   v, w;
+        bool            resumed;
+    };
+    std::vector<Frame> stack;
+    for (std::uint32_t start = 0; start < n; ++start) {
+        if (root[start] != start || x[start] != undefined)
+            continue;
+        x[start] = 0.;
+        stack.push_back(Frame{start, start, false});
+        while (!stack.empty()) {
+            const auto v = stack.back().v;
+            const auto w = stack.back().w;
+            const auto wpos = tpos(w);
+            if (wpos > 0) {
+                const auto p = at(static_cast<std::size_t>(g.layer[w]), wpos - 1);
+                const auto u = root[p];
+                if (!stack.back().resumed && x[u] == undefined) {
+                    stack.back().resumed = true;
+                    x[u] = 0.;
+                    stack.push_back(Frame{u, u, false});
+                    continue;
+                }
+                if (sink[v] == v)
+                    sink[v] = sink[u];
+                if (sink[v] == sink[u])
+                    x[v] = std::max(x[v], x[u] + separation(p, w));
+            }
+            auto& frame = stack.back();
+            frame.resumed = false;
+            frame.w = align[w];
+            if (frame.w == frame.v)
+                stack.pop_back();
+        }
+    }
+
+    // Class shifts: longest path on classes separation constraints, classes sorted topologically
+    std::vector<double> shift(n, 0.);
+    std::vector<std::vector<std::pair<std::uint32_t, double>>> constraints(n);
+    std::vector<std::uint32_t> inDegrees(n, 0);
+    for (std::size_t l = 0; l < h; ++l)
+        for (std::size_t k = 1; k < g.layers[l].size(); ++k) {
+            const auto p = at(l, k - 1);
+            const auto w = at(l, k);
+            const auto cp = sink[root[p]];
+            const auto cw = sink[root[w]];
+            if (cp == cw)
+                continue;
+            constraints[cp].emplace_back(cw, x[root[p]] + separation(p, w) - x[root[w]]);
+            ++inDegrees[cw];
+        }
+    std::vector<std::uint32_t> classes;
+    for (std::uint32_t c = 0; c < n; ++c)
+        if (sink[c] == c && inDegrees[c] == 0)
+            classes.push_back(c);
+    for (std::size_t i = 0; i < classes.size(); ++i) {
+        const auto c = classes[i];
+        for (const auto& constraint : constraints[c]) {
+            shift[constraint.first] = std::max(shift[constraint.first], shift[c] + constraint.second);
+            if (--inDegrees[constraint.first] == 0)
+                classes.push_back(constraint.first);
+        }
+    }
+
+    std::vector<double> coordinates(n);
+    for (std::uint32_t v = 0; v < n; ++v) {
+        const auto c = x[root[v]] + shift[sink[root[v]]];
+        coordinates[v] = fromRight ? -c : c;
+    }
+    return coordinates;
+}
+
+//! Balance the four Brandes-Köpf alignments: align them on the narrowest one and average the two median coordinates.
+std::vector<double> balancedCoordinates(const Layering& g, std::array<std::vector<double>, 4>& alignments)
+{
+    const auto n = g.size();
+    std::array<double, 4> mins, maxs;
+    std::size_t narrowest = 0;
+    for (std::size_t a = 0; a < 4; ++a) {
+        mins[a] = std::numeric_limits<double>::max();
+        maxs[a] = std::numeric_limits<double>::lowest();
+        for (std::size_t v = 0; v < n; ++v) {
+            mins[a] = std::min(mins[a], alignments[a][v] - g.extent[v] / 2.);
+            maxs[a] = std::max(maxs[a], alignments[a][v] + g.extent[v] / 2.);
+        }
+        if (maxs[a] - mins[a] < maxs[narrowest] - mins[narrowest])
+            narrowest = a;
+    }
+    for (std::size_t a = 0; a < 4; ++a) {
+        const bool fromRight = (a & 1) != 0;
+        const auto delta = fromRight ? maxs[narrowest] - maxs[a] : mins[narrowest] - mins[a];
+        for (auto& c : alignments[a])
+            c += delta;
+    }
+    std::vector<double> coordinates(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        std::array<double, 4> c{ alignments[0][v], alignments[1][v], alignments[2][v], alignments[3][v] };
+        std::sort(c.begin(), c.end());
+        coordinates[v] = (c[1] + c[2]) / 2.;
+    }
+    return coordinates;
+}
+
+} // ::qan::anonymous
+
+int     runLayered(LayoutJob& job, const LayeredParameters& parameters,
+                   const LayeredState* previous, LayeredState* state,
+                   const LayeredCallback& callback)
+{
+    const auto n = job.size();
+    if (n == 0 || job.offsets.size() < n + 1) {
+        if (state != nullptr)
+            state->entries.clear();
+        return 0;
+    }
+    // Layout is computed top to bottom, horizontal layout swap axis
+    const auto& extents = parameters.horizontal ? job.height : job.width;
+    const auto& thicknesses = parameters.horizontal ? job.width : job.height;
+
+    const auto edges = acyclicEdges(job);
+    const auto layers = assignLayers(n, edges);
+    auto g = buildLayering(job, extents, edges, layers);
+    const auto layerCount = g.layers.size();
+
+    // Node adjacency hash (order independent) and affected layers
+    std::vector<std::uint64_t> adjacencies(n, 0);
+    for (std::size_t s = 0; s < n; ++s)
+        for (auto e = job.offsets[s]; e < job.offsets[s + 1]; ++e) {
+            const auto t = job.targets[e];
+            if (t == s || t >= n)
+                continue;
+            adjacencies[s] += gtpo::hash_combine(job.keys[t], 1);
+            adjacencies[t] += gtpo::hash_combine(job.keys[s], 2);
+        }
+    const bool incremental = previous != nullptr && !previous->empty();
+    std::vector<bool> affected(layerCount, !incremental);
+    if (incremental) {
+        std::unordered_set<std::uint64_t> keys;
+        keys.reserve(g.size());
+        const auto markLayer = [&affected](int l) {
+            if (l >= 0 && static_cast<std::size_t>(l) < affected.size())
+                affected[static_cast<std::size_t>(l)] = true;
+        };
+        for (std::uint32_t v = 0; v < g.size(); ++v) {
+            keys.insert(g.keys[v]);
+            const auto entry = previous->entries.find(g.keys[v]);
+            if (entry == previous->entries.cend()) {
+                markLayer(g.layer[v]);
+                continue;
+            }
+            if (entry->second.layer != g.layer[v] ||
+                (!g.isDummy(v) && entry->second.adjacency != adjacencies[v])) {
+                markLayer(g.layer[v]);
+                markLayer(entry->second.layer);
+            }
+        }
+        for (const auto& entry : previous->entries)     // Removed nodes
+            if (keys.find(entry.first) == keys.cend())
+                markLayer(entry.second.layer);
+        restoreOrder(g, *previous);
+    }
+
+    // Crossing reduction
+    const auto orderSnapshot = [&g]() { return g.layers; };
+    auto best = orderSnapshot();
+    auto bestCrossings = countCrossings(g);
+    int sweep = 0;
+    const bool anyAffected = std::find(affected.cbegin(), affected.cend(), true) != affected.cend();
+    for (int stalled = 0; anyAffected && bestCrossings > 0 && sweep < parameters.sweeps && stalled < 4; ) {
+        ++sweep;
+        for (std::size_t l = 1; l < layerCount; ++l)
+            if (affected[l])
+                orderLayer(g, l, true);
+        for (std::size_t l = layerCount - 1; l-- > 0; )
+            if (affected[l])
+                orderLayer(g, l, false);
+        const auto crossings = countCrossings(g);
+        if (crossings < bestCrossings) {
+            bestCrossings = crossings;
+            best = orderSnapshot();
+            stalled = 0;
+        } else
+            ++stalled;
+        if (callback && !callback(sweep, bestCrossings))
+            break;
+    }
+    g.layers = std::move(best);
+    for (std::size_t l = 0; l < layerCount; ++l)
+        g.updatePositions(l);
+    for (std::uint32_t v = 0; v < g.size(); ++v) {
+        const auto byPosition = [&g](auto a, auto b) { return g.pos[a] < g.pos[b]; };
+        std::sort(g.up[v].begin(), g.up[v].end(), byPosition);
+        std::sort(g.down[v].begin(), g.down[v].end(), byPosition);
+    }
+
+    // Coordinate assignment
+    const auto conflicts = markConflicts(g);
+    std::array<std::vector<double>, 4> alignments;
+    for (std::size_t a = 0; a < 4; ++a)
+        alignments[a] = alignedCoordinates(g, conflicts, (a & 2) != 0, (a & 1) != 0, parameters.nodeSpacing);
+    const auto along = balancedCoordinates(g, alignments);
+
+    std::vector<double> layerThickness(layerCount, 0.);
+    for (std::size_t v = 0; v < n; ++v) {
+        auto& thickness = layerThickness[static_cast<std::size_t>(g.layer[v])];
+        thickness = std::max(thickness, thicknesses[v]);
+    }
+    std::vector<double> layerCenter(layerCount, 0.);
+    for (std::size_t l = 0; l < layerCount; ++l) {
+        const auto layerTop = l == 0 ? 0. : layerCenter[l - 1] + layerThickness[l - 1] / 2. + parameters.layerSpacing;
+        layerCenter[l] = layerTop + layerThickness[l] / 2.;
+    }
+
+    // Keep nodes bounding box top left corner
+    auto left = std::numeric_limits<double>::max();
+    auto top = std::numeric_limits<double>::max();
+    auto newLeft = std::numeric_limits<double>::max();
+    for (std::size_t v = 0; v < n; ++v) {
+        left = std::min(left, job.x[v] - job.width[v] / 2.);
+        top = std::min(top, job.y[v] - job.height[v] / 2.);
+        newLeft = std::min(newLeft, along[v] - extents[v] / 2.);
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        const auto a = along[v] - newLeft;
+        const auto c = layerCenter[static_cast<std::size_t>(g.layer[v])];
+        job.x[v] = left + (parameters.horizontal ? c : a);
+        job.y[v] = top + (parameters.horizontal ? a : c);
+    }
+
+    if (state != nullptr) {
+        state->entries.clear();
+        state->entries.reserve(g.size());
+        for (std::uint32_t v = 0; v < g.size(); ++v) {
+            LayeredState::Entry entry;
+            entry.layer = g.layer[v];
+            entry.rank = (g.pos[v] + 0.5) / g.layers[static_cast<std::size_t>(g.layer[v])].size();
+            entry.adjacency = g.isDummy(v) ? 0 : adjacencies[v];
+            state->entries[g.keys[v]] = entry;
+        }
+    }
+    return sweep;
+}
+
+} // ::qan
@@ -0,0 +1,105 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayeredKernel.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+// QuickQanava headers
+#include "./qanLayoutJob.h"
+
+namespace qan { // ::qan
+
+//! Parameters of qan::runLayered().
+struct LayeredParameters
+{
+    //! Space between two consecutive layers.
+    double      layerSpacing = 80.;
+    //! Minimum space between two nodes of the same layer (halved when a long edge dummy node is involved).
+    double      nodeSpacing = 40.;
+    //! Maximum number of crossing reduction sweeps (a sweep is a down and an up barycentric pass).
+    int         sweeps = 24;
+    //! Layers are laid out from left to right instead of top to bottom.
+    bool        horizontal = false;
+};
+
+/*! \brief Nodes layer and order of a layered layout, used by an incremental qan::runLayered().
+ *
+ * Entries are indexed by qan::LayoutJob::keys for nodes and by a key derived from the edge ends keys for
+ * long edges dummy nodes.
+ */
+struct LayeredState
+{
+    struct Entry {
+        int             layer = 0;
+        //! Normalized position of node in its layer (0. is first node, 1. is last node).
+        double          rank = 0.;
+        //! Hash of node in and out neighbours keys.
+        std::uint64_t   adjacency = 0;
+    };
+    std::unordered_map<std::uint64_t, Entry>    entries;
+
+    inline bool empty() const noexcept { return entries.empty(); }
+};
+
+//! Callback called after every crossing reduction sweep (with current sweep and best crossing count), return false to stop sweeping.
+using LayeredCallback = std::function<bool(int sweep, std::size_t crossings)>;
+
+/*! \brief Run a layered (Sugiyama) layout on \c job, return the number of crossing reduction sweeps.
+ *
+ * \li Cycle removal: edges closing a cycle during a DFS are reversed, self loops and parallel edges are ignored.
+ * \li Layer assignment: longest path layering, sources are then pulled down next to their successors.
+ * \li Long edges are split with dummy nodes so that every edge links two consecutive layers.
+ * \li Crossing reduction: barycentric down and up sweeps, the order with fewest crossings is kept (crossings are
+ *     counted with an accumulator tree, O(m log n) per sweep).
+ * \li Coordinate assignment: Brandes-Köpf vertical alignment and horizontal compaction in the four directions,
+ *     balanced with the average median, separation accounting for nodes \c width (or \c height when \c horizontal).
+ *
+ * Layout is translated so that nodes bounding box top left corner is kept, \c job \c x and \c y are updated in
+ * place, \c job \c mobility is ignored.
+ *
+ * When \c previous is a non empty state, layout is incremental: only layers with an added, removed or moved node,
+ * or with a node whose adjacency changed, are reordered, other layers keep their \c previous order. When \c state
+ * is not nullptr, it is set with the resulting layers and order.
+ */
+int     runLayered(LayoutJob& job, const LayeredParameters& parameters,
+                   const LayeredState* previous = nullptr, LayeredState* state = nullptr,
+                   const LayeredCallback& callback = LayeredCallback{});
+
+} // ::qan
@@ -0,0 +1,120 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayeredLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max
+
+// QuickQanava headers
+#include "./qanLayeredLayout.h"
+
+namespace qan { // ::qan
+
+/* LayeredLayout Object Management *///----------------------------------------
+LayeredLayout::LayeredLayout(QObject* parent) :
+    qan::AbstractLayout{parent}
+{
+    connect(this, &qan::AbstractLayout::finished, this, [this]() {
+        if (_pendingState)
+            _state = std::move(_pendingState);
+    });
+    connect(this, &qan::AbstractLayout::graphChanged, this, [this]() {
+        _state.reset();
+        _pendingState.reset();
+    });
+}
+
+AbstractLayout::Task    LayeredLayout::createTask()
+{
+    _pendingState = std::make_shared<qan::LayeredState>();
+    auto previous = _incremental ? _state : nullptr;
+    return [parameters = _parameters, previous = std::move(previous), state = _pendingState]
+            (qan::LayoutJob& job, qan::LayoutProgress& progress) {
+        return qan::runLayered(job, parameters, previous.get(), state.get(),
+                               [&progress](int, std::size_t) { return !progress.isCancelled(); });
+    };
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Parameters *///------------------------------------------------------
+void    LayeredLayout::setLayerSpacing(qreal layerSpacing) noexcept
+{
+    layerSpacing = std::max(0., layerSpacing);
+    if (!qFuzzyCompare(1. + layerSpacing, 1. + _parameters.layerSpacing)) {
+        _parameters.layerSpacing = layerSpacing;
+        emit layerSpacingChanged();
+    }
+}
+
+void    LayeredLayout::setNodeSpacing(qreal nodeSpacing) noexcept
+{
+    nodeSpacing = std::max(0., nodeSpacing);
+    if (!qFuzzyCompare(1. + nodeSpacing, 1. + _parameters.nodeSpacing)) {
+        _parameters.nodeSpacing = nodeSpacing;
+        emit nodeSpacingChanged();
+    }
+}
+
+void    LayeredLayout::setSweeps(int sweeps) noexcept
+{
+    sweeps = std::max(0, sweeps);
+    if (sweeps != _parameters.sweeps) {
+        _parameters.sweeps = sweeps;
+        emit sweepsChanged();
+    }
+}
+
+void    LayeredLayout::setOrientation(Qt::Orientation orientation) noexcept
+{
+    if (orientation != getOrientation()) {
+        _parameters.horizontal = orientation == Qt::Horizontal;
+        _state.reset();
+        emit orientationChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Incremental Layout *///-----------------------------------------------------
+void    LayeredLayout::setIncremental(bool incremental) noexcept
+{
+    if (incremental != _incremental) {
+        _incremental = incremental;
+        if (!_incremental)
+            _state.reset();
+        emit incrementalChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
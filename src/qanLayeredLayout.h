@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayeredLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+
+// QuickQanava headers
+#include "./qanAbstractLayout.h"
+#include "./qanLayeredKernel.h"
+
+namespace qan { // ::qan
+
+/*! \brief Layered (Sugiyama) layout of a qan::Graph computed on a worker thread, intended for DAGs and trees.
+ *
+ * Cycles are broken by reversing edges, layers are assigned using longest path layering, crossings are
+ * reduced with barycentric sweeps and coordinates are assigned using Brandes-Köpf (see qan::runLayered()).
+ *
+ * When \c incremental is true, layers and order computed by the last layout are kept: next layout only
+ * reorders layers affected by nodes or edges inserted, removed or moved since, keeping a stable drawing
+ * while a graph is edited.
+ *
+ * \code
+ * Qan.LayeredLayout {
+ *   id: layeredLayout
+ *   graph: graph
+ *   orientation: Qt.Horizontal
+ *   incremental: true
+ * }
+ * Button { text: "Layout"; onClicked: layeredLayout.start() }
+ * \endcode
+ * \nosubgrouping
+ */
+class LayeredLayout : public qan::AbstractLayout
+{
+    Q_OBJECT
+    /*! \name LayeredLayout Object Management *///-----------------------------
+    //@{
+public:
+    explicit LayeredLayout(QObject* parent = nullptr);
+    virtual ~LayeredLayout() override = default;
+    LayeredLayout(const LayeredLayout&) = delete;
+    LayeredLayout& operator=(const LayeredLayout&) = delete;
+
+protected:
+    virtual Task    createTask() override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Parameters *///-------------------------------------------
+    //@{
+public:
+    //! Space between two consecutive layers (default to 80.).
+    Q_PROPERTY(qreal layerSpacing READ getLayerSpacing WRITE setLayerSpacing NOTIFY layerSpacingChanged FINAL)
+    void            setLayerSpacing(qreal layerSpacing) noexcept;
+    inline qreal    getLayerSpacing() const noexcept { return _parameters.layerSpacing; }
+signals:
+    void            layerSpacingChanged();
+
+public:
+    //! Minimum space between two nodes in the same layer (default to 40.).
+    Q_PROPERTY(qreal nodeSpacing READ getNodeSpacing WRITE setNodeSpacing NOTIFY nodeSpacingChanged FINAL)
+    void            setNodeSpacing(qreal nodeSpacing) noexcept;
+    inline qreal    getNodeSpacing() const noexcept { return _parameters.nodeSpacing; }
+signals:
+    void            nodeSpacingChanged();
+
+public:
+    //! Maximum number of crossing reduction sweeps (default to 24).
+    Q_PROPERTY(int sweeps READ getSweeps WRITE setSweeps NOTIFY sweepsChanged FINAL)
+    void            setSweeps(int sweeps) noexcept;
+    inline int      getSweeps() const noexcept { return _parameters.sweeps; }
+signals:
+    void            sweepsChanged();
+
+public:
+    //! Qt::Vertical for top to bottom layers, Qt::Horizontal for left to right layers (default to Qt::Vertical).
+    Q_PROPERTY(Qt::Orientation orientation READ getOrientation WRITE setOrientation NOTIFY orientationChanged FINAL)
+    void            setOrientation(Qt::Orientation orientation) noexcept;
+    inline Qt::Orientation  getOrientation() const noexcept { return _parameters.horizontal ? Qt::Horizontal : Qt::Vertical; }
+signals:
+    void            orientationChanged();
+
+private:
+    qan::LayeredParameters  _parameters;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Incremental Layout *///------------------------------------------
+    //@{
+public:
+    /*! \brief Reuse last layout layers and order, only reorder layers affected by a graph modification (default to false).
+     *
+     * Setting \c incremental to false (or changing \c graph or \c orientation) forget last layout.
+     */
+    Q_PROPERTY(bool incremental READ getIncremental WRITE setIncremental NOTIFY incrementalChanged FINAL)
+    void            setIncremental(bool incremental) noexcept;
+    inline bool     getIncremental() const noexcept { return _incremental; }
+private:
+    bool            _incremental = false;
+signals:
+    void            incrementalChanged();
+
+private:
+    //! Result of last finished layout.
+    std::shared_ptr<const qan::LayeredState>    _state;
+    //! Result of actually running layout, adopted as \c _state when layout finish.
+    std::shared_ptr<qan::LayeredState>          _pendingState;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::LayeredLayout)
@@ -0,0 +1,214 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayoutCache.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>    // std::lower_bound std::stable_sort
+#include <cstring>      // std::memcmp std::memcpy
+
+// Qt headers
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QUrl>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanLayoutCache.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+static const char   cacheMagic[8] = {'Q', 'A', 'N', 'L', 'Y', 'C', '0', '1'};
+
+QString toLocalFilePath(const QString& filePath)
+{
+    const QUrl url{filePath};
+    return url.isLocalFile() ? url.toLocalFile() : filePath;
+}
+
+} // ::qan::anonymous
+
+/* LayoutCache Object Management *///------------------------------------------
+LayoutCache::LayoutCache(QObject* parent) :
+    QObject{parent}
+{
+    static_assert(sizeof(Entry) == 32, "qan::LayoutCache::Entry must be packed in 32 bytes.");
+}
+
+LayoutCache::~LayoutCache()
+{
+    close();
+}
+
+void    LayoutCache::setFilePath(QString filePath) noexcept
+{
+    if (filePath != _filePath) {
+        close();
+        _filePath = filePath;
+        open();
+        emit filePathChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Cache Management *///-------------------------------------------------------
+bool    LayoutCache::lookup(std::uint64_t fingerprint, std::uint64_t key, QPointF& center, bool& exact) const noexcept
+{
+    exact = false;
+    if (_data == nullptr ||
+        _count == 0)
+        return false;
+    const auto first = entries();
+    const auto last = first + _count;
+    auto entry = std::lower_bound(first, last, key, [](const Entry& e, std::uint64_t k) { return e.key < k; });
+    if (entry == last ||
+        entry->key != key)
+        return false;
+    center = QPointF{entry->x, entry->y};   // Default to most recent entry
+    for (; entry != last && entry->key == key; ++entry) {
+        if (entry->fingerprint == fingerprint) {
+            center = QPointF{entry->x, entry->y};
+            exact = true;
+            break;
+        }
+    }
+    return true;
+}
+
+bool    LayoutCache::store(std::vector<Entry> entries) noexcept
+{
+    if (_filePath.isEmpty())
+        return false;
+    try {
+        // New entries come first: after a stable sort by key, they precede older entries with the same key
+        std::vector<Entry> merged = std::move(entries);
+        merged.reserve(merged.size() + static_cast<std::size_t>(_count));
+        if (_data != nullptr)
+            merged.insert(merged.end(), this->entries(), this->entries() + _count);
+        std::stable_sort(merged.begin(), merged.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+        std::vector<Entry> unique;
+        unique.reserve(merged.size());
+        std::size_t keyCount = 0;
+        for (const auto& entry : merged) {
+            if (!unique.empty() && unique.back().key == entry.key) {
+                if (keyCount >= maxEntriesPerKey)
+                    continue;
+                bool duplicate = false;
+                for (auto e = unique.rbegin(); e != unique.rbegin() + static_cast<std::ptrdiff_t>(keyCount); ++e)
+                    duplicate = duplicate || e->fingerprint == entry.fingerprint;
+                if (duplicate)
+                    continue;
+            } else
+                keyCount = 0;
+            unique.push_back(entry);
+            ++keyCount;
+        }
+
+        close();    // Note: a mapped file can't be replaced on some platforms
+        QSaveFile file{toLocalFilePath(_filePath)};
+        if (!file.open(QIODevice::WriteOnly)) {
+            qWarning() << "qan::LayoutCache::store(): Error: Can't open cache file " << file.fileName();
+            open();
+            return false;
+        }
+        const std::uint64_t count = unique.size();
+        file.write(cacheMagic, sizeof(cacheMagic));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        file.write(reinterpret_cast<const char*>(unique.data()), static_cast<qint64>(unique.size() * sizeof(Entry)));
+        if (!file.commit()) {
+            qWarning() << "qan::LayoutCache::store(): Error: Can't write cache file " << file.fileName();
+            open();
+            return false;
+        }
+    } catch (const std::bad_alloc&) {
+        qWarning() << "qan::LayoutCache::store(): Error: Out of memory.";
+        return false;
+    }
+    return open();
+}
+
+void    LayoutCache::clear() noexcept
+{
+    close();
+    if (!_filePath.isEmpty())
+        QFile::remove(toLocalFilePath(_filePath));
+    setCount(0);
+}
+
+bool    LayoutCache::open() noexcept
+{
+    close();
+    if (_filePath.isEmpty())
+        return false;
+    _file.setFileName(toLocalFilePath(_filePath));
+    if (!_file.exists() ||
+        !_file.open(QIODevice::ReadOnly))
+        return false;
+    const auto size = _file.size();
+    const uchar* data = size >= static_cast<qint64>(headerSize) ? _file.map(0, size) : nullptr;
+    std::uint64_t count = 0;
+    if (data != nullptr)
+        std::memcpy(&count, data + sizeof(cacheMagic), sizeof(count));
+    if (data == nullptr ||
+        std::memcmp(data, cacheMagic, sizeof(cacheMagic)) != 0 ||
+        static_cast<std::uint64_t>(size - static_cast<qint64>(headerSize)) != count * sizeof(Entry)) {
+        qWarning() << "qan::LayoutCache::open(): Error: Invalid cache file " << _file.fileName();
+        close();
+        return false;
+    }
+    _data = data;
+    setCount(count);
+    return true;
+}
+
+void    LayoutCache::close() noexcept
+{
+    if (_data != nullptr)
+        _file.unmap(const_cast<uchar*>(_data));
+    _data = nullptr;
+    if (_file.isOpen())
+        _file.close();
+    setCount(0);
+}
+
+void    LayoutCache::setCount(std::uint64_t count) noexcept
+{
+    if (count != _count) {
+        _count = count;
+        emit entryCountChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,148 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayoutCache.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointF>
+#include <QString>
+#include <QFile>
+
+namespace qan { // ::qan
+
+/*! \brief Persistent node positions cache keyed by graph structural fingerprint and a per node structural key.
+ *
+ * A layout with a cache (see qan::AbstractLayout::cache) first looks up its nodes positions in cache: when graph
+ * fingerprint (see qan::Graph::getFingerprint()) and all nodes are found, cached positions are applied without
+ * running the layout task, otherwise cached nodes are pinned at their cached position and only new nodes are
+ * laid out. Final layout positions are stored back in cache.
+ *
+ * Cache file is memory mapped, a lookup is a binary search in mapped entries: opening a large cache does not
+ * read it. At most 4 fingerprints (most recent first) are kept per node key.
+ *
+ * \code
+ * Qan.ForceDirectedLayout {
+ *   graph: graphView.graph
+ *   cache: Qan.LayoutCache { filePath: "file:///tmp/graph.qlc" }
+ * }
+ * \endcode
+ *
+ * \note Entries are stored in host byte order, cache files are not portable across architectures.
+ * \nosubgrouping
+ */
+class LayoutCache : public QObject
+{
+    /*! \name LayoutCache Object Management *///-------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit LayoutCache(QObject* parent = nullptr);
+    virtual ~LayoutCache() override;
+    LayoutCache(const LayoutCache&) = delete;
+
+public:
+    //! Cache file path (or local file url), file is created on first store().
+    Q_PROPERTY(QString filePath READ getFilePath WRITE setFilePath NOTIFY filePathChanged FINAL)
+    //! \copydoc filePath
+    inline QString      getFilePath() const noexcept { return _filePath; }
+    //! \copydoc filePath
+    void                setFilePath(QString filePath) noexcept;
+private:
+    QString             _filePath;
+signals:
+    void                filePathChanged();
+
+public:
+    //! Number of (node key, fingerprint) entries in cache.
+    Q_PROPERTY(int entryCount READ getEntryCount NOTIFY entryCountChanged FINAL)
+    //! \copydoc entryCount
+    inline int          getEntryCount() const noexcept { return static_cast<int>(_count); }
+signals:
+    void                entryCountChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Cache Management *///--------------------------------------------
+    //@{
+public:
+    //! Cached node center position.
+    struct Entry {
+        std::uint64_t   key = 0;
+        std::uint64_t   fingerprint = 0;
+        double          x = 0.;
+        double          y = 0.;
+    };
+
+    /*! \brief Lookup node \c key position, return false if \c key is not cached.
+     *
+     * \c exact is set to true when \c key has been cached for graph \c fingerprint, otherwise most recent
+     * cached position is returned.
+     */
+    bool                lookup(std::uint64_t fingerprint, std::uint64_t key, QPointF& center, bool& exact) const noexcept;
+
+    //! Store node \c entries (replacing entries with the same key and fingerprint) and rewrite cache file, O(n log(n)).
+    bool                store(std::vector<Entry> entries) noexcept;
+
+    //! Remove all cached entries and cache file.
+    Q_INVOKABLE void    clear() noexcept;
+
+private:
+    //! Map actual file path, return false if file does not exist or is not a valid cache.
+    bool                open() noexcept;
+    void                close() noexcept;
+    //! Set mapped entries count.
+    void                setCount(std::uint64_t count) noexcept;
+
+    QFile               _file;
+    const uchar*        _data = nullptr;
+    std::uint64_t       _count = 0;
+    //! Mapped entries sorted by key, most recent fingerprint first for a given key.
+    inline const Entry* entries() const noexcept { return reinterpret_cast<const Entry*>(_data + headerSize); }
+
+    //! File header: 8 bytes magic and 64 bits entry count.
+    static constexpr std::size_t    headerSize = 16;
+    static constexpr std::size_t    maxEntriesPerKey = 4;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::LayoutCache)
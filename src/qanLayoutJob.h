@@ -0,0 +1,75 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayoutJob.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace qan { // ::qan
+
+/*! \brief Thread independent input and output of a layout task (see qan::AbstractLayout::createTask()).
+ *
+ * Laid out nodes are indexed from 0 to size() - 1, every per node array has size() elements.
+ *
+ * A hierarchical job (see isHierarchical()) also contains grouped nodes: \c parents and \c containers are
+ * set, grouped nodes coordinates are relative to their group container.
+ */
+struct LayoutJob
+{
+    //! Node center, input is actual node position, task should update it in place.
+    std::vector<double>         x, y;
+    //! Node size.
+    std::vector<double>         width, height;
+    //! 1.0 for a free node, 0.0 for a pinned node (node with a non draggable item).
+    std::vector<double>         mobility;
+    //! Node identity, stable across layout runs (could be used to reuse a previous layout result).
+    std::vector<std::uint64_t>  keys;
+    //! Directed adjacency: out nodes of node \c i are <tt>targets[offsets[i]]</tt> to <tt>targets[offsets[i + 1]]</tt>.
+    std::vector<std::size_t>    offsets;
+    std::vector<std::uint32_t>  targets;
+
+    //! Index of node group in job, -1 for a top level node (hierarchical job only).
+    std::vector<std::int32_t>   parents;
+    //! 1 for a group whose content is laid out: its input size is its minimum size, task should set its final size.
+    std::vector<std::uint8_t>   containers;
+
+    inline auto size() const noexcept -> std::size_t { return x.size(); }
+    inline auto isHierarchical() const noexcept -> bool { return !parents.empty(); }
+};
+
+} // ::qan
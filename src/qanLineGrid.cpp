@@ -40,6 +40,7 @@
 
 // QuickQanava headers
 #include "./qanLineGrid.h"
+#include "./qanTrace.h"
 
 namespace qan {  // ::qan
 
@@ -107,6 +108,7 @@ bool    LineGrid::updateGrid(const QRectF& viewRect,
                              const QQuickItem& container,
                              const QQuickItem& navigable) noexcept
 {
+    QAN_TRACE_SCOPE("LineGrid::updateGrid");
     // PRECONDITIONS:
         // Base implementation should return true
         // gridShape property should have been set
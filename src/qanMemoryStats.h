@@ -0,0 +1,97 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanMemoryStats.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Qt headers
+#include <QtGlobal>
+#include <QVariantMap>
+
+namespace qan { // ::qan
+
+/*! \brief Estimated memory footprint of a graph primitives, topology and items (see qan::Graph::memoryStats()).
+ *
+ * Bytes are a lower bound computed from C++ object sizes and container capacities: Qt private objects
+ * (QObjectPrivate, QQuickItemPrivate), QML bindings, connections and scene graph nodes are not accounted.
+ * Measured per element costs (all allocations included) are reported by \c qan_benchmarks BM_memory_* benchmarks.
+ */
+struct MemoryStats
+{
+    int     nodeCount = 0;
+    int     edgeCount = 0;
+    int     groupCount = 0;
+
+    //! Number of existing node, edge and group items (less than primitives count in a virtualized or headless graph).
+    int     nodeItemCount = 0;
+    int     edgeItemCount = 0;
+    int     groupItemCount = 0;
+    //! Total number of QQuickItem in primitives items trees (delegates content included).
+    int     quickItemCount = 0;
+    //! Number of pooled (recycled) items.
+    int     pooledItemCount = 0;
+    //! Number of created qcm container models (in/out nodes and edges, graph and selection models).
+    int     modelCount = 0;
+
+    //! Node, edge and group objects with their adjacency containers (and graph containers references).
+    qint64  nodeBytes = 0;
+    qint64  edgeBytes = 0;
+    qint64  groupBytes = 0;
+    //! Primitives items and their QQuickItem sub trees.
+    qint64  itemBytes = 0;
+    //! Created container models.
+    qint64  modelBytes = 0;
+
+    inline qint64   totalBytes() const noexcept { return nodeBytes + edgeBytes + groupBytes + itemBytes + modelBytes; }
+
+    //! Return stats as a QML friendly map (keys are member names, plus \c totalBytes).
+    inline QVariantMap  toVariantMap() const {
+        return QVariantMap{ { QStringLiteral("nodeCount"),      nodeCount },
+                            { QStringLiteral("edgeCount"),      edgeCount },
+                            { QStringLiteral("groupCount"),     groupCount },
+                            { QStringLiteral("nodeItemCount"),  nodeItemCount },
+                            { QStringLiteral("edgeItemCount"),  edgeItemCount },
+                            { QStringLiteral("groupItemCount"), groupItemCount },
+                            { QStringLiteral("quickItemCount"), quickItemCount },
+                            { QStringLiteral("pooledItemCount"), pooledItemCount },
+                            { QStringLiteral("modelCount"),     modelCount },
+                            { QStringLiteral("nodeBytes"),      nodeBytes },
+                            { QStringLiteral("edgeBytes"),      edgeBytes },
+                            { QStringLiteral("groupBytes"),     groupBytes },
+                            { QStringLiteral("itemBytes"),      itemBytes },
+                            { QStringLiteral("modelBytes"),     modelBytes },
+                            { QStringLiteral("totalBytes"),     totalBytes() } };
+    }
+};
+
+} // ::qan
@@ -0,0 +1,370 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanModelGraphAdapter.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// QuickQanava headers
+#include "./qanModelGraphAdapter.h"
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+/* ModelGraphAdapter Object Management *///------------------------------------
+ModelGraphAdapter::ModelGraphAdapter(QObject* parent) :
+    QObject{parent}
+{
+    connect(this, &ModelGraphAdapter::rolesChanged, this, &ModelGraphAdapter::synchronize);
+}
+
+void    ModelGraphAdapter::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    _graph = graph;
+    _nodeIds.clear();       // Note: primitives inserted in previous graph are left untouched
+    _edgeIds.clear();
+    _pendingEdges.clear();
+    synchronize();
+    emit graphChanged();
+}
+
+void    ModelGraphAdapter::setNodeModel(QAbstractItemModel* nodeModel) noexcept
+{
+    if (nodeModel == _nodeModel)
+        return;
+    if (_nodeModel)
+        disconnect(_nodeModel, nullptr, this, nullptr);
+    _nodeModel = nodeModel;
+    if (_nodeModel) {
+        connect(_nodeModel, &QAbstractItemModel::rowsInserted,
+                this, [this](const QModelIndex& parent, int first, int last) {
+            if (!parent.isValid()) {
+                updateNodes(first, last);
+                resolvePendingEdges();
+                emit synchronized();
+            }
+        });
+        connect(_nodeModel, &QAbstractItemModel::rowsAboutToBeRemoved,
+                this, [this](const QModelIndex& parent, int first, int last) {
+            if (!parent.isValid()) {
+                removeNodes(first, last);
+                emit synchronized();
+            }
+        });
+        connect(_nodeModel, &QAbstractItemModel::dataChanged,
+                this, [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles) {
+            if (topLeft.parent().isValid())
+                return;
+            if (roles.contains(_nodeRoles.id))  // Rows id changed, re-synchronize
+                synchronize();
+            else {
+                updateNodes(topLeft.row(), bottomRight.row(), roles);
+                emit synchronized();
+            }
+        });
+        connect(_nodeModel, &QAbstractItemModel::modelReset, this, &ModelGraphAdapter::synchronize);
+        connect(_nodeModel, &QAbstractItemModel::layoutChanged, this, &ModelGraphAdapter::synchronize);
+    }
+    synchronize();
+    emit nodeModelChanged();
+}
+
+void    ModelGraphAdapter::setEdgeModel(QAbstractItemModel* edgeModel) noexcept
+{
+    if (edgeModel == _edgeModel)
+        return;
+    if (_edgeModel)
+        disconnect(_edgeModel, nullptr, this, nullptr);
+    _edgeModel = edgeModel;
+    if (_edgeModel) {
+        connect(_edgeModel, &QAbstractItemModel::rowsInserted,
+                this, [this](const QModelIndex& parent, int first, int last) {
+            if (!parent.isValid()) {
+                updateEdges(first, last);
+                emit synchronized();
+            }
+        });
+        connect(_edgeModel, &QAbstractItemModel::rowsAboutToBeRemoved,
+                this, [this](const QModelIndex& parent, int first, int last) {
+            if (!parent.isValid()) {
+                removeEdges(first, last);
+                emit synchronized();
+            }
+        });
+        connect(_edgeModel, &QAbstractItemModel::dataChanged,
+                this, [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles) {
+            if (topLeft.parent().isValid())
+                return;
+            if (roles.contains(_edgeRoles.id))  // Rows id changed, re-synchronize
+                synchronize();
+            else {
+                updateEdges(topLeft.row(), bottomRight.row(), roles);
+                emit synchronized();
+            }
+        });
+        connect(_edgeModel, &QAbstractItemModel::modelReset, this, &ModelGraphAdapter::synchronize);
+        connect(_edgeModel, &QAbstractItemModel::layoutChanged, this, &ModelGraphAdapter::synchronize);
+    }
+    synchronize();
+    emit edgeModelChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Synchronization *///--------------------------------------------------------
+int     ModelGraphAdapter::roleForName(const QAbstractItemModel& model, const QString& name) noexcept
+{
+    if (name.isEmpty())
+        return -1;
+    const auto roleName = name.toUtf8();
+    const auto roleNames = model.roleNames();
+    for (auto role = roleNames.cbegin(); role != roleNames.cend(); ++role)
+        if (role.value() == roleName)
+            return role.key();
+    return -1;
+}
+
+void    ModelGraphAdapter::resolveRoles() noexcept
+{
+    _nodeRoles = NodeRoles{};
+    if (_nodeModel) {
+        _nodeRoles.id = roleForName(*_nodeModel, _nodeIdRole);
+        _nodeRoles.label = roleForName(*_nodeModel, _nodeLabelRole);
+        _nodeRoles.x = roleForName(*_nodeModel, _nodeXRole);
+        _nodeRoles.y = roleForName(*_nodeModel, _nodeYRole);
+    }
+    _edgeRoles = EdgeRoles{};
+    if (_edgeModel) {
+        _edgeRoles.id = roleForName(*_edgeModel, _edgeIdRole);
+        _edgeRoles.src = roleForName(*_edgeModel, _edgeSourceRole);
+        _edgeRoles.dst = roleForName(*_edgeModel, _edgeDestinationRole);
+        _edgeRoles.label = roleForName(*_edgeModel, _edgeLabelRole);
+    }
+}
+
+void    ModelGraphAdapter::synchronize() noexcept
+{
+    resolveRoles();
+    if (!_graph)
+        return;
+    QAN_TRACE_SCOPE("ModelGraphAdapter::synchronize");
+    _graph->beginUpdate();
+    // 1. Remove nodes and edges that are no longer in models
+    QSet<QString> edgeIds;
+    const auto edgeCount = _edgeModel && _edgeRoles.id >= 0 ? _edgeModel->rowCount() : 0;
+    for (int row = 0; row < edgeCount; row++)
+        edgeIds.insert(_edgeModel->data(_edgeModel->index(row, 0), _edgeRoles.id).toString());
+    for (const auto& id : _edgeIds - edgeIds) {
+        _edgeIds.remove(id);
+        _graph->removeEdge(_graph->edgeById(id));
+    }
+    for (auto pending = _pendingEdges.begin(); pending != _pendingEdges.end(); ) {
+        if (edgeIds.contains(pending.key()))
+            ++pending;
+        else
+            pending = _pendingEdges.erase(pending);
+    }
+
+    QSet<QString> nodeIds;
+    const auto nodeCount = _nodeModel && _nodeRoles.id >= 0 ? _nodeModel->rowCount() : 0;
+    for (int row = 0; row < nodeCount; row++)
+        nodeIds.insert(_nodeModel->data(_nodeModel->index(row, 0), _nodeRoles.id).toString());
+    for (const auto& id : _nodeIds - nodeIds)
+        removeNode(id);
+
+    // 2. Insert or update nodes, then edges
+    if (nodeCount > 0)
+        updateNodes(0, nodeCount - 1);
+    if (edgeCount > 0)
+        updateEdges(0, edgeCount - 1);
+    resolvePendingEdges();
+    _graph->endUpdate();
+    emit synchronized();
+}
+
+void    ModelGraphAdapter::updateNodes(int first, int last, const QVector<int>& roles) noexcept
+{
+    if (!_graph ||
+        !_nodeModel ||
+        _nodeRoles.id < 0)
+        return;
+    const auto changed = [&roles](int role) { return role >= 0 && (roles.isEmpty() || roles.contains(role)); };
+    const bool labelChanged = changed(_nodeRoles.label);
+    const bool positionChanged = changed(_nodeRoles.x) || changed(_nodeRoles.y);
+    if (!roles.isEmpty() &&
+        !labelChanged &&
+        !positionChanged)
+        return;
+    _graph->beginUpdate();
+    for (int row = first; row <= last; row++) {
+        const auto index = _nodeModel->index(row, 0);
+        const auto id = _nodeModel->data(index, _nodeRoles.id).toString();
+        if (id.isEmpty())
+            continue;
+        auto node = _graph->nodeById(id);
+        if (node == nullptr) {
+            node = _graph->insertNode(id);
+            if (node == nullptr)
+                continue;
+            _nodeIds.insert(id);
+        }
+        if (labelChanged)
+            node->setLabel(_nodeModel->data(index, _nodeRoles.label).toString());
+        if (positionChanged) {
+            const auto geometry = node->getGeometry();
+            const auto x = _nodeRoles.x >= 0 ? _nodeModel->data(index, _nodeRoles.x).toReal() : geometry.x();
+            const auto y = _nodeRoles.y >= 0 ? _nodeModel->data(index, _nodeRoles.y).toReal() : geometry.y();
+            if (!qFuzzyCompare(1. + x, 1. + geometry.x()) ||
+                !qFuzzyCompare(1. + y, 1. + geometry.y()))
+                node->setGeometry(QRectF{QPointF{x, y}, geometry.size()});
+        }
+    }
+    _graph->endUpdate();
+}
+
+void    ModelGraphAdapter::removeNodes(int first, int last) noexcept
+{
+    if (!_graph ||
+        !_nodeModel ||
+        _nodeRoles.id < 0)
+        return;
+    _graph->beginUpdate();
+    for (int row = first; row <= last; row++)
+        removeNode(_nodeModel->data(_nodeModel->index(row, 0), _nodeRoles.id).toString());
+    _graph->endUpdate();
+}
+
+void    ModelGraphAdapter::removeNode(const QString& id) noexcept
+{
+    if (!_nodeIds.remove(id))
+        return;
+    const auto node = _graph->nodeById(id);
+    if (node == nullptr)
+        return;
+    // Adjacent edges are removed with node, keep them pending until node is inserted again
+    node->forEachAdjacentEdge0([this](qan::Edge* edge) {
+        if (edge == nullptr)
+            return;
+        const auto edgeId = _graph->getPrimitiveId(edge);
+        if (!_edgeIds.remove(edgeId))
+            return;
+        _pendingEdges.insert(edgeId, PendingEdge{_graph->getPrimitiveId(edge->getSource()),
+                                                 _graph->getPrimitiveId(edge->getDestination()),
+                                                 edge->getLabel()});
+    });
+    _graph->removeNode(node);
+}
+
+void    ModelGraphAdapter::updateEdges(int first, int last, const QVector<int>& roles) noexcept
+{
+    if (!_graph ||
+        !_edgeModel ||
+        _edgeRoles.id < 0 ||
+        _edgeRoles.src < 0 ||
+        _edgeRoles.dst < 0)
+        return;
+    const auto changed = [&roles](int role) { return role >= 0 && (roles.isEmpty() || roles.contains(role)); };
+    const bool labelChanged = changed(_edgeRoles.label);
+    const bool endsChanged = changed(_edgeRoles.src) || changed(_edgeRoles.dst);
+    if (!roles.isEmpty() &&
+        !labelChanged &&
+        !endsChanged)
+        return;
+    _graph->beginUpdate();
+    for (int row = first; row <= last; row++) {
+        const auto index = _edgeModel->index(row, 0);
+        const auto id = _edgeModel->data(index, _edgeRoles.id).toString();
+        if (id.isEmpty())
+            continue;
+        const auto srcId = _edgeModel->data(index, _edgeRoles.src).toString();
+        const auto dstId = _edgeModel->data(index, _edgeRoles.dst).toString();
+        const auto label = _edgeRoles.label >= 0 ? _edgeModel->data(index, _edgeRoles.label) : QVariant{};
+        const auto edge = _edgeIds.contains(id) ? _graph->edgeById(id) : nullptr;
+        if (edge != nullptr &&
+            _graph->getPrimitiveId(edge->getSource()) == srcId &&
+            _graph->getPrimitiveId(edge->getDestination()) == dstId) {
+            if (labelChanged)
+                edge->setLabel(label.toString());
+        } else if (!connectEdge(id, srcId, dstId, label))
+            _pendingEdges.insert(id, PendingEdge{srcId, dstId, label});
+    }
+    _graph->endUpdate();
+}
+
+void    ModelGraphAdapter::removeEdges(int first, int last) noexcept
+{
+    if (!_graph ||
+        !_edgeModel ||
+        _edgeRoles.id < 0)
+        return;
+    _graph->beginUpdate();
+    for (int row = first; row <= last; row++) {
+        const auto id = _edgeModel->data(_edgeModel->index(row, 0), _edgeRoles.id).toString();
+        _pendingEdges.remove(id);
+        if (_edgeIds.remove(id))
+            _graph->removeEdge(_graph->edgeById(id));
+    }
+    _graph->endUpdate();
+}
+
+void    ModelGraphAdapter::resolvePendingEdges() noexcept
+{
+    if (!_graph ||
+        _pendingEdges.isEmpty())
+        return;
+    const auto pendingEdges = _pendingEdges;
+    _graph->beginUpdate();
+    for (auto pending = pendingEdges.cbegin(); pending != pendingEdges.cend(); ++pending)
+        connectEdge(pending.key(), pending->srcId, pending->dstId, pending->label);
+    _graph->endUpdate();
+}
+
+bool    ModelGraphAdapter::connectEdge(const QString& id, const QString& srcId, const QString& dstId, const QVariant& label) noexcept
+{
+    if (_edgeIds.remove(id))    // Reconnect an existing edge
+        _graph->removeEdge(_graph->edgeById(id));
+    const auto src = _graph->nodeById(srcId);
+    const auto dst = _graph->nodeById(dstId);
+    if (src == nullptr ||
+        dst == nullptr)
+        return false;
+    const auto edge = _graph->insertEdge(id, src, dst);
+    if (edge == nullptr)
+        return false;
+    _edgeIds.insert(id);
+    _pendingEdges.remove(id);
+    if (label.isValid())
+        edge->setLabel(label.toString());
+    return true;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,208 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanModelGraphAdapter.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QSet>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Bind a node model and an edge model (any QAbstractItemModel list) to a qan::Graph.
+ *
+ * Model rows are mapped to graph primitives with role names: a node row has an id, and optionally a label
+ * and a position, an edge row has an id, a source node id, a destination node id and optionally a label.
+ * Graph is updated incrementally, in a batched update scope (see qan::Graph::beginUpdate()):
+ * \li \c rowsInserted() insert new primitives.
+ * \li \c rowsAboutToBeRemoved() remove primitives.
+ * \li \c dataChanged() update label and position, or reconnect an edge when its source or destination changes.
+ * \li \c modelReset() and \c layoutChanged() trigger a full synchronization (existing primitives are reused).
+ *
+ * Primitives are indexed with their model id in graph external id index (see qan::Graph::nodeById()).
+ * \code
+ * Qan.ModelGraphAdapter {
+ *   graph: graphView.graph
+ *   nodeModel: servicesModel     // Roles: "id", "label", "x", "y"
+ *   edgeModel: linksModel        // Roles: "id", "source", "destination", "label"
+ *   edgeSourceRole: "from"; edgeDestinationRole: "to"
+ * }
+ * \endcode
+ * \note Only model rows are mapped (hierarchical models children are ignored), edges referencing a node id that is not
+ * (yet) in node model are inserted once node is inserted.
+ * \nosubgrouping
+ */
+class ModelGraphAdapter : public QObject
+{
+    Q_OBJECT
+    /*! \name ModelGraphAdapter Object Management *///-------------------------
+    //@{
+public:
+    explicit ModelGraphAdapter(QObject* parent = nullptr);
+    virtual ~ModelGraphAdapter() override = default;
+    ModelGraphAdapter(const ModelGraphAdapter&) = delete;
+    ModelGraphAdapter& operator=(const ModelGraphAdapter&) = delete;
+
+public:
+    //! Synchronized graph.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    inline qan::Graph*      getGraph() const noexcept { return _graph.data(); }
+    void                    setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                    graphChanged();
+
+public:
+    //! Node model, one node is inserted per row.
+    Q_PROPERTY(QAbstractItemModel* nodeModel READ getNodeModel WRITE setNodeModel NOTIFY nodeModelChanged FINAL)
+    inline QAbstractItemModel*  getNodeModel() const noexcept { return _nodeModel.data(); }
+    void                    setNodeModel(QAbstractItemModel* nodeModel) noexcept;
+private:
+    QPointer<QAbstractItemModel>    _nodeModel;
+signals:
+    void                    nodeModelChanged();
+
+public:
+    //! Edge model, one edge is inserted per row.
+    Q_PROPERTY(QAbstractItemModel* edgeModel READ getEdgeModel WRITE setEdgeModel NOTIFY edgeModelChanged FINAL)
+    inline QAbstractItemModel*  getEdgeModel() const noexcept { return _edgeModel.data(); }
+    void                    setEdgeModel(QAbstractItemModel* edgeModel) noexcept;
+private:
+    QPointer<QAbstractItemModel>    _edgeModel;
+signals:
+    void                    edgeModelChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Role Mapping *///------------------------------------------------
+    //@{
+public:
+    //! Node model id role name (default to "id").
+    Q_PROPERTY(QString nodeIdRole MEMBER _nodeIdRole NOTIFY rolesChanged FINAL)
+    //! Node model label role name (default to "label", optional).
+    Q_PROPERTY(QString nodeLabelRole MEMBER _nodeLabelRole NOTIFY rolesChanged FINAL)
+    //! Node model x position role name (default to "x", optional).
+    Q_PROPERTY(QString nodeXRole MEMBER _nodeXRole NOTIFY rolesChanged FINAL)
+    //! Node model y position role name (default to "y", optional).
+    Q_PROPERTY(QString nodeYRole MEMBER _nodeYRole NOTIFY rolesChanged FINAL)
+    //! Edge model id role name (default to "id").
+    Q_PROPERTY(QString edgeIdRole MEMBER _edgeIdRole NOTIFY rolesChanged FINAL)
+    //! Edge model source node id role name (default to "source").
+    Q_PROPERTY(QString edgeSourceRole MEMBER _edgeSourceRole NOTIFY rolesChanged FINAL)
+    //! Edge model destination node id role name (default to "destination").
+    Q_PROPERTY(QString edgeDestinationRole MEMBER _edgeDestinationRole NOTIFY rolesChanged FINAL)
+    //! Edge model label role name (default to "label", optional).
+    Q_PROPERTY(QString edgeLabelRole MEMBER _edgeLabelRole NOTIFY rolesChanged FINAL)
+private:
+    QString                 _nodeIdRole = QStringLiteral("id");
+    QString                 _nodeLabelRole = QStringLiteral("label");
+    QString                 _nodeXRole = QStringLiteral("x");
+    QString                 _nodeYRole = QStringLiteral("y");
+    QString                 _edgeIdRole = QStringLiteral("id");
+    QString                 _edgeSourceRole = QStringLiteral("source");
+    QString                 _edgeDestinationRole = QStringLiteral("destination");
+    QString                 _edgeLabelRole = QStringLiteral("label");
+signals:
+    //! Emitted when a role mapping change (graph is fully synchronized).
+    void                    rolesChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Synchronization *///---------------------------------------------
+    //@{
+public:
+    //! Full synchronization of graph with node and edge models (usually called automatically).
+    Q_INVOKABLE void        synchronize() noexcept;
+
+signals:
+    //! Emitted after a model change has been applied to graph.
+    void                    synchronized();
+
+private:
+    //! Resolved model role numbers (-1 for an unmapped role).
+    struct NodeRoles {
+        int id = -1;
+        int label = -1;
+        int x = -1;
+        int y = -1;
+    };
+    struct EdgeRoles {
+        int id = -1;
+        int src = -1;
+        int dst = -1;
+        int label = -1;
+    };
+    static int              roleForName(const QAbstractItemModel& model, const QString& name) noexcept;
+    void                    resolveRoles() noexcept;
+
+    //! Insert or update nodes for node model rows \c first to \c last.
+    void                    updateNodes(int first, int last, const QVector<int>& roles = QVector<int>{}) noexcept;
+    //! Remove nodes for node model rows \c first to \c last.
+    void                    removeNodes(int first, int last) noexcept;
+    //! Remove node \c id inserted by adapter, its adjacent edges are inserted again if node is inserted again.
+    void                    removeNode(const QString& id) noexcept;
+    //! Insert, update or reconnect edges for edge model rows \c first to \c last.
+    void                    updateEdges(int first, int last, const QVector<int>& roles = QVector<int>{}) noexcept;
+    //! Remove edges for edge model rows \c first to \c last.
+    void                    removeEdges(int first, int last) noexcept;
+    //! Insert edges waiting for a source or destination node.
+    void                    resolvePendingEdges() noexcept;
+    //! Insert (or reconnect) edge \c id, return false if source or destination node does not exist.
+    bool                    connectEdge(const QString& id, const QString& srcId, const QString& dstId, const QVariant& label) noexcept;
+
+    NodeRoles               _nodeRoles;
+    EdgeRoles               _edgeRoles;
+    QSet<QString>           _nodeIds;       // Ids of nodes inserted by adapter
+    QSet<QString>           _edgeIds;       // Ids of edges inserted by adapter
+    struct PendingEdge {
+        QString     srcId;
+        QString     dstId;
+        QVariant    label;
+    };
+    QHash<QString, PendingEdge>     _pendingEdges;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::ModelGraphAdapter)
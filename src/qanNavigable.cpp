@@ -32,11 +32,15 @@
 // \date	2015 07 19
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>    // std::min std::max
+
 // Qt headers
-// Nil
+#include <QQuickWindow>
 
 // QuickQanava headers
 #include "./qanNavigable.h"
+#include "./qanTrace.h"
 
 namespace qan { // ::qan
 
@@ -48,13 +52,7 @@ Navigable::Navigable( QQuickItem* parent ) :
     _containerItem->setTransformOrigin(TransformOrigin::TopLeft);
     _containerItem->setAcceptTouchEvents(true);
     connect(_containerItem, &QQuickItem::childrenRectChanged,  // Listen to children rect changes to update containerItem size
-             [this]() {
-        if (this->_containerItem != nullptr) {
-            const auto cr = this->_containerItem->childrenRect();
-            this->_containerItem->setWidth(cr.width());
-            this->_containerItem->setHeight(cr.height());
-        }
-    });
+            this,           &Navigable::contentRectModified);
     setAcceptedMouseButtons(Qt::RightButton | Qt::LeftButton);
     setTransformOrigin(TransformOrigin::TopLeft);
 
@@ -114,9 +112,40 @@ void    Navigable::centerOnPosition(QPointF position)
     updateGrid();
 }
 
+void    Navigable::setContainerResizeSuspended(bool suspended) noexcept
+{
+    if (suspended == _containerResizeSuspended)
+        return;
+    _containerResizeSuspended = suspended;
+    if (!_containerResizeSuspended)
+        updateContainerSize();
+}
+
+void    Navigable::updateContainerSize() noexcept
+{
+    if (_containerResizeSuspended ||
+        _containerItem == nullptr)
+        return;
+    const auto cr = getContentRect();
+    _containerItem->setWidth(cr.width());
+    _containerItem->setHeight(cr.height());
+}
+
+QRectF  Navigable::getContentRect() noexcept
+{
+    return _containerItem ? _containerItem->childrenRect() : QRectF{};
+}
+
+void    Navigable::contentRectModified() noexcept
+{
+    updateContainerSize();
+    emit contentRectChanged();
+}
+
 void    Navigable::fitInView( )
 {
-    QRectF content = _containerItem->childrenRect();
+    QAN_TRACE_SCOPE("Navigable::fitInView");
+    QRectF content = getContentRect();
     if (!content.isEmpty()) { // Protect against div/0, can't fit if there is no content...
         const qreal viewWidth = width();
         const qreal viewHeight = height();
@@ -187,6 +216,7 @@ void    Navigable::setZoom(qreal zoom)
 
 void    Navigable::zoomOn(QPointF center, qreal zoom)
 {
+    QAN_TRACE_SCOPE("Navigable::zoomOn");
     // Get center coordinates in container CS, it is our
     // zoom application point
     qreal containerCenterX = center.x() - _containerItem->x();
@@ -277,7 +307,7 @@ void    Navigable::geometryChanged( const QRectF& newGeometry, const QRectF& old
             bool centerWidth = false;
             bool centerHeight = false;
             // Container item children Br mapped in root CS.
-            QRectF contentBr = mapRectFromItem( _containerItem, _containerItem->childrenRect( ) );
+            QRectF contentBr = mapRectFromItem( _containerItem, getContentRect() );
             if ( newGeometry.contains( contentBr ) ) {
                 centerWidth = true;
                 centerHeight = true;
@@ -307,7 +337,7 @@ void    Navigable::geometryChanged( const QRectF& newGeometry, const QRectF& old
             bool anchorLeft = false;
 
             // Container item children Br mapped in root CS.
-            QRectF contentBr = mapRectFromItem( _containerItem, _containerItem->childrenRect() );
+            QRectF contentBr = mapRectFromItem( _containerItem, getContentRect() );
             if ( contentBr.width() > newGeometry.width() &&
                  contentBr.right() < newGeometry.right() ) {
                 anchorRight = true;
@@ -339,6 +369,7 @@ void    Navigable::mouseMoveEvent(QMouseEvent* event)
     }
     if (_leftButtonPressed &&               // Left click panning /////////////
         !_lastPan.isNull()) {
+        interactionStep();
         const QPointF delta = _lastPan - event->localPos();
         const auto p = QPointF{_containerItem->x(),
                                _containerItem->y()} - delta;
@@ -430,6 +461,7 @@ void    Navigable::wheelEvent(QWheelEvent* event)
 {
     if (getNavigable()) {
         qreal zoomFactor = (event->angleDelta().y() > 0. ? _zoomIncrement : -_zoomIncrement);
+        interactionStep();
         zoomOn(event->position(), getZoom() + zoomFactor);
     }
     updateGrid();
@@ -497,4 +529,89 @@ void    Navigable::updateGrid() noexcept
 }
 //-----------------------------------------------------------------------------
 
+/* Interaction Render Cache *///-----------------------------------------------
+void    Navigable::setInteractionCache(bool interactionCache) noexcept
+{
+    if (interactionCache != _interactionCache) {
+        _interactionCache = interactionCache;
+        if (!_interactionCache)
+            endInteractionCache();
+        emit interactionCacheChanged();
+    }
+}
+
+void    Navigable::setInteractionCacheDelay(int interactionCacheDelay) noexcept
+{
+    interactionCacheDelay = std::max(0, interactionCacheDelay);
+    if (interactionCacheDelay != _interactionCacheDelay) {
+        _interactionCacheDelay = interactionCacheDelay;
+        emit interactionCacheDelayChanged();
+    }
+}
+
+void    Navigable::setInteractionCacheMaxSize(int interactionCacheMaxSize) noexcept
+{
+    interactionCacheMaxSize = std::max(64, interactionCacheMaxSize);
+    if (interactionCacheMaxSize != _interactionCacheMaxSize) {
+        _interactionCacheMaxSize = interactionCacheMaxSize;
+        emit interactionCacheMaxSizeChanged();
+    }
+}
+
+void    Navigable::interactionStep() noexcept
+{
+    if (!_interactionCache ||
+        !_containerItem)
+        return;
+    if (_interactionCacheTimer == nullptr) {
+        _interactionCacheTimer = new QTimer{this};
+        _interactionCacheTimer->setSingleShot(true);
+        connect(_interactionCacheTimer, &QTimer::timeout,
+                this,                   &Navigable::endInteractionCache);
+    }
+    _interactionCacheTimer->start(_interactionCacheDelay);   // Restart idle delay
+    if (_interactionCacheActive)
+        return;
+
+    // Note: QQuickItem layer is only exposed as a grouped QML property (QQuickItemLayer is private API)
+    auto layer = qvariant_cast<QObject*>(_containerItem->property("layer"));
+    if (layer == nullptr)
+        return;
+    // Cache visible window extended by one view size on every side, in container item CS
+    const auto visibleRect = mapRectToItem(_containerItem, QRectF{0., 0., width(), height()});
+    auto cacheRect = visibleRect.adjusted(-visibleRect.width(), -visibleRect.height(),
+                                          visibleRect.width(), visibleRect.height());
+    const auto contentRect = getContentRect();
+    if (!contentRect.isEmpty())
+        cacheRect = cacheRect.intersected(contentRect);
+    if (cacheRect.isEmpty())
+        return;
+    const auto dpr = window() != nullptr ? window()->effectiveDevicePixelRatio() : 1.;
+    const auto zoom = _containerItem->scale() * dpr;
+    const auto maxSize = static_cast<qreal>(_interactionCacheMaxSize);
+    const auto textureScale = std::min(zoom, std::min(maxSize / cacheRect.width(), maxSize / cacheRect.height()));
+    const QSize textureSize{ std::max(1, static_cast<int>(cacheRect.width() * textureScale)),
+                             std::max(1, static_cast<int>(cacheRect.height() * textureScale)) };
+    layer->setProperty("sourceRect", cacheRect);
+    layer->setProperty("textureSize", textureSize);
+    layer->setProperty("smooth", true);
+    layer->setProperty("enabled", true);
+    _interactionCacheActive = true;
+    emit interactionCacheActiveChanged();
+}
+
+void    Navigable::endInteractionCache() noexcept
+{
+    if (_interactionCacheTimer != nullptr)
+        _interactionCacheTimer->stop();
+    if (!_interactionCacheActive)
+        return;
+    _interactionCacheActive = false;
+    auto layer = _containerItem ? qvariant_cast<QObject*>(_containerItem->property("layer")) : nullptr;
+    if (layer != nullptr)
+        layer->setProperty("enabled", false);
+    emit interactionCacheActiveChanged();
+}
+//-----------------------------------------------------------------------------
+
 } // ::qan
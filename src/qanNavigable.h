@@ -36,6 +36,7 @@
 
 // Qt headers
 #include <QQuickItem>
+#include <QTimer>
 
 // QuickQanava headers
 #include "./qanGrid.h"
@@ -149,6 +150,39 @@ public:
 private:
     QPointer<QQuickItem>    _containerItem = nullptr;
 
+public:
+    /*! \brief When true, container item is no longer resized when its children rect change (default to false).
+     *
+     * Used to avoid resizing container item on every inserted item during a batched update, container is
+     * resized once when \c suspended is set back to false.
+     */
+    void                    setContainerResizeSuspended(bool suspended) noexcept;
+protected:
+    //! Resize container item to its content rect.
+    void                    updateContainerSize() noexcept;
+private:
+    bool                    _containerResizeSuspended = false;
+
+public:
+    /*! \brief Navigable content bounding rect in \c containerItem CS (used for fit in view, auto fit and previews).
+     *
+     * Default to \c containerItem childrenRect, qan::GraphView use graph incrementally maintained qan::Graph::sceneBounds.
+     */
+    Q_PROPERTY(QRectF contentRect READ getContentRect NOTIFY contentRectChanged FINAL)
+    //! \copydoc contentRect
+    virtual QRectF          getContentRect() noexcept;
+signals:
+    //! \copydoc contentRect
+    void                    contentRectChanged();
+    /*! \brief Emitted when content inside \c rect (in \c containerItem CS) has been modified (used for preview partial invalidation).
+     *
+     * Never emitted by default, qan::GraphView forward qan::Graph::sceneModified().
+     */
+    void                    contentModified(QRectF rect);
+protected:
+    //! Call when content rect returned by an overriden getContentRect() is modified.
+    void                    contentRectModified() noexcept;
+
 public:
     //! Center the view on a given child item (zoom level is not modified).
     Q_INVOKABLE void    centerOn(QQuickItem* item);
@@ -413,6 +447,78 @@ signals:
     void                gridChanged();
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Interaction Render Cache *///------------------------------------
+    //@{
+public:
+    /*! \brief Render container item in a cached texture during zoom and pan gestures (default to false).
+     *
+     * When enabled, \c containerItem is rendered once in a texture layer when a wheel zoom or a pan starts, the
+     * layer texture is then transformed for every gesture frame instead of re-rendering all content items. Live
+     * content is restored when no zoom or pan occurs during \c interactionCacheDelay.
+     *
+     * Cached region is the visible window extended by one view size on every side (clipped to \c contentRect),
+     * rendered at gesture initial zoom with a texture size limited to \c interactionCacheMaxSize.
+     */
+    Q_PROPERTY(bool interactionCache READ getInteractionCache WRITE setInteractionCache NOTIFY interactionCacheChanged FINAL)
+    //! \copydoc interactionCache
+    inline bool     getInteractionCache() const noexcept { return _interactionCache; }
+    //! \copydoc interactionCache
+    void            setInteractionCache(bool interactionCache) noexcept;
+private:
+    //! \copydoc interactionCache
+    bool            _interactionCache = false;
+signals:
+    //! \copydoc interactionCache
+    void            interactionCacheChanged();
+
+public:
+    //! Idle delay in ms after the last zoom or pan before live content is rendered again (default to 250ms).
+    Q_PROPERTY(int interactionCacheDelay READ getInteractionCacheDelay WRITE setInteractionCacheDelay NOTIFY interactionCacheDelayChanged FINAL)
+    //! \copydoc interactionCacheDelay
+    inline int      getInteractionCacheDelay() const noexcept { return _interactionCacheDelay; }
+    //! \copydoc interactionCacheDelay
+    void            setInteractionCacheDelay(int interactionCacheDelay) noexcept;
+private:
+    //! \copydoc interactionCacheDelay
+    int             _interactionCacheDelay = 250;
+signals:
+    //! \copydoc interactionCacheDelay
+    void            interactionCacheDelayChanged();
+
+public:
+    //! Maximum cache texture width or height in pixels (default to 4096).
+    Q_PROPERTY(int interactionCacheMaxSize READ getInteractionCacheMaxSize WRITE setInteractionCacheMaxSize NOTIFY interactionCacheMaxSizeChanged FINAL)
+    //! \copydoc interactionCacheMaxSize
+    inline int      getInteractionCacheMaxSize() const noexcept { return _interactionCacheMaxSize; }
+    //! \copydoc interactionCacheMaxSize
+    void            setInteractionCacheMaxSize(int interactionCacheMaxSize) noexcept;
+private:
+    //! \copydoc interactionCacheMaxSize
+    int             _interactionCacheMaxSize = 4096;
+signals:
+    //! \copydoc interactionCacheMaxSize
+    void            interactionCacheMaxSizeChanged();
+
+public:
+    //! True while container item is rendered from interaction cache texture (read-only).
+    Q_PROPERTY(bool interactionCacheActive READ getInteractionCacheActive NOTIFY interactionCacheActiveChanged FINAL)
+    //! \copydoc interactionCacheActive
+    inline bool     getInteractionCacheActive() const noexcept { return _interactionCacheActive; }
+signals:
+    //! \copydoc interactionCacheActive
+    void            interactionCacheActiveChanged();
+
+protected:
+    //! Called on every zoom or pan: activate interaction cache (if \c interactionCache is true) and restart idle timer.
+    void            interactionStep() noexcept;
+    //! Restore live content rendering.
+    void            endInteractionCache() noexcept;
+private:
+    bool            _interactionCacheActive = false;
+    QTimer*         _interactionCacheTimer = nullptr;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
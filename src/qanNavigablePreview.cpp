@@ -32,6 +32,9 @@
 // \date	2017 06 02
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <algorithm>
+
 // Qt headers
 // Nil
 
@@ -45,6 +48,9 @@ NavigablePreview::NavigablePreview( QQuickItem* parent ) :
     QQuickItem{parent}
 {
     setFlag(QQuickItem::ItemHasContents);
+    _thumbnailTimer.setSingleShot(true);
+    connect(&_thumbnailTimer,   &QTimer::timeout,
+            this,               &NavigablePreview::flushThumbnailUpdate);
 }
 //-----------------------------------------------------------------------------
 
@@ -53,9 +59,85 @@ void    NavigablePreview::setSource( qan::Navigable* source ) noexcept
 {
     if ( source != _source ) {
         _source = source;
+        updateThumbnailPolicy();
         emit sourceChanged();
     }
 }
 //-----------------------------------------------------------------------------
 
+/* Thumbnail Update Policy *///------------------------------------------------
+void    NavigablePreview::setUpdatePolicy(UpdatePolicy updatePolicy) noexcept
+{
+    if (updatePolicy != _updatePolicy) {
+        _updatePolicy = updatePolicy;
+        updateThumbnailPolicy();
+        emit updatePolicyChanged();
+    }
+}
+
+void    NavigablePreview::setUpdateInterval(int updateInterval) noexcept
+{
+    updateInterval = std::max(0, updateInterval);
+    if (updateInterval != _updateInterval) {
+        _updateInterval = updateInterval;
+        if (_updatePolicy == Periodic)
+            updateThumbnailPolicy();
+        emit updateIntervalChanged();
+    }
+}
+
+void    NavigablePreview::invalidateThumbnail(QRectF rect) noexcept
+{
+    if (_updatePolicy == Live)
+        return;
+    if (rect.isEmpty())
+        _fullInvalidation = true;
+    else
+        _dirtyRect = _dirtyRect.united(rect);
+    if (_updatePolicy == OnChange &&
+        !_thumbnailTimer.isActive())
+        _thumbnailTimer.start(_updateInterval);
+}
+
+void    NavigablePreview::flushThumbnailUpdate() noexcept
+{
+    if (_updatePolicy == Periodic)
+        _fullInvalidation = true;
+    if (!_fullInvalidation &&
+        _dirtyRect.isEmpty())
+        return;
+    const auto dirtyRect = _fullInvalidation ? QRectF{} : _dirtyRect;
+    _fullInvalidation = false;
+    _dirtyRect = QRectF{};
+    emit thumbnailUpdateRequested(dirtyRect);
+}
+
+void    NavigablePreview::updateThumbnailPolicy() noexcept
+{
+    disconnect(_contentModifiedCon);
+    disconnect(_contentRectCon);
+    _thumbnailTimer.stop();
+    _thumbnailTimer.setSingleShot(_updatePolicy != Periodic);
+    _dirtyRect = QRectF{};
+    _fullInvalidation = false;
+    switch (_updatePolicy) {
+    case Live:
+        break;
+    case OnChange:
+        if (_source) {
+            _contentModifiedCon = connect(_source.data(), &qan::Navigable::contentModified,
+                                          this,           [this](QRectF rect) { invalidateThumbnail(rect); });
+            _contentRectCon = connect(_source.data(), &qan::Navigable::contentRectChanged,
+                                      this,           [this]() { invalidateThumbnail(); });
+        }
+        invalidateThumbnail();  // Initial full render
+        break;
+    case Periodic:
+        _thumbnailTimer.start(_updateInterval);
+        QTimer::singleShot(0, this, &NavigablePreview::flushThumbnailUpdate);  // Initial full render
+        break;
+    }
+}
+//-----------------------------------------------------------------------------
+
 } // ::qan
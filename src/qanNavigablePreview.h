@@ -37,6 +37,7 @@
 
 // Qt headers
 #include <QQuickItem>
+#include <QTimer>
 
 // QuickQanava headers
 #include "./qanNavigable.h"
@@ -89,6 +90,79 @@ signals:
     void        visibleWindowChanged(QRectF visibleWindowRect, qreal navigableZoom);
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Thumbnail Update Policy *///-------------------------------------
+    //@{
+public:
+    enum UpdatePolicy {
+        //! Source content is rendered in the preview every time it change (default).
+        Live,
+        /*! \brief Source content is rendered only when modified: invalidated regions are accumulated and
+         * flushed at most once every \c updateInterval ms (using source qan::Navigable::contentModified() and
+         * qan::Navigable::contentRectChanged() notifications). */
+        OnChange,
+        //! Source content is fully rendered every \c updateInterval ms.
+        Periodic
+    };
+    Q_ENUM(UpdatePolicy)
+
+    /*! \brief Preview thumbnail update policy (default to \c Live).
+     *
+     * Visible window rectangle is always updated in real time, \c OnChange and \c Periodic only throttle
+     * source content rendering, use them for large graphs where redrawing the whole scene in the preview
+     * texture on every frame is costly.
+     */
+    Q_PROPERTY(UpdatePolicy updatePolicy READ getUpdatePolicy WRITE setUpdatePolicy NOTIFY updatePolicyChanged FINAL)
+    //! \copydoc updatePolicy
+    inline UpdatePolicy         getUpdatePolicy() const noexcept { return _updatePolicy; }
+    //! \copydoc updatePolicy
+    void                        setUpdatePolicy(UpdatePolicy updatePolicy) noexcept;
+private:
+    //! \copydoc updatePolicy
+    UpdatePolicy                _updatePolicy = Live;
+signals:
+    //! \copydoc updatePolicy
+    void                        updatePolicyChanged();
+
+public:
+    //! Minimum delay in ms between two thumbnail updates with \c OnChange policy, update period with \c Periodic policy (default to 250ms).
+    Q_PROPERTY(int updateInterval READ getUpdateInterval WRITE setUpdateInterval NOTIFY updateIntervalChanged FINAL)
+    //! \copydoc updateInterval
+    inline int                  getUpdateInterval() const noexcept { return _updateInterval; }
+    //! \copydoc updateInterval
+    void                        setUpdateInterval(int updateInterval) noexcept;
+private:
+    //! \copydoc updateInterval
+    int                         _updateInterval = 250;
+signals:
+    //! \copydoc updateInterval
+    void                        updateIntervalChanged();
+
+public:
+    /*! \brief Invalidate thumbnail region \c rect (in source \c containerItem CS), an empty \c rect invalidate the whole thumbnail.
+     *
+     * Invalidations are accumulated and flushed with a single thumbnailUpdateRequested() at most once every \c updateInterval.
+     * \note Does nothing with \c Live policy.
+     */
+    Q_INVOKABLE void            invalidateThumbnail(QRectF rect = QRectF{}) noexcept;
+signals:
+    /*! \brief Emitted when thumbnail region \c dirtyRect (in source \c containerItem CS) has to be rendered again.
+     *
+     * \arg dirtyRect region to update, an empty rect means the whole thumbnail.
+     */
+    void                        thumbnailUpdateRequested(QRectF dirtyRect);
+private:
+    //! Emit thumbnailUpdateRequested() with the accumulated dirty region.
+    void                        flushThumbnailUpdate() noexcept;
+    //! Configure update timer and source connections for actual policy.
+    void                        updateThumbnailPolicy() noexcept;
+    QTimer                      _thumbnailTimer;
+    QRectF                      _dirtyRect;
+    bool                        _fullInvalidation = false;
+    QMetaObject::Connection     _contentModifiedCon;
+    QMetaObject::Connection     _contentRectCon;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
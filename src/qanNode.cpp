@@ -38,6 +38,7 @@
 
 // QuickQanava headers
 #include "./qanNode.h"
+#include "./qanComponentCache.h"
 #include "./qanNodeItem.h"
 #include "./qanPortItem.h"
 #include "./qanGroup.h"
@@ -51,15 +52,14 @@ Node::Node(QObject* parent) :
 {
     Q_UNUSED(parent)
 
-    // Bind in/out nodes model lengthChanged() signal to in/ou degree modified signal.
-    const auto inNodesModel = get_in_nodes().model();
-    if (inNodesModel != nullptr)
-        connect( inNodesModel, &qcm::ContainerModel::lengthChanged,
-                 this,         &qan::Node::inDegreeChanged);
-    const auto outNodesModel = get_out_nodes().model();
-    if (outNodesModel != nullptr)
-        connect( outNodesModel, &qcm::ContainerModel::lengthChanged,
-                 this,          &qan::Node::outDegreeChanged);
+#if !defined(QUICKQANAVA_STD_ADJACENCY)  // Otherwise, degree signals are emitted by qan::NodeDegreeNotifier
+    // Bind in/out nodes containers lengthChanged() signal to in/ou degree modified signal (binding
+    // to containers avoid creating in/out nodes models until they are effectively accessed from QML).
+    connect( &get_in_nodes(),   &qcm::AbstractContainer::lengthChanged,
+             this,              &qan::Node::inDegreeChanged);
+    connect( &get_out_nodes(),  &qcm::AbstractContainer::lengthChanged,
+             this,              &qan::Node::outDegreeChanged);
+#endif
 }
 
 Node::~Node()
@@ -92,17 +92,44 @@ void    Node::setItem(qan::NodeItem* nodeItem) noexcept
             nodeItem->setNode(this);
     }
 }
+
+qan::NodeItem*  Node::releaseItem() noexcept
+{
+    const auto item = _item.data();
+    _item.clear();
+    return item;
+}
+
+QRectF  Node::getGeometry() const noexcept
+{
+    if (_item)
+        return QRectF{_item->position(), QSizeF{_item->width(), _item->height()}};
+    return _geometry;
+}
+
+void    Node::setGeometry(const QRectF& geometry) noexcept
+{
+    _geometry = geometry;
+    if (_item) {
+        _item->setPosition(geometry.topLeft());
+        if (!geometry.isEmpty())
+            _item->setSize(geometry.size());
+    }
+    emit geometryChanged();
+}
+
+void    Node::storeItemGeometry() noexcept
+{
+    if (_item)
+        _geometry = QRectF{_item->position(), QSizeF{_item->width(), _item->height()}};
+}
 //-----------------------------------------------------------------------------
 
 /* Node Static Factories *///--------------------------------------------------
 QQmlComponent*  Node::delegate(QQmlEngine& engine, QObject* parent) noexcept
 {
     Q_UNUSED(parent)
-    static std::unique_ptr<QQmlComponent>   delegate;
-    if (!delegate)
-        delegate = std::make_unique<QQmlComponent>(&engine, "qrc:/QuickQanava/Node.qml",
-                                                   QQmlComponent::PreferSynchronous);
-    return delegate.get();
+    return qan::ComponentCache::get(engine, QStringLiteral("qrc:/QuickQanava/Node.qml"));
 }
 
 qan::NodeStyle* Node::style(QObject* parent) noexcept
@@ -117,44 +144,55 @@ qan::NodeStyle* Node::style(QObject* parent) noexcept
 /* Topology Interface *///-----------------------------------------------------
 QAbstractItemModel* Node::qmlGetInNodes( ) const
 {
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+    return getAdjacencyModel(_inNodesModel, qan::AdjacencyModel::Adjacency::InNodes);
+#else
     return const_cast<QAbstractItemModel*>( static_cast< const QAbstractItemModel* >( get_in_nodes().model() ) );
+#endif
 }
 
 int     Node::getInDegree() const
 {
-    const auto model = get_in_nodes().model();
-    return model != nullptr ? model->getLength() : -1;
+    return static_cast<int>(get_in_degree());
 }
 
 QAbstractItemModel* Node::qmlGetOutNodes() const
 {
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+    return getAdjacencyModel(_outNodesModel, qan::AdjacencyModel::Adjacency::OutNodes);
+#else
     return const_cast< QAbstractItemModel* >( qobject_cast< const QAbstractItemModel* >( get_out_nodes().model() ) );
+#endif
 }
 
 int     Node::getOutDegree() const
 {
-    const auto model = get_out_nodes().model();
-    return model != nullptr ? model->getLength() : -1;
+    return static_cast<int>(get_out_degree());
 }
 
 QAbstractItemModel* Node::qmlGetOutEdges() const
 {
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+    return getAdjacencyModel(_outEdgesModel, qan::AdjacencyModel::Adjacency::OutEdges);
+#else
     return const_cast< QAbstractItemModel* >( qobject_cast< const QAbstractItemModel* >( gtpo::node<qan::Config>::get_out_edges().model() ) );
+#endif
 }
 
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+QAbstractItemModel* Node::getAdjacencyModel(std::unique_ptr<qan::AdjacencyModel>& model,
+                                            qan::AdjacencyModel::Adjacency adjacency) const
+{
+    if (!model)
+        model = std::make_unique<qan::AdjacencyModel>(*this, adjacency);
+    return model.get();
+}
+#endif
+
 std::unordered_set<qan::Edge*>  Node::collectAdjacentEdges0() const
 {
     std::unordered_set<qan::Edge*> edges;
-    for (const auto& in_edge_ptr: qAsConst(get_in_edges())) {
-        const auto in_edge = in_edge_ptr.lock();
-        if (in_edge)
-            edges.insert(in_edge.get());
-    }
-    for (const auto& out_edge_ptr: qAsConst(get_out_edges())) {
-        const auto out_edge = out_edge_ptr.lock();
-        if (out_edge)
-            edges.insert(out_edge.get());
-    }
+    forEachAdjacentEdge0([&edges](qan::Edge* edge) { edges.insert(edge); });
     return edges;
 }
 //-----------------------------------------------------------------------------
@@ -40,10 +40,14 @@
 #include <QPolygonF>
 
 // QuickQanava headers
+#include <gtpo/algorithm.h>
 #include "./qanGraphConfig.h"
 #include "./qanEdge.h"
 #include "./qanStyle.h"
 #include "./qanBehaviour.h"
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+#include "./qanAdjacencyModel.h"
+#endif
 
 namespace qan { // ::qan
 
@@ -89,8 +93,30 @@ public:
     qan::NodeItem*          getItem() noexcept;
     const qan::NodeItem*    getItem() const noexcept;
     virtual void            setItem(qan::NodeItem* nodeItem) noexcept;
+    //! Detach node item from this node (item is no longer destroyed with node), return detached item.
+    qan::NodeItem*          releaseItem() noexcept;
 protected:
     QPointer<qan::NodeItem> _item;
+
+public:
+    /*! \brief Node geometry in graph container item coordinates (or in group coordinates for a grouped node).
+     *
+     * Geometry is read from node item when an item exists, otherwise it is the geometry stored in node, it is
+     * used in virtualized graph (see qan::Graph::virtualized) to position nodes that have no visual item.
+     * \note geometryChanged() is emitted only when setGeometry() is called, not when node item is moved.
+     */
+    Q_PROPERTY(QRectF geometry READ getGeometry WRITE setGeometry NOTIFY geometryChanged FINAL)
+    //! \copydoc geometry
+    QRectF                  getGeometry() const noexcept;
+    //! \copydoc geometry
+    void                    setGeometry(const QRectF& geometry) noexcept;
+    //! Store actual node item geometry in node (called before node item is released in a virtualized graph).
+    void                    storeItemGeometry() noexcept;
+private:
+    QRectF                  _geometry{};
+signals:
+    //! \copydoc geometry
+    void                    geometryChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -141,9 +167,29 @@ public:
     Q_PROPERTY( QAbstractItemModel* outEdges READ qmlGetOutEdges CONSTANT FINAL )
     QAbstractItemModel* qmlGetOutEdges() const;
 
+#if defined(QUICKQANAVA_STD_ADJACENCY)
+private:
+    //! Lazily created inNodes, outNodes and outEdges models (adjacency is stored in plain std containers).
+    mutable std::unique_ptr<qan::AdjacencyModel>    _inNodesModel;
+    mutable std::unique_ptr<qan::AdjacencyModel>    _outNodesModel;
+    mutable std::unique_ptr<qan::AdjacencyModel>    _outEdgesModel;
+    //! Return \c model, creating it for \c adjacency on first access.
+    QAbstractItemModel* getAdjacencyModel(std::unique_ptr<qan::AdjacencyModel>& model,
+                                          qan::AdjacencyModel::Adjacency adjacency) const;
+#endif
+
 public:
     //! Get this node level 0 adjacent edges (ie sum of node in edges and out edges).
     std::unordered_set<qan::Edge*>  collectAdjacentEdges0() const;
+
+    /*! \brief Call \c f(qan::Edge*) on this node level 0 adjacent edges, without allocating a temporary edge set.
+     *
+     * \note A self loop edge is visited once, \c f must not modify this node adjacency.
+     */
+    template <class Functor_t>
+    void    forEachAdjacentEdge0(Functor_t&& f) const {
+        gtpo::for_each_adjacent_edge(*this, [&f](const auto& edge) { f(edge.get()); });
+    }
     //@}
     //-------------------------------------------------------------------------
 
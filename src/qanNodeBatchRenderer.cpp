@@ -0,0 +1,186 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// QuickQanava headers
+#include "./qanNodeBatchRenderer.h"
+#include "./qanNodeItem.h"
+#include "./qanNode.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* NodeBatchRenderer Object Management *///-----------------------------------
+NodeBatchRenderer::NodeBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+NodeBatchRenderer::~NodeBatchRenderer()
+{
+    if (_graph)
+        _graph->setFlatBatched(false);
+}
+
+void    NodeBatchRenderer::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return;
+    if (_graph) {
+        disconnect(_graph, nullptr, this, nullptr);
+        disconnect(_graph->getStyleManager(), nullptr, this, nullptr);
+        _graph->setFlatBatched(false);
+    }
+    _graph = graph;
+    if (_graph) {
+        _graph->setFlatBatched(true);
+        connect(_graph->getStyleManager(), &qan::StyleManager::styleTableModified,
+                this, &NodeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::levelOfDetailChanged,  this, &NodeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeInserted,          this, &NodeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::nodeRemoved,           this, &NodeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::updateEnded,           this, &NodeBatchRenderer::invalidate);
+        connect(_graph, &qan::Graph::sceneModified,         this, &NodeBatchRenderer::invalidate);
+    }
+    invalidate();
+    emit graphChanged();
+}
+
+void    NodeBatchRenderer::setColor(QColor color) noexcept
+{
+    if (color != _color) {
+        _color = color;
+        invalidate();
+        emit colorChanged();
+    }
+}
+
+void    NodeBatchRenderer::invalidate() noexcept
+{
+    polish();
+    if (_rebuild)       // Merge multiple invalidations until next frame
+        return;
+    _rebuild = true;
+    update();
+}
+//-----------------------------------------------------------------------------
+
+/* Batch Rendering *///--------------------------------------------------------
+bool    NodeBatchRenderer::isFlat() const noexcept
+{
+    return _graph &&
+           _graph->getLevelOfDetail() == qan::NodeItem::LevelOfDetail::Flat;
+}
+
+void    NodeBatchRenderer::updatePolish()
+{
+    if (!isFlat())
+        return;
+    // Style table is only modified from GUI thread: registering a new style emit styleTableModified()
+    auto styleManager = _graph->getStyleManager();
+    for (const auto& graphNode : _graph->get_nodes())
+        if (graphNode &&
+            !graphNode->is_group())
+            styleManager->getStyleIndex(_graph->getNodeStyle(*graphNode));
+}
+
+QSGNode*    NodeBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    // Note: GUI thread is blocked while updatePaintNode() is called, graph nodes can be safely read.
+    if (!_rebuild)
+        return oldNode;
+    _rebuild = false;
+    if (!isFlat()) {
+        delete oldNode;
+        return nullptr;
+    }
+    int nodeCount = 0;
+    for (const auto& node : _graph->get_nodes())
+        if (node && !node->is_group())
+            ++nodeCount;
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), nodeCount * 6};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    } else if (node->geometry()->vertexCount() != nodeCount * 6)
+        node->geometry()->allocate(nodeCount * 6);
+    auto v = node->geometry()->vertexDataAsColoredPoint2D();
+    const auto styleManager = _graph->getStyleManager();    // Nodes style have been registered in updatePolish()
+    // Default color is premultiplied once, nodes style colors are read premultiplied from style table
+    qan::StyleManager::StyleEntry::Rgba defaultColor;
+    {
+        const auto a = _color.alpha();
+        defaultColor.r = static_cast<uchar>(_color.red() * a / 255);
+        defaultColor.g = static_cast<uchar>(_color.green() * a / 255);
+        defaultColor.b = static_cast<uchar>(_color.blue() * a / 255);
+        defaultColor.a = static_cast<uchar>(a);
+    }
+    for (const auto& graphNode : _graph->get_nodes()) {
+        if (!graphNode ||
+            graphNode->is_group())
+            continue;
+        const auto nodeItem = graphNode->getItem();
+        // Grouped nodes items have group relative coordinates, virtualized nodes geometry is in container CS
+        const auto r = nodeItem != nullptr ? nodeItem->mapRectToItem(this, QRectF{0., 0., nodeItem->width(), nodeItem->height()}) :
+                                             graphNode->getGeometry();
+        const auto visible = nodeItem == nullptr || nodeItem->isVisible();
+        const auto entry = styleManager->getStyleEntry(styleManager->findStyleIndex(_graph->getNodeStyle(*graphNode)));
+        auto color = entry != nullptr ? entry->fillColor : defaultColor;
+        if (!visible)
+            color = qan::StyleManager::StyleEntry::Rgba{};
+        const auto push = [&v, &color](qreal x, qreal y) {
+            v->set(static_cast<float>(x), static_cast<float>(y), color.r, color.g, color.b, color.a);
+            ++v;
+        };
+        push(r.left(), r.top());    push(r.right(), r.top());       push(r.left(), r.bottom());
+        push(r.right(), r.top());   push(r.right(), r.bottom());    push(r.left(), r.bottom());
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+
+namespace qan { // ::qan
+
+class Graph;
+
+/*! \brief Draw all graph nodes as flat rectangles in a single scene graph node when graph level of detail is Flat.
+ *
+ * At low zoom, node delegates label, border and effects are not readable, NodeBatchRenderer replace them with one
+ * vertex colored triangle buffer (two triangles per node, colored with node style \c backColor and \c backOpacity read
+ * from graph qan::StyleManager style table), rendering all nodes in a single draw call. Renderer set
+ * qan::Graph::flatBatched: at Flat level delegates hide their content and virtualized graphs defer node items creation
+ * until level of detail is raised.
+ *
+ * Renderer must be a child of graph container item (at origin), above edges:
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   graph: Qan.Graph { id: graph }
+ *   Qan.NodeBatchRenderer {
+ *     parent: graphView.containerItem
+ *     graph: graph
+ *   }
+ * }
+ * \endcode
+ *
+ * \note Groups are not rendered, group items keep their own delegate.
+ * \nosubgrouping
+ */
+class NodeBatchRenderer : public QQuickItem
+{
+    /*! \name NodeBatchRenderer Object Management *///-------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit NodeBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~NodeBatchRenderer() override;
+    NodeBatchRenderer(const NodeBatchRenderer&) = delete;
+
+public:
+    //! Graph whose nodes are rendered.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+
+public:
+    //! Color used for nodes with no style (default to lightgrey).
+    Q_PROPERTY(QColor color READ getColor WRITE setColor NOTIFY colorChanged FINAL)
+    //! \copydoc color
+    inline QColor       getColor() const noexcept { return _color; }
+    //! \copydoc color
+    void                setColor(QColor color) noexcept;
+private:
+    QColor              _color{Qt::lightGray};
+signals:
+    void                colorChanged();
+
+public:
+    //! Force a rebuild of node rectangles (rebuild is automatic when nodes are inserted, removed or moved).
+    Q_INVOKABLE void    invalidate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batch Rendering *///---------------------------------------------
+    //@{
+protected:
+    //! Register nodes style in graph qan::StyleManager style table (from GUI thread, before updatePaintNode()).
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Return true if graph nodes are actually rendered at Flat level of detail.
+    bool                isFlat() const noexcept;
+
+    bool                _rebuild = true;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::NodeBatchRenderer)
@@ -0,0 +1,204 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeColumns.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max std::fill
+
+// QuickQanava headers
+#include "./qanNodeColumns.h"
+#include "./qanNode.h"
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+/* NodeColumns Object Management *///------------------------------------------
+std::size_t NodeColumns::rowOf(const qan::Node& node) const noexcept
+{
+    const auto id = node.get_id();
+    if (!id.is_valid())
+        return rowCount();
+    const auto row = static_cast<std::size_t>(id.get_index());
+    return row < _nodes.size() && _nodes[row] == &node ? row : rowCount();
+}
+//-----------------------------------------------------------------------------
+
+/* Geometry Columns *///-------------------------------------------------------
+void    NodeColumns::markModified(std::size_t row) noexcept
+{
+    if (row >= _nodes.size() ||
+        _nodes[row] == nullptr ||
+        (_states[row] & Modified) != 0)
+        return;
+    try {
+        _modifiedRows.push_back(static_cast<std::uint32_t>(row));
+        _states[row] |= Modified;
+    } catch (const std::bad_alloc&) { /* Nil: row is not pushed */ }
+}
+
+void    NodeColumns::markAllModified() noexcept
+{
+    for (std::size_t row = 0; row < _nodes.size(); ++row)
+        markModified(row);
+}
+//-----------------------------------------------------------------------------
+
+/* User Columns *///-----------------------------------------------------------
+int     NodeColumns::addColumn(const QString& name)
+{
+    const auto existing = columnIndex(name);
+    if (existing >= 0)
+        return existing;
+    _columns.emplace_back(_nodes.size(), 0.);
+    _columnNames.push_back(name);
+    return static_cast<int>(_columns.size()) - 1;
+}
+
+int     NodeColumns::columnIndex(const QString& name) const noexcept
+{
+    const auto column = std::find(_columnNames.cbegin(), _columnNames.cend(), name);
+    return column != _columnNames.cend() ? static_cast<int>(column - _columnNames.cbegin()) : -1;
+}
+
+double* NodeColumns::column(int column) noexcept
+{
+    return column >= 0 && column < columnCount() ? _columns[static_cast<std::size_t>(column)].data() : nullptr;
+}
+
+const double*   NodeColumns::column(int column) const noexcept
+{
+    return column >= 0 && column < columnCount() ? _columns[static_cast<std::size_t>(column)].data() : nullptr;
+}
+//-----------------------------------------------------------------------------
+
+/* Graph Synchronization *///--------------------------------------------------
+void    NodeColumns::markItemDirty(qan::Node& node)
+{
+    const auto id = node.get_id();
+    if (!id.is_valid())
+        return;
+    const auto row = static_cast<std::size_t>(id.get_index());
+    if (row >= _nodes.size())
+        resize(std::max(row + 1, _nodes.size() * 2));
+    if (_nodes[row] != &node) {     // Row is created, or reused by a new node
+        removeRow(row);
+        _nodes[row] = &node;
+    }
+    if ((_states[row] & ItemDirty) == 0) {
+        _itemDirtyRows.push_back(static_cast<std::uint32_t>(row));
+        _states[row] |= ItemDirty;
+    }
+}
+
+void    NodeColumns::removeRow(std::size_t row) noexcept
+{
+    if (row >= _nodes.size())
+        return;
+    _nodes[row] = nullptr;
+    _states[row] = 0;       // Note: stale dirty and modified rows entries are skipped when state flag is not set
+    _x[row] = _y[row] = _width[row] = _height[row] = _z[row] = 0.;
+    for (auto& column : _columns)
+        column[row] = 0.;
+}
+
+void    NodeColumns::clear() noexcept
+{
+    _nodes.clear();
+    _states.clear();
+    _itemDirtyRows.clear();
+    _modifiedRows.clear();
+    for (auto v : { &_x, &_y, &_width, &_height, &_z })
+        v->clear();
+    for (auto& column : _columns)
+        column.clear();
+}
+
+void    NodeColumns::pullItems() noexcept
+{
+    for (const auto row : _itemDirtyRows) {
+        if ((_states[row] & ItemDirty) == 0)
+            continue;
+        _states[row] &= ~ItemDirty;
+        if ((_states[row] & Modified) != 0)     // Modified rows win over item modifications
+            continue;
+        const auto node = _nodes[row];
+        const auto item = node != nullptr ? node->getItem() : nullptr;
+        if (item == nullptr)
+            continue;
+        _x[row] = item->x();
+        _y[row] = item->y();
+        _width[row] = item->width();
+        _height[row] = item->height();
+        _z[row] = item->z();
+    }
+    _itemDirtyRows.clear();
+}
+
+std::size_t NodeColumns::pushItems() noexcept
+{
+    std::size_t pushed = 0;
+    for (const auto row : _modifiedRows) {
+        if ((_states[row] & Modified) == 0)
+            continue;
+        _states[row] &= ~Modified;
+        const auto node = _nodes[row];
+        const auto item = node != nullptr ? node->getItem() : nullptr;
+        if (item == nullptr)
+            continue;
+        const QPointF position{_x[row], _y[row]};
+        if (item->position() != position)       // Note: avoid useless geometry notifications
+            item->setPosition(position);
+        if (item->width() != _width[row])
+            item->setWidth(_width[row]);
+        if (item->height() != _height[row])
+            item->setHeight(_height[row]);
+        if (item->z() != _z[row])
+            item->setZ(_z[row]);
+        ++pushed;
+    }
+    _modifiedRows.clear();
+    return pushed;
+}
+
+void    NodeColumns::resize(std::size_t rowCount)
+{
+    _nodes.resize(rowCount, nullptr);
+    _states.resize(rowCount, 0);
+    for (auto v : { &_x, &_y, &_width, &_height, &_z })
+        v->resize(rowCount, 0.);
+    for (auto& column : _columns)
+        column.resize(rowCount, 0.);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNodeColumns.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Qt headers
+#include <QString>
+
+namespace qan { // ::qan
+
+class Node;
+class Graph;
+
+/*! \brief Columnar (structure of arrays) store of node geometry and user scalar properties.
+ *
+ * Rows are indexed by node handle index (see gtpo::node<>::get_id()), every column is a contiguous array
+ * of rowCount() doubles that can be read and written in place by batch (SIMD) algorithms without any
+ * QQuickItem property access. Empty rows (no node, or node without item) are zero filled.
+ *
+ * Store is owned and synchronized by qan::Graph (see qan::Graph::nodeColumnsEnabled):
+ * \li node items geometry modifications are pulled to columns lazily (on qan::Graph::getNodeColumns() and at frame boundary).
+ * \li rows marked modified with markModified() are pushed to node items at next frame boundary (or with qan::Graph::syncNodeColumns()).
+ *
+ * \note x and y are node item position in its parent CS (ie group CS for grouped nodes), same as qan::Node::getGeometry().
+ * \warning Not thread safe, columns must be accessed from GUI thread (or from a job owning a copy).
+ */
+class NodeColumns
+{
+    /*! \name NodeColumns Object Management *///-------------------------------
+    //@{
+public:
+    NodeColumns() noexcept = default;
+    ~NodeColumns() noexcept = default;
+    NodeColumns(const NodeColumns&) = delete;
+    NodeColumns& operator=(const NodeColumns&) = delete;
+
+public:
+    //! Number of rows in every column (node handle index upper bound).
+    inline std::size_t  rowCount() const noexcept { return _nodes.size(); }
+    //! Node stored in \c row, nullptr for an empty row.
+    inline qan::Node*   node(std::size_t row) const noexcept { return row < _nodes.size() ? _nodes[row] : nullptr; }
+    //! Return row of \c node (node handle index), or rowCount() if \c node is not stored.
+    std::size_t         rowOf(const qan::Node& node) const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Geometry Columns *///--------------------------------------------
+    //@{
+public:
+    inline double*          x() noexcept { return _x.data(); }
+    inline const double*    x() const noexcept { return _x.data(); }
+    inline double*          y() noexcept { return _y.data(); }
+    inline const double*    y() const noexcept { return _y.data(); }
+    inline double*          width() noexcept { return _width.data(); }
+    inline const double*    width() const noexcept { return _width.data(); }
+    inline double*          height() noexcept { return _height.data(); }
+    inline const double*    height() const noexcept { return _height.data(); }
+    inline double*          z() noexcept { return _z.data(); }
+    inline const double*    z() const noexcept { return _z.data(); }
+
+    /*! \brief Mark \c row geometry (x, y, width, height, z) modified, it will be pushed to node item on next synchronization.
+     *
+     * \note Modified rows take precedence over concurrent item modifications.
+     */
+    void                    markModified(std::size_t row) noexcept;
+    //! Mark all non empty rows modified.
+    void                    markAllModified() noexcept;
+    //! Return true if at least one row is waiting to be pushed to its node item.
+    inline bool             isModified() const noexcept { return !_modifiedRows.empty(); }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name User Columns *///------------------------------------------------
+    //@{
+public:
+    /*! \brief Add a zero filled user scalar column named \c name and return its index (existing column index if \c name is already used).
+     *
+     * User columns are never synchronized with items, they are cleared when a row node is removed.
+     */
+    int                     addColumn(const QString& name);
+    //! Return index of user column \c name, or -1 if there is no such column.
+    int                     columnIndex(const QString& name) const noexcept;
+    //! Number of user columns.
+    inline int              columnCount() const noexcept { return static_cast<int>(_columns.size()); }
+    //! Return user column \c column data (rowCount() values), nullptr if \c column is invalid.
+    double*                 column(int column) noexcept;
+    const double*           column(int column) const noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Graph Synchronization *///---------------------------------------
+    //@{
+private:
+    friend qan::Graph;
+    //! Mark \c node row item geometry dirty (row is created if \c node is not stored).
+    void                    markItemDirty(qan::Node& node);
+    //! Clear \c row (remove its node).
+    void                    removeRow(std::size_t row) noexcept;
+    //! Clear all rows.
+    void                    clear() noexcept;
+    //! Read item geometry of every dirty row (modified rows are skipped).
+    void                    pullItems() noexcept;
+    //! Write modified rows geometry to their node items, return the number of rows pushed.
+    std::size_t             pushItems() noexcept;
+    //! Grow every column to \c rowCount rows.
+    void                    resize(std::size_t rowCount);
+
+    enum RowState : std::uint8_t {
+        ItemDirty   = 1,
+        Modified    = 2
+    };
+
+    std::vector<qan::Node*>             _nodes;
+    std::vector<std::uint8_t>           _states;
+    std::vector<std::uint32_t>          _itemDirtyRows;
+    std::vector<std::uint32_t>          _modifiedRows;
+    std::vector<double>                 _x;
+    std::vector<double>                 _y;
+    std::vector<double>                 _width;
+    std::vector<double>                 _height;
+    std::vector<double>                 _z;
+    std::vector<std::vector<double>>    _columns;
+    std::vector<QString>                _columnNames;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -35,15 +35,19 @@
 // Std headers
 #include <algorithm>    // std::for_each
 #include <utility>      // std::as_const
+#include <cmath>
+#include <functional>   // std::greater_equal
 
 // Qt headers
 #include <QPainter>
 #include <QPainterPath>
+#include <QTimer>
 
 // QuickQanava headers
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
 #include "./qanGraph.h"
+#include "./qanPortItem.h"
 #include "./qanDraggableCtrl.h"
 
 namespace qan { // ::qan
@@ -92,9 +96,12 @@ qan::AbstractDraggableCtrl& NodeItem::draggableCtrl() { Q_ASSERT(_draggableCtrl!
 auto    NodeItem::getNode() noexcept -> qan::Node* { return _node.data(); }
 auto    NodeItem::getNode() const noexcept -> const qan::Node* { return _node.data(); }
 auto    NodeItem::setNode(qan::Node* node) noexcept -> void {
-    _node = node;
     const auto nodeDraggableCtrl = static_cast<DraggableCtrl*>(_draggableCtrl.get());
     nodeDraggableCtrl->setTarget(node);
+    if ( node != _node.data() ) {
+        _node = node;
+        emit nodeChanged();
+    }
 }
 
 auto    NodeItem::setGraph(qan::Graph* graph) noexcept -> void {
@@ -155,7 +162,7 @@ void    NodeItem::collapseAncestors(bool collapsed)
         // 1. Collect all ancestors of group
         // 2. Filter from ancestors every nodes that are part of this group
         // 3. Collect adjacent edges of selected nodes
-        // 4. Hide selected edges and nodes
+        // 4. Hide selected edges and nodes (in one batch, see qan::Graph::setNodesVisible())
 
     // 1.
     const auto allAncestors = graph->collectAncestorsDfs(*node, true);
@@ -169,21 +176,8 @@ void    NodeItem::collapseAncestors(bool collapsed)
             ancestors.push_back(const_cast<qan::Node*>(ancestor));
     }
 
-    // 3.
-    std::unordered_set<qan::Edge*> ancestorsEdges;
-    for (const auto ancestor: ancestors) {
-        const auto edges = ancestor->collectAdjacentEdges0();
-        //ancestorsEdges.insert(std::inserter += edges;
-        // FIXME use STL std::inserter here ?
-        for (const auto edge : edges)
-            ancestorsEdges.insert(edge);
-    }
-
-    // 4.
-    for (const auto ancestorEdge: ancestorsEdges)
-        ancestorEdge->getItem()->setVisible(collapsed);
-    for (const auto ancestor: ancestors)
-        ancestor->getItem()->setVisible(collapsed);
+    // 3., 4.
+    graph->setNodesVisible(ancestors, collapsed);
 }
 //-----------------------------------------------------------------------------
 
@@ -191,17 +185,17 @@ void    NodeItem::collapseAncestors(bool collapsed)
 void    NodeItem::onWidthChanged()
 {
     configureSelectionItem();
-    if ( _complexBoundingShape )            // Invalidate actual bounding shape
-        emit requestUpdateBoundingShape();
-    else setDefaultBoundingShape();
+    invalidateBoundingShape();
+    if ( _nativeDockLayout )
+        invalidateDockLayout();
 }
 
 void    NodeItem::onHeightChanged()
 {
     configureSelectionItem();
-    if ( _complexBoundingShape )            // Invalidate actual bounding shape
-        emit requestUpdateBoundingShape();
-    else setDefaultBoundingShape();
+    invalidateBoundingShape();
+    if ( _nativeDockLayout )
+        invalidateDockLayout();
 }
 //-----------------------------------------------------------------------------
 
@@ -227,6 +221,29 @@ void    NodeItem::setConnectable(Connectable connectable) noexcept
         emit connectableChanged();
     }
 }
+
+void    NodeItem::setLevelOfDetail(LevelOfDetail levelOfDetail) noexcept
+{
+    if (_levelOfDetail != levelOfDetail) {
+        _levelOfDetail = levelOfDetail;
+        emit levelOfDetailChanged();
+    }
+}
+
+void    NodeItem::setCulled(bool culled) noexcept
+{
+    if (_culled == culled)
+        return;
+    _culled = culled;
+    disconnect(_culledXConnection);
+    disconnect(_culledYConnection);
+    const auto graph = getGraph();
+    if (_culled && graph != nullptr) {
+        _culledXConnection = connect(this, &QQuickItem::xChanged, graph, &qan::Graph::scheduleCullingUpdate);
+        _culledYConnection = connect(this, &QQuickItem::yChanged, graph, &qan::Graph::scheduleCullingUpdate);
+    }
+    emit culledChanged();
+}
 //-----------------------------------------------------------------------------
 
 /* Draggable Management *///---------------------------------------------------
@@ -371,28 +388,45 @@ void    NodeItem::setComplexBoundingShape( bool complexBoundingShape ) noexcept
 {
     if ( complexBoundingShape != _complexBoundingShape ) {
         _complexBoundingShape = complexBoundingShape;
-        if ( !complexBoundingShape )
-            setDefaultBoundingShape();
-        else
-            emit requestUpdateBoundingShape();
+        invalidateBoundingShape();
         emit complexBoundingShapeChanged();
     }
 }
 
+void    NodeItem::setShapeProvider( qan::BoundingShape* shapeProvider ) noexcept
+{
+    if ( shapeProvider == _shapeProvider )
+        return;
+    if ( _shapeProvider )
+        _shapeProvider->disconnect(this);
+    _shapeProvider = shapeProvider;
+    if ( _shapeProvider ) {
+        connect( _shapeProvider, &qan::BoundingShape::invalidated,
+                 this,           &NodeItem::invalidateBoundingShape );
+        connect( _shapeProvider, &QObject::destroyed,
+                 this,           &NodeItem::invalidateBoundingShape );
+    }
+    invalidateBoundingShape();
+    emit shapeProviderChanged();
+}
+
 QPolygonF   NodeItem::getBoundingShape() noexcept
 {
     if ( _boundingShape.isEmpty( ) )
-        _boundingShape = generateDefaultBoundingShape( );
+        _boundingShape = _shapeProvider ? _shapeProvider->getShape(QSizeF{width(), height()}) :
+                                          generateDefaultBoundingShape( );
     return _boundingShape;
 }
 
 QPolygonF    NodeItem::generateDefaultBoundingShape() const
 {
-    // Generate a rounded rectangular intersection shape for this node rect new geometry
-    QPainterPath path;
-    qreal shapeRadius = 5.;
-    path.addRoundedRect(QRectF{ 0., 0., width(), height() }, shapeRadius, shapeRadius);
-    return path.toFillPolygon(QTransform{});
+    // Rounded rectangular intersection shape for this node rect geometry, shared with other default shaped nodes
+    static const auto defaultShape = []() {
+        auto shape = new qan::BoundingShape{};
+        shape->setRadius(defaultBoundingShapeRadius);
+        return shape;
+    }();
+    return defaultShape->getShape(QSizeF{width(), height()});
 }
 
 void    NodeItem::setDefaultBoundingShape()
@@ -400,6 +434,39 @@ void    NodeItem::setDefaultBoundingShape()
     setBoundingShape(generateDefaultBoundingShape());
 }
 
+void    NodeItem::beginResize() noexcept
+{
+    _resizing = true;
+}
+
+void    NodeItem::endResize() noexcept
+{
+    if (!_resizing)
+        return;
+    _resizing = false;
+    if (_boundingShapeDirty) {
+        _boundingShapeDirty = false;
+        invalidateBoundingShape();
+    }
+}
+
+void    NodeItem::invalidateBoundingShape() noexcept
+{
+    const bool complex = _complexBoundingShape && !_shapeProvider;
+    if (_resizing) {
+        _boundingShapeDirty = true;
+        if (!complex)
+            _boundingShape.clear();     // Lazily regenerated in getBoundingShape()
+        return;
+    }
+    if ( complex )                      // Invalidate actual bounding shape
+        emit requestUpdateBoundingShape();
+    else {
+        _boundingShape.clear();         // Lazily regenerated on first hit-test or edge clipping
+        emit boundingShapeChanged();
+    }
+}
+
 void    NodeItem::setBoundingShape(QVariantList boundingShape)
 {
     QPolygonF shape; shape.resize(boundingShape.size());
@@ -412,22 +479,195 @@ void    NodeItem::setBoundingShape(QVariantList boundingShape)
 
 bool    NodeItem::isInsideBoundingShape(QPointF p)
 {
-    if ( _boundingShape.isEmpty() )
-        setBoundingShape(generateDefaultBoundingShape());
-    return _boundingShape.containsPoint(p, Qt::OddEvenFill);
+    return getBoundingShape().containsPoint(p, Qt::OddEvenFill);
+}
+
+const QPolygonF&    NodeItem::getContainerBoundingShape( const QQuickItem* container ) noexcept
+{
+    updateContainerShape(container);
+    return _containerShape.shape;
+}
+
+const QRectF&   NodeItem::getContainerBoundingRect( const QQuickItem* container ) noexcept
+{
+    updateContainerShape(container);
+    return _containerShape.br;
+}
+
+void    NodeItem::updateContainerShape( const QQuickItem* container ) noexcept
+{
+    if ( container == nullptr ) {
+        _containerShape = ContainerShape{};
+        return;
+    }
+    const auto localShape = getBoundingShape();
+    const QPointF origin = mapToItem(container, QPointF{0., 0.});
+    const QPointF corner = mapToItem(container, QPointF{width(), height()});
+
+    auto& cache = _containerShape;
+    if ( cache.container == container &&
+         cache.localShape == localShape ) {     // Fast pointer comparison for an unmodified shape
+        const QPointF delta = origin - cache.origin;
+        const QPointF cornerDelta = corner - cache.corner;
+        if ( qFuzzyCompare(1. + delta.x(), 1. + cornerDelta.x()) &&
+             qFuzzyCompare(1. + delta.y(), 1. + cornerDelta.y()) ) {
+            if ( !delta.isNull() ) {            // Pure translation: clip table is expressed relatively to br center
+                cache.shape.translate(delta);
+                cache.br.translate(delta);
+                cache.origin = origin;
+                cache.corner = corner;
+            }
+            return;
+        }
+    }
+
+    // Full regeneration: map shape, then build angular clip table
+    cache.container = container;
+    cache.localShape = localShape;
+    cache.origin = origin;
+    cache.corner = corner;
+    cache.shape.resize(localShape.size());
+    int p = 0;
+    for ( const auto& point: localShape )
+        cache.shape[p++] = mapToItem(container, point);
+    cache.br = cache.shape.boundingRect();
+    cache.clipPoints.clear();
+    cache.clipAngles.clear();
+
+    auto n = cache.shape.size();
+    if ( n > 1 && cache.shape.first() == cache.shape.last() )
+        --n;                                    // Ignore closing point
+    if ( n < 3 )
+        return;
+    const QPointF center = cache.br.center();
+    std::vector<QPointF>    points;
+    std::vector<qreal>      angles;
+    points.reserve(static_cast<std::size_t>(n));
+    angles.reserve(static_cast<std::size_t>(n));
+    for ( int v = 0; v < n; ++v ) {
+        const QPointF r = cache.shape[v] - center;
+        if ( qFuzzyIsNull(r.x()) && qFuzzyIsNull(r.y()) )
+            return;                             // Center is on shape, use generic clip
+        points.push_back(r);
+        angles.push_back(std::atan2(r.y(), r.x()));
+    }
+    // Shape is star shaped around center if angles are cyclically monotonic with every step in ]0, Pi[
+    static constexpr qreal Pi = 3.14159265358979323846;
+    const auto step = [](qreal from, qreal to) {
+        qreal d = to - from;
+        if ( d <= -Pi )  d += 2. * Pi;
+        if ( d > Pi )    d -= 2. * Pi;
+        return d;
+    };
+    const qreal orientation = step(angles[0], angles[1]) > 0. ? 1. : -1.;
+    for ( std::size_t v = 0; v < points.size(); ++v ) {
+        const qreal d = orientation * step(angles[v], angles[(v + 1) % points.size()]);
+        if ( d <= 0. || d >= Pi )
+            return;                             // Not star shaped, use generic clip
+    }
+    if ( orientation < 0. ) {
+        std::reverse(points.begin(), points.end());
+        std::reverse(angles.begin(), angles.end());
+    }
+    const auto first = std::distance(angles.begin(), std::min_element(angles.begin(), angles.end()));
+    std::rotate(points.begin(), points.begin() + first, points.end());
+    std::rotate(angles.begin(), angles.begin() + first, angles.end());
+    if ( std::adjacent_find(angles.begin(), angles.end(), std::greater_equal<qreal>{}) != angles.end() )
+        return;                                 // Shape wind more than once around center
+    cache.clipPoints = std::move(points);
+    cache.clipAngles = std::move(angles);
+}
+
+QPointF     NodeItem::clipContainerBoundingShape( const QQuickItem* container, const QPointF& target ) noexcept
+{
+    updateContainerShape(container);
+    const auto& cache = _containerShape;
+    const QPointF center = cache.br.center();
+    const QPointF d = target - center;
+
+    // Intersect segment (center, center + d) with shape edge (a, b) expressed relatively to center
+    const auto intersect = [&d](const QPointF& a, const QPointF& b, qreal& t) -> bool {
+        const QPointF e = b - a;
+        const qreal denom = d.x() * e.y() - d.y() * e.x();
+        if ( qFuzzyIsNull(denom) )
+            return false;
+        t = ( a.x() * e.y() - a.y() * e.x() ) / denom;
+        const qreal s = ( a.x() * d.y() - a.y() * d.x() ) / denom;
+        return t >= 0. && t <= 1. && s >= 0. && s <= 1.;
+    };
+
+    qreal t = 0.;
+    if ( !cache.clipPoints.empty() ) {          // Star shaped: binary search the wedge containing d
+        if ( qFuzzyIsNull(d.x()) && qFuzzyIsNull(d.y()) )
+            return center;
+        const auto& angles = cache.clipAngles;
+        const qreal angle = std::atan2(d.y(), d.x());
+        const auto n = angles.size();
+        const auto k = static_cast<std::size_t>(std::distance(angles.begin(), std::upper_bound(angles.begin(), angles.end(), angle)));
+        const auto& a = cache.clipPoints[(k + n - 1) % n];
+        const auto& b = cache.clipPoints[k % n];
+        return intersect(a, b, t) ? center + d * t : center;
+    }
+    // Generic clip: first intersected edge in shape order
+    const auto& shape = cache.shape;
+    for ( int p = 0; p < shape.size() - 1; ++p ) {
+        if ( intersect(shape[p] - center, shape[p + 1] - center, t) )
+            return center + d * t;
+    }
+    return center;
 }
 //-----------------------------------------------------------------------------
 
 /* Port/Dock Management *///---------------------------------------------------
 qan::PortItem*  NodeItem::findPort(const QString& portId) const noexcept
 {
-    for ( const auto port : qAsConst(_ports) ) {   // Note: std::as_const is officially c++17
-        const auto portItem = qobject_cast<qan::PortItem*>(port);
-        if ( portItem &&
-             portItem->getId() == portId )
-            return portItem;
+    const auto port = _portsById.constFind(portId);
+    return port != _portsById.constEnd() ? port->data() : nullptr;
+}
+
+void    NodeItem::indexPort(qan::PortItem& port) noexcept
+{
+    auto& indexed = _portsById[port.getId()];
+    if ( !indexed )                     // Keep first indexed port for duplicate ids
+        indexed = &port;
+}
+
+void    NodeItem::unindexPort(qan::PortItem& port) noexcept
+{
+    const auto indexed = _portsById.find(port.getId());
+    if ( indexed == _portsById.end() ||
+         ( *indexed && indexed->data() != &port ) )
+        return;
+    _portsById.erase(indexed);
+    // Fall back to another port with the same id (rare, slow path)
+    for ( const auto item : qAsConst(_ports) ) {   // Note: std::as_const is officially c++17
+        const auto portItem = qobject_cast<qan::PortItem*>(item);
+        if ( portItem != nullptr &&
+             portItem != &port &&
+             portItem->getId() == port.getId() ) {
+            _portsById.insert(portItem->getId(), portItem);
+            break;
+        }
+    }
+}
+
+void    NodeItem::clearPorts() noexcept
+{
+    for ( const auto port : qAsConst(_ports) ) {
+        if ( port != nullptr ) {
+            disconnect(port, nullptr, this, nullptr);
+            port->setParentItem(nullptr);
+            port->deleteLater();
+        }
+    }
+    _ports.clear();
+    _portsById.clear();
+    for ( std::size_t dock = 0; dock < dockCount; ++dock ) {
+        if ( _dockItems[dock] ) {
+            _dockItems[dock]->deleteLater();
+            setDock(static_cast<Dock>(dock), nullptr);
+        }
     }
-    return nullptr;
 }
 
 void    NodeItem::setLeftDock( QQuickItem* leftDock ) noexcept
@@ -498,6 +738,109 @@ void    NodeItem::configureDock(QQuickItem& dockItem, const Dock dock) noexcept
     dockItem.setProperty("dockType",
                          QVariant::fromValue(dock));
 }
+
+void    NodeItem::setNativeDockLayout(bool nativeDockLayout) noexcept
+{
+    if ( nativeDockLayout == _nativeDockLayout )
+        return;
+    _nativeDockLayout = nativeDockLayout;
+    // Move existing ports from QML docks to this item (or back to their dock item)
+    for ( const auto item : qAsConst(_ports) ) {
+        const auto port = qobject_cast<qan::PortItem*>(item);
+        if ( port == nullptr )
+            continue;
+        const auto dockItem = getDock(port->getDockType());
+        if ( _nativeDockLayout ) {
+            port->setParentItem(this);
+            port->setZ(1.5);    // On top of selection item (z=1.0), under node resizer (z=2.0)
+        } else if ( dockItem != nullptr )
+            port->setParentItem(dockItem);
+    }
+    for ( auto& dockItem : _dockItems )
+        if ( dockItem )
+            dockItem->setVisible(!_nativeDockLayout);
+    invalidateDockLayout();
+    emit nativeDockLayoutChanged();
+}
+
+void    NodeItem::setDockSpacing(qreal dockSpacing) noexcept
+{
+    if ( !qFuzzyCompare(1. + dockSpacing, 1. + _dockSpacing) ) {
+        _dockSpacing = dockSpacing;
+        invalidateDockLayout();
+        emit dockSpacingChanged();
+    }
+}
+
+void    NodeItem::setDockMargin(qreal dockMargin) noexcept
+{
+    if ( !qFuzzyCompare(1. + dockMargin, 1. + _dockMargin) ) {
+        _dockMargin = dockMargin;
+        invalidateDockLayout();
+        emit dockMarginChanged();
+    }
+}
+
+void    NodeItem::invalidateDockLayout() noexcept
+{
+    if ( !_nativeDockLayout ||
+         _dockLayoutPending )       // Merge resize and ports insertion in a single layout
+        return;
+    _dockLayoutPending = true;
+    QTimer::singleShot(0, this, &NodeItem::layoutDocks);
+}
+
+void    NodeItem::layoutDocks() noexcept
+{
+    _dockLayoutPending = false;
+    if ( !_nativeDockLayout )
+        return;
+    // 1. Collect ports per dock, with ports length along and thickness across their dock.
+    std::array<std::vector<qan::PortItem*>, dockCount> dockPorts;
+    std::array<qreal, dockCount> lengths{}, thicknesses{};
+    const auto isHorizontal = [](std::size_t d) {
+        return d == static_cast<std::size_t>(Dock::Top) ||
+               d == static_cast<std::size_t>(Dock::Bottom);
+    };
+    for ( const auto item : qAsConst(_ports) ) {
+        const auto port = qobject_cast<qan::PortItem*>(item);
+        if ( port == nullptr ||
+             port->parentItem() != this )   // Port is not natively docked
+            continue;
+        const auto d = static_cast<std::size_t>(port->getDockType());
+        if ( d >= dockCount )
+            continue;
+        lengths[d] += isHorizontal(d) ? port->width() : port->height();
+        thicknesses[d] = std::max(thicknesses[d], isHorizontal(d) ? port->height() : port->width());
+        dockPorts[d].push_back(port);
+    }
+
+    // 2. Center ports on their node side, ports are centered across their dock.
+    //    Note: ports position changes are notified to their edges, that are updated in a single batch
+    //    with qan::Graph::scheduleEdgeItemUpdate().
+    for ( std::size_t d = 0; d < dockCount; ++d ) {
+        const auto& ports = dockPorts[d];
+        if ( ports.empty() )
+            continue;
+        const auto horizontal = isHorizontal(d);
+        const auto length = lengths[d] + _dockSpacing * static_cast<qreal>(ports.size() - 1);
+        auto along = ( ( horizontal ? width() : height() ) - length ) / 2.;
+        qreal across = 0.;
+        switch ( static_cast<Dock>(d) ) {
+        case Dock::Left:    // Fallthrough
+        case Dock::Top:     across = -_dockMargin - thicknesses[d];     break;
+        case Dock::Right:   across = width() + _dockMargin;             break;
+        case Dock::Bottom:  across = height() + _dockMargin;            break;
+        }
+        for ( const auto port : ports ) {
+            const auto portLength = horizontal ? port->width() : port->height();
+            const auto portAcross = across + ( thicknesses[d] - ( horizontal ? port->height() : port->width() ) ) / 2.;
+            port->setPosition(horizontal ? QPointF{along, portAcross} :
+                                           QPointF{portAcross, along});
+            along += portLength + _dockSpacing;
+        }
+    }
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
@@ -37,6 +37,7 @@
 // Std headers
 #include <cstddef>  // std::size_t
 #include <array>
+#include <vector>
 
 // Qt headers
 #include <QQuickItem>
@@ -44,6 +45,7 @@
 #include <QPolygonF>
 #include <QDrag>
 #include <QPointer>
+#include <QHash>
 
 // QuickQanava headers
 #include "./qanGraphConfig.h"
@@ -53,6 +55,7 @@
 #include "./qanSelectable.h"
 #include "./qanDraggable.h"
 #include "./qanAbstractDraggableCtrl.h"
+#include "./qanBoundingShape.h"
 
 namespace qan { // ::qan
 
@@ -74,6 +77,9 @@ class Graph;
  *
  * Optionally, you could choose to set \c complexBoundingShape to false and override \c generateDefaultBoundingShape() method.
  *
+ * For common non rectangular shapes, prefer setting a native qan::BoundingShape \c shapeProvider: shapes are then
+ * generated lazily on first hit-test or edge clipping, and shared between nodes of the same size.
+ *
  * \warning NodeItem \c objectName property is set to "qan::NodeItem" and should not be changed in subclasses.
  *
  * \nosubgrouping
@@ -106,12 +112,15 @@ protected:
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY( qan::Node* node READ getNode CONSTANT FINAL )
+    Q_PROPERTY( qan::Node* node READ getNode NOTIFY nodeChanged FINAL )
     auto        getNode() noexcept -> qan::Node*;
     auto        getNode() const noexcept -> const qan::Node*;
-    auto        setNode(qan::Node* node) noexcept -> void;
+    virtual auto    setNode(qan::Node* node) noexcept -> void;
 private:
     QPointer<qan::Node> _node{nullptr};
+signals:
+    //! Emitted when item is bound to another node (recycled items, see qan::Graph::itemPoolSize).
+    void        nodeChanged();
 
 public:
     //! Secure shortcut to getNode().getGraph().
@@ -252,6 +261,54 @@ protected:
 signals:
     //! \copydoc connectable
     void            connectableChanged();
+
+public:
+    //! Node item representation complexity, set by qan::Graph from actual view zoom (see qan::Graph::levelOfDetail).
+    enum class LevelOfDetail : int {
+        //! Full delegate with label, content, border and effects.
+        Full        = 0,
+        //! Simplified delegate: background and border only, no label, no effect.
+        Simplified  = 1,
+        //! Flat rectangle, eventually drawn by qan::NodeBatchRenderer instead of the node delegate.
+        Flat        = 2
+    };
+    Q_ENUM(LevelOfDetail)
+
+    /*! \brief Node delegate representation complexity (default to Full), read-only from QML, set by qan::Graph.
+     *
+     * Delegates should bind their rich content to levelOfDetail, see RectNodeTemplate.qml: label and content are
+     * hidden and effects are disabled below Full.
+     */
+    Q_PROPERTY( LevelOfDetail levelOfDetail READ getLevelOfDetail NOTIFY levelOfDetailChanged FINAL )
+    //! \copydoc levelOfDetail
+    inline LevelOfDetail    getLevelOfDetail() const noexcept { return _levelOfDetail; }
+    //! \copydoc levelOfDetail
+    void                    setLevelOfDetail( LevelOfDetail levelOfDetail ) noexcept;
+protected:
+    //! \copydoc levelOfDetail
+    LevelOfDetail           _levelOfDetail{LevelOfDetail::Full};
+signals:
+    //! \copydoc levelOfDetail
+    void                    levelOfDetailChanged();
+
+public:
+    /*! \brief True when node item lies fully outside graph view culling area (default to false), read-only from QML, set by qan::Graph.
+     *
+     * Delegates should hide their expensive content (usually label text) when culled, see qan::Graph::viewportCulling.
+     */
+    Q_PROPERTY( bool culled READ getCulled NOTIFY culledChanged FINAL )
+    //! \copydoc culled
+    inline bool             getCulled() const noexcept { return _culled; }
+    //! \copydoc culled
+    void                    setCulled( bool culled ) noexcept;
+private:
+    //! \copydoc culled
+    bool                    _culled = false;
+    //! Culled item position is monitored to update culling when item is moved programmatically.
+    QMetaObject::Connection _culledXConnection, _culledYConnection;
+signals:
+    //! \copydoc culled
+    void                    culledChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -337,6 +394,20 @@ private:
 signals:
     void            complexBoundingShapeChanged( );
 
+public:
+    /*! \brief Native bounding shape generator (default to nullptr, ie default rounded rectangle or complex bounding shape).
+     *
+     * When a provider is set, \c requestUpdateBoundingShape() is not emitted and \c complexBoundingShape is ignored, the bounding
+     * shape is fetched lazily from qan::BoundingShape shared cache.
+     */
+    Q_PROPERTY( qan::BoundingShape* shapeProvider READ getShapeProvider WRITE setShapeProvider NOTIFY shapeProviderChanged FINAL )
+    inline qan::BoundingShape*  getShapeProvider() const noexcept { return _shapeProvider.data(); }
+    void                        setShapeProvider( qan::BoundingShape* shapeProvider ) noexcept;
+private:
+    QPointer<qan::BoundingShape>    _shapeProvider;
+signals:
+    void                        shapeProviderChanged();
+
 public:
     /*! \brief Polygon used for mouse event clipping, and edge arrow clipping.
      *
@@ -352,7 +423,29 @@ signals:
     void                boundingShapeChanged();
     //! signal is Emitted when the bounding shape become invalid and should be regenerated from QML.
     void                requestUpdateBoundingShape();
+public:
+    //! Corner radius of the rounded rectangle generated by generateDefaultBoundingShape().
+    static constexpr qreal  defaultBoundingShapeRadius = 5.;
+
+public:
+    /*! \brief Begin an interactive resize transaction (called by Qan.GraphView node and group resizers).
+     *
+     * During a resize transaction, default bounding shape is lazily regenerated when accessed, and
+     * \c requestUpdateBoundingShape() is emitted only once from endResize() for complex bounding shapes.
+     * Adjacent edges are updated using qan::Graph dirty edge scheduler (at most once per frame).
+     */
+    Q_INVOKABLE void    beginResize() noexcept;
+    //! End a resize transaction started with beginResize() and regenerate bounding shape if node has been resized.
+    Q_INVOKABLE void    endResize() noexcept;
+    //! Return true if a resize transaction is in progress.
+    inline bool         isResizing() const noexcept { return _resizing; }
+private:
+    //! Invalidate bounding shape after a width or height change (deferred to endResize() while resizing).
+    void                invalidateBoundingShape() noexcept;
+    bool                _resizing = false;
+    bool                _boundingShapeDirty = false;
 protected:
+    //! Generate a rounded rectangle bounding shape for current node size (polygons are shared between nodes of the same size).
     QPolygonF           generateDefaultBoundingShape() const;
     //! Generate a default bounding shape (rounded rectangle) and set it as current bounding shape.
     Q_INVOKABLE void    setDefaultBoundingShape();
@@ -391,6 +484,42 @@ protected:
      *  \sa setBoundShapeFrom()
      */
     Q_INVOKABLE virtual bool    isInsideBoundingShape( QPointF p );
+
+public:
+    /*! \brief Return node bounding shape mapped in \c container CS.
+     *
+     * Mapped shape is cached: it is regenerated only when the bounding shape, \c container or item transformation
+     * change, a pure translation of the item (including ancestors moves) just translate the cached polygon.
+     */
+    const QPolygonF&    getContainerBoundingShape( const QQuickItem* container ) noexcept;
+    //! Return getContainerBoundingShape() bounding rect (cached).
+    const QRectF&       getContainerBoundingRect( const QQuickItem* container ) noexcept;
+
+    /*! \brief Clip segment (container bounding rect center, \c target) against container bounding shape.
+     *
+     * \return segment intersection point with bounding shape in \c container CS, or container bounding
+     * rect center if there is no intersection (ie \c target is inside the shape).
+     * \note For shapes that are star shaped around their bounding rect center (all convex shapes, and most
+     * round or diamond shapes), clipping is O(log(n)) with a binary search in a cached angular table,
+     * otherwise every shape edge is tested.
+     */
+    QPointF             clipContainerBoundingShape( const QQuickItem* container, const QPointF& target ) noexcept;
+
+private:
+    //! Update _containerShape cache for \c container.
+    void                updateContainerShape( const QQuickItem* container ) noexcept;
+
+    struct ContainerShape {
+        QPointer<const QQuickItem>  container;
+        QPolygonF           localShape;         // Implicitly shared copy of _boundingShape used to detect shape changes
+        QPointF             origin, corner;     // Item (0, 0) and (width, height) in container CS
+        QPolygonF           shape;
+        QRectF              br;
+        // Shape vertices relative to br center, sorted by angle (empty if shape is not star shaped around br center)
+        std::vector<QPointF>    clipPoints;
+        std::vector<qreal>      clipAngles;
+    };
+    ContainerShape      _containerShape;
     //@}
     //-------------------------------------------------------------------------
 
@@ -399,9 +528,19 @@ protected:
 public:
     using PortItems = qcm::Container<QVector, QQuickItem*>;    // Using QQuickItem instead of qan::PortItem because MSVC15 does not fully support complete c++14 forward declarations
 
-    //! Look for a port with a given \c id (or nullptr if no such port exists).
+    //! Look for a port with a given \c id (or nullptr if no such port exists), O(1) lookup in ports id index.
     Q_INVOKABLE qan::PortItem*  findPort(const QString& portId) const noexcept;
 
+    /*! \brief Add \c port to this node ports id index (called by qan::Graph::insertPort() and qan::PortItem::setId()).
+     *
+     * When multiple ports share the same id, the first indexed port is returned by findPort().
+     */
+    void                indexPort(qan::PortItem& port) noexcept;
+    //! Remove \c port from this node ports id index (called by qan::Graph::removePort() and qan::PortItem::setId()).
+    void                unindexPort(qan::PortItem& port) noexcept;
+    //! Destroy all ports and dock items (used when item is recycled, caller must unindex ports from graph).
+    void                clearPorts() noexcept;
+
     //! Read-only list model of this node ports (either in or out).
     Q_PROPERTY( QAbstractListModel* ports READ getPortsModel CONSTANT FINAL )
     QAbstractListModel* getPortsModel() { return qobject_cast<QAbstractListModel*>( _ports.getModel() ); }
@@ -409,6 +548,8 @@ public:
     inline auto         getPorts() const noexcept -> const PortItems& { return _ports; }
 private:
     PortItems           _ports;
+    //! Ports indexed by id, maintained by qan::Graph (see findPort()).
+    QHash<QString, QPointer<qan::PortItem>> _portsById;
 
 public:
     //! Define port dock type/index/position.
@@ -476,6 +617,64 @@ protected:
 private:
     static constexpr unsigned int dockCount = 4;
     std::array<QPointer<QQuickItem>, dockCount> _dockItems;
+
+public:
+    /*! \brief Lay out ports natively from node geometry instead of using QML dock items (default to false).
+     *
+     * When true, qan::Graph::insertPort() does not create dock items from graph \c horizontalDockDelegate and
+     * \c verticalDockDelegate, ports are direct children of this node item and all ports of all docks are positioned
+     * in one pass (same geometry as Qan.HorizontalDock and Qan.VerticalDock: ports are centered on their node side,
+     * \c dockMargin away from node border and \c dockSpacing apart). Layout is recomputed only when node or ports
+     * size change and when ports are inserted or removed, at most once per event loop iteration. Edges bound to
+     * moved ports are then updated in a single qan::Graph batched edge update.
+     *
+     * Prefer native dock layout for nodes with many ports (dataflow nodes), QML RowLayout and ColumnLayout docks
+     * re-layout and notify every port on each node resize.
+     */
+    Q_PROPERTY( bool nativeDockLayout READ getNativeDockLayout WRITE setNativeDockLayout NOTIFY nativeDockLayoutChanged FINAL )
+    //! \copydoc nativeDockLayout
+    inline bool             getNativeDockLayout() const noexcept { return _nativeDockLayout; }
+    //! \copydoc nativeDockLayout
+    void                    setNativeDockLayout(bool nativeDockLayout) noexcept;
+private:
+    bool                    _nativeDockLayout = false;
+signals:
+    //! \copydoc nativeDockLayout
+    void                    nativeDockLayoutChanged();
+
+public:
+    //! Space between two consecutive ports of a native dock (default to 15., see nativeDockLayout).
+    Q_PROPERTY( qreal dockSpacing READ getDockSpacing WRITE setDockSpacing NOTIFY dockSpacingChanged FINAL )
+    //! \copydoc dockSpacing
+    inline qreal            getDockSpacing() const noexcept { return _dockSpacing; }
+    //! \copydoc dockSpacing
+    void                    setDockSpacing(qreal dockSpacing) noexcept;
+private:
+    qreal                   _dockSpacing = 15.;
+signals:
+    //! \copydoc dockSpacing
+    void                    dockSpacingChanged();
+
+public:
+    //! Space between native docks ports and node border (default to 7., see nativeDockLayout).
+    Q_PROPERTY( qreal dockMargin READ getDockMargin WRITE setDockMargin NOTIFY dockMarginChanged FINAL )
+    //! \copydoc dockMargin
+    inline qreal            getDockMargin() const noexcept { return _dockMargin; }
+    //! \copydoc dockMargin
+    void                    setDockMargin(qreal dockMargin) noexcept;
+private:
+    qreal                   _dockMargin = 7.;
+signals:
+    //! \copydoc dockMargin
+    void                    dockMarginChanged();
+
+public:
+    //! Schedule a native dock layout (called automatically on node or ports resize and ports insertion/removal).
+    void                    invalidateDockLayout() noexcept;
+    //! Immediately position all native docks ports (no-op when nativeDockLayout is false).
+    void                    layoutDocks() noexcept;
+private:
+    bool                    _dockLayoutPending = false;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -0,0 +1,493 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanOrthoRouter.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::sort std::unique std::lower_bound
+#include <cmath>        // std::fabs
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+
+// Qt headers
+#include <QTimer>
+#include <QThreadPool>
+#include <QRunnable>
+
+// QuickQanava headers
+#include "./qanOrthoRouter.h"
+#include "./qanGraph.h"
+#include "./qanEdgeItem.h"
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+//! Shared between a router and its running workers, worker results are only posted while router is alive.
+struct OrthoRouter::Guard {
+    std::mutex          mutex;
+    qan::OrthoRouter*   router = nullptr;
+};
+
+namespace { // ::qan::anonymous
+
+class RouteRunnable : public QRunnable
+{
+public:
+    RouteRunnable(std::shared_ptr<qan::OrthoRouter::Guard> guard, std::vector<qan::OrthoRouter::Job> jobs,
+                  qreal margin, qreal bendPenalty) :
+        QRunnable{}, _guard{std::move(guard)}, _jobs{std::move(jobs)},
+        _margin{margin}, _bendPenalty{bendPenalty} { setAutoDelete(true); }
+
+    virtual void run() override {
+        for (auto& job : _jobs)
+            job.route = qan::OrthoRouter::routeOrtho(job.obstacles, job.srcBr, job.dstBr, _margin, _bendPenalty);
+        std::lock_guard<std::mutex> lock{_guard->mutex};
+        if (_guard->router == nullptr)
+            return;
+        const auto router = _guard->router;
+        QMetaObject::invokeMethod(router, [router, jobs = std::move(_jobs)]() mutable {
+            router->routesReady(std::move(jobs));
+        }, Qt::QueuedConnection);
+    }
+
+private:
+    std::shared_ptr<qan::OrthoRouter::Guard>    _guard;
+    std::vector<qan::OrthoRouter::Job>          _jobs;
+    qreal                                       _margin = 10.;
+    qreal                                       _bendPenalty = 40.;
+};
+
+} // ::qan::anonymous
+
+/* OrthoRouter Object Management *///------------------------------------------
+OrthoRouter::OrthoRouter(qan::Graph* graph) :
+    QObject{graph},
+    _graph{graph},
+    _guard{std::make_shared<Guard>()}
+{
+    _guard->router = this;
+}
+
+OrthoRouter::~OrthoRouter()
+{
+    std::lock_guard<std::mutex> lock{_guard->mutex};
+    _guard->router = nullptr;       // Running workers results are dropped
+}
+
+void    OrthoRouter::setMargin(qreal margin) noexcept
+{
+    margin = std::max(0., margin);
+    if (!qFuzzyCompare(1. + margin, 1. + _margin)) {
+        _margin = margin;
+        emit marginChanged();
+        invalidate();
+    }
+}
+
+void    OrthoRouter::setBendPenalty(qreal bendPenalty) noexcept
+{
+    bendPenalty = std::max(0., bendPenalty);
+    if (!qFuzzyCompare(1. + bendPenalty, 1. + _bendPenalty)) {
+        _bendPenalty = bendPenalty;
+        emit bendPenaltyChanged();
+        invalidate();
+    }
+}
+
+void    OrthoRouter::setSearchMargin(qreal searchMargin) noexcept
+{
+    searchMargin = std::max(0., searchMargin);
+    if (!qFuzzyCompare(1. + searchMargin, 1. + _searchMargin)) {
+        _searchMargin = searchMargin;
+        emit searchMarginChanged();
+        invalidate();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Edge Routing *///-----------------------------------------------------------
+QPolygonF   OrthoRouter::route(qan::EdgeItem* edgeItem, const QRectF& srcBr, const QRectF& dstBr) noexcept
+{
+    if (edgeItem == nullptr)
+        return QPolygonF{};
+    auto route = _routes.find(edgeItem);
+    if (route == _routes.end()) {
+        route = _routes.emplace(edgeItem, Route{}).first;
+        route->second.edgeItem = edgeItem;
+        connect(edgeItem, &QObject::destroyed, this, [this, edgeItem]() { removeRoute(edgeItem); });
+    }
+    if (route->second.valid &&
+        route->second.srcBr == srcBr &&
+        route->second.dstBr == dstBr)
+        return route->second.points;
+    // Route is outdated: edge ends has been moved or resized, use default geometry until edge is rerouted
+    route->second.valid = false;
+    route->second.srcBr = srcBr;
+    route->second.dstBr = dstBr;
+    requestRoute(edgeItem);
+    return QPolygonF{};
+}
+
+void    OrthoRouter::obstacleModified(const QQuickItem* item) noexcept
+{
+    if (item == nullptr ||
+        !_graph ||
+        item->parentItem() != _graph->getContainerItem() ||
+        qobject_cast<const qan::NodeItem*>(item) == nullptr)     // Only ungrouped nodes and root groups are obstacles
+        return;
+    // Note: a move usually modify x and y, modifications are coalesced until next launchRequests()
+    if (_modifiedObstacles.insert(item).second)
+        scheduleLaunch();
+}
+
+void    OrthoRouter::rerouteModifiedObstacles() noexcept
+{
+    for (const auto item : _modifiedObstacles) {
+        const auto rect = containerRect(item);
+        auto& previousRect = _obstacleRects[item];
+        for (const auto& route : _routes) {
+            if (!route.second.valid)
+                continue;
+            if (route.second.corridor.intersects(rect) ||
+                ( !previousRect.isNull() && route.second.corridor.intersects(previousRect) ))
+                requestRoute(route.first);
+        }
+        previousRect = rect;
+    }
+    _modifiedObstacles.clear();
+}
+
+void    OrthoRouter::invalidate() noexcept
+{
+    for (auto& route : _routes)
+        requestRoute(route.first);
+}
+
+void    OrthoRouter::requestRoute(const qan::EdgeItem* edgeItem) noexcept
+{
+    auto route = _routes.find(edgeItem);
+    if (route == _routes.end())
+        return;
+    route->second.generation = ++_generation;   // Results of running request for this edge will be dropped
+    _requests.insert(edgeItem);
+    scheduleLaunch();
+}
+
+void    OrthoRouter::scheduleLaunch() noexcept
+{
+    if (!_launchScheduled) {
+        _launchScheduled = true;
+        QTimer::singleShot(0, this, [this]() { launchRequests(); });
+    }
+}
+
+void    OrthoRouter::launchRequests() noexcept
+{
+    _launchScheduled = false;
+    rerouteModifiedObstacles();
+    if (_requests.empty())
+        return;
+    const auto container = _graph ? _graph->getContainerItem() : nullptr;
+    if (container == nullptr) {
+        _requests.clear();
+        return;
+    }
+    std::vector<Job> jobs;
+    jobs.reserve(_requests.size());
+    for (const auto request : _requests) {
+        const auto route = _routes.find(request);
+        if (route == _routes.end() ||
+            !route->second.edgeItem)
+            continue;
+        const auto edgeItem = route->second.edgeItem.data();
+        const auto srcItem = edgeItem->getSourceItem();
+        const auto dstItem = edgeItem->getDestinationItem();
+        if (srcItem == nullptr || dstItem == nullptr)
+            continue;
+        // Use actual ends rects (edge might not have been updated since request)
+        const auto srcBr = srcItem->getContainerBoundingRect(container);
+        const auto dstBr = dstItem->getContainerBoundingRect(container);
+        route->second.srcBr = srcBr;
+        route->second.dstBr = dstBr;
+
+        Job job;
+        job.edgeItem = request;
+        job.generation = route->second.generation;
+        job.srcBr = srcBr;
+        job.dstBr = dstBr;
+        const auto searchRect = srcBr.united(dstBr).adjusted(-_searchMargin, -_searchMargin, _searchMargin, _searchMargin);
+        for (const auto obstacle : _graph->graphChildrenIn(searchRect)) {
+            if (qobject_cast<const qan::NodeItem*>(obstacle) == nullptr ||
+                obstacle == srcItem || obstacle == dstItem ||
+                obstacle->isAncestorOf(srcItem) ||      // Edge ends group are not obstacles
+                obstacle->isAncestorOf(dstItem) ||
+                !obstacle->isVisible())
+                continue;
+            const auto rect = containerRect(obstacle);
+            _obstacleRects[obstacle] = rect;
+            job.obstacles.push_back(rect);
+        }
+        jobs.push_back(std::move(job));
+    }
+    _requests.clear();
+    if (jobs.empty())
+        return;
+    ++_runningCount;
+    QThreadPool::globalInstance()->start(new RouteRunnable{_guard, std::move(jobs), _margin, _bendPenalty});
+}
+
+void    OrthoRouter::routesReady(std::vector<Job> jobs) noexcept
+{
+    --_runningCount;
+    for (auto& job : jobs) {
+        const auto route = _routes.find(job.edgeItem);
+        if (route == _routes.end() ||
+            route->second.generation != job.generation)   // Edge has been rerouted since this job has been launched
+            continue;
+        route->second.valid = true;
+        route->second.srcBr = job.srcBr;
+        route->second.dstBr = job.dstBr;
+        route->second.points = std::move(job.route);
+        const auto margin = _margin;
+        route->second.corridor = route->second.points.boundingRect().united(job.srcBr).united(job.dstBr).
+                                 adjusted(-margin, -margin, margin, margin);
+        if (route->second.edgeItem)
+            route->second.edgeItem->routeModified();
+    }
+}
+
+void    OrthoRouter::removeRoute(const qan::EdgeItem* edgeItem) noexcept
+{
+    // Note: edgeItem is being destroyed, it must not be dereferenced
+    _routes.erase(edgeItem);
+    _requests.erase(edgeItem);
+}
+
+QRectF  OrthoRouter::containerRect(const QQuickItem* item) const noexcept
+{
+    const auto container = _graph ? _graph->getContainerItem() : nullptr;
+    if (item == nullptr ||
+        container == nullptr)
+        return QRectF{};
+    return QRectF{ item->mapToItem(container, QPointF{0., 0.}), QSizeF{item->width(), item->height()} };
+}
+
+QPolygonF   OrthoRouter::routeOrtho(const std::vector<QRectF>& obstacles,
+                                    const QRectF& srcBr, const QRectF& dstBr,
+                                    qreal margin, qreal bendPenalty) noexcept
+{
+    // Algorithm:
+        // 1. Build a sparse orthogonal visibility grid from inflated obstacles borders and ends centers and borders:
+        //    between two consecutive grid lines, an obstacle either cover the whole grid cell or do not intersect it,
+        //    a grid segment is blocked if its center is strictly inside an obstacle.
+        // 2. A* search from source center to destination center with (grid point, direction) states, a bend cost
+        //    bendPenalty, heuristic is manhattan distance (admissible).
+        // 3. Simplify collinear points and clip route on source and destination rects borders.
+    if (!srcBr.isValid() ||
+        !dstBr.isValid() ||
+        srcBr.intersects(dstBr))
+        return QPolygonF{};
+    const QPointF src = srcBr.center();
+    const QPointF dst = dstBr.center();
+
+    std::vector<QRectF> inflated;
+    inflated.reserve(obstacles.size());
+    for (const auto& obstacle : obstacles) {
+        const auto rect = obstacle.adjusted(-margin, -margin, margin, margin);
+        if (!rect.contains(src) &&      // Overlapping ends are ignored
+            !rect.contains(dst))
+            inflated.push_back(rect);
+    }
+
+    // 1.
+    std::vector<qreal> xs{src.x(), dst.x(), srcBr.left() - margin, srcBr.right() + margin,
+                                            dstBr.left() - margin, dstBr.right() + margin};
+    std::vector<qreal> ys{src.y(), dst.y(), srcBr.top() - margin, srcBr.bottom() + margin,
+                                            dstBr.top() - margin, dstBr.bottom() + margin};
+    for (const auto& rect : inflated) {
+        xs.push_back(rect.left());  xs.push_back(rect.right());
+        ys.push_back(rect.top());   ys.push_back(rect.bottom());
+    }
+    const auto uniqueSorted = [](std::vector<qreal>& v) {
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end(), [](qreal a, qreal b) { return std::fabs(b - a) < 0.001; }), v.end());
+    };
+    uniqueSorted(xs);
+    uniqueSorted(ys);
+    const auto indexOf = [](const std::vector<qreal>& v, qreal c) {
+        const auto it = std::lower_bound(v.begin(), v.end(), c - 0.001);
+        return static_cast<int>(std::distance(v.begin(), it));
+    };
+    const int nx = static_cast<int>(xs.size());
+    const int ny = static_cast<int>(ys.size());
+    const auto nodeId = [nx](int i, int j) { return j * nx + i; };
+    const int srcNode = nodeId(indexOf(xs, src.x()), indexOf(ys, src.y()));
+    const int dstNode = nodeId(indexOf(xs, dst.x()), indexOf(ys, dst.y()));
+
+    const auto strictlyInside = [&inflated](qreal x, qreal y) {
+        for (const auto& rect : inflated)
+            if (x > rect.left() && x < rect.right() &&
+                y > rect.top() && y < rect.bottom())
+                return true;
+        return false;
+    };
+    const auto nodeCount = static_cast<std::size_t>(nx) * static_cast<std::size_t>(ny);
+    std::vector<std::uint8_t> blocked(nodeCount, 0);      // Bit 0: node, 1: +x segment, 2: +y segment
+    for (int j = 0; j < ny; ++j)
+        for (int i = 0; i < nx; ++i) {
+            std::uint8_t b = strictlyInside(xs[i], ys[j]) ? 1 : 0;
+            if (i + 1 < nx && strictlyInside(( xs[i] + xs[i + 1] ) * 0.5, ys[j]))
+                b |= 2;
+            if (j + 1 < ny && strictlyInside(xs[i], ( ys[j] + ys[j + 1] ) * 0.5))
+                b |= 4;
+            blocked[static_cast<std::size_t>(nodeId(i, j))] = b;
+        }
+
+    // 2. Directions: 0 +x, 1 -x, 2 +y, 3 -y
+    constexpr auto infinity = std::numeric_limits<qreal>::max();
+    std::vector<qreal> cost(nodeCount * 4, infinity);
+    std::vector<int> previous(nodeCount * 4, -1);
+    using Entry = std::pair<qreal, int>;    // f, state
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    const auto heuristic = [&xs, &ys, &dst, nx](int node) {
+        return std::fabs(xs[static_cast<std::size_t>(node % nx)] - dst.x()) +
+               std::fabs(ys[static_cast<std::size_t>(node / nx)] - dst.y());
+    };
+    for (int d = 0; d < 4; ++d) {
+        cost[static_cast<std::size_t>(srcNode * 4 + d)] = 0.;
+        open.emplace(heuristic(srcNode), srcNode * 4 + d);
+    }
+    int goal = -1;
+    while (!open.empty()) {
+        const auto top = open.top();
+        open.pop();
+        const int state = top.second;
+        const int node = state / 4;
+        const int dir = state % 4;
+        const auto g = cost[static_cast<std::size_t>(state)];
+        if (top.first > g + heuristic(node) + 0.0001)
+            continue;   // Outdated entry
+        if (node == dstNode) {
+            goal = state;
+            break;
+        }
+        const int i = node % nx;
+        const int j = node / nx;
+        for (int d = 0; d < 4; ++d) {
+            int ni = i, nj = j;
+            bool segmentBlocked = true;
+            switch (d) {
+            case 0: ni = i + 1; segmentBlocked = ni >= nx || ( blocked[static_cast<std::size_t>(node)] & 2 ); break;
+            case 1: ni = i - 1; segmentBlocked = ni < 0   || ( blocked[static_cast<std::size_t>(nodeId(ni, j))] & 2 ); break;
+            case 2: nj = j + 1; segmentBlocked = nj >= ny || ( blocked[static_cast<std::size_t>(node)] & 4 ); break;
+            case 3: nj = j - 1; segmentBlocked = nj < 0   || ( blocked[static_cast<std::size_t>(nodeId(i, nj))] & 4 ); break;
+            }
+            if (segmentBlocked)
+                continue;
+            const int next = nodeId(ni, nj);
+            if (next != dstNode &&
+                ( blocked[static_cast<std::size_t>(next)] & 1 ))
+                continue;
+            const auto length = std::fabs(xs[static_cast<std::size_t>(ni)] - xs[static_cast<std::size_t>(i)]) +
+                                std::fabs(ys[static_cast<std::size_t>(nj)] - ys[static_cast<std::size_t>(j)]);
+            const auto nextCost = g + length + ( d != dir && node != srcNode ? bendPenalty : 0. );
+            const int nextState = next * 4 + d;
+            if (nextCost < cost[static_cast<std::size_t>(nextState)]) {
+                cost[static_cast<std::size_t>(nextState)] = nextCost;
+                previous[static_cast<std::size_t>(nextState)] = state;
+                open.emplace(nextCost + heuristic(next), nextState);
+            }
+        }
+    }
+    if (goal < 0)
+        return QPolygonF{};
+
+    // 3.
+    QPolygonF points;
+    for (int state = goal; state >= 0; state = previous[static_cast<std::size_t>(state)]) {
+        const int node = state / 4;
+        const QPointF p{xs[static_cast<std::size_t>(node % nx)], ys[static_cast<std::size_t>(node / nx)]};
+        if (points.isEmpty() || points.last() != p)
+            points.append(p);
+    }
+    std::reverse(points.begin(), points.end());
+    const auto simplify = [](const QPolygonF& polyline) {
+        QPolygonF simplified;
+        for (const auto& p : polyline) {
+            const auto n = simplified.size();
+            if (n >= 2) {
+                const auto& a = simplified[n - 2];
+                const auto& b = simplified[n - 1];
+                if (( qFuzzyCompare(a.x(), b.x()) && qFuzzyCompare(b.x(), p.x()) ) ||
+                    ( qFuzzyCompare(a.y(), b.y()) && qFuzzyCompare(b.y(), p.y()) )) {
+                    simplified[n - 1] = p;
+                    continue;
+                }
+            }
+            simplified.append(p);
+        }
+        return simplified;
+    };
+    points = simplify(points);
+    if (points.size() < 2)
+        return QPolygonF{};
+
+    // Clip route on ends: find last point inside source rect and first point inside destination rect
+    const auto borderPoint = [](const QPointF& inside, const QPointF& outside, const QRectF& rect) {
+        if (qFuzzyCompare(inside.y(), outside.y()))     // Horizontal segment
+            return QPointF{ outside.x() > inside.x() ? rect.right() : rect.left(), inside.y() };
+        return QPointF{ inside.x(), outside.y() > inside.y() ? rect.bottom() : rect.top() };
+    };
+    int srcLast = 0;
+    for (int p = 1; p < points.size(); ++p)
+        if (srcBr.contains(points[p]))
+            srcLast = p;
+    int dstFirst = points.size() - 1;
+    for (int p = dstFirst - 1; p > srcLast; --p)
+        if (dstBr.contains(points[p]))
+            dstFirst = p;
+    if (srcLast + 1 > dstFirst)
+        return QPolygonF{};
+    QPolygonF route;
+    route.reserve(dstFirst - srcLast + 1);
+    route.append(borderPoint(points[srcLast], points[srcLast + 1], srcBr));
+    for (int p = srcLast + 1; p < dstFirst; ++p)
+        route.append(points[p]);
+    route.append(borderPoint(points[dstFirst], points[dstFirst - 1], dstBr));
+    return simplify(route);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,199 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanOrthoRouter.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QPolygonF>
+#include <QRectF>
+#include <QQmlEngine>
+
+QT_BEGIN_NAMESPACE
+class QQuickItem;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+class Graph;
+class EdgeItem;
+
+/*! \brief Obstacle aware orthogonal edge router.
+ *
+ * Router is owned by qan::Graph and enabled with qan::Graph::orthoRouting: orthogonal (qan::EdgeStyle::LineType::Ortho)
+ * edges are then routed around graph container children (ungrouped nodes and root groups), with a margin
+ * of \c margin around obstacles and a cost of \c bendPenalty for every bend.
+ *
+ * Routes are searched with A* on a sparse orthogonal visibility grid built from obstacles borders and edge ends
+ * centers, obstacles are queried with graph spatial index in a region around edge ends extended by \c searchMargin.
+ * Searches run on a worker thread (global QThreadPool) on a snapshot of obstacles rects, an edge item is updated with
+ * qan::EdgeItem::routeModified() when its route is available, default elbow geometry is used until then.
+ *
+ * Routes are incrementally maintained: when an obstacle is moved or resized, only edges whose route corridor
+ * intersects the obstacle previous or actual rect are rerouted.
+ * \nosubgrouping
+ */
+class OrthoRouter : public QObject
+{
+    Q_OBJECT
+    /*! \name OrthoRouter Object Management *///-------------------------------
+    //@{
+public:
+    explicit OrthoRouter(qan::Graph* graph);
+    virtual ~OrthoRouter() override;
+    OrthoRouter(const OrthoRouter&) = delete;
+    OrthoRouter& operator=(const OrthoRouter&) = delete;
+
+public:
+    //! Margin around obstacles (default to 10.).
+    Q_PROPERTY(qreal margin READ getMargin WRITE setMargin NOTIFY marginChanged FINAL)
+    void            setMargin(qreal margin) noexcept;
+    inline qreal    getMargin() const noexcept { return _margin; }
+private:
+    qreal           _margin = 10.;
+signals:
+    void            marginChanged();
+
+public:
+    //! Cost of a bend expressed as an equivalent route length (default to 40.).
+    Q_PROPERTY(qreal bendPenalty READ getBendPenalty WRITE setBendPenalty NOTIFY bendPenaltyChanged FINAL)
+    void            setBendPenalty(qreal bendPenalty) noexcept;
+    inline qreal    getBendPenalty() const noexcept { return _bendPenalty; }
+private:
+    qreal           _bendPenalty = 40.;
+signals:
+    void            bendPenaltyChanged();
+
+public:
+    //! Obstacles are searched in edge ends bounding rect extended by \c searchMargin (default to 200.).
+    Q_PROPERTY(qreal searchMargin READ getSearchMargin WRITE setSearchMargin NOTIFY searchMarginChanged FINAL)
+    void            setSearchMargin(qreal searchMargin) noexcept;
+    inline qreal    getSearchMargin() const noexcept { return _searchMargin; }
+private:
+    qreal           _searchMargin = 200.;
+signals:
+    void            searchMarginChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edge Routing *///------------------------------------------------
+    //@{
+public:
+    /*! \brief Return \c edgeItem route for source and destination rects \c srcBr and \c dstBr (graph container CS).
+     *
+     * Return an empty polygon and request an asynchronous routing when there is no route for actual
+     * \c srcBr and \c dstBr. Returned route start at \c srcBr border and end at \c dstBr border.
+     */
+    QPolygonF       route(qan::EdgeItem* edgeItem, const QRectF& srcBr, const QRectF& dstBr) noexcept;
+
+    //! Reroute edges whose route corridor intersects \c item previous or actual rect (called when an obstacle is modified).
+    void            obstacleModified(const QQuickItem* item) noexcept;
+
+    //! Invalidate all routes (all edges are rerouted).
+    Q_INVOKABLE void    invalidate() noexcept;
+
+    //! Number of pending route requests (including running ones).
+    inline int      getPendingRouteCount() const noexcept { return static_cast<int>(_requests.size()) + _runningCount; }
+
+    /*! \brief Synchronously search an orthogonal route from \c srcBr to \c dstBr avoiding \c obstacles.
+     *
+     * Obstacles are inflated by \c margin, source and destination rects should not be part of \c obstacles.
+     * \return route points from \c srcBr border to \c dstBr border, or an empty polygon if there is no route.
+     * \note Thread safe, cost is O(n² log(n)) where n is the number of obstacles.
+     */
+    static QPolygonF    routeOrtho(const std::vector<QRectF>& obstacles,
+                                   const QRectF& srcBr, const QRectF& dstBr,
+                                   qreal margin, qreal bendPenalty) noexcept;
+
+public:
+    struct Job {
+        const qan::EdgeItem*    edgeItem = nullptr;
+        std::uint64_t           generation = 0;
+        QRectF                  srcBr, dstBr;
+        std::vector<QRectF>     obstacles;
+        QPolygonF               route;
+    };
+    struct Guard;
+
+    //! Apply routes computed by a worker thread (must be called from router thread).
+    void            routesReady(std::vector<Job> jobs) noexcept;
+
+private:
+    //! Request \c edgeItem reroute, requests are launched on next event loop iteration.
+    void            requestRoute(const qan::EdgeItem* edgeItem) noexcept;
+    //! Call launchRequests() on next event loop iteration.
+    void            scheduleLaunch() noexcept;
+    //! Launch pending requests on a worker thread.
+    void            launchRequests() noexcept;
+    //! Request reroute of edges whose corridor intersects a modified obstacle previous or actual rect.
+    void            rerouteModifiedObstacles() noexcept;
+    //! Remove \c edgeItem route (called when edge item is destroyed).
+    void            removeRoute(const qan::EdgeItem* edgeItem) noexcept;
+    //! Return \c item rect in graph container CS.
+    QRectF          containerRect(const QQuickItem* item) const noexcept;
+
+    struct Route {
+        QPointer<qan::EdgeItem> edgeItem;
+        QRectF                  srcBr, dstBr;   // Ends rects used to generate route
+        QPolygonF               points;
+        QRectF                  corridor;       // Route and ends bounding rect inflated by margin
+        std::uint64_t           generation = 0;
+        bool                    valid = false;
+    };
+
+    QPointer<qan::Graph>    _graph;
+    std::unordered_map<const qan::EdgeItem*, Route>     _routes;
+    std::unordered_set<const qan::EdgeItem*>            _requests;
+    std::unordered_map<const QQuickItem*, QRectF>       _obstacleRects;
+    std::unordered_set<const QQuickItem*>               _modifiedObstacles;
+    std::shared_ptr<Guard>  _guard;
+    std::uint64_t           _generation = 0;
+    int                     _runningCount = 0;
+    bool                    _launchScheduled = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::OrthoRouter)
@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanPerformanceMonitor.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// QuickQanava headers
+#include "./qanPerformanceMonitor.h"
+#include "./qanGraph.h"
+#include "./qanNodeItem.h"
+#include "./qanEdgeItem.h"
+
+namespace qan { // ::qan
+
+/* PerformanceMonitor Object Management *///-----------------------------------
+PerformanceMonitor::PerformanceMonitor(QObject* parent) :
+    QObject{parent}
+{
+    _clock.start();
+    _sampleTimer.setInterval(500);
+    connect(&_sampleTimer, &QTimer::timeout, this, &PerformanceMonitor::sample);
+}
+
+void    PerformanceMonitor::setGraphView(qan::GraphView* graphView) noexcept
+{
+    if ( graphView == _graphView )
+        return;
+    if ( _graphView )
+        disconnect(_graphView, nullptr, this, nullptr);
+    _graphView = graphView;
+    if ( _graphView ) {
+        connect(_graphView, &QQuickItem::windowChanged, this, &PerformanceMonitor::setWindow);
+        setWindow(_graphView->window());
+    } else
+        setWindow(nullptr);
+    emit graphViewChanged();
+}
+
+void    PerformanceMonitor::setEnabled(bool enabled) noexcept
+{
+    if ( enabled != _enabled ) {
+        _enabled = enabled;
+        setWindow(_graphView ? _graphView->window() : nullptr);
+        emit enabledChanged();
+    }
+}
+
+void    PerformanceMonitor::setSampleInterval(int sampleInterval) noexcept
+{
+    sampleInterval = qMax(100, sampleInterval);
+    if ( sampleInterval != _sampleTimer.interval() ) {
+        _sampleTimer.setInterval(sampleInterval);
+        emit sampleIntervalChanged();
+    }
+}
+
+void    PerformanceMonitor::setWindow(QQuickWindow* window) noexcept
+{
+    if ( !_enabled )
+        window = nullptr;
+    if ( _window != window ) {
+        if ( _window )
+            disconnect(_window, nullptr, this, nullptr);
+        _window = window;
+        if ( _window )      // Queued on GUI thread, frameSwapped() is emitted from render thread with threaded render loop
+            connect(_window, &QQuickWindow::frameSwapped, this, &PerformanceMonitor::frameSwapped, Qt::QueuedConnection);
+    }
+    _lastFrame = -1;
+    _frameTimeSum = 0.;
+    _sampleMaxFrameTime = 0.;
+    _frameCount = 0;
+    _lastSample = _clock.nsecsElapsed();
+    _lastEdgeUpdates = qan::Trace::getCounter(qan::TraceCounter::EdgeItemUpdates);
+    _lastItemsCreated = qan::Trace::getCounter(qan::TraceCounter::ItemsCreated);
+    _lastItemsReused = qan::Trace::getCounter(qan::TraceCounter::ItemsReused);
+    if ( _window )
+        _sampleTimer.start();
+    else
+        _sampleTimer.stop();
+}
+//-----------------------------------------------------------------------------
+
+/* Metrics *///----------------------------------------------------------------
+void    PerformanceMonitor::frameSwapped() noexcept
+{
+    const auto now = _clock.nsecsElapsed();
+    if ( _lastFrame >= 0 ) {
+        const qreal frameTime = (now - _lastFrame) / 1e6;
+        _frameTimeSum += frameTime;
+        _sampleMaxFrameTime = qMax(_sampleMaxFrameTime, frameTime);
+        ++_frameCount;
+    }
+    _lastFrame = now;
+}
+
+void    PerformanceMonitor::sample() noexcept
+{
+    const auto now = _clock.nsecsElapsed();
+    const auto elapsed = now - _lastSample;
+    _lastSample = now;
+
+    _fps = elapsed > 0 ? _frameCount * 1e9 / elapsed : 0.;
+    _frameTime = _frameCount > 0 ? _frameTimeSum / _frameCount : 0.;
+    _maxFrameTime = _sampleMaxFrameTime;
+
+    const auto edgeUpdates = qan::Trace::getCounter(qan::TraceCounter::EdgeItemUpdates);
+    const auto itemsCreated = qan::Trace::getCounter(qan::TraceCounter::ItemsCreated);
+    const auto itemsReused = qan::Trace::getCounter(qan::TraceCounter::ItemsReused);
+    // Without swapped frames, updates are reported "per frame" for a single (pending) frame
+    _edgeUpdatesPerFrame = static_cast<qreal>(edgeUpdates - _lastEdgeUpdates) / qMax(1, _frameCount);
+    _itemsCreated = static_cast<int>(itemsCreated - _lastItemsCreated);
+    _itemsReused = static_cast<int>(itemsReused - _lastItemsReused);
+    _lastEdgeUpdates = edgeUpdates;
+    _lastItemsCreated = itemsCreated;
+    _lastItemsReused = itemsReused;
+    _frameTimeSum = 0.;
+    _sampleMaxFrameTime = 0.;
+    _frameCount = 0;
+
+    _pooledItems = _visibleNodes = _nodeCount = _visibleEdges = _edgeCount = _selectionSize = 0;
+    const auto graph = _graphView ? _graphView->getGraph() : nullptr;
+    const auto container = _graphView ? _graphView->getContainerItem() : nullptr;
+    if ( graph != nullptr &&
+         container != nullptr ) {
+        _pooledItems = graph->getPooledItemCount();
+        _nodeCount = static_cast<int>(graph->get_node_count());
+        _edgeCount = static_cast<int>(graph->get_edge_count());
+        _selectionSize = static_cast<int>(graph->getSelection().size());
+
+        // Graph view rect in container CS
+        const auto viewRect = container->mapRectFromItem(_graphView, QRectF{0., 0., _graphView->width(), _graphView->height()});
+        const auto isVisible = [container, &viewRect](const QQuickItem* item) -> bool {
+            return item != nullptr &&
+                   item->isVisible() &&
+                   viewRect.intersects(item->mapRectToItem(container, QRectF{0., 0., item->width(), item->height()}));
+        };
+        for ( const auto& node : graph->get_nodes() )
+            if ( node && isVisible(node->getItem()) )
+                ++_visibleNodes;
+        for ( const auto& edge : graph->get_edges() )
+            if ( edge && isVisible(edge->getItem()) )
+                ++_visibleEdges;
+    }
+    emit metricsChanged();
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
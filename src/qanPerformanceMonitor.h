@@ -0,0 +1,180 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanPerformanceMonitor.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include "./qanGraphView.h"
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+/*! \brief Sample rendering and graph metrics for a qan::GraphView (backend for Qan.PerformanceOverlay).
+ *
+ * Frame times are measured on graph view window \c frameSwapped() signal, per frame counters are
+ * computed from qan::Trace counters (see QAN_TRACE_COUNT()), item and selection counts are sampled
+ * every \c sampleInterval ms.
+ * \nosubgrouping
+ */
+class PerformanceMonitor : public QObject
+{
+    Q_OBJECT
+    /*! \name PerformanceMonitor Object Management *///------------------------
+    //@{
+public:
+    explicit PerformanceMonitor(QObject* parent = nullptr);
+    virtual ~PerformanceMonitor() override = default;
+    PerformanceMonitor(const PerformanceMonitor&) = delete;
+    PerformanceMonitor& operator=(const PerformanceMonitor&) = delete;
+
+public:
+    //! Monitored graph view (metrics are sampled only when graph view is set and \c enabled is true).
+    Q_PROPERTY(qan::GraphView* graphView READ getGraphView WRITE setGraphView NOTIFY graphViewChanged FINAL)
+    inline qan::GraphView*  getGraphView() const noexcept { return _graphView.data(); }
+    void                    setGraphView(qan::GraphView* graphView) noexcept;
+private:
+    QPointer<qan::GraphView> _graphView;
+signals:
+    void                    graphViewChanged();
+
+public:
+    //! Enable or disable sampling (default to true).
+    Q_PROPERTY(bool enabled READ getEnabled WRITE setEnabled NOTIFY enabledChanged FINAL)
+    inline bool             getEnabled() const noexcept { return _enabled; }
+    void                    setEnabled(bool enabled) noexcept;
+private:
+    bool                    _enabled = true;
+signals:
+    void                    enabledChanged();
+
+public:
+    //! Metrics sampling interval in ms (default to 500ms, minimum 100ms).
+    Q_PROPERTY(int sampleInterval READ getSampleInterval WRITE setSampleInterval NOTIFY sampleIntervalChanged FINAL)
+    inline int              getSampleInterval() const noexcept { return _sampleTimer.interval(); }
+    void                    setSampleInterval(int sampleInterval) noexcept;
+signals:
+    void                    sampleIntervalChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Metrics *///-----------------------------------------------------
+    //@{
+public:
+    //! Average frame time in ms over the last sample interval.
+    Q_PROPERTY(qreal frameTime READ getFrameTime NOTIFY metricsChanged FINAL)
+    inline qreal            getFrameTime() const noexcept { return _frameTime; }
+    //! Maximum frame time in ms over the last sample interval.
+    Q_PROPERTY(qreal maxFrameTime READ getMaxFrameTime NOTIFY metricsChanged FINAL)
+    inline qreal            getMaxFrameTime() const noexcept { return _maxFrameTime; }
+    //! Frame per seconds over the last sample interval.
+    Q_PROPERTY(qreal fps READ getFps NOTIFY metricsChanged FINAL)
+    inline qreal            getFps() const noexcept { return _fps; }
+    //! Average number of qan::EdgeItem::updateItem() calls per frame over the last sample interval.
+    Q_PROPERTY(qreal edgeUpdatesPerFrame READ getEdgeUpdatesPerFrame NOTIFY metricsChanged FINAL)
+    inline qreal            getEdgeUpdatesPerFrame() const noexcept { return _edgeUpdatesPerFrame; }
+    //! Number of items created from delegates during the last sample interval.
+    Q_PROPERTY(int itemsCreated READ getItemsCreated NOTIFY metricsChanged FINAL)
+    inline int              getItemsCreated() const noexcept { return _itemsCreated; }
+    //! Number of items taken from graph item pool during the last sample interval.
+    Q_PROPERTY(int itemsReused READ getItemsReused NOTIFY metricsChanged FINAL)
+    inline int              getItemsReused() const noexcept { return _itemsReused; }
+    //! Number of items actually waiting in graph item pool.
+    Q_PROPERTY(int pooledItems READ getPooledItems NOTIFY metricsChanged FINAL)
+    inline int              getPooledItems() const noexcept { return _pooledItems; }
+    //! Number of node items (including groups) visible in graph view.
+    Q_PROPERTY(int visibleNodes READ getVisibleNodes NOTIFY metricsChanged FINAL)
+    inline int              getVisibleNodes() const noexcept { return _visibleNodes; }
+    //! Number of nodes (including groups) in graph.
+    Q_PROPERTY(int nodeCount READ getNodeCount NOTIFY metricsChanged FINAL)
+    inline int              getNodeCount() const noexcept { return _nodeCount; }
+    //! Number of edge items visible in graph view.
+    Q_PROPERTY(int visibleEdges READ getVisibleEdges NOTIFY metricsChanged FINAL)
+    inline int              getVisibleEdges() const noexcept { return _visibleEdges; }
+    //! Number of edges in graph.
+    Q_PROPERTY(int edgeCount READ getEdgeCount NOTIFY metricsChanged FINAL)
+    inline int              getEdgeCount() const noexcept { return _edgeCount; }
+    //! Number of selected nodes and groups.
+    Q_PROPERTY(int selectionSize READ getSelectionSize NOTIFY metricsChanged FINAL)
+    inline int              getSelectionSize() const noexcept { return _selectionSize; }
+signals:
+    //! Emitted when metrics are updated (once per sample interval).
+    void                    metricsChanged();
+
+public:
+    //! Force an immediate metrics sampling.
+    Q_INVOKABLE void        sample() noexcept;
+
+private:
+    void                    setWindow(QQuickWindow* window) noexcept;
+    void                    frameSwapped() noexcept;
+
+    QPointer<QQuickWindow>  _window;
+    QElapsedTimer           _clock;
+    QTimer                  _sampleTimer;
+    qint64                  _lastFrame = -1;        // ns
+    qint64                  _lastSample = 0;        // ns
+    qreal                   _frameTimeSum = 0.;
+    qreal                   _sampleMaxFrameTime = 0.;
+    int                     _frameCount = 0;
+    std::uint64_t           _lastEdgeUpdates = 0;
+    std::uint64_t           _lastItemsCreated = 0;
+    std::uint64_t           _lastItemsReused = 0;
+
+    qreal                   _frameTime = 0.;
+    qreal                   _maxFrameTime = 0.;
+    qreal                   _fps = 0.;
+    qreal                   _edgeUpdatesPerFrame = 0.;
+    int                     _itemsCreated = 0;
+    int                     _itemsReused = 0;
+    int                     _pooledItems = 0;
+    int                     _visibleNodes = 0;
+    int                     _nodeCount = 0;
+    int                     _visibleEdges = 0;
+    int                     _edgeCount = 0;
+    int                     _selectionSize = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::PerformanceMonitor)
@@ -33,11 +33,38 @@
 //-----------------------------------------------------------------------------
 
 
+// Qt headers
+#include <QTimer>
+
 // QuickQanava headers
 #include "./qanPlugin.h"
 #include "./qanGraphConfig.h"
 #include "./qanEdge.h"
 #include "./qanEdgeItem.h"
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanNodeBatchRenderer.h"
+#include "./qanLabelBatchRenderer.h"
+#include "./qanFastNodeItem.h"
+#include "./qanGraphExporter.h"
+#include "./qanTileView.h"
+#include "./qanLayoutCache.h"
+#include "./qanImageCache.h"
+#include "./qanEdgeBundler.h"
+#include "./qanEdgeAggregator.h"
+#include "./qanOrthoRouter.h"
+#include "./qanAbstractLayout.h"
+#include "./qanForceDirectedLayout.h"
+#include "./qanLayeredLayout.h"
+#include "./qanTreeLayout.h"
+#include "./qanGroupLayout.h"
+#include "./qanFlowEngine.h"
+#include "./qanFlowExecutor.h"
+#include "./qanPerformanceMonitor.h"
+#include "./qanGraphImporter.h"
+#include "./qanGraphUpdateQueue.h"
+#include "./qanModelGraphAdapter.h"
+#include "./qanUndoStack.h"
+#include "./qanBoundingShape.h"
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
 #include "./qanPortItem.h"
@@ -45,9 +72,12 @@
 #include "./qanGroup.h"
 #include "./qanGroupItem.h"
 #include "./qanGraph.h"
+#include "./qanComponentCache.h"
 #include "./qanNavigable.h"
 #include "./qanGrid.h"
 #include "./qanLineGrid.h"
+#include "./qanShaderGrid.h"
+#include "./qanEffectItem.h"
 #include "./qanGraphView.h"
 #include "./qanStyle.h"
 #include "./qanStyleManager.h"
@@ -94,6 +124,30 @@ void QuickQanavaPlugin::registerTypes(const char *uri)
     qmlRegisterType< qan::PortItem >( uri, 2, 0, "PortItem");
     qmlRegisterType< qan::Edge >( uri, 2, 0, "AbstractEdge");
     qmlRegisterType< qan::EdgeItem >( uri, 2, 0, "EdgeItem");
+    qRegisterMetaType< qan::EdgeGeometry >();
+    qmlRegisterType< qan::EdgeBatchRenderer >( uri, 2, 0, "EdgeBatchRenderer");
+    qmlRegisterType< qan::NodeBatchRenderer >( uri, 2, 0, "NodeBatchRenderer");
+    qmlRegisterType< qan::LabelBatchRenderer >( uri, 2, 0, "LabelBatchRenderer");
+    qmlRegisterType< qan::FastNodeItem >( uri, 2, 0, "FastNodeItem");
+    qmlRegisterType< qan::GraphExporter >( uri, 2, 0, "GraphExporter");
+    qmlRegisterType< qan::TileView >( uri, 2, 0, "TileView");
+    qmlRegisterType< qan::LayoutCache >( uri, 2, 0, "LayoutCache");
+    qmlRegisterType< qan::EdgeBundler >( uri, 2, 0, "EdgeBundler");
+    qmlRegisterType< qan::EdgeAggregator >( uri, 2, 0, "EdgeAggregator");
+    qmlRegisterUncreatableType< qan::OrthoRouter >( uri, 2, 0, "OrthoRouter", "OrthoRouter is created by qan::Graph, use Graph.orthoRouting.");
+    qmlRegisterUncreatableType< qan::AbstractLayout >( uri, 2, 0, "AbstractLayout", "AbstractLayout is abstract, use ForceDirectedLayout, LayeredLayout or TreeLayout.");
+    qmlRegisterType< qan::ForceDirectedLayout >( uri, 2, 0, "ForceDirectedLayout");
+    qmlRegisterType< qan::LayeredLayout >( uri, 2, 0, "LayeredLayout");
+    qmlRegisterType< qan::TreeLayout >( uri, 2, 0, "TreeLayout");
+    qmlRegisterType< qan::GroupLayout >( uri, 2, 0, "GroupLayout");
+    qmlRegisterType< qan::FlowEngine >( uri, 2, 0, "FlowEngine");
+    qmlRegisterType< qan::FlowExecutor >( uri, 2, 0, "FlowExecutor");
+    qmlRegisterType< qan::PerformanceMonitor >( uri, 2, 0, "PerformanceMonitor");
+    qmlRegisterType< qan::GraphImporter >( uri, 2, 0, "GraphImporter");
+    qmlRegisterType< qan::GraphUpdateQueue >( uri, 2, 0, "GraphUpdateQueue");
+    qmlRegisterType< qan::ModelGraphAdapter >( uri, 2, 0, "ModelGraphAdapter");
+    qmlRegisterUncreatableType< qan::UndoStack >( uri, 2, 0, "UndoStack", "UndoStack is created by qan::Graph, use Graph.undoStack.");
+    qmlRegisterType< qan::BoundingShape >( uri, 2, 0, "BoundingShape");
     qmlRegisterType< qan::Group >( uri, 2, 0, "AbstractGroup");
     qmlRegisterType< qan::GroupItem >( uri, 2, 0, "GroupItem");
     qmlRegisterType< qan::Connector >( uri, 2, 0, "Connector");
@@ -107,6 +161,8 @@ void QuickQanavaPlugin::registerTypes(const char *uri)
     qmlRegisterType<qan::OrthoGrid>(uri, 2, 0, "OrthoGrid");
     qmlRegisterType<qan::LineGrid>(uri, 2, 0, "AbstractLineGrid");
     qmlRegisterType<qan::impl::GridLine>(uri, 2, 0, "GridLine");
+    qmlRegisterType<qan::ShaderGrid>(uri, 2, 0, "ShaderGrid");
+    qmlRegisterType<qan::EffectItem>(uri, 2, 0, "EffectItem");
 
     qmlRegisterType< qan::Style >( uri, 2, 0, "Style");
     qmlRegisterType< qan::NodeStyle >( uri, 2, 0, "NodeStyle");
@@ -130,6 +186,13 @@ void QuickQanavaPlugin::initializeEngine(QQmlEngine *engine, const char *uri)
     engine->rootContext()->setContextProperty( "defaultNodeStyle", QVariant::fromValue(qan::Node::style()) );
     engine->rootContext()->setContextProperty( "defaultEdgeStyle", QVariant::fromValue(qan::Edge::style()) );
     engine->rootContext()->setContextProperty( "defaultGroupStyle", QVariant::fromValue(qan::Group::style()) );
+
+    // Default templates are compiled asynchronously once QuickQanava import has been processed
+    QTimer::singleShot(0, engine, [engine]() { qan::ComponentCache::instance(*engine).preload(); });
+
+    // Shared asynchronous image cache (image://qan/ urls)
+    if (engine->imageProvider(QStringLiteral("qan")) == nullptr)
+        engine->addImageProvider(QStringLiteral("qan"), new qan::ImageProvider{});
 }
 
 QString QuickQanavaPlugin::fileLocation() const
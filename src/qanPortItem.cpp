@@ -95,28 +95,67 @@ void    PortItem::setLabel( const QString& label ) noexcept
     }
 }
 
+void    PortItem::setId(const QString& id) noexcept
+{
+    if ( id == _id )
+        return;
+    const auto hostNode = getNode();
+    const auto hostItem = hostNode != nullptr ? hostNode->getItem() : nullptr;
+    if ( hostItem != nullptr )
+        hostItem->unindexPort(*this);
+    _id = id;
+    if ( hostItem != nullptr )
+        hostItem->indexPort(*this);
+}
+
 void    PortItem::addInEdgeItem(qan::EdgeItem& inEdgeItem) noexcept
 {
-    QObject::connect(&inEdgeItem,   &QObject::destroyed,
-                     this,          &qan::PortItem::onEdgeItemDestroyed);
+    if ( _inEdgeItemsIndex.contains(&inEdgeItem) )
+        return;
+    if ( !_outEdgeItemsIndex.contains(&inEdgeItem) )
+        QObject::connect(&inEdgeItem,   &QObject::destroyed,
+                         this,          [this, &inEdgeItem]() { onEdgeItemDestroyed(&inEdgeItem); });
+    _inEdgeItemsIndex.insert(&inEdgeItem);
     _inEdgeItems.append(&inEdgeItem);
 }
 
 void    PortItem::addOutEdgeItem(qan::EdgeItem& outEdgeItem) noexcept
 {
-    QObject::connect(&outEdgeItem,  &QObject::destroyed,
-                     this,          &qan::PortItem::onEdgeItemDestroyed);
+    if ( _outEdgeItemsIndex.contains(&outEdgeItem) )
+        return;
+    if ( !_inEdgeItemsIndex.contains(&outEdgeItem) )
+        QObject::connect(&outEdgeItem,  &QObject::destroyed,
+                         this,          [this, &outEdgeItem]() { onEdgeItemDestroyed(&outEdgeItem); });
+    _outEdgeItemsIndex.insert(&outEdgeItem);
     _outEdgeItems.append(&outEdgeItem);
 }
 
-void    PortItem::onEdgeItemDestroyed(QObject* obj)
+void    PortItem::removeInEdgeItem(qan::EdgeItem& inEdgeItem) noexcept
+{
+    if ( !_inEdgeItemsIndex.remove(&inEdgeItem) )
+        return;
+    _inEdgeItems.removeAll(&inEdgeItem);
+    if ( !_outEdgeItemsIndex.contains(&inEdgeItem) )
+        QObject::disconnect(&inEdgeItem, &QObject::destroyed, this, nullptr);
+}
+
+void    PortItem::removeOutEdgeItem(qan::EdgeItem& outEdgeItem) noexcept
 {
-    // Connection to destroyed signal in addInEdgeItem() and addOutEdgeItem()
-    const auto edgeItem = qobject_cast<qan::EdgeItem*>(obj);
-    if (edgeItem != nullptr) {
+    if ( !_outEdgeItemsIndex.remove(&outEdgeItem) )
+        return;
+    _outEdgeItems.removeAll(&outEdgeItem);
+    if ( !_inEdgeItemsIndex.contains(&outEdgeItem) )
+        QObject::disconnect(&outEdgeItem, &QObject::destroyed, this, nullptr);
+}
+
+void    PortItem::onEdgeItemDestroyed(qan::EdgeItem* edgeItem)
+{
+    // Connection to destroyed signal in addInEdgeItem() and addOutEdgeItem(), note that edgeItem
+    // is partially destroyed and can't be qobject_cast'ed: only its address is used.
+    if ( _inEdgeItemsIndex.remove(edgeItem) )
         _inEdgeItems.removeAll(edgeItem);
+    if ( _outEdgeItemsIndex.remove(edgeItem) )
         _outEdgeItems.removeAll(edgeItem);
-    }
 }
 //-----------------------------------------------------------------------------
 
@@ -41,6 +41,7 @@
 #include <QPolygonF>
 #include <QDrag>
 #include <QPointer>
+#include <QSet>
 
 // QuickQanava headers
 #include "./qanNodeItem.h"
@@ -138,7 +139,8 @@ signals:
     void            labelChanged();
 
 public:
-    void            setId(const QString& id) noexcept { _id = id; }
+    //! Set port id, port is re-indexed in its host node item ports index (see qan::NodeItem::findPort()).
+    void            setId(const QString& id) noexcept;
     const QString&  getId() const noexcept { return _id; }
 private:
     QString         _id{QStringLiteral("")};
@@ -146,8 +148,22 @@ private:
 public:
     using EdgeItems =   qcm::Container<QVector, qan::EdgeItem*>;
 
+    /*! \brief Register an in edge item bound to this port (called by qan::Graph::bindEdgeDestination()).
+     *
+     * Port edges lists are maintained by qan::Graph: edge items are removed when they are unbound, removed
+     * from graph or destroyed. Adding an already registered edge item is a no-op.
+     */
     void                addInEdgeItem(qan::EdgeItem& inEdgeItem) noexcept;
+    //! Register an out edge item bound to this port (called by qan::Graph::bindEdgeSource()).
     void                addOutEdgeItem(qan::EdgeItem& outEdgeItem) noexcept;
+    //! Unregister an in edge item, no-op if \c inEdgeItem is not registered.
+    void                removeInEdgeItem(qan::EdgeItem& inEdgeItem) noexcept;
+    //! Unregister an out edge item, no-op if \c outEdgeItem is not registered.
+    void                removeOutEdgeItem(qan::EdgeItem& outEdgeItem) noexcept;
+    //! Return true if \c edgeItem is registered as an in edge of this port (O(1)).
+    inline bool         hasInEdgeItem(const qan::EdgeItem& edgeItem) const noexcept { return _inEdgeItemsIndex.contains(&edgeItem); }
+    //! Return true if \c edgeItem is registered as an out edge of this port (O(1)).
+    inline bool         hasOutEdgeItem(const qan::EdgeItem& edgeItem) const noexcept { return _outEdgeItemsIndex.contains(&edgeItem); }
 
     EdgeItems&          getInEdgeItems() noexcept { return _inEdgeItems; }
     const EdgeItems&    getInEdgeItems() const noexcept { return _inEdgeItems; }
@@ -158,9 +174,12 @@ public:
 protected:
     EdgeItems           _inEdgeItems;
     EdgeItems           _outEdgeItems;
+private:
+    QSet<const qan::EdgeItem*>  _inEdgeItemsIndex;
+    QSet<const qan::EdgeItem*>  _outEdgeItemsIndex;
 
     //! Used internally to automatically monitor in/out edges items destruction.
-    void                onEdgeItemDestroyed(QObject* obj);
+    void                onEdgeItemDestroyed(qan::EdgeItem* edgeItem);
     //@}
     //-------------------------------------------------------------------------
 };
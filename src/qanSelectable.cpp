@@ -76,7 +76,9 @@ void    Selectable::setSelected( bool selected ) noexcept
     if ( _target &&
          _graph ) {  // Eventually create selection item
         if ( selected &&
-             getSelectionItem() == nullptr )
+             getSelectionItem() == nullptr &&
+             !_graph->getSelectionOverlay() &&  // No selection item when selection is drawn by graph overlay
+             !hasNativeSelection() )            // ...or by target item
             setSelectionItem( _graph->createSelectionItem( _target.data() ).data() );
         else if ( !selected )
             _graph->removeFromSelection(_target.data());
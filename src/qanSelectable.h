@@ -87,6 +87,8 @@ public:
     inline bool     getSelected() const noexcept { return _selected; }
 protected:
     virtual void    emitSelectedChanged() = 0;
+    //! Return true when target item draws its selection state itself: no selection item is created (default to false).
+    virtual bool    hasNativeSelection() const noexcept { return false; }
 private:
     bool            _selected{false};
 
@@ -0,0 +1,142 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionOverlay.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+// QuickQanava headers
+#include "./qanSelectionOverlay.h"
+#include "./qanNodeItem.h"
+#include "./qanGroupItem.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* SelectionOverlay Object Management *///------------------------------------
+SelectionOverlay::SelectionOverlay(qan::Graph& graph, QQuickItem* parent) :
+    QQuickItem{parent},
+    _graph{&graph}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setEnabled(false);      // Overlay must not interfere with nodes mouse events
+    const auto invalidate = [this]() { this->invalidate(); };
+    connect(&graph, &qan::Graph::selectionColorChanged,     this, invalidate);
+    connect(&graph, &qan::Graph::selectionWeightChanged,    this, invalidate);
+    connect(&graph, &qan::Graph::selectionMarginChanged,    this, invalidate);
+    connect(&graph, &qan::Graph::sceneModified,             this, invalidate);
+    connect(&graph, &qan::Graph::nodeRemoved,               this, invalidate);
+    connect(&graph, &qan::Graph::selectionModified,         this, invalidate);
+}
+
+void    SelectionOverlay::invalidate() noexcept
+{
+    if (_rebuild)       // Merge multiple invalidations until next frame
+        return;
+    _rebuild = true;
+    update();
+}
+//-----------------------------------------------------------------------------
+
+/* Overlay Rendering *///------------------------------------------------------
+void    SelectionOverlay::appendSelectionRect(const QQuickItem* item, std::vector<QRectF>& rects) const noexcept
+{
+    if (item == nullptr ||
+        !item->isVisible())
+        return;
+    const auto weight = _graph->getSelectionWeight();
+    const auto offset = weight / 2. + _graph->getSelectionMargin();
+    // Note: Same geometry than qan::Selectable::configureSelectionItem(), mapped in overlay CS (grouped items)
+    const auto r = item->mapRectToItem(this, QRectF{0., 0., item->width(), item->height()})
+                       .adjusted(-offset, -offset, offset, offset);
+    rects.emplace_back(r.left(), r.top(), r.width(), weight);                       // Top
+    rects.emplace_back(r.left(), r.bottom() - weight, r.width(), weight);           // Bottom
+    rects.emplace_back(r.left(), r.top() + weight, weight, r.height() - 2 * weight);              // Left
+    rects.emplace_back(r.right() - weight, r.top() + weight, weight, r.height() - 2 * weight);    // Right
+}
+
+QSGNode*    SelectionOverlay::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    // Note: GUI thread is blocked while updatePaintNode() is called, graph selection can be safely read.
+    if (!_rebuild)
+        return oldNode;
+    _rebuild = false;
+    std::vector<QRectF> rects;
+    if (_graph) {
+        // Note: Selection bitset is read directly, selection models are synchronized lazily on GUI thread
+        const auto& selection = _graph->getSelection();
+        rects.reserve(selection.size() * 4);
+        selection.forEach([this, &rects](const qan::Node* node) {
+            appendSelectionRect(node->getItem(), rects);
+        });
+    }
+    if (rects.empty()) {
+        delete oldNode;
+        return nullptr;
+    }
+    const int vertexCount = static_cast<int>(rects.size()) * 6;
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), vertexCount};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGFlatColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    } else if (node->geometry()->vertexCount() != vertexCount)
+        node->geometry()->allocate(vertexCount);
+    auto material = static_cast<QSGFlatColorMaterial*>(node->material());
+    if (material->color() != _graph->getSelectionColor()) {
+        material->setColor(_graph->getSelectionColor());
+        node->markDirty(QSGNode::DirtyMaterial);
+    }
+    auto v = node->geometry()->vertexDataAsPoint2D();
+    const auto push = [&v](qreal x, qreal y) {
+        v->set(static_cast<float>(x), static_cast<float>(y));
+        ++v;
+    };
+    for (const auto& r : rects) {
+        push(r.left(), r.top());    push(r.right(), r.top());       push(r.left(), r.bottom());
+        push(r.right(), r.top());   push(r.right(), r.bottom());    push(r.left(), r.bottom());
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,94 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionOverlay.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+
+namespace qan { // ::qan
+
+class Graph;
+
+/*! \brief Draw all selected nodes and groups selection rectangles in a single scene graph node.
+ *
+ * Overlay is created by qan::Graph when \c selectionOverlay is enabled, it is a child of graph container
+ * item (at origin) drawn above nodes and groups. Rectangles are drawn with graph \c selectionColor,
+ * \c selectionWeight and \c selectionMargin, no selection item is created for selected primitives.
+ *
+ * Overlay is rebuilt at most once per frame when selection is modified, when selection properties
+ * change or when graph scene is modified.
+ *
+ * \nosubgrouping
+ */
+class SelectionOverlay : public QQuickItem
+{
+    /*! \name SelectionOverlay Object Management *///--------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit SelectionOverlay(qan::Graph& graph, QQuickItem* parent = nullptr);
+    virtual ~SelectionOverlay() override = default;
+    SelectionOverlay(const SelectionOverlay&) = delete;
+
+private:
+    QPointer<qan::Graph>    _graph;
+
+public:
+    //! Force a rebuild of selection rectangles on next frame.
+    Q_INVOKABLE void    invalidate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Overlay Rendering *///-------------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Append \c item selection rectangle (four quads) to \c rects.
+    void                appendSelectionRect(const QQuickItem* item, std::vector<QRectF>& rects) const noexcept;
+
+    bool                _rebuild = true;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::SelectionOverlay)
@@ -0,0 +1,149 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionSet.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::fill
+
+// QuickQanava headers
+#include "./qanSelectionSet.h"
+#include "./qanNode.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+//! Return \c node handle index, or -1 if \c node is not registered in a graph.
+inline qint64   nodeIndex(const qan::Node& node) noexcept
+{
+    const auto id = node.get_id();
+    return id.is_valid() ? static_cast<qint64>(id.get_index()) : -1;
+}
+} // ::qan::anonymous
+
+/* SelectionSet Object Management *///----------------------------------------
+bool    SelectionSet::contains(const qan::Node& node) const noexcept
+{
+    const auto index = nodeIndex(node);
+    if (index < 0 ||
+        static_cast<std::size_t>(index) >= _nodes.size())
+        return false;
+    return (_bits[static_cast<std::size_t>(index) / 64] & (quint64{1} << (index % 64))) != 0 &&
+            _nodes[static_cast<std::size_t>(index)] == &node;
+}
+
+bool    SelectionSet::insert(qan::Node& node) noexcept
+{
+    const auto index = nodeIndex(node);
+    if (index < 0)
+        return false;
+    const auto i = static_cast<std::size_t>(index);
+    if (i >= _nodes.size()) {
+        const auto words = i / 64 + 1;
+        _bits.resize(words, 0);
+        _published.resize(words, 0);
+        _nodes.resize(words * 64, nullptr);
+        _stamps.resize(words * 64, 0);
+    }
+    auto& word = _bits[i / 64];
+    const auto bit = quint64{1} << (i % 64);
+    if ((word & bit) != 0)
+        return false;
+    word |= bit;
+    _nodes[i] = &node;
+    ++_size;
+    ++_version;
+    _stamps[i] = _version;
+    return true;
+}
+
+bool    SelectionSet::remove(const qan::Node& node) noexcept
+{
+    if (!contains(node))
+        return false;
+    const auto i = static_cast<std::size_t>(nodeIndex(node));
+    _bits[i / 64] &= ~(quint64{1} << (i % 64));
+    --_size;
+    ++_version;
+    return true;
+}
+
+void    SelectionSet::erase(const qan::Node& node) noexcept
+{
+    const auto index = nodeIndex(node);
+    if (index < 0 ||
+        static_cast<std::size_t>(index) >= _nodes.size() ||
+        _nodes[static_cast<std::size_t>(index)] != &node)
+        return;
+    remove(node);
+    const auto i = static_cast<std::size_t>(index);
+    _published[i / 64] &= ~(quint64{1} << (i % 64));
+    _nodes[i] = nullptr;
+}
+
+void    SelectionSet::clear() noexcept
+{
+    if (_size == 0)
+        return;
+    std::fill(_bits.begin(), _bits.end(), 0);
+    _size = 0;
+    ++_version;
+}
+
+void    SelectionSet::reset() noexcept
+{
+    _bits.clear();
+    _published.clear();
+    _nodes.clear();
+    _stamps.clear();
+    _size = 0;
+    ++_version;
+}
+
+bool    SelectionSet::takeDelta(SelectionDelta& delta)
+{
+    delta.added.clear();
+    delta.removed.clear();
+    delta.version = _version;
+    for (std::size_t w = 0; w < _bits.size(); ++w) {
+        const auto changed = _bits[w] ^ _published[w];
+        for (auto word = changed & _bits[w]; word != 0; word &= word - 1)
+            delta.added.push_back(_nodes[w * 64 + qCountTrailingZeroBits(word)]);
+        for (auto word = changed & _published[w]; word != 0; word &= word - 1)
+            delta.removed.push_back(_nodes[w * 64 + qCountTrailingZeroBits(word)]);
+        _published[w] = _bits[w];
+    }
+    return !delta.added.empty() || !delta.removed.empty();
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,139 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionSet.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <vector>
+#include <algorithm>        // std::sort()
+
+// Qt headers
+#include <QtGlobal>
+#include <QtAlgorithms>     // qCountTrailingZeroBits()
+
+namespace qan { // ::qan
+
+class Node;
+
+//! Selection modifications published by qan::Graph::selectionModified() since previous delta.
+struct SelectionDelta
+{
+    //! Selection version once delta is applied (see qan::SelectionSet::getVersion()).
+    quint64                 version = 0;
+    //! Nodes (or groups) selected since previous delta.
+    std::vector<qan::Node*> added;
+    //! Nodes (or groups) unselected since previous delta (removed nodes are not reported).
+    std::vector<qan::Node*> removed;
+};
+
+/*! \brief Dense bitset of selected nodes (and groups) indexed by node handle index (see gtpo::node<>::get_id()).
+ *
+ * Membership test, insertion and removal are O(1) with no allocation once the set has grown to the graph handle
+ * count. Set keep a copy of the bits published with the last delta: takeDelta() compute added and removed nodes with
+ * a word wise diff (O(handles / 64 + changes)), a node selected then unselected between two deltas is not reported.
+ */
+class SelectionSet
+{
+    /*! \name SelectionSet Object Management *///------------------------------
+    //@{
+public:
+    SelectionSet() noexcept = default;
+    ~SelectionSet() noexcept = default;
+    SelectionSet(const SelectionSet&) = delete;
+    SelectionSet& operator=(const SelectionSet&) = delete;
+
+public:
+    //! Return true if \c node is selected.
+    bool        contains(const qan::Node& node) const noexcept;
+    //! Select \c node, return false if \c node is already selected or has no valid handle.
+    bool        insert(qan::Node& node) noexcept;
+    //! Unselect \c node, return false if \c node is not selected.
+    bool        remove(const qan::Node& node) noexcept;
+    //! Forget \c node (removed from graph), it is neither selected nor reported in next delta.
+    void        erase(const qan::Node& node) noexcept;
+    //! Unselect all nodes (unselected nodes are reported in next delta).
+    void        clear() noexcept;
+    //! Forget all nodes and published state (graph is cleared), next delta is empty.
+    void        reset() noexcept;
+
+    //! Number of selected nodes.
+    inline std::size_t  size() const noexcept { return _size; }
+    inline bool         empty() const noexcept { return _size == 0; }
+    //! Incremented on every effective selection modification.
+    inline quint64      getVersion() const noexcept { return _version; }
+
+    //! Call \c functor with every selected node, in handle index order.
+    template <class Functor>
+    void        forEach(Functor functor) const {
+        for (std::size_t w = 0; w < _bits.size(); ++w)
+            for (auto word = _bits[w]; word != 0; word &= word - 1)
+                functor(_nodes[w * 64 + qCountTrailingZeroBits(word)]);
+    }
+
+    //! Call \c functor with every selected node, in selection order (selected nodes are sorted, prefer forEach()).
+    template <class Functor>
+    void        forEachInSelectionOrder(Functor functor) const {
+        std::vector<std::size_t> indexes;
+        indexes.reserve(_size);
+        for (std::size_t w = 0; w < _bits.size(); ++w)
+            for (auto word = _bits[w]; word != 0; word &= word - 1)
+                indexes.push_back(w * 64 + qCountTrailingZeroBits(word));
+        std::sort(indexes.begin(), indexes.end(), [this](std::size_t a, std::size_t b) { return _stamps[a] < _stamps[b]; });
+        for (const auto index : indexes)
+            functor(_nodes[index]);
+    }
+
+    /*! \brief Set \c delta with nodes added and removed since previous call, return false if selection did not change.
+     *
+     * Published state is updated, \c delta vectors are cleared first (their capacity is reused).
+     */
+    bool        takeDelta(SelectionDelta& delta);
+
+private:
+    //! Bit \c index of selected nodes.
+    std::vector<quint64>    _bits;
+    //! Bits at last takeDelta() call.
+    std::vector<quint64>    _published;
+    //! Node of every index set (kept once unselected until next delta to report removals).
+    std::vector<qan::Node*> _nodes;
+    //! Selection version when node at index was selected (see forEachInSelectionOrder()).
+    std::vector<quint64>    _stamps;
+    std::size_t             _size = 0;
+    quint64                 _version = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
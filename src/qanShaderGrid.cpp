@@ -0,0 +1,247 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanShaderGrid.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+
+// Qt headers
+#include <QSGNode>
+#include <QSGGeometryNode>
+#include <QSGMaterial>
+#include <QOpenGLShaderProgram>
+#include <QVector2D>
+#include <QVector4D>
+
+// QuickQanava headers
+#include "./qanShaderGrid.h"
+
+namespace qan {  // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Grid material uniforms (colors are premultiplied).
+class GridMaterial : public QSGMaterial
+{
+public:
+    GridMaterial() { setFlag(QSGMaterial::Blending); }
+    virtual QSGMaterialType*    type() const override { static QSGMaterialType type; return &type; }
+    virtual QSGMaterialShader*  createShader() const override;
+    virtual int                 compare(const QSGMaterial* other) const override {
+        return other == this ? 0 : (other < this ? -1 : 1);
+    }
+
+    QVector2D   origin;
+    float       spacing = 1.f;
+    float       major = 5.f;
+    float       thickness = 1.f;
+    float       points = 0.f;
+    QVector4D   minorColor;
+    QVector4D   majorColor;
+};
+
+class GridMaterialShader : public QSGMaterialShader
+{
+public:
+    virtual const char*         vertexShader() const override {
+        return  "attribute highp vec4 qt_VertexPosition;\n"
+                "uniform highp mat4 qt_Matrix;\n"
+                "varying highp vec2 coord;\n"
+                "void main() {\n"
+                "    coord = qt_VertexPosition.xy;\n"
+                "    gl_Position = qt_Matrix * qt_VertexPosition;\n"
+                "}\n";
+    }
+    // Distance to the nearest minor line is computed independently on x and y in item pixels,
+    // a line is major when its index (relative to container origin) is a multiple of major.
+    virtual const char*         fragmentShader() const override {
+        return  "uniform lowp float qt_Opacity;\n"
+                "uniform highp vec2 origin;\n"
+                "uniform highp float spacing;\n"
+                "uniform highp float major;\n"
+                "uniform highp float thickness;\n"
+                "uniform lowp float points;\n"
+                "uniform lowp vec4 minorColor;\n"
+                "uniform lowp vec4 majorColor;\n"
+                "varying highp vec2 coord;\n"
+                "void main() {\n"
+                "    highp vec2 g = (coord - origin) / spacing;\n"
+                "    highp vec2 n = floor(g + 0.5);\n"
+                "    highp vec2 d = abs(g - n) * spacing;\n"
+                "    highp vec2 m = 1.0 - step(0.5, mod(n, major));\n"
+                "    highp float r = thickness * 0.5;\n"
+                "    lowp float coverage;\n"
+                "    lowp float isMajor;\n"
+                "    if (points > 0.5) {\n"
+                "        coverage = 1.0 - smoothstep(r - 0.5, r + 0.5, length(d));\n"
+                "        isMajor = m.x * m.y;\n"
+                "    } else {\n"
+                "        highp vec2 c = 1.0 - smoothstep(vec2(r - 0.5), vec2(r + 0.5), d);\n"
+                "        coverage = max(c.x, c.y);\n"
+                "        isMajor = step(0.001, max(c.x * m.x, c.y * m.y));\n"
+                "    }\n"
+                "    gl_FragColor = mix(minorColor, majorColor, isMajor) * coverage * qt_Opacity;\n"
+                "}\n";
+    }
+    virtual char const* const*  attributeNames() const override {
+        static const char* const names[] = { "qt_VertexPosition", nullptr };
+        return names;
+    }
+    virtual void                updateState(const RenderState& state, QSGMaterial* newMaterial, QSGMaterial* oldMaterial) override {
+        Q_UNUSED(oldMaterial)
+        auto p = program();
+        if (state.isMatrixDirty())
+            p->setUniformValue(_matrixId, state.combinedMatrix());
+        if (state.isOpacityDirty())
+            p->setUniformValue(_opacityId, state.opacity());
+        const auto material = static_cast<GridMaterial*>(newMaterial);
+        p->setUniformValue(_originId, material->origin);
+        p->setUniformValue(_spacingId, material->spacing);
+        p->setUniformValue(_majorId, material->major);
+        p->setUniformValue(_thicknessId, material->thickness);
+        p->setUniformValue(_pointsId, material->points);
+        p->setUniformValue(_minorColorId, material->minorColor);
+        p->setUniformValue(_majorColorId, material->majorColor);
+    }
+
+protected:
+    virtual void                initialize() override {
+        auto p = program();
+        _matrixId = p->uniformLocation("qt_Matrix");
+        _opacityId = p->uniformLocation("qt_Opacity");
+        _originId = p->uniformLocation("origin");
+        _spacingId = p->uniformLocation("spacing");
+        _majorId = p->uniformLocation("major");
+        _thicknessId = p->uniformLocation("thickness");
+        _pointsId = p->uniformLocation("points");
+        _minorColorId = p->uniformLocation("minorColor");
+        _majorColorId = p->uniformLocation("majorColor");
+    }
+
+private:
+    int _matrixId = -1;
+    int _opacityId = -1;
+    int _originId = -1;
+    int _spacingId = -1;
+    int _majorId = -1;
+    int _thicknessId = -1;
+    int _pointsId = -1;
+    int _minorColorId = -1;
+    int _majorColorId = -1;
+};
+
+QSGMaterialShader*  GridMaterial::createShader() const { return new GridMaterialShader{}; }
+
+inline QVector4D    premultiplied(const QColor& color) noexcept
+{
+    const auto a = static_cast<float>(color.alphaF());
+    return QVector4D{static_cast<float>(color.redF()) * a,
+                     static_cast<float>(color.greenF()) * a,
+                     static_cast<float>(color.blueF()) * a, a};
+}
+
+} // ::qan::anonymous
+
+/* ShaderGrid Object Management *///-------------------------------------------
+ShaderGrid::ShaderGrid(QQuickItem* parent) :
+    OrthoGrid{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    connect(this, &Grid::thickColorChanged, this, &QQuickItem::update);
+    connect(this, &Grid::gridWidthChanged,  this, &QQuickItem::update);
+}
+//-----------------------------------------------------------------------------
+
+/* Grid Management *///--------------------------------------------------------
+void    ShaderGrid::setGridStyle(GridStyle gridStyle) noexcept
+{
+    if (gridStyle != _gridStyle) {
+        _gridStyle = gridStyle;
+        emit gridStyleChanged();
+        update();
+    }
+}
+
+bool    ShaderGrid::updateGrid(const QRectF& viewRect,
+                               const QQuickItem& container,
+                               const QQuickItem& navigable) noexcept
+{
+    if (!OrthoGrid::updateGrid(viewRect, container, navigable))
+        return false;
+
+    // Use the same adaptative scale than qan::LineGrid: thicks are never closer than gridScale when zooming out.
+    qreal containerZoom = container.scale();
+    if ( qFuzzyCompare(1.0 + containerZoom, 1.0) )  // Protect against 0 zoom
+        containerZoom = 1.0;
+    const qreal gridScale{getGridScale()};
+    const qreal adaptativeScale = containerZoom < 1. ? gridScale / containerZoom : gridScale;
+
+    _origin = container.mapToItem(this, QPointF{0., 0.});
+    _spacing = container.mapToItem(this, QPointF{adaptativeScale, 0.}).x() - _origin.x();
+    update();
+    return true;
+}
+
+QSGNode*    ShaderGrid::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_spacing < 1. ||
+        width() <= 0. || height() <= 0.) {
+        delete node;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        node->setGeometry(new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 4});
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new GridMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+    QSGGeometry::updateRectGeometry(node->geometry(), boundingRect());
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    auto material = static_cast<GridMaterial*>(node->material());
+    material->origin = QVector2D{_origin};
+    material->spacing = static_cast<float>(_spacing);
+    material->major = static_cast<float>(getGridMajor());
+    material->thickness = static_cast<float>(_gridStyle == Points ? getGridWidth() : 1.);
+    material->points = _gridStyle == Points ? 1.f : 0.f;
+    material->minorColor = premultiplied(getThickColor());
+    material->majorColor = premultiplied(getThickColor().darker(130));
+    node->markDirty(QSGNode::DirtyMaterial);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,121 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanShaderGrid.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QtQml>
+#include <QQuickItem>
+
+// QuickQanava headers
+#include "./qanLineGrid.h"
+
+namespace qan {  // ::qan
+
+/*! \brief Draw an orthogonal line or point grid procedurally with a fragment shader.
+ *
+ * Contrary to qan::LineGrid, no per line object is allocated: grid is a single quad covering
+ * the navigable, lines (or points) are generated in a fragment shader from \c gridScale,
+ * \c gridMajor and the navigable container transformation, drawing cost is constant and
+ * panning or zooming only update a few shader uniforms.
+ *
+ * Minor lines are drawn with \c thickColor, major lines with a darker \c thickColor (same
+ * rendering as Qan.LineGrid), lines are 1px wide, points use \c gridWidth as diameter.
+ *
+ * \code
+ *  Qan.Navigable {
+ *    navigable: true
+ *    Qan.ShaderGrid { id: shaderGrid; anchors.fill: parent; gridScale: 25 }
+ *    grid: shaderGrid
+ *  }
+ * \endcode
+ *
+ * \note Shaders are GLSL (OpenGL scene graph backend).
+ * \nosubgrouping
+ */
+class ShaderGrid : public OrthoGrid
+{
+    /*! \name ShaderGrid Object Management *///--------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit ShaderGrid(QQuickItem* parent = nullptr);
+    virtual ~ShaderGrid() override = default;
+    ShaderGrid(const ShaderGrid&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Grid Management *///---------------------------------------------
+    //@{
+public:
+    enum GridStyle {
+        //! Draw minor and major orthogonal lines.
+        Lines,
+        //! Draw a point on every minor and major lines crossing.
+        Points
+    };
+    Q_ENUM(GridStyle)
+
+    //! Grid style (default to \c Lines).
+    Q_PROPERTY(GridStyle gridStyle READ getGridStyle WRITE setGridStyle NOTIFY gridStyleChanged FINAL)
+    //! \copydoc gridStyle
+    inline GridStyle    getGridStyle() const noexcept { return _gridStyle; }
+    //! \copydoc gridStyle
+    void                setGridStyle(GridStyle gridStyle) noexcept;
+private:
+    //! \copydoc gridStyle
+    GridStyle           _gridStyle = Lines;
+signals:
+    //! \copydoc gridStyle
+    void                gridStyleChanged();
+
+public:
+    virtual bool    updateGrid(const QRectF& viewRect,
+                               const QQuickItem& container,
+                               const QQuickItem& navigable) noexcept override;
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Container (0, 0) origin in grid item CS.
+    QPointF         _origin;
+    //! Distance between two minor lines in grid item CS.
+    qreal           _spacing = 0.;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+}  // ::qan
+
+QML_DECLARE_TYPE(qan::ShaderGrid);
@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSimdLane.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QAN_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define QAN_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace qan { // ::qan
+namespace simd { // ::qan::simd
+
+// Lane types: a lane wrap a SIMD register of doubles with the few operations used by batch kernels,
+// masks are stored in the same register type (all bits set for true).
+struct ScalarLane {
+    static constexpr std::size_t width = 1;
+    double  v;
+    static inline ScalarLane load(const double* p) noexcept { return {*p}; }
+    inline void     store(double* p) const noexcept { *p = v; }
+    static inline ScalarLane set1(double d) noexcept { return {d}; }
+    friend inline ScalarLane operator+(ScalarLane a, ScalarLane b) noexcept { return {a.v + b.v}; }
+    friend inline ScalarLane operator-(ScalarLane a, ScalarLane b) noexcept { return {a.v - b.v}; }
+    friend inline ScalarLane operator*(ScalarLane a, ScalarLane b) noexcept { return {a.v * b.v}; }
+    friend inline ScalarLane operator/(ScalarLane a, ScalarLane b) noexcept { return {a.v / b.v}; }
+    static inline ScalarLane min(ScalarLane a, ScalarLane b) noexcept { return {a.v < b.v ? a.v : b.v}; }
+    static inline ScalarLane max(ScalarLane a, ScalarLane b) noexcept { return {a.v > b.v ? a.v : b.v}; }
+    static inline ScalarLane abs(ScalarLane a) noexcept { return {std::fabs(a.v)}; }
+    static inline ScalarLane sqrt(ScalarLane a) noexcept { return {std::sqrt(a.v)}; }
+    // Masks are stored as 0.0 / 1.0 for the scalar lane
+    static inline ScalarLane lt(ScalarLane a, ScalarLane b) noexcept { return {a.v < b.v ? 1. : 0.}; }
+    static inline ScalarLane le(ScalarLane a, ScalarLane b) noexcept { return {a.v <= b.v ? 1. : 0.}; }
+    static inline ScalarLane mand(ScalarLane a, ScalarLane b) noexcept { return {a.v != 0. && b.v != 0. ? 1. : 0.}; }
+    static inline ScalarLane mor(ScalarLane a, ScalarLane b) noexcept { return {a.v != 0. || b.v != 0. ? 1. : 0.}; }
+    static inline ScalarLane select(ScalarLane m, ScalarLane a, ScalarLane b) noexcept { return m.v != 0. ? a : b; }
+    static inline void      storeMask(ScalarLane m, std::uint8_t* p) noexcept { *p = m.v != 0. ? 1 : 0; }
+};
+
+#if defined(__AVX__)
+struct SimdLane {
+    static constexpr std::size_t width = 4;
+    __m256d v;
+    static inline SimdLane load(const double* p) noexcept { return {_mm256_loadu_pd(p)}; }
+    inline void     store(double* p) const noexcept { _mm256_storeu_pd(p, v); }
+    static inline SimdLane set1(double d) noexcept { return {_mm256_set1_pd(d)}; }
+    friend inline SimdLane operator+(SimdLane a, SimdLane b) noexcept { return {_mm256_add_pd(a.v, b.v)}; }
+    friend inline SimdLane operator-(SimdLane a, SimdLane b) noexcept { return {_mm256_sub_pd(a.v, b.v)}; }
+    friend inline SimdLane operator*(SimdLane a, SimdLane b) noexcept { return {_mm256_mul_pd(a.v, b.v)}; }
+    friend inline SimdLane operator/(SimdLane a, SimdLane b) noexcept { return {_mm256_div_pd(a.v, b.v)}; }
+    static inline SimdLane min(SimdLane a, SimdLane b) noexcept { return {_mm256_min_pd(a.v, b.v)}; }
+    static inline SimdLane max(SimdLane a, SimdLane b) noexcept { return {_mm256_max_pd(a.v, b.v)}; }
+    static inline SimdLane abs(SimdLane a) noexcept { return {_mm256_andnot_pd(_mm256_set1_pd(-0.), a.v)}; }
+    static inline SimdLane sqrt(SimdLane a) noexcept { return {_mm256_sqrt_pd(a.v)}; }
+    static inline SimdLane lt(SimdLane a, SimdLane b) noexcept { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+    static inline SimdLane le(SimdLane a, SimdLane b) noexcept { return {_mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ)}; }
+    static inline SimdLane mand(SimdLane a, SimdLane b) noexcept { return {_mm256_and_pd(a.v, b.v)}; }
+    static inline SimdLane mor(SimdLane a, SimdLane b) noexcept { return {_mm256_or_pd(a.v, b.v)}; }
+    static inline SimdLane select(SimdLane m, SimdLane a, SimdLane b) noexcept { return {_mm256_blendv_pd(b.v, a.v, m.v)}; }
+    static inline void      storeMask(SimdLane m, std::uint8_t* p) noexcept {
+        const int bits = _mm256_movemask_pd(m.v);
+        for (std::size_t l = 0; l < width; ++l)
+            p[l] = static_cast<std::uint8_t>((bits >> l) & 1);
+    }
+};
+constexpr const char* simdLaneIsa = "avx";
+#elif defined(QAN_SIMD_SSE2)
+struct SimdLane {
+    static constexpr std::size_t width = 2;
+    __m128d v;
+    static inline SimdLane load(const double* p) noexcept { return {_mm_loadu_pd(p)}; }
+    inline void     store(double* p) const noexcept { _mm_storeu_pd(p, v); }
+    static inline SimdLane set1(double d) noexcept { return {_mm_set1_pd(d)}; }
+    friend inline SimdLane operator+(SimdLane a, SimdLane b) noexcept { return {_mm_add_pd(a.v, b.v)}; }
+    friend inline SimdLane operator-(SimdLane a, SimdLane b) noexcept { return {_mm_sub_pd(a.v, b.v)}; }
+    friend inline SimdLane operator*(SimdLane a, SimdLane b) noexcept { return {_mm_mul_pd(a.v, b.v)}; }
+    friend inline SimdLane operator/(SimdLane a, SimdLane b) noexcept { return {_mm_div_pd(a.v, b.v)}; }
+    static inline SimdLane min(SimdLane a, SimdLane b) noexcept { return {_mm_min_pd(a.v, b.v)}; }
+    static inline SimdLane max(SimdLane a, SimdLane b) noexcept { return {_mm_max_pd(a.v, b.v)}; }
+    static inline SimdLane abs(SimdLane a) noexcept { return {_mm_andnot_pd(_mm_set1_pd(-0.), a.v)}; }
+    static inline SimdLane sqrt(SimdLane a) noexcept { return {_mm_sqrt_pd(a.v)}; }
+    static inline SimdLane lt(SimdLane a, SimdLane b) noexcept { return {_mm_cmplt_pd(a.v, b.v)}; }
+    static inline SimdLane le(SimdLane a, SimdLane b) noexcept { return {_mm_cmple_pd(a.v, b.v)}; }
+    static inline SimdLane mand(SimdLane a, SimdLane b) noexcept { return {_mm_and_pd(a.v, b.v)}; }
+    static inline SimdLane mor(SimdLane a, SimdLane b) noexcept { return {_mm_or_pd(a.v, b.v)}; }
+    static inline SimdLane select(SimdLane m, SimdLane a, SimdLane b) noexcept {
+        return {_mm_or_pd(_mm_and_pd(m.v, a.v), _mm_andnot_pd(m.v, b.v))};
+    }
+    static inline void      storeMask(SimdLane m, std::uint8_t* p) noexcept {
+        const int bits = _mm_movemask_pd(m.v);
+        p[0] = static_cast<std::uint8_t>(bits & 1);
+        p[1] = static_cast<std::uint8_t>((bits >> 1) & 1);
+    }
+};
+constexpr const char* simdLaneIsa = "sse2";
+#elif defined(QAN_SIMD_NEON)
+struct SimdLane {
+    static constexpr std::size_t width = 2;
+    float64x2_t v;
+    static inline SimdLane load(const double* p) noexcept { return {vld1q_f64(p)}; }
+    inline void     store(double* p) const noexcept { vst1q_f64(p, v); }
+    static inline SimdLane set1(double d) noexcept { return {vdupq_n_f64(d)}; }
+    friend inline SimdLane operator+(SimdLane a, SimdLane b) noexcept { return {vaddq_f64(a.v, b.v)}; }
+    friend inline SimdLane operator-(SimdLane a, SimdLane b) noexcept { return {vsubq_f64(a.v, b.v)}; }
+    friend inline SimdLane operator*(SimdLane a, SimdLane b) noexcept { return {vmulq_f64(a.v, b.v)}; }
+    friend inline SimdLane operator/(SimdLane a, SimdLane b) noexcept { return {vdivq_f64(a.v, b.v)}; }
+    static inline SimdLane min(SimdLane a, SimdLane b) noexcept { return {vminq_f64(a.v, b.v)}; }
+    static inline SimdLane max(SimdLane a, SimdLane b) noexcept { return {vmaxq_f64(a.v, b.v)}; }
+    static inline SimdLane abs(SimdLane a) noexcept { return {vabsq_f64(a.v)}; }
+    static inline SimdLane sqrt(SimdLane a) noexcept { return {vsqrtq_f64(a.v)}; }
+    static inline SimdLane lt(SimdLane a, SimdLane b) noexcept { return {vreinterpretq_f64_u64(vcltq_f64(a.v, b.v))}; }
+    static inline SimdLane le(SimdLane a, SimdLane b) noexcept { return {vreinterpretq_f64_u64(vcleq_f64(a.v, b.v))}; }
+    static inline SimdLane mand(SimdLane a, SimdLane b) noexcept {
+        return {vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(a.v), vreinterpretq_u64_f64(b.v)))};
+    }
+    static inline SimdLane mor(SimdLane a, SimdLane b) noexcept {
+        return {vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(a.v), vreinterpretq_u64_f64(b.v)))};
+    }
+    static inline SimdLane select(SimdLane m, SimdLane a, SimdLane b) noexcept {
+        return {vbslq_f64(vreinterpretq_u64_f64(m.v), a.v, b.v)};
+    }
+    static inline void      storeMask(SimdLane m, std::uint8_t* p) noexcept {
+        const uint64x2_t bits = vreinterpretq_u64_f64(m.v);
+        p[0] = vgetq_lane_u64(bits, 0) != 0 ? 1 : 0;
+        p[1] = vgetq_lane_u64(bits, 1) != 0 ? 1 : 0;
+    }
+};
+constexpr const char* simdLaneIsa = "neon";
+#else
+using SimdLane = ScalarLane;
+constexpr const char* simdLaneIsa = "scalar";
+#endif
+
+} // ::qan::simd
+} // ::qan
@@ -0,0 +1,234 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::sort std::max std::unique
+#include <cmath>        // std::floor
+#include <limits>
+
+// QuickQanava headers
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+//! Items overlapping more cells are stored in the large items list.
+constexpr std::int64_t maxItemCells = 256;
+} // ::qan::anonymous
+
+/* SpatialIndex Object Management *///-----------------------------------------
+SpatialIndex::SpatialIndex(qreal cellSize) noexcept :
+    _cellSize{cellSize > 1. ? cellSize : 1.}
+{ }
+
+std::int32_t    SpatialIndex::cellCoord(qreal c) const noexcept
+{
+    const auto cell = std::floor(c / _cellSize);
+    constexpr auto lowest = static_cast<qreal>(std::numeric_limits<std::int32_t>::lowest());
+    constexpr auto highest = static_cast<qreal>(std::numeric_limits<std::int32_t>::max());
+    return static_cast<std::int32_t>(std::max(lowest, std::min(highest, cell)));
+}
+
+template <class F>
+bool    SpatialIndex::forEachCell(const QRectF& rect, F f) const noexcept
+{
+    const auto left = cellCoord(rect.left());
+    const auto right = cellCoord(rect.right());
+    const auto top = cellCoord(rect.top());
+    const auto bottom = cellCoord(rect.bottom());
+    const auto cellCount = ( static_cast<std::int64_t>(right) - left + 1 ) *
+                           ( static_cast<std::int64_t>(bottom) - top + 1 );
+    if (cellCount > maxItemCells)
+        return false;
+    for (auto x = left; x <= right; ++x)
+        for (auto y = top; y <= bottom; ++y)
+            f(cellKey(x, y));
+    return true;
+}
+
+void    SpatialIndex::insert(const QQuickItem* item, const QRectF& rect, qreal z) noexcept
+{
+    if (item == nullptr)
+        return;
+    auto entry = _entries.find(item);
+    if (entry != _entries.end()) {
+        if (entry->second.rect == rect) {   // Fast path for z only modifications
+            entry->second.z = z;
+            return;
+        }
+        updateBounds(&entry->second.rect, &rect);
+        unlink(item, entry->second.rect, entry->second.large);
+    } else {
+        entry = _entries.emplace(item, Entry{rect, z, ++_order, false}).first;
+        updateBounds(nullptr, &rect);
+    }
+    entry->second.rect = rect;
+    entry->second.z = z;
+    entry->second.large = !forEachCell(rect, [this, item](CellKey key) {
+        _cells[key].push_back(item);
+    });
+    if (entry->second.large)
+        _largeItems.push_back(item);
+}
+
+void    SpatialIndex::remove(const QQuickItem* item) noexcept
+{
+    const auto entry = _entries.find(item);
+    if (entry == _entries.end())
+        return;
+    updateBounds(&entry->second.rect, nullptr);
+    unlink(item, entry->second.rect, entry->second.large);
+    _entries.erase(entry);
+}
+
+void    SpatialIndex::updateBounds(const QRectF* previous, const QRectF* rect) noexcept
+{
+    if (_boundsDirty)
+        return;     // Bounds will be recomputed anyway
+    if (previous != nullptr &&  // Previous rect defining a bounds border might have been shrinked or removed
+        ( previous->left() <= _bounds.left() || previous->right() >= _bounds.right() ||
+          previous->top() <= _bounds.top() || previous->bottom() >= _bounds.bottom() )) {
+        _boundsDirty = true;
+        return;
+    }
+    if (rect != nullptr)
+        _bounds = _bounds.united(*rect);    // Note: QRectF::united() ignore null rects
+}
+
+QRectF  SpatialIndex::bounds() const noexcept
+{
+    if (_boundsDirty) {
+        _bounds = QRectF{};
+        for (const auto& entry : _entries)
+            _bounds = _bounds.united(entry.second.rect);
+        _boundsDirty = false;
+    }
+    return _bounds;
+}
+
+void    SpatialIndex::unlink(const QQuickItem* item, const QRectF& rect, bool large) noexcept
+{
+    const auto eraseFrom = [item](std::vector<const QQuickItem*>& items) {
+        const auto it = std::find(items.begin(), items.end(), item);
+        if (it != items.end()) {        // Order in cells is irrelevant, swap with last
+            *it = items.back();
+            items.pop_back();
+        }
+    };
+    if (large) {
+        eraseFrom(_largeItems);
+        return;
+    }
+    forEachCell(rect, [this, &eraseFrom](CellKey key) {
+        const auto cell = _cells.find(key);
+        if (cell != _cells.end()) {
+            eraseFrom(cell->second);
+            if (cell->second.empty())
+                _cells.erase(cell);
+        }
+    });
+}
+
+void    SpatialIndex::clear() noexcept
+{
+    _entries.clear();
+    _cells.clear();
+    _largeItems.clear();
+    _bounds = QRectF{};
+    _boundsDirty = false;
+}
+
+std::vector<const QQuickItem*>  SpatialIndex::itemsAt(const QPointF& p) const noexcept
+{
+    std::vector<const QQuickItem*> items;
+    const auto collect = [this, &p, &items](const std::vector<const QQuickItem*>& candidates) {
+        for (const auto candidate : candidates) {
+            const auto entry = _entries.find(candidate);
+            if (entry != _entries.end() &&
+                entry->second.rect.contains(p))
+                items.push_back(candidate);
+        }
+    };
+    const auto cell = _cells.find(cellKey(cellCoord(p.x()), cellCoord(p.y())));
+    if (cell != _cells.end())
+        collect(cell->second);
+    collect(_largeItems);
+    std::sort(items.begin(), items.end(), [this](const QQuickItem* i1, const QQuickItem* i2) {
+        const auto& e1 = _entries.find(i1)->second;
+        const auto& e2 = _entries.find(i2)->second;
+        return e1.z > e2.z || ( e1.z == e2.z && e1.order > e2.order );
+    });
+    return items;
+}
+
+std::vector<const QQuickItem*>  SpatialIndex::itemsIn(const QRectF& rect) const noexcept
+{
+    std::vector<const QQuickItem*> items;
+    const auto intersects = [this, &rect](const QQuickItem* candidate) {
+        const auto entry = _entries.find(candidate);
+        return entry != _entries.end() &&
+               entry->second.rect.intersects(rect);
+    };
+    const auto scanned = forEachCell(rect, [this, &items, &intersects](CellKey key) {
+        const auto cell = _cells.find(key);
+        if (cell == _cells.end())
+            return;
+        for (const auto candidate : cell->second)
+            if (intersects(candidate))
+                items.push_back(candidate);
+    });
+    if (!scanned) {     // rect overlap too many cells, scan all entries
+        items.clear();
+        for (const auto& entry : _entries)
+            if (!entry.second.large &&
+                entry.second.rect.intersects(rect))
+                items.push_back(entry.first);
+    } else {            // An item overlapping multiple cells is collected multiple times
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+    }
+    for (const auto candidate : _largeItems)
+        if (intersects(candidate))
+            items.push_back(candidate);
+    return items;
+}
+
+QRectF  SpatialIndex::rectOf(const QQuickItem* item) const noexcept
+{
+    const auto entry = _entries.find(item);
+    return entry != _entries.end() ? entry->second.rect : QRectF{};
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,137 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.h
+// \author	benoit@destrat.io
+// \date	2026 10 14
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QRectF>
+#include <QPointF>
+
+QT_BEGIN_NAMESPACE
+class QQuickItem;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+/*! \brief Z aware uniform grid spatial index of item bounding rects.
+ *
+ * Items are bucketed in square cells of \c cellSize, an item is referenced in every cell its rect
+ * overlaps (items overlapping too many cells are stored in a separate "large items" list scanned on every
+ * query). Point queries are O(k) where k is the number of items in the point cell.
+ *
+ * Index store item key, rect and z, items are never dereferenced.
+ */
+class SpatialIndex
+{
+    /*! \name SpatialIndex Object Management *///------------------------------
+    //@{
+public:
+    explicit SpatialIndex(qreal cellSize = 256.) noexcept;
+    ~SpatialIndex() noexcept = default;
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+public:
+    //! Insert \c item with bounding \c rect and \c z, or update \c item rect and z if it is already indexed.
+    void        insert(const QQuickItem* item, const QRectF& rect, qreal z) noexcept;
+    //! Remove \c item from index (nothing is done if \c item is not indexed).
+    void        remove(const QQuickItem* item) noexcept;
+    //! Return true if \c item is indexed.
+    inline bool contains(const QQuickItem* item) const noexcept { return _entries.find(item) != _entries.end(); }
+    //! Remove all items from index.
+    void        clear() noexcept;
+    //! Number of items actually indexed.
+    inline int  size() const noexcept { return static_cast<int>(_entries.size()); }
+
+    /*! \brief Return items whose rect contains \c p, ordered from top to bottom.
+     *
+     * Items are ordered by decreasing z, items with the same z are ordered in reverse insertion order (last inserted above).
+     */
+    std::vector<const QQuickItem*>  itemsAt(const QPointF& p) const noexcept;
+
+    /*! \brief Return items whose rect intersects \c rect (unordered, every item is returned once).
+     *
+     * Query is O(c + k) where c is the number of cells overlapped by \c rect, a \c rect overlapping too many cells
+     * is resolved with a linear scan of indexed items.
+     */
+    std::vector<const QQuickItem*>  itemsIn(const QRectF& rect) const noexcept;
+
+    //! Return \c item indexed rect (an empty rect if \c item is not indexed).
+    QRectF                          rectOf(const QQuickItem* item) const noexcept;
+
+    /*! \brief Return the union of all indexed items rects (an empty rect if index is empty).
+     *
+     * Bounds are maintained incrementally: growing an item rect is O(1), shrinking or removing an item
+     * standing on bounds border trigger a lazy O(n) recomputation on next bounds() call.
+     */
+    QRectF                          bounds() const noexcept;
+
+private:
+    using   CellKey = std::uint64_t;
+    inline  CellKey cellKey(std::int32_t x, std::int32_t y) const noexcept {
+        return ( static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 ) | static_cast<std::uint32_t>(y);
+    }
+    inline  std::int32_t    cellCoord(qreal c) const noexcept;
+    //! Call \c f with the key of every cell overlapped by \c rect, return false if \c rect overlap too many cells.
+    template <class F>
+    bool    forEachCell(const QRectF& rect, F f) const noexcept;
+    void    unlink(const QQuickItem* item, const QRectF& rect, bool large) noexcept;
+
+    struct Entry {
+        QRectF          rect;
+        qreal           z = 0.;
+        std::uint64_t   order = 0;
+        bool            large = false;
+    };
+
+    qreal                                                       _cellSize = 256.;
+    std::uint64_t                                               _order = 0;
+    std::unordered_map<const QQuickItem*, Entry>                _entries;
+    std::unordered_map<CellKey, std::vector<const QQuickItem*>> _cells;
+    std::vector<const QQuickItem*>                              _largeItems;
+    //! Union of indexed rects, valid when _boundsDirty is false.
+    mutable QRectF                                              _bounds;
+    mutable bool                                                _boundsDirty = false;
+    //! Grow bounds with \c rect, or mark bounds dirty if \c previous rect stand on bounds border.
+    void    updateBounds(const QRectF* previous, const QRectF* rect) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -189,6 +189,17 @@ void    EdgeStyle::setLineType( LineType lineType ) noexcept
     if ( lineType != _lineType ) {
         _lineType = lineType;
         emit lineTypeChanged();
+        emit geometryModified();
+        emit styleModified();
+    }
+}
+
+void    EdgeStyle::setCustomShape( const QString& customShape ) noexcept
+{
+    if ( customShape != _customShape ) {
+        _customShape = customShape;
+        emit customShapeChanged();
+        emit geometryModified();
         emit styleModified();
     }
 }
@@ -198,6 +209,7 @@ void    EdgeStyle::setLineColor( const QColor& lineColor ) noexcept
     if ( lineColor != _lineColor ) {
         _lineColor = lineColor;
         emit lineColorChanged();
+        emit paintModified();
         emit styleModified();
     }
 }
@@ -207,6 +219,7 @@ void    EdgeStyle::setLineWidth( qreal lineWidth ) noexcept
     if ( !qFuzzyCompare( 1.0 + lineWidth, 1.0 + _lineWidth ) ) {
         _lineWidth = lineWidth;
         emit lineWidthChanged();
+        emit paintModified();
         emit styleModified();
     }
 }
@@ -216,6 +229,7 @@ void    EdgeStyle::setArrowSize( qreal arrowSize ) noexcept
     if ( !qFuzzyCompare(1. + arrowSize, 1. + _arrowSize ) ) {
         _arrowSize = arrowSize;
         emit arrowSizeChanged();
+        emit geometryModified();
         emit styleModified();
     }
 }
@@ -225,6 +239,7 @@ auto    EdgeStyle::setSrcShape(ArrowShape srcShape) noexcept -> void
     if ( _srcShape != srcShape ) {
         _srcShape = srcShape;
         emit srcShapeChanged();
+        emit geometryModified();
         emit styleModified();
     }
 }
@@ -234,6 +249,7 @@ auto    EdgeStyle::setDstShape(ArrowShape dstShape) noexcept -> void
     if ( _dstShape != dstShape ) {
         _dstShape = dstShape;
         emit dstShapeChanged();
+        emit geometryModified();
         emit styleModified();
     }
 }
@@ -243,13 +259,19 @@ void    EdgeStyle::setDashed( bool dashed ) noexcept
     if ( dashed != _dashed ) {
         _dashed = dashed;
         emit dashedChanged();
+        emit paintModified();
+        emit styleModified();
     }
 }
 
 void    EdgeStyle::setDashPattern( const QVector<qreal>& dashPattern ) noexcept
 {
-    _dashPattern = dashPattern;
-    emit dashPatternChanged();
+    if ( dashPattern != _dashPattern ) {
+        _dashPattern = dashPattern;
+        emit dashPatternChanged();
+        emit paintModified();
+        emit styleModified();
+    }
 }
 
 const QVector<qreal>& EdgeStyle::getDashPattern() const noexcept { return _dashPattern; }
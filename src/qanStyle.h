@@ -327,7 +327,20 @@ public:
     /*! \name Properties Management *///---------------------------------------
     //@{
 signals:
+    //! Emitted when any edge style property affecting edge rendering is modified.
     void            styleModified();
+    /*! \brief Emitted when a property affecting concrete edge geometry is modified (lineType, customShape, arrowSize, srcShape and dstShape).
+     *
+     * Edge items using this style have to regenerate their geometry, they are scheduled for a batched
+     * update with qan::Graph::scheduleEdgeItemUpdate().
+     */
+    void            geometryModified();
+    /*! \brief Emitted when a paint only property is modified (lineColor, lineWidth, dashed and dashPattern).
+     *
+     * Paint only modifications never trigger an edge geometry update: delegates bind directly to style
+     * properties, and qan::EdgeBatchRenderer only update its batch material or vertices once per frame.
+     */
+    void            paintModified();
 
 public:
     //! End type drawing configuration
@@ -353,7 +366,9 @@ public:
     enum class LineType : unsigned int {
         Straight    = 0,
         Curved      = 1,
-        Ortho       = 2
+        Ortho       = 2,
+        //! Polyline generated by a C++ shape registered with qan::EdgeItem::registerShape() (see \c customShape).
+        Custom      = 3
     };
     Q_ENUM(LineType)
 
@@ -367,6 +382,20 @@ protected:
 signals:
     void            lineTypeChanged();
 
+public:
+    //! Name of a C++ edge shape registered with qan::EdgeItem::registerShape(), used when \c lineType is Custom (default to empty).
+    Q_PROPERTY( QString customShape READ getCustomShape WRITE setCustomShape NOTIFY customShapeChanged FINAL )
+    //! \copydoc customShape
+    void            setCustomShape( const QString& customShape ) noexcept;
+    //! \copydoc customShape
+    inline const QString&   getCustomShape() const noexcept { return _customShape; }
+protected:
+    //! \copydoc customShape
+    QString         _customShape;
+signals:
+    //! \copydoc customShape
+    void            customShapeChanged();
+
 public:
     Q_PROPERTY( QColor lineColor READ getLineColor WRITE setLineColor NOTIFY lineColorChanged FINAL )
     void                    setLineColor( const QColor& lineColor ) noexcept;
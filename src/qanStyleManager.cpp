@@ -56,6 +56,15 @@ void    StyleManager::clear()
     _styles.clear();
     _nodeStyles.clear();
     _edgeStyles.clear();
+
+    for (const auto& style : _tableStyles)
+        if (style)
+            disconnect(style, nullptr, this, nullptr);
+    _styleTable.clear();
+    _tableStyles.clear();
+    _styleIndexes.clear();
+    ++_styleTableVersion;
+    emit styleTableModified(-1);
 }
 //-----------------------------------------------------------------------------
 
@@ -124,5 +133,79 @@ qan::Style*     StyleManager::getStyleAt( int s )
 
 //-----------------------------------------------------------------------------
 
+/* Style Table *///------------------------------------------------------------
+int     StyleManager::getStyleIndex(const qan::Style* style) noexcept
+{
+    if (style == nullptr)
+        return -1;
+    const auto styleIndex = _styleIndexes.find(style);
+    if (styleIndex != _styleIndexes.end())
+        return styleIndex->second;
+
+    const auto index = static_cast<int>(_styleTable.size());
+    _styleTable.emplace_back();
+    _tableStyles.emplace_back(style);
+    _styleIndexes.emplace(style, index);
+
+    const auto update = [this, index]() { updateStyleEntry(index); };
+    if (const auto nodeStyle = qobject_cast<const qan::NodeStyle*>(style)) {
+        connect(nodeStyle, &qan::NodeStyle::backColorChanged,   this, update);
+        connect(nodeStyle, &qan::NodeStyle::backOpacityChanged, this, update);
+        connect(nodeStyle, &qan::NodeStyle::borderColorChanged, this, update);
+        connect(nodeStyle, &qan::NodeStyle::borderWidthChanged, this, update);
+        connect(nodeStyle, &qan::NodeStyle::backRadiusChanged,  this, update);
+    } else if (const auto edgeStyle = qobject_cast<const qan::EdgeStyle*>(style))
+        connect(edgeStyle, &qan::EdgeStyle::styleModified,      this, update);
+    // Style pointer is only used as a key, entry is kept (with its last values) to keep indexes stable
+    connect(style, &QObject::destroyed, this, [this, style]() { _styleIndexes.erase(style); });
+
+    updateStyleEntry(index);
+    return index;
+}
+
+int     StyleManager::findStyleIndex(const qan::Style* style) const noexcept
+{
+    const auto styleIndex = _styleIndexes.find(style);
+    return styleIndex != _styleIndexes.end() ? styleIndex->second : -1;
+}
+
+void    StyleManager::updateStyleEntry(int index) noexcept
+{
+    if (index < 0 ||
+        index >= static_cast<int>(_styleTable.size()))
+        return;
+    const auto style = _tableStyles[static_cast<std::size_t>(index)];
+    if (!style)
+        return;
+    const auto rgba = [](const QColor& color, qreal opacity = 1.) {
+        const auto alpha = qBound(0., color.alphaF() * opacity, 1.);
+        StyleEntry::Rgba c;
+        c.r = static_cast<uchar>(qRound(color.redF() * alpha * 255.));
+        c.g = static_cast<uchar>(qRound(color.greenF() * alpha * 255.));
+        c.b = static_cast<uchar>(qRound(color.blueF() * alpha * 255.));
+        c.a = static_cast<uchar>(qRound(alpha * 255.));
+        return c;
+    };
+    auto& entry = _styleTable[static_cast<std::size_t>(index)];
+    if (const auto nodeStyle = qobject_cast<const qan::NodeStyle*>(style.data())) {
+        entry.fillColor = rgba(nodeStyle->getBackColor(), nodeStyle->getBackOpacity());
+        entry.strokeColor = rgba(nodeStyle->getBorderColor());
+        entry.strokeWidth = static_cast<float>(nodeStyle->getBorderWidth());
+        entry.radius = static_cast<float>(nodeStyle->getBackRadius());
+    } else if (const auto edgeStyle = qobject_cast<const qan::EdgeStyle*>(style.data())) {
+        entry.fillColor = StyleEntry::Rgba{};
+        entry.strokeColor = rgba(edgeStyle->getLineColor());
+        entry.strokeWidth = static_cast<float>(edgeStyle->getLineWidth());
+        entry.radius = static_cast<float>(edgeStyle->getArrowSize());
+        const auto& dashPattern = edgeStyle->getDashPattern();
+        const auto dashed = edgeStyle->getDashed() && !dashPattern.isEmpty();
+        entry.dash = dashed ? static_cast<float>(dashPattern.at(0)) : 0.f;
+        entry.gap = dashed ? static_cast<float>(dashPattern.size() > 1 ? dashPattern.at(1) : dashPattern.at(0)) : 0.f;
+    }
+    entry.version = ++_styleTableVersion;
+    emit styleTableModified(index);
+}
+//-----------------------------------------------------------------------------
+
 } // ::qan
 
@@ -35,6 +35,10 @@
 #ifndef qanStyleManager_h
 #define qanStyleManager_h
 
+// Std headers
+#include <vector>
+#include <unordered_map>
+
 // Qt headers
 #include <QSortFilterProxyModel>
 #include <QQuickImageProvider>
@@ -116,6 +120,70 @@ public:
     Q_INVOKABLE qan::Style*         getStyleAt(int s);
     //@}
     //-------------------------------------------------------------------------
+
+    /*! \name Style Table *///-------------------------------------------------
+    //@{
+public:
+    /*! \brief Packed rendering data of a node or edge style, see getStyleTable().
+     *
+     * Colors are premultiplied RGBA8, ready to be copied in QSGGeometry::ColoredPoint2D vertices.
+     */
+    struct StyleEntry {
+        struct Rgba {
+            uchar   r = 0, g = 0, b = 0, a = 0;
+        };
+        //! Node \c backColor (with \c backOpacity), transparent for edges.
+        Rgba    fillColor;
+        //! Node \c borderColor or edge \c lineColor.
+        Rgba    strokeColor;
+        //! Node \c borderWidth or edge \c lineWidth.
+        float   strokeWidth = 0.f;
+        //! Node \c backRadius or edge \c arrowSize.
+        float   radius = 0.f;
+        //! Edge dash pattern first dash and gap lengths (in line width unit), 0. for solid lines and nodes.
+        float   dash = 0.f;
+        float   gap = 0.f;
+        //! Style table version when this entry was last modified (see getStyleTableVersion()).
+        quint64 version = 0;
+    };
+
+    /*! \brief Return \c style index in style table, \c style is added to the table if necessary (-1 if \c style is nullptr).
+     *
+     * Indexes are stable until clear() is called: an entry is never reused, even once its style is destroyed.
+     */
+    int                             getStyleIndex(const qan::Style* style) noexcept;
+    //! Return \c style index in style table, or -1 if \c style has never been added with getStyleIndex().
+    int                             findStyleIndex(const qan::Style* style) const noexcept;
+
+    /*! \brief Packed rendering data for all styles referenced with getStyleIndex().
+     *
+     * Batched renderers keep a per element style index and read colors, widths, radius and dash pattern from this
+     * table instead of reaching style QObjects through properties. Entries are updated as soon as their style is
+     * modified, then styleTableModified() is emitted with entry index, so that renderers could patch only the
+     * elements using that style.
+     */
+    inline const std::vector<StyleEntry>&  getStyleTable() const noexcept { return _styleTable; }
+    //! Return style table \c index entry, or nullptr if \c index is invalid.
+    inline const StyleEntry*        getStyleEntry(int index) const noexcept {
+        return index >= 0 && index < static_cast<int>(_styleTable.size()) ? &_styleTable[static_cast<std::size_t>(index)] : nullptr;
+    }
+    //! Style table version, incremented each time an entry is added or modified.
+    inline quint64                  getStyleTableVersion() const noexcept { return _styleTableVersion; }
+
+signals:
+    //! Emitted when style table entry \c index is added or modified, \c index is -1 when the whole table is cleared.
+    void                            styleTableModified(int index);
+
+private:
+    //! Read style table entry \c index from its style, then emit styleTableModified().
+    void                            updateStyleEntry(int index) noexcept;
+
+    std::vector<StyleEntry>             _styleTable;
+    std::vector<QPointer<const qan::Style>> _tableStyles;
+    std::unordered_map<const qan::Style*, int>  _styleIndexes;
+    quint64                             _styleTableVersion = 0;
+    //@}
+    //-------------------------------------------------------------------------
 };
 
 } // ::qan
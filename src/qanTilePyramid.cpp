@@ -0,0 +1,176 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTilePyramid.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cstring>      // std::memcmp std::memcpy
+
+// Qt headers
+#include <QtEndian>
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanTilePyramid.h"
+
+namespace qan { // ::qan
+
+constexpr const char*   TilePyramid::magic;
+constexpr quint32       TilePyramid::version;
+constexpr qint64        TilePyramid::headerSize;
+constexpr qint64        TilePyramid::levelSize;
+
+namespace { // ::qan::anonymous
+
+inline quint32  readUInt32(const uchar* p) noexcept { return qFromLittleEndian<quint32>(p); }
+inline quint64  readUInt64(const uchar* p) noexcept { return qFromLittleEndian<quint64>(p); }
+inline double   readDouble(const uchar* p) noexcept {
+    const auto bits = readUInt64(p);
+    double d;
+    std::memcpy(&d, &bits, sizeof(double));
+    return d;
+}
+
+} // ::qan::anonymous
+
+/* TilePyramid Object Management *///------------------------------------------
+TilePyramid::~TilePyramid() noexcept { close(); }
+//-----------------------------------------------------------------------------
+
+/* Pyramid Access *///---------------------------------------------------------
+bool    TilePyramid::open(const QString& filePath) noexcept
+{
+    close();
+    _file.setFileName(filePath);
+    if (!_file.open(QIODevice::ReadOnly)) {
+        qWarning() << "qan::TilePyramid::open(): Error:" << _file.errorString();
+        return false;
+    }
+    const auto invalid = [this](const char* error) {
+        qWarning() << "qan::TilePyramid::open(): Error:" << error << _file.fileName();
+        close();
+        return false;
+    };
+    _size = _file.size();
+    if (_size < headerSize)
+        return invalid("not a tile pyramid file");
+    _data = _file.map(0, _size);
+    if (_data == nullptr)
+        return invalid("file could not be mapped");
+    if (std::memcmp(_data, magic, 8) != 0 ||
+        readUInt32(_data + 8) != version)
+        return invalid("not a tile pyramid file or unsupported version");
+    _tileSize = static_cast<int>(readUInt32(_data + 12));
+    const auto levelCount = static_cast<qint64>(readUInt32(_data + 16));
+    _sceneRect = QRectF{readDouble(_data + 24), readDouble(_data + 32),
+                        readDouble(_data + 40), readDouble(_data + 48)};
+    if (_tileSize <= 0 ||
+        levelCount <= 0 ||
+        headerSize + levelCount * levelSize > _size)
+        return invalid("corrupted tile pyramid header");
+
+    qint64 tileCount = 0;
+    _levels.reserve(static_cast<std::size_t>(levelCount));
+    for (qint64 l = 0; l < levelCount; ++l) {
+        const auto p = _data + headerSize + l * levelSize;
+        Level level;
+        level.zoom = readDouble(p);
+        level.tileCountX = static_cast<int>(readUInt32(p + 8));
+        level.tileCountY = static_cast<int>(readUInt32(p + 12));
+        level.firstTile = tileCount;
+        tileCount += static_cast<qint64>(level.tileCountX) * level.tileCountY;
+        _levels.push_back(level);
+    }
+    const auto tileBytes = static_cast<qint64>(_tileSize) * _tileSize * 4;
+    const auto indexOffset = headerSize + levelCount * levelSize;
+    if (indexOffset + tileCount * 8 > _size)
+        return invalid("corrupted tile pyramid index");
+    for (qint64 t = 0; t < tileCount; ++t) {     // Check tiles once, tile() does not have to
+        const auto offset = static_cast<qint64>(readUInt64(_data + indexOffset + t * 8));
+        if (offset != 0 &&
+            (offset < indexOffset + tileCount * 8 || offset + tileBytes > _size))
+            return invalid("corrupted tile pyramid index");
+    }
+    return true;
+}
+
+void    TilePyramid::close() noexcept
+{
+    if (_data != nullptr)
+        _file.unmap(const_cast<uchar*>(_data));
+    _data = nullptr;
+    _size = 0;
+    _file.close();
+    _tileSize = 0;
+    _sceneRect = QRectF{};
+    _levels.clear();
+}
+
+int     TilePyramid::levelForZoom(qreal zoom) const noexcept
+{
+    int result = 0;
+    for (int l = 0; l < static_cast<int>(_levels.size()); ++l)
+        if (_levels[static_cast<std::size_t>(l)].zoom >= zoom)
+            result = l;     // Levels are sorted by decreasing zoom
+    return result;
+}
+
+QRectF  TilePyramid::tileRect(int level, int x, int y) const noexcept
+{
+    if (level < 0 ||
+        level >= static_cast<int>(_levels.size()))
+        return QRectF{};
+    const auto size = _tileSize / _levels[static_cast<std::size_t>(level)].zoom;
+    return QRectF{_sceneRect.x() + x * size, _sceneRect.y() + y * size, size, size};
+}
+
+QImage  TilePyramid::tile(int level, int x, int y) const noexcept
+{
+    if (_data == nullptr ||
+        level < 0 ||
+        level >= static_cast<int>(_levels.size()))
+        return QImage{};
+    const auto& l = _levels[static_cast<std::size_t>(level)];
+    if (x < 0 || x >= l.tileCountX ||
+        y < 0 || y >= l.tileCountY)
+        return QImage{};
+    const auto indexOffset = headerSize + static_cast<qint64>(_levels.size()) * levelSize;
+    const auto t = l.firstTile + static_cast<qint64>(y) * l.tileCountX + x;
+    const auto offset = static_cast<qint64>(readUInt64(_data + indexOffset + t * 8));
+    if (offset == 0)
+        return QImage{};    // Empty tile
+    // Note: const uchar* constructor does not copy nor modify pixels
+    return QImage{_data + offset, _tileSize, _tileSize, _tileSize * 4, QImage::Format_RGBA8888_Premultiplied};
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,130 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTilePyramid.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <vector>
+
+// Qt headers
+#include <QFile>
+#include <QImage>
+#include <QRectF>
+#include <QString>
+
+namespace qan { // ::qan
+
+/*! \brief Read only, memory mapped zoom level tile pyramid of a pre-rendered graph.
+ *
+ * Pyramid files are written with qan::GraphExporter::exportTilePyramid() and displayed with qan::TileView. Level 0 is
+ * the most detailed level (exporter \c zoom), zoom is halved from a level to the next one until the whole scene fits
+ * in a single tile: a tile of level l + 1 exactly covers 2x2 tiles of level l, all levels tiles grids start at scene
+ * rect top left corner.
+ *
+ * File layout (little endian, 8 bytes aligned):
+ * \li Header: "QANTILES" magic, quint32 version, tile size, level count and a reserved quint32, scene rect x, y,
+ * width and height as doubles (in graph container CS).
+ * \li Levels: for each level, zoom (double), tile count along x and y (quint32).
+ * \li Tile index: for each level, for each tile (row major), tile data offset in file (quint64, 0 for an empty tile
+ * where no primitive is drawn, empty tiles are not stored).
+ * \li Tiles: raw premultiplied RGBA8888 pixels, \c tileSize x \c tileSize.
+ *
+ * Tiles are not compressed: tile images directly wrap mapped file memory, file pages are loaded on demand by the OS
+ * when a tile is first displayed.
+ */
+class TilePyramid
+{
+    /*! \name TilePyramid Object Management *///-------------------------------
+    //@{
+public:
+    TilePyramid() = default;
+    ~TilePyramid() noexcept;
+    TilePyramid(const TilePyramid&) = delete;
+    TilePyramid& operator=(const TilePyramid&) = delete;
+
+    //! Pyramid files magic bytes.
+    static constexpr const char*    magic = "QANTILES";
+    //! Pyramid files format version.
+    static constexpr quint32        version = 1;
+    //! Size in bytes of file header (magic, version, tile size, level count and scene rect).
+    static constexpr qint64         headerSize = 56;
+    //! Size in bytes of a level description.
+    static constexpr qint64         levelSize = 16;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Pyramid Access *///----------------------------------------------
+    //@{
+public:
+    //! Map pyramid \c filePath, return false if file could not be mapped or is not a valid pyramid file.
+    bool        open(const QString& filePath) noexcept;
+    //! Unmap current file, images returned by tile() must no longer be used.
+    void        close() noexcept;
+    inline bool isOpen() const noexcept { return _data != nullptr; }
+
+    struct Level {
+        qreal   zoom = 1.;
+        int     tileCountX = 0;
+        int     tileCountY = 0;
+        //! Index of level first tile in tile index.
+        qint64  firstTile = 0;
+    };
+    inline const std::vector<Level>&    getLevels() const noexcept { return _levels; }
+    inline int                          getTileSize() const noexcept { return _tileSize; }
+    //! Pyramid scene rect in graph container CS.
+    inline const QRectF&                getSceneRect() const noexcept { return _sceneRect; }
+
+    //! Return the coarsest level whose zoom is greater or equal to \c zoom (level 0 if \c zoom exceed level 0 zoom).
+    int         levelForZoom(qreal zoom) const noexcept;
+    //! Return \c level tile \c x, \c y rect in graph container CS.
+    QRectF      tileRect(int level, int x, int y) const noexcept;
+    /*! \brief Return \c level tile \c x, \c y image wrapping mapped file memory (no copy).
+     *
+     * Return a null image for an empty tile or invalid coordinates.
+     */
+    QImage      tile(int level, int x, int y) const noexcept;
+
+private:
+    QFile               _file;
+    const uchar*        _data = nullptr;
+    qint64              _size = 0;
+    int                 _tileSize = 0;
+    QRectF              _sceneRect;
+    std::vector<Level>  _levels;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
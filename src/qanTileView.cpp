@@ -0,0 +1,350 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTileView.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max std::min std::nth_element
+#include <cmath>        // std::floor
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QUrl>
+#include <QQuickWindow>
+#include <QSGNode>
+#include <QSGSimpleTextureNode>
+#include <QSGTexture>
+
+// QuickQanava headers
+#include "./qanTileView.h"
+#include "./qanGraph.h"
+#include "./qanNode.h"
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Maximum number of tile textures created per frame, remaining tiles are uploaded in following frames.
+constexpr int   maxUploadsPerFrame = 8;
+
+//! Tile view root node, own tile textures (cache is destroyed with the scene graph, on render thread).
+class TileRootNode : public QSGNode
+{
+public:
+    TileRootNode() = default;
+    virtual ~TileRootNode() override { clearTextures(); }
+    TileRootNode(const TileRootNode&) = delete;
+
+    void    clearTextures() noexcept {
+        for (auto& texture : textures)
+            delete texture.second.texture;
+        textures.clear();
+    }
+
+    static inline quint64   tileKey(int level, int x, int y) noexcept {
+        return (static_cast<quint64>(level) << 48) |
+               (static_cast<quint64>(x) << 24) |
+                static_cast<quint64>(y);
+    }
+
+    struct Entry {
+        //! nullptr for an empty tile.
+        QSGTexture* texture = nullptr;
+        quint64     lastUse = 0;
+    };
+    std::unordered_map<quint64, Entry>  textures;
+    //! Pyramid textures have been created from (kept alive until textures are released).
+    std::shared_ptr<qan::TilePyramid>   pyramid;
+    quint64                             frame = 0;
+};
+
+} // ::qan::anonymous
+
+/* TileView Object Management *///--------------------------------------------
+TileView::TileView(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setAcceptHoverEvents(true);
+    setAcceptedMouseButtons(Qt::LeftButton | Qt::RightButton);
+}
+
+TileView::~TileView() { /* Nil */ }
+
+void    TileView::setGraph(qan::Graph* graph) noexcept
+{
+    if (_graph == graph)
+        return;
+    setActiveNode(nullptr);
+    if (_graph)
+        disconnect(_graph, nullptr, this, nullptr);
+    _graph = graph;
+    _pickIndexDirty = true;
+    if (_graph) {
+        const auto invalidatePickIndex = [this]() { _pickIndexDirty = true; };
+        connect(_graph, &qan::Graph::nodeInserted,          this, invalidatePickIndex);
+        connect(_graph, &qan::Graph::nodeRemoved,           this, [this](qan::Node* node) {
+            _pickIndexDirty = true;
+            if (node == _activeNode) {
+                _activeNode = nullptr;
+                _activeNodeAttached = false;
+                emit activeNodeChanged();
+            }
+        });
+        connect(_graph, &qan::Graph::updateEnded,           this, invalidatePickIndex);
+        connect(_graph, &qan::Graph::viewportRectChanged,   this, &QQuickItem::update);
+    }
+    emit graphChanged();
+}
+
+void    TileView::setSource(const QString& source) noexcept
+{
+    if (_source == source)
+        return;
+    _source = source;
+    _pyramid.reset();   // Scene graph keep previous pyramid alive until its textures are released
+    if (!_source.isEmpty()) {
+        const QUrl url{_source};
+        auto pyramid = std::make_shared<qan::TilePyramid>();
+        if (pyramid->open(url.isLocalFile() ? url.toLocalFile() : _source)) {
+            _pyramid = pyramid;
+            const auto& sceneRect = _pyramid->getSceneRect();
+            setPosition(sceneRect.topLeft());
+            setSize(sceneRect.size());
+        } else
+            qWarning() << "qan::TileView::setSource(): Error: " << _source << " is not a valid tile pyramid.";
+    }
+    update();
+    emit sourceChanged();
+}
+
+void    TileView::setCacheSize(int cacheSize) noexcept
+{
+    cacheSize = std::max(16, cacheSize);
+    if (_cacheSize == cacheSize)
+        return;
+    _cacheSize = cacheSize;
+    emit cacheSizeChanged();
+}
+//-----------------------------------------------------------------------------
+
+/* Picking and Interaction *///-----------------------------------------------
+qan::Node*  TileView::nodeAt(const QPointF& p) const noexcept
+{
+    if (!_graph)
+        return nullptr;
+    if (_pickIndexDirty)
+        updatePickIndex();
+    const auto items = _pickIndex.itemsAt(p);
+    // Keys are qan::Node pointers stored as opaque index keys (see updatePickIndex())
+    return items.empty() ? nullptr :
+                           reinterpret_cast<qan::Node*>(const_cast<QQuickItem*>(items.front()));
+}
+
+void    TileView::updatePickIndex() const noexcept
+{
+    _pickIndex.clear();
+    _pickIndexDirty = false;
+    if (!_graph)
+        return;
+    for (const auto& node : _graph->get_nodes())
+        if (node && !node->is_group())
+            _pickIndex.insert(reinterpret_cast<const QQuickItem*>(node.get()), node->getGeometry(), 0.);
+}
+
+void    TileView::setActiveNode(qan::Node* activeNode) noexcept
+{
+    if (_activeNode == activeNode)
+        return;
+    if (_activeNode &&
+        _activeNodeAttached &&
+        _graph) {
+        const auto nodeItem = _activeNode->getItem();
+        if (nodeItem == nullptr ||
+            !nodeItem->getSelected()) {
+            _graph->detachNodeItem(*_activeNode);
+            // Node might have been dragged while active, update its pick geometry
+            const auto key = reinterpret_cast<const QQuickItem*>(_activeNode.data());
+            _pickIndex.remove(key);
+            _pickIndex.insert(key, _activeNode->getGeometry(), 0.);
+        }
+    }
+    _activeNode = activeNode;
+    _activeNodeAttached = false;
+    if (_activeNode &&
+        _graph &&
+        _activeNode->getItem() == nullptr)
+        _activeNodeAttached = _graph->attachNodeItem(*_activeNode);
+    emit activeNodeChanged();
+}
+
+void    TileView::hoverMoveEvent(QHoverEvent* event)
+{
+    if (parentItem() != nullptr)
+        setActiveNode(nodeAt(mapToItem(parentItem(), event->posF())));
+    QQuickItem::hoverMoveEvent(event);
+}
+
+void    TileView::mousePressEvent(QMouseEvent* event)
+{
+    if (parentItem() != nullptr)
+        setActiveNode(nodeAt(mapToItem(parentItem(), event->localPos())));
+    event->ignore();    // Let navigable view pan
+}
+//-----------------------------------------------------------------------------
+
+/* Tile Rendering *///--------------------------------------------------------
+QSGNode*    TileView::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data)
+    const auto pyramid = _pyramid;
+    if (!pyramid ||
+        pyramid->getLevels().empty() ||
+        window() == nullptr) {
+        delete oldNode;
+        return nullptr;
+    }
+    auto root = static_cast<TileRootNode*>(oldNode);
+    if (root == nullptr)
+        root = new TileRootNode{};
+    while (const auto child = root->firstChild()) {
+        root->removeChildNode(child);
+        delete child;
+    }
+    if (root->pyramid != pyramid) {
+        root->clearTextures();
+        root->pyramid = pyramid;
+    }
+    const auto frame = ++root->frame;
+
+    // Select level from effective (view zoom and device pixel ratio) scale
+    const auto zoom = mapRectToScene(QRectF{0., 0., 1., 1.}).width() * window()->effectiveDevicePixelRatio();
+    const auto level = pyramid->levelForZoom(zoom);
+    const auto& levels = pyramid->getLevels();
+    const auto tileSize = pyramid->getTileSize();
+    const auto sceneOrigin = pyramid->getSceneRect().topLeft();
+
+    // Visible tiles range, tile rects are expressed in graph container CS (item is positionned on pyramid scene rect)
+    const auto visibleRect = mapRectFromScene(QRectF{QPointF{0., 0.}, window()->size()}) &
+                             QRectF{0., 0., width(), height()};
+    if (visibleRect.isEmpty())
+        return root;
+    const auto tileExtent = tileSize / levels[level].zoom;
+    const auto firstX = std::max(0, static_cast<int>(std::floor(visibleRect.left() / tileExtent)));
+    const auto firstY = std::max(0, static_cast<int>(std::floor(visibleRect.top() / tileExtent)));
+    const auto lastX = std::min(levels[level].tileCountX - 1, static_cast<int>(std::floor(visibleRect.right() / tileExtent)));
+    const auto lastY = std::min(levels[level].tileCountY - 1, static_cast<int>(std::floor(visibleRect.bottom() / tileExtent)));
+
+    int uploads = 0;
+    bool pending = false;
+    // Return tile texture, uploading it from mapped pyramid if upload budget allow it (nullptr for an empty tile)
+    const auto texture = [&](int l, int x, int y, bool& available) -> QSGTexture* {
+        const auto key = TileRootNode::tileKey(l, x, y);
+        auto cached = root->textures.find(key);
+        if (cached == root->textures.end()) {
+            if (uploads >= maxUploadsPerFrame) {
+                available = false;
+                return nullptr;
+            }
+            const auto image = pyramid->tile(l, x, y);
+            QSGTexture* tileTexture = nullptr;
+            if (!image.isNull()) {
+                ++uploads;
+                tileTexture = window()->createTextureFromImage(image, QQuickWindow::TextureHasAlphaChannel);
+                if (tileTexture != nullptr)
+                    tileTexture->setFiltering(QSGTexture::Linear);
+            }
+            cached = root->textures.emplace(key, TileRootNode::Entry{tileTexture, 0}).first;
+        }
+        cached->second.lastUse = frame;
+        available = true;
+        return cached->second.texture;
+    };
+
+    for (int y = firstY; y <= lastY; ++y) {
+        for (int x = firstX; x <= lastX; ++x) {
+            const auto rect = pyramid->tileRect(level, x, y).translated(-sceneOrigin);
+            bool available = false;
+            auto tileTexture = texture(level, x, y, available);
+            QRectF sourceRect{0., 0., static_cast<qreal>(tileSize), static_cast<qreal>(tileSize)};
+            if (!available) {
+                // Upload budget exhausted: fall back to the nearest coarser cached tile covering this one
+                pending = true;
+                for (int parent = level + 1; parent < static_cast<int>(levels.size()); ++parent) {
+                    const auto shift = parent - level;
+                    const auto cached = root->textures.find(TileRootNode::tileKey(parent, x >> shift, y >> shift));
+                    if (cached == root->textures.end())
+                        continue;
+                    cached->second.lastUse = frame;
+                    tileTexture = cached->second.texture;
+                    const auto extent = static_cast<qreal>(tileSize >> shift);
+                    const auto mask = (1 << shift) - 1;
+                    sourceRect = QRectF{(x & mask) * extent, (y & mask) * extent, extent, extent};
+                    break;
+                }
+            }
+            if (tileTexture == nullptr)
+                continue;
+            auto tileNode = new QSGSimpleTextureNode{};
+            tileNode->setOwnsTexture(false);
+            tileNode->setTexture(tileTexture);
+            tileNode->setSourceRect(sourceRect);
+            tileNode->setRect(rect);
+            root->appendChildNode(tileNode);
+        }
+    }
+
+    // Evict least recently used textures not displayed in this frame
+    const auto cacheSize = static_cast<std::size_t>(_cacheSize);
+    if (root->textures.size() > cacheSize) {
+        std::vector<std::pair<quint64, quint64>> uses;    // lastUse, key
+        uses.reserve(root->textures.size());
+        for (const auto& cached : root->textures)
+            if (cached.second.lastUse != frame)
+                uses.emplace_back(cached.second.lastUse, cached.first);
+        const auto evictions = std::min(uses.size(), root->textures.size() - cacheSize);
+        std::nth_element(uses.begin(), uses.begin() + evictions, uses.end());
+        for (std::size_t e = 0; e < evictions; ++e) {
+            const auto cached = root->textures.find(uses[e].second);
+            delete cached->second.texture;
+            root->textures.erase(cached);
+        }
+    }
+    if (pending)
+        update();
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
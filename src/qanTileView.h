@@ -0,0 +1,190 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTileView.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+
+// QuickQanava headers
+#include "./qanTilePyramid.h"
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+
+/*! \brief Read only display of a huge graph from a pre-rendered zoom level tile pyramid.
+ *
+ * For static reference graphs with millions of primitives, even virtualized items are not viable. TileView display
+ * a qan::TilePyramid written with qan::GraphExporter::exportTilePyramid(): graph is kept \c headless (topology and
+ * node geometry only, no items), view pan and zoom over the tiles like a map, and only the level matching current
+ * zoom is drawn, with tiles intersecting the window. Tile textures are uploaded from the memory mapped file when
+ * they are first displayed (at most 8 per frame, missing tiles are replaced by a cached coarser level tile) and are
+ * kept in a \c cacheSize LRU cache.
+ *
+ * Picking is answered from a spatial index of nodes geometry (see nodeAt()), a real qan::NodeItem is created only for
+ * the node under interaction (\c activeNode, hovered or pressed node) and released once it is no longer active.
+ *
+ * TileView must be a child of graph container item, below graph items:
+ * \code
+ * Qan.GraphView {
+ *   id: graphView
+ *   graph: Qan.Graph { id: graph; headless: true }
+ *   Qan.TileView {
+ *     parent: graphView.containerItem
+ *     z: -1
+ *     graph: graph
+ *     source: "file:///tmp/dependencies.qtp"
+ *   }
+ * }
+ * \endcode
+ *
+ * \nosubgrouping
+ */
+class TileView : public QQuickItem
+{
+    /*! \name TileView Object Management *///----------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit TileView(QQuickItem* parent = nullptr);
+    virtual ~TileView() override;
+    TileView(const TileView&) = delete;
+
+public:
+    //! Displayed graph, used for picking and to create active node item (graph should be \c headless).
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    //! \copydoc graph
+    inline qan::Graph*  getGraph() const noexcept { return _graph.data(); }
+    //! \copydoc graph
+    void                setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+signals:
+    void                graphChanged();
+
+public:
+    /*! \brief Tile pyramid file (local file path or url), item is moved and resized to pyramid scene rect.
+     *
+     * \c loaded is set to false with a warning if file is not a valid pyramid.
+     */
+    Q_PROPERTY(QString source READ getSource WRITE setSource NOTIFY sourceChanged FINAL)
+    //! \copydoc source
+    inline QString      getSource() const noexcept { return _source; }
+    //! \copydoc source
+    void                setSource(const QString& source) noexcept;
+private:
+    QString             _source;
+signals:
+    void                sourceChanged();
+
+public:
+    //! True when \c source has been successfully mapped.
+    Q_PROPERTY(bool loaded READ getLoaded NOTIFY sourceChanged FINAL)
+    //! \copydoc loaded
+    inline bool         getLoaded() const noexcept { return _pyramid && _pyramid->isOpen(); }
+
+public:
+    //! Maximum number of tile textures kept in memory (default to 256, minimum 16).
+    Q_PROPERTY(int cacheSize READ getCacheSize WRITE setCacheSize NOTIFY cacheSizeChanged FINAL)
+    //! \copydoc cacheSize
+    inline int          getCacheSize() const noexcept { return _cacheSize; }
+    //! \copydoc cacheSize
+    void                setCacheSize(int cacheSize) noexcept;
+private:
+    int                 _cacheSize = 256;
+signals:
+    void                cacheSizeChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Picking and Interaction *///-------------------------------------
+    //@{
+public:
+    /*! \brief Return the top most node whose geometry contains \c p (in graph container CS), or nullptr.
+     *
+     * Query is answered from a spatial index of graph non group nodes geometry (rebuilt lazily when nodes are
+     * inserted or removed), no item is created.
+     */
+    Q_INVOKABLE qan::Node*  nodeAt(const QPointF& p) const noexcept;
+
+    /*! \brief Node under interaction (hovered or pressed), the only node with a live item created by this view.
+     *
+     * Previous active node item is released when active node change, unless it is selected.
+     */
+    Q_PROPERTY(qan::Node* activeNode READ getActiveNode WRITE setActiveNode NOTIFY activeNodeChanged FINAL)
+    //! \copydoc activeNode
+    inline qan::Node*   getActiveNode() const noexcept { return _activeNode.data(); }
+    //! \copydoc activeNode
+    void                setActiveNode(qan::Node* activeNode) noexcept;
+private:
+    QPointer<qan::Node> _activeNode;
+    //! True if active node item has been created by this view (and must be released).
+    bool                _activeNodeAttached = false;
+signals:
+    void                activeNodeChanged();
+
+protected:
+    virtual void        hoverMoveEvent(QHoverEvent* event) override;
+    virtual void        mousePressEvent(QMouseEvent* event) override;
+
+private:
+    //! Index graph nodes geometry (keys are qan::Node pointers, never dereferenced by the index).
+    void                updatePickIndex() const noexcept;
+    mutable qan::SpatialIndex   _pickIndex;
+    mutable bool                _pickIndexDirty = true;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Tile Rendering *///----------------------------------------------
+    //@{
+protected:
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Shared with scene graph root node: mapped memory is kept until textures of a previous \c source are released.
+    std::shared_ptr<qan::TilePyramid>   _pyramid;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::TileView)
@@ -0,0 +1,124 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTrace.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <chrono>
+#include <fstream>
+
+// QuickQanava headers
+#include "./qanTrace.h"
+
+namespace qan { // ::qan
+
+/* ChromeTraceSink *///--------------------------------------------------------
+ChromeTraceSink::ChromeTraceSink(const std::string& fileName) :
+    _fileName{fileName}
+{
+    _events.reserve(1 << 14);
+}
+
+ChromeTraceSink::~ChromeTraceSink()
+{
+    flush();
+}
+
+void    ChromeTraceSink::event(const char* name, const char* category,
+                               std::int64_t begin, std::int64_t duration, std::uint64_t thread) noexcept
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    try {
+        _events.push_back(Event{name, category, begin, duration, thread});
+    } catch (...) { }   // Drop event on allocation failure
+}
+
+bool    ChromeTraceSink::flush() noexcept
+{
+    std::lock_guard<std::mutex> lock{_mutex};
+    try {
+        std::ofstream file{_fileName, std::ios::out | std::ios::trunc};
+        if (!file)
+            return false;
+        // Complete ("X") events, timestamps in us
+        file << "{\"traceEvents\":[";
+        bool first = true;
+        for (const auto& event : _events) {
+            file << (first ? "\n" : ",\n");
+            first = false;
+            file << "{\"name\":\"" << (event.name != nullptr ? event.name : "") << "\","
+                 << "\"cat\":\"" << (event.category != nullptr ? event.category : "") << "\","
+                 << "\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread << ','
+                 << "\"ts\":" << event.begin / 1000 << '.' << (event.begin % 1000) / 100 << ','
+                 << "\"dur\":" << event.duration / 1000 << '.' << (event.duration % 1000) / 100 << '}';
+        }
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return static_cast<bool>(file);
+    } catch (...) {
+        return false;
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Trace *///------------------------------------------------------------------
+std::atomic<TraceSink*>  Trace::_sink{nullptr};
+std::atomic<std::uint64_t>  Trace::_counters[static_cast<int>(TraceCounter::Count)] = {};
+
+void    Trace::setSink(std::shared_ptr<TraceSink> sink) noexcept
+{
+    static std::mutex                               sinksMutex;
+    static std::vector<std::shared_ptr<TraceSink>>  sinks;  // Installed sinks, kept alive until exit
+    std::lock_guard<std::mutex> lock{sinksMutex};
+    try {
+        if (sink)
+            sinks.push_back(sink);
+    } catch (...) {
+        return;
+    }
+    _sink.store(sink.get(), std::memory_order_release);
+}
+
+std::int64_t    Trace::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::uint64_t   Trace::threadId() noexcept
+{
+    // Small sequential ids (trace viewers parse ids as JavaScript numbers)
+    static std::atomic<std::uint64_t>   nextId{1};
+    static thread_local const std::uint64_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
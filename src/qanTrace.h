@@ -0,0 +1,181 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTrace.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace qan { // ::qan
+
+/*! \brief Receive trace events emitted by QuickQanava trace points (see QAN_TRACE_SCOPE()).
+ *
+ * \note event() is called concurrently from any thread (layout, flow and routing workers included).
+ */
+class TraceSink
+{
+public:
+    virtual ~TraceSink() = default;
+    /*! \brief Record a \c name event of \c category starting at \c begin and lasting \c duration (ns, steady clock) on \c thread.
+     *
+     * \c name and \c category are string literals, they could be stored without copy.
+     */
+    virtual void    event(const char* name, const char* category,
+                          std::int64_t begin, std::int64_t duration, std::uint64_t thread) noexcept = 0;
+};
+
+/*! \brief Buffer trace events and write them in Chrome trace event JSON format (open with chrome://tracing or ui.perfetto.dev).
+ *
+ * \code
+ * auto sink = std::make_shared<qan::ChromeTraceSink>("quickqanava.json");
+ * qan::Trace::setSink(sink);
+ * // ...
+ * sink->flush();
+ * \endcode
+ */
+class ChromeTraceSink : public TraceSink
+{
+public:
+    explicit ChromeTraceSink(const std::string& fileName);
+    //! Flush buffered events.
+    virtual ~ChromeTraceSink() override;
+    ChromeTraceSink(const ChromeTraceSink&) = delete;
+
+    virtual void    event(const char* name, const char* category,
+                          std::int64_t begin, std::int64_t duration, std::uint64_t thread) noexcept override;
+    //! Write all events recorded so far to file (file is rewritten), return false on i/o error.
+    bool            flush() noexcept;
+
+private:
+    struct Event {
+        const char*     name;
+        const char*     category;
+        std::int64_t    begin;
+        std::int64_t    duration;
+        std::uint64_t   thread;
+    };
+    const std::string   _fileName;
+    std::mutex          _mutex;
+    std::vector<Event>  _events;
+};
+
+/*! \brief Hot path counters, always compiled (a relaxed atomic increment), see QAN_TRACE_COUNT() and qan::PerformanceMonitor.
+ */
+enum class TraceCounter : int {
+    EdgeItemUpdates = 0,    //!< EdgeItem::updateItem() calls.
+    ItemsCreated    = 1,    //!< Items created from a delegate component.
+    ItemsRecycled   = 2,    //!< Items moved to graph item pool.
+    ItemsReused     = 3,    //!< Items taken from graph item pool instead of being created.
+    Count           = 4
+};
+
+//! Global trace sink and counters management.
+class Trace
+{
+public:
+    /*! \brief Install \c sink as trace events receiver (nullptr to stop tracing).
+     *
+     * \note Previously installed sinks are kept alive until exit since trace scopes might still be referencing them.
+     */
+    static void         setSink(std::shared_ptr<TraceSink> sink) noexcept;
+    //! Return actual sink, or nullptr when tracing is disabled.
+    static inline TraceSink*    getSink() noexcept { return _sink.load(std::memory_order_acquire); }
+
+    //! Steady clock time in ns.
+    static std::int64_t     now() noexcept;
+    //! Current thread identifier (sequential, 1 for the first traced thread).
+    static std::uint64_t    threadId() noexcept;
+
+private:
+    static std::atomic<TraceSink*>  _sink;
+
+public:
+    //! Add \c n to \c counter (thread safe).
+    static inline void  count(TraceCounter counter, std::uint64_t n = 1) noexcept {
+        _counters[static_cast<int>(counter)].fetch_add(n, std::memory_order_relaxed);
+    }
+    //! Return \c counter value since process start (counters are never reset, compute deltas between reads).
+    static inline std::uint64_t getCounter(TraceCounter counter) noexcept {
+        return _counters[static_cast<int>(counter)].load(std::memory_order_relaxed);
+    }
+private:
+    static std::atomic<std::uint64_t>   _counters[static_cast<int>(TraceCounter::Count)];
+};
+
+/*! \brief Emit a trace event lasting for this object lifetime (nothing is measured when no sink is installed).
+ *
+ * Use QAN_TRACE_SCOPE() rather than a TraceScope directly, trace points are then compiled out when QUICKQANAVA_TRACE
+ * is not defined (CMake QUICKQANAVA_TRACE option).
+ */
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name, const char* category = "qan") noexcept :
+        _name{name}, _category{category},
+        _begin{Trace::getSink() != nullptr ? Trace::now() : -1} { }
+    ~TraceScope() noexcept {
+        if (_begin >= 0) {
+            const auto sink = Trace::getSink();
+            if (sink != nullptr)
+                sink->event(_name, _category, _begin, Trace::now() - _begin, Trace::threadId());
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char*         _name;
+    const char*         _category;
+    const std::int64_t  _begin;
+};
+
+} // ::qan
+
+#define QAN_TRACE_CONCAT_IMPL(a, b) a##b
+#define QAN_TRACE_CONCAT(a, b) QAN_TRACE_CONCAT_IMPL(a, b)
+
+//! Increment qan::TraceCounter \c counter (always active, independently of QUICKQANAVA_TRACE).
+#define QAN_TRACE_COUNT(counter) qan::Trace::count(qan::TraceCounter::counter)
+
+#if defined(QUICKQANAVA_TRACE)
+//! Trace enclosing scope as a \c name event (\c name must be a string literal).
+#define QAN_TRACE_SCOPE(name) const qan::TraceScope QAN_TRACE_CONCAT(qanTraceScope, __LINE__){name}
+#else
+#define QAN_TRACE_SCOPE(name)
+#endif
@@ -0,0 +1,370 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTreeKernel.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// GTpo headers
+#include <gtpo/utils.h>
+
+// QuickQanava headers
+#include "./qanTreeKernel.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+constexpr auto  invalidNode = std::numeric_limits<std::uint32_t>::max();
+
+/*! \brief Spanning forest of a layout job, forest roots are children of a virtual root indexed size().
+ *
+ * Children of node \c v are <tt>children[begin[v]]</tt> to <tt>children[begin[v + 1]]</tt>, \c order is a BFS
+ * order (parents before children).
+ */
+struct Forest
+{
+    std::vector<std::uint32_t>  parent;
+    std::vector<std::size_t>    begin;
+    std::vector<std::uint32_t>  children;
+    //! Index of node in its parent children.
+    std::vector<std::uint32_t>  number;
+    std::vector<std::uint32_t>  depth;
+    std::vector<std::uint32_t>  order;
+    std::uint32_t               root = 0;
+
+    inline bool             isLeaf(std::uint32_t v) const noexcept { return begin[v] == begin[v + 1]; }
+    inline std::uint32_t    firstChild(std::uint32_t v) const noexcept { return children[begin[v]]; }
+    inline std::uint32_t    lastChild(std::uint32_t v) const noexcept { return children[begin[v + 1] - 1]; }
+    inline std::uint32_t    leftSibling(std::uint32_t v) const noexcept {
+        return v == root || number[v] == 0 ? invalidNode : children[begin[parent[v]] + number[v] - 1];
+    }
+    inline std::uint32_t    leftmostSibling(std::uint32_t v) const noexcept { return children[begin[parent[v]]]; }
+};
+
+//! Extract a BFS spanning forest of \c job from nodes with no in edges, remaining nodes (in cycles) are taken as roots. O(n + m).
+Forest  spanningForest(const LayoutJob& job)
+{
+    const auto n = job.size();
+    const auto count = n + 1;
+    Forest f;
+    f.root = static_cast<std::uint32_t>(n);
+    f.parent.assign(count, invalidNode);
+    f.order.reserve(count);
+    f.order.push_back(f.root);
+    std::vector<std::uint32_t> inDegrees(n, 0);
+    for (std::size_t v = 0; v < n; ++v)
+        for (auto e = job.offsets[v]; e < job.offsets[v + 1]; ++e) {
+            const auto t = job.targets[e];
+            if (t < n && t != v)
+                ++inDegrees[t];
+        }
+    for (std::uint32_t v = 0; v < n; ++v)
+        if (inDegrees[v] == 0) {
+            f.parent[v] = f.root;
+            f.order.push_back(v);
+        }
+    std::uint32_t next = 0;     // Next root candidate when BFS is exhausted
+    for (std::size_t i = 1; i < count; ++i) {
+        if (i == f.order.size()) {
+            while (f.parent[next] != invalidNode)
+                ++next;
+            f.parent[next] = f.root;
+            f.order.push_back(next);
+        }
+        const auto v = f.order[i];
+        for (auto e = job.offsets[v]; e < job.offsets[v + 1]; ++e) {
+            const auto t = job.targets[e];
+            if (t < n && f.parent[t] == invalidNode) {
+                f.parent[t] = v;
+                f.order.push_back(t);
+            }
+        }
+    }
+
+    // Children are sorted by parent, keeping BFS (ie out edges) order
+    f.begin.assign(count + 1, 0);
+    for (std::size_t i = 1; i < count; ++i)
+        ++f.begin[f.parent[f.order[i]] + 1];
+    for (std::size_t v = 0; v < count; ++v)
+        f.begin[v + 1] += f.begin[v];
+    f.children.resize(n);
+    f.number.assign(count, 0);
+    f.depth.assign(count, 0);
+    auto cursors = f.begin;
+    for (std::size_t i = 1; i < count; ++i) {
+        const auto v = f.order[i];
+        const auto p = f.parent[v];
+        f.number[v] = static_cast<std::uint32_t>(cursors[p] - f.begin[p]);
+        f.children[cursors[p]++] = v;
+        f.depth[v] = f.depth[p] + 1;
+    }
+    return f;
+}
+
+} // ::qan::anonymous
+
+int     runTree(LayoutJob& job, const TreeParameters& parameters,
+                const TreeState* previous, TreeState* state)
+{
+    if (state != nullptr)
+        state->entries.clear();
+    const auto n = job.size();
+    if (n == 0)
+        return 0;
+    const auto f = spanningForest(job);
+    const auto count = n + 1;
+    const auto root = f.root;
+    const auto& breadths = parameters.horizontal ? job.height : job.width;
+    const auto& thicknesses = parameters.horizontal ? job.width : job.height;
+    const auto breadth = [&breadths, root](std::uint32_t v) { return v == root ? 0. : breadths[v]; };
+    const bool hasKeys = job.keys.size() == n;
+    const bool incremental = hasKeys && previous != nullptr && !previous->empty();
+
+    // Subtree signatures, children before parents
+    std::vector<std::uint64_t> signatures;
+    if (hasKeys && (incremental || state != nullptr)) {
+        auto seed = gtpo::hash_combine(gtpo::hash_combine(gtpo::hash_combine(0, gtpo::hash_bits(parameters.siblingSpacing)),
+                                                          gtpo::hash_bits(parameters.subtreeSpacing)),
+                                       static_cast<std::uint64_t>(parameters.horizontal));
+        signatures.assign(count, 0);
+        for (std::size_t i = count; i-- > 1; ) {
+            const auto v = f.order[i];
+            auto signature = gtpo::hash_combine(gtpo::hash_combine(seed, job.keys[v]), gtpo::hash_bits(breadths[v]));
+            signature = gtpo::hash_combine(signature, static_cast<std::uint64_t>(f.begin[v + 1] - f.begin[v]));
+            for (auto c = f.begin[v]; c < f.begin[v + 1]; ++c)
+                signature = gtpo::hash_combine(signature, signatures[f.children[c]]);
+            signatures[v] = signature;
+        }
+    }
+
+    // Unchanged subtrees: 1 for a reused subtree root, 2 for a node inside a reused subtree
+    std::vector<std::uint8_t> reused(count, 0);
+    if (incremental) {
+        for (std::size_t i = 1; i < count; ++i) {
+            const auto v = f.order[i];
+            if (reused[f.parent[v]] != 0) {
+                reused[v] = 2;
+                continue;
+            }
+            const auto entry = previous->entries.find(job.keys[v]);
+            if (entry != previous->entries.cend() &&
+                entry->second.signature == signatures[v])
+                reused[v] = 1;
+        }
+    }
+
+    // Walker first walk (Buchheim et al.), children before parents, left to right
+    std::vector<double> prelim(count, 0.), mod(count, 0.), shift(count, 0.), change(count, 0.);
+    std::vector<std::uint32_t> thread(count, invalidNode), ancestor(count);
+    for (std::uint32_t v = 0; v < count; ++v)
+        ancestor[v] = v;
+    const auto distance = [&f, &parameters, &breadth](std::uint32_t left, std::uint32_t right) {
+        const bool siblings = f.parent[left] == f.parent[right] && f.parent[left] != f.root;
+        return (breadth(left) + breadth(right)) / 2. + (siblings ? parameters.siblingSpacing : parameters.subtreeSpacing);
+    };
+    const auto nextLeft = [&f, &thread](std::uint32_t v) { return f.isLeaf(v) ? thread[v] : f.firstChild(v); };
+    const auto nextRight = [&f, &thread](std::uint32_t v) { return f.isLeaf(v) ? thread[v] : f.lastChild(v); };
+    const auto moveSubtree = [&](std::uint32_t wm, std::uint32_t wp, double s) {
+        const auto subtrees = static_cast<double>(f.number[wp] - f.number[wm]);
+        change[wp] -= s / subtrees;
+        shift[wp] += s;
+        change[wm] += s / subtrees;
+        prelim[wp] += s;
+        mod[wp] += s;
+    };
+    const auto apportion = [&](std::uint32_t v, std::uint32_t& defaultAncestor) {
+        const auto w = f.leftSibling(v);
+        if (w == invalidNode)
+            return;
+        auto vip = v, vop = v, vim = w, vom = f.leftmostSibling(v);
+        auto sip = mod[vip], sop = mod[vop], sim = mod[vim], som = mod[vom];
+        auto right = nextRight(vim);
+        auto left = nextLeft(vip);
+        while (right != invalidNode && left != invalidNode) {
+            vim = right;
+            vip = left;
+            vom = nextLeft(vom);
+            vop = nextRight(vop);
+            ancestor[vop] = v;
+            const auto s = (prelim[vim] + sim) - (prelim[vip] + sip) + distance(vim, vip);
+            if (s > 0.) {
+                const auto a = f.parent[ancestor[vim]] == f.parent[v] ? ancestor[vim] : defaultAncestor;
+                moveSubtree(a, v, s);
+                sip += s;
+                sop += s;
+            }
+            sim += mod[vim];
+            sip += mod[vip];
+            som += mod[vom];
+            sop += mod[vop];
+            right = nextRight(vim);
+            left = nextLeft(vip);
+        }
+        if (right != invalidNode && nextRight(vop) == invalidNode) {
+            thread[vop] = right;
+            mod[vop] += sim - sop;
+        }
+        if (left != invalidNode && nextLeft(vom) == invalidNode) {
+            thread[vom] = left;
+            mod[vom] += sip - som;
+            defaultAncestor = v;
+        }
+    };
+
+    // Restore a reused subtree relative layout (prelim relative to subtree root) and its left and right contours threads
+    std::vector<std::uint32_t> stack, leftContour, rightContour;
+    const auto restore = [&](std::uint32_t r) {
+        leftContour.clear();
+        rightContour.clear();
+        stack.push_back(r);
+        while (!stack.empty()) {        // Preorder, left to right: first node of a level is leftmost, last is rightmost
+            const auto u = stack.back();
+            stack.pop_back();
+            const auto level = f.depth[u] - f.depth[r];
+            if (level == leftContour.size()) {
+                leftContour.push_back(u);
+                rightContour.push_back(u);
+            } else
+                rightContour[level] = u;
+            if (u != r) {
+                const auto entry = previous->entries.find(job.keys[u]);
+                prelim[u] = (f.parent[u] == r ? 0. : prelim[f.parent[u]]) +
+                            (entry != previous->entries.cend() ? entry->second.offset : 0.);
+            }
+            for (auto c = f.begin[u + 1]; c-- > f.begin[u]; )
+                stack.push_back(f.children[c]);
+        }
+        for (std::size_t level = 0; level + 1 < leftContour.size(); ++level) {
+            if (f.isLeaf(leftContour[level]))
+                thread[leftContour[level]] = leftContour[level + 1];
+            if (f.isLeaf(rightContour[level]))
+                thread[rightContour[level]] = rightContour[level + 1];
+        }
+    };
+
+    std::vector<std::uint32_t> walk;    // Postorder, left to right (reversed right to left preorder)
+    walk.reserve(count);
+    stack.push_back(root);
+    while (!stack.empty()) {
+        const auto v = stack.back();
+        stack.pop_back();
+        walk.push_back(v);
+        if (reused[v] == 0)
+            for (auto c = f.begin[v]; c < f.begin[v + 1]; ++c)
+                stack.push_back(f.children[c]);
+    }
+    std::reverse(walk.begin(), walk.end());
+    // Note: a node is placed next to its left sibling by its parent, once left sibling subtree has been apportioned
+    const auto place = [&](std::uint32_t v) {
+        const auto w = f.leftSibling(v);
+        const auto midpoint = f.isLeaf(v) || reused[v] != 0 ? 0. :
+                                                              (prelim[f.firstChild(v)] + prelim[f.lastChild(v)]) / 2.;
+        if (w != invalidNode) {
+            prelim[v] = prelim[w] + distance(w, v);
+            if (!f.isLeaf(v))           // Reused subtree children are centered on its root
+                mod[v] = prelim[v] - midpoint;
+        } else
+            prelim[v] = midpoint;
+    };
+    for (const auto v : walk) {
+        if (reused[v] != 0)
+            restore(v);
+        if (reused[v] != 0 || f.isLeaf(v))
+            continue;
+        auto defaultAncestor = f.firstChild(v);
+        for (auto c = f.begin[v]; c < f.begin[v + 1]; ++c) {
+            place(f.children[c]);
+            apportion(f.children[c], defaultAncestor);
+        }
+        auto s = 0., c = 0.;            // Execute shifts
+        for (auto i = f.begin[v + 1]; i-- > f.begin[v]; ) {
+            const auto u = f.children[i];
+            prelim[u] += s;
+            mod[u] += s;
+            c += change[u];
+            s += shift[u] + c;
+        }
+    }
+
+    // Second walk, parents before children: sum ancestors modifiers
+    std::vector<double> along(count, 0.), sums(count, 0.);
+    std::vector<double> levelThickness;
+    for (std::size_t i = 1; i < count; ++i) {
+        const auto v = f.order[i];
+        const auto p = f.parent[v];
+        sums[v] = sums[p] + mod[p];
+        along[v] = prelim[v] + sums[v];
+        const auto level = f.depth[v] - 1;
+        if (level >= levelThickness.size())
+            levelThickness.resize(level + 1, 0.);
+        levelThickness[level] = std::max(levelThickness[level], thicknesses[v]);
+    }
+    std::vector<double> levelCenter(levelThickness.size(), 0.);
+    for (std::size_t l = 0; l < levelThickness.size(); ++l) {
+        const auto levelTop = l == 0 ? 0. : levelCenter[l - 1] + levelThickness[l - 1] / 2. + parameters.levelSpacing;
+        levelCenter[l] = levelTop + levelThickness[l] / 2.;
+    }
+
+    if (state != nullptr && hasKeys) {
+        state->entries.reserve(n);
+        for (std::uint32_t v = 0; v < n; ++v) {
+            TreeState::Entry entry;
+            entry.signature = signatures[v];
+            entry.offset = f.parent[v] == root ? 0. : along[v] - along[f.parent[v]];
+            state->entries[job.keys[v]] = entry;
+        }
+    }
+
+    // Keep nodes bounding box top left corner
+    auto left = std::numeric_limits<double>::max();
+    auto top = std::numeric_limits<double>::max();
+    auto newLeft = std::numeric_limits<double>::max();
+    for (std::size_t v = 0; v < n; ++v) {
+        left = std::min(left, job.x[v] - job.width[v] / 2.);
+        top = std::min(top, job.y[v] - job.height[v] / 2.);
+        newLeft = std::min(newLeft, along[v] - breadths[v] / 2.);
+    }
+    for (std::size_t v = 0; v < n; ++v) {
+        const auto a = along[v] - newLeft;
+        const auto c = levelCenter[f.depth[v] - 1];
+        job.x[v] = left + (parameters.horizontal ? c : a);
+        job.y[v] = top + (parameters.horizontal ? a : c);
+    }
+    return static_cast<int>(walk.size() - 1);
+}
+
+} // ::qan
@@ -0,0 +1,98 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTreeKernel.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <unordered_map>
+
+// QuickQanava headers
+#include "./qanLayoutJob.h"
+
+namespace qan { // ::qan
+
+//! Parameters of qan::runTree().
+struct TreeParameters
+{
+    //! Space between two consecutive levels.
+    double      levelSpacing = 80.;
+    //! Minimum space between two siblings.
+    double      siblingSpacing = 20.;
+    //! Minimum space between two adjacent nodes that are not siblings (including forest roots).
+    double      subtreeSpacing = 40.;
+    //! Levels are laid out from left to right instead of top to bottom.
+    bool        horizontal = false;
+};
+
+/*! \brief Subtrees signature and relative layout of a tidy tree layout, used by an incremental qan::runTree().
+ *
+ * Entries are indexed by qan::LayoutJob::keys.
+ */
+struct TreeState
+{
+    struct Entry {
+        //! Hash of node subtree keys, nodes breadth (width or height when horizontal) and layout parameters.
+        std::uint64_t   signature = 0;
+        //! Offset of node center from its tree parent center, across levels (0. for a root).
+        double          offset = 0.;
+    };
+    std::unordered_map<std::uint64_t, Entry>    entries;
+
+    inline bool empty() const noexcept { return entries.empty(); }
+};
+
+/*! \brief Run a tidy tree layout on \c job, return the number of nodes actually laid out.
+ *
+ * \li A spanning forest is extracted with a BFS from nodes with no in edges (shallowest parent is kept for DAGs),
+ *     nodes only reachable through a cycle are taken as roots in index order, forest roots are laid out side by side.
+ * \li Walker algorithm with Buchheim et al. linear time improvements (threads, ancestors and deferred shifts,
+ *     O(n)), iterative: deep trees do not overflow the stack. Siblings are ordered by out edges order and parents
+ *     are centered over their first and last children.
+ * \li Separation accounts for nodes \c width (or \c height when \c horizontal), levels thickness is the largest
+ *     node \c height (or \c width when \c horizontal) of the level.
+ *
+ * Layout is translated so that nodes bounding box top left corner is kept, \c job \c x and \c y are updated in
+ * place, \c job \c mobility is ignored.
+ *
+ * When \c previous is a non empty state, layout is incremental: subtrees whose signature did not change since
+ * \c previous are not laid out again, their \c previous relative layout is reused as a block (only its contour is
+ * restored), so that only subtrees modified by a node or edge insertion or removal (and their ancestors) are
+ * walked. When \c state is not nullptr, it is set with the resulting signatures and relative layout.
+ */
+int     runTree(LayoutJob& job, const TreeParameters& parameters,
+                const TreeState* previous = nullptr, TreeState* state = nullptr);
+
+} // ::qan
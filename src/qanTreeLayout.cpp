@@ -0,0 +1,119 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTreeLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>    // std::max
+
+// QuickQanava headers
+#include "./qanTreeLayout.h"
+
+namespace qan { // ::qan
+
+/* TreeLayout Object Management *///-------------------------------------------
+TreeLayout::TreeLayout(QObject* parent) :
+    qan::AbstractLayout{parent}
+{
+    connect(this, &qan::AbstractLayout::finished, this, [this]() {
+        if (_pendingState)
+            _state = std::move(_pendingState);
+    });
+    connect(this, &qan::AbstractLayout::graphChanged, this, [this]() {
+        _state.reset();
+        _pendingState.reset();
+    });
+}
+
+AbstractLayout::Task    TreeLayout::createTask()
+{
+    _pendingState = std::make_shared<qan::TreeState>();
+    auto previous = _incremental ? _state : nullptr;
+    // Note: layout is a single O(n) pass, it is not cancelled
+    return [parameters = _parameters, previous = std::move(previous), state = _pendingState]
+            (qan::LayoutJob& job, qan::LayoutProgress&) {
+        return qan::runTree(job, parameters, previous.get(), state.get());
+    };
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Parameters *///------------------------------------------------------
+void    TreeLayout::setLevelSpacing(qreal levelSpacing) noexcept
+{
+    levelSpacing = std::max(0., levelSpacing);
+    if (!qFuzzyCompare(1. + levelSpacing, 1. + _parameters.levelSpacing)) {
+        _parameters.levelSpacing = levelSpacing;
+        emit levelSpacingChanged();
+    }
+}
+
+void    TreeLayout::setSiblingSpacing(qreal siblingSpacing) noexcept
+{
+    siblingSpacing = std::max(0., siblingSpacing);
+    if (!qFuzzyCompare(1. + siblingSpacing, 1. + _parameters.siblingSpacing)) {
+        _parameters.siblingSpacing = siblingSpacing;
+        emit siblingSpacingChanged();
+    }
+}
+
+void    TreeLayout::setSubtreeSpacing(qreal subtreeSpacing) noexcept
+{
+    subtreeSpacing = std::max(0., subtreeSpacing);
+    if (!qFuzzyCompare(1. + subtreeSpacing, 1. + _parameters.subtreeSpacing)) {
+        _parameters.subtreeSpacing = subtreeSpacing;
+        emit subtreeSpacingChanged();
+    }
+}
+
+void    TreeLayout::setOrientation(Qt::Orientation orientation) noexcept
+{
+    if (orientation != getOrientation()) {
+        _parameters.horizontal = orientation == Qt::Horizontal;
+        emit orientationChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Incremental Layout *///-----------------------------------------------------
+void    TreeLayout::setIncremental(bool incremental) noexcept
+{
+    if (incremental != _incremental) {
+        _incremental = incremental;
+        if (!_incremental)
+            _state.reset();
+        emit incrementalChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,152 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanTreeLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+
+// QuickQanava headers
+#include "./qanAbstractLayout.h"
+#include "./qanTreeKernel.h"
+
+namespace qan { // ::qan
+
+/*! \brief Tidy tree layout of a qan::Graph computed on a worker thread, intended for hierarchy views (org charts, file trees).
+ *
+ * Nodes are laid out in levels with Walker algorithm and Buchheim et al. linear time improvements, accounting for
+ * nodes width and height (see qan::runTree()). Graphs that are not trees are laid out using a spanning forest.
+ *
+ * When \c incremental is true, subtrees relative layout computed by the last layout are kept: next layout only
+ * walks subtrees modified by nodes or edges inserted or removed since (and their ancestors).
+ *
+ * \code
+ * Qan.TreeLayout {
+ *   id: treeLayout
+ *   graph: graph
+ *   orientation: Qt.Horizontal
+ *   incremental: true
+ * }
+ * Button { text: "Layout"; onClicked: treeLayout.start() }
+ * \endcode
+ * \nosubgrouping
+ */
+class TreeLayout : public qan::AbstractLayout
+{
+    Q_OBJECT
+    /*! \name TreeLayout Object Management *///--------------------------------
+    //@{
+public:
+    explicit TreeLayout(QObject* parent = nullptr);
+    virtual ~TreeLayout() override = default;
+    TreeLayout(const TreeLayout&) = delete;
+    TreeLayout& operator=(const TreeLayout&) = delete;
+
+protected:
+    virtual Task    createTask() override;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Parameters *///-------------------------------------------
+    //@{
+public:
+    //! Space between two consecutive levels (default to 80.).
+    Q_PROPERTY(qreal levelSpacing READ getLevelSpacing WRITE setLevelSpacing NOTIFY levelSpacingChanged FINAL)
+    void            setLevelSpacing(qreal levelSpacing) noexcept;
+    inline qreal    getLevelSpacing() const noexcept { return _parameters.levelSpacing; }
+signals:
+    void            levelSpacingChanged();
+
+public:
+    //! Minimum space between two siblings (default to 20.).
+    Q_PROPERTY(qreal siblingSpacing READ getSiblingSpacing WRITE setSiblingSpacing NOTIFY siblingSpacingChanged FINAL)
+    void            setSiblingSpacing(qreal siblingSpacing) noexcept;
+    inline qreal    getSiblingSpacing() const noexcept { return _parameters.siblingSpacing; }
+signals:
+    void            siblingSpacingChanged();
+
+public:
+    //! Minimum space between two adjacent nodes that are not siblings (default to 40.).
+    Q_PROPERTY(qreal subtreeSpacing READ getSubtreeSpacing WRITE setSubtreeSpacing NOTIFY subtreeSpacingChanged FINAL)
+    void            setSubtreeSpacing(qreal subtreeSpacing) noexcept;
+    inline qreal    getSubtreeSpacing() const noexcept { return _parameters.subtreeSpacing; }
+signals:
+    void            subtreeSpacingChanged();
+
+public:
+    //! Qt::Vertical for top to bottom levels, Qt::Horizontal for left to right levels (default to Qt::Vertical).
+    Q_PROPERTY(Qt::Orientation orientation READ getOrientation WRITE setOrientation NOTIFY orientationChanged FINAL)
+    void            setOrientation(Qt::Orientation orientation) noexcept;
+    inline Qt::Orientation  getOrientation() const noexcept { return _parameters.horizontal ? Qt::Horizontal : Qt::Vertical; }
+signals:
+    void            orientationChanged();
+
+private:
+    qan::TreeParameters     _parameters;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Incremental Layout *///------------------------------------------
+    //@{
+public:
+    /*! \brief Reuse last layout unmodified subtrees, only walk subtrees affected by a graph modification (default to false).
+     *
+     * Setting \c incremental to false (or changing \c graph) forget last layout, changing a spacing or \c orientation
+     * invalidates every subtree of last layout.
+     */
+    Q_PROPERTY(bool incremental READ getIncremental WRITE setIncremental NOTIFY incrementalChanged FINAL)
+    void            setIncremental(bool incremental) noexcept;
+    inline bool     getIncremental() const noexcept { return _incremental; }
+private:
+    bool            _incremental = false;
+signals:
+    void            incrementalChanged();
+
+private:
+    //! Result of last finished layout.
+    std::shared_ptr<const qan::TreeState>   _state;
+    //! Result of actually running layout, adopted as \c _state when layout finish.
+    std::shared_ptr<qan::TreeState>         _pendingState;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::TreeLayout)
@@ -0,0 +1,553 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanUndoStack.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+// Std headers
+#include <algorithm>
+#include <memory>
+
+// QuickQanava headers
+#include "./qanUndoStack.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* UndoStack Object Management *///--------------------------------------------
+UndoStack::UndoStack(qan::Graph& graph, QObject* parent) :
+    QObject{parent},
+    _graph{graph}
+{
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+}
+
+void    UndoStack::setEnabled(bool enabled) noexcept
+{
+    if (enabled == _enabled)
+        return;
+    _enabled = enabled;
+    if (!_enabled)
+        clear();
+    emit enabledChanged();
+}
+
+void    UndoStack::setLimit(int limit) noexcept
+{
+    limit = std::max(1, limit);
+    if (limit == _limit)
+        return;
+    _limit = limit;
+    const auto trimmed = _entries.size() > static_cast<std::size_t>(_limit);
+    while (_entries.size() > static_cast<std::size_t>(_limit)) {
+        releaseEntry(_entries.front());
+        _entries.pop_front();
+        if (_index > 0)
+            --_index;
+    }
+    emit limitChanged();
+    if (trimmed)
+        emit changed();
+}
+//-----------------------------------------------------------------------------
+
+/* Undo/Redo Management *///---------------------------------------------------
+void    UndoStack::undo() noexcept
+{
+    if (!canUndo())
+        return;
+    --_index;
+    apply(_entries[_index], true);
+    emit changed();
+}
+
+void    UndoStack::redo() noexcept
+{
+    if (!canRedo())
+        return;
+    apply(_entries[_index], false);
+    ++_index;
+    emit changed();
+}
+
+void    UndoStack::clear() noexcept
+{
+    const auto wasEmpty = _entries.empty();
+    _entries.clear();
+    _index = 0;
+    _macro.ops.clear();
+    _macro.states.clear();
+    _references.clear();
+    _keys.clear();
+    if (!wasEmpty)
+        emit changed();
+}
+
+void    UndoStack::beginMacro(const QString& text) noexcept
+{
+    if (_macroDepth++ == 0) {
+        _macro = Entry{};
+        _macro.text = text;
+        if (_enabled)
+            emit changed();     // canUndo() and canRedo() are false while a macro is recorded
+    }
+}
+
+void    UndoStack::endMacro() noexcept
+{
+    if (_macroDepth == 0)
+        return;
+    if (--_macroDepth == 0) {
+        if (!_macro.ops.empty())
+            commit(std::move(_macro));
+        _macro = Entry{};
+        if (_enabled)
+            emit changed();
+    }
+}
+
+QString UndoStack::getUndoText() const noexcept
+{
+    return _index > 0 ? _entries[_index - 1].text : QString{};
+}
+
+QString UndoStack::getRedoText() const noexcept
+{
+    return _index < _entries.size() ? _entries[_index].text : QString{};
+}
+//-----------------------------------------------------------------------------
+
+/* Operations Recording *///---------------------------------------------------
+void    UndoStack::recordMove(qan::Node& node, QPointF delta) noexcept
+{
+    if (!isRecording() ||
+        delta.isNull())
+        return;
+    const auto key = keyOf(&node);
+    if (_macroDepth > 0 &&          // Coalesce successive moves of the same node in a macro
+        !_macro.ops.empty() &&
+        _macro.ops.back().type == OpType::Move &&
+        _macro.ops.back().key == key) {
+        _macro.ops.back().delta += delta;
+        return;
+    }
+    Op op;
+    op.type = OpType::Move;
+    op.key = key;
+    op.delta = delta;
+    push(op, tr("Move"));
+}
+
+void    UndoStack::recordStyle(QObject& primitive, qan::Style* previousStyle, qan::Style* style) noexcept
+{
+    if (!isRecording() ||
+        previousStyle == style)
+        return;
+    Op op;
+    op.type = OpType::Style;
+    op.key = keyOf(&primitive);
+    State state;
+    state.style = style;
+    state.previousStyle = previousStyle;
+    push(op, tr("Change style"), &state);
+}
+
+void    UndoStack::recordInsertNode(qan::Node& node) noexcept
+{
+    if (!isRecording())
+        return;
+    const auto last = lastOp();
+    if (last != nullptr &&
+        last->type == OpType::InsertNode &&
+        resolve(last->key) == &node)
+        return;
+    Op op;
+    op.type = OpType::InsertNode;
+    op.key = keyOf(&node);
+    push(op, qobject_cast<qan::Group*>(&node) != nullptr ? tr("Insert group") : tr("Insert node"));
+}
+
+void    UndoStack::recordRemoveNode(qan::Node& node) noexcept
+{
+    if (!isRecording())
+        return;
+    Op op;
+    op.type = OpType::RemoveNode;
+    op.key = keyOf(&node);
+    auto state = captureNode(node);
+    push(op, state.isGroup ? tr("Remove group") : tr("Remove node"), &state);
+    unbind(&node);
+}
+
+void    UndoStack::recordInsertEdge(qan::Edge& edge) noexcept
+{
+    if (!isRecording())
+        return;
+    const auto last = lastOp();
+    if (last != nullptr &&      // Note: Edge insertion from QML is notified twice
+        last->type == OpType::InsertEdge &&
+        resolve(last->key) == &edge)
+        return;
+    Op op;
+    op.type = OpType::InsertEdge;
+    op.key = keyOf(&edge);
+    push(op, tr("Insert edge"));
+}
+
+void    UndoStack::recordRemoveEdge(qan::Edge& edge) noexcept
+{
+    if (!isRecording() ||
+        edge.getSource() == nullptr ||
+        edge.getDestination() == nullptr)
+        return;
+    Op op;
+    op.type = OpType::RemoveEdge;
+    op.key = keyOf(&edge);
+    op.src = keyOf(edge.getSource());
+    op.dst = keyOf(edge.getDestination());
+    auto state = captureEdge(edge);
+    push(op, tr("Remove edge"), &state);
+    unbind(&edge);
+}
+
+void    UndoStack::recordGroup(qan::Node& node, qan::Group& group) noexcept
+{
+    if (!isRecording())
+        return;
+    Op op;
+    op.type = OpType::Group;
+    op.key = keyOf(&node);
+    op.src = keyOf(&group);
+    push(op, tr("Group"));
+}
+
+void    UndoStack::recordUngroup(qan::Node& node, qan::Group& group) noexcept
+{
+    if (!isRecording())
+        return;
+    Op op;
+    op.type = OpType::Ungroup;
+    op.key = keyOf(&node);
+    op.src = keyOf(&group);
+    push(op, tr("Ungroup"));
+}
+
+std::uint32_t   UndoStack::keyOf(const QObject* primitive) noexcept
+{
+    const auto key = _keys.find(primitive);
+    if (key != _keys.end()) {
+        const auto reference = _references.find(key->second);
+        if (reference != _references.end() &&
+            reference->second.primitive.data() == primitive)
+            return key->second;
+        // Primitive has been destroyed without being unbound and its address reused: forget stale key
+        if (reference != _references.end())
+            reference->second.address = nullptr;
+        _keys.erase(key);
+    }
+    const auto newKey = _nextKey++;
+    auto& reference = _references[newKey];
+    reference.primitive = const_cast<QObject*>(primitive);
+    reference.address = primitive;
+    _keys.emplace(primitive, newKey);
+    return newKey;
+}
+
+QObject*    UndoStack::resolve(std::uint32_t key) const noexcept
+{
+    const auto reference = _references.find(key);
+    return reference != _references.end() ? reference->second.primitive.data() : nullptr;
+}
+
+void    UndoStack::rebind(std::uint32_t key, QObject* primitive) noexcept
+{
+    const auto reference = _references.find(key);
+    if (reference == _references.end() ||
+        primitive == nullptr)
+        return;
+    if (reference->second.address != nullptr)
+        _keys.erase(reference->second.address);
+    reference->second.primitive = primitive;
+    reference->second.address = primitive;
+    _keys[primitive] = key;
+}
+
+void    UndoStack::unbind(const QObject* primitive) noexcept
+{
+    const auto key = _keys.find(primitive);
+    if (key == _keys.end())
+        return;
+    const auto reference = _references.find(key->second);
+    if (reference != _references.end()) {
+        reference->second.primitive.clear();
+        reference->second.address = nullptr;
+    }
+    _keys.erase(key);
+}
+
+void    UndoStack::acquire(std::uint32_t key) noexcept
+{
+    if (key == 0)
+        return;
+    const auto reference = _references.find(key);
+    if (reference != _references.end())
+        ++reference->second.count;
+}
+
+void    UndoStack::release(std::uint32_t key) noexcept
+{
+    if (key == 0)
+        return;
+    const auto reference = _references.find(key);
+    if (reference == _references.end() ||
+        --reference->second.count > 0)
+        return;
+    if (reference->second.address != nullptr)
+        _keys.erase(reference->second.address);
+    _references.erase(reference);
+}
+
+void    UndoStack::releaseEntry(const Entry& entry) noexcept
+{
+    for (const auto& op : entry.ops) {
+        release(op.key);
+        release(op.src);
+        release(op.dst);
+    }
+    for (const auto& state : entry.states)
+        release(state.group);
+}
+
+auto    UndoStack::lastOp() const noexcept -> const Op*
+{
+    if (_macroDepth > 0)
+        return _macro.ops.empty() ? nullptr : &_macro.ops.back();
+    return _index > 0 && !_entries[_index - 1].ops.empty() ? &_entries[_index - 1].ops.back() : nullptr;
+}
+
+void    UndoStack::push(Op op, const QString& text, State* state) noexcept
+{
+    acquire(op.key);
+    acquire(op.src);
+    acquire(op.dst);
+    Entry single;
+    auto& entry = _macroDepth > 0 ? _macro : single;
+    if (state != nullptr) {
+        acquire(state->group);
+        op.state = static_cast<std::int32_t>(entry.states.size());
+        entry.states.push_back(std::move(*state));
+    }
+    entry.ops.push_back(op);
+    if (_macroDepth == 0) {     // Not in a macro: operation is an entry
+        single.text = text;
+        commit(std::move(single));
+        emit changed();
+    }
+}
+
+void    UndoStack::commit(Entry&& entry) noexcept
+{
+    while (_entries.size() > _index) {  // Recording discard redo entries
+        releaseEntry(_entries.back());
+        _entries.pop_back();
+    }
+    entry.ops.shrink_to_fit();
+    entry.states.shrink_to_fit();
+    _entries.push_back(std::move(entry));
+    while (_entries.size() > static_cast<std::size_t>(_limit)) {
+        releaseEntry(_entries.front());
+        _entries.pop_front();
+    }
+    _index = _entries.size();
+}
+
+UndoStack::State    UndoStack::captureNode(qan::Node& node) noexcept
+{
+    State state;
+    state.label = node.getLabel();
+    state.geometry = node.getGeometry();
+    state.style = const_cast<qan::NodeStyle*>(_graph.getNodeStyle(node));
+    state.isGroup = qobject_cast<qan::Group*>(&node) != nullptr;
+    state.component = _graph.getNodeDelegate(node);
+    if (node.getGroup() != nullptr)
+        state.group = keyOf(node.getGroup());
+    return state;
+}
+
+UndoStack::State    UndoStack::captureEdge(qan::Edge& edge) noexcept
+{
+    State state;
+    state.label = edge.getLabel();
+    state.style = const_cast<qan::EdgeStyle*>(_graph.getEdgeStyle(edge));
+    return state;
+}
+
+qan::Node*  UndoStack::restoreNode(const State& state) noexcept
+{
+    // Node is restored with the delegate and style it has been removed with
+    const auto style = qobject_cast<qan::NodeStyle*>(state.style.data());
+    qan::Node* node = nullptr;
+    if (!state.isGroup)
+        node = _graph.insertNode(state.component.data(), style);
+    else if (state.component) {
+        const auto group = std::make_shared<qan::Group>();
+        if (_graph.insertGroup(group, state.component.data(), style))
+            node = group.get();
+    } else
+        node = _graph.insertGroup();
+    if (node == nullptr)
+        return nullptr;
+    node->setLabel(state.label);
+    if (style != nullptr)
+        _graph.setNodeStyle(*node, style);
+    const auto group = qobject_cast<qan::Group*>(resolve(state.group));
+    if (group != nullptr)
+        _graph.groupNode(group, node, false);   // Note: geometry is restored in group coordinates
+    node->setGeometry(state.geometry);
+    return node;
+}
+
+qan::Edge*  UndoStack::restoreEdge(const State& state, std::uint32_t src, std::uint32_t dst) noexcept
+{
+    const auto source = qobject_cast<qan::Node*>(resolve(src));
+    const auto destination = qobject_cast<qan::Node*>(resolve(dst));
+    if (source == nullptr ||
+        destination == nullptr)
+        return nullptr;
+    const auto edge = _graph.insertEdge(source, destination);
+    if (edge == nullptr)
+        return nullptr;
+    edge->setLabel(state.label);
+    if (state.style)
+        _graph.setEdgeStyle(*edge, qobject_cast<qan::EdgeStyle*>(state.style.data()));
+    return edge;
+}
+
+void    UndoStack::apply(Entry& entry, bool undo) noexcept
+{
+    // Primitive state is stored before a primitive is removed, it is used to restore the primitive on next undo or redo
+    const auto storeState = [this, &entry](Op& op, State&& state) {
+        acquire(state.group);
+        if (op.state < 0) {
+            op.state = static_cast<std::int32_t>(entry.states.size());
+            entry.states.push_back(std::move(state));
+        } else {
+            auto& stored = entry.states[static_cast<std::size_t>(op.state)];
+            release(stored.group);
+            stored = std::move(state);
+        }
+    };
+    const auto removeNode = [this, &storeState](Op& op) {
+        const auto node = qobject_cast<qan::Node*>(resolve(op.key));
+        if (node == nullptr)
+            return;
+        storeState(op, captureNode(*node));
+        unbind(node);
+        const auto group = qobject_cast<qan::Group*>(node);
+        if (group != nullptr)
+            _graph.removeGroup(group);
+        else
+            _graph.removeNode(node);
+    };
+    const auto removeEdge = [this, &storeState](Op& op) {
+        const auto edge = qobject_cast<qan::Edge*>(resolve(op.key));
+        if (edge == nullptr ||
+            edge->getSource() == nullptr ||
+            edge->getDestination() == nullptr)
+            return;
+        if (op.src == 0) {      // Inserted edge end points are keyed when edge is removed
+            op.src = keyOf(edge->getSource());
+            op.dst = keyOf(edge->getDestination());
+            acquire(op.src);
+            acquire(op.dst);
+        }
+        storeState(op, captureEdge(*edge));
+        unbind(edge);
+        _graph.removeEdge(edge);
+    };
+
+    _replaying = true;
+    _graph.beginUpdate();
+    const auto count = entry.ops.size();
+    for (std::size_t o = 0; o < count; ++o) {
+        auto& op = entry.ops[undo ? count - 1 - o : o];
+        const auto state = op.state >= 0 ? &entry.states[static_cast<std::size_t>(op.state)] : nullptr;
+        switch (op.type) {
+        case OpType::Move: {
+            const auto node = qobject_cast<qan::Node*>(resolve(op.key));
+            if (node != nullptr)
+                node->setGeometry(node->getGeometry().translated(undo ? -op.delta : op.delta));
+        }
+            break;
+        case OpType::Style: {
+            const auto style = state != nullptr ? (undo ? state->previousStyle.data() : state->style.data()) : nullptr;
+            const auto primitive = resolve(op.key);
+            if (const auto node = qobject_cast<qan::Node*>(primitive))
+                _graph.setNodeStyle(*node, qobject_cast<qan::NodeStyle*>(style));
+            else if (const auto edge = qobject_cast<qan::Edge*>(primitive))
+                _graph.setEdgeStyle(*edge, qobject_cast<qan::EdgeStyle*>(style));
+        }
+            break;
+        case OpType::InsertNode:
+        case OpType::RemoveNode:
+            if (undo == (op.type == OpType::InsertNode))
+                removeNode(op);
+            else if (state != nullptr)
+                rebind(op.key, restoreNode(*state));
+            break;
+        case OpType::InsertEdge:
+        case OpType::RemoveEdge:
+            if (undo == (op.type == OpType::InsertEdge))
+                removeEdge(op);
+            else if (state != nullptr)
+                rebind(op.key, restoreEdge(*state, op.src, op.dst));
+            break;
+        case OpType::Group:
+        case OpType::Ungroup: {
+            const auto node = qobject_cast<qan::Node*>(resolve(op.key));
+            const auto group = qobject_cast<qan::Group*>(resolve(op.src));
+            if (node == nullptr ||
+                group == nullptr)
+                break;
+            if (undo == (op.type == OpType::Group))
+                _graph.ungroupNode(node, group);
+            else
+                _graph.groupNode(group, node);
+        }
+            break;
+        }
+    }
+    _graph.endUpdate();
+    _replaying = false;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
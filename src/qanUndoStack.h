@@ -0,0 +1,260 @@
+/*
+ Copyright (c) 2008-2020, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanUndoStack.h
+// \author	benoit@destrat.io
+// \date	2026 10 15
+
+#pragma once
+
+// Std headers
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QQmlEngine>
+#include <QPointer>
+#include <QPointF>
+#include <QQmlComponent>
+#include <QRectF>
+#include <QString>
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+class Group;
+class Style;
+
+/*! \brief Graph undo stack recording compact deltas (see qan::Graph::undoStack).
+ *
+ * Entries store node position deltas, topology operations (node, group and edge insertion or removal, grouping)
+ * and style changes, not graph snapshots: memory use is proportional to the number of modified primitives
+ * and bounded by \c limit entries.
+ *
+ * Graph API operations are recorded automatically when \c enabled is true, a batch of operations could be
+ * recorded as a single entry with beginMacro() / endMacro():
+ * \code
+ * graph.undoStack.enabled = true
+ * graph.undoStack.beginMacro("Insert cluster")
+ * var group = graph.insertGroup()
+ * for (var n = 0; n < 10; n++)
+ *   graph.groupNode(group, graph.insertNode())
+ * graph.undoStack.endMacro()
+ * graph.undoStack.undo()     // Remove the whole cluster
+ * \endcode
+ * qan::Graph alignSelection*() methods, a mouse drag of a selection and a qan::Graph::beginUpdate() / endUpdate()
+ * batch are recorded as a single entry. Successive moves of the same node in a macro are merged.
+ *
+ * \note Nodes and groups removed and restored by undo() are inserted again as qan::Node or qan::Group with the
+ * delegate they have been removed with, edges with graph default delegate, their label, geometry, style and group
+ * are restored.
+ * \nosubgrouping
+ */
+class UndoStack : public QObject
+{
+    Q_OBJECT
+    /*! \name UndoStack Object Management *///---------------------------------
+    //@{
+public:
+    explicit UndoStack(qan::Graph& graph, QObject* parent = nullptr);
+    virtual ~UndoStack() override = default;
+    UndoStack(const UndoStack&) = delete;
+    UndoStack& operator=(const UndoStack&) = delete;
+
+public:
+    //! Enable recording (default to false, stack is cleared when recording is disabled).
+    Q_PROPERTY(bool enabled READ getEnabled WRITE setEnabled NOTIFY enabledChanged FINAL)
+    inline bool         getEnabled() const noexcept { return _enabled; }
+    void                setEnabled(bool enabled) noexcept;
+private:
+    bool                _enabled = false;
+signals:
+    void                enabledChanged();
+
+public:
+    //! Maximum number of entries, oldest entries are discarded (default to 500, minimum 1).
+    Q_PROPERTY(int limit READ getLimit WRITE setLimit NOTIFY limitChanged FINAL)
+    inline int          getLimit() const noexcept { return _limit; }
+    void                setLimit(int limit) noexcept;
+private:
+    int                 _limit = 500;
+signals:
+    void                limitChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Undo/Redo Management *///----------------------------------------
+    //@{
+public:
+    //! Undo last entry (or last entry before actual index).
+    Q_INVOKABLE void    undo() noexcept;
+    //! Redo next entry.
+    Q_INVOKABLE void    redo() noexcept;
+    //! Clear all entries.
+    Q_INVOKABLE void    clear() noexcept;
+
+    //! Record following operations as a single entry described by \c text until endMacro() is called (calls could be nested).
+    Q_INVOKABLE void    beginMacro(const QString& text) noexcept;
+    //! End a macro started with beginMacro(), macro is discarded if no operation has been recorded.
+    Q_INVOKABLE void    endMacro() noexcept;
+
+    //! RAII beginMacro() / endMacro() scope.
+    struct MacroScope {
+        MacroScope(UndoStack& undoStack, const QString& text) noexcept : _undoStack(undoStack) { _undoStack.beginMacro(text); }
+        ~MacroScope() noexcept { _undoStack.endMacro(); }
+        MacroScope(const MacroScope&) = delete;
+        UndoStack&  _undoStack;
+    };
+
+    Q_PROPERTY(int count READ getCount NOTIFY changed FINAL)
+    inline int          getCount() const noexcept { return static_cast<int>(_entries.size()); }
+    //! Index of next entry to redo (entries before index are undoable).
+    Q_PROPERTY(int index READ getIndex NOTIFY changed FINAL)
+    inline int          getIndex() const noexcept { return static_cast<int>(_index); }
+    Q_PROPERTY(bool canUndo READ canUndo NOTIFY changed FINAL)
+    inline bool         canUndo() const noexcept { return _index > 0 && _macroDepth == 0; }
+    Q_PROPERTY(bool canRedo READ canRedo NOTIFY changed FINAL)
+    inline bool         canRedo() const noexcept { return _index < _entries.size() && _macroDepth == 0; }
+    Q_PROPERTY(QString undoText READ getUndoText NOTIFY changed FINAL)
+    QString             getUndoText() const noexcept;
+    Q_PROPERTY(QString redoText READ getRedoText NOTIFY changed FINAL)
+    QString             getRedoText() const noexcept;
+signals:
+    void                changed();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Operations Recording *///----------------------------------------
+    //@{
+public:
+    //! True when operations are actually recorded (enabled and not undoing or redoing).
+    inline bool         isRecording() const noexcept { return _enabled && !_replaying; }
+
+    //! Record a \c node move of \c delta (in node item parent coordinates).
+    void                recordMove(qan::Node& node, QPointF delta) noexcept;
+    //! Record a node (or edge) \c primitive style change.
+    void                recordStyle(QObject& primitive, qan::Style* previousStyle, qan::Style* style) noexcept;
+    //! Record insertion of \c node (or group).
+    void                recordInsertNode(qan::Node& node) noexcept;
+    //! Record removal of \c node (or group), must be called before \c node is removed (adjacent edges removal should be recorded first).
+    void                recordRemoveNode(qan::Node& node) noexcept;
+    //! Record insertion of \c edge.
+    void                recordInsertEdge(qan::Edge& edge) noexcept;
+    //! Record removal of \c edge, must be called before \c edge is removed.
+    void                recordRemoveEdge(qan::Edge& edge) noexcept;
+    //! Record grouping of \c node in \c group.
+    void                recordGroup(qan::Node& node, qan::Group& group) noexcept;
+    //! Record ungrouping of \c node from \c group.
+    void                recordUngroup(qan::Node& node, qan::Group& group) noexcept;
+
+private:
+    enum class OpType : std::uint8_t {
+        Move,
+        Style,
+        InsertNode,
+        RemoveNode,
+        InsertEdge,
+        RemoveEdge,
+        Group,
+        Ungroup
+    };
+    //! Node or edge state, used to restore a removed primitive.
+    struct State {
+        QString                 label;
+        QRectF                  geometry;
+        QPointer<qan::Style>    style;
+        QPointer<qan::Style>    previousStyle;
+        QPointer<QQmlComponent> component;      // Node delegate
+        std::uint32_t           group = 0;
+        bool                    isGroup = false;
+    };
+    struct Op {
+        OpType          type = OpType::Move;
+        std::uint32_t   key = 0;        // Node, group or edge primitive key
+        std::uint32_t   src = 0;        // Edge source key, or group key for Group and Ungroup
+        std::uint32_t   dst = 0;        // Edge destination key
+        std::int32_t    state = -1;     // Index of primitive state in entry states
+        QPointF         delta;          // Move delta
+    };
+    struct Entry {
+        QString             text;
+        std::vector<Op>     ops;
+        std::vector<State>  states;
+    };
+
+    //! Return a key for \c primitive (keys are stable when a primitive is removed and restored).
+    std::uint32_t       keyOf(const QObject* primitive) noexcept;
+    QObject*            resolve(std::uint32_t key) const noexcept;
+    //! Bind existing \c key to a restored \c primitive.
+    void                rebind(std::uint32_t key, QObject* primitive) noexcept;
+    //! Forget \c primitive pointer (primitive is being removed, its key is kept while referenced).
+    void                unbind(const QObject* primitive) noexcept;
+    void                acquire(std::uint32_t key) noexcept;
+    void                release(std::uint32_t key) noexcept;
+    void                releaseEntry(const Entry& entry) noexcept;
+    //! Return last recorded operation (in actual macro or on top of stack), or nullptr.
+    const Op*           lastOp() const noexcept;
+
+    void                push(Op op, const QString& text, State* state = nullptr) noexcept;
+    //! Push \c entry on stack, discarding redo entries and oldest entries above \c limit.
+    void                commit(Entry&& entry) noexcept;
+    State               captureNode(qan::Node& node) noexcept;
+    State               captureEdge(qan::Edge& edge) noexcept;
+    qan::Node*          restoreNode(const State& state) noexcept;
+    qan::Edge*          restoreEdge(const State& state, std::uint32_t src, std::uint32_t dst) noexcept;
+    void                apply(Entry& entry, bool undo) noexcept;
+
+    qan::Graph&         _graph;
+    std::deque<Entry>   _entries;
+    std::size_t         _index = 0;
+    Entry               _macro;                 // Macro entry being recorded
+    int                 _macroDepth = 0;
+    bool                _replaying = false;
+
+    struct Reference {
+        QPointer<QObject>   primitive;
+        const QObject*      address = nullptr;  // Actual primitive address in _keys, nullptr when unbound
+        int                 count = 0;
+    };
+    std::unordered_map<std::uint32_t, Reference>        _references;
+    std::unordered_map<const QObject*, std::uint32_t>   _keys;
+    std::uint32_t       _nextKey = 1;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::UndoStack)
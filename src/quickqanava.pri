@@ -7,6 +7,9 @@ include(../QuickContainers/quickcontainers.pri)
 
 # With .pri inclusion, try to statically link all QML files in Qt ressource, do not
 DEFINES         += QUICKQANAVA_STATIC   # use QML module (calling QuickQanava::initialize() is mandatory...
+#DEFINES        += QUICKQANAVA_TRACE    # Compile hot path trace points (see qanTrace.h)
+#DEFINES        += QUICKQANAVA_STD_ADJACENCY    # Store nodes adjacency in std::vector (see qan::Config)
+#CONFIG         += qtquickcompiler              # Precompile QuickQanava_static.qrc QML files (qmlcachegen), reduce cold start
 DEPENDPATH      += $$PWD
 INCLUDEPATH     += $$PWD
 RESOURCES       += $$PWD/QuickQanava_static.qrc
@@ -17,10 +20,52 @@ HEADERS +=  $$PWD/QuickQanava.h             \
             $$PWD/qanGraphView.h            \
             $$PWD/qanEdge.h                 \
             $$PWD/qanEdgeItem.h             \
+            $$PWD/qanEdgeBatchRenderer.h    \
+            $$PWD/qanNodeBatchRenderer.h    \
+            $$PWD/qanLabelBatchRenderer.h   \
+            $$PWD/qanFastNodeItem.h         \
+            $$PWD/qanGraphExporter.h        \
+            $$PWD/qanTilePyramid.h          \
+            $$PWD/qanTileView.h             \
+            $$PWD/qanLayoutCache.h          \
+            $$PWD/qanImageCache.h           \
+            $$PWD/qanEdgeBundler.h          \
+            $$PWD/qanEdgeAggregator.h       \
+            $$PWD/qanOrthoRouter.h          \
             $$PWD/qanNode.h                 \
             $$PWD/qanNodeItem.h             \
             $$PWD/qanPortItem.h             \
             $$PWD/qanSelectable.h           \
+            $$PWD/qanSelectionOverlay.h     \
+            $$PWD/qanSpatialIndex.h         \
+            $$PWD/qanSelectionSet.h         \
+            $$PWD/qanLabelIndex.h           \
+            $$PWD/qanNodeColumns.h          \
+            $$PWD/qanEdgeGeometryKernel.h   \
+            $$PWD/qanSimdLane.h             \
+            $$PWD/qanLayoutJob.h            \
+            $$PWD/qanAbstractLayout.h       \
+            $$PWD/qanForceDirectedKernel.h  \
+            $$PWD/qanForceDirectedLayout.h  \
+            $$PWD/qanLayeredKernel.h        \
+            $$PWD/qanLayeredLayout.h        \
+            $$PWD/qanTreeKernel.h           \
+            $$PWD/qanTreeLayout.h           \
+            $$PWD/qanGroupLayout.h          \
+            $$PWD/qanFlowEngine.h           \
+            $$PWD/qanFlowExecutor.h         \
+            $$PWD/qanMemoryStats.h          \
+            $$PWD/qanTrace.h                \
+            $$PWD/qanPerformanceMonitor.h   \
+            $$PWD/qanGraphImporter.h        \
+            $$PWD/qanGraphBuilder.h         \
+            $$PWD/qanAdjacencyModel.h       \
+            $$PWD/qanGraphUpdateQueue.h     \
+            $$PWD/qanModelGraphAdapter.h    \
+            $$PWD/qanUndoStack.h            \
+            $$PWD/qanBoundingShape.h        \
+            $$PWD/qanEdgeGeometry.h         \
+            $$PWD/qanEdgeGeometryPolicy.h   \
             $$PWD/qanDraggable.h            \
             $$PWD/qanAbstractDraggableCtrl.h\
             $$PWD/qanDraggableCtrl.h        \
@@ -30,12 +75,15 @@ HEADERS +=  $$PWD/QuickQanava.h             \
             $$PWD/qanGroupItem.h            \
             $$PWD/qanGraph.h                \
             $$PWD/qanGraph.hpp              \
+            $$PWD/qanComponentCache.h       \
             $$PWD/qanStyle.h                \
             $$PWD/qanStyleManager.h         \
             $$PWD/qanNavigable.h            \
             $$PWD/qanNavigablePreview.h     \
             $$PWD/qanGrid.h                 \
             $$PWD/qanLineGrid.h             \
+            $$PWD/qanShaderGrid.h           \
+            $$PWD/qanEffectItem.h           \
             $$PWD/qanContainerAdapter.h     \
             $$PWD/qanBottomRightResizer.h
 
@@ -43,15 +91,53 @@ SOURCES +=  $$PWD/qanGraphView.cpp          \
             $$PWD/qanUtils.cpp              \
             $$PWD/qanEdge.cpp               \
             $$PWD/qanEdgeItem.cpp           \
+            $$PWD/qanEdgeBatchRenderer.cpp  \
+            $$PWD/qanNodeBatchRenderer.cpp  \
+            $$PWD/qanLabelBatchRenderer.cpp \
+            $$PWD/qanFastNodeItem.cpp       \
+            $$PWD/qanGraphExporter.cpp      \
+            $$PWD/qanTilePyramid.cpp        \
+            $$PWD/qanTileView.cpp           \
+            $$PWD/qanLayoutCache.cpp        \
+            $$PWD/qanImageCache.cpp         \
+            $$PWD/qanEdgeBundler.cpp        \
+            $$PWD/qanEdgeAggregator.cpp     \
+            $$PWD/qanOrthoRouter.cpp        \
             $$PWD/qanNode.cpp               \
             $$PWD/qanNodeItem.cpp           \
             $$PWD/qanPortItem.cpp           \
             $$PWD/qanSelectable.cpp         \
+            $$PWD/qanSelectionOverlay.cpp   \
+            $$PWD/qanSpatialIndex.cpp       \
+            $$PWD/qanSelectionSet.cpp       \
+            $$PWD/qanLabelIndex.cpp         \
+            $$PWD/qanNodeColumns.cpp        \
+            $$PWD/qanEdgeGeometryKernel.cpp \
+            $$PWD/qanAbstractLayout.cpp     \
+            $$PWD/qanForceDirectedKernel.cpp\
+            $$PWD/qanForceDirectedLayout.cpp\
+            $$PWD/qanLayeredKernel.cpp      \
+            $$PWD/qanLayeredLayout.cpp      \
+            $$PWD/qanTreeKernel.cpp         \
+            $$PWD/qanTreeLayout.cpp         \
+            $$PWD/qanGroupLayout.cpp        \
+            $$PWD/qanFlowEngine.cpp         \
+            $$PWD/qanFlowExecutor.cpp       \
+            $$PWD/qanTrace.cpp              \
+            $$PWD/qanPerformanceMonitor.cpp \
+            $$PWD/qanGraphImporter.cpp      \
+            $$PWD/qanGraphBuilder.cpp       \
+            $$PWD/qanAdjacencyModel.cpp     \
+            $$PWD/qanGraphUpdateQueue.cpp   \
+            $$PWD/qanModelGraphAdapter.cpp  \
+            $$PWD/qanUndoStack.cpp          \
+            $$PWD/qanBoundingShape.cpp      \
             $$PWD/qanDraggable.cpp          \
             $$PWD/qanDraggableCtrl.cpp      \
             $$PWD/qanConnector.cpp          \
             $$PWD/qanBehaviour.cpp          \
             $$PWD/qanGraph.cpp              \
+            $$PWD/qanComponentCache.cpp     \
             $$PWD/qanGroup.cpp              \
             $$PWD/qanGroupItem.cpp          \
             $$PWD/qanStyle.cpp              \
@@ -60,6 +146,8 @@ SOURCES +=  $$PWD/qanGraphView.cpp          \
             $$PWD/qanNavigablePreview.cpp   \
             $$PWD/qanGrid.cpp               \
             $$PWD/qanLineGrid.cpp           \
+            $$PWD/qanShaderGrid.cpp         \
+            $$PWD/qanEffectItem.cpp         \
             $$PWD/qanBottomRightResizer.cpp
 
 OTHER_FILES +=  $$PWD/QuickQanava                   \
@@ -91,4 +179,5 @@ OTHER_FILES +=  $$PWD/QuickQanava                   \
                 $$PWD/StyleListView.qml             \
                 $$PWD/VisualConnector.qml           \
                 $$PWD/LabelEditor.qml               \
+                $$PWD/PerformanceOverlay.qml        \
                 $$PWD/qmldir_static